@@ -4,11 +4,21 @@ SPDX-License-Identifier: MIT
 
 Converts CLIP vocabulary merges in a list of token number pairs.
 ref: https://github.com/openai/CLIP : clip/simple_tokenizer.py
+
+Usage:
+  python gencode_clip_merges.py > src/clip_merges.c.h
+  python gencode_clip_merges.py --hash > src/clip_merges_hash.c.h
+
+The second one is the hash table to find the merges (see clip.c).
 """
 import gzip
+import sys
 
 bpe_path = "bpe_simple_vocab_16e6.txt.gz"
 
+# Must match clip.c
+HASH_BITS = 17
+
 # Code copied almost verbatim from CLIP repo
 def bytes_to_unicode():
 	bs = list(range(ord("!"), ord("~")+1)) \
@@ -24,21 +34,45 @@ def bytes_to_unicode():
 	cs = [chr(n) for n in cs]
 	return bs, cs
 
-merges = gzip.open(bpe_path).read().decode("utf-8").split('\n')
-merges = merges[1:49152-256-2+1]
-merges = [tuple(merge.split()) for merge in merges]
+def merge_pairs():
+	merges = gzip.open(bpe_path).read().decode("utf-8").split('\n')
+	merges = merges[1:49152-256-2+1]
+	merges = [tuple(merge.split()) for merge in merges]
+
+	vocab = list(bytes_to_unicode()[1])
+	vocab = vocab + [v+'</w>' for v in vocab]
+	for merge in merges:
+		vocab.append(''.join(merge))
+	vocab.extend(['<|startoftext|>', '<|endoftext|>'])
+
+	encoder = dict(zip(vocab, range(len(vocab))))
+	#decoder = {v: k for k, v in encoder.items()}
+	#bpe_ranks = dict(zip(merges, range(len(merges))))
+
+	return [(encoder[left], encoder[right]) for left, right in merges]
 
-vocab = list(bytes_to_unicode()[1])
-vocab = vocab + [v+'</w>' for v in vocab]
-for merge in merges:
-	vocab.append(''.join(merge))
-vocab.extend(['<|startoftext|>', '<|endoftext|>'])
+def merge_hash(left, right):
+	k = (left << 16) | right
+	return ((k * 2654435761) & 0xffffffff) >> (32 - HASH_BITS)
 
-encoder = dict(zip(vocab, range(len(vocab))))
-decoder = {v: k for k, v in encoder.items()}
-#bpe_ranks = dict(zip(merges, range(len(merges))))
+def hash_table(pairs):
+	""" Open addressing with linear probing.
+	Each slot has the index of the merge plus one, zero if empty. """
+	assert len(pairs) < 0xffff
+	mask = (1 << HASH_BITS) - 1
+	table = [0] * (1 << HASH_BITS)
+	for i, (left, right) in enumerate(pairs):
+		h = merge_hash(left, right)
+		while table[h]: h = (h + 1) & mask
+		table[h] = i + 1
+	return table
 
-for left, right in merges:
-	l = encoder[left]
-	r = encoder[right]
-	print("{%d, %d}," % (l, r))
+if __name__ == "__main__":
+	pairs = merge_pairs()
+	if "--hash" in sys.argv[1:]:
+		table = hash_table(pairs)
+		for i in range(0, len(table), 16):
+			print(",".join(str(v) for v in table[i:i+16]) + ",")
+	else:
+		for l, r in pairs:
+			print("{%d, %d}," % (l, r))
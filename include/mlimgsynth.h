@@ -217,7 +217,8 @@ typedef enum MLIS_Option {
 
 	// Batch size (number of images to generate simultaneously).
 	// Increases memory usage, but should be faster to generating individually.
-	// Not implemented yet.
+	// Each image uses its own seed: seed + index.
+	// Access the images with mlis_image_get(ctx, index).
 	// Arg: (int)
 	MLIS_OPT_BATCH_SIZE = 10,
 
@@ -291,7 +292,9 @@ typedef enum MLIS_Option {
 	MLIS_OPT_VAE_TILE = 25,
 
 	// Split unet model in two parts to reduce the memory usage.
-	// Arg: true or false (int)
+	// 1: only one part in memory at a time, rebuilt on each step.
+	// 2: both parts kept during the generation, faster.
+	// Arg: 0, 1 or 2 (int)
 	MLIS_OPT_UNET_SPLIT = 26,
 
 	// Number CPU threads used by the backend.
@@ -299,6 +302,8 @@ typedef enum MLIS_Option {
 	MLIS_OPT_THREADS = 27,
 
 	// (debug) Control dumping of tensors and graphs information to files.
+	// Flags: 1: model tensors, 2: LoRA tensors, 4: computation graphs,
+	//        8: time of each graph op, as Chrome trace and text summary.
 	// Arg: (int)
 	MLIS_OPT_DUMP_FLAGS = 28,
 	
@@ -341,8 +346,61 @@ typedef enum MLIS_Option {
 	// Do not parse the prompt for attention emphasis and loras.
 	// Arg: true or false (int)
 	MLIS_OPT_NO_PROMPT_PARSE = 35,
+
+	// Keep the model weights in the backend memory between generations.
+	// Avoids reloading them each time, but the weights of all the sub-models
+	// (e.g. unet and vae) are kept in memory at the same time.
+	// Arg: true or false (int)
+	MLIS_OPT_KEEP_WEIGHTS = 36,
+
+	// Number of computation graphs kept ready for reuse (0 to disable).
+	// Saves the time to build and allocate the graphs when the same image
+	// size is used again, but the memory used by each one is kept.
+	// Arg: (int)
+	MLIS_OPT_GRAPH_CACHE = 37,
+
+	// Compute the UNet cross attention K/V projections of the prompt
+	// conditioning once per generation instead of on each step.
+	// Ignored with MLIS_OPT_UNET_SPLIT.
+	// Arg: true or false (int)
+	MLIS_OPT_UNET_KV_PRE = 38,
+
+	// Number of VAE tiles computed in parallel (with MLIS_OPT_VAE_TILE).
+	// Only with the CPU backend, each one uses its own compute memory.
+	// Default: 1.
+	// Arg: (int)
+	MLIS_OPT_VAE_TILE_WORKERS = 39,
+
+	// Image sink.
+	// If set, the decoded images are passed to this function in bands of
+	// rows as soon as they are ready, instead of being kept for
+	// mlis_image_get. With MLIS_OPT_VAE_TILE only one row of tiles is in
+	// memory at a time, so large images can be saved as they are decoded.
+	// Arg: MLIS_ImageSink
+	// Arg: user_data (void*)
+	MLIS_OPT_IMAGE_SINK = 40,
+
+	// Attention computed in chunks of this number of query tokens.
+	// Bounds the memory of the attention matrices in the UNet, VAE and CLIP,
+	// which dominate the compute memory with large images. 0 to disable.
+	// Arg: (int)
+	MLIS_OPT_ATTN_CHUNK = 41,
+
+	// Directory where the weights converted to the weight type are cached
+	// (e.g. quantized), to be memory mapped in later runs instead of
+	// converting them again. The cache file is named after the model and the
+	// weight type, it is updated after mlis_generate if new weights were
+	// converted, except while LoRA's are merged. Empty to disable.
+	// Arg: path (str)
+	MLIS_OPT_WEIGHT_CACHE = 42,
+
+	// Apply the LoRA's at runtime as additional low-rank computations,
+	// instead of merging them into the weights. Slower generation, but
+	// changing the LoRA's does not require to reload the model weights.
+	// Arg: enable (int)
+	MLIS_OPT_LORA_RUNTIME = 43,
 	
-	MLIS_OPT__LAST = 35,
+	MLIS_OPT__LAST = 43,
 } MLIS_Option;
 
 /* Structures */
@@ -407,6 +465,14 @@ typedef struct MLIS_Tensor {
  */
 typedef int (*MLIS_Callback)(void*, MLIS_Ctx*, const MLIS_Progress*);
 
+/* Image sink (callback)
+ * Receives the rows [y, y+band->h) of the image idx in the batch, which has a
+ * total height of h. The bands of each image arrive in order, starting with
+ * y = 0. mlis_infotext_get can be already used. Return < 0 to abort.
+ */
+typedef int (*MLIS_ImageSink)(void*, MLIS_Ctx*, const MLIS_Image* band,
+	int idx, unsigned y, unsigned h);
+
 /* Error handler (callback)
  */
 typedef void (*MLIS_ErrorHandler)(void*, MLIS_Ctx*, const MLIS_ErrorInfo*);
@@ -457,13 +523,13 @@ int mlis_option_get(MLIS_Ctx* ctx, MLIS_Option id, ...);
 int mlis_generate(MLIS_Ctx* ctx);
 
 /* Access the resulting image.
- * idx: indicates the image position (usually zero).
+ * idx: indicates the image position in the batch (usually zero).
  */
 MLIS_Image* mlis_image_get(MLIS_Ctx* ctx, int idx);
 
 /* Get textual description of the parameters used for the last generation.
  * Imitates stable-diffusion-webui create_infotext.
- * idx: indicates the image position (usually zero).
+ * idx: indicates the image position in the batch (usually zero).
  */
 const char* mlis_infotext_get(MLIS_Ctx* ctx, int idx);
 
@@ -114,7 +114,15 @@ MLIS_OPT_LOG_LEVEL = 32
 MLIS_OPT_MODEL_TYPE = 33
 MLIS_OPT_WEIGHT_TYPE = 34
 MLIS_OPT_NO_PROMPT_PARSE = 35
-MLIS_OPT__LAST = 35
+MLIS_OPT_KEEP_WEIGHTS = 36
+MLIS_OPT_GRAPH_CACHE = 37
+MLIS_OPT_UNET_KV_PRE = 38
+MLIS_OPT_VAE_TILE_WORKERS = 39
+MLIS_OPT_IMAGE_SINK = 40
+MLIS_OPT_ATTN_CHUNK = 41
+MLIS_OPT_WEIGHT_CACHE = 42
+MLIS_OPT_LORA_RUNTIME = 43
+MLIS_OPT__LAST = 43
 
 MLIS_CTEF_NO_NORM = 1
 
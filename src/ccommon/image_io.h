@@ -54,6 +54,7 @@ typedef struct {
 	int (*seek)(void*, struct ImageIO*, long, int);
 	int (*value_get)(void*, struct ImageIO*, int, void*, unsigned);
 	int (*value_set)(void*, struct ImageIO*, int, const void*, unsigned);
+	int (*rows)(void*, struct ImageIO*, const Image*, unsigned, unsigned);
 } ImageCodecSub;
 
 typedef struct {
@@ -132,6 +133,20 @@ int imgio_save(ImageIO* obj, const Image* img) {
 	IMGIO_CODEC_CALL(op, (Image*)img)
 }
 
+/**
+Save an image incrementally in bands of rows, from top to bottom.
+img contains the rows [y, y+img->h) of an image of height h_total.
+The first call (y=0) starts the image, the one that reaches h_total ends it.
+Only the codecs with the rows function (e.g. png, jpeg) support it.
+*/
+static inline
+int imgio_save_rows(ImageIO* obj, const Image* img, unsigned y,
+	unsigned h_total)
+{
+	if (~obj->oflags & IMG_OF_SAVE) return IMG_ERROR_UNSUPPORTED_FUNCTION;
+	IMGIO_CODEC_CALL(rows, img, y, h_total)
+}
+
 static inline
 int imgio_seek(ImageIO* obj, long offset, int mode) {
 	IMGIO_CODEC_CALL(seek, offset, mode)
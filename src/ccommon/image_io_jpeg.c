@@ -303,12 +303,20 @@ int imgio_jpeg_load_op(CodecJpegLoad* codec, ImageIO* imgio, Image* img)
 /*
 	Save
 */
-int imgio_jpeg_save_op(CodecJpegSave* codec, ImageIO* imgio, Image* img)
+// Sets the parameters and writes the header and the metadata
+static
+int imgio_jpeg_save_start(CodecJpegSave* codec, ImageIO* imgio,
+	const Image* img, unsigned h_total)
 {
 	int r=0;
 	DynStr tmps=NULL;
 	struct jpeg_compress_struct * cinfo = &codec->cinfo;
 
+	if (codec->started) {
+		jpeg_abort_compress(cinfo);
+		codec->started = false;
+	}
+
 	if (setjmp(codec->jerr.escape)) {
 		/* If we get here, libjpeg found an error */
 		r = IMG_ERROR_SAVE; goto end;
@@ -316,7 +324,7 @@ int imgio_jpeg_save_op(CodecJpegSave* codec, ImageIO* imgio, Image* img)
 	if (jpeg_stream_dest(cinfo, imgio->s) < 0) { r=IMG_ERROR_SAVE; goto end; }
 
 	cinfo->image_width = img->w;
-	cinfo->image_height = img->h;
+	cinfo->image_height = h_total;
 
 	switch (img->format) {
 	case IMG_FORMAT_RGB:
@@ -334,6 +342,7 @@ int imgio_jpeg_save_op(CodecJpegSave* codec, ImageIO* imgio, Image* img)
 	jpeg_set_defaults(cinfo);
 	jpeg_set_quality(cinfo, codec->quality, TRUE);
 	jpeg_start_compress(cinfo, TRUE);
+	codec->started = true;
 
 	vec_forp(struct CodecJpegText, codec->metadata, p, 0) {
 		dstr_copyd(tmps, p->key);
@@ -342,20 +351,59 @@ int imgio_jpeg_save_op(CodecJpegSave* codec, ImageIO* imgio, Image* img)
 		jpeg_write_marker(cinfo, JPEG_COM, (const JOCTET*)tmps, dstr_count(tmps));
 	}
 
+	r = IMG_RESULT_OK;
+end:
+	dstr_free(tmps);
+	return r;
+}
+
+int imgio_jpeg_save_rows(CodecJpegSave* codec, ImageIO* imgio,
+	const Image* img, unsigned y, unsigned h_total)
+{
+	int r=0;
+	struct jpeg_compress_struct * cinfo = &codec->cinfo;
+
+	if (y == 0) {
+		r = imgio_jpeg_save_start(codec, imgio, img, h_total);
+		if (r < 0) goto end;
+	}
+	else if (!codec->started || y != cinfo->next_scanline)
+		return IMG_ERROR_PARAMS;
+
+	if (cinfo->next_scanline + img->h > cinfo->image_height) {
+		r = IMG_ERROR_PARAMS; goto end;
+	}
+
+	if (setjmp(codec->jerr.escape)) {
+		/* If we get here, libjpeg found an error */
+		r = IMG_ERROR_SAVE; goto end;
+	}
+
 	JSAMPROW rowptr[1];
-	while (cinfo->next_scanline < cinfo->image_height) {
-		rowptr[0] = (JSAMPROW)img->data + cinfo->next_scanline * img->pitch;
+	for (unsigned i=0; i<img->h; ++i) {
+		rowptr[0] = (JSAMPROW)img->data + i * img->pitch;
 		jpeg_write_scanlines(cinfo, rowptr, 1);
 	}
 
-	jpeg_finish_compress(cinfo);
+	if (cinfo->next_scanline == cinfo->image_height) {
+		jpeg_finish_compress(cinfo);
+		codec->started = false;
+	}
 
 	r = IMG_RESULT_OK;
 end:
-	dstr_free(tmps);
+	if (r < 0 && codec->started) {
+		jpeg_abort_compress(cinfo);
+		codec->started = false;
+	}
 	return r;
 }
 
+int imgio_jpeg_save_op(CodecJpegSave* codec, ImageIO* imgio, Image* img)
+{
+	return imgio_jpeg_save_rows(codec, imgio, img, 0, img->h);
+}
+
 int imgio_jpeg_save_value_set(CodecJpegSave* codec, ImageIO* imgio,
 	int id, const void* buf, unsigned bufsz)
 {
@@ -397,7 +445,9 @@ const ImageCodec img_codec_jpeg = {
 		NULL, //seek
 		NULL, //value_get
 		(int (*)(void*, ImageIO*, int, const void*, unsigned))
-			imgio_jpeg_save_value_set
+			imgio_jpeg_save_value_set,
+		(int (*)(void*, ImageIO*, const Image*, unsigned, unsigned))
+			imgio_jpeg_save_rows,
 	},
 	"JPEG", "jpeg"
 };
@@ -25,6 +25,7 @@ struct CodecJpegSave {
 
 	struct CodecJpegText { DynStr key, value; } *metadata;  //vector
 	int quality;
+	bool started;  //incremental save in progress
 };
 #endif
 
@@ -40,6 +41,8 @@ int  imgio_jpeg_load_op(CodecJpegLoad* codec, ImageIO* imgio, Image* img);
 int  imgio_jpeg_save_init(CodecJpegSave* codec, ImageIO* imgio);
 void imgio_jpeg_save_free(CodecJpegSave* codec, ImageIO* imgio);
 int  imgio_jpeg_save_op(CodecJpegSave* codec, ImageIO* imgio, Image* img);
+int  imgio_jpeg_save_rows(CodecJpegSave* codec, ImageIO* imgio,
+		const Image* img, unsigned y, unsigned h_total);
 
 extern const ImageCodec img_codec_jpeg;
 
@@ -210,8 +210,19 @@ int imgio_png_save_init(CodecPng* S, ImageIO* imgio)
 	return 0;
 }
 
+static
+void imgio_png_save_end(CodecPng* S)
+{
+	if (S->png_ptr)
+		png_destroy_write_struct(&S->png_ptr, S->info_ptr ? &S->info_ptr : NULL);
+	S->png_ptr = NULL;
+	S->info_ptr = NULL;
+	S->y = 0;
+}
+
 void imgio_png_save_free(CodecPng* S, ImageIO* imgio)
 {
+	imgio_png_save_end(S);
 	vec_for(S->metadata,i,0) {
 		dstr_free(S->metadata[i].value);
 		dstr_free(S->metadata[i].key);
@@ -219,25 +230,27 @@ void imgio_png_save_free(CodecPng* S, ImageIO* imgio)
 	vec_free(S->metadata);
 }
 
-int imgio_png_save_op(CodecPng* S, ImageIO* imgio, Image* img)
+// Writes the header and the metadata
+static
+int imgio_png_save_start(CodecPng* S, ImageIO* imgio, const Image* img,
+	unsigned h_total)
 {
 	int R = IMG_RESULT_OK;
-	png_structp png_ptr=NULL;
-	png_infop info_ptr=NULL;
 	png_text *texts=NULL;
-	png_bytep *row_pointers=NULL;
 
-	png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL,NULL,NULL);
-	if (!png_ptr) RETURN( IMG_ERROR_OUT_OF_MEMORY );
+	imgio_png_save_end(S);
+
+	S->png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL,NULL,NULL);
+	if (!S->png_ptr) RETURN( IMG_ERROR_OUT_OF_MEMORY );
 	//TODO: custom allocator?
 
-	info_ptr = png_create_info_struct(png_ptr);
-	if (!info_ptr) RETURN ( IMG_ERROR_OUT_OF_MEMORY );
+	S->info_ptr = png_create_info_struct(S->png_ptr);
+	if (!S->info_ptr) RETURN ( IMG_ERROR_OUT_OF_MEMORY );
 
-    png_set_write_fn(png_ptr, imgio->s, png_write_data, png_flush_data);
+    png_set_write_fn(S->png_ptr, imgio->s, png_write_data, png_flush_data);
 
 	// Set up error handling
-	if (setjmp(png_jmpbuf(png_ptr)))
+	if (setjmp(png_jmpbuf(S->png_ptr)))
 	{	// libpng jumps here in case of error
 		RETURN( IMG_ERROR_SAVE );
 	}
@@ -259,13 +272,13 @@ int imgio_png_save_op(CodecPng* S, ImageIO* imgio, Image* img)
 		RETURN( IMG_ERROR_UNSUPPORTED_FORMAT );
 	}
 
-	png_set_IHDR(png_ptr, info_ptr, img->w, img->h,
+	png_set_IHDR(S->png_ptr, S->info_ptr, img->w, h_total,
 		bit_depth, color_type, PNG_INTERLACE_NONE,
 		PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
 
 	// Configure compression
 	if (S->comp_lvl > 0)
-		png_set_compression_level(png_ptr, S->comp_lvl);
+		png_set_compression_level(S->png_ptr, S->comp_lvl);
 
 	// Set meta data text
 	unsigned ntext = vec_count(S->metadata);
@@ -279,27 +292,55 @@ int imgio_png_save_op(CodecPng* S, ImageIO* imgio, Image* img)
 				.text_length = dstr_count(S->metadata[i].value),
 			};
 		}
-		png_set_text(png_ptr, info_ptr, texts, ntext);
+		png_set_text(S->png_ptr, S->info_ptr, texts, ntext);
 	}
 
-	// Allocate and store pointers to each row
-	row_pointers = alloc_alloc(IMAGE_IO_ALLOCATOR, sizeof(png_bytep) * img->h);
+	png_write_info(S->png_ptr, S->info_ptr);
 
-	for (png_uint_32 i=0; i<img->h; ++i)
-		row_pointers[i] = img->data + img->pitch * i;
+end:
+	alloc_free(IMAGE_IO_ALLOCATOR, texts);
+	if (R < 0) imgio_png_save_end(S);
+	return R;
+}
+
+int imgio_png_save_rows(CodecPng* S, ImageIO* imgio, const Image* img,
+	unsigned y, unsigned h_total)
+{
+	int R = IMG_RESULT_OK;
+
+	if (y == 0) {
+		R = imgio_png_save_start(S, imgio, img, h_total);
+		if (R < 0) return R;
+	}
+	else if (!S->png_ptr || y != S->y)
+		return IMG_ERROR_PARAMS;
+
+	if (S->y + img->h > h_total) RETURN( IMG_ERROR_PARAMS );
 
-	png_set_rows(png_ptr, info_ptr, row_pointers);
+	if (setjmp(png_jmpbuf(S->png_ptr)))
+	{	// libpng jumps here in case of error
+		RETURN( IMG_ERROR_SAVE );
+	}
 
-	png_write_png(png_ptr, info_ptr, PNG_TRANSFORM_IDENTITY, NULL);
+	for (unsigned i=0; i<img->h; ++i)
+		png_write_row(S->png_ptr, img->data + img->pitch * i);
+	S->y += img->h;
+
+	if (S->y == h_total) {
+		png_write_end(S->png_ptr, S->info_ptr);
+		imgio_png_save_end(S);
+	}
 
 end:
-	alloc_free(IMAGE_IO_ALLOCATOR, row_pointers);
-	alloc_free(IMAGE_IO_ALLOCATOR, texts);
-	if (png_ptr)
-		png_destroy_write_struct(&png_ptr, info_ptr ? &info_ptr : NULL);
+	if (R < 0) imgio_png_save_end(S);
 	return R;
 }
 
+int imgio_png_save_op(CodecPng* S, ImageIO* imgio, Image* img)
+{
+	return imgio_png_save_rows(S, imgio, img, 0, img->h);
+}
+
 int imgio_png_value_set(CodecPng* S, ImageIO* imgio,
 	int id, const void* buf, unsigned bufsz)
 {
@@ -339,6 +380,8 @@ const ImageCodec img_codec_png = {
 		NULL,  //value_get
 		(int (*)(void*, ImageIO*, int, const void*, unsigned))
 			imgio_png_value_set,
+		(int (*)(void*, ImageIO*, const Image*, unsigned, unsigned))
+			imgio_png_save_rows,
 	},
 	"PNG", "png"
 };
@@ -6,9 +6,14 @@
 
 #ifdef IMGIO_PNG_IMPL
 #include "vector.h"
+#include <png.h>
 struct CodecPng {
 	struct CodecPngText { DynStr key, value; } *metadata;  //vector
 	int comp_lvl;
+	// Incremental save state
+	png_structp png_ptr;
+	png_infop info_ptr;
+	unsigned y;  //next row
 };
 #endif
 
@@ -21,6 +26,8 @@ int imgio_png_load(void* self, ImageIO* imgio, Image* img);
 int  imgio_png_save_init(CodecPng* S, ImageIO* imgio);
 void imgio_png_save_free(CodecPng* S, ImageIO* imgio);
 int  imgio_png_save_op(CodecPng* S, ImageIO* imgio, Image* img);
+int  imgio_png_save_rows(CodecPng* S, ImageIO* imgio, const Image* img,
+		unsigned y, unsigned h_total);
 int  imgio_png_value_set(CodecPng* S, ImageIO* imgio,
 		int id, const void* buf, unsigned bufsz);
 
@@ -20,32 +20,49 @@ double box_muller(double x, double y)
 	return sqrt(-2.0 * log(u)) * sin(v);
 }
 
-void rng_philox_randn(RngPhilox* S, unsigned n, float* out)
+// Counters processed together, the rounds loop can be vectorized
+#define RNG_PHILOX_LANES  8
+
+void rng_philox_randn_at(const RngPhilox* S, unsigned i0, unsigned n,
+	float* out)
 {
-	uint32_t cnt[4], key[2];
-	for (unsigned i=0; i<n; ++i) {
-		cnt[0] = S->offset;
-		cnt[1] = 0;
-		cnt[2] = i;
-		cnt[3] = 0;
+	enum { L = RNG_PHILOX_LANES };
+	uint32_t c0[L], c1[L], c2[L], c3[L];
+	for (unsigned b=0; b<n; b+=L) {
+		for (unsigned j=0; j<L; ++j) {
+			c0[j] = S->offset;
+			c1[j] = 0;
+			c2[j] = i0 + b + j;
+			c3[j] = 0;
+		}
 
-		key[0] = S->seed;
-		key[1] = S->seed>>32;
+		uint32_t key0 = S->seed,
+		         key1 = S->seed>>32;
 
 		for (unsigned r=0; r<10; ++r) {
 			// Round
-			uint64_t v1 = (uint64_t)cnt[0] * philox_m[0];
-			uint64_t v2 = (uint64_t)cnt[2] * philox_m[1];
-			cnt[0] = (uint32_t)(v2>>32) ^ cnt[1] ^ key[0];
-			cnt[1] = v2;
-			cnt[2] = (uint32_t)(v1>>32) ^ cnt[3] ^ key[1];
-			cnt[3] = v1;
-
-			key[0] += philox_w[0];
-			key[1] += philox_w[1];
+			for (unsigned j=0; j<L; ++j) {
+				uint64_t v1 = (uint64_t)c0[j] * philox_m[0];
+				uint64_t v2 = (uint64_t)c2[j] * philox_m[1];
+				c0[j] = (uint32_t)(v2>>32) ^ c1[j] ^ key0;
+				c1[j] = v2;
+				c2[j] = (uint32_t)(v1>>32) ^ c3[j] ^ key1;
+				c3[j] = v1;
+			}
+
+			key0 += philox_w[0];
+			key1 += philox_w[1];
 		}
 
-		out[i] = box_muller(cnt[0], cnt[1]);
+		// Scalar libm to keep the same results on every platform
+		unsigned m = n-b < L ? n-b : L;
+		for (unsigned j=0; j<m; ++j)
+			out[b+j] = box_muller(c0[j], c1[j]);
 	}
+}
+
+void rng_philox_randn(RngPhilox* S, unsigned n, float* out)
+{
+	rng_philox_randn_at(S, 0, n, out);
 	S->offset++;
 }
@@ -12,8 +12,18 @@ typedef struct {
     uint32_t offset;	
 } RngPhilox;
 
+/* Fills out with n normal random numbers and advances the offset.
+ */
 void rng_philox_randn(RngPhilox* S, unsigned n, float* out);
 
+/* Generates the numbers [i0,i0+n) of the sequence that rng_philox_randn would
+ * generate with the current state, without changing it.
+ * Each number depends only in the seed, offset and position, so slices can
+ * be generated independently (e.g. in several threads) with the same result.
+ */
+void rng_philox_randn_at(const RngPhilox* S, unsigned i0, unsigned n,
+	float* out);
+
 extern RngPhilox g_rng;
 
 static inline
@@ -1,6 +1,9 @@
 /* Copyright 2024, Alejandro A. García <aag@zorzal.net>
  * SPDX-License-Identifier: Zlib
  */
+#if defined(__unix__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L  //posix_fadvise, posix_madvise
+#endif
 #include "stream.h"
 #include "alloc.h"
 #include <limits.h>
@@ -1030,13 +1033,34 @@ int stream_posix_mmap_flush(StreamInt* S)
 	return r<0 ? STREAM_E_FLUSH : 0;
 }
 
+int stream_posix_mmap_control(StreamInt* S, int cmd, va_list ap)
+{
+	uint8_t *addr = S->p[0];
+	size_t size = (size_t)S->p[1];
+
+	if (cmd == STREAM_CMD_PREFETCH)
+	{
+		uint64_t beg = va_arg(ap, uint64_t),
+		         end = beg + va_arg(ap, uint64_t);
+		if (end > size) end = size;
+		if (!(beg < end)) return 0;
+		// The address must be page aligned
+		long psz = sysconf(_SC_PAGESIZE);
+		if (psz > 0) beg -= beg % psz;
+		int r = posix_madvise(addr + beg, end - beg, POSIX_MADV_WILLNEED);
+		return r ? STREAM_E_CONTROL : 0;
+	}
+	else
+		return STREAM_E_CONTROL;
+}
+
 const StreamClass stream_class_posix_mmap = {
 	NULL,
 	NULL,
 	stream_posix_mmap_close,
 	NULL,
 	stream_posix_mmap_flush,
-	NULL,
+	stream_posix_mmap_control,
 	"posix-mmap"
 };
 
@@ -1187,6 +1211,13 @@ int stream_posix_control(StreamInt* S, int cmd, va_list ap)
 
 		return r;
 	}
+	else if (cmd == STREAM_CMD_PREFETCH)
+	{
+		uint64_t offset = va_arg(ap, uint64_t),
+		         size   = va_arg(ap, uint64_t);
+		int r = posix_fadvise(fd, offset, size, POSIX_FADV_WILLNEED);
+		return r ? STREAM_E_CONTROL : 0;
+	}
 	else
 		return STREAM_E_CONTROL;
 }
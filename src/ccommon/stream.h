@@ -369,6 +369,12 @@ enum {
 	 * Returns the previous state.
 	 */
 	STREAM_CMD_TERM_RAW		= 2,
+	/* Hint that a range of the stream will be read soon, so that the system
+	 * may start reading it in the background (e.g. readahead).
+	 * Arg.1 (uint64_t) offset, Arg.2 (uint64_t) size.
+	 * Returns 0 on success.
+	 */
+	STREAM_CMD_PREFETCH		= 3,
 };
 
 /*
@@ -7,6 +7,10 @@
 #include "ccommon/bisect.h"
 #include <inttypes.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifdef TENSORSTORE_USE_GGML
 #include "ggml.h"
 #else
@@ -181,13 +185,24 @@ uint64_t tstore_tensor_size(const TSTensorEntry* S)
 	return size * attr->sz_m / attr->sz_d;
 }
 
+/* Data conversion */
+
+int g_tstore_n_thread = 0;
+
+// Elements per task, a multiple of every quantization block size
+#define TS_CONV_BLOCK  (1<<16)
+// Elements of the intermediate F32 buffer (on the stack)
+#define TS_CONV_TMP  1024
+
 static
-int data_convert(int dtype, int stype, size_t n, void* dst, const void* src)
+int data_convert_block(int dtype, int stype, size_t n, void* dst,
+	const void* src)
 {
 #ifdef TENSORSTORE_USE_GGML
 	//TODO: one ggml_init is required for some of this to work
 	const TSDTypeAttr *dta = tstore_dtype_attr(dtype);
 	const TSDTypeAttr *sta = tstore_dtype_attr(stype);
+	float tmp[TS_CONV_TMP];
 	if (dtype == TS_DTYPE_F32 && stype == TS_DTYPE_F16) {
 		ggml_fp16_to_fp32_row(src, dst, n);
 	}
@@ -198,10 +213,11 @@ int data_convert(int dtype, int stype, size_t n, void* dst, const void* src)
 		ggml_bf16_to_fp32_row(src, dst, n);
 	}
 	else if (dtype == TS_DTYPE_F16 && stype == TS_DTYPE_BF16) {
-		void *tmp = alloc_alloc(TENSORSTORE_ALLOCATOR, n*4);
-		ggml_bf16_to_fp32_row(src, tmp, n);
-		ggml_fp32_to_fp16_row(tmp, dst, n);
-		alloc_free(TENSORSTORE_ALLOCATOR, tmp);
+		for (size_t i=0; i<n; i+=TS_CONV_TMP) {
+			size_t m = n-i < TS_CONV_TMP ? n-i : TS_CONV_TMP;
+			ggml_bf16_to_fp32_row((const ggml_bf16_t*)src + i, tmp, m);
+			ggml_fp32_to_fp16_row(tmp, (ggml_fp16_t*)dst + i, m);
+		}
 	}
 	else if (dtype == TS_DTYPE_F32 && stype == TS_DTYPE_F64) {
 		for (size_t i=0; i<n; ++i)
@@ -212,11 +228,13 @@ int data_convert(int dtype, int stype, size_t n, void* dst, const void* src)
 		if (r == 0) return -1;
 	}
 	else if (dta->sz_d > 1 && stype == TS_DTYPE_F16) {  //quant
-		void *tmp = alloc_alloc(TENSORSTORE_ALLOCATOR, n*4);
-		ggml_fp16_to_fp32_row(src, tmp, n);
-		size_t r = ggml_quantize_chunk(dta->ggml, tmp, dst, 0, 1, n, NULL);
-		alloc_free(TENSORSTORE_ALLOCATOR, tmp);
-		if (r == 0) return -1;
+		for (size_t i=0; i<n; i+=TS_CONV_TMP) {
+			size_t m = n-i < TS_CONV_TMP ? n-i : TS_CONV_TMP;
+			ggml_fp16_to_fp32_row((const ggml_fp16_t*)src + i, tmp, m);
+			size_t r = ggml_quantize_chunk(dta->ggml, tmp,
+				(char*)dst + i / dta->sz_d * dta->sz_m, 0, 1, m, NULL);
+			if (r == 0) return -1;
+		}
 	}
 	else if (sta->sz_d > 1 && dtype == TS_DTYPE_F32) {  //dequant
 		const struct ggml_type_traits *ggml_sta = ggml_get_type_traits(sta->ggml);
@@ -253,6 +271,38 @@ int data_convert(int dtype, int stype, size_t n, void* dst, const void* src)
 	return 1;
 }
 
+/* Converts n elements. Large tensors are split in blocks converted in
+ * parallel, the blocks are independent for all the types (the quantization
+ * works on blocks of at most 256 elements).
+ */
+static
+int data_convert(int dtype, int stype, size_t n, void* dst, const void* src)
+{
+	const TSDTypeAttr *dta = tstore_dtype_attr(dtype);
+	const TSDTypeAttr *sta = tstore_dtype_attr(stype);
+	long nb = (n + TS_CONV_BLOCK-1) / TS_CONV_BLOCK;
+	int r=1;
+#ifdef _OPENMP
+	int nt = g_tstore_n_thread > 0 ? g_tstore_n_thread : omp_get_max_threads();
+	if (nt > nb) nt = nb;
+	#pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+	for (long b=0; b<nb; ++b) {
+		size_t i0 = b * TS_CONV_BLOCK,
+		       i1 = i0 + TS_CONV_BLOCK < n ? i0 + TS_CONV_BLOCK : n;
+		if (data_convert_block(dtype, stype, i1-i0,
+			(char*)dst + i0 / dta->sz_d * dta->sz_m,
+			(const char*)src + i0 / sta->sz_d * sta->sz_m) < 0)
+		{
+#ifdef _OPENMP
+			#pragma omp critical (tstore_convert_error)
+#endif
+			r = -1;
+		}
+	}
+	return r;
+}
+
 int tstore_tensor_data_get(TSTensorEntry* S, TSDType dtype, int flags, 
 	TSTensorData* out)
 {
@@ -262,11 +312,17 @@ int tstore_tensor_data_get(TSTensorEntry* S, TSDType dtype, int flags,
 
 	tstore_tdata_free(out);
 		
-	//TODO: write flag?
 	BISECT_RIGHT_DECL(found, idx, 0, vec_count(S->cache),
 		S->cache[i_].dtype - dtype);
 	if (found) {
-		*out = S->cache[idx];
+		TSTensorData *d = &S->cache[idx];
+		if (f_write && !d->ownmem) {  //e.g. mmap'd, replace with a copy
+			void *data = alloc_alloc(TENSORSTORE_ALLOCATOR, d->size);
+			memcpy(data, d->data, d->size);
+			d->data = data;
+			d->ownmem = true;
+		}
+		*out = *d;
 		return 1;
 	}
 
@@ -322,6 +378,98 @@ end:
 	return R;
 }
 
+/* Conversion of one tensor for tstore_tensors_convert.
+ * The stream reads and the allocations are serialized, the conversions are
+ * not. A placeholder entry (data=NULL) is inserted in the cache first to skip
+ * repeated requests.
+ */
+static
+int tstore_tensor_convert_par(TSTensorEntry* S, TSDType dtype)
+{
+	int R=1;
+	const TSDTypeAttr *dta = tstore_dtype_attr(dtype);
+	const TSDTypeAttr *sta = tstore_dtype_attr(S->dtype);
+	size_t n = tstore_tensor_count(S),
+	       sz = n * dta->sz_m / dta->sz_d;
+	const void *src=NULL;
+	void *data=NULL, *tmp=NULL;
+	bool inserted=false;
+
+#ifdef _OPENMP
+	#pragma omp critical (tstore_io)
+#endif
+	{
+		BISECT_RIGHT_DECL(found, idx, 0, vec_count(S->cache),
+			S->cache[i_].dtype - dtype);
+		if (found) {}  //done or in progress
+		else if (!(dta->valid)) R = -1;
+		else if (stream_seek(S->stm, S->offset, 0) < 0 ||
+			stream_read_prep(S->stm, S->size) < S->size) R = -2;
+		else {
+			src = stream_buffer_get(S->stm, NULL);
+			data = alloc_alloc(TENSORSTORE_ALLOCATOR, sz);
+			vec_insert(S->cache, idx, 1, &((TSTensorData){ dtype }));
+			inserted = true;
+			// Only the memory mapped streams keep the buffer valid,
+			// otherwise the source is copied to convert it outside
+			if (!stream_mmap_is(S->stm)) {
+				tmp = alloc_alloc(TENSORSTORE_ALLOCATOR, S->size);
+				memcpy(tmp, src, S->size);
+				src = tmp;
+			}
+		}
+	}
+
+	if (src && data_convert(dtype, S->dtype, n, data, src) < 0) R = -3;
+
+#ifdef _OPENMP
+	#pragma omp critical (tstore_io)
+#endif
+	if (inserted) {
+		if (tmp) alloc_free(TENSORSTORE_ALLOCATOR, tmp);
+		BISECT_RIGHT_DECL(found, idx, 0, vec_count(S->cache),
+			S->cache[i_].dtype - dtype);
+		(void)found;  //the placeholder
+		if (R < 0) {
+			vec_remove(S->cache, idx, 1);
+			alloc_free(TENSORSTORE_ALLOCATOR, data);
+		}
+		else
+			S->cache[idx] = (TSTensorData){ dtype, data, sz,
+				.ownmem=true, .perm=true };
+	}
+	if (R == -1)
+		log_error("invalid target tensor type %u", dtype);
+	else if (R == -2)
+		log_error("read %"PRIu64" bytes at %"PRIu64, S->size, S->offset);
+	else if (R == -3)
+		log_error("unsupported conversion from %s to %s",
+			sta->name, dta->name);
+	return R;
+}
+
+int tstore_tensors_convert(size_t n, TSTensorEntry*const* ents,
+	const TSDType* dtypes)
+{
+	int R=1;
+#ifdef _OPENMP
+	int nt = g_tstore_n_thread > 0 ? g_tstore_n_thread : omp_get_max_threads();
+	if (nt > (long)n) nt = n;
+	#pragma omp parallel for num_threads(nt) schedule(dynamic) if(nt > 1)
+#endif
+	for (long i=0; i<(long)n; ++i) {
+		if (R < 0 || dtypes[i] == ents[i]->dtype) continue;
+		int r = tstore_tensor_convert_par(ents[i], dtypes[i]);
+		if (r < 0) {
+#ifdef _OPENMP
+			#pragma omp critical (tstore_convert_error)
+#endif
+			R = r;
+		}
+	}
+	return R;
+}
+
 /* Formats register */
 
 #ifdef TENSORSTORE_FMT_GGUF
@@ -525,3 +673,76 @@ int tstore_cache_clear(TensorStore* S)
 	}
 	return 1;
 }
+
+/* Last converted data in the cache of a tensor, NULL if none */
+static
+const TSTensorData* tstore_tensor_cache_conv(const TSTensorEntry* e)
+{
+	vec_forr(e->cache, i)
+		if (e->cache[i].dtype != e->dtype) return &e->cache[i];
+	return NULL;
+}
+
+int tstore_cache_write(TensorStore* S, TensorStore* dst, Stream* stm,
+	const TensorStoreFormat* fmt)
+{
+	int R=1;
+	const TSTensorData **tds=NULL;  //vector
+
+	vec_forp(TSTensorEntry, S->tensors, e, 0) {
+		const TSTensorData *td = tstore_tensor_cache_conv(e);
+		if (!td) continue;
+		TSTensorEntry n = *e;
+		n.dtype = td->dtype;
+		n.cache = NULL;
+		if (tstore_tensor_size(&n) != td->size)
+			ERROR_LOG(TS_E_OVERFLOW, "cache '%s': invalid size %zu",
+				id_str(e->key), td->size);
+		tstore_tensor_addk(dst, e->key, &n);
+		vec_push(tds, td);
+	}
+
+	TRY( tstore_write(dst, stm, fmt, NULL) );
+
+	vec_forp(TSTensorEntry, dst->tensors, e, 0) {
+		const TSTensorData *td = tds[e - dst->tensors];
+		TRY_LOG( stream_seek(stm, e->offset, 0), "cache write seek" );
+		TRY_LOG( stream_write_chk(stm, td->size, td->data), "cache write" );
+	}
+	TRY( stream_flush(stm) );
+
+	R = vec_count(tds);
+end:
+	vec_free(tds);
+	return R;
+}
+
+int tstore_cache_read(TensorStore* S, TensorStore* src)
+{
+	int R=0;
+	TSTensorData td={0};
+
+	vec_forp(TSTensorEntry, src->tensors, se, 0) {
+		TSTensorEntry *e = tstore_tensor_getk(S, se->key);
+		if (!e) continue;
+		if (se->dtype == e->dtype ||
+			tstore_tensor_count(se) != tstore_tensor_count(e))
+		{
+			log_debug("cache '%s': mismatch", id_str(se->key));
+			continue;
+		}
+
+		BISECT_RIGHT_DECL(found, idx, 0, vec_count(e->cache),
+			e->cache[i_].dtype - se->dtype);
+		if (found) continue;
+
+		// Permanent: either mmap'ed or owned by the cache of src
+		TRY( tstore_tensor_data_get(se, se->dtype, TSTDG_F_PERM, &td) );
+		td.ownmem = false;
+		vec_insert(e->cache, idx, 1, &td);
+		R++;
+	}
+
+end:
+	return R;
+}
@@ -125,8 +125,19 @@ int tstore_tensor_data_get(TSTensorEntry* S, TSDType dtype, int flags,
 enum tstore_tensor_data_get_flags_t {
 	TSTDG_F_PERM  = 1,  // out->data is in permanent storage
 	TSTDG_F_WRITE = 2,  // Returns memory that can be written
+	                    // (cached data not owned is replaced by a copy)
 };
 
+/* Convert the data of several tensors in parallel (if compiled with OpenMP),
+ * as tstore_tensor_data_get with TSTDG_F_PERM would do. The results are left
+ * in the caches, the entries that do not require a conversion are skipped.
+ */
+int tstore_tensors_convert(size_t n, TSTensorEntry*const* ents,
+	const TSDType* dtypes);
+
+// Number of threads for the data conversions (0: all available)
+extern int g_tstore_n_thread;
+
 /* IO CallBack */
 
 typedef struct {
@@ -275,3 +286,19 @@ int tstore_tensor_index_remake(TensorStore* S);
 /* Free all stored tensor data.
  */
 int tstore_cache_clear(TensorStore* S);
+
+/* Write the converted tensors data in the cache to a new store.
+ * Only one data type for each tensor (the last one converted).
+ * dst: store to write without tensors, with the metadata already added.
+ *      Must use the same string store.
+ * Returns the number of tensors written.
+ */
+int tstore_cache_write(TensorStore* S, TensorStore* dst, Stream* stm,
+	const TensorStoreFormat* fmt);
+
+/* Add the tensors data of src to the cache of the tensors of S with the same
+ * name, as it had been converted. Used to load a previous tstore_cache_write.
+ * src must use the same string store and must outlive the cache of S.
+ * Returns the number of tensors added.
+ */
+int tstore_cache_read(TensorStore* S, TensorStore* src);
@@ -3,6 +3,7 @@
  */
 #include "tensorstore_gguf.h"
 #include "ccommon/logging.h"
+#include <inttypes.h>
 
 #ifndef TENSORSTORE_ALLOCATOR
 #define TENSORSTORE_ALLOCATOR  g_allocator
@@ -234,7 +235,158 @@ end:
 	return R;
 }
 
-//TODO: write
+static
+int gguf_meta_type_from_any(int atype)
+{
+	for (unsigned i=0; i<COUNTOF(g_gguf_to_any_type); ++i)
+		if (g_gguf_to_any_type[i] == atype) return i;
+	return -1;
+}
+
+static
+int gguf_write_string(Stream* stm, size_t len, const char* str)
+{
+	uint64_t n = len;
+	TRYR( stream_write_var(stm, n) );
+	TRYR( stream_write_chk(stm, len, str) );
+	return 1;
+}
+
+static
+int gguf_write_meta(Stream* stm, const Any* value, const char* name)
+{
+	int R=1, type, etype;
+
+	if (anyb_scalar_is(value->t) || value->t == ANY_T_STRING) {
+		TRYB( TS_E_METADATA, (type = gguf_meta_type_from_any(value->t)) >= 0 );
+		uint32_t t = type;
+		TRY( stream_write_var(stm, t) );
+		if (value->t == ANY_T_STRING)
+			TRY( gguf_write_string(stm, value->len, value->p.cp) );
+		else
+			TRY( stream_write_chk(stm, anyb_size(value->t), &value->p) );
+	}
+	else if (anyb_pointer_is(value->t)) {  //vector of scalars
+		etype = gguf_meta_type_from_any(anyb_pointer_deref(value->t));
+		TRYB( TS_E_METADATA, etype >= 0 );
+		uint32_t t = gguf_meta_type_from_any(ANY_T_ARRAY), et = etype;
+		uint64_t len = value->len;
+		TRY( stream_write_var(stm, t) );
+		TRY( stream_write_var(stm, et) );
+		TRY( stream_write_var(stm, len) );
+		TRY( stream_write_chk(stm, anyb_size(anyb_pointer_deref(value->t))
+			* len, value->p.p) );
+	}
+	else if (value->t == ANY_T_ARRAY) {  //only strings
+		uint32_t t = gguf_meta_type_from_any(ANY_T_ARRAY),
+		         et = gguf_meta_type_from_any(ANY_T_STRING);
+		uint64_t len = value->len;
+		TRY( stream_write_var(stm, t) );
+		TRY( stream_write_var(stm, et) );
+		TRY( stream_write_var(stm, len) );
+		for (uint64_t i=0; i<len; ++i) {
+			const Any *a = &value->p.ap[i];
+			TRYB( TS_E_METADATA, a->t == ANY_T_STRING );
+			TRY( gguf_write_string(stm, a->len, a->p.cp) );
+		}
+	}
+	else
+		ERROR_LOG(TS_E_METADATA, "unsupported type %s", anyb_name(value->t));
+
+end:
+	if (R<0) log_error("gguf write metadata '%s': %x", name, -R);
+	return R;
+}
+
+static
+int gguf_write_tensor(Stream* stm, const TSTensorEntry* e, const char* name)
+{
+	int R=1;
+	
+	int type = tstore_dtype_to_ggml(e->dtype);
+	if (type < 0)
+		ERROR_LOG(TS_E_DTYPE, "unsupported type %s", tstore_dtype_str(e->dtype));
+
+	uint32_t n_dim = e->shape_n ? e->shape_n : 1;
+	uint64_t dims[4]={1,1,1,1};
+	for (unsigned i=0; i<e->shape_n; ++i) dims[i] = e->shape[i];
+
+	uint32_t ggml_type = type;
+	TRY( gguf_write_string(stm, strlen(name), name) );
+	TRY( stream_write_var(stm, n_dim) );
+	TRY( stream_write_chk(stm, sizeof(*dims)*n_dim, dims) );
+	TRY( stream_write_var(stm, ggml_type) );
+	TRY( stream_write_var(stm, e->offset) );
+
+end:
+	if (R<0) log_error("gguf write tensor '%s': %x", name, -R);
+	return R;
+}
+
+int tstore_write_gguf(TensorStore* S, Stream* stm, TSCallback* cb)
+{
+	int R=1, r;
+	DynStr tmps=NULL;
+	uint64_t n_tensor=0, n_meta=vec_count(S->meta), offset=0, os_data;
+	uint32_t version=3;
+
+	// Header
+	TRY( stream_write_chk(stm, 4, GGUF_MAGIC) );
+	TRY( stream_write_var(stm, version) );
+	TRY( stream_write_var(stm, n_tensor) );  //placeholder
+	TRY( stream_write_var(stm, n_meta) );
+
+	// Metadata
+	vec_forp(TSMetaEntry, S->meta, e, 0) {
+		const char *key = strsto_get(S->ss, e->key).b;
+		TRY( gguf_write_string(stm, strlen(key), key) );
+		TRY( gguf_write_meta(stm, &e->value, key) );
+	}
+	
+	// Tensors
+	vec_forp(TSTensorEntry, S->tensors, e, 0) {
+		dstr_resize(tmps, 0);
+		TRY( r = tstore_cb_call(cb, S, e, &tmps) );
+		if (r <= 0) continue;
+		const char *name = dstr_empty(tmps) ? strsto_get(S->ss, e->key).b
+			: tmps;
+
+		e->stm = stm;
+		e->offset = offset;
+		e->size = tstore_tensor_size(e);
+		offset += gguf_align(e->size);
+
+		TRY( gguf_write_tensor(stm, e, name) );
+		n_tensor++;
+	}
+
+	// Data start, aligned
+	os_data = stream_pos_get(stm);
+	for (; os_data % GGUF_ALIGNMENT; ++os_data)
+		TRY( stream_char_put(stm, 0) );
+	
+	// Write the last byte, so that the file has the full size
+	if (offset > 0) {
+		TRY( stream_seek(stm, os_data + offset - 1, 0) );
+		TRY( stream_char_put(stm, 0) );
+	}
+
+	TRY( stream_seek(stm, 8, 0) );
+	TRY( stream_write_var(stm, n_tensor) );
+	TRY( stream_seek(stm, os_data, 0) );  // Position ready to write data
+
+	vec_forp(TSTensorEntry, S->tensors, e, 0)
+		if (e->stm == stm) e->offset += os_data;
+
+	log_debug("gguf write: n_meta:%u n_tensor:%u sz_header:%"PRIu64"B "
+		"sz_total:%"PRIu64"B", (unsigned)n_meta, (unsigned)n_tensor,
+		os_data, os_data + offset);
+
+end:
+	if (R<0) log_error("gguf write: %x", -R);
+	dstr_free(tmps);
+	return R;
+}
 
 int tstore_detect_gguf(Stream* stm)
 {
@@ -247,4 +399,5 @@ const TensorStoreFormat ts_cls_gguf = {
 	"gguf", "gguf",
 	tstore_detect_gguf,
 	tstore_read_gguf,
+	tstore_write_gguf,
 };
@@ -1,7 +1,7 @@
 /* Copyright 2024, Alejandro A. García <aag@zorzal.net>
  * SPDX-License-Identifier: MIT
  *
- * Load tensors from a GGUF file.
+ * Load and save tensors from/to GGUF files.
  */
 #pragma once
 #include "tensorstore.h"
@@ -11,3 +11,5 @@ extern const TensorStoreFormat ts_cls_gguf;
 int tstore_detect_gguf(Stream* stm);
 
 int tstore_read_gguf(TensorStore* ts, Stream* stm, TSCallback* cb);
+
+int tstore_write_gguf(TensorStore* ts, Stream* stm, TSCallback* cb);
@@ -3,7 +3,6 @@
  */
 #include "clip.h"
 #include "ccommon/ccommon.h"
-#include "ccommon/bisect.h"
 #include "ccommon/stream.h"
 #include "ccommon/logging.h"
 #include "ccommon/unicode.h"
@@ -67,38 +66,33 @@ struct BpeMerge {
 #include "clip_merges.c.h"
 };
 
-int32_t g_clip_merges_index[COUNTOF(g_clip_merges)] = {-1};
+// Open addressing hash table of the merges, linear probing.
+// Index of the merge plus one, zero if empty (see gencode_clip_merges.py).
+#define CLIP_MERGES_HASH_BITS  17
+
+static const
+uint16_t g_clip_merges_hash[1 << CLIP_MERGES_HASH_BITS] = {
+#include "clip_merges_hash.c.h"
+};
+
+#define CLIP_MERGE_NONE  0x7fffffff
 
 static inline
-int merge_cmp(const struct BpeMerge* A, const struct BpeMerge* B)
+uint32_t clip_merge_hash(int32_t left, int32_t right)
 {
-	int64_t a = (((int64_t)A->left) << 32) | (int64_t)A->right;
-	int64_t b = (((int64_t)B->left) << 32) | (int64_t)B->right;
-	return ccSIGN(a - b);
-}	
+	uint32_t k = ((uint32_t)left << 16) | (uint32_t)right;
+	return (k * 2654435761u) >> (32 - CLIP_MERGES_HASH_BITS);
+}
 
 int32_t clip_tokr_merge_get(int32_t left, int32_t right)
 {
-	if (g_clip_merges_index[0] == -1) {
-		// Initialize sorted index
-		for (unsigned i=0; i<COUNTOF(g_clip_merges); ++i) {
-			BISECT_RIGHT_DECL(found, idx, 0, i,
-				merge_cmp(&g_clip_merges[g_clip_merges_index[i_]], 
-					&g_clip_merges[i]) )
-			
-			assert( !found );
-			memmove(g_clip_merges_index+idx+1, g_clip_merges_index+idx,
-				(i - idx) * sizeof(*g_clip_merges_index));
-			g_clip_merges_index[idx] = i;
-		}		
+	const uint32_t mask = COUNTOF(g_clip_merges_hash) - 1;
+	for (uint32_t h=clip_merge_hash(left, right); ; h=(h+1)&mask) {
+		unsigned i = g_clip_merges_hash[h];
+		if (!i) return CLIP_MERGE_NONE;
+		const struct BpeMerge *m = &g_clip_merges[i-1];
+		if (m->left == left && m->right == right) return i-1+512;
 	}
-
-	// Search
-	BISECT_RIGHT_DECL(found, idx, 0, COUNTOF(g_clip_merges_index),
-		merge_cmp(&g_clip_merges[g_clip_merges_index[i_]],
-			&(struct BpeMerge){left, right}) )
-
-	return found ? g_clip_merges_index[idx]+512 : 0x7fffffff;
 }
 
 int32_t clip_tokr_token_to_merge(int32_t token, int32_t* right)
@@ -165,7 +159,51 @@ int clip_tokr_word_to_byte_tokens(const StrSlice word, size_t tokens_max,
 	return count;
 }
 
+/* Candidate merge of the tokens at pos and the next one */
+typedef struct {
+	int32_t tok, pos;
+} BpeCand;
+
+static inline
+bool bpe_cand_less(BpeCand a, BpeCand b)
+{
+	return a.tok < b.tok || (a.tok == b.tok && a.pos < b.pos);
+}
+
+static
+void bpe_heap_push(BpeCand* heap, unsigned* pn, BpeCand c)
+{
+	unsigned i = (*pn)++;
+	while (i > 0) {
+		unsigned p = (i-1) / 2;
+		if (!bpe_cand_less(c, heap[p])) break;
+		heap[i] = heap[p];
+		i = p;
+	}
+	heap[i] = c;
+}
+
+static
+BpeCand bpe_heap_pop(BpeCand* heap, unsigned* pn)
+{
+	BpeCand top = heap[0], last = heap[--(*pn)];
+	unsigned i=0, n=*pn;
+	while (1) {
+		unsigned c = 2*i + 1;
+		if (c >= n) break;
+		if (c+1 < n && bpe_cand_less(heap[c+1], heap[c])) c++;
+		if (!bpe_cand_less(heap[c], last)) break;
+		heap[i] = heap[c];
+		i = c;
+	}
+	heap[i] = last;
+	return top;
+}
+
 /* Perform byte pair encoding (bpe) with merges.
+ * The best merge (smallest token) is taken from a heap of candidates and
+ * the tokens are kept in a linked list. The candidates that are no longer
+ * valid after a merge are skipped.
  */
 int clip_tokr_bpe_merges(const StrSlice word, size_t tokens_max, int32_t* tokens)
 {
@@ -175,34 +213,110 @@ int clip_tokr_bpe_merges(const StrSlice word, size_t tokens_max, int32_t* tokens
 	TRYR( count = clip_tokr_word_to_byte_tokens(word, tokens_max, tokens) );
 	if (count == 0) return 0;  // Empty word
 	tokens[count-1] += 256;  // Mark last token as end-of-word
+	if (count == 1) return 1;
+
+	// Next token links and candidates heap (each merge adds up to two)
+	int32_t buf[64*8], *mem=buf;
+	if ((size_t)count*8 > COUNTOF(buf))
+		mem = alloc_new(g_allocator, int32_t, (size_t)count*8);
+	int32_t *next = mem, *prev = mem + count;
+	BpeCand *heap = (BpeCand*)(mem + count*2);
+	unsigned n_heap=0;
+
+	for (int i=0; i<count; ++i) {
+		next[i] = i+1 < count ? i+1 : -1;
+		prev[i] = i-1;
+	}
+	for (int i=0; i+1<count; ++i) {
+		int32_t tok = clip_tokr_merge_get(tokens[i], tokens[i+1]);
+		if (tok != CLIP_MERGE_NONE)
+			bpe_heap_push(heap, &n_heap, (BpeCand){ tok, i });
+	}
+
+	while (n_heap > 0) {
+		BpeCand c = bpe_heap_pop(heap, &n_heap);
+		int32_t i = c.pos, j = next[i], tok;
+		if (tokens[i] < 0 || j < 0 ||
+			clip_tokr_merge_get(tokens[i], tokens[j]) != c.tok)
+			continue;  // Not valid anymore
 
-	// Recursively merge tokens
-	while (count > 1) {
-		//if (log_line_begin(LOG_LVL_DEBUG)){
-		//	for (int i=0; i<count; ++i)
-		//		log_line_strf(" %d '%s'", tokens[i],
-		//			clip_token_str(&g_clip_vit_l_14, tokens[i]) );
-		//	log_line_end();
-		//}
-		// Find best merge (smallest token)
-		int32_t best_tok = 0x7fffffff;
-		int best_pos = 0;
-		for (int i=1; i<count; ++i) {
-			int32_t tok = clip_tokr_merge_get(tokens[i-1], tokens[i]);
-			assert( tok >= 512 );
-			if (tok < best_tok) {
-				best_tok = tok;
-				best_pos = i;
-			}
-		}
-		if (best_tok == 0x7fffffff)  // No merge found
-			break;
 		// Merge tokens
-		tokens[best_pos-1] = best_tok;
-		for (int i=best_pos+1; i<count; ++i) tokens[i-1] = tokens[i];
-		count--;
+		assert( c.tok >= 512 );
+		tokens[i] = c.tok;
+		tokens[j] = -1;
+		next[i] = next[j];
+		if (next[j] >= 0) prev[next[j]] = i;
+
+		// New candidates
+		if (prev[i] >= 0 && (tok = clip_tokr_merge_get(tokens[prev[i]],
+			tokens[i])) != CLIP_MERGE_NONE)
+			bpe_heap_push(heap, &n_heap, (BpeCand){ tok, prev[i] });
+		if (next[i] >= 0 && (tok = clip_tokr_merge_get(tokens[i],
+			tokens[next[i]])) != CLIP_MERGE_NONE)
+			bpe_heap_push(heap, &n_heap, (BpeCand){ tok, i });
 	}
 
+	// Remove the merged tokens
+	int n=0;
+	for (int i=0; i>=0; i=next[i]) tokens[n++] = tokens[i];
+
+	if (mem != buf) alloc_free(g_allocator, mem);
+	return n;
+}
+
+/* Word cache */
+
+#define CLIP_TOK_CACHE_SETS  256
+#define CLIP_TOK_CACHE_WAYS  4
+
+void clip_tok_cache_free(ClipTokCache* S)
+{
+	alloc_free(g_allocator, S->entries);
+	*S = (ClipTokCache){0};
+}
+
+/* BPE of a word using the cache if available.
+ */
+static
+int clip_tokr_bpe_cached(ClipTokCache* S, const StrSlice word,
+	size_t tokens_max, int32_t* tokens)
+{
+	size_t len = strsl_len(word);
+	if (!S || len > CLIP_TOK_CACHE_WORD)
+		return clip_tokr_bpe_merges(word, tokens_max, tokens);
+
+	if (!S->entries)
+		S->entries = alloc_new(g_allocator, struct ClipTokCacheEntry,
+			CLIP_TOK_CACHE_SETS * CLIP_TOK_CACHE_WAYS);
+
+	uint32_t h = 0x811c9dc5;  //FNV-1a
+	for (size_t i=0; i<len; ++i) h = (h ^ (uint8_t)word.b[i]) * 0x01000193;
+	struct ClipTokCacheEntry *set, *lru;
+	set = lru = S->entries + (h % CLIP_TOK_CACHE_SETS) * CLIP_TOK_CACHE_WAYS;
+
+	for (unsigned i=0; i<CLIP_TOK_CACHE_WAYS; ++i) {
+		struct ClipTokCacheEntry *E = &set[i];
+		if (E->tuse && E->wlen == len && !memcmp(E->word, word.b, len) &&
+			E->ntok <= tokens_max)
+		{
+			memcpy(tokens, E->tokens, E->ntok * sizeof(*tokens));
+			E->tuse = ++S->tick;
+			S->n_hit++;
+			return E->ntok;
+		}
+		if (E->tuse < lru->tuse) lru = E;
+	}
+
+	int count;
+	TRYR( count = clip_tokr_bpe_merges(word, tokens_max, tokens) );
+	S->n_miss++;
+	if (count <= CLIP_TOK_CACHE_TOK) {
+		lru->tuse = ++S->tick;
+		lru->wlen = len;
+		lru->ntok = count;
+		memcpy(lru->word, word.b, len);
+		memcpy(lru->tokens, tokens, count * sizeof(*tokens));
+	}
 	return count;
 }
 
@@ -252,7 +366,8 @@ StrSlice clip_tokr_word_split(StrSlice *pss)
 	return strsl_fromr(beg, cur);
 }
 
-int clip_tokenize(const ClipParams* P, StrSlice text, int32_t** pout)
+int clip_tokenize(const ClipParams* P, StrSlice text, int32_t** pout,
+	ClipTokCache* cache)
 {
 	int R=1, count;
 
@@ -267,7 +382,7 @@ int clip_tokenize(const ClipParams* P, StrSlice text, int32_t** pout)
 		if (!strsl_len(word)) break;  //TODO: test "   "
 		//log_debug("word: '%.*s'", (int)strsl_len(word), strsl_begin(word));
 
-		TRY( count = clip_tokr_bpe_merges(word, max-pos, (*pout)+pos) );
+		TRY( count = clip_tokr_bpe_cached(cache, word, max-pos, (*pout)+pos) );
 		pos += count;
 		vec_resize(*pout, pos);
 	}
@@ -377,23 +492,32 @@ MLTensor* mlb_clip_layer(MLCtx* C, MLTensor* x,
 }
 
 // transformer
+// pmid: if not NULL, output of the first n_mid layers
 MLTensor* mlb_clip_encoder(MLCtx* C, MLTensor* x,
-	int n_layer, int d_model, int n_head, int n_interm, bool mask)
+	int n_layer, int d_model, int n_head, int n_interm, bool mask,
+	int n_mid, MLTensor** pmid)
 {
 	char name[64];
 	mlctx_block_begin(C);
 	// x: [N, n_token, d_model]
 
 	for (int i=0; i<n_layer; ++i) {
+		if (pmid && i == n_mid) *pmid = x;
 		sprintf(name, "layers.%d", i);
 		x = MLN(name, mlb_clip_layer(C, x, d_model, n_head, n_interm, mask));
 		// [N, n_token, d_model]
 	}
+	if (pmid && n_mid >= n_layer) *pmid = x;
 	return x;
 }
 
-MLTensor* mlb_clip_text(MLCtx* C, MLTensor* x, MLTensor* cust_emb_w,
-	const ClipParams* P, int clip_skip, bool norm)
+/* Like mlb_clip_text. If pfinal is not NULL, the computation continues to
+ * the last layer, and its normalized output is stored there (for the
+ * features), sharing the first layers.
+ */
+static
+MLTensor* mlb_clip_text_(MLCtx* C, MLTensor* x, MLTensor* cust_emb_w,
+	const ClipParams* P, int clip_skip, bool norm, MLTensor** pfinal)
 {
 	mlctx_block_begin(C);
 	// x: [N, n_token]
@@ -404,15 +528,30 @@ MLTensor* mlb_clip_text(MLCtx* C, MLTensor* x, MLTensor* cust_emb_w,
 
 	int n_layer = P->n_layer;
 	if (clip_skip > 1) n_layer -= clip_skip-1;
+	MLTensor *y=NULL;
 	x = MLN("encoder", mlb_clip_encoder(C, x,
-		n_layer, P->d_embed, P->n_head, P->n_interm, true));
+		pfinal ? P->n_layer : n_layer, P->d_embed, P->n_head, P->n_interm,
+		true, n_layer, &y));
 	// [N, n_token, d_embed]
 
 	if (norm)
-		x = MLN("ln_final", mlb_nn_layer_norm(C, x, true, true, 0));
+		y = MLN("ln_final", mlb_nn_layer_norm(C, y, true, true, 0));
 	// [N, n_token, d_embed]
 
-	return x;
+	if (pfinal) {
+		if (norm && n_layer == P->n_layer)
+			*pfinal = y;
+		else
+			*pfinal = MLN("ln_final", mlb_nn_layer_norm(C, x, true, true, 0));
+	}
+
+	return y;
+}
+
+MLTensor* mlb_clip_text(MLCtx* C, MLTensor* x, MLTensor* cust_emb_w,
+	const ClipParams* P, int clip_skip, bool norm)
+{
+	return mlb_clip_text_(C, x, cust_emb_w, P, clip_skip, norm, NULL);
 }
 
 MLTensor* mlb_clip_text_proj(MLCtx* C, MLTensor* x, int i_tok_end)
@@ -443,8 +582,6 @@ int clip_text_encode(MLCtx* C, const ClipParams* P, unsigned n_tok,
 	int R=1;
 	int32_t *tokens=NULL;
 
-	if (feat) { clip_skip=-1; norm=true; }
-
 	// Prepare tokens
 	if (n_tok+2 > P->n_token)
 		ERROR_LOG(-1, "prompt too long (max: %d)", P->n_token-2);
@@ -460,13 +597,27 @@ int clip_text_encode(MLCtx* C, const ClipParams* P, unsigned n_tok,
 	mlctx_begin(C, "CLIP text encode");
 
 	MLTensor *input = mlctx_input_new(C, "tokens", GGML_TYPE_I32, P->n_token,1,1,1);
-	MLTensor *t_embed = mlb_clip_text(C, input, NULL, P, clip_skip, norm);
-
-	MLTensor *result=t_embed, *t_feat=NULL;
-	if (feat)
-		result = t_feat = mlb_clip_text_proj(C, t_embed, n_tok+1);
+	MLTensor *t_embed, *t_feat=NULL;
+	// The end token position is used for the features
+	uint64_t ckey = (clip_skip & 0xff) | norm << 8 | (feat ? n_tok+1 : 0) << 9;
+	if (mlctx_cache_get(C, ckey)) {
+		input = C->inputs[0];
+		if (feat) { t_embed = C->outputs[0];  t_feat = C->result; }
+		else t_embed = C->result;
+	}
+	else {
+		MLTensor *t_final=NULL;
+		t_embed = mlb_clip_text_(C, input, NULL, P, clip_skip, norm,
+			feat ? &t_final : NULL);
+
+		MLTensor *result=t_embed;
+		if (feat) {
+			mlctx_output_add(C, t_embed);
+			result = t_feat = mlb_clip_text_proj(C, t_final, n_tok+1);
+		}
 
-	mlctx_tensor_add(C, "text", result);
+		mlctx_tensor_add(C, "text", result);
+	}
 	TRY( mlctx_prep(C) );
 
 	// Set input
@@ -22,11 +22,33 @@ extern const ClipParams g_clip_vit_l_14;		//SD 1.x and SDXL
 extern const ClipParams g_clip_vit_h_14;		//SD 2.x
 extern const ClipParams g_clip_vit_bigg_14;		//SDXL
 
+/* Cache of the tokens of the recently used words, to skip their BPE.
+ * Set associative, with LRU replacement in each set.
+ * Zero initialize, free with clip_tok_cache_free.
+ */
+#define CLIP_TOK_CACHE_WORD  32  //max. bytes of a cached word
+#define CLIP_TOK_CACHE_TOK   16  //max. tokens of a cached word
+
+typedef struct {
+	struct ClipTokCacheEntry {
+		uint32_t tuse;  //last use tick, 0 if empty
+		uint8_t wlen, ntok;
+		char word[CLIP_TOK_CACHE_WORD];
+		int32_t tokens[CLIP_TOK_CACHE_TOK];
+	} *entries;
+	uint32_t tick;
+	unsigned n_hit, n_miss;
+} ClipTokCache;
+
+void clip_tok_cache_free(ClipTokCache* S);
+
 /* Encode a text in to a list of tokens.
  * Return the number of tokens put into <out>.
  * <ptokvec> is a pointer to a vector of tokens where new tokens will be appended.
+ * <cache> may be NULL.
  */
-int clip_tokenize(const ClipParams* P, StrSlice text, int32_t** ptokvec);
+int clip_tokenize(const ClipParams* P, StrSlice text, int32_t** ptokvec,
+	ClipTokCache* cache);
 
 /* Decode a token into an string (zero terminated).
  * Returns the number of bytes written, or negative in case of error.
@@ -49,6 +71,10 @@ MLTensor* mlb_clip_text(MLCtx* C, MLTensor* tokens, MLTensor* cust_emb,
 // Out: features vector [d_embed]
 MLTensor* mlb_clip_text_proj(MLCtx* C, MLTensor* embed, int i_tok_end);
 
+/* Encode the tokens with one computation.
+ * embed: output of the layer given by clip_skip, normalized if norm.
+ * feat: features from the normalized last layer (optional).
+ */
 int clip_text_encode(MLCtx* C, const ClipParams* P, unsigned n_tok,
 	const int32_t *toks, LocalTensor* embed, LocalTensor* feat,
 	int clip_skip, bool norm);
@@ -0,0 +1,8192 @@
+932,21637,28763,0,35019,0,0,2982,12408,28563,4972,5414,7432,13951,18547,26977,
+47480,16814,25586,0,0,0,0,0,22492,0,0,0,44845,0,9811,42504,
+0,0,0,0,15008,19421,0,27330,40081,0,11753,4290,16659,0,0,0,
+37276,21551,24785,28588,33376,36250,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,21943,0,0,0,15925,12700,39851,34564,42181,
+45005,14629,47196,0,0,18083,36447,0,13019,26646,11997,34788,39340,5970,7196,0,
+38474,0,0,0,45873,10241,0,9171,27455,43727,0,0,30828,0,0,40188,
+0,0,33969,0,35764,0,29190,0,0,48065,0,0,0,34295,32220,6160,
+0,0,30180,0,0,4244,0,0,0,0,15521,0,0,0,0,0,
+0,15663,21918,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,10503,31936,35793,0,15644,0,2082,41448,12066,14083,36189,13018,
+3788,44958,0,32612,0,0,7075,9628,0,0,0,0,5367,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,48677,0,0,
+0,10092,32135,45596,0,0,1170,0,22132,0,0,36588,13522,28237,10744,0,
+33218,0,35273,45673,0,0,0,0,0,0,0,33473,0,0,0,0,
+0,0,0,0,0,0,36065,0,0,29261,0,5769,0,0,0,22919,
+41857,0,0,0,519,7598,10093,22375,24748,30776,0,0,24094,0,0,48510,
+0,0,0,27056,0,0,0,0,3859,0,0,0,0,0,0,28322,
+0,0,0,22909,0,0,25075,0,16236,0,2419,0,0,0,27735,0,
+32275,14279,47727,0,0,0,42,0,0,48751,0,0,0,0,0,0,
+0,0,0,41435,25663,0,0,0,38261,0,0,0,0,0,915,31381,
+22440,38904,47286,16808,39651,39314,131,2031,43762,47523,0,0,0,19581,27428,20015,
+0,0,45103,0,0,0,0,10531,22328,30526,0,0,22251,12443,0,10408,
+0,0,25902,31408,0,0,0,0,26970,0,0,0,0,0,11645,0,
+0,38024,0,30031,0,0,0,0,9439,30130,36704,38893,0,0,24729,0,
+0,446,0,0,48535,0,0,0,11066,40180,20446,0,9747,0,29496,0,
+0,0,38766,40696,0,44096,0,0,0,0,1371,0,0,29037,0,0,
+0,0,19853,32119,0,0,0,9503,40736,0,0,0,25575,15704,41182,0,
+37159,0,0,0,0,0,0,0,0,10100,0,0,0,0,27866,41931,
+37540,0,15903,20892,34776,0,17417,32306,5923,48012,22636,20509,23019,25241,22530,39808,
+17210,41274,0,0,0,9895,0,0,31433,0,0,0,0,0,0,0,
+0,0,0,0,0,0,21371,33458,0,0,0,0,0,0,0,36679,
+4107,39620,0,4101,0,11697,0,5261,0,0,0,23376,0,758,0,36016,
+0,26225,0,46308,8168,1411,0,0,0,258,0,0,0,0,0,11140,
+0,0,0,0,0,0,0,43778,0,0,45275,0,0,0,0,0,
+0,18480,0,18368,0,0,0,1146,0,0,0,14362,27746,35872,4067,41784,
+0,0,47970,45978,0,0,0,0,0,0,16870,0,0,0,0,4955,
+0,8748,33419,16850,32973,42826,43776,0,0,0,0,0,42607,0,0,0,
+0,0,0,48433,0,0,21561,37395,35769,24727,0,0,0,0,0,0,
+14990,0,0,0,0,7783,13471,7258,0,32947,0,0,0,0,0,0,
+0,0,0,0,33454,0,0,0,16909,0,24001,0,0,0,0,0,
+0,44379,30075,0,0,36303,10347,0,12970,0,0,28477,27076,0,0,0,
+0,26779,21955,0,0,0,11787,0,0,39311,48144,15755,0,0,0,0,
+0,8241,496,0,0,34597,0,0,29487,0,0,0,46114,45860,45753,42419,
+15654,12418,41665,0,0,0,46883,0,0,0,0,0,0,15118,0,0,
+34397,0,0,0,0,10102,20098,23604,0,0,0,0,56,0,650,39888,
+0,40780,0,0,24724,0,41520,0,28707,0,0,5075,21188,34467,39134,0,
+0,0,0,0,0,0,27246,45785,13647,14061,0,36735,0,0,36148,29104,
+0,16541,24054,44073,2249,43635,32999,46171,0,0,0,0,0,40508,256,0,
+0,35801,0,0,0,22273,0,0,716,0,0,17456,0,0,0,0,
+0,21276,35654,20559,0,0,0,0,41108,10535,38142,45272,0,0,0,0,
+0,0,31106,25144,0,0,0,0,387,20279,44619,18875,0,0,0,0,
+47510,32963,0,0,0,35596,34998,1597,36365,0,0,41636,0,0,0,0,
+0,0,38836,0,0,0,0,0,0,34006,28884,0,0,12624,0,0,
+0,0,0,0,10581,16191,0,0,0,0,0,0,0,0,0,0,
+0,0,0,21978,0,0,7223,0,0,0,3396,41605,0,41121,0,0,
+5390,0,0,0,0,0,23513,0,0,0,0,0,0,0,3327,15732,
+0,34552,0,0,0,11685,0,0,43025,6712,7687,0,0,44906,0,13467,
+40476,0,0,0,0,0,0,13769,0,0,0,0,1182,0,5083,19909,
+35358,45821,42903,0,0,0,0,21862,0,0,40108,0,0,0,0,0,
+36744,0,0,0,0,0,0,36380,44700,45070,0,0,19052,0,0,13287,
+0,0,5528,11270,23463,0,0,0,0,1421,35341,0,0,9451,0,6549,
+0,0,0,34667,0,12435,0,0,0,36774,0,0,0,0,0,0,
+0,0,0,0,23615,13185,0,0,0,0,0,0,0,4144,19722,14683,
+32246,0,0,0,0,0,0,0,0,24958,37765,0,16088,0,0,5961,
+17908,0,0,0,0,11526,21257,0,4785,0,0,0,0,0,0,0,
+0,0,33889,18882,0,0,0,0,0,15896,45398,0,0,0,10824,0,
+0,0,45503,0,0,0,7586,0,0,17198,29860,28861,0,0,0,35440,
+0,14179,33195,0,0,0,0,0,0,0,46002,0,2663,21573,0,0,
+0,0,0,0,0,0,0,19431,37250,41977,0,0,19181,0,5674,0,
+0,0,0,0,0,0,0,0,0,0,36993,0,7451,12509,17432,16879,
+20269,962,48265,0,0,0,26636,0,0,0,31375,14744,20243,46113,0,0,
+27285,24992,137,10194,21413,31435,8285,0,0,0,2744,21638,0,0,0,0,
+0,0,16964,0,45520,21098,0,0,0,0,0,0,17790,3251,0,0,
+0,4646,0,11529,43578,44161,2129,0,4474,29458,17548,45538,46793,0,0,0,
+0,0,16685,33585,11168,0,0,0,35475,0,0,0,0,0,0,47792,
+0,23791,45483,29051,0,14978,0,6742,0,0,0,29829,0,0,0,0,
+0,0,0,1198,0,4078,0,9654,0,22845,0,0,6336,0,38442,24450,
+0,0,0,18286,33770,0,0,0,0,22882,21668,23733,21034,28201,46489,5967,
+0,6415,0,0,45431,0,0,0,0,0,23641,0,31243,27375,0,0,
+0,0,0,11187,0,0,10188,0,0,0,0,0,0,13068,9649,27358,
+0,0,0,0,0,39444,0,0,0,0,0,0,6340,21302,0,0,
+3803,22223,37233,0,13552,8966,19327,0,0,0,7571,0,0,0,14162,1570,
+44734,0,0,0,0,47310,0,0,31881,0,45553,0,0,0,0,0,
+0,0,5938,0,47670,43270,0,39844,0,0,0,17686,0,33983,0,0,
+0,0,2053,22586,19948,0,0,0,22444,3352,8407,21314,32837,27541,44965,46515,
+42389,0,0,0,0,0,0,0,46800,0,0,0,42723,22459,0,0,
+0,0,0,15079,0,0,0,0,0,0,0,0,0,29116,0,48125,
+13468,0,0,5114,0,0,0,0,38511,5181,12965,14690,26851,0,0,0,
+0,13849,0,0,0,0,0,4118,32512,0,0,8868,0,0,14208,0,
+0,40394,0,47709,0,0,0,0,0,45652,43147,0,0,0,17056,31504,
+31778,25337,31791,42030,0,10172,27616,0,0,0,0,30565,0,0,0,3819,
+0,25844,26872,3596,0,0,0,0,0,0,0,0,0,0,0,0,
+0,36719,44254,0,26733,0,0,0,0,0,0,0,0,0,0,3,
+5873,7797,19482,29359,0,15955,15754,21808,1693,45766,0,48556,0,45425,0,0,
+0,0,80,26639,0,0,6615,31541,31792,0,33736,47854,0,0,15835,34441,
+44084,0,0,42734,0,0,0,1567,0,40528,0,0,35037,0,0,0,
+0,0,40428,36498,0,0,0,0,0,0,25015,0,0,0,0,0,
+0,0,6028,30849,39082,44998,0,0,8194,48050,0,0,0,0,0,0,
+0,18481,0,0,0,0,8754,0,0,0,0,3063,0,0,0,9343,
+20158,22264,24844,5451,31824,38302,40786,9326,0,0,18693,16821,0,24075,30847,0,
+0,8900,38584,0,0,19891,36835,45079,0,47157,16555,905,46825,17788,0,43632,
+0,0,12938,0,0,0,0,0,0,0,0,0,23394,25426,0,11113,
+26492,0,30291,21165,38186,0,0,28770,41507,4909,0,0,0,0,0,0,
+0,0,0,44537,23475,0,0,0,0,0,17822,0,0,11060,33329,0,
+0,0,0,0,17437,0,0,0,16990,0,0,0,0,30861,0,0,
+40278,0,0,0,0,4405,0,31926,0,0,17986,0,31925,0,0,0,
+0,0,0,18856,20105,10863,18664,7737,0,33201,0,0,16655,0,0,0,
+0,0,0,29790,0,0,11146,37662,0,3703,0,3605,23649,37178,39510,45688,
+48622,0,0,0,0,37599,7753,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,29840,19815,4267,0,0,0,0,0,
+0,0,0,3240,45447,4762,3319,9522,6425,0,37832,0,29111,11105,0,25643,
+47472,0,0,36229,48406,0,0,0,0,0,0,0,40402,0,0,0,
+0,0,6995,0,19726,0,0,0,0,0,0,0,0,15032,0,0,
+0,22618,5382,29431,40035,0,0,0,0,0,0,22755,43560,0,0,5489,
+0,30999,0,0,36686,8961,0,0,0,33597,0,0,0,0,0,0,
+0,0,0,19941,31838,36034,7011,0,44527,0,0,35777,0,0,37542,3740,
+48802,0,0,3609,15820,18084,15697,0,0,0,9119,1032,570,0,0,0,
+0,10325,0,17567,0,0,11981,48805,8518,0,0,0,14045,22667,13557,33234,
+46600,48475,0,0,0,6531,0,8507,35414,47711,3275,0,0,0,0,0,
+0,0,0,0,0,4081,0,0,0,8138,3885,31262,0,2955,9590,47795,
+34662,0,0,0,0,0,0,0,7500,35306,20786,0,0,25233,0,0,
+0,0,18993,17394,4778,27698,0,0,0,0,14462,0,0,0,29139,0,
+17202,0,37341,0,0,43010,0,28814,36440,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,30246,30366,40487,0,0,0,
+8378,0,0,0,0,4295,946,0,0,25498,0,0,0,0,26919,48702,
+0,0,0,10356,0,28665,0,0,0,432,17457,42695,22808,40095,45387,0,
+0,0,41064,16513,3815,10760,15452,39843,39800,0,0,41570,0,0,0,0,
+11524,0,0,22324,0,0,0,0,0,0,0,0,0,0,0,0,
+0,31558,0,15505,25107,0,0,0,0,26005,33353,31914,0,3626,0,22084,
+0,0,0,0,0,0,0,7142,8722,0,24,24009,0,0,0,23904,
+0,0,0,48247,0,0,0,0,0,0,10042,35302,41440,17279,0,38408,
+0,18185,0,0,29014,0,0,0,0,21864,34999,0,0,38913,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,14796,0,0,0,
+0,14887,0,0,39467,39996,0,0,0,0,0,35422,0,0,0,21946,
+6084,0,37311,48549,19149,0,22089,29775,39430,0,0,3290,0,0,27227,0,
+0,0,14871,37741,0,0,0,0,0,0,39809,0,0,0,31692,42321,
+44776,0,0,21506,0,14766,0,0,0,17524,22693,14794,26686,0,0,0,
+16285,0,44244,0,21731,0,10090,26279,39353,23489,0,0,0,23934,0,0,
+0,47365,28753,0,0,0,0,37538,3368,3427,14515,0,23001,14074,21308,30108,
+37498,0,0,5147,18772,28003,35451,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,21909,0,23519,0,0,27186,41477,0,0,0,0,
+31495,0,0,0,0,0,0,8594,39614,29252,0,38662,32569,29812,8480,46248,
+0,0,0,0,0,0,0,0,0,1155,0,0,22673,41188,0,0,
+0,12979,46656,0,0,0,0,9931,44233,0,0,0,14290,0,41230,0,
+6873,33606,47818,23919,47062,0,0,0,0,0,25419,38344,38870,0,0,28554,
+17942,0,0,13915,47648,47769,0,0,0,0,25255,9678,39239,0,10953,35338,
+0,0,0,0,0,0,0,0,31719,0,32711,6315,15608,0,36409,0,
+0,0,0,0,6921,0,0,0,0,0,0,0,5548,46820,0,37415,
+29251,0,0,0,13192,13152,47731,0,0,0,0,0,0,24264,32230,0,
+0,0,14552,36232,0,0,46055,0,0,0,34649,0,9224,0,9547,1686,
+45031,8024,25774,0,0,0,0,0,7369,0,2457,0,30726,33973,0,0,
+0,0,25520,0,0,0,0,48818,32441,20607,0,0,24996,25316,0,0,
+12099,0,0,19076,0,37167,16045,42583,30614,46924,6488,7472,11410,35898,11061,0,
+0,24919,0,0,0,28799,43688,0,0,0,0,0,0,38791,22885,0,
+0,0,47136,8401,10048,0,0,0,32524,7077,15106,23368,0,0,0,0,
+0,0,0,0,0,0,0,21674,0,0,0,0,0,47702,0,0,
+0,0,0,0,0,24997,12982,0,0,16570,0,0,43022,2872,0,0,
+0,0,0,0,0,0,0,0,0,30539,0,2126,33956,0,0,34604,
+47908,0,0,0,0,0,0,0,0,0,12690,26866,0,18346,29163,0,
+0,0,0,7294,39715,36667,0,0,0,22601,0,0,0,0,0,0,
+18912,0,0,46411,0,0,28213,0,0,0,0,0,0,21244,43584,0,
+0,22698,0,0,0,23224,25262,0,0,0,0,23633,0,0,0,0,
+0,0,39678,0,0,0,0,7632,0,0,0,0,0,0,0,26392,
+39592,13637,19872,0,5914,0,5710,9039,0,4289,0,0,0,0,0,14348,
+0,0,0,34314,844,0,0,0,10148,40260,32513,44321,0,9338,38395,45506,
+12506,0,0,0,35618,0,0,0,0,0,44030,45564,18493,0,0,8881,
+0,0,0,22687,0,0,0,0,43657,0,0,0,0,14550,13306,0,
+0,19346,0,0,0,0,32187,12316,0,47397,0,0,0,0,0,42022,
+1576,29351,25308,0,3882,0,0,42505,0,0,0,0,0,0,0,0,
+0,0,8726,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,46683,0,0,39506,0,0,0,0,0,0,0,0,0,
+0,0,33295,0,0,0,15590,21880,0,4611,12210,35687,0,6518,0,0,
+4667,18589,0,47034,0,0,0,0,0,0,8096,0,0,0,0,0,
+14564,27029,0,0,0,0,6662,0,0,22771,0,0,0,0,0,45889,
+0,31290,3398,29059,27173,43944,46233,0,0,2836,0,0,0,0,22310,14312,
+25197,0,0,34272,29494,20655,25128,37430,15702,16573,48341,0,0,28470,0,44436,
+19458,0,0,0,36702,0,0,0,0,0,0,3818,8293,0,0,0,
+0,42272,11451,14028,6570,10363,30332,0,37892,0,0,31904,0,0,24107,0,
+5905,7316,33697,0,47344,0,0,0,0,5308,0,0,0,0,18485,0,
+0,11011,33055,0,0,23927,0,0,0,0,22649,0,42163,37218,0,6471,
+0,0,0,46545,0,0,0,15899,17019,12502,37926,46186,33733,0,45777,30898,
+0,0,0,0,0,0,0,0,48610,32344,0,0,0,0,0,0,
+0,0,0,0,0,0,0,41901,0,0,0,0,0,29659,4990,0,
+0,0,0,0,0,0,0,0,0,0,45505,24174,0,0,27357,0,
+0,1947,14486,19393,0,477,15647,0,12844,0,39837,0,0,0,27117,7044,
+0,0,18354,0,0,0,0,0,0,48018,33498,0,8243,23663,8397,36924,
+25701,0,15598,23087,2003,0,0,29605,19591,42720,0,32087,0,11808,18942,0,
+0,22320,0,21311,0,0,36093,34796,16210,37381,8263,28305,45349,47942,42817,29880,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,15065,0,0,0,0,0,18621,0,13166,0,39994,21884,25636,0,
+0,0,0,43121,0,29566,0,8510,0,0,0,0,0,35688,0,0,
+0,0,0,0,5739,10604,10525,10626,24755,25831,18442,0,33784,43294,0,0,
+0,0,38291,0,0,0,39166,706,6101,15384,0,0,0,0,20212,0,
+9126,0,40718,0,0,0,0,0,4180,0,0,0,0,0,0,0,
+0,0,0,33573,10982,45428,36553,13598,21834,35310,7679,10035,40618,44479,0,32151,
+0,0,15684,0,36441,0,0,0,0,6535,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,20512,0,0,0,0,0,0,
+46267,15701,0,0,0,0,0,12868,0,0,0,0,0,0,0,0,
+0,0,3081,0,39075,0,38356,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,45767,10137,0,0,0,0,0,0,47536,0,14817,
+37884,0,0,0,0,0,16825,36278,0,0,8266,38171,23613,10711,43714,44470,
+0,0,31365,24952,0,13150,0,0,0,1424,6831,29003,0,0,0,47683,
+0,0,0,8276,8877,12604,44622,0,2843,0,0,0,15391,0,0,23752,
+26599,0,35426,45593,0,0,0,0,0,0,31960,0,0,0,0,0,
+36514,20023,25251,27302,32053,48872,0,0,0,0,0,0,0,0,0,40419,
+0,6056,0,0,0,0,0,0,0,0,0,44667,0,20170,9510,0,
+0,0,0,0,0,0,0,0,0,0,0,0,27967,0,0,4298,
+1984,4084,23925,30683,35551,13636,0,0,0,17591,45712,34288,0,0,0,0,
+0,0,45019,0,0,0,0,0,40634,32133,43084,0,0,0,0,16949,
+0,0,0,0,0,0,0,0,39820,0,0,0,0,0,18246,41297,
+6958,0,13484,0,0,0,39537,0,0,0,30426,360,0,0,0,0,
+0,17949,12619,11593,0,38686,0,0,25101,47214,0,0,0,47989,48033,11325,
+0,23406,0,4796,0,0,0,11679,0,37668,0,6246,11434,0,3017,0,
+0,44936,0,0,41840,27554,0,0,0,0,0,0,33248,0,1327,16970,
+0,0,0,0,5980,0,0,0,0,42166,0,0,0,0,43280,0,
+0,4772,23207,39012,0,0,0,0,0,29171,42111,0,5855,39993,44358,0,
+0,870,0,2720,43784,6204,0,40,0,0,0,0,0,6786,48121,0,
+0,0,0,0,0,4385,8209,21110,19417,28190,6592,11068,28224,0,0,0,
+0,0,0,0,0,0,0,0,0,42105,0,0,0,11952,18770,0,
+23913,0,0,3006,0,33877,0,0,0,0,0,0,0,0,0,38992,
+0,0,40577,25177,15178,44795,0,46427,2713,21610,42296,44007,25091,8685,6446,21602,
+8708,0,0,46915,0,0,0,1018,14274,0,0,0,0,0,17867,0,
+43818,0,0,31940,40641,44490,0,0,0,13400,20829,22051,25997,0,0,31995,
+0,0,44339,0,0,0,29713,0,0,27690,0,0,0,0,0,17089,
+43595,0,0,0,0,15001,0,35432,44205,5745,17856,0,46475,0,0,0,
+0,0,0,0,12924,0,24842,18591,33608,0,23802,0,0,0,0,0,
+33529,0,21658,0,0,0,952,0,30128,46187,0,24920,3575,0,41966,0,
+0,27004,0,25123,9766,9819,42794,31255,43996,0,19291,23832,9789,48634,0,7917,
+11935,13650,24938,8584,38697,44256,22290,42580,46062,0,0,0,5184,0,0,0,
+20142,0,0,0,0,0,11504,26548,0,0,0,36568,0,0,0,4907,
+0,0,26606,11561,5370,0,0,0,18438,0,0,0,0,0,0,18141,
+3723,8365,0,45653,0,0,13346,24446,0,0,0,0,0,0,0,31777,
+0,30856,0,41235,47851,0,0,0,0,22003,13559,27815,0,0,0,26555,
+0,0,0,3023,0,35532,0,47105,0,25016,0,13646,36899,0,0,21171,
+45489,0,27535,0,0,11768,0,0,0,0,0,0,0,14676,33306,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,25960,0,
+0,0,20144,0,0,21796,33979,0,0,40757,0,0,0,20422,0,0,
+0,1970,0,0,0,0,0,0,0,0,0,0,0,0,26887,0,
+0,39013,35253,0,0,0,6211,37649,0,0,43758,7400,0,0,44138,0,
+0,26578,0,0,0,0,0,0,16231,0,37212,0,0,0,0,0,
+0,0,0,0,1696,4015,0,0,0,0,0,0,0,0,0,0,
+0,0,0,6126,0,0,0,0,45112,0,4391,20594,0,0,25903,0,
+0,24380,11897,0,36977,19925,0,0,0,5977,33327,41407,0,5320,0,0,
+0,0,0,0,48635,6205,0,10295,26213,0,0,0,0,0,0,7453,
+0,4223,0,0,5887,27589,17955,34866,34943,47325,14193,0,27258,0,0,0,
+0,0,0,25229,38090,0,44714,0,27810,18268,0,0,0,0,0,26126,
+9142,0,29888,0,6475,0,48824,0,12775,0,0,0,0,29398,0,17823,
+36522,5220,0,0,11607,0,0,9004,0,7831,0,47243,0,0,0,45126,
+19398,0,0,0,4747,18864,36313,43504,45048,34214,0,0,0,0,0,0,
+0,9160,10147,43519,0,0,29353,1270,0,0,0,14681,0,0,0,804,
+0,0,0,0,0,6587,0,0,23132,12945,46228,0,0,37103,7705,2572,
+21829,29947,34176,44230,0,0,0,0,6940,0,32992,41945,0,0,9168,30126,
+6754,30547,0,0,0,0,0,28458,0,0,0,0,33769,14945,0,0,
+0,0,19,0,0,0,0,0,0,35933,0,0,5188,0,0,0,
+0,35073,42220,0,0,20661,21678,11160,2302,0,0,0,5868,31041,36692,0,
+38232,0,23044,0,0,0,0,10311,0,0,0,15132,31343,31174,0,5629,
+0,0,0,19778,13968,134,40731,30169,0,20979,0,0,0,0,0,0,
+30965,0,0,0,0,0,11919,18445,24164,0,0,38262,0,0,0,35927,
+0,2670,15381,0,46013,5084,0,0,1928,0,1168,0,7635,3937,2401,0,
+41083,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48190,
+0,577,0,0,0,13488,0,7530,0,0,0,0,0,0,0,0,
+0,0,0,0,1594,0,0,46121,0,5104,45304,4488,0,0,0,0,
+0,45354,0,24313,16960,0,0,46632,0,24894,0,0,0,0,0,0,
+0,0,0,0,14126,0,0,4700,0,29099,31241,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,39719,0,18042,0,
+16723,0,0,0,0,0,7126,11009,20927,0,0,0,0,6081,6256,26722,
+0,22404,0,0,0,0,22133,0,0,40567,164,37767,0,33883,0,0,
+0,0,0,30858,0,0,0,0,6405,2159,3597,14342,19540,0,0,0,
+24056,0,0,10925,0,45788,0,0,0,47933,0,0,18749,11459,1463,40172,
+35897,34665,35960,47906,0,36087,0,0,11058,0,0,0,0,0,25923,0,
+0,0,0,0,0,0,0,30057,0,0,0,0,5995,37011,38015,16593,
+46982,26244,22001,0,0,0,46472,0,0,41442,0,0,12017,0,6588,0,
+0,0,0,0,0,30684,0,2974,0,0,0,0,0,0,25775,1698,
+0,0,7731,0,0,3947,0,31687,0,7702,13586,42075,47954,0,0,0,
+0,0,0,0,12821,0,0,0,0,0,0,30739,0,10966,10015,0,
+0,0,17328,0,0,26826,0,0,0,25146,30335,0,0,0,0,3322,
+22772,43910,0,0,17348,18074,0,40609,0,0,0,36218,0,0,9122,31580,
+33767,30231,48040,0,0,3053,29743,0,36015,8649,0,0,12898,20989,0,48274,
+32108,0,20298,0,0,19351,0,0,0,35393,0,0,0,37488,6936,33080,
+0,0,0,1354,0,0,11972,0,12279,0,0,1769,11995,12772,32083,13465,
+24801,36334,17135,0,19723,0,43442,0,0,0,0,30234,36711,46790,21333,0,
+0,0,0,0,0,0,0,23141,0,0,0,0,0,0,8398,44739,
+0,0,13977,26993,0,0,0,0,0,0,0,3394,32309,0,24253,28293,
+28370,12485,0,0,12620,0,31416,0,0,44600,0,0,13258,48490,0,0,
+0,39839,0,0,45043,33614,0,0,2083,26214,0,0,39119,0,11912,0,
+25941,0,0,32100,0,0,0,0,0,0,0,18324,0,35802,0,0,
+0,0,0,0,0,0,0,7984,14062,27807,43558,0,0,12896,0,0,
+19747,28060,24394,31223,0,0,0,10440,27261,0,0,30934,4001,24112,0,20503,
+43282,36302,46111,40474,0,0,37187,0,0,0,28381,41933,0,23583,0,0,
+0,0,44226,0,0,0,33487,0,0,32205,21891,42520,0,29622,16895,2551,
+18399,27020,0,0,0,0,0,0,17948,0,5222,0,10212,36929,0,0,
+0,30583,0,26438,0,0,0,12250,22861,26576,0,2869,6098,13517,0,0,
+0,0,0,22579,8620,12599,12890,9568,44836,47644,0,6834,0,3622,19559,22136,
+5283,0,44369,0,33728,0,0,0,0,0,0,0,0,0,0,0,
+12127,11550,0,3224,0,0,0,0,0,26219,28324,38980,47613,0,21466,48290,
+40183,0,20003,0,8663,0,0,0,0,4156,0,0,38268,0,0,5202,
+5002,0,0,19359,9257,0,48038,0,0,0,0,0,0,0,0,0,
+0,0,40964,27151,0,0,0,11867,36416,0,0,0,0,0,0,5675,
+15984,35504,0,23800,39336,0,0,0,0,0,0,30384,1250,16490,37278,0,
+19808,0,38839,0,0,0,26178,16849,27992,0,0,0,7997,9411,0,18086,
+12057,0,0,0,44105,0,0,0,16624,27361,32130,26844,39256,48448,0,13411,
+0,3019,0,48322,0,39421,0,0,0,0,0,42206,0,0,0,0,
+0,0,34986,0,48485,0,0,0,22305,24408,24835,28095,0,0,45879,0,
+0,0,0,0,0,0,5480,35550,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,1945,18280,0,0,22995,39746,
+0,0,0,0,737,0,1660,0,21261,0,0,9534,45026,0,41608,2878,
+0,31673,42279,7805,0,0,0,33481,0,0,23053,41402,27565,32139,0,0,
+0,33704,34623,41378,44251,0,0,14900,2319,0,39255,0,21478,26252,0,0,
+0,0,0,0,4657,14098,30590,38070,0,0,25847,0,0,0,9473,25695,
+48243,0,25418,0,4089,35160,6896,44187,40050,0,0,0,0,39876,0,0,
+0,0,0,0,47983,0,0,14411,24898,45660,29876,0,0,0,75,11478,
+31865,0,0,0,0,3844,0,0,0,0,3117,6682,0,0,0,34638,
+9375,20816,30170,0,0,23061,0,38690,0,0,0,0,10663,13946,22142,23062,
+36028,0,0,0,16313,0,0,0,17880,0,35131,4024,30286,0,0,0,
+0,0,0,0,0,0,11360,17051,29651,0,0,0,19931,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,33496,0,0,0,40242,
+36823,42944,0,0,0,0,41812,26832,0,740,21725,0,0,0,48189,659,
+0,44191,26476,0,0,0,0,0,0,0,0,0,0,0,12807,10184,
+32355,0,17854,25680,0,0,0,0,0,23718,24987,11797,38148,0,0,17614,
+0,0,0,41962,0,0,0,48480,0,0,0,0,0,9007,0,0,
+46706,47607,0,36382,15922,0,39399,11996,13038,0,0,0,22932,0,0,0,
+45013,16701,0,24418,38251,0,0,0,0,0,14464,0,17905,0,0,369,
+17753,0,0,0,38403,7200,23510,2817,42962,0,0,40656,0,0,8914,13007,
+13103,26709,0,4848,42567,0,48134,0,0,0,0,0,19887,35239,30904,35611,
+36714,13874,0,27548,0,9195,6185,25356,40432,0,0,0,0,9829,30371,0,
+36433,42620,46237,21265,0,0,0,25121,4513,0,0,0,0,0,0,0,
+31277,11365,46351,40954,0,0,0,0,0,0,0,0,37301,7673,35879,2926,
+0,0,0,43856,32650,32919,0,14954,0,0,3591,44212,0,0,0,0,
+13894,0,0,0,0,0,0,22366,0,0,0,8475,0,0,0,0,
+30717,0,0,0,24892,0,0,0,0,13956,9241,0,0,0,0,0,
+33416,19009,0,0,0,0,0,0,0,0,0,0,0,0,40345,48396,
+0,0,0,0,0,0,0,46791,0,0,0,0,0,30806,0,2566,
+22833,0,16259,33712,0,6911,0,44567,0,44916,0,0,0,31714,30385,37985,
+0,0,0,20653,15274,33959,35563,19165,20251,0,0,0,44741,4764,6679,8831,
+0,0,801,14739,17761,29204,31941,39004,0,36336,656,34166,37235,16585,10105,12270,
+20778,45877,0,0,12134,0,26159,36255,0,0,0,0,27126,17811,38156,0,
+0,0,0,0,0,0,0,0,0,0,28214,42133,43955,0,0,4155,
+2006,0,0,0,0,0,0,25794,0,861,0,29121,0,23478,0,0,
+0,40473,0,14775,30293,0,11321,0,0,0,19450,19903,0,23834,12395,0,
+0,0,0,9535,22794,0,0,0,0,2380,17612,48376,0,0,0,13987,
+15401,43652,0,0,0,0,0,0,0,0,0,10789,35870,22228,0,0,
+0,0,0,0,0,32179,0,0,0,8869,0,0,0,0,0,0,
+0,25494,0,0,0,2812,482,15039,16636,34002,0,37070,0,0,0,159,
+0,0,0,32426,15576,0,0,25340,4577,0,9668,35139,47533,0,0,31017,
+0,35800,0,0,2184,0,0,6723,10854,0,13207,0,0,6614,0,14491,
+19219,5170,15560,22123,34132,0,0,0,0,0,31679,0,0,6620,23532,0,
+0,0,4795,7005,41208,31682,46945,0,0,0,31038,30168,40709,0,0,4074,
+0,45133,0,0,0,0,0,0,0,11961,33026,39972,0,0,0,0,
+16954,46504,2908,0,0,0,362,17112,0,7455,44261,0,0,0,0,0,
+0,0,13576,0,1117,0,0,19970,0,0,0,0,15354,28544,7748,12425,
+1068,33069,39587,7078,0,23889,0,0,0,36912,10456,3048,15458,15847,38078,47931,
+48370,0,0,0,0,0,0,25328,439,15281,19050,24274,42318,0,15610,10641,
+0,0,0,0,17031,0,0,33478,0,0,0,0,0,16627,0,0,
+0,5715,0,0,34739,3316,0,0,20112,0,0,0,40864,43336,0,0,
+27408,0,0,0,0,0,0,23621,3848,35134,0,0,0,2645,2964,22986,
+47761,0,0,36489,0,27050,40347,29791,30205,0,0,7134,0,36552,0,28766,
+0,0,0,0,18249,0,0,2377,45338,0,0,0,0,0,0,0,
+1902,41100,0,24428,0,35697,0,0,0,0,24124,0,0,0,0,0,
+7688,0,11677,39306,1106,0,223,1631,28816,38242,28348,45646,0,0,0,0,
+0,0,11911,0,22061,37261,0,27388,0,40308,13016,18835,0,38920,0,0,
+27781,45717,26536,41379,1951,42940,0,0,2593,0,0,0,0,39266,0,0,
+0,2642,42380,0,0,0,0,0,0,0,14987,0,8929,0,19022,26433,
+0,25767,0,0,0,15028,46498,0,0,2195,0,0,23297,0,0,0,
+38673,0,0,0,26931,2738,20226,19211,34988,0,0,0,15298,0,0,0,
+0,0,0,0,0,11861,0,0,0,0,0,0,0,44123,0,0,
+4593,23647,16483,18736,5526,6520,14236,15763,15895,20645,0,6881,45233,0,4437,32395,
+0,0,0,0,0,11289,0,33092,0,0,0,18865,897,23439,0,0,
+32724,0,0,0,0,16930,34341,0,0,0,9018,45118,0,0,0,1349,
+0,0,0,0,0,39040,0,0,0,0,1741,0,0,0,5233,0,
+0,0,0,0,0,0,0,0,0,0,0,3308,33904,0,0,0,
+0,0,6195,0,0,0,0,0,0,13777,0,0,0,0,0,0,
+0,0,7048,0,0,9896,8465,10019,20744,0,0,0,0,0,0,0,
+0,0,24744,40906,37727,43155,33062,0,0,0,20558,22058,48131,0,0,0,
+0,28283,0,0,21263,0,0,0,0,0,0,30510,0,0,0,0,
+0,1697,6200,3476,0,48548,275,0,0,0,0,0,1020,0,0,0,
+0,0,0,0,0,0,0,0,19105,25257,22199,0,14826,0,0,0,
+0,0,16868,0,0,0,18472,0,0,34356,0,0,0,0,0,0,
+0,1725,15081,37697,0,0,0,40022,0,0,0,0,0,0,0,0,
+0,40165,0,0,23890,0,0,24817,21761,0,26288,10378,0,34201,34756,22401,
+48180,0,0,0,0,0,32339,0,42762,0,0,32755,0,8530,0,23063,
+0,0,32402,44050,5059,0,25723,3871,0,0,0,0,0,0,3182,0,
+16754,0,23088,0,0,35020,12312,0,0,47270,34107,0,0,28263,0,20187,
+5252,24269,0,0,0,16873,0,0,0,27325,0,0,0,0,39069,46671,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,12715,20306,0,0,21623,0,37249,16807,938,0,0,2243,5613,0,0,
+0,30407,37190,0,0,0,9787,10612,28918,31104,0,0,0,0,0,25653,
+0,0,0,0,0,7966,0,45965,9691,18242,23497,0,11950,40967,6739,42683,
+0,1326,0,0,0,0,43296,18602,19700,0,0,0,46201,48154,8889,0,
+0,3433,0,21298,0,0,0,28157,0,18870,18910,0,0,0,0,16769,
+20968,25451,48427,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,39428,0,34941,1550,1658,0,0,0,46565,21949,169,40263,23643,
+0,0,0,0,32227,0,32213,26596,0,0,0,0,0,0,0,0,
+0,0,0,0,36001,7170,6864,8979,21096,25297,28618,30773,0,38955,41287,0,
+29103,0,0,0,0,0,0,0,43024,0,41374,34741,7251,0,0,0,
+0,0,0,0,11392,0,0,0,14144,0,27650,0,0,0,0,0,
+0,0,0,47328,0,0,0,0,0,8173,0,0,36,12776,16633,28406,
+0,0,0,0,30696,39873,0,0,0,0,0,0,35334,27352,47935,16722,
+0,5474,0,0,0,16038,0,0,20575,0,0,3113,0,0,0,0,
+0,0,0,0,0,2508,44767,0,0,0,8493,0,0,0,2521,31464,
+0,0,0,20410,0,0,0,0,18963,45028,40247,7122,45861,8677,7487,32778,
+0,0,0,0,0,0,37148,38281,11780,0,0,0,35455,14046,0,0,
+27181,0,0,0,0,33228,0,17161,0,0,0,0,0,0,0,0,
+10828,47284,4683,11817,0,0,43295,0,0,32280,40454,0,0,0,0,39547,
+7548,25938,15517,35809,42221,0,0,15080,0,45129,28576,0,0,19476,0,0,
+0,0,0,0,2770,20993,0,0,0,0,15723,5758,24869,0,0,0,
+0,34790,0,0,10772,0,0,0,0,8515,25317,0,0,0,22908,45145,
+0,21816,32004,36425,35077,0,0,0,0,39676,0,0,5655,0,10252,0,
+0,0,0,27549,17695,0,0,15046,0,0,0,0,0,38818,42209,0,
+0,0,0,0,45166,0,4387,6962,22407,40350,46418,0,0,0,0,0,
+24573,0,0,0,10489,2755,43561,0,39652,0,0,0,0,24795,0,0,
+0,0,0,0,12611,0,0,0,0,35883,24448,8379,47000,0,28264,0,
+0,0,0,38693,0,0,11313,0,0,0,0,0,0,1208,32859,45377,
+0,0,0,0,0,35030,33239,0,0,0,0,0,0,15875,0,8008,
+657,791,10661,25858,9050,0,0,26378,43439,0,39721,0,42578,0,0,0,
+0,0,0,0,47801,0,0,0,0,0,0,24703,0,23588,0,0,
+0,0,0,26799,4196,30929,0,31018,0,32630,0,40034,0,0,0,0,
+23191,0,0,24027,32319,39299,39504,0,0,0,0,0,0,0,6282,0,
+0,0,31578,0,13148,40337,41375,0,0,7533,37955,0,0,0,0,0,
+0,35209,22227,13491,35634,35894,48501,0,0,39331,0,347,0,36422,0,0,
+34777,13352,27220,39619,41204,0,0,0,0,0,0,18652,43914,3620,0,0,
+48474,13060,43987,41653,0,22958,15277,42010,48234,0,0,0,12697,11933,24267,20965,
+0,0,2491,0,0,28919,0,0,0,30030,0,0,0,0,0,0,
+37825,0,230,0,0,0,41925,34581,0,0,0,29444,34719,0,0,0,
+0,0,0,3749,0,0,0,31218,27298,36537,0,41654,6103,4994,6113,0,
+0,0,5302,21044,0,0,3722,0,0,0,40764,0,0,0,0,0,
+0,0,0,0,0,0,2918,0,42822,0,0,0,0,0,2250,39898,
+4022,0,0,9084,0,14432,0,15950,0,11065,0,0,0,0,0,0,
+0,0,0,3132,0,0,0,0,0,0,0,0,33711,11467,39650,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,1911,6649,0,
+0,31303,0,0,10129,0,11352,0,3405,0,0,0,0,10927,10955,19789,
+21902,26889,0,8281,48519,38659,10611,0,0,0,0,0,0,46469,38977,4920,
+26243,0,0,0,0,16540,0,0,0,6731,48701,0,31742,0,0,0,
+0,27582,0,28979,16488,40688,0,10215,32757,0,0,0,21431,0,42188,0,
+8233,14458,0,0,0,0,0,0,0,3055,0,0,9182,0,0,0,
+0,0,15862,0,0,45940,0,0,41695,1394,0,36037,2023,14621,0,0,
+0,0,0,0,0,10430,19571,0,0,0,43744,0,30931,0,0,0,
+28262,0,0,0,0,20257,42512,19472,15579,27337,0,21162,12287,21226,0,48871,
+0,37101,0,0,0,0,0,0,1044,0,29268,0,0,0,26497,10502,
+0,0,0,24516,0,0,26371,27167,0,0,44777,19724,29224,40787,0,0,
+0,0,0,0,0,27481,28835,0,2167,9557,0,0,3826,14927,16574,0,
+0,0,0,0,0,0,0,0,0,36676,0,14468,0,0,0,0,
+0,0,0,43628,0,1307,35665,0,0,13324,0,28326,2022,17840,12350,41004,
+0,0,0,0,0,0,0,0,0,0,0,18769,0,37321,0,0,
+0,0,21641,13493,1793,0,0,8252,24717,0,0,0,0,27942,40367,46402,
+0,0,0,0,0,0,0,0,2368,0,15963,0,0,0,0,39932,
+0,31994,36618,0,0,2282,25892,13291,40365,1364,0,25953,0,25739,0,0,
+0,0,7744,10150,0,22910,12268,42861,0,0,0,0,0,47588,0,0,
+0,0,0,0,0,0,7607,24449,27289,0,0,42591,0,0,4429,0,
+0,48316,29875,0,0,0,0,0,0,11179,8838,39645,43832,0,41377,0,
+0,0,0,5617,38479,43852,0,0,0,40056,0,0,0,44243,0,7854,
+0,0,1923,0,0,0,0,0,2829,0,43255,0,0,2363,23179,0,
+39596,0,0,0,0,20382,0,0,0,25817,32614,0,0,7324,0,0,
+0,0,31127,22917,0,0,32608,41321,0,6355,0,0,27093,28439,0,0,
+0,34721,0,48334,0,31348,0,12056,46119,2455,12296,0,0,0,10800,0,
+0,22776,21773,0,128,0,0,37143,0,13385,6939,0,0,0,27013,0,
+0,37694,14150,0,0,44407,3210,24576,0,21465,29977,0,0,0,0,0,
+0,0,0,35484,0,0,0,0,0,5797,20763,0,0,0,47077,32232,
+0,20623,0,0,0,0,0,33616,0,44682,0,24480,0,29767,0,0,
+0,0,0,0,0,14779,22846,0,0,0,0,4901,48353,0,0,0,
+27224,0,0,0,493,20284,23329,0,47929,48842,0,0,1260,28991,0,45315,
+0,0,3158,0,11638,0,29845,0,0,0,0,0,0,0,0,25232,
+0,3231,39814,4710,30092,37340,38247,0,0,0,0,9706,33926,0,0,20634,
+41998,44983,48483,44215,0,0,0,0,32297,17155,26552,31946,5425,27758,37175,0,
+0,0,0,0,0,33594,37811,3891,4114,0,8681,33365,0,0,35895,37394,
+39739,0,0,0,0,1348,0,0,0,1655,18342,40559,0,0,0,0,
+0,0,4296,44735,33577,13936,18809,0,0,34013,0,0,0,0,0,0,
+0,13009,11538,1604,11042,8799,18251,7559,29728,46608,0,0,0,0,21975,38040,
+0,0,0,0,0,0,37554,0,0,33042,0,3930,26342,39995,41822,34619,
+42387,0,0,0,6046,0,36321,37491,40915,0,0,36573,38426,10703,9910,0,
+0,0,0,17641,0,0,0,24935,0,0,31084,21997,0,17078,0,0,
+0,0,0,0,0,0,33611,0,0,10098,32856,0,0,0,5452,0,
+0,0,0,33383,12727,0,0,9438,14746,24416,19784,15618,19752,12919,23818,7689,
+0,859,0,0,10302,1564,15607,11213,23680,0,28021,0,21330,0,47458,0,
+0,0,0,10599,42641,0,0,18944,6891,0,0,25937,26787,0,0,0,
+0,5363,9279,0,0,0,0,0,0,12910,0,0,0,29052,48,6794,
+0,0,0,0,0,0,0,0,0,21351,41090,0,0,6294,0,0,
+0,20244,0,0,0,0,15496,7671,29882,24162,0,0,0,233,0,0,
+0,48865,0,0,4615,0,0,0,0,48616,23968,47624,0,0,0,0,
+882,42682,0,0,0,0,20724,0,0,0,22614,0,0,0,0,0,
+0,0,33815,16352,40342,45603,0,0,0,1843,16437,6445,0,0,23247,0,
+0,0,0,0,35908,0,0,0,5911,0,3701,11134,22412,0,0,19238,
+10710,22055,10667,13820,38995,25054,0,0,0,11853,45982,0,45827,0,0,0,
+0,32270,0,39803,31484,1887,0,0,0,0,0,0,0,0,0,12254,
+32323,3704,0,0,0,0,47522,0,18948,0,0,48088,0,0,0,32623,
+0,0,20669,3881,0,15770,0,0,15624,0,0,36979,4948,21911,47677,28298,
+29527,43799,44136,0,0,21529,0,0,0,0,0,722,7729,38643,33459,43934,
+0,0,41660,0,8744,10814,0,0,0,0,0,0,0,0,35249,27432,
+45378,0,0,0,0,0,0,41823,7039,17655,18642,0,0,0,35165,41913,
+39615,0,0,10983,0,11688,15252,0,0,28952,0,20770,45721,0,0,0,
+0,0,22666,41367,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,24093,0,0,0,0,0,0,0,0,0,0,0,920,
+31033,0,0,21245,0,4471,0,0,0,0,0,0,0,0,11689,0,
+0,0,0,19940,0,0,0,0,0,31298,48208,0,26689,0,0,0,
+0,0,0,0,26074,0,23454,26247,0,0,0,20713,15117,0,0,0,
+0,16415,0,0,0,23622,0,0,0,0,14375,0,1323,37195,14687,23452,
+26150,0,0,36025,0,0,18794,0,12496,0,0,40632,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,23208,47442,34563,0,0,0,
+0,0,33169,34475,0,0,9169,0,0,0,0,11167,0,13282,0,0,
+0,0,0,15874,4536,26442,11012,7286,33101,0,0,32352,0,38272,0,0,
+45363,0,0,14419,0,0,0,44920,0,0,5257,11050,41746,1678,0,0,
+0,0,23303,32507,0,0,2687,45077,0,0,0,0,0,0,0,0,
+4524,0,0,0,0,0,39906,0,31339,0,0,12931,0,0,0,0,
+0,0,0,0,34257,8529,43828,26072,0,0,0,4325,0,0,0,25411,
+41555,0,4763,14042,0,0,6681,0,0,12275,0,0,0,0,0,0,
+0,30484,47299,0,15109,0,9689,25747,34876,27862,0,0,29936,0,35262,0,
+4494,0,0,0,0,0,0,0,0,23161,23696,16575,0,0,0,25959,
+0,0,0,0,0,4787,11228,36190,31358,44862,46313,0,0,0,0,0,
+45466,0,0,30087,10367,24087,0,0,0,19895,25999,0,0,0,0,0,
+0,26899,17344,2157,0,0,9309,0,0,0,41995,6277,0,40179,45451,0,
+16827,0,0,0,16972,17010,24401,0,0,0,38698,0,0,16249,15542,0,
+0,25931,15552,33661,35962,45361,0,0,0,0,0,9016,0,0,0,0,
+0,0,0,0,0,21475,10662,1453,41314,13163,42701,0,0,0,0,0,
+0,15286,38304,0,0,45244,0,0,23930,0,0,6664,0,40143,9663,0,
+47158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11219,
+43499,0,35127,0,0,0,18366,0,0,38484,0,0,9755,17774,0,19585,
+0,0,5726,12188,0,1751,1803,0,0,0,4335,0,0,31766,7389,0,
+0,0,0,11423,0,0,0,0,3935,0,0,1517,0,0,0,0,
+0,0,48090,0,0,0,0,0,0,40220,0,0,0,0,3678,5121,
+11892,0,0,0,10593,26954,0,0,23548,0,0,0,0,10267,0,0,
+41157,20005,31494,0,11560,0,0,0,0,0,19303,0,0,889,0,42703,
+22038,35232,0,0,0,0,0,19813,3312,30540,42715,0,18720,0,34505,38743,
+0,0,0,40475,0,0,0,0,46531,18016,0,0,41761,0,0,0,
+15433,24399,12944,4930,35905,44946,12238,0,38934,14070,10911,0,0,18011,46603,24031,
+40639,13746,0,0,0,0,0,0,45874,20742,4887,0,0,0,0,47195,
+0,0,0,0,929,7341,0,0,48652,0,0,0,18288,0,8392,0,
+21239,25176,48864,0,0,0,9141,16292,39128,45173,0,37482,0,0,0,2879,
+6513,9139,9228,16660,2325,26909,31530,43540,0,0,0,0,30948,0,0,44430,
+0,0,0,0,0,0,3087,0,0,0,0,0,0,0,0,0,
+13620,0,36887,41735,0,0,0,0,0,0,0,0,13175,0,0,0,
+0,0,0,0,39869,0,21297,0,0,16076,0,0,0,0,38160,44846,
+814,9672,15052,29102,40560,0,0,7926,0,0,0,0,42674,24833,0,45096,
+24143,0,29074,0,0,0,0,0,14492,47654,31207,0,0,8999,35041,0,
+0,34258,0,6216,0,24424,47661,0,17588,32341,0,0,469,5596,5572,43489,
+26062,45057,0,0,0,0,8066,0,0,0,0,0,0,0,7159,31630,
+38597,16269,12114,34379,41373,41926,0,0,0,45309,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,44012,12222,15991,23756,0,47202,0,
+0,13798,45716,0,0,0,0,0,1745,6517,34907,0,0,7658,0,0,
+41502,0,0,21841,0,0,38958,0,0,0,0,0,39927,38522,47285,0,
+0,0,0,48592,0,0,0,4973,2845,8326,8902,0,0,0,0,0,
+44574,0,0,0,0,6745,0,0,0,0,13645,0,0,11702,0,43513,
+43238,0,0,0,0,0,0,0,25271,0,0,27528,0,5394,15036,3334,
+41036,42078,2911,32663,0,0,0,0,0,7019,8577,9608,39136,0,46274,0,
+0,0,0,0,0,0,0,15191,0,0,0,40114,26995,42784,0,0,
+12383,2641,0,0,0,0,0,0,0,0,0,37079,0,0,42066,0,
+0,0,0,0,4660,0,0,0,0,0,0,39416,0,0,0,42157,
+0,0,0,2483,26280,0,0,0,0,36141,948,0,0,31770,0,0,
+0,20209,29912,32379,0,0,0,3465,32625,0,39047,38948,0,0,0,0,
+914,15022,0,2441,0,45734,44354,39402,0,0,42821,0,0,0,41089,40410,
+0,0,30304,0,0,0,0,0,0,0,7466,17958,2792,45666,0,10370,
+15026,35233,0,0,0,0,0,191,40301,38782,46563,0,0,8433,21730,44026,
+3660,0,41634,19969,44740,7631,47619,0,0,0,0,0,0,0,0,25665,
+40939,43408,614,0,0,0,0,0,0,0,0,0,0,48892,0,41213,
+0,0,0,18316,0,0,0,0,0,185,0,25301,0,0,0,0,
+0,36876,0,1652,0,0,0,27027,27170,3439,0,0,40729,0,0,0,
+44760,0,0,0,0,0,0,0,48070,24392,21642,34833,0,38619,0,0,
+0,0,26180,0,0,0,0,0,0,6685,21684,4359,5342,8492,8715,12933,
+15279,22726,39091,0,0,0,3548,12828,30843,0,0,0,15800,0,25330,32315,
+47451,0,37472,0,28924,14148,0,0,40850,46586,0,0,0,3211,15792,20670,
+0,0,24068,2468,0,2001,15728,21183,7272,30605,40152,0,17482,48794,0,0,
+34079,0,0,45497,37719,0,0,23577,47009,0,20275,0,0,32948,17220,0,
+0,0,0,0,18611,19605,37479,0,0,47334,0,20444,0,0,4533,22161,
+45089,0,0,0,0,330,0,4892,44276,37948,0,23704,22451,0,0,0,
+0,0,2039,0,15431,20837,32557,0,0,0,0,0,0,44731,0,13270,
+0,0,0,0,0,0,0,0,1131,27143,16596,44756,31750,0,0,17514,
+0,45078,46839,0,19490,0,0,0,0,0,0,4755,42867,953,0,0,
+0,26602,0,21780,0,0,0,0,0,0,0,47294,1211,22580,11359,0,
+0,14206,39958,0,0,0,0,0,0,0,0,21237,20491,27407,0,0,
+22583,1948,23716,24878,29725,47827,0,0,34468,0,42132,24721,0,41381,3577,0,
+3189,0,23538,0,0,0,23223,31966,38576,0,6436,26810,0,0,0,0,
+0,0,0,0,0,12476,0,0,10166,25364,25569,0,0,0,0,0,
+0,0,0,0,41491,0,0,0,0,27871,0,0,0,0,0,0,
+37217,0,0,0,43369,0,34447,6476,0,0,4141,23529,15926,0,0,0,
+25989,0,39465,0,34116,12801,16584,39034,0,0,0,0,0,0,0,0,
+0,0,0,0,0,27694,0,0,0,27973,0,0,0,0,20372,26234,
+37718,0,20102,24141,24493,39355,0,0,0,0,0,0,0,0,0,0,
+0,45123,0,2842,0,0,0,0,28516,0,14869,25672,45094,663,0,0,
+0,24234,0,14516,0,21059,12688,16449,0,0,0,39930,26129,0,0,0,
+0,1993,35525,0,0,0,4222,0,31877,38919,0,22402,27411,4708,0,46037,
+0,19133,1340,0,0,0,0,0,0,0,0,6928,0,0,0,46669,
+0,0,0,0,3163,3865,0,0,0,0,1873,7505,27300,0,33881,41850,
+45758,0,11399,13724,44442,0,0,0,0,22201,0,0,0,0,28943,42635,
+0,0,40361,0,0,0,0,0,45276,0,18922,0,0,0,16205,0,
+4236,12026,22536,0,0,6865,0,0,0,0,0,17430,4961,0,0,0,
+0,16764,0,6213,0,40346,0,0,0,10469,38108,21557,28179,37520,47680,0,
+0,0,0,0,0,0,0,47064,0,0,0,33279,0,0,0,27014,
+37286,0,0,0,0,0,29305,0,0,0,2777,26162,0,0,0,0,
+0,37383,0,0,0,0,0,47489,0,0,0,0,0,27885,13165,0,
+0,7569,39084,0,0,47759,0,24625,0,0,0,0,0,4876,8978,23000,
+0,151,0,0,0,0,0,0,4515,13819,0,19025,688,0,0,4148,
+15615,32901,0,0,0,0,0,0,1431,8993,2816,18413,21283,0,0,36131,
+0,21227,0,2907,0,0,0,47781,14072,43985,0,0,0,22555,0,0,
+0,0,0,388,24429,25532,0,0,0,0,15852,0,0,0,0,0,
+0,39936,0,0,0,0,21479,0,0,0,0,8535,0,30480,0,0,
+25822,0,14293,34648,0,32626,0,0,0,0,39189,33222,35643,0,0,45900,
+0,0,0,27921,26518,0,41400,43703,0,0,0,0,0,8305,9845,0,
+7377,40008,34089,0,0,0,0,0,0,0,36942,6563,23083,25748,43579,0,
+0,0,0,23893,0,39437,14291,0,0,0,9601,37252,41017,30645,0,0,
+11139,0,0,0,0,0,0,0,0,48323,0,0,0,29109,0,0,
+0,0,35587,0,0,0,14079,0,0,0,30274,0,0,0,0,11733,
+0,0,0,36147,0,0,0,0,24843,0,35369,0,21533,0,44150,6139,
+12374,27260,34949,0,0,41671,0,22385,0,0,0,0,26040,46789,0,0,
+0,0,0,0,0,0,9093,10244,0,35140,0,0,27033,0,28106,0,
+0,0,0,0,0,2668,0,0,0,29779,0,7040,42768,0,11576,0,
+0,0,0,0,0,0,0,18754,42497,48020,0,25712,0,26081,43008,0,
+0,9925,9622,12592,0,0,0,0,18751,0,0,0,13503,0,40177,0,
+0,0,0,0,0,9850,3662,14136,21011,23846,30780,35781,43615,0,36680,0,
+6628,13095,13472,29157,3727,40343,37911,0,23243,27874,0,1376,33027,44608,18337,0,
+0,4383,28203,34368,35005,37975,0,0,0,42977,0,0,0,0,0,0,
+0,0,33567,23999,0,5662,0,24546,0,0,0,0,4071,0,0,0,
+0,0,4486,0,0,20609,38925,0,0,0,1522,0,0,21669,46367,0,
+29604,0,8330,0,0,0,0,0,0,0,0,44602,0,0,0,0,
+0,18142,19312,24186,36583,0,0,41710,0,14589,0,0,0,40767,1935,18516,
+0,14177,0,0,0,0,0,0,0,0,0,15557,14915,44805,0,0,
+0,0,23590,0,0,0,0,13753,25975,44772,46511,13744,0,0,0,37781,
+0,17399,0,7214,43491,36381,0,2471,0,0,0,15210,0,0,0,0,
+0,0,0,0,42082,18320,0,0,0,0,0,0,0,36616,8348,40852,
+0,41844,0,0,0,39943,0,20362,0,9834,0,0,0,17436,47883,0,
+0,41787,0,17377,0,0,0,0,0,34469,0,0,28282,0,5809,37277,
+0,0,9040,0,3236,37944,0,0,0,0,10128,0,0,7165,0,0,
+0,10003,0,0,0,0,35169,0,0,46540,0,0,0,0,0,15856,
+0,0,0,0,36884,0,0,0,0,6569,0,0,0,23468,33455,0,
+0,38540,0,0,0,0,36155,0,0,0,0,4326,28630,0,0,0,
+25342,8277,8441,18386,33668,47928,0,0,0,0,4677,27111,33172,0,0,0,
+0,0,0,0,43957,0,7112,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,13039,13599,0,0,0,338,0,48694,43768,
+0,20361,0,3026,31848,0,0,0,26739,0,0,0,0,0,0,0,
+12360,0,0,0,0,7670,16147,32374,46069,0,0,0,210,40920,41994,0,
+0,0,10725,40624,0,0,0,0,26185,0,0,0,0,0,0,192,
+0,0,0,0,0,16428,30881,31514,0,0,0,0,0,21462,0,373,
+33713,0,0,46942,0,0,0,48684,0,0,0,0,0,0,0,903,
+0,0,0,45616,0,0,0,0,5001,19239,46548,36593,44454,0,0,0,
+0,0,33165,42594,0,0,0,4482,0,16695,48530,8268,18694,13628,37823,38501,
+0,11918,0,22503,41024,0,0,5856,0,0,0,40810,27268,0,0,10037,
+0,14377,30063,0,0,0,0,0,0,0,0,970,0,0,28167,8402,
+0,0,0,0,0,0,0,0,0,0,0,0,36520,17077,0,0,
+41914,0,1675,0,0,0,0,0,0,0,22147,0,0,0,0,0,
+0,0,0,29607,13008,0,0,0,18144,0,18045,0,0,0,0,42378,
+0,0,0,0,0,0,0,0,17261,0,48477,0,0,43992,42363,0,
+10080,0,0,0,0,42160,0,23528,24229,22315,47102,0,26069,0,0,0,
+0,0,0,34901,0,15952,41574,46189,0,0,0,0,0,0,0,0,
+0,3448,13773,0,0,0,19523,0,0,15218,21996,22021,47845,8426,0,0,
+0,0,0,43737,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,48344,0,45578,0,9294,25763,42319,0,5255,19377,0,0,0,19547,
+32710,0,0,0,0,0,0,0,11834,0,26444,0,0,5245,11525,0,
+19410,11823,25007,43945,0,0,0,0,0,0,0,0,0,0,0,3856,
+27851,25212,35375,47518,0,33338,40376,11238,0,46522,0,0,0,8815,0,0,
+0,0,0,0,0,0,11934,0,32447,0,0,0,32349,12054,13433,42276,
+15170,34774,37597,31148,43085,48658,0,0,0,0,0,41068,32541,35875,38831,48797,
+0,0,5073,0,0,0,0,7612,0,3131,17087,0,0,0,0,0,
+0,0,0,0,0,25409,3769,6608,36496,12892,7043,28668,17707,33942,0,0,
+32051,0,0,0,28008,0,0,0,18569,0,0,43344,0,28538,3595,44378,
+0,0,0,2681,0,5378,7579,39788,0,0,5579,37308,0,0,0,0,
+5942,0,0,0,43756,0,0,0,0,0,7213,3411,14620,0,0,0,
+0,32738,0,0,0,5353,29805,37139,0,17739,0,0,0,0,0,0,
+0,0,27750,0,0,40895,10954,48612,0,0,9576,41514,0,46195,9948,0,
+0,16379,27427,0,7807,39060,9712,0,0,0,0,46605,0,23027,0,0,
+0,0,47719,14138,0,0,0,7946,46412,0,0,7047,43626,45807,9320,0,
+0,0,0,3627,25671,15621,17597,33921,0,10816,31693,0,10750,0,29469,0,
+0,0,968,28751,0,0,0,0,0,0,0,0,17471,44426,27678,30951,
+0,0,0,9594,0,0,0,0,0,0,0,0,0,0,0,0,
+9796,2255,3832,0,21047,0,0,13551,0,0,0,0,35190,0,0,0,
+2819,29592,37304,40330,7333,3983,0,0,0,0,32530,0,0,13422,20772,0,
+0,19314,0,43904,15637,0,0,48149,0,0,10690,0,0,34392,23486,0,
+0,0,0,0,0,0,0,0,35842,0,0,0,0,368,6769,28420,
+0,0,4056,0,0,6313,0,43245,0,0,0,0,13816,0,43201,0,
+34409,0,0,18234,0,0,0,0,0,0,3313,24308,29128,29861,0,0,
+29203,0,44919,0,0,0,5201,47986,0,23737,0,0,0,1042,0,0,
+1630,20550,46786,4704,0,0,0,0,0,0,5459,0,0,0,0,20569,
+32065,0,0,4725,20360,0,0,0,0,0,0,0,0,0,0,0,
+0,39742,305,5198,0,48262,22718,4460,39580,0,22599,0,18650,32081,0,0,
+0,0,26573,0,0,0,1302,0,0,0,0,0,0,0,0,0,
+33774,0,18252,0,0,5680,16194,9413,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,17741,29851,0,3977,0,30819,11849,0,10359,
+26351,0,0,0,0,0,4320,0,0,0,0,13692,24268,9365,0,0,
+34628,26273,10118,46658,0,0,0,0,28726,0,0,27733,36115,0,0,45072,
+0,0,0,0,0,32930,43271,0,0,0,0,0,30845,0,19253,0,
+31891,47307,0,25202,0,0,0,0,0,0,9074,0,12792,0,12267,0,
+0,7243,0,0,0,27055,0,0,0,0,0,0,34324,44986,10073,31334,
+0,9428,0,0,0,0,0,0,0,0,0,34865,0,39218,0,35558,
+23232,41014,6234,46060,33340,29270,11850,27832,0,9596,14237,18223,23089,28239,7182,41042,
+0,20278,5720,9032,40317,2343,9852,0,0,0,3872,4004,0,17492,22767,30877,
+0,26700,28931,8440,15536,34588,0,0,15888,38566,0,37559,36304,0,0,11191,
+32604,0,0,0,47985,0,0,0,0,0,0,0,0,5821,9823,0,
+22545,3757,42819,21869,0,0,5439,0,0,0,25659,16233,42590,0,14373,39553,
+38201,0,8667,36921,0,0,0,0,2081,9391,10591,9873,27228,37818,17451,44903,
+45484,0,0,25703,0,0,0,0,0,9677,8971,0,0,0,19510,0,
+30334,0,0,0,6595,0,33128,7191,18297,7574,37126,12187,0,0,0,0,
+48233,38951,0,0,8555,9031,23998,0,23349,0,0,0,0,0,0,0,
+0,0,0,10874,0,0,14612,0,0,17938,10097,29675,0,5553,5912,0,
+0,0,0,21967,0,0,0,0,0,0,0,0,17045,5079,47732,0,
+5896,0,0,13877,2059,27932,33015,0,14434,0,0,0,0,18073,0,0,
+0,20912,48085,0,0,0,13133,0,0,0,0,14942,42718,27930,0,0,
+25424,0,0,0,0,26653,0,13267,0,0,0,17174,0,42364,24088,0,
+0,0,0,46662,11490,0,9176,0,0,0,6092,0,0,38825,0,0,
+0,0,0,0,0,0,6102,0,843,0,0,0,0,0,0,0,
+35413,0,0,6658,9412,0,0,0,40319,25179,0,30809,0,18138,0,15002,
+0,0,0,42595,0,0,0,0,0,10412,32381,9021,743,0,0,0,
+0,17496,16745,0,0,0,0,0,0,0,0,0,0,0,35017,19521,
+35682,30674,42911,0,15310,16327,45950,0,0,0,37605,0,0,26236,0,0,
+676,22316,24158,29212,0,15405,0,34457,27085,0,42391,0,23068,39812,40928,0,
+0,0,29941,28094,0,0,0,0,0,0,5782,14384,0,10200,0,0,
+0,0,0,1412,0,0,0,0,0,42280,0,0,0,0,0,0,
+0,0,21072,24531,0,0,41619,0,0,0,6214,0,0,0,15712,0,
+0,0,0,0,0,0,0,0,0,0,0,16173,9456,43738,0,0,
+0,46879,0,0,14006,0,22379,0,0,0,22348,0,0,0,20851,41752,
+0,0,0,0,0,0,0,0,1401,0,0,0,0,47597,0,0,
+0,0,0,0,2896,25189,45809,0,0,28085,0,0,0,0,0,0,
+0,7695,0,0,0,46352,32207,18999,27505,46452,26962,7359,39862,40863,0,0,
+46907,0,0,20461,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,25623,19056,26794,45193,9758,39877,367,6457,9973,33200,33641,34147,
+42467,47728,0,22378,0,0,0,0,13311,0,0,40724,0,0,2065,0,
+0,0,0,0,0,0,23948,0,0,2726,0,0,0,21819,0,0,
+1720,3582,5178,0,8850,28149,0,0,30986,0,0,0,0,310,0,46881,
+0,0,0,0,32009,23634,0,0,39953,0,0,3878,0,0,0,0,
+24555,0,0,0,0,0,18780,43068,0,0,1102,0,47508,0,0,0,
+0,528,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1426,0,0,14733,9318,30542,38804,0,0,0,24251,43550,0,0,0,31876,
+21892,35081,0,34255,0,0,0,0,0,0,22717,0,11999,21079,0,0,
+0,10058,0,18389,0,0,0,43515,19782,0,0,47578,26101,42214,0,0,
+12479,0,0,0,25284,0,0,0,20081,0,9472,0,0,0,0,0,
+0,0,0,48577,0,20468,0,0,0,0,26882,36163,40315,48381,0,0,
+7909,43725,0,0,0,13200,25003,25753,36925,38473,44749,43775,0,0,34016,7465,
+0,3914,38573,0,0,38843,2901,0,0,0,0,0,30712,2247,34698,0,
+0,0,0,24197,28693,0,0,42995,19175,0,0,0,0,0,0,0,
+0,0,0,44270,38022,0,34899,0,0,16638,36099,0,46059,0,4173,39374,
+34799,0,4069,0,0,0,0,0,0,0,0,5287,0,0,0,0,
+43477,0,0,0,0,19937,0,38517,0,12378,19460,30902,37239,0,0,0,
+0,0,0,0,0,45480,0,0,0,0,30723,0,0,0,10846,0,
+16913,0,0,0,0,0,0,0,36527,0,0,0,0,0,13349,38357,
+0,0,0,0,7180,0,0,8445,0,0,0,8873,0,37770,42264,6157,
+11339,22952,0,0,0,0,0,0,41881,0,0,0,0,0,0,0,
+25142,0,0,19277,16925,0,21468,0,0,0,0,24420,30004,47203,0,0,
+0,0,0,29538,0,0,0,0,0,0,37086,26511,39429,0,0,0,
+20024,0,0,0,0,10346,0,0,0,0,12281,37342,0,0,2512,0,
+0,14361,0,0,0,2933,32784,0,0,4501,44319,0,0,0,0,0,
+45736,2533,40714,42842,0,0,0,0,0,0,39638,2834,47253,3619,9739,41271,
+0,13126,0,18782,0,0,28558,0,0,0,0,48847,0,0,41076,43656,
+0,18060,0,0,0,0,0,0,6690,0,775,15909,0,0,0,0,
+0,8852,0,0,0,0,23798,32771,0,0,0,0,0,33466,0,0,
+13323,14264,38554,28271,39763,48267,0,44014,0,16582,29907,0,0,0,22648,0,
+0,9163,33716,0,27542,0,16976,32353,0,3046,0,0,0,0,0,0,
+40128,2309,37255,19319,0,0,36252,31345,45728,0,0,0,0,0,0,0,
+0,0,28589,0,27097,31843,0,11815,0,0,0,0,0,0,26055,5082,
+0,0,15010,0,0,20101,0,0,0,7229,33508,0,45368,29137,0,11302,
+0,0,18707,0,0,0,0,0,0,2269,35806,39492,47116,0,0,0,
+0,0,0,0,5676,0,17362,0,0,0,29363,0,0,0,0,0,
+0,756,0,5752,15301,0,0,0,0,48444,0,1325,42596,0,0,13992,
+0,1916,0,0,36059,0,39041,46440,0,0,16092,0,0,0,0,0,
+0,0,0,0,2299,0,36786,34162,0,31278,0,5193,7818,15583,0,0,
+0,0,0,44374,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,29354,0,0,5107,0,41861,42345,5009,0,0,0,0,
+0,0,43145,0,38428,0,5518,0,0,1069,6851,28811,0,0,0,0,
+0,0,143,0,11379,42613,0,0,0,22420,0,0,0,0,0,41436,
+1082,20473,32054,33895,0,36353,0,0,0,0,25294,0,0,0,0,32043,
+22778,0,34488,0,27279,47859,14200,5812,27169,37436,0,0,0,0,21709,23823,
+47007,0,0,25466,2798,16133,20194,0,0,31763,0,0,0,27089,0,0,
+12848,11100,0,0,0,25901,48829,0,6906,0,31178,0,0,0,14132,0,
+37427,12695,12554,0,16499,0,0,6996,42589,45671,0,0,0,0,0,35727,
+31396,44186,42398,43497,507,31991,33651,37705,37885,40131,43630,0,0,0,0,0,
+12974,3860,2139,0,0,0,41031,48041,0,43506,0,6726,0,1445,0,27252,
+0,0,0,44114,1179,0,0,0,48772,48508,38513,0,0,0,0,0,
+0,0,0,40569,0,0,3916,7117,0,4578,0,0,12176,0,7958,0,
+0,0,0,30461,41785,42846,18459,0,0,0,0,10086,148,42412,43549,16863,
+42136,0,0,29269,0,21714,0,0,0,0,0,0,0,0,46400,0,
+1404,41019,2226,0,38435,0,27769,14745,9312,36008,0,0,7138,37526,17352,30519,
+40322,48355,3337,0,0,0,0,0,0,0,0,0,0,0,34979,21748,
+0,33533,48676,0,34766,44176,0,10032,0,0,0,0,28786,0,0,0,
+0,0,12126,15160,0,0,0,0,0,0,0,0,0,0,40126,7169,
+45810,0,0,0,0,38850,0,0,44624,30467,43851,0,0,0,0,14104,
+0,43672,0,0,43002,0,32658,0,0,0,10679,13876,35333,46777,43257,32653,
+13736,0,0,4136,0,9336,0,34900,14217,22389,42793,0,0,0,23356,0,
+0,0,44263,0,0,0,0,0,0,0,38346,0,0,11920,0,0,
+0,10511,0,0,0,0,0,0,6411,34591,0,0,0,0,0,0,
+0,0,30217,0,0,6265,39536,0,0,0,0,0,7747,0,0,0,
+0,0,0,0,0,18209,0,0,0,0,11059,23067,46259,0,33361,0,
+0,32618,2587,5522,21043,48664,0,36741,0,0,0,0,0,0,0,0,
+44609,38991,0,0,0,0,0,0,0,12322,40344,39796,10122,42408,44246,1448,
+46914,0,0,0,0,0,0,10714,44769,0,0,0,0,18755,0,0,
+0,0,7590,32410,0,0,0,43496,7589,0,0,0,28390,0,0,0,
+27065,0,0,0,0,4571,36133,0,0,29755,0,0,0,0,8717,0,
+0,37935,0,0,5728,18186,0,0,0,0,0,40664,0,280,2772,21180,
+0,0,0,0,0,0,0,18178,0,0,0,0,9455,47201,0,0,
+7116,0,0,0,42503,0,0,0,15937,0,43891,0,0,0,0,12070,
+0,0,0,34090,0,0,7468,7025,0,0,0,0,0,0,0,0,
+48350,0,0,0,0,0,0,0,0,39115,0,0,0,39789,0,0,
+8879,1427,0,22257,0,0,0,23749,0,43782,0,47100,0,43204,0,0,
+46609,10815,0,0,21008,0,36393,5986,0,1620,6250,45618,0,0,0,0,
+0,39904,0,0,0,0,48176,0,0,8169,42341,0,0,0,0,0,
+0,0,0,24388,0,0,0,0,11759,16565,37433,0,0,0,0,0,
+0,0,2880,26053,46920,0,34120,41501,0,0,20847,28174,46731,11400,48876,0,
+0,47656,21549,0,0,0,738,0,0,0,0,0,25777,17115,36411,41229,
+11474,47391,3587,0,0,0,0,0,43019,40989,0,0,0,0,0,19877,
+0,30429,10497,0,25787,29993,37023,0,0,0,0,0,0,24238,34019,43297,
+0,0,3264,0,0,0,0,0,0,0,0,23366,0,0,17901,0,
+21594,0,0,0,0,5165,0,0,0,0,0,0,0,30305,48143,2478,
+42161,0,0,0,20019,44995,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,37795,0,0,2813,48741,0,0,46678,0,0,19390,0,
+0,38052,44719,45764,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,39659,43090,46781,0,0,35864,36698,37318,13775,0,22332,34454,26352,0,
+48657,8660,0,37087,0,0,0,0,517,0,0,10494,0,0,1701,44599,
+0,10294,0,33557,0,8062,0,0,0,4491,13790,0,0,0,0,0,
+0,0,0,0,0,0,0,3070,0,13761,0,13029,18261,0,0,0,
+0,0,0,0,0,0,0,0,43403,0,22449,0,0,7244,43423,0,
+0,0,0,0,0,0,0,0,0,0,17211,22543,0,0,0,0,
+17113,0,5239,0,0,8335,0,12781,40336,3966,15960,21024,0,0,0,35438,
+0,0,0,0,0,0,0,0,0,25936,0,0,10190,14698,0,0,
+4881,0,0,0,19871,0,0,26570,14231,20145,34956,0,7163,0,0,0,
+0,15055,0,11610,27674,32255,32617,25927,0,0,0,2484,13706,0,42355,0,
+24891,39414,29970,47620,48611,0,0,0,0,0,0,0,23308,38550,0,41691,
+47823,0,0,0,0,0,0,0,0,18168,0,0,0,18317,0,36357,
+31593,0,0,0,0,0,0,0,3220,0,0,0,0,0,0,0,
+2275,0,0,0,0,0,3808,0,46817,16081,0,0,0,21487,0,0,
+47179,40746,0,0,0,0,5994,6251,14113,0,0,26059,0,0,30909,4676,
+12097,13719,29028,34305,38104,0,39915,0,0,0,4159,0,0,0,0,23717,
+24249,35137,0,0,36858,19322,0,0,0,7249,36523,16063,0,0,28572,40676,
+0,0,0,0,0,28945,0,0,0,18818,0,0,0,0,0,0,
+0,0,0,0,0,0,20635,0,0,0,0,28779,29049,0,0,0,
+5004,0,25329,2134,0,0,0,0,22246,0,0,0,0,0,0,5027,
+0,0,39224,0,20988,40981,25519,0,0,29965,31901,47035,0,0,0,12673,
+21186,26712,0,0,42767,15120,0,47664,38349,0,11769,0,8315,0,0,13138,
+25483,39191,0,0,0,0,0,0,29100,1434,19371,1870,36765,42284,47707,0,
+0,0,0,0,0,0,0,0,0,0,0,0,11549,0,0,0,
+12158,0,37229,0,0,0,25463,0,39852,0,23181,44507,0,0,0,26684,
+0,47367,0,14905,37951,0,36156,4238,0,0,0,0,0,0,0,0,
+0,0,0,0,27722,0,0,0,0,46473,20909,0,0,26775,46415,0,
+44259,0,0,0,0,3198,41739,10805,0,0,30300,0,22268,0,186,0,
+26681,0,0,32310,12829,0,35200,6196,11658,21365,44119,0,0,32635,17846,0,
+0,0,0,0,31956,24768,1962,1279,0,8870,0,0,0,0,7,0,
+27841,0,28768,21109,32311,39868,5543,10740,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,11393,0,0,24698,21839,36412,0,41651,24108,0,
+0,0,0,0,0,0,0,0,0,0,0,25405,37345,40496,40282,2518,
+0,0,0,0,0,39473,0,0,0,76,24581,0,25843,0,0,0,
+0,37380,0,33223,0,0,45326,0,0,0,0,0,38701,28962,0,0,
+0,0,0,0,45886,0,0,0,0,0,14423,0,0,0,0,0,
+9509,2679,42217,0,0,0,0,0,0,0,0,0,0,36512,0,0,
+22088,0,0,34122,0,0,12011,0,0,0,0,0,0,0,0,44616,
+0,39359,0,17919,0,0,0,25032,0,0,39365,0,14226,0,0,46697,
+0,0,0,36020,0,0,35853,0,0,0,0,46939,31336,0,5295,47254,
+48470,0,8534,0,0,27795,0,0,0,5019,0,0,28226,0,6625,21852,
+24344,0,0,17061,0,9234,28116,16591,25280,46625,0,0,0,0,0,17223,
+22560,0,0,28444,0,0,0,0,0,11143,19021,0,44449,0,0,0,
+0,0,0,0,379,0,0,0,0,0,0,0,0,0,0,7786,
+0,0,0,0,42571,0,0,0,1237,6272,45159,0,0,0,0,38427,
+0,0,700,12626,14412,0,0,0,6965,0,0,21202,0,0,7006,9221,
+17806,19843,23130,23645,24220,21086,0,0,1927,0,46197,30152,0,0,0,29313,
+0,4134,31385,41532,8259,4025,0,0,0,0,0,38325,24802,0,0,0,
+0,33020,44514,0,0,5013,6105,0,43633,0,0,12303,0,0,0,0,
+21728,0,23897,5988,0,0,0,32430,0,0,0,0,0,0,0,43243,
+0,0,0,0,47167,0,0,0,0,0,41446,0,0,0,10948,0,
+0,0,2273,8948,0,0,31992,0,0,36315,0,0,0,0,0,0,
+0,45685,0,0,0,0,0,20263,4971,0,0,0,0,9762,0,0,
+0,45681,48199,16208,48424,0,0,0,0,0,23235,6164,32706,0,0,0,
+0,0,0,30054,23740,0,45108,0,0,0,0,24052,0,31845,17529,0,
+0,0,0,0,0,0,30026,0,0,0,0,0,0,0,0,0,
+23844,0,0,0,877,7833,0,0,31727,0,0,0,0,0,26949,0,
+0,4270,10052,43494,0,0,28445,5427,8221,31730,0,31999,46368,3027,0,0,
+0,19212,12971,0,0,0,0,0,0,0,0,25124,0,0,0,14519,
+21205,0,0,0,9275,858,0,0,0,0,6577,0,0,0,0,0,
+136,0,0,0,0,29664,41584,44149,0,31639,42262,6626,18345,19198,0,0,
+0,0,2613,0,0,0,0,0,0,0,0,8867,0,46487,11218,21527,
+0,0,0,0,0,0,0,0,0,0,0,25252,0,38748,0,0,
+0,0,22682,0,654,0,0,0,0,0,0,4378,42302,6223,0,2115,
+0,0,12985,7153,33607,25808,0,0,0,0,7757,34661,15325,0,22526,0,
+12432,0,14140,44736,47491,0,0,40135,0,0,0,0,0,26505,44696,0,
+6904,38629,0,0,0,30509,0,21284,17257,0,26776,0,0,0,19989,24669,
+0,18697,0,0,10085,37642,0,16071,18956,40972,32472,0,0,0,0,12650,
+40573,37872,31822,47141,0,0,0,13037,0,35247,0,0,32945,0,0,0,
+0,11941,16432,23602,25130,12059,12671,31113,39350,48463,13172,40230,0,0,3850,0,
+0,0,0,17722,0,11651,0,0,0,39910,0,0,48743,19414,30788,0,
+0,0,0,0,11643,0,15656,40392,0,0,0,0,0,0,18827,27060,
+0,44412,44164,48156,0,0,0,0,0,0,0,38885,0,0,0,0,
+0,34202,30085,10395,0,0,0,23505,39064,44040,0,0,20533,26475,28249,0,
+0,8359,0,0,2544,0,0,0,0,47726,0,0,23783,0,0,0,
+0,33949,0,22966,30364,0,33336,0,43850,47563,0,17378,0,9085,18408,17357,
+42005,0,0,0,35720,0,0,35710,45918,24341,14574,20873,34361,0,42863,0,
+0,0,0,0,0,0,16183,19890,8878,0,27688,0,0,0,0,3854,
+10132,22075,0,29198,0,0,0,0,0,39373,47350,0,0,0,0,0,
+46613,0,0,45018,19781,0,0,0,0,0,0,0,0,0,0,0,
+0,9068,0,0,0,0,0,0,0,0,254,0,0,0,0,0,
+43654,0,0,0,0,0,0,0,0,0,0,0,0,12207,0,0,
+28178,22699,0,7035,0,0,0,47490,0,402,0,0,0,0,0,26400,
+0,0,0,0,0,0,0,0,31468,29482,0,0,5322,12706,18181,0,
+0,0,0,0,10269,30963,20822,0,0,0,0,23310,0,0,0,0,
+0,0,3621,18167,32330,0,0,31690,0,0,15175,8578,31560,0,0,0,
+0,0,0,0,0,0,405,0,0,0,0,0,0,16982,34066,34985,
+0,0,16297,43149,43321,38402,45845,0,0,0,0,0,0,0,0,0,
+10528,28309,0,43471,0,0,607,0,0,0,0,0,0,0,20432,0,
+0,0,3897,22653,0,0,40597,0,8864,15773,0,0,0,19834,46434,0,
+0,0,0,0,36444,0,0,22668,21654,0,5520,0,34054,0,0,0,
+0,27440,0,22585,2971,0,0,797,29731,41580,0,9110,35011,39030,0,0,
+0,32676,44337,0,40154,35322,0,0,0,0,0,40909,17108,0,3822,0,
+0,0,0,24349,0,0,0,0,0,0,0,0,0,0,0,0,
+0,24687,12080,6372,27005,32805,21267,45023,23312,0,0,44973,25796,35782,1409,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14029,
+13096,11077,44458,0,23456,0,0,30581,4671,36975,16475,17778,20136,22177,0,0,
+41316,0,24728,12481,17578,28035,9964,35678,44297,0,0,0,0,0,0,16234,
+4452,0,0,0,0,0,1978,27409,0,0,0,1774,0,15454,0,0,
+0,13430,0,0,0,0,0,20181,0,27965,0,0,0,0,27122,0,
+40051,10718,16597,0,35043,0,0,0,5444,5513,14518,0,0,2703,0,0,
+0,0,0,0,0,0,0,0,7513,0,0,0,44620,0,0,0,
+0,11253,0,44773,31915,20114,0,0,0,16289,0,0,23997,13499,36207,0,
+0,0,29082,0,0,0,0,0,0,18877,1029,0,0,6020,0,0,
+5229,9687,0,0,0,0,0,0,0,14460,0,0,0,0,2510,4602,
+27423,0,44266,5290,40936,0,0,0,0,30517,14844,0,0,0,36696,0,
+0,0,0,0,1823,0,0,0,0,0,0,15137,0,0,23735,26123,
+0,0,0,0,0,0,0,41078,35515,28617,44893,0,0,0,17221,15489,
+44352,0,0,0,0,0,0,20916,0,0,23009,0,0,0,0,2426,
+0,0,0,0,0,0,31964,0,0,17576,19094,48819,25309,0,0,0,
+15430,7079,0,35630,0,0,9978,13249,40888,22756,30639,0,0,40882,43971,0,
+0,0,0,36192,26561,0,0,48087,0,0,0,0,0,0,42452,0,
+0,4653,0,10406,35052,0,0,0,0,0,0,0,1883,44295,0,0,
+43103,0,0,34155,0,16867,21809,0,0,0,0,0,0,34859,25447,0,
+0,0,0,0,16405,0,34828,44926,0,0,20587,0,5450,42047,0,40267,
+0,4801,0,0,0,0,0,0,0,0,0,0,0,36739,20507,9770,
+0,0,27291,27586,33474,40952,0,0,0,0,0,21084,9033,0,0,0,
+29803,601,4729,35339,27671,0,3502,0,35434,36203,0,0,27152,21278,0,0,
+0,0,41350,0,0,0,0,37672,32527,0,0,19478,2128,0,0,0,
+0,0,6416,0,17493,0,0,32652,29219,0,0,7761,46865,0,0,0,
+29841,44000,0,0,7028,35623,42011,3022,3974,28438,0,0,0,0,0,0,
+0,0,0,28960,0,0,41048,0,0,0,47547,0,0,0,0,0,
+0,0,0,0,0,0,8135,130,16317,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,30701,39633,0,0,0,0,45314,
+40490,18953,0,10417,17924,30161,0,27568,0,31747,0,0,30812,0,0,0,
+9064,38788,17183,0,0,0,1263,2716,44657,0,0,39815,0,0,0,0,
+0,29453,0,0,0,0,0,0,0,16561,28140,40105,29727,31088,5677,29489,
+0,0,0,0,41185,0,0,0,0,0,0,44206,4215,9360,0,0,
+22711,0,23004,0,0,0,0,0,11906,0,25840,0,0,0,0,0,
+34680,27782,4889,21306,0,0,17006,9882,32912,34575,45587,48429,26854,22895,11029,43555,
+2786,4160,0,0,28286,0,0,0,0,766,43969,0,0,32713,0,0,
+0,0,0,0,13925,40532,42473,0,3091,0,0,24346,43847,0,0,6145,
+22441,34003,36044,0,0,0,0,23555,33861,0,0,34204,0,0,0,0,
+31796,0,19978,26822,0,0,5534,0,5273,0,20309,0,0,24650,22322,31403,
+0,44627,0,0,0,8655,0,0,3990,36760,0,0,0,0,33801,0,
+18842,32787,0,0,0,42555,4271,0,0,0,3077,0,0,0,0,0,
+26707,0,0,0,0,0,0,48843,22562,11162,21140,0,20254,31773,29962,22868,
+0,15312,29650,0,0,26974,0,0,0,43752,0,0,0,0,32813,0,
+1239,47227,22241,0,0,0,0,0,0,0,0,7535,30876,0,0,0,
+0,0,236,0,0,4374,0,0,21400,27749,0,0,0,0,0,0,
+30199,21944,37850,0,0,0,3114,0,0,0,0,1145,0,0,36690,0,
+0,41519,0,0,0,0,30049,4641,0,0,0,0,0,0,17379,9741,
+0,0,0,0,21882,0,0,0,26650,0,0,0,0,20953,36333,0,
+0,0,0,35155,0,0,20625,0,25631,0,0,45024,0,0,7524,33226,
+0,0,0,8934,32097,37514,42054,25611,0,44796,28736,17360,0,0,13675,0,
+0,0,0,0,0,0,43886,8109,0,25084,0,41523,0,0,0,0,
+14153,19083,37728,0,0,0,0,0,0,22255,0,0,0,10240,4811,2173,
+20969,29999,34858,36085,0,11748,0,0,0,7681,14611,38230,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,29172,31783,13872,0,0,
+4840,0,0,0,34443,45946,0,30459,14493,0,0,0,0,17583,0,0,
+46944,0,0,0,40445,0,0,0,0,0,0,0,0,0,23882,0,
+904,22829,31409,0,0,47129,2696,0,0,23331,0,0,0,38202,40112,0,
+37902,28800,0,37534,0,0,0,0,0,4639,45010,0,2855,0,33435,10807,
+12192,0,0,19144,0,0,0,0,0,0,38959,0,13409,0,0,0,
+0,44938,0,30416,0,0,0,0,4055,0,0,0,0,0,0,0,
+0,47765,0,0,42994,0,0,0,44051,0,0,0,4399,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2354,0,26527,0,
+0,0,0,0,0,0,0,0,1525,6583,0,18740,25028,43690,0,0,
+10735,0,0,13580,34982,32596,0,0,0,0,46651,30883,0,34315,0,0,
+0,23487,44564,0,5624,0,0,39981,6992,0,0,0,17325,0,0,0,
+0,23726,0,0,0,6222,0,0,0,0,48688,4348,20982,43464,18848,0,
+0,0,0,0,10977,0,0,0,0,36988,24807,497,0,1669,31705,34940,
+42014,0,4036,0,0,0,0,0,0,0,0,30244,0,0,0,10226,
+22873,0,0,9714,10940,4691,17680,0,0,6599,0,0,0,0,0,47794,
+34882,38507,17029,20342,27599,0,0,0,0,0,0,5362,6829,0,0,0,
+0,45927,0,41577,46933,11159,0,0,25994,2384,0,0,0,47625,8046,15575,
+44390,46436,0,0,10186,0,0,21124,35858,31952,40199,0,0,0,0,0,
+0,32519,0,0,0,20798,0,18365,31411,48400,0,0,0,0,24063,39588,
+0,0,0,0,4607,14048,0,0,0,25882,0,4135,34559,0,0,0,
+0,10273,26545,0,0,17808,0,3894,14420,0,0,0,0,22333,0,0,
+0,0,0,0,0,0,42716,0,0,0,0,3928,12249,0,41207,0,
+0,0,0,0,0,0,0,45034,19173,0,2241,13842,0,0,0,4170,
+0,24786,0,2270,0,0,0,22628,29341,13047,34413,0,12265,770,35773,41242,
+0,0,3045,0,6453,0,0,27776,0,27532,0,0,20564,6585,0,0,
+8502,36324,0,0,0,0,2410,0,46948,26390,0,0,0,0,26028,0,
+0,0,0,0,0,0,16943,4643,20020,31654,32313,39945,0,45254,0,0,
+0,39668,0,0,0,17957,24183,0,0,0,0,9460,15074,0,0,0,
+0,0,0,0,0,0,728,0,31917,12774,22830,0,3180,44748,40226,43933,
+0,27848,4627,0,0,0,0,24896,0,9262,42517,6427,0,20487,38457,39074,
+44572,4628,0,0,0,0,0,0,0,0,0,28944,30871,0,0,0,
+0,0,0,0,0,20246,33182,43774,0,0,0,0,12760,0,0,5996,
+10905,9244,0,27560,0,39627,0,20075,13124,0,0,0,44423,0,0,0,
+0,0,15291,20319,33161,0,0,33505,0,0,48467,0,0,40708,0,0,
+0,0,0,0,0,0,0,13120,20766,0,0,0,0,0,0,0,
+0,0,41432,11348,18808,30050,13061,38196,15202,9346,0,25158,12948,39385,15473,21260,
+0,0,0,0,0,13222,5731,30669,32708,0,0,0,0,29377,0,0,
+0,0,0,0,0,40803,0,0,0,0,0,0,15646,0,0,0,
+0,0,0,7220,0,12590,8523,0,24680,0,21500,26314,37384,5506,0,0,
+0,3748,28706,0,3888,0,31523,6452,43096,9816,28200,0,0,0,10526,29153,
+0,0,0,0,0,20334,0,0,0,48126,0,1643,0,16138,0,14850,
+0,11234,0,0,0,0,0,10177,0,0,0,0,0,0,0,0,
+0,0,0,31333,0,44405,0,29918,45182,8544,18503,0,36050,0,24662,0,
+21790,0,0,0,0,0,0,0,0,0,0,0,48367,0,0,0,
+0,10630,32651,42476,0,0,0,0,0,0,0,0,0,22,0,0,
+0,6920,0,46526,11127,17971,0,40744,0,13554,0,19508,0,0,22712,33827,
+44005,0,0,29719,0,0,0,0,0,0,0,43728,13351,24718,0,0,
+0,0,36818,12440,3447,40018,14300,45542,0,0,0,0,0,0,35967,2386,
+0,0,40423,47362,0,0,7098,27253,0,0,0,0,0,0,0,0,
+39234,0,0,14489,46856,0,0,0,0,9531,44832,0,0,30740,0,0,
+0,0,0,0,0,11254,0,0,0,0,0,12475,37141,40235,0,538,
+0,0,2225,35597,0,0,12213,35079,0,0,0,0,16657,42037,0,0,
+0,0,30203,0,0,0,0,0,0,0,0,45392,0,0,0,0,
+0,20579,18378,22191,15643,0,46976,26745,0,18745,20627,41834,31263,39206,9400,0,
+0,0,33242,0,0,0,0,33974,0,0,0,0,0,0,0,0,
+0,0,5167,0,38199,0,0,0,15387,28774,0,0,0,0,25602,0,
+0,0,0,0,0,0,7295,27267,47981,0,10736,0,0,46360,0,0,
+0,0,0,0,0,5034,0,0,0,0,0,29614,0,11177,0,0,
+0,0,27929,0,34653,238,29624,46902,0,0,0,0,0,0,0,0,
+18290,0,0,28225,0,0,0,34640,0,0,0,0,15136,0,29046,39088,
+0,0,0,0,4872,24723,26300,0,1295,2519,0,18437,0,38227,13436,0,
+0,28121,36708,0,0,0,0,0,0,6186,0,0,599,23697,0,0,
+43094,0,0,0,48572,43110,0,10398,0,0,0,0,0,6439,0,15511,
+36241,31330,0,0,0,0,27534,0,0,0,47154,0,0,0,0,0,
+0,0,0,0,47230,0,0,0,0,0,0,43454,42668,0,4697,0,
+0,0,0,0,1229,0,0,0,138,0,0,0,0,0,613,24144,
+39786,0,0,21212,18727,35538,585,0,0,0,0,0,0,13195,18819,41641,
+0,5345,0,0,0,0,0,7366,0,0,12469,0,0,181,47,14482,
+10524,8159,0,0,0,0,0,46374,0,0,1612,0,28313,16421,30842,36808,
+0,0,31225,0,0,12621,0,0,0,34683,0,0,0,0,0,45415,
+0,0,27272,34481,0,0,0,5829,15422,0,0,0,6814,0,45337,171,
+0,0,0,3293,34714,0,0,0,0,44750,0,0,0,0,0,0,
+0,16793,0,3506,0,0,22802,5554,20293,24829,32383,35505,0,37136,0,0,
+0,0,0,19665,0,30548,0,0,0,4535,17028,11169,3075,23772,0,2215,
+11280,36721,28312,0,0,2411,513,17256,0,0,0,39731,33954,0,0,0,
+0,0,0,21013,0,0,27474,0,0,10747,0,0,0,18630,0,13473,
+23210,0,5164,0,0,0,0,0,0,1153,0,0,0,26726,45731,48056,
+0,32739,47152,0,0,0,0,0,19437,0,43581,0,0,0,0,0,
+0,0,508,2064,7902,0,33742,30958,0,0,27574,22419,0,29485,11883,0,
+29009,27840,0,0,0,0,22016,0,44830,0,0,0,15951,10138,19454,45274,
+41526,29333,48161,0,0,0,0,0,31432,29681,0,0,46736,15292,9901,0,
+2303,0,0,0,0,4880,0,0,34611,0,9226,0,26315,43088,43873,0,
+0,0,0,0,0,0,0,0,26382,0,0,0,27343,0,0,0,
+0,14663,20900,0,0,8213,0,0,0,0,8198,15090,17288,43908,0,0,
+39021,0,0,26583,38440,0,15215,0,0,0,0,1553,0,0,0,0,
+0,19243,26355,0,0,0,0,0,26647,47826,0,26227,43792,21483,6044,33966,
+44513,0,36801,39237,0,0,0,46821,0,22276,38095,40061,0,14057,0,33817,
+7137,29256,0,0,1190,13782,0,8599,9397,0,0,29809,34745,23852,45778,0,
+0,14151,22588,10517,32840,39177,42730,0,0,19856,0,17206,0,37894,0,26780,
+27853,0,0,0,0,0,44439,0,0,14914,28996,29857,7395,15680,20427,21905,
+34580,0,48259,0,0,0,0,33507,0,0,0,0,0,0,0,0,
+0,0,0,0,23351,36880,0,0,0,30029,0,10305,0,0,24320,0,
+0,0,30758,9009,0,22017,12020,0,0,0,0,0,23744,0,0,31963,
+0,0,0,0,0,0,0,0,33737,0,42077,28897,12809,34530,8527,0,
+0,0,0,30014,32913,47402,0,0,0,0,25023,0,0,0,21538,33908,
+19432,41588,0,0,20498,0,0,0,0,0,0,0,0,0,10980,0,
+0,36934,0,0,0,0,0,0,0,24719,0,46553,0,40596,0,0,
+0,28682,7527,26945,0,0,0,0,0,10338,16397,0,0,0,0,0,
+8022,39155,2618,0,0,24568,0,13492,0,5800,24586,0,0,0,45998,23933,
+0,11038,0,0,11282,0,0,0,0,48248,0,39089,22519,0,16380,28643,
+34226,34840,42610,46495,0,0,0,0,31516,0,0,0,500,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,28331,0,42382,0,
+0,0,0,0,0,29645,33401,0,36266,0,38706,0,3664,5632,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,29549,28986,46864,0,
+0,0,0,0,0,0,0,0,6579,34707,35441,14897,40175,48392,0,0,
+0,29274,0,42998,3750,9976,27894,0,0,0,0,35588,0,0,0,16803,
+33164,7935,0,0,0,0,0,0,30926,32572,0,0,0,0,0,0,
+0,0,0,6432,13064,13356,0,0,0,0,0,0,0,16599,0,1462,
+0,0,0,0,16262,0,5230,0,32786,15282,0,0,0,41558,0,39066,
+27989,0,0,0,0,0,48692,46641,8033,0,0,27308,0,0,25780,0,
+0,47117,0,0,0,23074,0,44237,0,0,0,31610,0,0,48826,0,
+0,32751,13900,0,0,0,0,44786,0,33947,0,0,0,17463,19663,11408,
+23209,0,25784,37938,38332,8310,10218,34912,0,32636,0,0,0,36062,0,0,
+0,0,0,0,35311,0,0,0,28871,0,65,0,0,0,34545,0,
+0,0,0,32032,40086,0,9546,0,0,36078,45676,0,0,28616,0,31287,
+34449,0,0,0,35076,39823,0,0,0,0,0,0,0,28498,16622,0,
+16174,42789,0,0,0,0,0,0,0,32554,0,0,0,630,0,13476,
+3524,16287,28336,0,18044,39381,9783,0,31019,0,0,0,41216,33783,0,0,
+0,0,0,0,0,42548,0,0,0,709,0,0,9987,0,0,0,
+6666,22513,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,19468,10099,10539,5105,0,0,0,745,28270,43079,44484,12810,44818,16331,
+47810,0,0,0,0,0,976,21225,0,3056,9047,46778,0,0,9087,41013,
+0,35965,0,0,0,4954,10631,27500,30602,37306,46952,0,0,0,0,0,
+0,0,0,42866,0,0,23017,40819,45293,0,0,0,0,0,29403,10857,
+29031,0,32688,31426,0,0,3677,10313,0,4966,0,0,0,0,21518,0,
+0,41618,0,48488,0,0,0,0,12777,22973,26086,0,0,0,0,19492,
+0,0,0,0,0,1747,35240,0,0,0,0,4707,44224,14395,45346,28916,
+43879,29327,0,0,9757,0,0,0,0,28419,31291,23222,0,4706,27895,34978,
+47944,0,10322,7843,12284,26928,0,0,0,0,0,28542,0,0,3604,0,
+0,44956,0,41673,0,44362,0,30753,37109,37506,0,0,0,13514,0,0,
+0,0,0,0,46999,0,0,0,0,47885,0,0,20535,34073,2101,0,
+0,0,0,0,27975,25488,0,0,0,0,0,0,29081,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,26183,45664,0,4666,
+41727,0,0,0,0,0,1312,18969,0,0,0,0,0,25552,0,0,
+0,3590,0,19863,45834,37978,0,37121,38208,29033,21712,28998,0,0,0,0,
+0,16223,46102,19138,0,0,0,0,0,0,19273,0,15299,0,0,11872,
+0,0,0,0,27183,21855,0,0,41180,0,43275,18030,0,0,0,24864,
+0,8308,19869,0,0,0,0,0,0,5387,0,0,0,16017,17818,38213,
+42569,0,0,4505,48067,0,0,0,0,23745,0,1123,30490,0,0,0,
+0,0,0,0,46143,46619,0,0,43604,0,35125,0,0,3263,14345,0,
+45936,0,19777,0,0,42961,0,3962,26660,42020,26893,0,0,0,0,23702,
+0,15172,11805,38664,956,1375,9485,40415,44168,21374,0,0,0,0,0,8491,
+0,0,0,0,0,0,14449,25881,17735,0,30193,0,0,0,0,0,
+0,0,0,3503,0,0,0,0,11876,34211,0,0,0,0,24116,0,
+45891,0,0,0,0,0,0,0,0,0,0,0,0,39339,0,1779,
+46532,9367,6565,25657,45528,8355,18492,0,0,0,0,30402,0,0,0,44293,
+2582,0,12236,12911,31550,33341,37029,24134,0,1344,0,32545,0,43801,0,32274,
+0,0,0,0,0,0,0,0,6963,4438,32564,0,0,0,0,0,
+0,0,0,39928,25432,0,8755,0,0,0,0,0,0,16439,0,0,
+0,46263,0,0,0,0,0,22037,0,0,0,46076,0,0,0,0,
+0,0,0,26266,7633,37927,3615,0,0,1730,14814,0,42573,0,8163,0,
+0,31261,13247,0,5462,40162,0,0,43078,0,0,5661,0,38649,23720,31636,
+40669,48059,0,0,0,0,0,7018,25741,27416,0,15399,7157,27156,45700,0,
+0,29098,0,0,0,0,18071,33843,7416,0,18815,8556,14805,41264,23725,0,
+36354,0,0,0,0,0,0,0,0,0,0,47920,0,0,0,0,
+0,0,0,0,0,7190,41550,12258,20131,27741,0,8343,595,0,36041,0,
+0,0,0,0,26719,0,2979,0,17951,0,0,20843,0,0,0,5424,
+0,24403,40620,45994,0,27796,0,0,0,0,0,0,0,0,34485,5897,
+0,39199,0,0,0,0,0,0,21588,0,0,0,0,0,0,0,
+0,0,19577,5588,0,0,0,7835,0,0,0,0,0,0,0,0,
+0,27404,2588,0,34318,16761,0,0,0,35457,0,0,0,12677,23593,33810,
+16706,0,0,0,0,14936,20222,32537,0,0,0,2949,0,0,0,0,
+0,0,0,0,0,11953,0,0,0,790,0,0,0,46598,30320,0,
+18627,0,0,0,0,20109,0,34131,0,0,37913,0,0,5180,15504,1150,
+17598,18926,0,0,35362,0,0,5140,0,11340,0,0,0,33091,3553,0,
+15905,0,0,0,0,0,0,0,0,0,0,0,1052,10053,33723,0,
+8954,0,0,0,33497,45586,7613,10335,39779,19771,0,0,0,0,36677,0,
+0,0,0,0,11097,0,0,0,0,0,48740,37325,0,0,0,30042,
+36312,14287,0,19488,25474,0,0,0,0,0,25846,0,11231,41652,0,0,
+0,0,29300,42747,36387,21057,0,0,0,449,0,17259,0,0,0,32000,
+0,0,0,33501,0,0,45215,6094,0,0,0,15343,0,13242,46934,0,
+0,0,0,44989,0,0,30363,0,15588,0,0,0,13786,0,31637,18036,
+19091,0,0,0,25086,8409,0,0,0,43906,25526,0,0,17542,0,0,
+0,0,36139,0,0,21285,38970,0,0,0,0,8661,9497,0,9532,45246,
+0,42568,30854,0,0,0,0,16715,4384,25169,0,36122,0,0,45041,0,
+11488,0,0,36740,0,0,0,0,0,0,0,45261,2451,30279,0,0,
+0,0,39062,0,21275,41503,2150,0,0,0,43046,0,0,22603,41916,0,
+0,930,0,0,0,0,44167,0,0,13307,0,0,0,41743,0,0,
+26950,0,0,0,1387,9970,19358,0,25366,13898,0,7431,0,0,23803,10551,
+0,0,23026,26058,0,0,0,0,29223,0,40940,2528,0,0,10629,0,
+48468,0,0,12263,44006,45849,0,0,0,43534,46816,0,0,0,0,0,
+0,0,23047,0,0,0,0,10990,0,0,0,31588,0,0,0,0,
+43547,39132,17590,0,2978,0,0,1704,0,32363,32894,0,0,0,0,0,
+0,0,0,4980,0,0,7058,0,43075,0,0,33379,21196,11163,14970,27791,
+34188,21312,0,0,12956,26472,9801,36349,0,0,0,0,0,0,0,16790,
+23619,28402,47055,0,0,0,40202,36162,0,37544,0,0,0,46890,4573,0,
+0,39551,0,15465,35813,0,0,0,0,0,10712,34017,0,0,0,29479,
+0,0,0,48700,0,0,0,12,18343,30767,14590,0,47024,0,0,29402,
+31711,0,0,28964,0,0,0,0,0,0,0,44429,0,0,48167,0,
+47338,0,0,0,0,0,4913,47030,5699,38421,0,46784,0,0,0,34367,
+22722,2037,21068,46050,0,26543,0,42239,0,4903,13941,0,36265,0,0,0,
+12921,19249,20552,0,19831,17710,41858,2509,0,17733,0,0,0,47016,7493,18248,
+0,0,0,0,2595,0,0,15671,0,0,0,0,0,12065,2122,0,
+0,0,0,0,42820,0,34584,0,0,0,0,1810,6696,9313,17767,20727,
+28613,0,0,22458,9481,25730,14585,40407,5943,44511,46395,17048,0,32082,2391,16665,
+0,5179,0,0,0,0,0,0,0,0,0,0,36689,0,0,0,
+0,0,0,0,26016,12598,10795,26998,0,0,0,0,0,0,0,22629,
+41779,0,41949,27634,30077,0,0,0,23480,0,0,0,0,0,0,3274,
+0,27439,28107,1683,0,16447,40770,28721,0,10415,0,0,10170,29144,48224,3076,
+0,15545,44911,0,0,0,0,0,17723,28058,0,335,41628,0,0,0,
+0,0,0,3214,30224,41826,0,0,0,12342,35900,0,0,21710,0,0,
+0,22461,0,11536,0,38475,12859,34573,0,0,12812,0,0,0,0,29642,
+0,29277,0,3667,40503,0,0,38675,45259,0,0,8390,0,0,0,0,
+0,0,0,0,0,0,0,13781,0,22431,14164,18216,0,0,0,0,
+0,0,0,0,0,16611,0,0,27487,0,0,0,0,0,4525,16468,
+27333,40962,46679,43745,0,0,0,17012,36253,28043,37504,0,0,0,0,0,
+0,0,0,0,3429,15851,0,0,0,0,48669,0,0,0,3569,0,
+0,0,0,27118,0,44290,42466,0,0,0,0,0,0,20027,0,0,
+0,13648,0,0,23424,0,25195,15409,0,15648,33555,34423,31036,0,144,0,
+0,0,25848,0,0,0,40137,15356,0,0,22456,32015,0,0,26453,0,
+0,15683,0,0,0,0,0,35995,10794,17607,40791,0,7653,45329,0,0,
+0,0,0,175,11500,21340,39892,0,0,0,0,2235,0,0,0,28926,
+0,2056,26947,0,26562,37837,0,39397,4312,37244,10341,42227,0,0,0,0,
+30125,0,38313,0,0,46490,0,0,0,17863,1586,48338,34476,13920,30525,0,
+0,1536,0,0,0,0,0,0,0,0,0,0,37435,41688,34284,24988,
+24062,0,38472,24745,0,0,0,0,0,12008,0,8849,0,0,0,0,
+0,0,0,0,38615,1619,39051,13640,0,0,31491,9868,0,0,0,40544,
+18834,0,0,0,0,24102,28530,10424,24619,7897,16699,38162,15209,7515,25410,0,
+0,0,20919,19764,0,11725,0,0,0,0,2316,0,0,0,22275,878,
+28079,32957,0,0,0,0,0,0,43946,0,0,47375,0,18002,0,0,
+0,0,0,0,32756,13899,47780,0,0,0,0,6629,40647,0,0,36084,
+0,44579,0,0,0,0,2467,23679,15585,1230,28980,20986,46827,17476,4103,20783,
+48209,4454,0,0,0,0,25738,0,0,40768,0,7300,0,35007,21221,8079,
+0,0,0,0,0,0,3719,46460,0,0,0,0,0,0,0,0,
+0,0,20580,20236,32543,0,0,0,0,28083,0,15568,0,0,0,0,
+0,0,6225,0,0,10686,0,0,0,39379,0,0,0,0,0,0,
+15661,0,29348,0,0,0,16053,0,12421,0,0,23819,0,0,30855,0,
+39462,36907,0,0,32360,41231,0,0,0,0,10563,46899,6706,18415,44680,42273,
+0,0,44148,0,0,13354,38222,0,0,0,0,0,48527,30549,0,0,
+0,0,0,0,0,0,0,0,19939,31446,0,0,0,47421,16502,0,
+0,0,1405,12815,13677,29940,25313,44079,44175,48873,0,0,0,0,0,0,
+0,42199,46358,47947,0,0,6607,7985,26119,13280,892,0,0,22716,0,19658,
+0,0,0,0,0,9952,36895,0,0,0,0,8149,0,19188,18860,0,
+15475,0,0,0,45117,23787,16099,30219,0,14974,33268,0,0,0,0,0,
+0,0,0,32833,35101,39566,24059,0,0,0,20411,0,0,0,1289,0,
+0,0,0,0,1173,0,0,23378,18568,0,0,0,27819,0,0,0,
+0,30656,0,11317,0,0,0,0,0,0,0,10844,0,47258,0,0,
+0,40804,38309,0,0,0,45609,0,0,0,0,0,0,0,0,14271,
+0,0,0,0,41115,26626,17595,33231,0,18179,41702,8006,0,0,5509,30051,
+0,0,0,0,0,0,0,0,28315,0,0,48852,38692,0,13031,0,
+0,3686,0,0,30310,37981,35419,0,0,0,0,6087,0,0,42481,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,22351,0,7650,
+0,15774,26402,0,0,0,0,1645,13283,0,0,0,0,16651,36965,24890,
+35585,39217,0,41675,0,0,0,35681,0,0,0,0,0,0,0,16370,
+0,0,27665,0,4093,0,0,0,0,37442,0,40324,42666,0,0,0,
+0,0,0,0,2382,1096,0,0,0,0,8010,0,41470,0,12593,25270,
+23827,0,0,0,21578,0,0,16656,23678,23257,23916,0,40645,39466,7038,0,
+17683,0,0,0,0,31005,17351,0,0,0,0,0,0,0,22953,16581,
+8779,19307,30486,0,0,20626,18519,0,0,14661,11450,0,0,47959,0,0,
+40872,0,0,0,0,0,0,0,0,0,11687,0,36617,30575,0,0,
+0,0,13850,0,0,7591,45135,27038,44581,0,0,0,0,0,0,1110,
+25682,20495,10988,22570,33344,0,0,12735,0,0,0,0,33560,0,9477,36648,
+0,21195,0,0,0,0,0,0,0,0,0,0,0,11956,20113,22354,
+30070,31264,0,0,22574,34175,1483,31700,37412,5697,33633,38778,42260,42907,47570,0,
+12252,0,0,47250,12407,48025,0,3372,0,0,0,0,0,0,43130,30096,
+0,0,0,0,0,16100,0,0,0,10110,33142,0,0,0,21358,0,
+3363,0,0,0,29443,21198,0,9953,0,16751,11421,0,0,15149,36983,27376,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11602,
+0,0,0,0,0,0,4423,0,0,0,0,0,430,24504,0,33672,
+35103,40443,0,18966,9922,36326,37334,0,36205,16717,0,0,0,0,0,0,
+0,0,0,0,44464,0,0,23651,0,0,0,0,0,0,0,32302,
+22217,30732,0,0,0,1782,0,0,0,0,0,0,13802,0,0,35286,
+0,34028,0,0,4498,12218,25350,45983,22226,2621,35677,0,0,0,0,0,
+0,0,0,28426,0,0,0,0,2322,16890,0,31410,0,0,0,16402,
+12636,22770,31180,40591,0,0,0,0,0,0,0,0,16521,0,0,42156,
+19518,35066,46798,0,0,13338,0,2973,0,0,0,42498,26221,0,0,6135,
+0,13822,44882,0,0,27319,0,0,0,35018,0,0,0,0,30915,0,
+40335,0,0,0,0,0,0,17586,0,0,23389,32892,10773,24589,41142,0,
+0,0,45021,27336,12559,31011,46580,0,5866,0,0,21763,0,48598,22486,33378,
+38695,0,25521,0,0,1464,28471,0,0,0,25832,1845,0,15834,6498,9017,
+0,8874,0,0,0,39635,0,0,0,0,0,0,0,0,22181,0,
+0,0,0,0,29087,25513,0,0,0,0,0,35892,9225,0,14813,33650,
+0,1377,11453,0,0,667,0,0,0,0,0,0,0,17702,20389,0,
+30747,0,48627,0,0,0,0,27719,12274,0,0,0,0,0,0,34371,
+0,8734,23021,29513,47960,6935,0,17097,0,0,0,20202,0,0,32880,0,
+42854,0,0,0,0,0,0,569,0,0,0,0,25259,32194,0,0,
+0,6252,0,0,0,10668,0,0,0,0,0,0,46693,0,0,0,
+35626,0,0,43105,0,37686,0,0,0,29220,37890,0,0,0,0,0,
+39031,30838,0,0,0,26533,0,0,0,0,0,0,40398,0,0,0,
+14007,39872,46486,0,0,0,0,30388,0,46655,13794,15201,16725,0,0,0,
+36281,0,0,0,0,0,0,0,28460,0,37866,41380,22563,0,0,0,
+37691,0,0,0,12120,0,0,0,0,6151,0,16767,0,7131,12879,0,
+0,19452,0,0,0,46826,18443,0,0,11947,43,0,0,0,38098,0,
+0,7501,38914,7424,0,0,15858,0,0,0,0,0,0,39015,44033,0,
+0,0,0,0,17294,0,4458,0,0,16843,25373,0,5152,0,0,0,
+12416,0,3889,32881,48255,0,11793,0,0,0,0,0,18545,0,0,0,
+0,0,0,0,0,0,42024,0,39079,0,0,47720,6267,6903,0,0,
+0,0,0,0,0,0,11485,0,0,0,0,604,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,29044,46859,0,
+17998,0,46128,0,0,26985,47993,0,5776,27587,0,0,0,0,0,12290,
+26753,39393,0,0,5300,19039,19366,35449,40160,0,26445,0,32090,7603,0,32645,
+8297,0,29197,0,0,0,21734,25113,18373,0,0,17835,0,0,40733,0,
+0,0,21574,39774,30834,0,17331,23122,0,9930,0,24885,0,0,40238,5065,
+0,0,20604,0,0,0,0,0,15021,0,0,0,0,0,34419,0,
+0,0,0,0,6741,18711,37211,0,26911,0,0,23226,0,36480,0,0,
+0,0,0,0,0,0,0,25935,32845,20107,33440,0,0,22222,34124,0,
+42246,0,12703,38448,0,0,0,0,0,0,0,0,1727,0,0,0,
+16218,0,0,0,0,0,0,0,0,0,0,0,7718,16999,13855,47904,
+409,0,0,0,0,17912,17713,23516,24159,26107,28483,571,24212,35958,0,2690,
+41332,0,46564,12947,0,0,16211,0,0,0,0,0,0,0,33758,0,
+0,44686,0,0,18500,14289,17271,0,0,20619,0,0,0,15471,27399,0,
+0,0,8982,0,0,0,0,43185,0,0,0,23426,0,11964,48761,34664,
+11527,33849,0,0,7699,0,0,0,0,0,0,0,0,0,39656,0,
+0,11533,0,48168,25386,0,0,0,0,18836,0,0,998,8133,0,0,
+0,36134,0,0,0,0,0,0,0,0,42502,0,0,0,11048,22997,
+28685,38264,0,21595,0,0,0,0,34841,0,18224,0,42058,0,1248,3672,
+7105,209,13367,29406,28995,31496,35943,0,18435,0,0,14121,0,34690,0,0,
+0,6332,3535,19115,26572,0,33484,45919,0,14263,15724,24225,31927,0,0,0,
+0,0,36862,40010,0,1860,44121,0,30984,0,0,0,27022,0,21741,0,
+102,5704,0,0,0,0,3695,23950,26486,0,25509,25995,32296,0,0,0,
+18737,24876,41341,0,0,21370,0,0,46401,0,0,35357,33680,42766,0,0,
+855,9695,0,0,0,0,0,0,0,0,0,0,0,12376,0,0,
+31532,0,0,10088,10670,43140,47264,0,0,0,0,0,0,0,18800,8707,
+47452,0,0,0,30232,14437,28065,32079,43634,0,0,0,0,0,0,0,
+37439,0,35751,7922,36654,0,0,16149,0,0,0,6045,7813,48317,0,0,
+0,0,9292,15034,0,44991,43956,0,47968,9904,47617,0,0,0,0,29048,
+0,33117,46897,5219,26370,0,0,13115,0,36319,0,37987,0,0,2359,0,
+0,0,1562,0,30251,0,0,12830,352,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,24016,0,27070,0,0,7821,0,0,
+0,43609,27637,0,35601,9037,30500,0,43826,0,0,48298,0,0,0,0,
+0,0,0,0,47257,0,0,0,0,0,0,0,0,0,45569,20141,
+20808,0,0,0,35175,0,0,22370,0,0,36968,0,0,0,0,3067,
+4624,17725,20476,3498,28333,40146,47786,10902,325,11384,13843,0,0,18163,1825,0,
+43385,4959,0,29555,30117,0,0,0,0,24558,32037,0,0,0,0,22293,
+0,0,0,0,0,0,0,0,0,31962,0,30396,0,0,31151,0,
+0,72,37405,42579,0,12784,0,0,19923,0,0,8388,13937,46550,0,0,
+0,0,25508,19996,0,32200,0,4255,0,7435,36030,44399,0,0,0,0,
+36822,0,0,0,0,0,0,0,0,0,0,25889,10838,46539,0,35719,
+0,20566,36955,9848,35323,0,0,0,0,0,0,0,0,20063,37843,0,
+0,40208,0,0,0,0,17403,0,42464,14709,0,0,0,0,0,0,
+0,0,45,31437,0,41711,0,0,0,16394,38377,0,0,0,0,0,
+0,5446,0,0,0,33916,0,0,0,37829,0,0,0,0,0,5531,
+0,0,0,0,0,3317,22851,0,0,0,0,0,0,0,0,12847,
+0,31738,0,0,0,0,0,3407,38312,39246,16844,0,0,0,0,0,
+16268,19984,25990,35625,0,0,0,0,25036,0,41347,48784,8007,0,0,0,
+17473,0,0,9982,23131,0,586,21280,24682,0,0,0,0,0,0,1232,
+24171,0,0,0,0,0,25082,0,27165,0,0,0,15200,0,0,18986,
+0,0,0,0,0,6993,0,0,35130,0,0,0,20439,36945,37809,0,
+0,0,0,3005,26154,0,0,0,13506,9640,0,0,0,0,0,0,
+0,0,0,0,39496,0,0,0,0,20821,7959,19632,0,47833,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+45020,0,308,0,0,5524,0,0,723,0,0,0,0,0,0,0,
+20771,0,0,19232,33004,0,0,0,0,0,0,0,0,47198,0,0,
+0,0,0,0,17491,0,0,0,0,0,0,38010,0,0,0,8312,
+37128,34634,40072,0,30209,46566,0,0,0,0,0,0,26010,0,30636,0,
+0,0,42824,0,0,0,0,16072,30631,31804,5557,28487,34097,0,0,0,
+21223,41303,0,0,2617,0,43485,0,0,45970,0,0,0,31378,35541,46211,
+25264,36869,29548,0,0,0,16753,973,2661,0,7517,0,0,0,0,0,
+0,47550,0,0,0,25393,0,10720,15012,24126,19787,0,0,0,16562,33986,
+0,0,0,0,18994,0,0,0,0,27139,40778,0,0,0,0,2504,
+48675,0,18710,24302,0,0,2089,0,0,0,0,46892,48814,2141,2970,0,
+0,11240,0,44966,6678,0,0,11090,0,35186,0,19108,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,47642,0,0,0,0,
+0,0,0,13414,25090,0,0,0,0,0,0,0,14556,38841,0,0,
+0,0,0,47814,0,0,0,0,0,0,0,0,36132,8488,0,0,
+9188,28780,24203,0,0,0,0,0,0,0,0,0,0,18668,0,26109,
+30327,0,0,0,0,0,37715,0,4890,0,0,0,0,0,0,0,
+15254,28163,0,11371,29294,35649,0,10270,20971,0,0,5115,6013,0,0,0,
+0,35458,0,0,31107,0,3874,10243,26448,0,0,0,1160,11534,41764,0,
+40849,0,0,25566,22945,7175,35516,42039,22041,7217,43554,0,0,0,32923,0,
+19621,0,0,0,0,1365,1964,30446,0,0,33509,0,0,0,0,0,
+0,7649,0,0,13563,7375,26290,0,0,0,0,22911,20168,0,0,0,
+0,41441,0,0,0,0,0,0,0,0,0,39068,0,0,0,0,
+0,0,25752,33366,0,0,0,22157,0,0,0,28135,0,11202,0,0,
+13685,44904,3268,0,0,0,0,2925,26836,34593,0,19217,22421,0,19368,0,
+34625,5323,0,0,39735,0,42912,18868,0,32221,24959,45859,15414,28330,43435,0,
+0,6509,37893,18484,20392,0,0,38878,14581,16923,0,0,0,13634,0,14207,
+0,28067,0,0,44875,0,0,42491,16163,24763,0,0,0,0,0,0,
+0,21090,8567,24326,26264,37511,22163,19750,32682,17484,39277,43970,44611,0,0,0,
+0,17988,0,0,0,0,0,0,0,0,5021,40254,0,3346,10850,48366,
+0,41334,46601,0,0,0,0,0,0,41557,4060,0,9025,11869,0,0,
+26406,23186,36040,0,0,0,0,0,0,0,0,40529,0,32888,19030,0,
+0,45677,0,0,35482,41991,0,44918,17972,461,41043,45156,25517,32351,0,17141,
+0,37026,0,0,31100,0,18859,0,1592,0,1403,27413,19737,11664,8950,44432,
+24877,46871,48048,0,20933,0,23109,1314,6695,13336,0,0,0,0,0,0,
+0,0,0,0,39338,0,0,0,0,0,0,0,0,5774,0,0,
+0,11591,0,0,39032,29721,0,0,0,0,0,0,8368,0,0,28294,
+39227,0,0,0,0,19703,0,0,0,0,0,0,0,0,0,0,
+0,0,40416,44855,0,0,2177,10028,37335,0,41808,0,0,0,0,0,
+0,0,7993,33924,43066,40681,0,0,0,0,31467,0,29638,45931,0,21933,
+43881,0,1828,10197,20966,0,17558,1379,18997,40471,0,7624,0,42621,0,17573,
+18230,30585,32916,0,3097,711,29426,26177,0,34578,0,0,4245,0,0,29563,
+27496,0,0,0,0,0,0,36117,21485,33114,38869,41529,0,0,276,0,
+11307,0,8618,0,0,0,0,0,0,12811,31227,0,0,26374,0,0,
+0,38582,40354,6557,43414,43492,0,0,43040,0,0,0,284,25116,0,0,
+37527,0,0,0,24826,0,0,0,9299,0,0,0,12652,0,1837,2702,
+41020,23905,47566,0,0,39272,0,42872,0,0,0,19999,41354,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19681,
+0,0,0,0,0,0,0,0,11117,0,37099,43125,0,11267,25422,32882,
+0,0,0,0,0,0,0,0,0,0,12798,0,0,4187,0,0,
+0,48585,0,25278,0,0,7127,0,46335,18306,19516,0,0,43370,0,0,
+8358,15249,0,20223,301,23388,43436,0,11662,22744,0,0,0,37262,0,29405,
+0,0,31597,35102,0,0,0,32578,0,0,0,0,0,0,2619,8783,
+0,0,0,0,0,0,0,12344,0,7033,3310,14066,26170,31135,2465,44342,
+17340,40307,9996,46771,0,0,0,14841,0,48122,0,0,22727,14054,32831,0,
+0,0,0,0,0,0,0,1191,43510,0,31480,0,0,1516,32217,2294,
+39883,0,30214,0,0,0,0,39937,0,0,0,39094,39855,0,19690,45818,
+37740,0,39768,42615,47739,0,0,0,29658,0,0,0,18723,0,0,5242,
+46016,0,0,34329,0,0,0,5820,19824,41419,41534,0,31717,0,0,6064,
+0,0,0,0,0,0,0,0,16258,0,0,0,0,0,838,0,
+0,0,0,0,0,0,0,0,5740,0,0,0,16628,0,0,0,
+0,18411,41946,0,0,0,0,9642,32109,26610,17200,42330,46214,0,0,0,
+47399,0,0,12101,0,28382,23479,0,0,0,0,0,48258,0,0,0,
+0,0,0,36437,42329,0,36771,0,24765,392,47101,6003,6701,0,5433,12861,
+48002,0,0,0,0,0,0,0,8509,16856,2100,15776,19379,41387,7526,0,
+0,0,11507,0,5581,0,0,0,9246,0,0,18932,1128,0,0,0,
+0,0,2822,42423,35648,0,12233,0,0,0,0,0,0,0,0,0,
+0,47122,0,0,0,17783,28755,0,0,0,0,12899,0,0,0,44695,
+0,0,0,32238,0,0,0,35193,4841,11344,14614,41294,0,0,38663,32602,
+16056,40084,42282,46471,38819,0,9303,32824,12901,0,0,32718,0,0,0,0,
+0,15311,0,0,0,17489,0,0,0,0,41838,35636,0,26454,20861,0,
+0,0,0,0,42989,0,0,0,0,0,11969,0,0,0,0,14184,
+0,0,0,0,34452,0,21662,0,37158,0,0,12219,0,5569,0,0,
+0,15490,8186,6548,0,0,30576,0,0,11445,0,0,0,0,26349,0,
+0,0,0,5068,14730,33025,36982,39606,0,0,0,28940,0,0,0,0,
+0,3123,0,22825,0,0,0,21146,12357,0,15425,37802,0,9370,17764,0,
+0,0,18876,47159,0,0,0,2253,0,0,0,0,0,0,30421,0,
+0,21326,47011,16772,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,16835,0,0,47943,0,27353,0,28875,9942,0,0,0,
+0,0,0,0,21553,0,44852,31281,22592,47546,35942,37465,0,0,0,21746,
+43065,0,0,0,24597,0,0,0,29416,14277,0,0,0,0,39173,0,
+0,0,0,0,0,0,14849,24626,17918,0,0,0,0,0,0,43544,
+0,0,36071,4766,31252,10571,0,30731,0,0,39276,0,42902,0,0,17335,
+23432,29441,0,35980,0,0,2332,39828,0,38463,0,0,0,0,13585,0,
+0,23072,4139,23166,0,0,0,0,0,623,29335,26946,8723,27288,0,0,
+20396,0,0,0,0,681,33548,0,45912,1429,0,0,0,25430,0,0,
+0,13328,48586,27596,12082,0,0,0,0,3555,14169,20606,0,0,0,0,
+0,0,0,0,0,0,0,0,45299,3716,28949,0,0,0,0,8854,
+2826,7312,0,0,14077,1687,29700,0,16246,0,0,0,0,0,0,0,
+0,0,725,0,2697,48198,0,0,0,0,0,18001,0,0,0,2657,
+41576,0,0,0,0,0,22355,22765,0,42664,0,0,0,19684,45715,0,
+0,0,0,0,0,0,0,0,25662,0,0,0,0,0,13657,43251,
+0,0,37009,579,21399,20416,26847,0,735,0,0,12968,0,0,0,39745,
+40339,0,3996,4465,13703,25810,2370,0,35006,0,0,9748,18947,0,0,0,
+0,0,0,0,0,0,0,30893,36220,0,29304,0,39383,0,0,0,
+0,0,0,0,0,0,5077,0,0,29610,0,5628,0,0,0,0,
+0,0,31266,45738,0,0,13248,0,39077,22880,0,0,37157,0,11695,0,
+0,0,0,0,0,0,0,0,0,0,28098,0,0,3185,0,0,
+0,45036,0,0,0,6243,0,0,7640,0,0,0,0,0,0,0,
+0,48589,0,19059,37017,0,0,27480,34372,43825,45286,0,0,0,48019,0,
+0,8951,1900,0,0,4532,31045,44630,0,0,0,13041,0,0,0,0,
+0,0,22622,0,0,4926,0,0,0,28874,38575,0,0,4824,0,0,
+0,0,0,0,17272,0,21876,32044,0,25613,39352,0,0,2094,5603,38832,
+0,0,0,0,0,0,0,0,0,0,0,8327,0,0,0,0,
+0,0,33813,33482,0,44577,24215,25218,26724,0,13402,0,0,0,0,0,
+0,7773,0,36469,17809,20344,48397,0,0,0,0,0,1986,0,46333,0,
+0,0,34937,0,41664,0,0,30822,0,0,0,0,30932,0,0,0,
+8113,16676,0,44615,0,0,0,30518,0,0,19898,23661,23762,42033,0,0,
+0,0,0,24103,0,0,26187,0,0,834,0,0,0,0,0,37616,
+0,0,14282,39578,44194,0,0,0,17696,33402,40405,0,38007,0,0,0,
+0,0,0,13817,0,0,43541,19185,44874,0,0,2799,0,0,0,23849,
+0,26778,43712,40705,0,0,0,8331,0,43095,0,290,0,16335,34820,39743,
+0,0,20385,0,0,33761,0,0,6680,0,0,28168,0,0,15566,0,
+8206,9660,44708,0,0,0,0,0,0,0,0,0,0,0,18633,0,
+14369,0,17180,0,26309,32989,0,0,46954,36695,12787,808,29894,0,0,0,
+0,0,3509,42603,11837,47411,0,40129,13717,15743,36620,0,0,0,0,0,
+0,0,0,0,0,10843,0,0,27943,47512,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,34977,0,0,0,22709,0,0,0,0,0,0,0,0,7144,23246,
+0,0,0,33903,15208,14308,0,0,0,0,0,0,0,31083,0,0,
+0,31310,0,0,10300,0,0,0,0,0,42226,0,4912,10520,37646,48046,
+0,0,0,0,5754,21473,7273,33301,39344,0,0,43047,0,14592,24594,11838,
+0,5232,27124,0,0,0,0,0,0,0,0,41699,15259,0,0,0,
+0,0,0,0,0,1869,44558,0,0,0,42477,12942,34632,0,0,0,
+0,0,0,29985,41164,18829,0,11949,0,0,7973,45522,0,0,0,26184,
+0,8119,25764,44585,33869,0,0,0,10903,5306,0,0,0,3944,28540,0,
+0,0,0,0,0,0,0,11073,3151,48319,9162,0,0,0,0,38509,
+1180,0,0,0,0,0,26926,0,0,0,0,0,0,0,0,0,
+0,0,0,20341,28705,0,12172,32007,38761,41486,33227,0,0,0,0,46903,
+0,0,0,0,679,19544,0,39491,30736,46928,14059,0,0,46918,0,7442,
+0,24458,6624,30434,32067,44417,0,23377,26272,0,1942,0,6496,21316,25549,0,
+32555,8634,0,0,0,32111,0,0,0,0,0,0,0,31873,0,0,
+0,0,44969,0,27286,0,922,9382,39171,0,41678,0,30368,0,0,0,
+0,0,0,0,0,17866,0,0,40097,0,0,0,0,0,0,40362,
+0,0,0,1122,13609,0,0,0,0,0,47313,0,14252,0,0,2460,
+23653,0,2494,1777,0,9556,27731,32826,33322,0,1169,10733,13453,0,0,7380,
+0,0,0,0,0,0,0,18009,2699,9095,15365,0,26118,14402,0,0,
+24616,0,0,0,0,0,0,34608,0,0,7956,0,29350,0,7881,0,
+0,0,46979,48532,4010,0,0,0,0,14364,15164,0,0,0,0,0,
+0,3187,0,38555,0,0,0,0,0,0,0,8811,0,27130,0,41632,
+42207,0,0,0,2318,5196,0,40517,41936,0,19125,0,0,0,0,0,
+0,0,0,44013,0,33159,12064,0,0,0,0,0,0,0,10646,13466,
+0,0,0,41053,0,0,0,11206,0,0,0,46413,0,0,0,0,
+42154,0,38903,0,0,0,0,0,0,0,0,0,22631,0,0,0,
+0,0,0,40551,29013,13375,22252,0,0,0,4616,20456,0,0,20996,4011,
+0,19190,0,0,1268,0,0,36622,47946,16776,39980,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,26169,0,38018,0,
+0,10669,0,0,0,0,0,24800,0,32229,0,0,0,0,0,0,
+0,0,39367,7325,0,35501,6924,5076,12874,30995,27720,9969,32011,0,7171,27212,
+38100,0,0,0,0,0,36146,27761,0,0,0,26226,0,0,0,47647,
+0,0,0,0,25670,9078,18151,41875,0,0,0,0,0,0,7952,0,
+7021,0,0,0,0,32884,0,18468,26975,39859,20431,0,14929,0,0,0,
+6805,0,32525,46294,5341,0,0,0,24866,0,0,0,0,44435,0,0,
+0,0,0,0,27106,0,38167,0,0,0,46726,0,0,0,0,0,
+37755,33840,0,27653,0,24566,0,0,0,26622,0,0,0,0,0,0,
+0,0,19524,0,0,0,0,25728,0,0,1381,0,0,0,0,0,
+0,37098,18732,0,17785,40123,0,12989,1487,18967,30340,0,0,22188,0,0,
+46543,0,0,0,1425,0,0,0,0,0,33349,39366,47003,0,0,901,
+11132,37053,17795,46078,0,0,0,38916,0,18063,0,0,0,44839,0,0,
+0,5836,10431,25942,37569,7080,20179,0,41498,0,0,0,0,0,9514,31704,
+41046,22025,0,0,0,0,0,0,39129,0,0,12244,0,0,0,29123,
+8915,0,0,0,27601,9666,4978,0,0,10227,0,0,35082,0,7410,7224,
+22843,43954,0,0,0,3457,0,0,0,0,16393,0,0,0,37709,0,
+0,36157,0,19956,47209,0,45157,0,0,0,0,0,0,0,0,0,
+0,6341,14822,28082,0,0,0,0,14005,0,0,19623,18112,0,27239,0,
+0,47420,35313,0,0,0,0,3867,11492,7921,22072,47322,0,0,0,29456,
+0,6878,0,0,15362,17997,0,0,0,1605,0,0,0,29749,0,0,
+0,0,0,44045,0,0,0,0,220,8537,0,0,0,39685,0,21762,
+0,0,0,0,9379,30065,34688,35203,0,0,11440,0,1174,20591,35327,0,
+0,0,0,4810,0,38674,0,31996,47499,26857,41708,40856,0,0,0,23801,
+37042,4096,0,6663,0,0,0,41258,0,0,0,0,0,0,0,0,
+0,0,11778,0,0,0,14673,26901,0,0,0,4164,19127,0,0,0,
+0,0,37393,0,47925,0,0,40439,22803,24569,0,16125,0,0,0,0,
+0,0,2475,0,0,0,0,0,0,0,28275,2616,42297,44425,0,0,
+30457,0,0,0,0,25100,0,0,0,29075,0,0,0,0,0,0,
+0,39120,41417,0,0,0,0,9914,0,0,9181,42069,5539,0,0,45669,
+0,0,0,0,0,0,0,0,45200,0,32031,0,0,0,0,0,
+0,8142,27987,0,0,0,15689,0,0,0,0,0,27794,0,12170,27597,
+38547,22943,13975,0,0,0,0,0,11932,5654,14722,29626,0,0,0,0,
+0,0,0,28329,22399,0,0,18946,0,34795,0,0,0,0,38296,28207,
+15377,15872,0,0,0,0,0,0,0,0,0,0,0,0,46916,0,
+19935,30011,0,19656,36587,9287,13865,10349,37958,46145,7750,38785,3759,31827,0,0,
+0,0,0,0,0,12770,29474,44752,26037,46382,0,39007,0,0,23323,3766,
+12373,37348,25684,0,0,0,31312,39026,0,3585,0,0,46644,0,1205,27226,
+0,47567,0,0,0,353,33483,43360,46161,0,0,0,0,0,0,0,
+0,0,5356,0,0,0,0,24489,0,0,33106,0,31866,44441,25209,0,
+0,0,0,0,0,9724,11182,0,27028,0,0,41133,30609,0,19280,0,
+0,0,0,0,0,0,0,232,0,0,0,34627,0,0,0,0,
+0,0,47470,0,5250,0,0,0,0,0,11794,0,37297,35010,36442,36781,
+37712,0,0,0,0,34218,0,0,0,0,0,0,0,5584,0,0,
+0,1595,14757,44636,45639,0,33380,0,2148,18175,45799,0,0,12701,588,0,
+0,0,0,0,26319,0,12591,0,0,0,0,0,45549,12963,0,2739,
+37756,0,0,22918,0,0,0,47039,6444,22844,0,0,17101,0,0,0,
+0,13025,5861,0,0,15619,0,0,0,0,0,13929,0,0,27225,0,
+0,0,0,28579,0,0,0,3564,0,0,13799,25829,32685,38954,0,0,
+0,9765,0,0,0,17292,1906,7280,0,0,38011,39337,0,0,37897,43173,
+0,0,0,0,0,0,20688,0,0,0,7238,41366,0,0,23894,0,
+0,5000,44701,27859,0,0,0,0,1200,18174,48293,0,0,0,0,0,
+0,9920,0,0,17384,5953,26752,46065,48232,0,0,0,18463,0,0,0,
+31519,0,3847,0,0,0,0,0,0,0,5143,40755,0,11337,41284,15980,
+12140,23681,43731,0,0,0,1141,44792,0,0,0,17111,0,0,0,0,
+16279,33287,36605,24664,0,24154,0,0,0,10181,9086,42450,43928,39674,0,0,
+0,0,0,18562,37782,20555,24007,0,0,45127,0,0,0,0,0,0,
+0,0,0,0,2875,0,0,0,16078,13691,6772,38966,3212,32288,0,0,
+11442,34382,0,15519,20366,0,0,0,21583,0,0,13512,23484,0,0,0,
+0,0,0,0,18398,33357,0,0,0,0,0,0,0,0,29500,0,
+26546,0,16859,17503,0,0,43146,0,0,0,0,0,0,0,0,37361,
+46240,0,0,0,0,20746,22531,43472,0,0,0,8885,0,0,24705,0,
+0,0,0,20043,29346,0,42975,0,0,0,0,6467,3062,44675,0,0,
+0,0,34496,38056,0,32883,0,0,21451,48200,0,0,43935,21797,13529,0,
+0,0,0,0,0,0,0,0,0,0,24275,3221,30760,33283,43211,0,
+0,16013,0,0,23325,2452,6037,32365,25152,48615,0,0,0,0,0,0,
+0,0,0,19246,26163,0,0,0,0,0,0,0,3542,0,0,0,
+27007,0,5547,0,0,0,2914,0,0,0,0,0,0,0,12773,0,
+41388,45932,8127,0,0,6369,0,0,38658,0,0,8055,47793,14835,31547,0,
+0,0,0,0,0,0,0,0,0,25392,0,0,0,0,0,15073,
+0,12423,0,0,0,0,0,0,0,0,0,0,0,0,41062,0,
+0,1209,0,15832,1165,24397,43441,44901,0,6867,44518,46005,47521,0,34659,0,
+0,0,0,0,0,0,0,42303,0,0,0,21562,35976,36108,0,0,
+5400,2145,0,0,0,0,0,0,1776,27800,0,11509,0,0,0,0,
+0,0,40657,0,0,0,40593,0,0,0,0,0,0,0,0,0,
+0,0,39183,8498,31882,0,48130,0,0,0,0,0,35591,36012,0,0,
+0,0,0,11149,25139,0,0,0,0,34092,41153,31683,18791,0,0,0,
+0,0,17794,0,11112,36492,0,28764,0,2108,36764,0,0,29758,36841,43901,
+8612,13500,46743,29544,42925,47917,0,9680,0,3478,0,0,10351,12533,0,0,
+0,0,0,0,0,0,23828,16046,0,0,0,0,0,40965,0,0,
+1893,44448,0,0,0,0,0,0,0,0,5063,0,0,33123,34996,0,
+0,45637,0,0,0,0,28914,0,6305,44139,0,0,33601,34974,0,39816,
+8872,0,0,0,0,48024,0,0,33854,17215,0,11675,0,0,0,0,
+0,30111,37941,25633,960,35899,38488,14707,45826,0,0,47600,0,0,12565,46465,
+0,9879,1318,43772,0,0,0,0,0,0,0,27785,48100,0,0,44393,
+0,31319,0,0,0,0,0,7299,40774,25470,34403,6190,20761,25096,29122,42110,
+40538,0,0,9946,0,43713,14333,0,5360,13099,39055,0,0,0,0,0,
+0,0,0,45312,12846,376,23417,33131,0,0,23570,0,34252,0,0,5940,
+24348,42018,0,0,43128,0,0,4350,43119,0,0,0,0,0,11885,12335,
+7803,0,248,0,22140,0,0,0,0,48564,48666,6869,40494,0,0,0,
+29756,0,36418,0,0,37401,43884,0,0,0,0,0,34761,0,0,15785,
+0,45204,25053,41566,0,21343,17814,1118,17163,19730,20967,0,33087,45905,14880,12079,
+26604,0,38590,3536,0,0,0,29868,10615,0,42843,0,0,0,0,0,
+0,0,0,0,0,0,0,45056,0,0,0,0,0,0,0,0,
+0,0,1465,41643,19958,47239,0,19464,0,0,0,35225,0,7929,34421,24824,
+0,0,7578,0,0,21230,9627,41481,44044,33048,0,0,0,0,0,0,
+9544,16951,34178,44083,0,0,0,0,3400,0,0,0,0,29182,43868,29846,
+0,0,0,0,0,0,0,0,0,0,31686,17831,20256,0,0,46018,
+32868,0,0,0,42939,0,0,0,0,0,0,0,6605,0,0,0,
+0,0,0,0,0,0,45446,32878,0,0,45419,0,45895,33320,21962,0,
+38909,0,0,0,0,0,0,0,0,46705,46818,43073,0,0,0,0,
+0,28695,0,3665,24464,30247,10004,12081,32737,37319,0,0,22247,24692,0,0,
+0,9012,0,38106,19951,0,0,0,0,13674,0,0,0,0,0,33079,
+0,42376,0,0,0,21338,0,0,0,0,0,0,2172,0,0,0,
+0,36272,0,22567,48201,0,3592,12866,20621,0,37131,0,0,0,0,0,
+0,0,0,2628,0,0,41921,0,20733,0,0,0,28575,0,0,0,
+0,15947,0,0,0,27513,0,0,46888,0,5227,0,0,0,14717,22511,
+0,0,5058,0,0,0,44869,0,0,0,0,0,0,0,0,0,
+19568,17122,0,0,5964,17636,28199,28973,20814,28310,32345,0,0,7904,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,5849,0,754,0,0,0,2796,45765,0,39067,0,0,0,
+0,0,0,6311,0,0,0,9130,13215,14892,29780,0,0,0,0,0,
+0,0,0,0,0,0,15413,13660,7347,23698,47576,43458,27222,0,7086,14855,
+21922,9656,38019,38886,38899,42370,0,0,34430,0,0,0,0,0,28720,31448,
+0,21130,29032,21585,46265,0,0,15855,0,25260,29195,0,0,0,0,6350,
+0,0,0,0,0,0,0,0,21833,29343,33612,30383,40424,40993,0,0,
+0,47762,0,0,0,36258,0,0,0,13229,30215,0,42416,32538,0,0,
+25001,0,28646,0,46733,0,42258,6593,0,24409,0,0,0,0,0,0,
+47047,1183,36019,11115,9647,0,0,0,0,30657,0,45104,0,0,0,0,
+0,0,0,0,0,0,0,0,0,37040,0,0,0,0,23654,42837,
+0,0,0,12796,0,0,0,0,27115,489,11432,0,0,44762,0,0,
+10915,0,30635,189,21647,0,13237,22695,8467,44395,46024,14833,0,30397,34414,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,18667,22854,
+0,42537,0,0,14933,29669,0,0,0,0,0,0,0,32333,44210,0,
+0,21253,0,0,42901,0,15992,0,0,28934,0,0,19126,39431,0,0,
+0,0,0,0,33240,0,22200,0,24804,41138,0,0,0,0,0,46122,
+17925,0,28902,38252,1961,31344,0,0,0,0,0,13082,30242,0,0,0,
+0,0,0,0,0,0,0,14596,34701,35206,0,0,0,0,0,12573,
+0,4124,26760,0,0,10959,0,0,0,0,0,0,12327,0,0,9082,
+48028,0,0,0,0,0,0,17235,17171,7268,34809,11205,13520,43412,0,0,
+31832,0,0,0,0,0,2213,16841,45310,0,0,17246,0,8313,4574,26076,
+44298,0,0,15167,23215,29616,34440,47147,0,8436,41471,0,0,0,14180,0,
+38752,14748,3136,24209,0,0,0,17699,0,0,47401,39345,826,4247,0,22478,
+0,8856,5158,0,0,0,0,0,0,0,6597,21964,0,0,29024,0,
+0,0,27341,35173,0,25518,40094,31267,0,0,0,21663,7287,0,40795,48026,
+12098,0,0,0,28253,32252,5392,42651,0,0,21228,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,22992,1103,21904,41056,36688,0,0,
+0,0,0,10051,2654,30188,0,0,0,11833,31160,0,0,0,0,0,
+0,0,15726,20313,18046,46396,42556,46379,0,0,0,0,13581,0,4750,0,
+0,0,37382,0,0,43480,0,2849,28117,32656,10082,36915,0,0,0,0,
+0,0,0,0,0,0,0,2048,0,0,0,0,19828,0,0,0,
+0,0,0,36423,0,0,20215,0,0,0,33050,44340,0,0,3243,39054,
+0,0,0,0,5288,6825,19002,0,0,0,0,0,0,0,29859,0,
+0,0,8350,0,0,0,47124,0,29201,0,0,0,0,0,0,0,
+48605,20100,0,24434,0,0,0,0,0,0,0,0,18858,37799,32928,0,
+16414,0,0,0,0,0,0,0,0,0,0,0,11577,45592,0,0,
+0,0,0,15826,30650,35690,33252,24653,28654,42586,0,0,0,0,0,10233,
+17021,29997,30153,0,0,0,1671,15113,35418,0,33060,0,0,0,44043,0,
+41464,0,27524,0,0,37957,0,0,0,0,0,0,0,26973,0,0,
+18916,0,5375,0,28808,34801,38682,8156,28195,5415,10974,13176,45727,47424,0,0,
+34061,0,13254,0,0,33681,0,0,0,34248,48132,48279,0,0,0,0,
+0,39057,0,0,29625,0,0,35746,41939,0,5092,36077,0,0,0,7593,
+0,0,0,20865,25095,0,0,0,0,0,1159,46435,0,0,0,0,
+3383,0,0,29502,32069,0,18160,5927,25962,0,0,0,27516,0,0,7253,
+40956,0,0,46216,5649,0,0,0,0,0,0,0,42023,45784,0,45947,
+8423,0,0,10077,45448,0,0,0,0,21940,41846,0,0,14269,27335,0,
+0,33028,0,0,0,0,0,0,0,0,0,0,0,0,37484,8803,
+0,16510,8565,0,0,0,0,0,0,0,0,0,0,33109,0,30475,
+0,0,0,0,0,0,39756,7942,12825,0,0,47605,44930,0,0,0,
+0,16186,0,0,3401,45901,0,0,0,0,47582,0,0,0,0,22152,
+0,0,45362,18279,0,28597,0,0,0,0,0,0,1244,21628,0,0,
+0,4765,43365,0,0,0,0,8896,31561,0,43124,0,23845,0,0,26489,
+1047,24799,25087,44483,40622,0,0,0,0,25545,41184,0,47524,0,0,0,
+16341,0,7795,0,48385,0,0,0,0,14383,2806,0,0,0,0,0,
+0,0,2149,1635,13604,36524,0,5567,0,0,0,23494,31575,38277,0,0,
+0,31285,15386,24423,0,0,0,0,0,5372,0,3431,0,9844,0,0,
+0,0,0,0,0,0,0,32460,0,0,0,0,45956,0,0,986,
+0,0,0,0,0,39326,0,21410,0,4324,0,0,21250,0,0,0,
+35804,6957,22096,10016,28159,7177,9322,16134,16615,0,0,0,0,40687,0,0,
+0,0,0,0,0,0,0,0,0,38068,19565,35231,35607,0,0,0,
+6504,46133,0,0,24699,45210,37790,10066,0,7623,6807,7189,9170,0,0,0,
+0,0,26890,0,0,0,0,0,0,25058,0,37670,0,0,0,14643,
+0,0,13210,0,0,0,0,0,0,22099,43748,41707,0,0,40363,0,
+0,0,0,0,10933,27467,3696,35126,0,0,0,0,46846,0,0,0,
+221,23218,33016,0,37779,0,18982,0,16318,8718,11682,21916,0,35514,12574,0,
+0,0,0,4822,0,0,8753,0,0,0,0,10508,0,17748,0,0,
+1571,11802,0,0,41976,0,0,0,6233,1526,32263,0,0,42812,0,0,
+0,15019,26526,4476,43254,0,0,0,0,0,0,0,1512,0,0,0,
+0,0,0,0,0,0,40589,0,0,0,0,0,0,41106,0,0,
+0,19832,10895,26634,45885,0,0,0,0,0,33068,0,0,0,23082,19697,
+0,0,0,0,40648,2372,28796,0,0,0,0,0,0,0,0,296,
+0,0,0,0,9902,36557,0,0,0,0,0,10506,18709,21328,0,0,
+0,0,0,8586,0,0,0,31772,0,7674,0,0,0,0,0,9567,
+0,0,0,0,0,0,0,0,0,0,0,35807,0,0,0,0,
+0,0,0,0,0,16169,0,0,2665,0,0,0,0,0,0,0,
+0,0,0,0,39662,0,3855,0,0,41868,0,0,0,0,29483,36722,
+0,18572,19817,0,0,18285,0,0,0,0,18165,14310,0,0,28805,0,
+0,0,0,28131,45389,20667,0,762,8876,9611,19993,21106,27974,30811,0,39728,
+0,0,0,38579,46048,35406,27925,17014,0,0,28045,0,0,0,20538,18107,
+0,10256,39940,0,0,0,41759,0,0,45855,0,18147,0,0,0,0,
+0,7394,0,0,0,22523,0,0,0,0,0,0,0,0,0,0,
+38458,47834,0,0,0,0,0,0,17864,0,0,0,0,0,0,0,
+0,0,0,0,0,0,1282,0,0,0,0,0,10265,0,25460,0,
+0,39105,0,0,0,0,0,0,0,0,15787,20150,0,11334,0,0,
+0,21832,0,0,0,0,0,0,0,35378,0,8739,39689,0,0,0,
+0,693,9615,18943,47492,5503,12161,0,23271,0,20239,45319,28304,0,0,44294,
+0,0,0,0,0,34340,35555,0,0,18504,32103,48749,0,0,0,13246,
+0,0,0,0,0,44333,17190,0,0,36928,41762,0,0,0,37868,48621,
+41712,0,0,0,38444,39646,0,0,0,0,0,27538,3618,2808,13478,27443,
+25866,44751,47241,0,11671,0,0,33313,37849,0,0,27933,0,8504,43564,0,
+0,22963,14328,41249,0,0,2741,0,0,0,14125,0,0,0,31678,38153,
+42143,0,0,0,0,0,0,0,44080,0,0,0,0,0,6657,11987,
+2163,9026,31499,33157,0,0,20414,9051,27876,29707,0,0,35808,0,1737,18918,
+0,0,0,0,0,14421,26103,40039,11217,0,0,0,0,0,19333,0,
+0,0,0,0,0,0,0,0,0,0,13235,0,0,0,0,0,
+0,0,0,0,16811,0,10752,452,25608,0,2963,0,0,0,0,11277,
+0,0,0,0,0,0,0,31379,16643,0,24074,0,0,0,0,23685,
+0,0,0,18387,27450,24901,0,38644,6329,0,0,0,0,38781,0,0,
+0,0,0,44396,0,0,0,0,0,9259,0,0,16264,0,0,0,
+0,0,0,43307,27595,0,0,0,0,0,0,0,0,44381,0,0,
+0,36410,0,0,45959,11663,27175,0,0,0,0,0,46120,0,0,0,
+0,0,0,0,0,0,0,0,12762,19848,0,0,0,0,0,34872,
+0,6704,0,42619,15388,0,1832,0,0,15368,0,39320,0,0,0,25196,
+0,11375,42065,15589,0,0,0,28017,4967,23080,31801,12532,0,16614,0,9958,
+12718,0,0,0,22409,0,7330,0,0,0,0,0,0,0,44022,43655,
+0,2187,0,0,0,0,0,0,0,0,0,47543,390,0,0,40153,
+0,0,0,16129,10133,20970,44994,12047,0,40561,0,0,0,0,0,0,
+34243,36375,37847,0,0,0,0,0,0,21362,15072,47409,0,0,0,0,
+43537,0,32829,11856,48337,27882,15380,40932,37466,47369,0,0,42999,44993,0,11634,
+25484,0,0,4186,0,25971,40627,35163,0,0,40706,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15111,
+0,0,0,0,0,0,0,0,16505,0,0,6304,0,0,45323,23811,
+0,8935,31035,42631,45494,25554,0,0,0,0,0,1876,21214,0,0,34737,
+0,0,0,0,0,0,0,0,0,14566,0,0,0,0,0,0,
+34747,0,3125,0,0,0,0,37789,0,0,0,18764,0,38525,37785,30746,
+0,0,0,0,0,0,0,0,0,0,37524,4610,37360,0,0,0,
+16874,2469,0,4944,48288,26456,0,0,0,0,0,0,132,0,0,36644,
+0,0,0,0,0,10624,44281,6849,0,0,0,0,0,0,42225,0,
+31478,0,0,35617,0,8056,19130,21517,39863,30708,30201,40403,0,0,0,0,
+0,1269,15551,25389,6568,19668,27686,36521,46688,0,20716,0,0,0,36554,44519,
+0,0,17528,0,0,0,0,0,0,0,1087,32289,0,0,0,0,
+0,18595,30628,12471,0,0,15068,6356,33492,38391,0,0,14904,38237,0,0,
+4066,33217,8970,15962,16674,38586,46702,0,0,0,34347,0,0,0,36790,0,
+0,22279,0,0,0,0,0,31452,0,0,0,5455,0,0,0,40459,
+0,0,0,0,0,0,0,20176,0,0,0,0,0,0,13048,0,
+0,0,0,43709,0,0,0,16096,0,0,0,0,0,0,8776,0,
+0,0,4539,37510,3299,0,0,0,41130,0,0,0,0,26019,10251,27475,
+0,0,23152,0,0,0,0,0,0,14782,26782,0,0,0,0,0,
+47559,0,0,33693,0,6144,0,0,0,0,0,0,14952,0,0,0,
+1072,0,0,0,0,0,0,0,0,0,0,987,0,23482,17194,3804,
+27664,0,0,0,0,0,0,0,42658,0,41120,44332,0,0,5176,0,
+0,0,0,38424,0,0,0,0,0,44475,0,0,0,0,0,35663,
+31413,33019,33925,44704,0,0,0,0,0,0,40191,0,0,8766,0,0,
+0,4557,47355,0,701,37604,0,0,0,0,0,0,0,0,0,0,
+0,20186,18214,0,0,0,41935,0,5094,13415,0,0,0,0,0,29047,
+0,0,4529,10216,18873,40388,0,0,0,27219,0,37754,48423,0,0,12553,
+43326,0,0,41811,0,36351,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,39921,0,0,0,0,0,48593,8184,0,
+0,29275,33332,0,0,0,0,29135,0,26906,0,0,37214,20694,6871,13057,
+24756,0,38950,45988,0,37701,0,0,10908,24226,41551,0,6961,0,19097,18195,
+0,0,0,0,0,0,0,0,0,0,9204,0,0,0,0,0,
+0,0,0,0,0,3234,21696,4013,21769,23448,23928,26619,29852,0,0,0,
+0,0,0,0,3979,0,0,0,15057,0,0,0,35915,0,24487,0,
+19552,0,61,0,0,0,0,0,44262,7836,0,0,0,0,0,0,
+43795,10247,0,0,28710,0,0,21587,0,0,0,1332,0,3984,13432,16853,
+36626,839,46193,0,0,0,0,23197,26754,0,16729,48261,0,39758,0,0,
+0,0,0,0,10873,45537,0,0,42650,37631,0,0,0,0,0,0,
+37333,37708,0,9155,0,0,0,0,15493,29239,34139,40297,41774,47837,43061,0,
+0,14343,0,7101,0,0,26811,0,0,0,0,0,0,0,0,8486,
+0,0,0,0,0,0,14735,19743,20603,33107,34142,0,47110,0,40425,9681,
+26976,4993,5248,19006,46624,0,0,0,0,16891,19459,0,10319,0,0,0,
+0,0,0,0,0,0,36821,0,0,0,31587,36362,39329,0,0,0,
+0,0,0,0,27159,48142,11754,0,48076,0,0,0,0,0,6650,0,
+0,21290,0,0,0,0,4745,0,0,0,0,0,0,0,0,0,
+12052,0,37603,0,0,0,0,45229,46238,0,4468,18222,41260,30560,43848,0,
+0,0,0,0,23628,0,1264,7483,13838,47316,0,0,0,20740,18157,0,
+6485,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+12725,39319,0,0,0,0,0,26620,0,0,0,0,7576,0,0,0,
+0,44692,0,12428,48054,0,0,0,47867,3295,0,0,0,0,0,24353,
+48683,0,0,16461,0,0,0,32633,0,35224,0,0,0,36151,35700,0,
+0,0,0,0,0,0,28308,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2286,0,10103,20943,8425,0,0,0,
+0,1966,14288,41418,0,10598,18197,24818,26029,39913,0,0,0,0,0,45236,
+26421,29971,0,0,0,0,0,0,0,0,0,22980,37688,39460,0,0,
+0,0,0,0,0,0,0,0,0,0,10419,0,0,12814,18026,28110,
+0,0,0,0,0,0,0,0,22265,0,0,0,27303,40603,0,0,
+0,0,0,0,0,0,34861,0,15315,28031,0,0,0,0,1835,0,
+0,0,24191,0,0,4712,30415,2423,39408,37547,40288,0,21317,0,0,29867,
+0,0,8635,0,0,0,0,9396,12793,19428,0,0,0,0,1051,0,
+0,0,0,0,0,0,0,6385,0,0,0,0,27415,0,23712,26419,
+26366,0,0,16962,19007,12393,0,17665,0,37984,0,21872,4908,0,12833,14617,
+0,0,0,0,0,0,0,6033,44008,0,0,0,4731,0,28202,0,
+0,0,0,20675,0,0,0,0,0,0,2489,0,32160,9746,0,0,
+23111,14738,0,22059,0,0,0,0,0,0,0,0,0,33339,0,0,
+29237,38655,0,23673,26158,32393,34910,24510,0,1913,17630,0,40262,0,0,38006,
+0,0,0,0,42800,16482,0,0,20756,0,0,0,47754,0,38172,29689,
+0,0,0,0,45742,0,0,44737,0,0,26257,0,0,0,13199,7429,
+0,21733,0,42950,0,0,0,0,0,29508,2252,27112,0,0,0,0,
+0,22271,0,27223,41807,27354,0,0,33115,0,10361,0,0,0,0,0,
+16084,6542,0,0,0,0,30414,10941,0,11741,4105,12291,0,25093,25017,28368,
+0,0,0,0,0,0,0,17176,0,0,44699,0,0,0,11027,4783,
+0,48626,0,0,9134,0,25234,0,38518,0,0,28547,24565,45658,0,0,
+0,0,0,0,25697,0,0,5276,16248,0,0,0,0,0,29301,2554,
+380,2400,32498,0,0,0,0,14528,0,3613,0,13226,5983,0,0,0,
+0,0,5517,0,0,0,0,0,16508,0,7996,10746,46719,0,26414,1341,
+0,0,0,34696,0,0,0,0,0,0,1950,0,0,0,0,13441,
+1113,39003,39595,0,19640,47571,0,26885,0,0,0,0,0,20737,0,18385,
+0,0,0,36184,1070,0,0,0,8245,28215,0,0,39300,18051,33863,1703,
+0,0,19063,35391,4268,5325,898,19595,0,0,0,813,17414,0,6902,0,
+6469,32981,24357,0,24385,0,0,41839,0,0,0,34702,0,0,0,11063,
+41141,1886,4029,34934,0,0,0,0,0,5338,26691,47172,0,0,22291,17102,
+0,42557,0,37161,0,0,0,26313,0,0,2635,0,0,0,5119,10939,
+28158,33845,40760,0,21532,46923,32420,0,6339,0,19506,38493,38536,0,0,24740,
+26764,24030,40375,0,0,0,11535,0,0,0,11783,6397,0,0,0,0,
+34874,12799,4839,3761,21402,32747,0,7194,20482,0,0,0,0,0,0,30734,
+23853,0,0,0,4947,0,0,0,0,0,8261,37532,0,0,0,25555,
+31442,34416,0,15635,0,0,0,0,0,0,0,0,4131,0,0,0,
+0,0,0,0,36285,0,0,0,1049,24706,0,0,0,0,0,0,
+0,0,0,0,9786,0,0,0,22002,0,0,36697,33081,0,0,0,
+0,0,0,0,0,0,29097,29018,42350,36216,0,0,16003,0,0,0,
+0,46721,0,0,0,0,15572,0,0,0,0,0,0,0,2833,0,
+1151,39933,17301,0,0,0,0,0,40142,3016,35,11259,0,16086,32046,17130,
+16969,33262,3978,22212,44854,48584,0,0,0,0,0,0,0,0,0,13832,
+0,0,0,0,0,0,0,0,0,0,0,0,10214,45385,0,0,
+0,0,9870,0,0,0,0,24734,29170,8695,41075,0,12294,34096,0,0,
+37923,0,0,0,0,28641,48603,0,43781,0,0,0,0,0,19721,10365,
+46931,27945,0,0,0,0,0,0,0,0,41275,0,16629,34046,0,0,
+26202,0,0,0,6354,0,0,0,0,0,6459,0,0,0,14187,12388,
+12540,17007,5888,21349,34942,0,24502,0,0,7742,0,0,0,5032,24599,0,
+0,6387,33692,24572,0,15235,24973,29303,0,34695,0,12969,97,3418,28337,44655,
+0,0,21417,0,0,0,27254,0,22182,0,11630,25834,0,0,0,0,
+0,0,0,0,10715,183,19928,17066,31569,0,8244,0,0,0,0,0,
+0,0,37792,0,0,0,0,16691,41716,0,0,39960,0,0,0,0,
+0,0,0,10462,0,15420,0,0,2196,0,13180,0,0,6833,17608,27123,
+20116,24623,31172,0,17544,0,0,0,0,0,7087,0,0,13730,0,0,
+6944,0,8303,0,0,33999,0,0,11484,0,0,6257,0,0,0,0,
+32110,28702,9703,37963,17512,41328,47688,16021,0,0,10755,0,0,0,0,0,
+15549,23875,0,30420,45465,0,0,0,0,0,0,0,4534,0,0,0,
+0,3149,0,11412,25635,0,9463,47733,0,0,0,5172,31096,3348,31751,32382,
+43502,0,0,0,2026,32127,10403,0,0,13539,40992,0,0,0,19829,0,
+0,12665,30276,39732,45667,0,0,23961,0,29854,27969,0,26146,1474,3443,12184,
+40245,45957,0,46637,0,0,0,0,0,0,0,0,0,23199,0,0,
+40506,0,0,0,23317,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,48834,0,34045,9282,2287,2295,
+41911,23940,33590,41637,0,14719,0,30370,0,19597,1320,0,0,0,0,0,
+18706,19075,45774,1634,13699,0,0,33203,0,0,0,14809,45287,20731,0,0,
+0,12998,26071,29367,37168,40047,0,0,0,9859,0,0,0,0,0,0,
+8466,19573,0,0,7067,45550,46593,0,0,0,0,0,24797,38929,0,14924,
+0,0,0,0,0,0,6012,0,0,3086,37637,38465,41862,43733,0,20704,
+9552,8272,0,0,0,0,18660,29282,36054,0,0,0,40065,0,0,19486,
+32225,0,0,10913,31116,0,13750,22822,42897,7062,17516,0,11858,0,3600,26283,
+33158,7252,37444,237,4981,19627,45951,0,3089,0,33927,35356,0,0,0,0,
+44771,0,0,0,0,1734,20057,0,0,0,0,0,0,0,42352,0,
+14571,34511,40539,43815,0,0,46036,0,0,0,34780,4201,0,0,0,32320,
+4102,30439,1043,37864,0,0,21491,39903,34763,0,0,22045,0,0,0,1382,
+704,5022,0,0,0,0,0,42802,0,0,0,0,40360,0,0,0,
+0,6959,2279,20051,0,6676,20521,0,0,0,0,0,2352,19636,29698,0,
+0,0,41669,36861,0,0,0,0,0,0,0,5003,17245,31027,0,39594,
+0,0,26455,0,10716,0,0,0,0,0,0,0,0,22085,25049,25064,
+0,5102,0,20326,0,0,0,0,0,0,17582,0,0,0,0,0,
+21572,0,10342,19392,16383,33652,38094,0,39878,0,0,46832,0,0,0,0,
+0,0,2632,28473,0,0,0,45000,17100,0,0,0,0,0,21266,0,
+40302,0,5709,37327,36726,18605,0,0,0,16689,811,46444,0,0,0,36398,
+0,21515,47033,0,0,0,0,9785,8041,39001,41920,0,0,0,0,0,
+0,0,0,0,44612,0,17934,0,0,0,17349,0,0,0,0,42444,
+26201,0,0,2922,8757,0,0,0,0,0,25732,34395,0,16721,0,23160,
+30008,0,0,0,6986,0,0,24411,47483,0,0,0,3857,44729,0,0,
+0,0,0,11735,21727,48753,0,0,0,41195,0,0,0,46796,16355,31294,
+0,0,0,25883,32615,0,0,0,28464,39591,0,0,0,0,0,0,
+0,27273,12916,0,6066,0,0,0,15024,28130,0,0,0,0,0,0,
+30290,0,0,0,0,6441,0,16718,0,2063,42895,0,21103,45832,0,0,
+6388,0,0,0,0,16861,24932,0,0,20929,0,0,0,5173,0,0,
+0,24020,32852,0,0,0,0,24427,0,2682,0,0,0,0,0,8091,
+14243,12449,0,10457,29834,0,34247,0,31562,0,0,34205,0,0,0,0,
+0,0,2626,0,25675,33457,0,0,0,8568,0,2131,0,2647,0,35365,
+0,0,0,0,0,0,0,0,0,0,0,0,39636,0,0,0,
+0,0,0,24339,0,31,32132,7865,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,20511,0,0,0,0,0,2715,
+23214,0,0,0,0,0,0,0,0,0,0,0,19825,38165,0,0,
+0,0,0,35930,0,0,0,1005,0,0,0,0,0,6507,0,0,
+14370,0,0,0,0,0,0,0,0,8946,0,0,0,0,0,20302,
+27104,0,0,0,0,41236,5460,30698,0,15145,0,0,0,37577,0,0,
+0,0,0,0,0,0,0,0,8363,26468,29266,0,0,0,36580,0,
+7459,0,0,35092,23148,0,0,0,0,0,44236,0,0,0,17517,0,
+0,0,26459,0,0,0,0,0,0,0,0,0,0,0,4212,22031,
+30285,0,0,37678,0,0,19155,0,0,0,28476,30158,0,0,0,0,
+0,0,0,0,18012,0,25876,26965,27713,15186,354,36101,0,0,21453,0,
+0,0,0,32780,0,0,28266,0,0,0,4094,19412,0,0,11101,5069,
+0,0,0,0,0,0,0,0,0,43159,0,0,0,0,0,42379,
+0,0,0,0,0,6058,0,0,0,0,0,0,0,14360,31022,32356,
+0,0,0,44980,0,0,28564,0,0,0,0,0,0,0,0,0,
+36700,0,8015,0,0,0,0,0,0,3580,0,0,0,0,0,0,
+32346,0,0,0,37483,32721,0,0,0,25537,41614,0,0,6285,5924,0,
+0,0,0,0,0,0,26803,0,0,13340,7271,19183,0,0,0,0,
+0,30103,0,0,28320,4713,0,0,24535,37744,0,0,0,0,44018,0,
+0,0,0,43459,0,0,0,0,0,2486,0,4443,0,14286,0,23926,
+0,0,32350,0,44724,30634,0,13135,5650,0,0,40412,3350,14407,0,0,
+100,0,0,0,11881,0,0,0,0,0,0,0,0,21327,23269,0,
+13230,26731,0,10505,0,0,0,0,0,0,0,0,0,13284,19038,32814,
+0,0,0,0,14334,9443,9671,23822,0,0,0,9891,42015,0,0,24803,
+0,0,561,0,0,0,0,0,0,44053,0,26814,0,0,0,4342,
+0,0,0,0,4492,0,713,0,0,19725,0,0,37118,4650,44162,0,
+0,0,0,0,0,0,0,0,26173,0,0,5646,0,0,9099,0,
+0,0,8654,0,0,39503,0,32098,2906,9440,11875,31165,11957,16973,0,0,
+0,20171,13410,0,0,22691,14863,15183,0,0,0,0,29202,0,48195,0,
+47268,20460,21073,32408,30268,43067,0,0,41209,0,0,0,46519,40393,795,17423,
+0,0,0,26766,30520,0,18738,0,0,0,0,0,26339,35230,17692,0,
+0,746,0,0,0,0,0,0,0,0,6125,0,0,0,0,0,
+0,18283,0,0,0,0,0,0,0,0,0,0,0,0,16816,0,
+21419,0,25601,39425,0,0,0,33866,0,20671,7042,0,0,0,0,21930,
+34605,0,0,0,0,0,27685,0,0,11666,0,43430,22297,6842,0,0,
+0,0,6067,0,9048,0,0,44782,0,0,0,0,0,0,0,6686,
+11116,0,43397,0,0,0,0,0,0,7626,0,3280,0,1836,14509,39305,
+10323,44196,0,0,0,0,0,0,0,0,0,0,0,0,0,31197,
+11341,0,0,0,0,0,0,35771,39347,41510,5626,26117,17401,35608,0,0,
+0,2556,8648,0,44502,0,16254,41750,0,26609,0,0,0,0,0,0,
+0,23564,25201,1799,0,19429,0,0,0,0,34733,11814,0,0,32818,0,
+0,0,0,0,0,0,0,0,0,38993,0,0,2876,0,0,0,
+0,0,0,0,0,0,0,0,5157,2481,2754,27908,0,0,0,10195,
+2689,0,34595,15041,39445,0,0,0,0,0,33899,1515,0,0,0,18364,
+19434,27792,8795,36569,0,0,41971,0,0,0,0,0,0,0,0,0,
+0,0,12577,32687,0,0,20504,0,48644,7814,17805,0,30880,0,0,0,
+0,3387,0,0,0,0,0,6880,42222,0,0,0,36360,0,0,0,
+17324,47119,0,0,0,0,886,33952,0,0,0,0,0,0,0,45273,
+0,0,0,0,0,0,43585,0,0,0,0,43318,0,35949,32448,36128,
+0,0,0,41466,4016,0,29450,0,0,0,0,941,0,0,0,0,
+0,33549,0,0,0,9709,23715,29521,0,36096,0,0,0,11683,0,11967,
+0,14095,0,0,24291,38534,23490,0,0,567,2024,3493,9835,41261,0,0,
+0,0,0,2981,0,0,0,47079,0,0,0,0,3109,27400,43941,0,
+0,18208,0,0,0,0,0,30606,30212,0,0,0,0,14969,0,0,
+0,7584,0,14878,0,0,0,0,33345,0,15744,16451,37707,0,19740,0,
+0,0,0,0,0,30376,0,559,15271,13348,28146,0,0,0,0,45208,
+0,0,0,36320,1245,24883,24879,25022,3760,39713,0,0,6853,9710,43405,30189,
+0,0,0,0,0,8817,15389,22234,3477,28418,0,0,0,0,0,0,
+908,0,0,0,4934,45342,4242,11175,0,873,19451,47394,0,0,0,0,
+0,0,0,0,13967,27573,42052,0,34550,0,40946,0,0,0,0,28793,
+8059,22043,32304,43822,22837,0,4793,0,0,0,0,0,0,29145,0,0,
+33097,0,0,23488,43234,0,0,0,0,32104,0,0,0,0,11547,13851,
+33232,0,0,0,0,0,0,0,37454,0,0,6395,20636,48821,0,24149,
+37794,413,17009,18556,32326,0,0,1253,0,2684,3101,46582,0,0,0,0,
+0,0,31638,0,25661,13789,48764,0,0,0,0,0,0,0,33610,2054,
+2527,8656,0,0,0,0,37290,0,0,0,0,15942,0,0,0,0,
+0,0,0,22949,0,0,0,0,0,0,9109,5619,0,46491,25886,41932,
+0,0,0,3532,0,29131,0,0,4340,0,31649,32749,38412,0,0,0,
+0,0,17664,0,0,0,0,0,0,0,0,0,0,35732,0,0,
+0,10143,39,0,0,16426,30824,40113,46964,20702,48550,0,0,0,0,44324,
+21046,19044,0,0,0,6240,25306,32279,0,0,0,0,0,0,38797,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,18158,47537,0,46301,0,35443,0,0,0,11613,16309,0,0,
+0,0,40104,0,0,0,0,20035,0,0,38311,0,15985,0,0,34145,
+0,1521,0,0,0,0,37072,0,22225,0,0,0,0,0,0,0,
+0,15859,0,0,12155,0,0,19186,0,0,19382,0,9406,14466,0,0,
+47603,374,0,0,0,0,14027,0,0,47651,0,24298,0,30477,0,0,
+0,0,0,0,16014,13810,16538,0,0,0,0,0,37500,29227,0,0,
+0,0,6398,0,0,20436,44908,0,17323,43156,0,47249,0,20285,32172,3527,
+0,17185,0,0,4670,8242,36279,25726,0,0,0,0,0,43570,0,11913,
+18156,0,0,33308,41909,39063,0,0,0,0,0,0,0,37344,0,30255,
+0,0,25570,0,0,0,0,0,0,0,0,0,37024,36762,24447,0,
+0,0,0,0,0,0,0,0,0,0,544,16953,17666,0,42147,0,
+33264,0,0,0,38379,0,0,0,0,0,0,0,0,0,11207,26770,
+0,16752,0,33542,0,0,0,32247,0,0,27551,0,0,11898,13835,3659,
+29697,40754,44783,0,0,0,0,0,0,0,0,0,44477,10333,0,0,
+10142,46574,0,0,0,0,0,1112,11023,0,0,0,0,33136,0,0,
+0,0,0,0,2497,0,0,0,0,0,0,0,8944,0,0,0,
+0,9327,0,0,0,32898,25707,15233,0,16709,15447,0,0,0,12515,41918,
+29551,0,0,0,0,0,0,45573,0,0,0,0,0,0,0,0,
+40758,0,2334,0,0,0,20381,0,0,0,0,22112,27101,7841,34660,0,
+0,0,0,0,0,44607,15569,0,0,0,0,0,0,0,46160,0,
+0,43461,7967,0,0,0,0,43376,0,0,19772,0,18759,0,24751,0,
+0,35054,0,0,0,0,12778,10189,35254,31582,0,0,0,0,0,0,
+14806,3845,0,0,25750,20164,33970,37170,0,1726,48538,44847,15573,0,0,0,
+0,0,15599,7022,20809,19159,0,0,17718,0,0,23582,9574,12587,38609,25491,
+0,46432,0,0,0,0,0,31511,19862,0,4449,0,29448,0,0,0,
+23052,0,33671,0,34909,23381,0,0,8260,0,0,0,0,0,38591,0,
+0,46958,0,0,0,0,0,0,0,0,14853,0,0,0,0,0,
+27752,12384,6384,30564,43262,0,0,0,8608,0,0,0,0,21539,0,0,
+0,5110,43443,0,0,0,0,3471,0,19147,0,0,0,0,9817,23184,
+0,0,0,0,0,14143,40012,0,0,0,0,29039,36530,0,0,16113,
+17675,0,0,34753,0,0,25593,1418,1548,18742,26343,43927,45243,17640,4625,0,
+0,0,0,0,0,0,0,0,4446,0,0,43917,0,0,0,0,
+0,0,24445,0,0,25076,0,0,0,0,0,0,0,16271,25281,23115,
+47186,47608,0,0,0,0,0,0,30206,0,0,0,0,0,518,9486,
+41018,0,0,0,0,0,0,0,0,0,13904,0,22249,0,0,0,
+32169,0,30033,0,0,42783,0,0,0,0,0,0,13155,0,6403,0,
+0,0,0,39663,534,0,0,0,0,0,0,0,0,0,46546,24936,
+224,24588,0,8522,14494,11216,0,0,0,47067,0,0,0,0,0,0,
+0,41339,34755,0,0,0,7390,0,5025,36939,48237,0,0,12788,0,0,
+0,0,0,0,2349,0,0,0,0,26670,0,0,21107,14899,0,0,
+2728,0,0,2960,27610,23339,14485,32477,11435,35031,35243,0,33493,46990,0,10498,
+38637,44392,0,37150,0,0,25699,0,0,0,0,0,0,0,0,17672,
+17561,0,0,0,851,0,0,22102,37671,48153,0,0,0,0,0,0,
+19600,0,0,17483,26436,0,0,0,0,0,0,0,644,0,40318,0,
+0,0,0,0,0,46670,0,12157,25692,37421,0,0,0,0,0,0,
+0,3906,0,0,14349,28183,0,0,40276,0,0,0,0,0,0,0,
+2323,19406,31325,10108,12489,33808,47144,9827,3007,26697,0,48461,0,0,9148,25885,
+10659,0,46430,17138,32321,0,9912,29428,0,45253,0,0,0,0,0,0,
+0,0,0,0,0,0,0,33290,0,20576,0,0,0,0,9217,0,
+0,0,0,0,0,0,0,0,0,0,0,31353,0,0,10250,10660,
+0,0,0,0,0,37176,0,8593,39907,45872,0,0,4735,0,0,29484,
+0,0,2353,6231,35753,0,0,14374,17333,0,0,0,0,0,0,36389,
+15295,0,0,0,0,0,0,19040,0,0,42874,0,0,0,0,0,
+11843,0,0,0,18100,32955,0,3913,0,15266,26336,0,44489,4746,26237,0,
+28505,0,0,0,0,0,0,0,0,0,16748,13910,48636,0,0,8225,
+32469,43798,0,34772,0,0,0,36217,0,14119,0,0,0,0,0,4862,
+0,20693,47926,0,41000,0,0,33685,0,14123,5361,16458,29430,11499,30646,46300,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,17153,34077,
+23300,26307,0,0,12391,11736,37788,0,0,0,11239,18380,0,0,48254,0,
+0,0,0,0,43037,0,0,3128,13259,0,0,15953,0,0,7717,39487,
+1002,0,0,0,0,0,5773,2736,44768,933,15720,0,16202,46449,19788,32511,
+3460,0,25963,32576,35060,0,0,0,0,0,0,0,0,23322,0,0,
+0,5364,0,0,37733,16649,45258,0,0,0,13489,34762,1992,0,46794,19433,
+21812,4883,35609,0,0,7602,5470,0,13626,0,0,0,32772,9118,39058,0,
+0,0,0,39879,0,0,22941,1335,33640,0,47774,3377,0,0,34993,0,
+48883,34768,0,6914,0,14834,40255,3779,10242,20032,37331,30990,41973,20143,0,20753,
+0,25827,6068,0,0,0,0,31817,44540,1090,0,28828,4009,0,0,0,
+0,0,0,3778,10991,23124,4925,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,2543,3570,25600,0,0,0,0,0,0,0,0,
+0,0,45317,0,0,0,0,0,0,0,0,19058,0,23429,0,0,
+0,15176,0,42523,39071,16422,24881,31305,3333,44478,0,0,0,0,0,6798,
+0,0,45360,0,0,44062,0,21547,0,0,0,0,23982,0,9839,0,
+0,8346,3963,12477,28956,44011,0,6527,0,25333,0,37819,17899,37587,32895,0,
+0,0,0,19539,0,18750,18757,0,0,13972,0,0,0,0,0,0,
+0,0,37227,48352,0,0,0,0,0,0,0,27136,0,0,0,0,
+0,40070,46152,0,0,0,0,0,0,0,0,0,0,0,0,3644,
+0,0,0,0,36885,4428,7617,0,0,0,11681,10324,0,0,10887,0,
+0,22406,0,0,46445,0,0,0,0,0,46132,46424,0,13612,28573,0,
+0,0,0,42484,0,32991,0,21323,43413,0,35959,0,0,19606,5891,0,
+42130,0,0,0,0,0,0,3171,9431,0,0,0,31860,0,0,0,
+0,0,0,23763,0,0,0,0,0,0,0,0,24100,23572,0,0,
+5763,22423,35242,0,38214,0,0,26742,0,0,16215,42844,0,0,0,0,
+0,0,30084,0,0,0,0,16349,17701,45450,0,0,0,0,0,0,
+0,22442,0,0,0,0,0,0,30151,3976,0,43997,0,0,0,0,
+0,48637,0,0,13788,0,0,36957,0,0,0,0,0,0,0,0,
+0,39468,0,0,12346,39454,0,11930,22371,19129,24903,38945,40570,40408,0,0,
+0,1871,26564,4869,32412,0,0,0,16529,25403,28725,0,0,0,31122,995,
+0,0,0,0,0,0,8434,27196,0,0,0,23155,0,0,27001,0,
+0,24092,31463,20524,0,0,0,24495,0,35124,41902,46174,0,0,0,0,
+0,0,0,0,0,0,38976,23789,0,0,0,0,0,0,3204,11599,
+0,30610,14560,0,33669,47643,0,0,0,0,0,0,0,0,21209,17008,
+0,14105,30311,0,0,5481,30600,0,8179,29385,0,0,0,0,0,28942,
+0,0,30816,29240,0,0,0,0,0,0,0,23233,0,32174,0,36495,
+0,0,0,32931,0,0,8964,33754,45974,0,0,5778,33547,0,0,41061,
+0,42100,0,0,34478,0,2852,33072,44912,0,0,32386,0,0,0,0,
+44595,0,0,18626,0,0,0,22493,41697,36984,0,0,0,0,0,43523,
+16180,10447,24701,20560,31710,47752,48880,0,0,0,23145,38126,14703,0,0,28024,
+0,0,0,0,0,31133,0,0,0,0,0,0,0,0,0,37667,
+14664,0,6078,0,0,0,0,20708,12165,38145,0,0,0,0,6027,21204,
+0,26139,0,0,28494,0,0,0,0,0,0,6137,18359,0,0,0,
+0,0,0,0,0,0,0,0,35379,40125,0,0,0,0,0,0,
+0,31672,0,0,35812,0,0,0,0,0,30705,0,0,4393,6646,35316,
+27663,0,0,46162,0,0,6175,10602,16818,23707,37844,39737,0,0,31907,0,
+35890,37215,17326,0,0,0,22820,2444,0,0,0,0,0,0,29847,30162,
+45969,0,0,12635,29832,48077,6927,25512,0,0,0,32857,0,32335,0,3355,
+8860,40280,43082,46576,47477,7497,47822,0,0,0,0,0,0,36962,0,0,
+0,0,0,0,0,0,0,38902,24045,0,0,22615,46266,0,2620,0,
+0,8222,0,0,0,0,0,13331,42947,0,9088,0,38478,0,0,0,
+0,0,0,13408,20333,9395,0,0,0,0,0,0,0,0,0,0,
+0,0,27090,0,0,0,0,0,0,0,0,0,0,0,16190,0,
+0,0,21846,42993,23688,22331,44512,0,0,0,17359,34290,0,25098,45705,4158,
+7502,19123,0,37392,34418,43422,31356,21427,0,14381,9434,25812,0,0,0,0,
+38064,0,0,0,0,24175,0,0,46172,0,0,0,8729,28577,0,1933,
+0,12422,32546,0,0,0,28584,0,33765,0,3208,22632,0,0,34232,0,
+0,24230,44330,0,0,0,0,47988,0,2882,5026,0,0,0,43264,27314,
+25339,42969,45492,46823,0,12069,15396,24733,26916,0,40007,0,9705,0,9457,45374,
+0,0,45115,0,0,0,0,0,0,0,0,15476,9750,0,0,0,
+0,0,47816,0,0,30577,0,42457,0,0,44328,0,45102,0,0,0,
+38375,0,0,0,29178,27356,12816,11566,0,0,0,6353,25746,23372,0,0,
+0,19986,15863,0,0,0,0,0,15309,32357,20660,3517,0,0,0,0,
+0,0,27477,0,0,26043,0,0,0,0,20527,16639,0,0,0,0,
+0,0,0,8882,0,17668,13588,30808,0,0,0,3715,0,16820,14524,34508,
+48071,0,39701,28394,25166,0,11760,0,0,0,0,0,0,0,0,0,
+0,0,0,0,26434,0,0,0,0,41615,0,12606,0,14191,0,0,
+0,22942,31885,46131,23840,37429,22838,20880,0,0,0,0,0,0,0,0,
+0,0,0,0,39225,47345,36641,0,0,0,34730,0,11614,11639,35610,0,
+0,0,27292,29556,41683,37147,48665,0,0,28881,0,0,0,8333,0,20351,
+0,0,32040,47684,11633,17160,35758,0,0,0,0,0,0,0,0,0,
+25433,0,0,0,0,0,9308,0,0,35317,0,0,5501,0,0,0,
+35664,0,0,1711,31642,33076,29810,0,0,0,0,32750,0,0,0,2592,
+26299,31831,43802,0,0,0,0,0,0,0,2924,20060,0,0,0,0,
+0,0,0,0,0,13002,1492,0,0,3271,46723,0,786,0,0,0,
+36166,37154,0,0,0,0,0,0,0,0,0,0,0,42204,0,18557,
+0,0,27738,29392,36150,37106,3745,35791,40461,0,0,0,0,0,0,0,
+6202,6309,11358,13136,26624,36239,13277,31420,23164,18978,45541,45565,31013,46536,0,0,
+0,0,36791,25388,13571,0,0,0,45588,15889,0,7297,26120,38982,0,0,
+0,25529,35368,3994,6711,7293,0,0,12271,0,41601,30301,0,34376,0,0,
+0,0,0,32418,0,0,0,0,6584,0,0,0,48787,0,0,0,
+0,0,0,0,0,0,0,0,20980,0,0,0,0,8640,0,0,
+18590,2768,45725,0,44586,0,0,0,44334,0,0,0,18232,19388,0,45828,
+22644,32752,1939,0,0,0,42549,0,0,28510,32795,44794,0,0,0,46305,
+0,0,40014,38749,5185,0,0,969,0,0,0,0,0,0,0,0,
+0,26618,0,0,5468,0,0,0,8199,46560,0,0,24305,38413,0,0,
+0,0,0,29380,4986,38030,30138,42108,0,13770,0,0,0,0,0,0,
+0,22334,25198,18840,0,0,0,0,0,0,0,4002,0,542,32156,0,
+16854,0,0,0,41191,0,6270,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,10343,0,0,9357,25864,0,216,7899,18783,21012,0,
+691,9530,6261,0,0,6710,38397,27051,771,40481,0,42431,0,0,0,21866,
+0,0,40663,0,12007,40499,0,0,0,27592,0,0,0,7707,0,0,
+0,0,0,20425,0,0,0,0,0,32251,44559,0,0,24057,34164,0,
+0,14684,11244,7358,0,0,0,0,0,0,9643,17656,27852,0,36991,34498,
+0,22029,0,43449,1076,0,0,0,0,0,0,0,40869,15786,13704,19770,
+0,0,0,0,0,0,18656,1958,4509,0,0,27402,0,0,30447,0,
+38065,0,24834,0,8995,32834,29798,6406,0,0,0,0,0,0,0,0,
+46362,0,0,0,0,0,0,0,12797,24575,0,0,0,12838,27446,0,
+0,26591,2421,33683,31286,38099,0,0,0,0,0,38188,0,177,23620,31542,
+0,34778,0,0,0,0,10348,0,0,24248,0,0,45591,15197,0,5527,
+5499,7947,18421,26208,0,0,0,0,0,0,39966,0,0,0,0,41694,
+0,0,0,0,0,15469,42315,44726,0,0,0,47193,0,0,0,2631,
+19876,27420,33515,35925,32273,32099,39602,41755,0,24880,28634,37193,0,0,0,22867,
+0,0,0,40891,37467,0,14034,19180,18119,23169,0,0,0,0,0,21231,
+2937,7866,25577,31880,0,0,0,0,35686,28841,0,0,20723,47004,2114,0,
+0,9019,0,0,0,3980,0,0,0,0,0,8026,2076,23671,31697,0,
+0,31412,27360,2272,0,0,0,0,45457,0,10613,0,0,0,8824,21041,
+22650,43438,9029,38612,15321,0,29493,23878,39895,0,22672,0,31259,31622,31958,45301,
+36167,12224,26395,33906,14847,0,27817,535,34646,0,0,0,0,0,16858,35996,
+3281,0,166,33433,0,0,0,0,0,0,0,48102,0,0,40285,0,
+23321,26589,0,0,0,8256,5380,32486,0,0,34489,3840,46349,0,0,0,
+0,0,5874,0,17132,0,0,0,7709,0,0,0,9634,0,0,0,
+0,48629,0,0,0,43593,0,34651,38527,22143,42943,0,47259,0,4403,9103,
+39730,0,0,0,0,16282,47977,0,32794,0,0,0,0,40059,0,0,
+0,9669,0,2805,0,0,0,0,0,0,0,0,0,0,0,17766,
+0,16939,0,0,18825,39413,7020,41335,0,0,22224,0,0,0,2691,0,
+0,9305,33374,35464,37928,0,18620,18089,0,24043,40905,0,23774,17557,31047,41718,
+0,0,10345,0,0,0,15085,0,0,0,16494,31123,47113,0,0,0,
+46739,32234,0,41943,46084,20013,0,0,0,0,0,17241,0,0,0,0,
+0,0,0,0,0,0,0,900,0,0,0,0,0,0,0,0,
+0,0,23383,0,0,8025,0,0,0,0,0,0,0,0,34767,0,
+0,0,4737,37761,0,0,23397,35919,0,15258,26210,22724,0,0,0,0,
+0,0,0,11642,0,2420,0,0,9874,0,0,0,0,0,5388,28396,
+0,35788,0,0,8913,3126,0,0,45063,0,0,0,44881,0,0,0,
+0,0,0,0,29586,34968,0,0,1598,39423,0,32610,18686,0,0,4694,
+0,0,0,322,0,0,45850,0,0,0,30308,8468,41560,3482,21987,0,
+0,0,0,46773,0,0,40607,0,0,0,0,0,19797,41940,17442,38556,
+0,0,0,17750,33150,14505,26813,0,0,0,3624,0,0,0,0,1088,
+19099,0,0,0,0,22006,30644,21640,35726,47995,26666,6279,0,0,0,29062,
+0,25687,0,0,0,0,0,8454,25417,41783,0,42277,0,10917,11839,0,
+0,0,0,0,731,27383,18744,46080,0,35865,0,18024,0,0,0,9721,
+24946,34994,608,0,0,0,0,0,0,0,0,15886,0,43148,0,0,
+0,45165,27976,0,0,22913,0,0,0,0,0,41666,0,0,0,0,
+0,0,2795,41301,13797,3959,37357,45962,0,0,0,0,18973,0,0,39483,
+0,23412,0,0,0,0,0,0,36449,0,0,0,0,45440,19889,0,
+0,0,0,29411,6091,0,0,0,6278,28114,0,0,0,26554,42469,0,
+0,28920,3533,37601,27907,24677,40370,0,0,0,0,0,21528,48081,24731,31121,
+0,0,0,38382,0,0,0,20520,0,0,25335,37045,0,0,0,43869,
+0,34140,27627,0,0,0,0,0,0,0,14387,17724,18388,19792,46218,47063,
+14670,6792,44344,0,25683,31544,12138,26078,0,0,0,0,0,41559,34411,47368,
+47790,17732,0,0,0,14658,41549,43511,0,33442,46450,8051,0,0,0,0,
+0,0,0,3389,24862,0,0,0,0,0,0,0,0,0,37875,38198,
+0,20203,0,0,0,0,7123,0,0,0,40272,36471,0,19527,0,0,
+0,0,0,0,0,0,0,0,0,4635,0,0,0,0,0,0,
+0,0,39680,0,0,31359,0,0,0,0,25345,26232,41573,16442,33675,48752,
+0,7345,48668,0,0,0,20119,43685,0,5651,0,23395,0,0,0,0,
+0,22715,0,0,31082,0,21814,0,0,0,19698,0,17064,0,20137,42803,
+0,0,0,0,0,0,0,0,34541,3239,0,0,17440,0,29786,39443,
+0,0,27979,0,0,0,0,0,0,0,0,0,0,0,0,46886,
+0,0,0,0,0,0,29449,0,0,36187,10271,37151,48606,0,0,0,
+0,0,0,45775,0,0,31092,1824,0,0,0,0,0,15297,22888,47205,
+0,0,0,0,0,0,0,29320,0,29,0,0,0,25326,41587,0,
+0,0,0,0,0,0,0,0,0,0,0,38822,0,0,0,0,
+0,39765,0,0,0,0,35929,0,0,38190,17277,0,0,0,0,40193,
+8835,0,0,40132,0,15333,0,11363,44638,0,0,4651,11540,40374,0,0,
+28172,9745,25803,0,0,45963,47891,16497,45697,0,0,0,48351,24757,42676,0,
+0,0,0,36563,0,0,0,0,26298,0,14582,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,1304,41612,4618,0,0,0,0,
+0,2986,0,47036,0,0,0,0,5160,40527,31149,42604,31543,44626,18005,16663,
+48727,0,0,0,0,34391,0,0,0,0,0,0,0,46017,0,0,
+0,0,0,0,0,24914,0,3673,1934,21218,0,0,0,0,6511,45207,
+0,0,0,31599,729,0,0,10597,0,0,13979,0,0,10965,1075,0,
+0,0,0,0,39764,4168,0,2996,0,8899,0,0,0,0,0,0,
+33975,0,0,46607,0,0,42251,0,34072,12034,24715,0,0,86,0,0,
+44343,0,0,0,36509,35988,5144,0,0,0,0,0,0,0,35042,0,
+31295,39470,40854,42630,0,0,39850,0,37865,0,0,3186,43281,5906,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17887,
+18298,47685,0,0,0,0,0,0,25398,40590,46404,0,0,0,19854,26943,
+32777,34709,0,0,0,0,0,0,0,27673,11405,0,35176,0,0,25861,
+42841,0,0,6581,43729,0,0,0,0,0,0,0,27629,11650,0,0,
+0,35199,25884,22641,24356,35212,25786,25215,0,0,33701,0,0,11729,42792,0,
+0,1353,11284,11544,12917,4100,18701,23970,26451,43835,8431,0,0,39834,41899,24871,
+0,0,0,0,0,0,0,0,0,42922,0,5878,18991,24019,0,38927,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,24627,2161,
+0,0,4917,46822,0,0,0,0,14843,0,0,0,16395,0,0,0,
+0,0,0,13431,0,0,0,0,44709,0,0,0,0,0,0,11521,
+0,0,0,0,21682,0,0,0,0,20038,19435,0,8569,0,0,0,
+0,48737,0,0,0,789,10176,35911,0,40876,18733,35780,0,0,0,842,
+13442,0,0,0,0,35439,0,0,11158,38738,0,13149,0,0,0,0,
+0,37054,18822,0,0,0,32838,0,3982,31862,438,0,41399,0,0,0,
+26820,0,0,24556,13856,0,6042,0,0,0,6464,0,25151,0,0,26577,
+0,533,1974,0,0,0,0,0,0,0,0,0,42879,25048,17859,0,
+0,47207,0,0,0,0,0,27346,0,42353,0,0,40198,0,0,0,
+0,27180,0,0,0,0,0,0,18761,0,0,0,0,0,0,31042,
+0,39357,9273,0,0,0,8384,0,0,0,0,41554,0,0,2258,0,
+0,0,0,0,27998,0,0,0,0,30658,0,0,0,0,0,0,
+7907,13857,28099,0,0,0,30018,0,0,44032,0,0,0,947,0,0,
+0,0,0,0,9265,16087,43692,0,0,0,4768,0,3656,0,0,0,
+0,2778,782,0,0,0,0,0,0,38688,0,0,0,12369,13707,7266,
+9792,40995,0,0,0,0,0,35896,45136,0,0,0,0,0,0,18985,
+48709,0,0,5900,31680,0,0,0,19259,0,14876,12524,0,0,1188,41604,
+28904,22677,37322,0,0,0,0,0,0,0,0,29904,0,22576,27026,22286,
+26767,0,0,45468,0,0,0,0,0,0,0,0,32262,0,0,0,
+47057,41820,0,14186,43963,7974,8080,0,0,36462,11847,0,0,0,27693,0,
+33622,0,0,0,0,0,0,29362,0,0,10590,0,0,0,0,14260,
+0,23939,39759,0,16886,0,33860,0,0,0,0,0,0,0,0,13030,
+38828,47669,28701,0,0,30133,47963,0,31220,0,0,0,32347,13301,0,0,
+0,40617,48244,39804,20201,0,0,15308,19807,0,0,0,0,0,41749,0,
+0,0,0,3837,13828,0,0,34133,0,0,0,5665,0,0,42004,0,
+0,0,0,0,0,0,36092,2179,0,0,0,4604,0,0,6670,36898,
+0,0,11518,42245,0,7962,11915,22725,6737,0,0,0,0,0,7951,0,
+26771,0,19343,0,0,0,0,12657,29286,0,0,33589,20884,0,37905,0,
+0,0,0,0,0,0,0,0,0,26427,27433,34239,0,20262,647,8858,
+0,0,12109,20650,0,3446,0,0,37753,0,20295,0,0,41227,0,32122,
+0,0,34169,0,0,0,0,0,0,0,0,25027,25724,0,15705,0,
+0,0,20642,0,27863,41169,0,0,0,0,0,16780,0,16312,0,45322,
+0,0,3459,14525,39716,25040,0,0,26935,0,0,36506,9274,11977,31061,33193,
+0,5725,6956,0,0,11708,0,11752,0,0,0,0,6912,0,20496,0,
+0,0,40661,36775,0,0,41140,0,0,23901,0,0,0,36878,0,0,
+0,0,0,0,0,0,5601,0,0,47447,0,0,0,0,27168,34261,
+0,0,0,0,0,5221,0,0,22049,0,0,0,21229,0,25736,0,
+0,0,0,0,5978,17405,38039,31137,18310,0,0,0,2096,0,0,0,
+0,17787,23273,0,0,36069,0,0,0,0,26725,0,0,10737,7202,35849,
+0,0,0,6728,45487,0,0,29394,24651,0,0,0,14284,0,0,0,
+0,0,40694,0,17989,0,0,0,0,0,2885,47704,28376,12852,0,25563,
+0,0,0,20588,0,0,0,0,0,0,0,0,0,0,0,8354,
+46229,0,16198,1888,1555,17909,6804,12676,27622,30918,31009,39192,0,0,0,0,
+468,45004,36503,21028,41827,0,0,0,5015,38867,0,0,13891,38081,19313,46209,
+0,24579,20152,0,0,0,47146,42067,0,13743,0,0,0,0,0,0,
+0,36415,0,0,0,0,0,0,0,0,0,1989,3676,0,0,10709,
+12511,34783,40957,0,19538,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,38254,48221,48799,0,0,46416,0,0,41217,36310,2767,
+0,0,0,21380,41842,0,0,0,0,0,0,2040,0,0,48552,0,
+0,0,0,0,0,0,22540,0,19087,0,0,30799,0,42240,0,0,
+11900,28026,32821,37783,36754,0,0,6390,26446,0,0,18980,0,11396,0,0,
+23855,42073,45831,17129,0,0,12881,21352,29787,0,0,0,0,43074,0,0,
+45823,19104,0,0,0,5926,42868,0,27294,0,8251,1539,0,0,0,0,
+0,0,0,0,0,15918,19326,31469,0,0,0,26900,0,27804,0,0,
+11422,0,5321,0,0,0,0,0,17637,25568,33752,0,0,0,39433,34919,
+0,0,0,41810,12975,0,0,0,14642,16546,39169,47273,0,0,0,0,
+0,2029,0,5014,0,0,0,41528,0,0,0,0,0,0,0,40615,
+18150,0,0,0,17252,7319,0,0,0,0,0,0,0,22139,0,0,
+0,0,0,0,12000,0,29179,1234,8278,32226,7290,0,19624,0,42083,0,
+0,0,0,0,37831,0,0,0,34385,1890,0,0,0,7801,0,0,
+0,13919,0,0,21823,0,0,0,0,0,0,33893,45935,0,0,28332,
+48407,24700,0,0,8709,0,0,0,0,0,0,0,3235,31175,37824,41462,
+0,45893,0,10389,17433,0,0,0,0,0,0,0,0,0,0,12666,
+0,0,0,15941,0,0,24352,0,0,0,0,22312,35192,7192,39039,0,
+0,0,0,0,0,28497,0,0,0,46745,0,43288,26137,21857,0,20541,
+0,0,0,0,13322,0,30032,0,0,2415,40861,0,0,19592,999,0,
+31188,24708,0,0,0,0,25965,32459,37317,0,0,0,31074,0,0,0,
+0,0,30511,0,0,0,12582,24772,0,25940,0,0,0,25224,32052,0,
+24769,0,6955,9635,0,0,0,0,0,0,48451,0,0,0,0,3421,
+0,0,0,0,6547,0,44157,0,0,0,0,0,0,45837,0,0,
+0,0,39583,8773,0,33644,12568,20899,0,0,0,0,0,0,0,13556,
+24095,47768,0,0,0,0,0,0,0,0,0,0,0,0,24365,0,
+7305,9427,9625,0,9653,0,32095,32268,40311,40773,0,29587,34779,43573,0,16975,
+0,0,0,0,0,0,0,0,0,0,25988,35553,44046,0,39484,28004,
+7916,42369,0,0,0,0,0,45283,0,24810,48238,14609,46630,5334,0,0,
+0,0,11554,0,0,0,0,39584,44693,34873,12348,0,0,7139,9756,18053,
+0,32148,0,37034,41649,0,42974,0,15928,0,0,0,19612,34417,0,0,
+0,43878,31920,11109,0,12381,0,0,0,0,24905,0,0,0,0,15513,
+0,0,33823,0,0,0,0,5890,44485,0,0,0,0,0,39997,42323,
+0,29120,14536,34366,25455,0,9600,12235,15910,20956,0,0,39556,0,0,0,
+41425,0,17547,0,0,0,0,0,1185,0,10162,5453,0,25230,0,0,
+0,27644,0,0,17307,45762,0,0,0,0,3391,6493,14758,0,0,0,
+0,0,0,0,0,36631,17363,17237,38874,0,37272,0,21105,44418,28981,0,
+0,0,41670,41733,0,31786,20918,36956,0,0,0,0,0,16222,0,20895,
+44064,0,15128,15083,0,0,0,0,0,5136,0,0,0,21513,24752,0,
+8089,0,0,0,0,28447,0,38603,0,0,10791,0,0,0,0,22292,
+33066,0,0,557,23495,27730,39509,0,1219,0,7321,0,35210,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,19526,0,0,0,
+0,0,0,37807,38233,44267,0,0,0,0,22660,0,0,0,0,0,
+41569,0,0,43580,0,0,27191,0,0,14679,38654,0,0,0,0,4154,
+0,0,0,0,7726,6683,5270,27230,0,1826,0,0,31607,0,27074,0,
+0,46203,4621,0,22128,26940,0,0,0,1859,0,0,23258,0,0,23020,
+1258,0,0,0,20440,0,0,0,0,0,0,0,0,0,0,0,
+0,0,3753,41616,0,0,38270,0,0,8585,0,28245,0,0,16207,0,
+0,0,0,30853,0,167,0,5932,7770,9394,24934,39929,0,0,0,44145,
+0,10065,0,24133,0,4846,43556,0,0,0,0,18785,24410,0,0,0,
+4682,0,0,0,0,0,4992,5853,0,0,0,35595,46742,0,32155,36240,
+37296,39604,0,0,0,0,0,0,0,0,0,22304,45320,0,0,0,
+0,0,0,0,0,0,2749,27783,17861,46497,0,0,16042,0,0,0,
+0,0,0,0,0,0,0,11193,41196,5272,0,0,0,0,37300,0,
+0,25618,32197,8152,3642,11084,0,0,0,30972,34110,0,0,33626,0,0,
+14605,2293,31893,12714,36345,10532,36454,0,0,0,0,0,0,16277,36237,0,
+0,14209,0,44929,0,0,0,3936,7198,0,5512,39205,0,0,38679,47753,
+0,0,0,0,0,23655,45911,16518,14344,29870,40851,25591,24470,0,32820,0,
+0,0,0,10757,11286,19952,32096,37267,0,0,0,0,0,0,2959,0,
+0,0,0,0,0,0,0,29800,46602,39008,0,11866,14772,44871,0,0,
+0,0,19297,0,0,20135,0,0,0,43892,36777,0,0,0,0,32125,
+0,0,0,7580,0,0,0,0,17173,20059,0,0,0,0,0,0,
+272,13845,0,0,36233,25677,0,0,0,48867,0,0,0,0,0,0,
+0,0,5139,22538,0,35094,43041,0,0,0,0,32506,0,0,1392,0,
+0,0,0,0,0,0,14219,48715,0,0,0,0,9767,0,0,0,
+18949,41223,78,0,3209,33566,22400,48292,0,0,0,0,0,22281,0,28732,
+0,0,0,0,0,0,3351,16337,10178,0,32641,47745,0,0,0,0,
+39175,0,0,1276,43375,0,0,46344,0,23526,14002,0,0,15071,40689,32753,
+9543,44909,0,0,0,0,0,0,0,1343,29064,0,0,0,0,12873,
+48729,0,0,0,0,12074,0,26617,34543,0,25729,0,0,0,0,0,
+2181,18419,0,0,0,25534,41552,13448,21179,43786,0,0,24711,44789,0,0,
+30850,0,7529,0,0,25300,0,0,0,43260,0,31529,0,0,0,0,
+1149,0,0,0,0,12162,14770,5815,17367,0,0,24367,33285,0,0,0,
+0,31070,0,0,34165,0,0,29911,2018,45723,48336,0,0,0,38455,0,
+24567,46713,0,0,0,11510,0,16720,0,0,0,0,30124,0,0,28342,
+5556,0,14665,0,0,22360,0,0,0,0,24199,0,30463,26423,45179,0,
+0,0,0,0,0,0,20782,18831,6501,16384,27529,48191,45171,0,29498,0,
+0,0,0,47408,0,18885,0,35837,0,42624,0,0,37391,0,26908,8922,
+39036,2095,11705,0,0,0,0,0,0,1345,10721,11195,33521,0,3864,38282,
+0,0,0,0,0,0,0,0,0,0,0,17236,0,19128,0,0,
+43953,0,0,12493,11188,0,20543,30887,0,0,0,0,0,15265,0,0,
+0,0,39018,0,39028,26356,0,307,0,0,13129,0,0,0,8855,9295,
+0,0,0,0,0,12939,9296,30499,0,0,0,10056,6024,9884,0,0,
+0,0,29916,0,0,25916,0,0,0,0,35554,46177,0,3762,13889,42642,
+0,0,0,44593,0,0,0,0,42434,0,41505,12544,42574,0,0,8167,
+0,0,8573,38118,0,0,0,0,0,752,9490,0,0,563,2571,17060,
+37621,0,0,25788,0,40782,40677,0,0,0,37287,0,14580,16020,0,20272,
+28876,0,0,0,0,0,0,0,0,35447,0,34686,25145,31007,46718,0,
+0,27941,33724,0,9774,0,2601,10949,0,0,0,33431,0,0,0,0,
+0,30249,0,0,0,0,27638,0,0,0,0,0,0,0,7480,31585,
+0,0,0,0,0,0,0,44372,0,48777,0,0,0,0,0,36732,
+40937,21048,0,0,39117,0,0,0,23172,9880,0,0,6941,0,39049,0,
+0,0,0,45181,0,0,0,0,42076,0,0,0,41145,0,0,0,
+0,8122,45281,0,30596,0,0,0,0,31260,15868,8211,12245,13983,45878,0,
+0,0,13094,25220,39369,0,0,0,23024,0,0,23709,32224,0,0,712,
+43038,39493,0,0,24221,0,0,0,0,0,0,0,44272,4550,46900,0,
+0,0,19515,0,0,34668,0,0,0,0,0,0,17890,0,0,0,
+0,0,25473,0,0,12572,0,0,0,0,0,0,30221,0,0,10001,
+7263,36098,0,0,0,0,0,0,0,0,33272,0,15069,20367,32627,35785,
+18881,18945,31320,43860,0,0,0,0,0,0,7900,0,45341,26432,0,0,
+30374,0,10901,8269,0,45711,46169,0,0,0,0,0,0,0,0,0,
+32186,10401,35706,0,0,1899,10810,0,0,17468,0,0,12966,0,0,0,
+0,0,1224,11775,29813,10944,45844,0,0,0,0,9734,0,26801,0,23873,
+0,10301,0,0,44646,0,8984,0,0,0,21620,42597,0,0,0,0,
+6665,22594,33963,36114,46185,0,0,2821,11497,13194,25781,19541,33550,34076,24547,37641,
+41394,34834,44264,0,21924,0,0,0,0,25400,0,0,0,0,0,0,
+0,0,0,0,0,0,0,25904,11974,26409,0,0,0,20368,24033,39103,
+0,0,0,0,0,0,0,0,6822,5374,15883,0,43687,1581,0,28775,
+0,0,0,0,32978,17419,0,0,0,0,0,0,4130,38316,35328,0,
+0,0,0,0,23292,0,43984,12824,0,0,0,0,0,0,0,3004,
+5485,8117,15255,15231,6344,23343,41117,0,0,0,0,0,0,9212,0,0,
+3217,0,0,0,0,13549,29477,2402,40127,41845,0,22697,1996,0,0,0,
+12216,0,0,0,0,0,0,0,0,35859,8115,6048,11,20000,9864,30970,
+4984,14156,19067,30561,41038,751,15745,36439,48685,1456,29238,10701,0,0,0,17923,
+3041,0,29601,31101,28124,33907,43399,38218,14982,0,0,0,32451,0,0,0,
+0,0,0,29273,0,0,34137,0,6266,0,14424,28361,38086,0,29302,17395,
+0,0,8123,40401,42404,38029,0,0,32324,0,0,0,0,0,0,37720,
+19471,0,0,46615,0,0,0,11734,45029,0,28448,0,0,0,0,15250,
+0,40232,13482,219,0,0,44178,0,35641,0,0,34185,0,0,0,18687,
+19289,0,25055,0,0,0,0,0,15481,0,0,1617,16371,0,0,0,
+32717,22336,0,6674,0,0,0,19389,17773,37089,0,0,0,0,0,0,
+499,37618,28323,43374,0,5622,16382,39767,0,0,0,0,14124,0,0,16245,
+0,0,26046,31125,34422,47952,0,0,0,21382,42640,0,0,0,0,0,
+0,21859,0,0,0,0,0,0,0,1355,0,21360,0,0,0,3717,
+0,0,37247,0,0,0,0,0,0,0,0,0,0,34560,3133,22046,
+0,0,383,14020,0,0,16278,0,0,23560,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,15706,0,0,0,
+15014,36820,0,31799,0,0,0,28687,38938,0,0,0,0,0,22254,0,
+3340,0,0,0,0,0,0,0,0,0,0,0,38091,16214,1912,36390,
+12888,33821,38051,9629,0,11067,32582,0,0,0,0,0,0,15423,0,0,
+0,0,0,25376,0,14400,0,0,0,26036,0,0,9445,530,9060,11439,
+12741,39934,0,0,0,19977,20299,30391,0,0,0,0,29804,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,42554,0,9333,17418,
+0,0,0,3938,0,0,15151,0,0,45137,24254,0,34838,11261,0,0,
+33475,25835,11943,6312,42003,0,0,27550,0,30027,42694,0,0,0,0,15196,
+0,0,14961,0,0,0,0,5931,23374,32861,0,0,9614,30504,34053,0,
+0,0,0,0,4836,0,0,45087,0,11318,32479,0,0,0,0,0,
+0,0,0,2365,0,6237,300,0,0,0,21303,0,0,0,0,19705,
+9261,36507,0,42072,0,14800,0,0,0,0,0,0,0,24005,14539,0,
+0,0,0,23249,5231,25191,41468,0,0,9781,11582,0,0,0,0,0,
+0,0,10681,0,0,0,366,0,0,0,12091,0,0,0,0,4556,
+0,0,5122,0,0,0,0,30903,0,8603,0,0,16534,38243,44580,0,
+0,0,0,0,0,2553,0,0,0,0,14032,0,17649,6296,24966,29808,
+28565,0,4519,16724,0,6541,0,0,38770,14593,0,32571,0,0,35213,0,
+4039,0,0,3792,24200,26696,30344,0,12625,13991,30765,0,0,42919,45426,21372,
+0,0,0,0,0,0,0,0,21652,0,0,0,31308,0,0,0,
+30210,34209,23722,0,0,0,0,0,0,0,46680,41515,0,12528,0,0,
+17815,0,24432,0,35028,41958,0,0,0,9813,0,0,0,0,44711,0,
+0,0,33670,0,0,0,0,0,0,0,0,0,10454,0,36097,0,
+0,0,0,0,6862,0,0,0,0,0,23449,0,0,0,0,2857,
+12420,0,0,0,0,0,0,0,0,0,0,17592,18843,11252,21738,14576,
+38973,0,41291,0,13250,47615,13313,41985,825,6181,0,0,47999,38226,0,0,
+0,0,0,0,39757,0,0,0,0,0,30343,0,0,41469,0,0,
+24526,48672,0,0,12831,33512,0,0,0,0,0,0,0,0,0,0,
+0,24783,42117,0,0,34585,0,0,0,3562,31698,48889,33149,0,0,0,
+35840,0,0,11894,37528,0,10485,0,0,31985,7756,39795,0,0,4225,0,
+28744,38911,0,18293,0,41198,0,24753,47657,10379,0,0,0,0,0,26988,
+0,16225,6669,4514,17532,25318,28551,30403,0,0,0,8151,0,29988,0,0,
+22205,27390,37189,40341,0,0,0,0,44371,19114,17600,25045,33274,0,27311,46922,
+0,0,17647,0,0,29213,0,0,0,5965,11579,14041,24101,32695,35277,0,
+0,0,25588,0,41240,0,11811,0,0,0,5532,0,0,33897,0,33382,
+0,0,0,0,0,0,0,8911,0,0,0,40234,0,0,16813,31154,
+0,36186,31632,17213,11433,34338,0,19440,39531,0,0,0,0,0,0,45791,
+33998,0,13273,0,0,43773,6357,0,0,25541,41093,46092,951,22309,33786,30757,
+43645,0,0,0,46906,0,36206,0,0,0,0,16496,0,15335,47873,17771,
+0,45194,44601,0,0,0,0,0,0,403,6358,0,0,0,28628,0,
+0,1932,17900,23176,29937,46289,0,0,16344,0,0,0,7696,22186,34722,37127,
+0,0,0,34987,48016,43387,0,0,0,2259,0,26329,37356,0,25448,0,
+0,0,30176,0,0,33296,0,35984,47467,0,0,32299,0,0,0,0,
+0,11765,0,0,0,0,0,0,0,0,0,0,0,0,0,39947,
+34939,0,0,0,0,0,0,4461,0,24208,0,0,0,0,0,0,
+29820,0,26746,0,16698,0,47501,26834,11082,0,43885,14438,0,21291,0,0,
+41814,29926,0,0,0,0,0,0,0,0,0,0,0,8719,0,9998,
+0,0,0,0,28595,5790,1861,37853,31643,0,0,38882,0,0,27492,5707,
+15015,15432,21233,0,0,0,0,389,0,0,0,0,18289,38986,0,0,
+0,18318,0,36121,0,0,0,28223,23758,0,0,0,16743,0,30491,0,
+48342,0,0,34436,0,20887,24540,38571,33570,10246,3880,0,0,16796,26277,0,
+12164,0,0,0,0,0,0,0,0,0,0,0,0,31695,3725,35145,
+0,0,0,0,15818,0,0,2731,16416,35437,43087,0,18889,37055,0,0,
+19235,45985,0,8367,0,17737,0,0,0,0,7927,0,0,0,0,0,
+34040,0,38783,0,31276,0,0,0,0,46558,41026,0,0,0,0,4372,
+48036,0,0,39750,0,0,0,0,42536,39990,63,0,35152,41535,0,0,
+35646,27441,0,10610,10586,29930,0,0,0,0,0,0,1466,0,0,0,
+5593,2704,33310,40860,0,0,22871,0,0,9518,12077,0,0,0,0,0,
+0,0,0,0,0,0,0,3975,32499,0,0,0,0,0,0,0,
+0,0,48127,0,0,0,7070,9776,0,16456,14898,12580,0,0,0,35598,
+26007,31497,32411,33013,20163,33424,34583,0,0,9129,899,4754,6117,15006,37379,17962,
+0,0,0,0,28717,1202,44765,0,0,0,0,0,0,0,822,0,
+0,0,11792,29826,21121,0,0,10748,0,14319,11186,44550,0,0,39448,0,
+5686,42533,0,0,0,9802,16747,19505,0,0,0,0,0,0,0,0,
+0,21795,34817,0,0,0,0,43487,0,157,0,0,0,0,0,0,
+0,0,0,0,0,41410,0,0,0,0,0,11173,26091,28374,44198,45975,
+18936,46442,22233,8175,34349,20885,11782,0,10849,47553,21988,0,28437,43160,0,0,
+0,9692,24431,0,0,0,0,0,0,13371,0,0,0,3223,14452,2125,
+18542,38860,20068,39944,8666,33469,0,35384,0,0,45397,0,0,0,0,0,
+0,42040,0,38811,14741,0,0,13870,0,0,0,0,31545,35891,5030,18625,
+19042,47231,0,0,0,17935,44629,0,0,0,0,39201,42275,0,0,0,
+0,27537,0,0,0,0,0,0,0,0,0,71,0,0,0,41567,
+0,0,0,4321,16108,16250,48810,0,0,0,1853,0,0,47892,3043,0,
+0,0,0,0,0,23736,0,0,0,0,0,0,0,0,0,37820,
+0,0,0,0,28574,0,0,0,0,0,0,0,0,835,4726,0,
+0,0,17291,0,0,0,0,0,0,24271,42500,0,0,0,0,36795,
+21973,0,48106,0,0,0,0,0,26656,38396,0,10856,0,0,0,34393,
+0,3018,0,0,0,0,40870,0,0,6641,32124,25841,39675,44023,0,11598,
+35057,0,0,0,0,0,0,0,0,16571,0,0,0,0,0,6848,
+0,4228,36256,0,0,0,1804,0,0,0,0,0,0,0,6708,0,
+0,0,0,43763,42006,36461,42525,0,14967,28499,32819,45527,47606,48045,0,0,
+0,0,46704,16142,6564,25711,0,0,12730,21251,0,0,40883,0,0,0,
+9638,0,0,0,22130,0,13774,0,36709,0,0,0,0,0,0,34666,
+0,0,0,0,0,46801,0,23540,7723,0,0,0,3573,0,0,11842,
+4434,0,0,45066,0,0,0,0,0,0,0,0,0,0,0,0,
+20221,39186,19300,29935,30528,12116,0,0,0,0,0,0,3537,0,0,0,
+0,0,0,0,0,9808,26292,0,0,0,1024,8980,0,3798,0,0,
+0,0,0,16781,20506,27142,0,45491,31627,0,6345,218,0,43165,0,21693,
+22484,27873,30354,0,0,0,34906,0,0,0,0,0,0,32632,0,0,
+0,14721,17044,23268,10390,32316,37862,0,41221,9876,45540,10229,2098,16516,28356,34339,
+0,0,28254,0,0,0,0,33429,0,0,39632,0,45663,0,0,0,
+0,20206,0,0,6797,0,0,47023,0,0,0,5259,9488,0,0,0,
+0,28614,0,0,0,15487,0,0,0,5947,43273,35045,939,16403,6029,22708,
+8606,33898,48769,0,0,0,0,0,0,0,0,7474,0,0,0,0,
+0,1321,0,0,28019,0,0,0,0,0,1753,5768,6032,16936,0,0,
+0,0,0,0,0,0,0,0,0,0,24315,0,0,0,0,484,
+0,0,0,0,0,12758,0,33565,40558,40881,3807,31810,11810,0,0,9977,
+13644,0,0,0,31126,33017,36611,45381,45747,0,0,0,39267,32334,43325,0,
+0,24065,22796,15833,9067,13501,24178,0,0,20405,31272,0,0,0,0,0,
+7932,42114,0,0,205,13201,0,0,0,0,0,0,0,0,0,0,
+34390,0,0,4353,0,21803,0,0,19285,1724,0,0,0,0,24049,0,
+18913,44947,19086,4095,6703,36501,0,0,0,0,0,5309,0,8395,0,0,
+4018,44434,0,4851,36805,0,0,0,0,0,0,0,39582,5729,12333,47903,
+48001,0,32489,0,0,0,0,0,0,12769,0,19269,31847,0,0,0,
+32943,4690,9206,0,0,1420,18199,26768,28741,0,0,0,22602,0,0,0,
+26160,43539,0,0,0,0,43202,0,0,0,0,0,0,0,0,1957,
+24477,27424,43636,15546,2408,26152,34535,0,0,0,0,0,0,0,26816,45650,
+24636,5033,32465,36075,41136,46099,0,0,0,0,25984,0,0,0,38842,0,
+0,0,8236,0,0,0,0,12759,39268,6401,0,0,0,0,0,229,
+5823,20451,0,0,0,0,0,0,0,0,0,10219,0,31120,0,0,
+47724,0,0,0,45277,0,11081,0,0,0,2597,6694,3237,0,0,0,
+43861,17587,0,26066,0,0,0,0,36883,0,0,0,0,0,0,0,
+0,3269,0,0,35799,0,0,22432,0,48697,30102,0,0,0,0,0,
+0,0,0,39741,0,0,12856,0,1667,0,0,0,0,1915,1089,11481,
+19696,0,45192,0,34895,41340,0,0,0,0,15394,25204,19334,0,0,0,
+27141,0,0,0,0,0,0,0,33920,4568,0,19827,0,4253,2367,41864,
+0,8188,0,14467,0,0,1625,0,0,0,0,0,0,0,0,0,
+45416,0,0,15529,41602,0,0,0,12329,0,0,0,0,0,0,0,
+0,0,0,27449,7949,0,10504,0,9637,0,0,33448,0,0,0,0,
+0,20528,242,0,0,26721,0,44691,0,0,0,9542,0,10997,28235,40838,
+27564,36004,47856,0,19806,0,0,45559,0,0,25992,31093,0,0,0,23078,
+0,0,0,0,0,0,7914,0,0,42560,0,0,0,15673,0,36749,
+0,0,0,29328,11290,0,0,0,0,0,21664,11724,0,29115,0,15570,
+32462,38953,0,45393,0,0,0,0,48706,0,0,278,19894,10486,0,12609,
+0,31169,0,0,18304,10478,0,26874,0,0,26116,44350,0,0,16787,0,
+35281,45284,12627,0,0,0,37010,0,0,0,15424,0,12800,29617,0,0,
+0,1124,26698,18381,38394,0,0,3841,0,0,0,32951,0,35713,0,0,
+0,0,26194,42035,0,14416,4756,36479,0,31624,41384,0,0,29117,0,35528,
+0,0,33199,15127,0,8294,43428,14415,0,30612,0,0,0,0,0,0,
+0,0,22039,0,0,0,0,0,35714,0,0,0,0,42717,0,0,
+14296,0,0,0,5612,0,33964,7525,47534,0,0,0,17501,0,23049,0,
+0,30964,0,0,0,42101,8918,0,0,0,21774,0,0,0,0,13119,
+44152,0,895,0,0,0,0,13873,0,0,0,0,0,14366,0,0,
+0,16452,0,0,25797,1914,20923,22924,0,0,0,0,0,7351,24244,15791,
+29960,43215,0,13443,11647,0,0,23691,0,41548,0,0,3724,7064,0,17069,
+0,42521,0,0,34437,0,0,0,0,0,0,35573,0,0,0,0,
+0,6497,4409,0,0,3417,0,11468,13140,0,0,0,0,0,46260,0,
+0,0,1554,11948,29891,22807,27615,0,0,38922,0,0,0,0,20548,0,
+13555,0,0,18604,30452,0,0,0,0,0,1121,0,38347,0,0,33204,
+0,0,18247,39529,0,0,0,29253,0,0,0,0,27017,35270,0,0,
+0,0,0,0,0,0,0,0,397,0,20991,19339,31608,33011,19642,45987,
+0,0,0,0,16910,0,0,0,35694,0,0,0,0,0,0,18988,
+48505,15695,0,8118,28349,0,20335,32137,43401,0,0,26862,0,0,0,0,
+0,0,27559,36045,44108,0,0,0,0,0,1489,5514,0,0,30626,0,
+26897,0,18989,47767,0,0,0,22127,0,38398,0,46321,0,0,0,0,
+0,4059,0,0,38359,0,0,0,0,15711,37774,0,0,0,0,6890,
+42316,0,37851,0,19826,0,36776,0,0,634,0,0,17148,0,0,0,
+23842,32965,0,14764,0,0,0,33029,0,13494,0,0,0,0,0,35622,
+0,0,0,5271,0,0,0,0,0,0,0,4858,33785,0,37562,29418,
+26687,22758,29811,21393,31203,0,0,15729,28489,16369,48116,48599,10018,48698,0,0,
+4044,277,27605,0,48214,6377,0,0,25112,0,0,0,0,33449,0,22465,
+0,0,0,0,0,0,0,0,0,0,33430,0,0,0,0,18338,
+0,42336,0,9236,0,0,5314,35260,0,0,39951,0,0,42488,0,0,
+0,0,3037,36294,0,0,0,0,0,0,0,0,27209,0,6364,7585,
+3572,36033,0,0,0,0,0,0,9858,0,24693,0,0,0,38374,0,
+0,29717,0,47210,0,13032,0,674,37336,12897,0,0,0,0,0,0,
+28255,0,23536,0,2395,0,16823,0,30544,0,0,0,0,0,0,0,
+0,0,48000,0,0,0,0,6163,31459,0,0,0,0,0,0,17169,
+31890,48869,15721,0,0,36720,0,0,13169,11404,0,0,32634,0,0,0,
+15699,0,0,0,0,2394,43340,0,0,0,0,35002,28362,0,0,19264,
+0,0,0,0,0,47700,0,0,14627,0,48583,0,0,15108,0,0,
+0,0,0,0,0,0,0,33696,7636,20540,27204,33734,10544,0,30066,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,7068,0,7906,
+0,7499,18655,27850,0,0,16401,20620,29969,0,0,0,3399,41433,41865,13130,
+14165,15159,0,0,13154,0,0,0,0,0,0,0,0,0,0,0,
+0,0,12349,12967,20274,17589,20544,35581,46167,3733,0,0,40250,23029,0,0,
+0,0,0,22119,0,0,12552,0,0,8417,0,0,0,0,190,47343,
+0,0,1636,38048,8147,21052,14848,21644,47551,0,0,0,0,15248,0,0,
+35975,1819,9201,22801,7690,0,29096,14992,0,1755,10075,35204,29915,48662,1591,0,
+0,0,17452,28204,0,0,0,15060,0,0,0,0,0,0,30178,0,
+25120,0,0,0,0,0,48595,2751,34287,0,0,0,0,10896,0,4727,
+0,0,34431,0,0,0,0,0,0,0,30479,0,0,0,27546,39797,
+0,0,0,0,33955,16712,23936,34501,0,0,0,0,0,0,42648,0,
+0,0,0,0,0,16551,0,35264,0,0,28529,0,0,0,0,38616,
+0,0,0,33245,1402,0,0,0,0,17984,23896,0,48607,0,0,27323,
+0,0,0,0,0,0,16917,15269,0,0,0,15143,24337,0,0,28813,
+48798,0,0,0,0,0,0,0,0,7093,0,0,0,33819,0,0,
+0,0,0,247,0,0,0,0,0,0,12022,0,8399,40910,5085,45007,
+45989,0,3262,36609,0,18358,0,0,0,0,21192,29579,20904,39729,0,37303,
+32815,5533,43330,0,30550,9498,0,0,20025,0,11684,7210,0,0,0,0,
+0,0,0,0,0,37882,34442,0,0,0,0,0,0,31604,0,0,
+0,0,0,37908,0,0,0,0,2366,25511,0,0,0,0,0,0,
+0,3922,39644,0,1997,0,46812,0,0,0,0,4122,19893,46094,0,44872,
+0,0,0,0,0,5930,47991,0,0,0,0,29643,0,0,0,31357,
+0,0,0,11717,12953,36080,0,18653,1830,0,7838,0,0,0,0,0,
+0,0,41874,0,14250,12510,19763,36729,0,31063,0,0,0,41421,0,0,
+0,10936,12658,35481,24026,0,28873,0,0,0,2750,41307,0,30336,0,18471,
+0,22179,0,0,0,29463,15959,0,29608,15948,38255,42891,45806,0,0,0,
+9447,0,10558,15336,47427,0,0,3474,0,0,0,10436,11486,0,0,0,
+0,0,0,0,0,0,44038,1036,0,0,0,0,0,0,0,0,
+0,0,29677,41521,45083,553,0,0,0,856,23562,44952,0,30113,0,0,
+0,0,0,0,0,0,44868,0,0,0,0,13518,0,0,0,0,
+47176,0,0,0,5213,19554,22362,0,0,2260,0,0,46047,0,12400,31407,
+0,0,0,0,108,2904,7109,26953,39979,46496,0,0,19331,19419,0,17302,
+23765,33120,34099,8328,0,0,0,22447,7890,0,46919,0,0,0,25693,46329,
+0,47153,0,0,0,34446,41337,46159,0,708,0,0,13330,0,0,0,
+0,12463,4209,0,7714,0,18555,28052,0,0,14283,12972,0,8965,0,0,
+0,0,15443,0,39690,0,0,0,0,0,0,0,0,0,0,0,
+0,8682,7983,22258,0,6524,0,6801,25664,0,0,35964,0,0,0,0,
+37970,0,4479,14414,0,7392,0,0,0,0,0,0,0,42770,20072,0,
+12040,0,0,17195,0,27867,0,0,0,1073,0,0,0,0,0,31488,
+36481,0,10753,0,0,34281,4815,0,0,30937,0,0,15198,0,0,0,
+0,0,0,0,0,17104,0,0,0,0,32796,13413,17098,33968,0,14598,
+27338,0,0,0,6709,15341,35268,41059,0,0,0,41299,29374,0,0,23114,
+0,0,1158,0,0,0,6617,0,40968,0,0,14909,22593,38194,0,0,
+0,0,39776,0,0,0,4695,0,12984,44763,32440,0,0,0,0,38723,
+0,0,0,0,0,0,36242,0,9209,0,0,17535,32867,23301,41542,0,
+0,0,0,0,0,44957,0,0,17485,27598,0,0,0,0,0,0,
+0,0,0,0,9793,0,0,0,0,0,0,17933,0,0,0,0,
+0,0,0,32505,0,1261,0,0,0,7076,0,39649,35480,0,0,0,
+0,17813,0,0,0,0,0,18787,0,0,0,0,0,0,0,0,
+0,38178,0,0,0,0,0,0,8989,47220,0,0,0,8014,5832,5703,
+17413,32556,13077,0,0,0,0,384,0,0,0,0,0,45757,0,0,
+0,0,0,0,0,0,23319,0,0,0,0,0,0,10961,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,42325,43980,0,0,
+25859,9361,0,0,0,12734,48185,0,0,13391,0,0,0,10621,0,0,
+0,13787,43536,0,0,0,0,0,0,0,0,37699,0,29180,1805,43115,
+0,0,0,29192,27339,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,9229,0,0,0,16159,40678,0,0,0,0,0,
+638,0,0,0,0,30377,0,0,0,0,49,0,0,14417,0,41304,
+19145,43567,2748,8931,0,0,0,0,2637,26786,0,0,24378,0,0,0,
+24091,11354,0,6090,0,0,0,0,0,0,35402,35627,5885,15455,39622,14367,
+0,0,12586,0,21508,0,0,0,29288,0,0,0,0,14808,0,43371,
+0,0,0,0,0,39744,46830,0,0,0,0,0,38611,0,29250,2035,
+25324,29506,8947,32188,33923,36840,37972,19299,12543,28795,0,6655,24240,32362,47689,0,
+19768,30852,0,8928,0,24646,8307,46370,0,37675,39539,0,0,0,0,4042,
+10409,0,0,0,0,13021,18952,28371,45053,26399,0,0,0,0,0,0,
+0,0,0,37696,0,38672,0,0,0,37611,0,18722,40136,0,3082,0,
+0,0,0,0,0,43706,0,12607,46807,0,0,0,0,9350,15436,0,
+0,0,0,17931,0,0,0,0,0,0,0,0,14190,0,20383,40712,
+0,39226,0,0,0,0,43420,48788,0,0,0,0,0,0,39512,11559,
+0,0,0,0,0,0,0,0,39138,32733,35983,44447,0,0,17682,0,
+0,0,0,44764,0,0,0,0,11045,0,42828,0,0,33522,0,0,
+0,24461,35815,0,17297,0,0,0,14630,38633,15125,0,2002,36377,40994,46774,
+20597,0,37806,0,0,0,11304,30568,0,0,0,0,0,29665,42122,0,
+0,765,0,0,0,0,39693,22598,0,0,0,23847,0,17243,14786,22125,
+451,23196,25792,32870,42811,0,0,0,0,0,0,0,0,0,34520,0,
+33390,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20472,
+9725,0,34875,34384,0,0,0,0,0,32588,0,0,0,483,11091,22685,
+38794,0,0,0,25253,0,0,4582,5060,15029,0,0,31473,0,0,48324,
+7954,18675,0,0,6106,34804,24998,0,0,0,0,0,0,24142,0,0,
+0,0,0,0,0,0,0,12089,0,0,0,28432,0,0,0,18213,
+13624,9123,32958,45069,0,0,9675,31712,0,37100,14832,16387,31337,35981,44363,0,
+0,0,0,0,0,0,27120,19318,28001,39970,0,0,47288,14837,20220,0,
+0,0,0,15444,13806,39711,46972,0,0,12453,0,0,0,0,0,21348,
+0,0,0,0,0,0,0,18190,11171,29705,0,39124,0,2709,0,16256,
+9529,0,0,0,0,45187,0,0,41049,36307,0,0,35416,0,0,6554,
+29927,0,0,0,0,0,5463,0,0,0,0,14870,32741,34451,40011,4316,
+40540,44128,26649,19064,28153,46642,40824,47352,0,36971,34672,7824,0,12129,9323,40732,
+0,0,41721,0,0,0,12887,41730,44848,0,0,0,11628,0,0,0,
+0,0,0,4169,43352,34849,0,0,0,0,20029,0,43453,0,0,0,
+0,37419,0,0,0,0,0,42089,0,0,0,12836,28666,15459,28609,9735,
+29781,8728,21207,39992,0,9252,0,0,0,0,39125,0,0,27096,0,0,
+14122,0,0,0,0,22343,23282,0,0,0,0,33698,0,0,0,0,
+0,0,24483,0,0,0,0,0,0,7014,0,0,0,31362,0,44347,
+0,45084,38107,45125,0,0,0,46518,41635,0,0,0,36198,0,0,0,
+0,0,0,0,0,4867,0,44402,0,0,0,0,3918,0,0,0,
+44216,12050,0,0,0,0,0,0,14003,0,0,0,0,0,0,0,
+15327,14409,0,0,7155,0,0,0,0,0,0,21460,14168,28893,0,0,
+1840,5673,20897,32600,48402,0,0,5781,10751,0,0,0,0,20536,27699,30840,
+15247,38639,1719,0,0,0,2724,0,0,0,31767,33605,0,0,0,8741,
+18331,11781,0,36231,0,42742,0,0,34450,0,0,0,0,0,0,0,
+0,0,31248,0,19288,21294,0,29337,0,0,39976,0,29133,0,0,0,
+0,0,0,0,0,6085,0,0,5870,0,13957,0,23144,2088,0,14376,
+3607,0,0,217,7672,0,34317,0,0,0,0,0,0,0,0,1765,
+19821,36053,45813,694,8064,18456,0,0,20903,45903,0,28400,0,15092,27944,0,
+0,0,0,0,0,0,0,0,0,0,48284,0,0,0,23578,42331,
+34358,43059,13950,0,0,35510,40426,0,0,0,22612,0,44625,0,0,21870,
+21591,38720,28493,37729,0,0,46759,0,0,13044,15885,0,24333,24383,22527,34323,
+20110,0,34897,44135,0,0,0,0,33562,7108,45624,5409,0,0,0,0,
+0,0,0,19734,0,0,0,45870,24618,8155,27865,42927,13179,44409,0,5477,
+24676,0,0,0,0,0,18319,0,0,11785,0,0,2676,0,0,0,
+10007,31043,37738,38219,0,0,0,0,0,44277,47831,10726,16806,37743,47901,43618,
+27458,9888,0,0,0,8461,0,40908,45321,0,0,0,0,42313,0,18583,
+0,9924,14901,0,0,0,41638,47717,9290,0,0,0,14886,0,0,0,
+38912,32062,0,7940,27163,39404,45789,0,9983,29090,0,0,15051,16979,0,0,
+0,0,0,0,0,0,0,0,0,11037,0,0,0,10880,0,0,
+0,0,19233,0,0,0,0,0,11019,30586,0,7620,28027,0,0,0,
+29776,0,0,0,0,30714,0,0,1016,0,6515,13332,17197,34512,44231,44634,
+45002,0,0,35750,1033,40186,0,3371,0,0,0,20719,0,0,0,8627,
+46064,0,0,0,2012,0,45746,2361,0,0,0,0,0,0,0,13575,
+0,0,0,0,4829,47541,0,0,0,4005,0,3403,36570,0,0,15756,
+0,12629,43571,0,0,31988,0,36860,0,0,0,0,0,0,42001,48207,
+0,0,0,0,0,0,22676,43722,9324,0,0,28034,18599,0,0,0,
+0,0,0,0,0,0,8927,0,0,0,15499,0,0,0,0,32063,
+0,15480,0,0,0,0,0,0,2939,0,40233,44632,30900,36825,0,0,
+0,31852,11720,0,0,0,35951,0,41722,8596,0,0,11197,0,0,21676,
+30302,43118,40670,44101,6622,0,43676,0,0,0,0,0,0,1578,0,0,
+15478,0,0,0,0,0,0,0,0,0,6429,19325,18098,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,33820,0,2705,48428,0,
+2710,45300,0,0,0,0,470,36905,0,0,25078,0,0,32078,0,0,
+0,0,0,0,0,32195,39899,7197,40429,30716,40116,46019,0,31393,0,0,
+0,0,0,12579,0,0,6818,30761,0,7563,0,0,0,0,0,0,
+0,0,22168,0,0,0,0,0,3909,45858,0,3547,18215,19201,0,0,
+0,0,46176,0,14325,16323,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,17318,0,30037,10547,0,0,0,11452,0,0,0,26415,
+0,0,0,0,0,0,0,44146,23362,42601,0,0,0,28247,0,0,
+0,45930,0,10548,0,0,0,0,0,0,0,27250,34022,0,0,13729,
+30271,4874,320,46720,0,0,44287,0,0,0,0,0,0,30372,44056,38021,
+36100,44269,0,0,0,0,0,0,19043,15417,0,38032,0,0,0,26605,
+0,9089,17099,0,11176,9466,664,43390,0,0,0,2337,0,0,0,0,
+0,19234,12721,0,35421,0,0,17149,0,43283,0,42337,27091,44770,0,40801,
+0,38567,15181,44506,0,0,0,0,0,0,0,0,0,37424,14862,7724,
+0,14591,35215,0,41828,0,0,0,0,32977,39543,41131,0,11114,36773,0,
+0,11051,0,0,4019,0,0,0,13912,3755,15844,0,0,0,0,0,
+34160,0,0,0,0,18476,0,18532,0,15050,36817,0,13183,26558,41372,0,
+0,1066,0,0,11449,16201,0,0,0,28839,0,0,0,11822,0,0,
+2283,31733,39978,0,16992,3260,5635,20469,36482,0,10708,18903,22702,0,0,0,
+0,0,42397,0,0,0,0,0,0,0,0,0,0,13768,39575,44494,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,2245,36340,
+0,34007,0,48863,0,0,0,0,0,0,20253,29835,0,0,0,0,
+4490,23608,0,0,23993,33543,27628,8324,0,0,0,0,0,20674,8323,36747,
+0,0,0,0,8702,0,0,0,41965,0,0,25154,0,0,0,0,
+8339,0,0,0,0,13667,0,0,40194,0,48086,0,0,0,34642,0,
+0,0,0,2356,47229,48710,0,0,0,0,0,0,0,0,0,0,
+0,24749,0,0,25685,38964,41278,38369,0,0,0,36649,10617,0,0,0,
+0,13591,0,22141,0,0,0,1633,34412,0,0,0,4540,4422,0,0,
+0,40841,19446,27374,30433,0,32616,0,27898,43797,0,6107,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32219,
+0,0,1781,0,0,45155,0,25445,1809,5434,46978,0,44088,0,0,336,
+44840,0,0,0,0,0,0,0,3721,20355,0,0,0,0,0,0,
+41003,0,0,32057,34021,0,0,7350,36515,0,0,31418,0,0,10076,0,
+0,5391,28257,0,4062,10834,32208,0,0,0,13454,10778,28042,32736,0,19915,
+8165,17123,43843,27899,0,0,19587,0,0,0,45679,7433,27828,0,19980,0,
+0,0,0,0,0,0,0,0,10592,0,0,0,0,26052,0,46701,
+0,0,0,0,0,13337,0,0,0,16039,18585,25972,0,0,0,0,
+5055,0,0,0,26143,0,0,0,0,0,47006,1416,0,10822,0,15767,
+16580,2745,42982,0,0,0,0,7010,2364,0,41524,45843,0,0,0,15290,
+1537,10594,0,0,0,41134,38298,39388,0,0,43972,36863,0,0,0,16294,
+0,0,12429,42781,0,0,3462,7386,0,0,0,0,0,0,0,0,
+0,0,14654,14553,20928,0,0,0,0,0,28029,23872,0,0,0,0,
+0,6154,0,0,0,0,21083,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,14583,0,0,19934,21446,22766,40959,90,32394,0,
+0,10159,0,42968,1866,38520,0,0,0,6841,0,1682,3080,8694,0,12049,
+0,0,21926,0,0,12518,0,0,0,40845,0,40478,44604,0,0,16177,
+10038,19985,0,37557,0,0,0,0,0,0,0,4133,33067,36057,43195,20805,
+0,0,14388,0,0,0,27880,41220,15633,6489,24644,0,0,0,28133,10883,
+31828,36460,19520,13444,40024,8539,0,12983,28862,36595,0,32157,0,44672,0,0,
+0,0,0,0,0,40090,0,0,19864,0,0,0,0,0,0,0,
+12468,0,0,18817,0,228,21139,0,0,0,0,0,20839,0,0,41437,
+0,0,0,36761,0,0,0,0,0,0,0,10566,0,0,22393,42026,
+0,22703,0,0,41268,3052,0,0,31434,0,0,0,37633,10921,0,0,
+0,41463,0,48671,0,0,0,47222,0,0,0,0,0,25638,3887,10173,
+32748,0,5445,0,47439,0,0,0,10385,1533,16871,38835,0,1513,9056,0,
+0,45694,0,42692,0,4413,4823,0,0,0,21739,45675,0,45090,41541,0,
+20789,40739,0,17058,23522,23327,29466,0,0,0,0,0,0,12001,46012,0,
+0,0,0,28041,18117,12826,26817,0,3107,13457,0,1757,19780,0,0,10308,
+0,39148,0,400,3323,0,0,26667,40237,0,0,0,0,0,16810,20563,
+48111,8153,0,0,32994,0,40446,0,4279,15345,35747,15512,36852,30389,0,13005,
+0,42064,0,0,0,3010,26595,0,0,6596,32398,0,24286,30920,0,0,
+0,0,3480,0,0,44548,0,0,33940,18099,16839,7354,0,0,0,0,
+0,0,0,0,0,0,14472,43252,43732,0,11335,0,0,0,45501,0,
+0,0,0,0,0,0,0,0,0,0,24647,0,0,0,0,19661,
+0,0,41330,0,0,31077,0,19711,11156,0,0,0,0,0,14902,40809,
+0,0,47949,0,0,0,9448,31522,28177,13101,0,0,0,0,0,37299,
+0,0,0,0,0,0,0,0,45763,26740,0,0,4720,0,10942,0,
+0,0,38598,33403,42687,0,0,0,0,0,682,46477,0,45432,0,0,
+23770,41393,0,0,15419,0,0,0,0,0,0,4634,28715,0,0,0,
+0,0,31803,5080,0,18062,19720,0,0,0,0,0,0,0,0,13712,
+17631,43132,0,2014,39754,0,0,16817,0,0,38144,0,0,0,32689,0,
+0,6002,43107,26293,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,17622,0,0,0,0,0,0,0,0,0,16052,0,
+0,41681,0,0,0,0,0,0,0,0,11361,0,17921,0,0,4311,
+26540,0,0,0,0,0,41499,45143,22731,0,0,0,0,0,0,7469,
+0,0,24279,0,0,0,0,0,2448,0,0,2694,0,37329,0,0,
+0,0,0,0,0,0,41371,0,0,0,0,0,0,0,10061,0,
+0,0,3412,9537,18659,0,0,35194,0,0,0,0,0,0,0,26498,
+0,0,0,0,23440,12926,16049,41255,48452,30056,27723,0,0,0,18880,39974,
+7725,28127,0,0,0,23037,0,39309,0,0,41630,0,34322,0,46049,26023,
+0,0,727,0,46178,23556,47374,0,33624,0,0,0,0,19962,0,0,
+0,0,7337,0,0,0,0,20602,24425,44428,38924,37082,12434,44099,0,44404,
+0,8203,34062,0,0,0,20875,0,23792,0,0,14448,16506,34951,10666,0,
+43335,0,0,0,42174,0,0,0,0,0,0,1254,18257,19073,0,0,
+0,0,21492,0,0,0,0,0,0,0,0,0,0,21956,0,22617,
+23518,0,0,0,0,22782,39250,0,38326,21840,44684,0,30182,0,25414,0,
+0,28451,5751,39576,0,0,24351,47645,0,0,9619,10210,19004,36549,0,0,
+0,15056,24281,14233,0,0,0,15530,20292,27822,0,0,0,0,0,37924,
+37529,0,0,0,0,0,30754,0,0,0,0,0,1905,14821,35047,48576,
+0,0,0,0,0,47697,27133,0,0,5640,0,28193,0,0,0,0,
+24548,23230,0,31076,0,0,0,0,1940,39621,1333,42777,0,36366,1706,0,
+0,8296,0,0,0,0,36164,0,0,37748,17478,30197,33984,0,0,0,
+39841,21878,0,0,0,0,0,16064,0,0,0,0,9267,3851,33311,5365,
+25946,34969,40327,0,0,37293,9062,0,47278,0,0,0,0,0,0,22900,
+0,0,0,18685,12860,14023,25799,21440,31090,0,0,0,0,0,0,34063,
+38229,0,47238,0,0,29732,0,0,23059,0,0,0,0,0,0,0,
+3904,0,0,0,0,0,16176,22754,31667,357,0,0,31003,0,36824,0,
+2360,0,0,35507,0,9807,0,4185,47591,23833,0,0,34925,0,4183,45340,
+0,0,2263,0,32047,0,0,0,0,13952,0,0,19179,27621,0,0,
+0,0,0,42400,0,45817,0,0,13735,0,0,13958,0,0,0,0,
+0,0,19630,0,15660,34878,0,25583,0,0,0,0,0,13023,0,0,
+0,0,36793,0,0,0,0,0,0,0,0,0,0,0,34197,0,
+0,9378,9416,0,41698,0,0,0,0,0,0,0,3709,24309,0,0,
+0,0,42761,10165,45852,0,0,0,0,44115,0,0,0,47635,0,0,
+0,0,0,0,0,0,0,37590,0,0,0,0,0,48032,0,0,
+0,10869,36484,28385,0,48325,37643,0,38592,41431,0,12088,33063,28660,5945,0,
+35997,0,0,0,27334,0,0,0,0,444,0,8413,0,0,0,13614,
+0,36384,0,0,0,0,0,0,16273,18526,0,17075,0,0,0,0,
+34566,0,0,0,0,25978,0,0,20008,0,0,0,0,0,0,13643,
+25060,27655,0,0,16771,19608,26325,10783,0,24852,16955,0,0,0,0,39419,
+0,0,36589,0,0,25069,34551,46087,10309,38881,0,6080,28156,47637,0,0,
+37457,0,40144,0,0,0,0,0,0,0,0,30944,0,0,0,0,
+27843,0,0,0,5411,0,0,0,0,0,0,0,0,0,4742,28355,
+0,0,35973,0,0,17382,41104,0,0,0,0,0,40785,8182,14221,40110,
+43032,0,9950,34490,0,13045,14103,33148,0,0,0,0,0,23983,0,24585,
+0,32998,0,0,0,0,27042,0,0,14798,0,0,0,46026,0,0,
+0,0,0,43524,0,23069,24166,27928,0,44061,15373,0,45686,0,0,26934,
+18762,0,45953,42779,0,0,0,9597,0,9561,0,0,0,0,8037,0,
+0,30131,35731,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2722,34529,21203,0,0,38485,0,29010,19626,0,0,0,0,0,
+0,0,17285,0,9945,30688,33154,0,0,0,0,0,45445,0,0,0,
+0,0,0,0,0,0,0,12474,0,0,0,0,0,0,0,0,
+0,0,43921,0,0,0,0,38859,0,0,0,0,4652,0,0,9231,
+21176,30379,0,25604,0,0,32668,0,0,0,37474,0,0,0,40987,0,
+0,0,34233,0,45981,2586,0,0,0,0,31034,0,0,0,0,4580,
+12143,42050,33990,20779,0,27284,9575,0,0,0,0,30875,4281,20492,0,0,
+0,0,4184,26145,35590,0,0,46941,0,0,0,0,0,0,0,39660,
+34952,38025,39023,0,6454,0,22604,24387,0,0,0,0,0,0,0,16794,
+23512,0,0,0,0,0,0,0,0,0,0,45576,0,19522,0,0,
+0,0,11564,33502,35784,3631,44468,0,0,0,11903,38552,40552,17079,0,2142,
+39011,0,0,11758,14141,22686,0,0,0,0,0,977,0,0,0,0,
+0,0,7072,0,0,30181,0,0,0,0,0,0,0,0,0,42495,
+46243,48460,26190,0,0,0,0,0,6178,23352,15035,0,0,0,0,0,
+0,46568,0,0,0,0,0,28155,0,0,9571,13908,0,39151,0,21021,
+5274,36897,39439,0,20921,0,0,14641,0,0,0,0,0,0,40284,42492,
+0,38417,0,0,32903,35352,0,40549,0,46686,0,0,0,0,0,0,
+46802,0,0,32970,0,0,0,0,6442,0,0,21078,0,3633,32401,0,
+16325,0,0,24311,0,0,0,0,44460,0,0,0,36137,0,0,0,
+15968,0,2335,0,5315,38102,35578,0,0,0,0,603,12571,47584,5123,0,
+31487,46943,0,0,24474,25933,38735,0,0,0,0,0,41424,0,0,0,
+11621,17533,0,0,5538,13944,25629,45464,20537,23591,24675,0,0,0,0,24293,
+16016,0,0,35288,0,0,30105,38585,38038,0,45369,0,0,0,38315,0,
+0,29792,45917,15397,0,0,35529,0,0,0,44653,19558,25922,0,0,38915,
+44091,36194,30775,0,0,0,0,0,0,41238,0,0,0,0,26477,15302,
+18540,0,0,0,0,0,43141,0,9469,0,0,0,0,0,0,0,
+0,0,0,0,0,0,19336,0,0,0,0,48651,0,0,0,0,
+6140,30339,11417,0,0,45909,20963,0,0,2591,0,13456,28184,0,0,0,
+38271,39354,0,0,0,27668,0,0,0,0,0,0,35789,0,11355,0,
+0,0,41586,0,0,23670,0,0,0,0,17781,43642,30295,0,0,3167,
+0,0,8767,0,4080,24726,10368,0,0,0,0,0,0,0,0,25818,
+0,0,0,0,22506,32654,0,0,27240,16079,25620,22781,3466,20247,29176,44443,
+46962,0,0,0,13610,0,39723,0,9471,12048,0,0,0,0,11657,0,
+0,0,0,0,0,0,28735,0,4338,14777,10634,0,0,0,0,0,
+0,0,0,0,41269,0,0,0,0,0,0,0,0,0,0,0,
+0,0,28838,0,0,2110,0,0,0,47228,25528,42128,0,0,28171,0,
+0,0,0,0,14668,47990,46628,0,0,34864,7660,0,0,0,16559,20665,
+0,28485,0,0,17792,33057,0,21344,0,22194,39528,0,0,28903,31010,0,
+0,0,38568,0,0,45635,0,24146,0,0,0,0,0,0,0,0,
+0,0,7857,0,0,0,0,0,0,12062,0,0,0,0,0,0,
+12738,0,27235,34830,0,0,0,12766,0,40750,0,0,4736,0,0,0,
+29284,29189,0,0,0,0,0,0,33465,24306,28141,31675,0,0,0,0,
+0,38378,44778,0,5369,9381,46629,31044,48282,5098,26747,6551,45842,0,0,22079,
+1738,42656,31002,0,0,34296,0,0,0,0,0,0,33461,0,0,0,
+0,0,0,0,0,0,41987,0,0,0,8967,0,13702,0,0,0,
+30225,40313,0,0,34477,0,40889,0,0,0,1743,45270,0,27247,23180,27259,
+30465,10677,19805,0,33243,0,0,0,20985,37546,0,36594,29686,34712,0,0,
+0,0,0,15509,0,10198,27406,8340,14555,0,0,0,0,0,0,17035,
+37887,0,0,8290,0,0,0,0,0,0,0,0,20914,44557,0,6854,
+23442,44858,0,20777,0,0,0,0,8973,15783,0,0,0,0,39793,4664,
+0,0,36624,13196,0,42632,0,0,10101,6747,28075,2790,44761,0,0,0,
+0,0,0,0,0,0,106,43530,0,0,0,0,0,31971,0,0,
+0,6934,0,0,19968,39848,12961,4017,0,25149,0,0,0,0,0,26140,
+38877,41606,0,0,0,456,0,10700,0,5816,0,0,28948,0,39481,0,
+0,0,0,42027,0,29647,6846,0,5383,0,29107,35572,0,0,0,0,
+0,0,0,0,6808,0,0,0,31859,13406,0,42465,0,0,0,0,
+0,20648,0,9867,0,0,1511,0,5864,0,28175,0,0,47029,0,27913,
+47099,0,2492,8923,11555,0,0,0,0,23952,42786,0,0,0,0,38020,
+0,37257,4546,0,9484,0,7823,0,0,0,0,0,9648,0,42428,28657,
+31209,24873,36104,42455,30428,40369,0,32566,0,1422,0,40386,46842,0,8549,0,
+48845,0,15757,0,32005,0,0,0,0,16155,38726,36922,0,0,0,9383,
+0,30183,0,2858,41189,41961,23279,0,0,0,0,2,5682,0,0,0,
+0,21632,0,0,0,0,0,0,28729,0,0,0,0,0,26294,0,
+0,0,0,0,22904,0,0,0,0,0,0,0,9288,40472,0,40283,
+0,0,0,0,6763,24097,0,16314,45205,0,0,0,0,19245,0,13294,
+0,16710,0,0,0,0,0,0,0,32715,44816,48689,21805,33771,0,0,
+15544,3663,0,7438,0,0,39938,0,0,0,0,0,16361,6635,0,0,
+25041,0,0,0,0,0,0,198,21605,0,9843,0,23195,38088,0,0,
+0,0,0,12508,0,0,0,0,0,0,0,0,0,12864,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,11543,0,0,0,39919,0,29038,22146,42427,0,0,13363,
+40515,0,48072,0,0,0,7343,0,0,0,0,0,41395,0,0,0,
+0,0,0,0,0,0,0,39563,0,840,35499,0,0,0,0,0,
+0,0,0,3096,0,31355,0,4417,42257,0,0,5282,45781,0,22253,0,
+12745,19484,5580,30235,35658,33271,38763,0,22638,0,0,10909,0,0,0,0,
+0,0,12691,24921,26114,25887,32690,33389,35168,0,0,0,0,0,0,0,
+0,0,0,0,21495,36290,30450,47432,0,0,44069,0,0,0,0,0,
+0,47699,0,0,18512,29730,0,0,20037,31631,15893,41886,22197,0,0,0,
+0,0,828,0,0,0,7867,17435,0,0,0,0,0,0,0,10627,
+47426,23443,0,0,11461,0,0,0,0,0,0,0,0,33839,0,0,
+0,42288,0,0,18122,0,0,31283,35080,0,0,0,0,0,1921,48820,
+0,28416,0,0,0,0,0,0,0,0,46995,0,0,0,0,0,
+48178,0,16553,0,16270,0,0,29272,18603,12442,12710,39282,0,1391,46447,0,
+0,0,0,0,0,27842,0,116,32167,0,48152,0,0,0,9626,0,
+0,27825,0,14445,0,0,0,0,0,0,0,37594,0,35994,0,0,
+0,0,0,0,48063,0,0,0,0,0,44597,12108,0,6473,0,0,
+0,0,0,0,0,0,2891,12548,0,0,0,0,0,0,0,0,
+0,12295,0,0,0,35412,0,21586,0,0,0,48117,0,20373,0,0,
+38740,6049,0,20764,34624,34916,0,32792,0,38541,27553,0,0,0,0,0,
+0,33261,0,0,0,0,0,0,0,38113,0,7596,20083,24290,0,0,
+5448,0,0,6433,0,36174,13934,0,0,0,4680,0,33805,41369,1186,29434,
+0,0,0,531,39647,0,44824,0,0,0,0,0,24960,0,0,0,
+29296,26471,0,0,0,0,16997,22454,36996,27062,0,0,0,0,0,0,
+17500,29814,33321,4477,0,0,3039,0,42647,0,0,46747,0,22394,38978,0,
+0,0,0,0,30280,20549,48135,0,22216,47807,0,0,0,44265,0,0,
+15317,0,0,0,0,0,830,17250,17566,0,0,10371,0,0,0,13206,
+0,0,4675,47687,0,0,0,36814,44992,0,41132,1444,0,0,0,18014,
+37083,0,18674,0,13974,0,0,0,0,13065,0,0,0,0,0,25621,
+0,0,0,30173,23886,35903,0,0,26295,11024,0,0,0,0,6540,0,
+0,0,0,0,0,0,0,0,0,0,0,0,35083,0,0,23884,
+0,2350,32971,36361,41860,44408,47191,0,0,0,0,25565,3796,23990,8653,26470,
+0,0,0,10543,0,0,0,0,0,0,0,0,0,0,0,0,
+28557,41071,0,0,0,0,0,42598,35544,19438,0,0,0,0,43209,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,43620,0,
+0,0,11031,0,0,44635,43947,41453,0,0,0,22922,33535,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,2567,2760,37146,0,
+0,0,17247,0,0,0,0,11619,27961,30250,0,0,2781,8924,31280,32628,
+0,1255,0,0,4865,15474,29021,34111,17843,37760,0,0,0,0,0,0,
+40991,0,41080,40655,0,0,0,0,19517,33018,47323,0,0,0,0,0,
+0,0,0,32925,47444,29889,4332,0,16104,0,0,46239,0,0,37030,0,
+42602,0,0,9582,0,27891,2116,0,35936,0,0,0,0,0,0,0,
+10811,0,35867,0,40722,15126,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,23868,20584,0,0,26235,0,0,37264,45289,16446,0,0,
+0,0,1563,0,0,0,0,0,0,0,0,0,0,0,37275,0,
+0,0,0,0,0,0,0,25378,27721,552,0,16265,0,6809,12915,0,
+0,0,26121,0,0,0,0,29896,22893,3084,34146,36706,0,0,0,0,
+0,0,0,0,0,45475,3042,0,0,39474,0,0,7913,10074,0,0,
+34156,0,0,20399,0,0,0,33190,0,0,0,0,20064,46342,0,0,
+0,0,0,0,21246,38096,44142,0,0,0,23393,0,0,0,0,11916,
+0,22063,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,6826,0,0,0,35521,0,0,42985,17391,13142,3638,5660,15129,
+0,11005,37018,0,0,0,2228,3805,47173,0,36947,19535,0,2609,4497,0,
+0,0,0,0,0,0,0,0,0,0,5491,0,34402,0,44910,37090,
+0,0,28887,0,0,378,2135,0,0,0,18713,33495,40963,42338,0,0,
+0,0,46348,20951,0,0,43190,0,0,0,0,0,0,0,22015,38415,
+0,23073,0,10275,2997,0,0,0,28955,37904,0,0,0,0,0,0,
+0,0,11584,0,0,34789,0,9591,39695,0,0,0,0,0,0,0,
+25964,0,417,30973,16368,25493,0,0,0,0,0,2045,0,0,2182,0,
+10872,0,0,46164,0,26783,0,0,25530,0,0,0,0,0,0,0,
+0,43293,0,0,0,6638,8120,0,41312,0,0,28910,0,0,31507,39781,
+0,0,0,28672,39626,0,0,0,6271,1661,0,0,0,0,0,3277,
+28527,8361,36519,39099,0,0,0,27567,11700,26141,0,0,0,38861,0,0,
+0,0,45039,47272,0,0,0,0,0,31760,3193,0,0,38149,0,0,
+0,0,9927,0,0,29132,0,0,0,0,33090,0,0,0,0,0,
+0,0,0,0,0,0,9423,17950,19337,24280,30546,0,0,25062,3469,48241,
+0,48073,0,0,0,0,5465,36260,0,33621,12640,0,24605,0,0,0,
+5142,0,0,27788,9679,0,0,13146,3011,19352,0,0,7004,11489,955,34764,
+0,0,14601,0,0,0,0,0,0,0,0,0,39044,12639,0,0,
+41302,0,0,0,5174,0,0,0,10607,30513,32691,39525,30865,48711,0,0,
+0,28596,8282,15747,2606,35660,38975,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,34319,0,0,0,0,0,0,0,0,0,40832,
+0,0,0,26699,0,2280,13296,0,0,0,0,7256,40006,0,0,0,
+0,0,0,0,33358,37220,0,0,0,0,26797,0,14268,8917,10303,0,
+0,0,0,8338,23870,34396,38595,42099,0,0,0,0,3422,34926,39603,39617,
+33868,31521,43503,44134,0,38005,0,0,36395,0,19719,0,33676,0,0,8647,
+29666,40933,32897,0,0,0,0,0,0,0,0,0,6764,26553,3545,0,
+0,0,35519,36111,0,0,5627,0,14454,30619,0,0,0,23150,0,0,
+0,0,18205,0,4584,0,0,0,34394,0,0,0,0,0,0,0,
+0,0,4886,11308,0,0,0,0,0,0,0,0,26270,0,0,0,
+0,29186,20395,0,0,33040,5787,0,45883,36958,47042,15439,2583,27445,28937,36837,
+0,0,31329,13689,23267,0,0,0,0,0,0,0,0,0,0,37496,
+37596,0,44355,0,33857,0,35241,43246,0,10978,19178,20317,35427,14429,40228,0,
+0,0,0,0,39586,0,0,0,0,0,34850,13293,20260,0,13763,48813,
+0,0,0,0,0,0,0,0,9890,21691,26796,0,21269,0,0,20573,
+0,0,26541,0,0,30800,0,0,0,34944,0,0,13955,0,0,0,
+0,18372,42253,22902,23066,0,0,39640,19321,0,0,35228,0,0,0,0,
+0,0,0,7081,21148,0,0,0,6716,22278,0,0,0,0,0,0,
+0,18960,39665,0,15427,32105,0,13879,32697,0,38492,0,0,39156,25068,13474,
+21705,0,0,0,0,0,24520,15600,0,8591,19628,20795,28921,3946,30807,40096,
+13760,20987,0,0,0,0,0,0,2547,18418,0,0,0,0,0,0,
+0,0,40644,0,0,36254,0,25910,35318,0,0,18226,24467,0,14861,0,
+0,0,0,21544,0,0,0,45481,0,0,12365,46751,46278,25038,0,133,
+0,0,0,0,25725,0,0,0,0,0,59,3452,23674,15023,0,0,
+0,0,0,37102,0,0,0,0,0,0,0,27995,0,0,0,0,
+0,15840,10842,0,4817,0,0,12649,0,0,3033,0,0,0,0,20049,
+0,0,0,23692,0,0,44573,0,0,0,0,0,9441,6974,14803,0,
+0,43937,0,10803,16448,30831,31228,26384,0,0,0,43249,0,30532,38900,22326,
+42780,6866,43887,0,0,15752,0,0,0,0,0,1093,0,0,0,0,
+0,0,0,25320,0,0,10971,17039,29372,0,19098,0,0,0,0,26191,
+41415,0,0,0,0,1023,5205,48567,0,6481,41956,14994,17458,20637,39666,37362,
+0,0,0,0,0,0,0,0,0,40828,0,0,0,0,10438,0,
+0,0,43009,0,18886,22870,0,0,0,0,0,0,0,0,0,0,
+0,24865,0,36572,0,1238,0,0,8730,24909,0,0,0,44681,0,26870,
+0,0,0,0,0,2358,0,0,0,0,46000,0,39561,0,0,0,
+0,0,0,0,0,0,0,44268,865,38207,16320,0,0,5053,32889,0,
+14979,45631,32967,36727,0,6019,0,5304,21830,0,0,0,15306,0,20459,24145,
+46222,0,0,0,0,0,0,0,31233,0,0,0,6218,29934,0,0,
+0,0,0,0,0,48739,0,0,0,0,0,33202,0,0,0,0,
+47120,43197,6443,47839,0,48196,0,3000,0,0,23658,0,28267,0,0,28671,
+13665,0,0,37732,14248,0,0,0,0,17717,0,9341,10254,0,524,38602,
+44306,46661,0,40351,1967,0,0,0,0,0,0,7727,0,0,0,0,
+31520,43899,24329,0,0,0,0,34187,0,31176,0,0,0,5061,8906,27515,
+33277,0,0,4485,26186,47972,0,0,0,12415,44219,0,22750,26631,0,38957,
+0,0,47953,0,0,0,2399,0,25642,0,0,2667,0,6159,0,46969,
+0,0,0,26332,0,11886,16388,40893,40575,32437,44130,47996,0,25658,0,11382,
+24747,14203,43995,79,4983,37254,0,0,0,0,9013,0,0,0,28290,0,
+0,6069,0,0,24916,0,36149,18383,0,0,37525,0,3560,5941,16308,0,
+0,0,0,0,0,4648,19013,0,0,0,0,0,0,30797,0,0,
+35917,0,348,0,29312,35118,0,0,0,0,0,0,37219,0,0,0,
+2133,11198,0,0,0,36291,0,0,0,17798,0,15907,0,0,0,0,
+0,0,0,0,0,0,0,26320,0,4999,0,19799,0,46140,0,0,
+0,37922,0,0,46524,2277,5354,16612,17728,26491,36007,37977,2450,32231,17796,0,
+6604,43358,0,34920,28427,35638,34708,40189,0,19100,22916,23287,0,39707,0,642,
+0,23028,0,48079,0,0,0,36758,0,46033,0,0,0,0,37313,0,
+0,730,0,0,31800,0,0,21063,43902,0,0,0,16694,41092,30654,0,
+0,0,0,0,0,0,29986,47519,0,0,0,0,0,0,0,6148,
+0,0,0,0,0,33782,39526,23200,32549,45991,47652,13360,43842,10014,47878,10112,
+0,0,33363,0,0,0,0,0,38420,0,0,45628,0,0,0,30045,
+37810,45752,24370,0,1540,17944,0,0,0,27394,0,28675,0,0,0,0,
+10315,20352,41103,0,0,0,0,10804,43940,0,0,44305,0,29391,22935,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9593,30912,0,
+0,0,0,0,16474,47783,0,7910,0,0,0,2701,34902,48561,0,0,
+0,0,0,0,22879,36275,0,18651,12191,45213,0,0,32968,0,0,0,
+0,0,22214,47791,24621,0,0,32237,0,0,0,0,0,27732,15762,0,
+3754,0,0,0,36870,4721,18169,0,0,0,0,23071,0,19804,47436,0,
+0,45358,0,0,24794,1814,10875,35662,0,0,37679,39446,0,0,0,8834,
+0,0,5126,0,12795,43265,0,0,0,0,1400,31837,1038,34641,34732,0,
+0,0,16024,19024,35376,45161,8121,20616,11676,36005,0,0,0,23446,32180,39555,
+0,0,0,46311,43100,0,0,0,0,0,0,22927,0,1265,4838,14371,
+0,0,0,0,0,0,0,0,19182,37375,0,0,0,0,33386,0,
+0,0,0,0,41489,41290,0,16213,17537,0,48733,0,0,0,0,0,
+0,26024,0,0,0,0,0,0,0,35651,0,0,5813,0,0,0,
+0,40839,0,42541,31193,0,0,20630,11477,0,0,0,9063,0,0,0,
+0,0,0,10719,934,19426,28692,32575,0,0,0,13742,22956,0,0,1638,
+0,0,0,0,0,48807,0,34228,17201,16786,39482,0,0,15370,43637,0,
+0,0,0,38751,43614,0,267,9742,0,0,0,6713,35012,35621,0,3404,
+9479,0,0,0,0,26387,0,0,0,2983,0,0,0,11723,0,6248,
+0,0,0,0,0,17316,43235,38989,0,14838,0,6286,0,0,27591,19475,
+21936,0,14182,0,0,0,0,0,583,6780,20316,10741,0,0,0,0,
+0,0,0,47924,0,19803,0,0,0,27099,34931,0,0,0,43949,0,
+0,7228,0,0,0,28722,46749,1573,0,0,47905,18702,0,18544,32722,42644,
+0,0,0,0,16389,11732,44648,0,0,0,0,26715,15005,32798,0,35275,
+0,0,26982,0,0,13128,21860,26840,0,0,0,0,5827,8106,0,44461,
+27784,13022,2865,46779,23129,29825,0,43689,35851,22651,9298,46256,46264,48225,0,0,
+30275,29488,4041,23814,24970,0,20810,0,0,717,7540,21560,0,0,0,0,
+0,14980,38236,43229,48118,0,0,0,0,0,0,0,0,0,0,0,
+0,0,6875,29958,32034,3309,25185,25077,33342,35074,42152,45690,36778,35234,0,31391,
+0,10441,0,6852,0,3908,0,2292,0,12152,30,0,0,28655,32740,0,
+0,19900,0,0,0,0,0,0,0,14795,0,0,15750,12731,5767,5134,
+17248,35841,43212,4600,0,0,0,0,0,0,38960,0,0,0,0,0,
+10881,0,0,0,47666,0,0,0,0,26287,0,8464,15520,1080,21295,35770,
+0,0,0,0,0,0,0,35707,0,0,0,0,0,0,14158,0,
+0,0,0,0,0,0,0,0,28719,45557,0,0,32942,14316,0,0,
+7692,0,37404,0,0,0,0,0,0,0,6241,41409,1324,20290,0,11826,
+0,0,36197,0,41122,0,46912,0,0,45692,38923,0,0,0,28112,0,
+9079,0,16124,9286,2651,17990,17383,0,0,0,0,0,0,0,8450,0,
+0,27316,46279,0,0,0,0,34568,0,0,0,0,32783,35424,0,0,
+23503,0,0,0,0,0,0,0,25979,0,0,6698,9753,13953,19445,23877,
+27363,41382,0,0,46072,0,1851,0,0,0,33793,27102,0,0,31989,0,
+0,0,0,15869,24288,0,0,0,0,0,0,0,8525,0,0,4916,
+0,15526,0,0,0,11437,37863,7872,46096,0,0,0,0,11532,19774,46617,
+0,0,590,0,0,0,7712,0,28377,0,0,6136,0,0,40111,0,
+0,3756,34794,0,14335,0,0,0,32021,0,21817,24382,0,0,0,0,
+0,39691,0,0,40545,11712,12169,1626,0,0,0,15064,0,0,0,0,
+0,0,0,0,0,0,21271,16070,0,823,0,0,0,0,0,0,
+32637,0,0,41633,0,0,0,0,0,0,0,10562,0,17105,0,0,
+0,26092,0,23204,2103,27950,0,37273,23781,0,0,16587,560,10152,0,27469,
+0,0,0,0,37414,0,0,0,0,36615,0,44730,0,38248,0,0,
+0,25396,0,0,0,0,36940,44641,0,0,0,0,0,0,0,0,
+0,0,0,1897,0,0,0,42146,0,32001,33763,0,0,4008,0,0,
+0,0,0,0,0,20676,36219,0,0,0,0,0,0,46043,35109,36743,
+0,0,0,0,0,45498,39557,0,0,0,0,41944,24607,0,32920,0,
+0,0,0,21675,22637,36867,0,15220,0,0,41096,0,8810,17312,0,0,
+0,0,0,0,0,0,0,0,25533,0,0,0,0,0,0,5028,
+13263,40320,0,29963,0,19415,0,7628,24854,0,0,0,0,0,0,0,
+0,0,0,0,11356,19852,27714,33510,41237,0,34736,21071,23546,0,0,0,
+16237,0,6192,0,0,0,0,44314,41693,0,0,0,0,0,0,0,
+25878,42374,48328,146,0,12130,0,0,0,0,11305,0,0,9270,0,0,
+0,0,32281,0,0,0,0,30885,45174,0,0,0,0,0,0,0,
+0,0,5636,12253,23537,28975,35093,44806,0,0,0,0,13772,0,0,0,
+0,0,0,0,0,0,0,0,14401,0,0,0,29678,20332,0,391,
+27577,34890,43298,44884,0,20419,0,0,14440,0,0,0,0,27398,47763,26958,
+31050,0,0,0,0,18979,0,37050,0,0,4151,24911,3852,47671,0,0,
+0,0,0,0,0,0,0,0,0,38381,38502,0,0,9551,47802,0,
+0,26824,4576,20715,0,25346,22272,0,0,0,0,0,3296,5335,30665,38328,
+0,0,0,11150,36376,0,0,0,0,46095,0,14481,16500,38505,9686,2801,
+4548,40121,48394,0,0,40295,35712,0,0,0,0,6162,8332,27830,6456,32276,
+0,0,31400,22477,33479,33846,23030,0,1491,7237,0,0,0,0,0,0,
+0,0,34375,43350,43328,0,0,13123,45441,0,0,0,6895,0,17667,0,
+0,0,0,13728,0,34031,0,0,0,0,0,0,3100,20022,14632,30894,
+0,0,45882,0,0,0,10675,34075,0,0,0,0,0,0,0,32121,
+0,0,0,0,39802,0,0,0,0,0,0,8254,42013,34268,0,0,
+0,0,0,0,0,0,0,1486,46734,30721,0,0,0,0,4733,0,
+0,29742,0,0,1490,32012,25453,2962,19189,31623,0,0,0,39811,0,33695,
+0,0,0,27520,0,0,7573,22569,47142,0,0,0,38150,0,0,0,
+30873,0,0,0,26176,0,0,29595,0,0,42628,0,0,0,0,0,
+0,0,0,40492,33450,0,0,19822,0,16590,0,9661,25550,31505,0,0,
+0,0,0,0,0,0,0,0,0,0,0,42393,47376,0,0,0,
+0,0,33085,0,0,48240,15564,0,10994,0,0,0,0,24525,0,39515,
+0,0,0,0,0,0,33225,0,0,2733,0,0,46547,0,16015,0,
+0,3341,0,27087,0,25899,35086,0,0,0,0,36788,0,1350,46025,0,
+40201,23156,0,0,0,24542,0,0,0,0,478,41937,0,0,0,21097,
+27911,8996,0,0,47564,0,2490,0,0,0,0,0,20070,0,0,0,
+0,0,0,0,0,0,0,0,0,251,0,0,0,0,0,42436,
+0,0,0,0,0,0,0,0,0,23288,0,0,744,47236,0,6468,
+16680,0,0,0,0,0,19295,0,41233,0,23211,0,1126,10107,6449,0,
+41266,0,6916,0,0,0,0,0,0,0,0,0,0,48108,0,0,
+0,0,0,0,1148,0,0,0,19062,0,36916,34119,0,0,0,0,
+0,0,27799,0,15256,0,0,6522,46150,0,5732,17005,24972,0,0,10070,
+11460,0,0,4732,25102,0,28005,0,0,26898,0,18080,0,5545,0,0,
+0,0,0,0,0,0,30796,27646,2238,6010,0,0,6590,12004,13420,0,
+0,13883,47681,0,0,0,8321,33598,0,0,0,0,0,0,0,16006,
+27643,0,9826,23922,2340,0,0,18521,3270,0,25580,0,0,0,0,0,
+15253,1181,20687,47336,41714,0,6544,0,29027,0,17177,0,0,0,0,2952,
+0,0,0,0,6100,0,0,0,0,0,0,13813,0,0,0,0,
+0,0,0,23642,0,0,27594,0,0,0,46207,0,0,0,0,0,
+0,20327,0,0,0,0,0,4079,0,0,0,0,0,9592,361,24377,
+48302,0,0,0,0,13619,1736,0,0,0,0,0,0,0,16963,0,
+0,0,37764,0,31352,3688,19121,45376,0,0,44940,0,0,30127,12560,16965,
+36426,39418,0,0,0,18786,0,9877,0,0,34600,0,32138,0,0,0,
+3602,41540,0,11704,0,0,0,0,602,12930,0,0,0,0,0,11380,
+19353,0,47811,24363,4852,0,0,0,0,0,0,0,0,0,0,0,
+0,0,12779,0,0,17342,0,0,0,0,2092,4426,0,38721,0,0,
+0,0,0,0,6788,25258,24294,11401,37007,32093,34224,39101,44656,0,22753,0,
+0,0,0,30692,0,24190,0,0,0,24870,0,7560,8772,0,34997,0,
+0,0,0,0,0,5431,25250,7895,0,0,0,0,0,0,0,7236,
+23700,10405,15328,0,0,0,1613,35947,0,0,0,0,15857,0,0,0,
+0,0,0,0,0,0,34148,0,0,4572,19373,0,0,35745,0,0,
+3276,0,0,0,0,15813,0,16489,0,0,0,13439,33833,0,0,0,
+0,7811,9430,9849,21822,22118,24913,37673,44923,45783,13617,0,0,37122,0,3069,
+0,0,0,0,0,0,0,11747,0,11200,16141,19240,24764,0,0,0,
+0,0,0,0,17838,0,0,0,28240,0,0,0,0,7739,26654,0,
+11908,0,0,4351,0,0,0,0,202,606,0,0,0,0,0,45760,
+0,0,0,0,0,0,32673,20369,36274,46983,0,0,0,0,0,31346,
+28318,6076,0,0,0,0,17286,32863,45399,48109,16931,0,0,0,37980,0,
+0,0,39221,0,0,0,0,24257,28608,0,0,3705,0,0,0,18423,
+12015,12522,39022,0,14382,0,0,6660,0,40636,0,7226,30569,0,0,0,
+32391,27229,42645,6633,15500,44403,0,463,7264,0,0,0,13780,45219,0,0,
+13080,36468,0,0,0,0,0,8381,0,0,0,34151,22202,0,25860,0,
+0,0,30707,0,0,0,14949,30406,2389,2532,10938,0,0,0,18915,0,
+8196,17106,38139,0,28959,38941,0,28211,0,0,0,0,0,18221,40054,48139,
+0,0,0,0,0,0,0,0,0,0,24999,0,0,11631,21875,33865,
+0,0,0,0,0,0,0,36638,4304,44498,0,0,11674,3739,12988,31950,
+0,17827,0,0,0,37372,0,28466,0,0,0,9806,0,47514,3342,47860,
+0,37947,0,9569,0,41343,0,31874,0,0,0,43169,19385,316,25332,1296,
+0,18330,0,9420,21095,0,0,0,24035,0,20046,34064,0,0,0,24720,
+0,0,0,0,28077,0,0,27094,0,0,0,0,0,0,0,2916,
+23895,0,18220,31030,28513,21895,24073,39864,0,0,14921,39845,46098,8002,47380,0,
+0,0,0,0,21023,5347,35298,29185,0,0,0,0,13435,0,16842,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,24805,0,0,
+0,0,41311,0,0,46975,23796,5265,0,0,0,0,0,0,0,0,
+0,3001,14114,0,0,0,0,0,0,3413,45120,0,0,0,0,0,
+0,0,0,0,17373,43974,0,22307,0,0,0,0,0,6201,0,298,
+36532,0,0,4466,0,19364,0,23051,0,0,48755,0,43785,38169,0,0,
+16603,41769,30879,33216,41034,34081,0,0,0,24666,47756,0,0,13803,29824,14249,
+38182,37828,0,0,40651,0,0,0,2487,17156,20398,45794,0,0,0,0,
+0,0,0,0,0,9911,43089,0,0,0,0,33163,0,4237,39438,0,
+0,0,0,35329,11929,0,0,4012,25696,32094,34001,0,0,6486,0,0,
+2222,0,0,0,0,0,0,0,0,0,0,13260,15866,21590,2174,34513,
+34210,40120,36125,32406,36434,10984,43840,33111,0,0,44644,0,0,17425,28188,0,
+37776,33506,37690,0,0,0,0,0,0,0,0,0,33546,35372,38445,22064,
+0,0,19975,42516,42570,48061,46758,0,0,0,0,7060,0,0,0,0,
+0,105,0,0,0,0,0,34812,0,0,0,0,10064,0,0,14441,
+0,0,0,0,43182,0,0,0,0,0,10329,0,40149,253,0,15738,
+0,0,21002,0,0,13225,0,0,0,0,0,38043,0,0,0,37204,
+0,35824,0,0,23969,0,2560,0,11955,0,30410,33188,30910,24324,0,0,
+0,0,0,20312,0,0,0,935,13153,0,0,11966,20720,10021,16031,0,
+0,0,0,0,0,0,0,0,0,0,0,0,40840,0,0,0,
+0,0,0,39833,46330,43092,0,0,0,0,0,0,0,30769,1300,23433,
+28276,46963,13949,0,103,0,45812,0,0,0,0,32264,29691,677,0,0,
+12286,6007,38092,20596,0,0,0,0,0,0,0,36342,16515,0,0,0,
+0,0,1509,43854,0,17310,0,0,14986,35472,37410,0,0,0,0,0,
+0,0,0,0,2549,24853,1380,48138,0,42294,0,0,0,0,0,0,
+0,27081,0,0,9975,42769,0,0,43006,0,37441,0,0,0,0,15288,
+0,0,0,0,45149,0,0,0,0,31289,9612,21848,2251,21170,26324,32949,
+38320,0,0,0,0,0,0,13440,24730,0,0,0,1677,0,34398,0,
+0,0,34462,0,0,14724,0,0,44932,18593,0,47162,0,0,0,42437,
+39432,0,0,0,0,11447,8994,16620,0,0,0,0,0,0,0,21355,
+44949,0,0,0,0,14220,42643,0,0,36383,0,41406,0,0,0,47098,
+0,0,783,17698,6112,2495,0,21505,10643,37085,48559,42085,46538,0,18299,33297,
+0,0,0,0,0,14784,0,1991,0,0,0,0,0,0,29158,0,
+0,30390,5765,39766,25305,0,8607,0,0,0,0,0,0,0,10054,15451,
+23043,33976,12217,30878,46782,19441,19680,0,7732,0,39558,0,0,23038,0,0,
+0,0,0,0,27949,29838,22914,0,0,0,0,0,10986,10023,26750,30643,
+32983,26997,44304,8764,25548,31401,43735,0,0,0,0,47305,20445,9332,39581,43196,
+0,13897,30270,0,279,0,0,0,0,0,0,20062,0,0,0,0,
+0,0,0,0,0,0,0,0,15371,48736,0,10049,0,19594,0,0,
+0,0,0,0,0,0,0,40265,0,0,0,0,0,0,0,0,
+0,0,836,0,29902,0,15630,328,16758,30803,0,0,0,0,0,7276,
+8418,43402,0,0,26633,0,44523,0,0,0,0,43017,44683,29365,5223,25408,
+0,0,0,0,27849,0,0,0,0,0,27846,0,0,3820,6905,9185,
+26211,36893,0,8362,0,0,0,0,0,0,25482,0,20874,0,2459,11945,
+28754,0,22114,13369,9200,12144,26385,0,37005,0,0,0,2000,0,0,0,
+27759,0,0,21699,0,9539,0,0,0,0,0,47884,0,0,13738,0,
+0,1621,3513,5875,0,0,0,24010,30729,36879,28569,0,0,0,0,0,
+0,0,0,36604,4528,37964,31732,0,0,0,761,0,0,0,0,0,
+0,44365,0,11034,40927,0,0,0,0,0,28053,0,0,0,0,0,
+39687,0,16511,44421,45967,0,0,0,34884,3952,4050,0,0,0,0,17228,
+25397,0,0,0,43498,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,34404,0,25399,7339,0,0,35945,0,0,0,20673,
+0,0,0,0,0,0,0,0,0,0,0,39324,0,0,0,11901,
+9499,29895,0,27116,0,685,0,31191,2086,0,10885,0,6059,0,28961,0,
+0,0,30035,0,24673,0,0,34264,27502,0,0,0,0,7176,27777,6458,
+41763,28069,12850,0,0,0,0,0,0,0,20984,0,0,0,29991,0,
+41561,0,0,0,0,0,35829,4285,0,0,0,0,33447,15382,0,0,
+0,13197,21332,0,39694,31806,0,48281,0,0,0,14018,0,0,0,0,
+0,13525,0,0,1352,0,0,0,0,0,0,0,0,7041,0,0,
+0,0,0,0,0,0,0,0,10253,28716,0,0,10439,0,0,0,
+0,0,19927,0,0,21867,0,0,0,0,34039,0,0,0,0,0,
+0,0,0,0,0,0,6417,2988,32806,0,0,5859,0,0,0,0,
+0,5750,7720,0,0,11652,0,0,0,0,0,0,0,0,28474,0,
+0,0,0,0,0,0,35304,41234,43981,4436,37076,3903,0,32675,0,0,
+44444,46307,0,0,48166,0,14537,22475,779,12131,26231,20858,36135,40874,0,0,
+0,0,14907,35448,31855,0,0,0,0,47909,36182,45249,0,0,0,0,
+42691,0,38416,0,13470,0,0,0,23085,0,0,0,0,4308,0,0,
+8691,0,14606,19635,0,0,8112,7458,20218,33132,0,0,5974,19563,31640,45175,
+33747,47396,44939,0,0,0,0,41011,0,0,15693,15567,0,0,0,0,
+46268,4349,0,28358,12433,0,0,0,0,0,0,0,0,0,0,0,
+0,43717,9478,0,0,45220,26873,47070,0,7537,28050,0,0,0,0,17209,
+34983,9121,21144,43559,11106,0,0,34355,47824,0,0,5784,28462,37008,0,10898,
+0,0,0,0,0,30982,0,0,0,0,0,0,0,0,47974,0,
+18582,12285,22069,0,0,24276,25669,0,31265,1467,0,0,0,0,0,42638,
+0,0,0,0,36032,12547,35861,0,0,11016,0,0,0,0,0,0,
+0,0,0,37117,12845,0,2485,39896,0,2766,0,0,0,0,29590,33911,
+10689,0,0,0,0,1010,38815,19416,0,0,0,37680,0,0,19294,15421,
+0,33354,30555,0,0,0,0,0,0,25954,0,0,39278,0,15642,18760,
+20330,0,13741,48235,0,0,0,18326,17749,25546,0,24322,0,0,0,0,
+41511,2680,30123,42916,0,1288,0,0,35762,0,0,10784,0,0,0,0,
+0,5169,0,0,0,0,0,0,0,16755,22135,0,27813,27922,42510,0,
+0,0,0,0,33831,0,0,0,0,0,37323,0,0,0,0,0,
+0,927,0,0,0,0,0,0,0,0,30591,0,0,0,20056,33757,
+0,21486,36973,35051,25559,29422,0,7685,45199,0,0,44185,0,0,48851,29020,
+42732,0,0,47190,0,2025,0,17144,0,0,0,93,11976,45250,0,0,
+0,0,0,0,34548,10114,17545,45476,0,0,0,46930,0,0,0,0,
+0,0,0,0,0,0,36023,27704,0,0,4722,10290,12631,29676,0,0,
+0,0,0,0,0,0,29768,0,0,0,0,0,0,33468,40716,35629,
+46365,0,0,40537,0,0,0,0,0,16367,0,38027,0,34265,0,36276,
+0,0,0,0,0,0,0,0,0,0,0,14117,0,40974,0,0,
+0,0,0,0,0,0,22387,0,0,0,34048,16204,40950,0,0,0,
+0,0,0,42751,0,0,0,0,0,1157,0,0,0,0,0,0,
+0,3751,0,0,45410,0,3335,1723,13011,18105,45514,31779,48855,47225,0,0,
+0,0,0,0,0,19839,0,7642,0,21390,41040,0,0,16914,0,0,
+0,0,0,0,0,0,0,46882,0,23743,16137,24985,0,0,0,0,
+309,14439,0,41607,0,0,0,684,13893,0,0,5540,48659,0,0,21563,
+0,0,0,45139,0,0,0,0,0,0,0,8329,19309,36177,0,0,
+2175,24028,34434,36268,39092,0,42678,46534,45496,2636,0,16857,0,0,2877,21161,
+0,0,7261,17876,1689,24827,0,0,0,38983,30154,45629,0,0,0,18716,
+9315,32266,0,5515,0,0,32387,0,0,0,0,5168,47696,0,19641,0,
+0,492,1221,18212,19775,36475,42564,46876,48384,0,28148,45732,0,0,15737,0,
+0,0,0,0,0,0,0,0,0,0,0,37501,0,33417,3073,23347,
+0,0,0,8703,25640,0,1641,5920,11726,18032,0,25624,28599,0,0,0,
+0,3793,0,0,0,28938,29073,5694,44070,45371,0,0,0,0,17527,24545,
+0,0,0,0,0,0,15237,39832,0,0,17560,21540,25114,35619,42290,43406,
+0,0,0,0,39455,0,0,0,0,0,0,45706,6333,0,0,0,
+0,0,1510,0,0,0,0,32761,0,0,0,4052,0,0,0,40581,
+17182,4249,0,0,0,0,0,0,0,0,22418,0,0,0,20146,27046,
+3232,0,4512,15096,22445,0,26855,42424,0,0,0,0,0,0,18061,0,
+0,14341,0,20958,1004,24782,0,0,0,0,0,0,44800,0,0,18120,
+0,0,0,0,0,8086,0,0,0,0,0,0,38438,45773,0,0,
+0,0,0,0,19140,34118,0,0,0,0,41329,0,0,0,0,0,
+0,0,0,24198,1358,0,0,17978,0,0,0,0,24413,30171,23379,30159,
+5044,18137,25814,41363,33462,0,29001,27948,34407,18609,27202,34609,48708,46004,0,0,
+0,0,0,45212,0,18069,0,46426,0,21580,0,34694,15278,48215,35787,45262,
+0,0,0,0,0,0,0,39880,0,0,0,0,8286,0,0,35924,
+12755,0,12181,649,11326,0,0,0,0,12857,9116,45328,3777,0,0,0,
+16333,13661,0,0,0,28535,0,0,0,0,34463,29154,0,34370,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,33470,37564,0,0,
+0,0,0,0,26407,39840,23584,0,0,0,15171,19012,0,0,24278,33636,
+30890,0,0,0,0,0,0,0,0,0,10344,0,0,0,0,0,
+0,0,0,6321,0,29340,42375,0,0,0,0,0,31864,15798,41951,4119,
+0,0,47937,0,0,0,0,47388,0,0,20132,4833,0,0,0,42724,
+17872,0,15205,35280,0,40900,3790,0,0,0,34504,0,12675,0,20237,0,
+0,13526,0,0,1194,0,0,16692,20513,0,8676,0,0,17874,7788,44192,
+0,0,0,0,47562,32488,18033,0,0,0,0,25943,0,0,0,0,
+0,22964,0,0,0,0,2155,2967,19502,8959,20245,21069,44387,0,0,0,
+0,0,802,36199,0,0,0,0,0,0,26529,47306,28568,36987,0,0,
+0,0,35380,0,0,0,0,0,0,23509,0,0,0,0,0,0,
+40109,19883,35119,46371,32679,0,0,22008,0,12513,0,0,0,16386,0,0,
+12257,0,0,0,0,0,0,0,27558,33678,0,29492,0,0,0,0,
+0,0,0,0,0,0,0,33578,1384,32071,0,0,0,11522,0,0,
+0,0,923,0,0,0,0,0,0,0,0,0,0,0,7749,0,
+37838,0,6293,0,0,0,0,39887,43135,0,0,0,0,33744,27702,0,
+213,0,26815,40088,0,20915,0,0,14893,0,0,0,0,42801,5742,13718,
+19342,21108,0,0,29724,375,24482,38012,0,0,45469,15924,34461,0,0,0,
+23732,39316,0,0,0,0,0,0,0,0,0,0,22795,0,0,31903,
+0,0,17654,0,3827,0,0,8234,0,9366,0,0,0,0,0,0,
+0,0,0,0,0,0,20282,0,0,0,0,0,0,0,0,0,
+48377,8517,36868,0,0,0,4037,25134,0,0,0,12880,0,1684,0,0,
+0,14506,0,30587,40000,42646,0,0,0,7592,13227,0,0,0,0,0,
+0,0,0,0,0,0,0,36541,0,10542,0,0,34282,0,0,0,
+0,0,40488,40917,42324,0,0,30114,0,3226,0,44535,7965,0,0,0,
+0,0,0,6,20475,0,0,0,0,0,19218,34200,0,0,0,0,
+0,0,46500,0,18394,0,12694,0,0,34746,0,12205,48405,0,0,0,
+0,0,16154,37000,0,0,0,0,0,21877,46419,0,0,0,24600,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,9027,14393,
+0,0,0,0,32056,0,0,0,0,0,0,0,4507,0,0,43771,
+16533,0,0,64,7309,0,19197,0,0,0,27745,0,0,0,29807,0,
+0,0,11246,0,0,0,0,14014,0,26223,0,0,0,0,0,0,
+10394,0,0,0,40584,0,18646,0,40658,39280,3365,23864,41724,0,16822,17416,
+3649,18076,0,0,0,0,0,0,0,0,5854,9106,12768,12177,0,0,
+40249,0,0,0,0,0,23469,6937,0,0,0,0,9359,16436,37588,0,
+0,0,0,0,39318,41742,0,41788,38599,31422,0,0,0,0,0,0,
+23143,0,0,0,0,0,0,0,0,0,0,36561,0,0,0,32254,
+0,1132,0,0,29893,30695,0,0,0,12583,0,0,44694,0,0,0,
+0,16464,17777,34052,5993,15853,47579,35104,0,19749,7991,34038,0,0,0,0,
+8638,0,0,43259,0,0,10272,36632,0,9362,0,0,0,17793,47580,0,
+0,48413,33673,0,40243,33917,0,8690,46183,2314,22098,18172,23543,0,41401,0,
+0,0,0,44663,0,36853,0,0,0,15939,0,0,0,36830,0,0,
+0,0,0,12482,37031,46198,23665,18159,0,0,0,0,7275,0,0,0,
+15468,24954,8512,1203,13923,41848,32887,8446,32817,31811,0,0,14097,8825,0,8191,
+0,22386,0,0,32468,47282,0,0,0,0,0,0,0,0,0,0,
+37968,0,0,0,0,0,0,44383,0,0,23892,0,40377,2569,0,28217,
+34328,0,0,0,0,6689,19791,0,0,0,0,0,2672,0,0,43309,
+0,38276,44318,0,13288,26884,30795,0,35843,29236,0,0,0,0,0,0,
+0,21665,46280,0,0,0,0,0,0,40489,25059,0,0,0,0,2329,
+26031,28018,0,14547,0,0,16151,0,0,0,8968,0,0,21423,21598,0,
+43760,0,30956,0,34377,0,0,0,31457,0,0,0,0,0,18207,47847,
+0,25503,0,0,0,0,16330,0,0,22262,0,0,0,0,0,0,
+14747,0,18965,0,0,0,14546,47043,13158,0,48528,40138,38942,28014,0,8097,
+35592,0,2579,14110,24453,32906,41667,0,26942,43755,0,46870,0,0,0,0,
+0,0,0,0,0,15053,4478,2921,41029,0,0,32003,25338,40585,0,0,
+48175,0,0,0,41060,0,0,8462,48888,0,0,0,0,6793,26588,35170,
+0,40124,0,0,0,0,0,0,0,22624,0,6598,0,0,0,0,
+1577,0,0,13726,0,7791,0,0,26096,4617,6776,32520,0,36145,0,0,
+0,0,0,0,0,0,0,0,0,12674,19857,0,0,2205,45906,11071,
+19567,0,0,14134,8035,42192,0,0,11298,34837,0,0,4698,36243,0,23684,
+0,0,8030,0,17298,15880,0,0,0,44481,21240,33790,40485,0,0,0,
+0,35847,0,23032,0,0,0,0,0,0,0,0,20115,0,9492,17708,
+34561,37243,0,0,0,0,27049,0,0,0,16284,0,0,31570,48339,0,
+40222,0,7057,2261,17049,29065,26706,18355,39334,0,0,0,0,0,3927,8546,
+11378,0,0,0,0,0,0,0,0,0,0,29591,15190,12588,19074,0,
+9175,34852,36248,43982,0,0,0,0,0,35312,44072,42833,11604,25472,47041,37945,
+39363,0,23569,1197,0,0,0,0,0,0,25380,23960,27887,0,0,30693,
+0,0,0,0,0,0,33795,38834,0,0,0,0,0,0,0,0,
+0,0,43081,0,0,0,0,0,0,0,0,0,0,302,3679,11455,
+28398,0,43199,0,28913,5187,10858,8068,0,22768,8713,27844,28640,39902,0,0,
+26136,0,0,0,5899,35844,46126,41964,28857,0,0,0,2774,43898,0,0,
+42527,0,0,0,15890,0,0,0,0,0,0,0,17165,0,0,16022,
+19766,29381,30325,38212,27709,28414,39179,3425,0,0,0,0,18440,30233,0,0,
+40281,0,0,42088,18470,0,47363,29636,0,0,0,0,0,0,15272,18538,
+36890,0,47133,0,0,0,39577,0,0,0,15628,0,0,16530,0,0,
+2388,7422,33687,0,10020,885,15725,0,25465,3958,19338,0,2371,0,0,860,
+36723,0,0,4558,6499,33387,0,2913,21131,33096,42371,4336,0,0,0,0,
+0,0,0,0,2069,21270,0,34953,0,0,0,35460,0,0,15733,0,
+0,0,0,0,0,0,0,20518,0,21914,0,0,0,0,12623,0,
+6146,36990,10523,24679,0,21383,0,44055,0,13948,0,0,0,0,9820,0,
+0,14988,0,0,0,14130,0,0,0,0,0,0,0,18291,0,0,
+29684,24228,20125,29467,0,30810,0,0,0,0,0,0,8396,28843,0,0,
+0,47495,0,4328,0,34844,32283,5133,31168,27370,43993,0,0,0,0,0,
+631,0,0,0,0,0,0,30961,29703,0,0,38610,0,0,0,0,
+0,43348,0,0,0,0,0,0,0,0,0,0,0,0,10174,30501,
+31669,0,47145,38747,0,0,0,0,32452,0,1252,7754,34877,0,0,0,
+0,0,28749,0,41659,0,0,0,0,24533,21309,0,6382,43670,0,27064,
+0,0,0,15626,12660,0,0,32591,31709,0,20041,0,0,0,0,0,
+21659,12204,43116,0,4510,29265,0,0,0,0,47668,0,0,15617,19015,29967,
+42012,0,20613,0,0,16033,0,0,0,0,0,0,0,1127,19287,39914,
+42957,0,5062,0,0,14501,0,34486,30710,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,39964,3464,0,0,0,0,0,
+6217,23728,18508,0,0,26460,45479,27901,0,21151,0,0,0,0,26772,0,
+0,47192,0,0,0,8552,0,0,0,0,0,0,0,0,0,23609,
+37,13887,13690,23945,38753,0,0,0,0,7931,0,37584,0,0,0,0,
+48613,0,35765,0,0,0,0,0,0,0,0,0,36628,36049,47526,0,
+1436,9272,12839,41119,0,0,21062,0,0,0,0,38895,0,0,0,25162,
+35640,0,0,0,0,3616,0,0,24577,0,17053,0,0,0,32528,0,
+0,0,0,25190,0,0,29879,0,0,0,0,12977,0,0,0,0,
+16881,37251,0,0,41123,0,0,0,0,0,0,0,0,19731,0,0,
+0,0,0,0,0,0,0,0,11744,0,0,0,13269,21804,0,4906,
+0,0,9929,26151,43865,0,46381,4217,20908,41250,0,11293,15949,21800,48780,0,
+0,0,0,47088,0,0,0,9111,0,0,6800,48104,0,0,23198,0,
+6915,0,0,0,0,0,15850,0,29550,0,1480,0,0,25594,0,0,
+5112,35952,40579,0,0,26095,0,0,0,0,0,0,0,0,23431,10969,
+37387,30243,0,0,0,0,0,0,1735,20886,0,0,0,0,1108,13272,
+12027,24316,33780,0,0,47182,0,24371,0,0,11618,0,0,0,0,0,
+4190,31455,31894,15873,31883,37800,0,0,10620,36767,0,0,0,37354,34068,16610,
+0,0,0,0,0,9410,30615,44618,0,0,0,28703,0,0,0,0,
+0,0,0,0,0,14776,39219,42818,0,0,0,32485,5759,13566,35725,22815,
+0,0,0,44842,45434,0,0,0,0,37165,0,0,0,0,0,0,
+0,0,0,0,0,0,0,6536,7045,0,13405,0,0,0,0,0,
+0,0,27618,31423,34635,0,26068,13875,42561,0,9075,0,0,18577,37677,38727,
+0,0,0,5685,20430,24994,5701,30908,41163,2326,47465,0,0,0,22165,48218,
+0,4377,0,0,0,0,26368,0,0,0,37991,0,44568,12555,0,48563,
+7121,0,0,40203,0,0,0,0,0,34093,9072,42679,44137,47410,0,0,
+0,0,0,13700,32905,25390,39215,5389,0,0,5413,13098,22457,0,1233,4116,
+0,0,0,0,0,0,0,42807,0,0,15532,0,1665,13519,18909,22813,
+34123,0,0,6770,8841,0,0,554,0,38338,9024,13086,22325,0,43113,0,
+0,0,10278,0,0,0,0,0,30622,0,0,0,33928,37812,5005,43286,
+0,33871,10084,22903,0,0,206,0,43988,0,0,39452,12171,32265,0,4844,
+38409,0,0,0,0,0,0,0,29637,46470,45636,0,1676,0,0,0,
+40604,0,38732,25178,16778,0,0,0,0,20901,0,35300,11511,0,9717,10255,
+0,0,34109,48742,0,0,0,0,38759,23428,41028,42814,44190,0,0,0,
+0,31081,45460,0,0,23065,28830,0,0,0,0,0,29953,0,0,0,
+0,14149,40355,0,0,0,36693,35166,0,0,0,0,0,27471,30763,0,
+0,24081,0,30002,26669,0,0,0,30082,0,0,0,0,48619,15140,19162,
+37481,0,0,0,0,226,2437,7766,29069,44158,0,0,0,0,32118,0,
+0,0,18077,22164,0,0,10274,0,0,0,0,0,0,0,0,0,
+0,0,48435,0,0,0,0,0,48216,0,0,0,28691,0,0,0,
+3228,18194,16734,44437,45324,0,0,0,0,0,16110,3451,37634,22495,41146,28769,
+0,0,0,0,0,0,35395,0,0,6280,0,0,0,0,0,10205,
+0,0,0,0,0,44063,21101,34088,0,36337,12251,0,10276,0,0,0,
+0,0,7136,24441,19286,14708,0,0,0,45798,46986,0,23237,10207,14675,38634,
+0,0,22230,32990,38109,10350,16430,24140,31574,0,0,0,0,0,0,6269,
+0,21093,39154,0,0,0,0,24995,0,0,0,35575,3038,0,0,0,
+22789,0,0,0,0,26781,0,0,0,0,0,0,0,0,5841,28040,
+6636,0,0,18227,15134,0,0,0,0,0,19570,27834,39100,39542,0,43424,
+0,11563,0,25440,41674,9799,0,0,20941,20960,29536,0,30104,18462,0,0,
+0,0,0,0,0,11395,0,0,0,28696,39778,0,0,0,0,0,
+0,0,0,0,9061,22436,38330,0,35675,0,0,0,0,45595,0,39287,
+0,0,0,0,0,0,0,0,0,36494,48250,0,46042,0,0,31863,
+0,8597,14946,29148,35483,0,5609,22611,0,0,0,28463,43478,0,0,1213,
+0,19534,0,0,31556,0,0,0,0,8382,15974,0,39202,10928,43456,43597,
+45452,0,0,0,0,0,21443,48115,2977,4834,42805,44082,0,0,12410,0,
+0,0,0,0,0,8364,14499,43726,1542,0,0,16075,6982,43276,0,28248,
+0,0,36120,46554,0,0,0,0,0,0,0,0,174,0,0,0,
+0,0,0,0,0,34000,0,0,0,0,0,0,0,17519,0,0,
+0,0,0,0,0,971,21690,47005,0,0,0,5043,7024,32481,37487,44955,
+0,0,22678,45914,0,0,0,0,36204,0,0,0,5552,0,19995,15283,
+30554,0,0,0,32464,44385,23281,27816,39290,0,0,0,0,0,23103,25506,
+0,0,23128,0,0,0,0,0,15514,27297,30981,0,0,2211,4605,0,
+0,0,0,0,0,0,15765,0,0,0,25131,21242,0,0,8069,0,
+0,31737,0,0,3534,38545,0,0,0,34420,0,28994,0,12705,33263,0,
+0,0,0,11463,2950,28101,43844,45625,21677,26921,29914,23370,31367,31644,0,0,
+23605,8840,3093,0,0,2223,17187,0,0,46479,19748,47716,33717,0,0,0,
+0,0,9526,0,8021,0,0,10758,19487,11074,0,0,0,45703,14526,0,
+2764,0,0,0,36497,42081,47135,0,0,42244,5913,28546,38267,0,0,0,
+0,18902,0,0,43651,0,0,43347,0,0,0,0,0,0,0,0,
+10673,0,0,0,37775,0,20301,20184,0,0,0,17943,0,43803,0,0,
+15018,0,0,17025,9424,46698,0,0,0,0,12534,16700,25985,27527,44967,0,
+0,19046,0,0,6414,0,7074,0,0,0,0,0,41530,0,0,0,
+0,21612,21825,0,0,0,0,0,0,26509,0,0,33249,36836,0,7135,
+0,0,0,0,6980,5946,5571,0,34868,0,0,0,0,29747,0,0,
+0,0,0,0,0,0,0,0,9651,11108,17525,25363,33399,48010,48514,24979,
+0,0,0,35493,0,48343,0,27536,0,0,0,2649,0,0,0,3899,
+31368,32763,47877,0,0,0,3318,0,0,7768,0,0,0,29754,0,0,
+19268,0,22985,0,0,12643,27544,29162,0,0,0,0,0,0,3489,43206,
+0,0,12313,0,0,0,1834,24991,0,0,0,0,0,0,0,0,
+0,14705,8696,23972,0,195,0,0,0,31752,46689,0,0,0,0,0,
+0,0,28868,8478,20248,41639,0,46699,0,0,0,0,0,0,0,0,
+0,12973,0,0,0,0,0,0,0,7796,0,0,0,0,0,0,
+34055,30545,0,0,0,0,45307,0,990,0,0,0,0,2160,0,48518,
+29200,0,414,0,27426,22124,0,29161,0,0,26593,0,18552,31196,0,0,
+0,0,0,37627,48800,23713,1960,0,25756,0,10596,0,0,8589,40650,22657,
+32624,2191,8871,26763,4302,38323,0,22981,0,31189,0,0,18961,0,10993,31153,
+0,27612,0,0,9132,14972,43915,0,0,5852,0,35743,47360,31715,48730,42193,
+37801,0,0,0,43991,0,41597,6086,17263,44081,0,0,35986,40433,0,0,
+0,0,0,810,0,0,34938,40806,0,0,0,0,18608,0,0,640,
+45504,0,0,0,34445,42127,0,145,0,0,10123,41110,0,0,0,18140,
+0,3579,0,0,0,25314,0,0,0,0,0,0,0,0,42908,0,
+12168,32523,0,0,0,0,0,0,22784,0,0,0,12118,0,0,0,
+28908,0,0,0,0,0,0,0,0,19135,0,0,0,5805,0,0,
+4418,34586,0,16894,0,0,0,0,0,0,0,0,0,2143,28549,29542,
+22507,37093,0,0,36010,44799,0,0,0,0,0,0,41527,0,0,0,
+0,8519,0,1709,0,0,1471,15119,0,0,0,0,0,0,0,0,
+0,0,0,0,3103,12545,41922,0,0,0,0,3441,0,47071,0,0,
+12616,35790,0,0,0,33221,0,0,44784,0,0,0,0,0,0,0,
+0,9550,35971,29017,0,0,0,0,0,25595,0,0,0,0,33350,0,
+10647,0,8421,0,0,0,0,0,29924,38648,21064,0,0,0,0,0,
+21985,0,17409,0,0,0,0,0,0,0,0,19049,31784,43320,18670,36896,
+0,0,0,0,0,0,37551,40173,24602,0,0,0,0,34846,9243,42002,
+0,13965,29690,9250,0,13358,17371,29537,0,0,0,0,21900,46799,0,32807,
+5544,38215,0,0,0,0,0,0,0,0,38710,0,0,28615,30435,38058,
+0,15547,17422,0,0,0,33901,7417,0,0,19687,10330,35632,47430,7365,0,
+0,0,0,0,0,0,0,0,1071,9167,30019,20165,20583,30373,30174,29076,
+36608,0,1498,0,13594,30702,0,0,40117,0,42198,0,0,0,37878,0,
+0,0,0,0,2928,4014,35048,27306,42362,0,6006,0,0,0,29729,0,
+0,32269,0,0,0,0,0,7298,27418,0,37305,0,0,0,0,0,
+0,45744,0,0,0,0,0,44059,26693,8644,20542,37967,38439,23194,13118,42508,
+0,0,0,0,0,36525,0,0,0,0,0,0,32036,24678,0,0,
+0,0,0,0,2899,6734,36875,12405,5386,0,0,0,30346,42238,0,0,
+26098,28982,0,0,40890,0,0,0,32661,0,30857,48506,0,0,0,0,
+0,0,0,0,0,0,17287,0,0,0,0,0,0,0,0,0,
+0,0,0,15531,0,0,27176,0,0,5162,0,0,0,38249,0,0,
+0,0,0,0,0,0,0,0,47638,47796,0,0,21377,0,43187,0,
+0,46788,0,0,0,28150,46611,0,42654,0,0,0,0,14267,0,41981,
+45907,0,34364,0,0,0,33071,0,0,40294,41802,47046,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,6474,39230,
+0,0,0,0,0,0,0,0,39942,29883,0,0,0,0,31489,0,
+0,20357,42422,0,1054,41349,0,34043,0,34691,0,0,0,44465,0,0,
+0,0,22517,0,30524,0,0,0,695,0,0,12903,12414,23711,0,30667,
+0,0,0,27025,38670,0,12842,37571,0,26331,0,48765,0,0,0,3528,
+294,8497,21442,0,0,8369,1982,16392,31006,0,0,42459,0,0,22274,36736,
+0,0,1472,27575,46273,0,14856,0,0,0,0,0,0,0,0,5917,
+29974,0,0,0,0,0,0,8847,10464,48647,6616,24759,0,25737,0,0,
+0,0,0,0,33423,0,0,0,0,0,41732,0,36350,0,0,0,
+0,39965,12102,25691,0,0,0,0,8692,27743,0,0,0,0,0,41325,
+42629,0,0,0,0,0,13361,0,0,0,27518,521,0,0,0,16834,
+0,27466,0,0,0,37769,0,0,44516,20905,28810,0,0,14087,0,0,
+0,0,0,0,0,0,0,0,0,19647,0,38572,0,4261,29415,42183,
+0,0,0,0,0,0,0,0,24471,2338,8373,0,28100,13089,0,0,
+43446,15550,0,21593,26628,0,0,0,344,6095,0,21923,27153,45622,0,0,
+27078,7772,45517,0,0,29142,30240,33936,0,0,20949,28465,1627,0,0,0,
+32789,27248,31231,0,0,12220,0,0,11263,13046,0,26538,0,0,0,46173,
+0,3711,18721,0,26308,29205,0,0,0,0,6566,26651,44203,0,29708,0,
+21476,0,32173,23163,0,38734,0,0,28698,0,0,0,0,0,0,0,
+0,9871,0,0,0,16217,0,32008,2608,0,0,24396,0,4182,0,0,
+0,30229,2948,48492,29183,0,0,20774,22967,19271,0,28863,0,23992,0,0,
+33138,37648,46112,42608,29656,0,17199,20370,0,0,0,5990,6409,37417,45345,4138,
+22769,0,0,2835,39212,0,34108,48030,0,0,0,0,0,0,29943,0,
+48361,0,0,0,0,0,0,0,0,19378,30651,5671,0,0,0,0,
+0,0,0,8909,0,13597,0,0,0,0,0,0,24041,36404,16252,0,
+0,0,0,0,0,18088,0,19991,35237,0,16774,30756,25544,0,48464,10836,
+31024,30155,44812,0,0,0,0,23286,39395,0,4979,0,0,0,0,21770,
+44522,0,22215,0,39600,0,0,0,0,0,0,0,0,0,0,0,
+0,0,44456,40440,0,0,0,0,0,41780,28007,3658,29464,18454,0,0,
+0,0,0,0,0,9933,0,0,0,2787,0,0,0,28826,0,7418,
+0,0,34042,0,0,0,6366,0,0,0,0,0,0,0,45303,0,
+0,10557,29019,47782,0,36388,537,0,0,0,0,0,0,21458,0,0,
+0,0,0,0,0,0,0,0,0,33500,0,0,0,0,12986,36027,
+0,0,0,31663,0,847,12663,24806,0,0,22689,0,17000,0,0,0,
+0,34675,17131,35366,0,25081,30489,13886,48075,0,18564,0,0,0,0,16719,
+0,0,0,19739,30487,0,0,0,1105,39126,0,30690,0,0,3694,0,
+0,0,0,23805,0,33994,4542,0,0,0,0,0,0,30493,26347,39370,
+0,0,3305,0,0,0,41872,0,39471,0,0,0,3505,0,1587,0,
+0,0,0,0,0,0,0,19593,0,48043,0,29379,0,12461,0,0,
+27864,18466,28567,0,25632,0,22104,0,0,37919,37181,0,29375,0,0,0,
+0,15794,0,14595,25109,0,0,0,7441,0,7646,0,0,0,17959,25880,
+31293,0,0,17495,19646,0,22773,0,0,0,44151,0,0,36734,0,0,
+0,0,0,0,0,0,0,0,0,26557,0,0,0,4006,22522,46027,
+47014,0,0,0,14329,40880,0,4354,0,0,792,0,0,0,6718,21732,
+26161,27707,28023,36374,32993,42522,46270,0,0,4654,20249,25656,30073,37020,0,21014,
+0,27798,13748,34567,0,0,0,23355,0,0,0,0,0,0,37191,0,
+0,20048,37473,985,0,0,0,0,0,0,0,0,0,46674,0,6362,
+0,6529,0,0,0,0,721,13606,0,41975,16377,17074,2612,12505,32484,29679,
+43005,2369,44718,0,0,0,0,27054,0,0,0,0,0,45797,0,0,
+0,37592,28314,0,0,34727,4938,8742,15038,29332,0,0,33525,0,0,0,
+19838,42359,13521,0,0,0,0,0,13903,30409,0,0,0,47449,0,20595,
+33053,0,5822,18409,2844,3266,43661,43813,0,1694,0,5100,34556,0,0,0,
+0,27960,33073,0,0,0,11531,0,0,0,29959,0,0,0,0,0,
+0,43704,15402,20453,30312,0,0,0,0,0,0,0,1201,0,8071,0,
+0,0,0,36453,15769,0,1367,0,0,0,0,0,46631,29598,0,0,
+0,0,18081,0,0,0,0,41298,0,0,0,16164,43377,0,0,0,
+0,0,0,0,0,22498,45640,31143,12061,0,0,7437,0,0,0,3670,
+32158,0,0,26802,0,12372,9599,23541,0,4344,23987,0,21556,35990,24258,0,
+15130,0,3985,20386,0,34250,6096,39507,4058,21111,0,0,0,0,24237,30149,
+0,0,0,0,0,0,0,0,37015,0,0,0,0,20622,0,0,
+0,0,0,0,0,26821,8311,0,10031,0,0,0,7816,45745,19003,0,
+0,0,0,0,0,0,32583,0,0,20121,0,0,0,47311,0,0,
+0,7769,0,0,8619,0,0,0,0,0,0,0,4087,27684,0,6174,
+0,9965,14728,30942,0,0,0,0,0,0,0,30700,0,13530,15629,28553,
+0,0,0,48503,35792,10258,0,0,0,0,0,0,23719,24615,48487,0,
+16647,46428,0,31430,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,6349,0,0,25898,0,0,0,2867,42669,0,30976,0,0,
+16884,27888,41461,0,0,9187,0,37462,20363,39752,0,0,0,32589,0,0,
+5508,36391,0,0,0,0,12247,18567,0,0,0,0,0,0,0,48410,
+0,0,0,23396,2446,17004,31447,0,0,0,46453,11848,28449,38526,0,31292,
+0,0,0,0,0,0,0,0,0,0,36969,0,6005,15260,5216,0,
+28689,42195,0,0,19010,0,43018,0,0,12902,43429,0,19394,0,0,26038,
+39181,0,26104,0,0,7336,0,0,18056,2186,33280,39111,47464,0,0,35110,
+6291,0,39810,0,0,48080,0,0,0,47386,0,0,0,0,0,40181,
+8532,15593,0,0,0,21764,0,16216,0,514,0,8506,42230,0,0,39159,
+22352,18779,17508,1889,2075,46709,48542,0,0,0,0,0,0,28173,19902,0,
+0,0,0,24195,0,0,17274,37638,0,0,0,24168,47751,7221,47955,0,
+0,0,0,0,40751,44985,0,0,0,1722,22627,25018,0,13528,20261,0,
+0,0,0,0,0,0,0,11968,8853,0,0,0,0,0,0,21616,
+0,0,0,0,0,20412,0,0,7619,0,0,0,0,0,19496,3791,
+0,0,0,0,0,0,21273,0,32055,0,0,13671,44209,0,0,0,
+0,0,0,0,0,38539,0,36656,0,0,0,0,0,0,5204,0,
+0,0,0,0,0,0,0,5316,0,412,4049,9658,0,0,0,7562,
+0,0,0,29041,0,12068,0,0,0,13839,0,47945,10579,0,0,0,
+0,15058,28776,15047,48887,0,0,40045,0,0,0,0,27495,4724,42864,10916,
+12225,0,0,0,0,20375,0,10999,18789,0,0,0,0,0,0,0,
+0,0,0,27067,0,0,0,6396,25039,10310,0,19548,0,16598,8949,0,
+32808,0,6653,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,14565,0,28011,8457,36914,40076,8862,26261,0,23259,46755,0,
+24684,22950,0,40431,0,0,0,34995,0,46306,0,0,0,0,0,38624,
+0,0,4914,6031,0,0,0,0,0,1999,0,0,26000,0,22788,0,
+48856,36903,48497,0,0,19023,0,0,0,0,0,37406,0,30417,0,0,
+0,0,0,23721,48537,0,0,0,15627,13232,0,0,48320,0,4891,48499,
+19617,0,0,0,0,0,4620,0,0,170,0,43267,0,14647,0,12317,
+0,0,13863,17258,0,38553,0,0,26597,30195,0,0,43174,0,0,0,
+10238,0,44329,46803,5496,20497,28528,28832,0,20204,32301,0,9854,0,46804,0,
+11795,0,0,44669,0,0,0,0,25686,0,0,0,6021,46314,0,32250,
+0,0,0,0,0,0,13656,0,0,0,0,0,0,0,0,0,
+0,0,0,46716,0,0,21991,43669,47604,0,36908,0,2274,43680,0,2534,
+107,0,0,37385,0,0,0,0,0,0,0,2600,10153,33642,44864,2427,
+13652,0,31440,0,0,0,30411,0,0,0,0,0,0,21952,0,0,
+0,11107,0,22469,0,7403,11328,18085,23554,0,0,6317,0,0,0,0,
+0,0,1034,0,34814,0,0,0,0,0,31977,0,17042,10826,32922,33568,
+46127,13593,0,0,0,0,0,0,25208,0,0,0,0,0,41438,2312,
+12617,4111,42771,0,0,0,0,0,0,0,0,0,0,28941,0,0,
+31184,0,1214,0,0,8076,0,0,0,0,6594,21345,33412,0,0,14213,
+0,0,0,0,37735,0,0,0,0,0,0,0,44222,0,0,44235,
+0,10121,16544,23491,0,0,0,0,40667,0,0,0,1705,0,0,0,
+0,17928,0,0,2046,0,0,4068,0,0,0,0,0,0,47137,40516,
+0,4686,47457,0,0,0,0,0,0,40266,0,0,0,0,0,18807,
+0,0,0,0,0,0,0,0,0,0,0,0,0,35295,0,0,
+0,0,14194,1135,0,0,37307,26490,0,0,25272,30924,0,0,16798,0,
+0,0,26582,0,0,0,0,0,0,28302,0,0,0,0,0,0,
+0,0,0,0,33286,0,0,25148,38538,34456,0,0,39449,0,0,8356,
+45256,0,0,11925,0,0,0,5620,0,0,18162,5847,36356,15739,0,0,
+8624,0,0,0,0,0,0,0,0,0,0,28603,0,0,0,33089,
+10840,33875,0,0,0,19420,0,0,8631,8013,0,0,0,13362,35693,0,
+0,0,28221,39986,0,39410,9115,18528,20480,29127,47874,0,0,0,0,40867,
+0,0,4831,356,0,0,0,16469,28495,0,0,0,0,32573,0,15460,
+12575,20983,39463,0,0,0,0,30664,38596,0,0,0,0,0,0,0,
+8859,0,0,0,0,10945,0,40796,0,10072,27870,0,0,28408,43016,0,
+0,0,0,7852,0,0,7879,11641,16359,27768,0,0,0,0,0,26430,
+14644,0,0,0,0,28425,0,17646,19967,12242,26310,27584,0,0,24213,0,
+0,0,0,0,0,0,0,0,15173,0,34380,0,22510,33307,0,8298,
+47092,0,0,0,0,32885,13264,18959,0,0,0,0,0,23888,0,0,
+3520,44286,10463,0,0,17538,699,24511,41508,0,0,35245,0,0,26730,0,
+0,0,0,32416,0,27786,36343,10458,48015,0,0,0,0,0,0,0,
+0,0,0,0,0,0,3554,0,0,0,0,13649,38516,27463,0,0,
+0,0,0,44356,0,0,16319,19409,0,0,0,0,0,0,0,39534,
+0,15049,0,0,0,0,0,0,7550,0,47902,46100,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,6933,31797,0,
+0,0,0,0,0,0,0,5038,1218,13565,0,0,0,0,0,0,
+0,0,0,0,0,30675,25525,0,0,9069,14578,3339,6009,29740,0,0,
+0,24951,18928,20080,0,0,0,13990,0,32193,46363,26748,0,33229,0,0,
+30404,37114,0,0,0,0,0,0,0,40296,0,0,7990,24405,0,0,
+0,0,0,42194,0,0,15227,568,8698,16434,0,0,0,0,0,11274,
+3741,40200,47040,0,0,0,0,0,0,23481,36036,24886,21178,0,47975,33778,
+0,0,0,17626,0,0,19653,0,26447,0,36543,3993,0,0,0,0,
+418,26848,0,0,0,0,0,0,6420,11438,28997,42884,0,0,4123,0,
+0,0,0,7625,22149,36943,38772,31809,0,0,11580,38131,0,0,0,0,
+0,0,0,0,0,12142,17679,0,0,0,0,3870,39838,0,10387,0,
+1535,32638,0,0,0,0,0,11014,0,20486,0,26106,30438,28227,0,0,
+27040,36636,0,9907,30498,35064,0,25391,0,0,0,43378,0,0,0,5957,
+15537,23055,41054,45383,0,0,0,0,7928,21255,7676,47104,3159,30670,0,0,
+0,0,0,5987,0,32308,18511,26224,32933,38083,0,0,0,41025,0,0,
+40720,16618,0,41015,0,44098,0,0,7034,2208,0,0,0,36699,0,25654,
+19302,0,0,11959,0,9372,8919,34221,0,16836,0,0,0,0,24707,0,
+26737,35227,36066,0,21983,0,0,29338,0,0,0,0,0,0,26274,46998,
+48345,6152,12923,23192,25375,25998,39090,47415,11381,43048,0,23400,0,0,0,36446,
+12328,38535,39223,0,0,0,0,0,3510,0,21686,28038,45197,0,0,0,
+24742,8940,29285,33913,43839,31897,0,0,0,40100,7722,23056,2321,0,35546,0,
+0,0,0,29459,0,0,0,3121,3877,44587,0,0,0,0,45896,0,
+0,6661,12749,14541,21698,0,4364,0,0,45183,26991,0,0,0,16862,0,
+0,0,24412,0,0,0,0,0,0,0,47799,0,0,0,0,0,
+0,0,21754,0,0,47764,0,0,0,42760,0,42223,5495,29410,46740,0,
+0,22391,0,0,0,0,0,0,0,5564,26859,0,0,12771,0,23932,
+0,0,0,0,0,18560,41642,39435,41243,46296,0,0,40777,0,29837,0,
+0,1813,45720,0,0,0,13392,9183,0,0,0,34047,0,0,0,0,
+0,26376,0,0,18006,0,0,15996,0,0,0,25582,0,0,0,31539,
+0,0,8029,22504,24681,38155,19210,8375,22195,36910,21416,5183,40812,24778,5454,34961,
+36998,0,0,32134,0,2090,0,23402,0,0,0,0,15534,0,41488,23860,
+33726,23996,0,0,8451,47478,0,0,0,0,45202,6235,0,0,0,0,
+0,0,0,33047,0,16412,0,17694,0,0,0,35188,0,4541,0,23738,
+0,0,0,0,12319,13015,0,0,0,0,6502,0,0,0,0,8107,
+0,20747,0,0,0,40064,0,0,0,25645,0,0,0,8336,0,0,
+0,0,0,0,0,0,0,0,0,34256,0,0,35674,42851,0,0,
+41057,5666,0,46285,0,0,36838,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,37130,0,0,25929,0,
+10316,0,343,0,0,0,6888,0,0,0,0,0,34860,0,0,0,
+0,0,0,2975,0,14680,19759,26025,28714,14818,0,0,0,0,41070,20207,
+0,41390,12075,0,0,0,0,9836,34313,0,0,33098,0,10625,44575,0,
+0,0,0,0,0,16661,38163,0,0,0,29670,0,39612,0,0,47927,
+0,0,0,0,0,29055,0,0,29005,0,1606,0,16815,0,0,0,
+0,0,0,0,0,0,0,0,0,0,3450,29507,0,0,0,0,
+44071,0,0,0,45433,20225,3612,14026,3785,17715,36118,0,4860,48327,0,0,
+45454,0,2317,0,0,0,0,0,0,15998,18535,23342,0,0,5440,2818,
+44743,0,0,0,0,0,0,26910,0,0,40966,0,0,0,0,0,
+0,0,24039,0,0,35001,0,6462,0,8422,32366,33209,0,3098,0,36813,
+12032,0,21798,12950,22242,0,0,8832,24924,0,0,26941,0,34203,0,0,
+4358,0,0,0,0,4145,0,43788,0,0,0,0,0,34354,0,0,
+0,0,0,32902,0,33809,48129,5031,0,0,0,15848,0,0,43416,0,
+0,45997,0,0,0,0,0,0,0,19858,0,0,0,0,0,0,
+0,0,0,0,30777,0,0,0,15184,30069,0,0,0,0,28341,0,
+0,47068,0,31256,0,0,19250,22544,26963,0,0,0,0,0,2305,0,
+12641,41276,0,0,0,0,0,0,0,23635,0,0,0,0,0,0,
+0,29784,34549,0,27521,0,902,6301,22218,38862,44520,0,15203,0,0,22791,
+16577,23253,25925,0,39296,0,0,25524,7908,11493,40623,46215,0,0,35749,41729,
+26398,0,0,0,0,3538,0,0,0,0,0,0,28517,0,0,0,
+0,28281,0,0,0,0,0,9720,0,0,0,7491,0,51,0,0,
+0,0,17490,0,36464,0,21199,0,0,0,0,22462,0,43247,0,0,
+0,0,0,8720,23630,12871,8020,20973,23104,29043,30074,0,0,0,40495,41228,
+10823,12115,0,0,8851,0,0,0,0,0,0,0,0,0,4327,341,
+11441,44397,0,0,0,0,0,0,0,0,0,2622,47446,0,7113,0,
+0,46283,13766,0,0,42873,0,39673,14652,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,18447,0,0,16068,21614,2998,30223,0,
+0,0,0,0,43611,7847,0,14732,0,0,47836,0,6976,20354,39293,0,
+0,25477,24867,25540,0,3408,21824,0,39130,0,0,0,0,0,16829,0,
+7721,0,22823,0,0,0,0,0,0,25587,0,0,46074,7181,0,0,
+21438,38620,0,0,27670,0,0,0,0,0,0,0,0,33434,0,0,
+0,29900,162,11616,27490,35027,48496,0,18628,0,30928,34191,0,0,0,0,
+0,41648,0,0,0,0,45062,22783,19260,0,13355,9348,32935,21000,33896,45401,
+0,0,2176,0,0,0,0,2346,38840,43747,0,16051,45772,0,0,0,
+0,0,0,7683,0,0,0,26463,0,21865,23193,38962,0,0,40098,0,
+46118,0,18662,0,0,9617,0,22011,0,17520,0,0,0,0,0,0,
+0,0,0,0,20751,0,0,0,0,13315,22595,19387,45347,47531,2656,0,
+0,0,0,0,0,0,0,0,0,0,12957,0,0,0,0,0,
+2304,0,0,480,0,0,36748,42655,0,0,0,39106,0,9376,0,0,
+0,22411,42229,0,0,14534,0,2900,0,44673,47242,0,0,0,0,9971,
+0,0,0,44349,0,0,24090,0,0,12232,44863,46623,0,0,0,0,
+0,0,0,26328,34855,0,0,11575,39061,16413,47979,0,22382,0,1011,16563,
+1101,2224,17577,0,0,0,21428,7711,0,48717,0,0,13010,0,0,0,
+1363,30866,26410,0,17481,0,0,0,0,37153,0,0,0,23625,0,0,
+0,0,0,0,0,0,0,0,0,7102,46463,0,0,0,0,0,
+11617,0,0,36463,0,0,0,30759,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,24608,33191,0,0,
+0,0,20547,234,45110,0,0,0,48246,18250,0,44922,3315,0,9256,13483,
+0,0,0,0,0,41765,0,11178,0,0,0,0,0,43646,7397,10374,
+23545,31065,0,225,38044,0,0,0,28081,0,0,0,0,29964,0,0,
+0,5330,0,0,0,318,633,0,0,0,0,0,0,39142,0,0,
+48776,0,43154,0,0,2351,0,1868,0,0,0,15229,0,0,0,0,
+0,0,0,0,34728,0,40450,0,0,0,0,0,0,43493,0,564,
+14544,0,0,12450,6988,0,41147,17779,31790,0,0,44195,0,30485,22723,8195,
+30505,0,0,0,0,0,0,6004,22762,0,0,18495,47341,0,21609,43715,
+0,21143,10742,0,5529,0,0,0,0,0,0,0,0,30258,0,0,
+47335,0,8372,15982,0,45061,19645,0,0,26623,8317,12709,44804,0,0,0,
+0,0,0,0,0,0,0,0,358,18725,0,0,0,0,0,1663,
+26112,28907,0,0,0,0,0,0,0,0,0,0,12883,0,44323,0,
+5796,0,0,7322,0,0,0,7810,0,0,39489,48493,44755,19242,40101,46521,
+0,9475,9773,8040,22528,39451,0,0,48459,20784,4788,26584,32890,32218,0,0,
+47252,26333,0,0,0,0,16797,0,0,0,0,43823,0,14336,0,0,
+0,0,0,30097,0,0,0,0,0,9991,0,12516,0,0,0,0,
+25516,0,0,24872,19678,46654,0,0,31657,0,0,0,14572,9145,0,0,
+34622,0,0,0,14753,0,0,1544,0,0,0,15802,0,0,11806,850,
+0,48074,0,0,10262,0,0,0,14111,40349,41849,0,5689,16097,0,0,
+4254,0,0,0,0,22153,18523,20377,26155,42686,0,0,0,0,0,0,
+0,0,0,0,21149,0,0,0,0,12228,0,0,0,0,0,15829,
+25468,34036,0,42958,17033,27364,0,0,0,0,0,0,0,3203,0,0,
+0,0,0,0,0,0,45730,48770,0,0,0,14868,0,0,0,41051,
+0,0,0,32839,42727,0,17789,8630,19938,22606,27940,42045,0,0,36138,0,
+0,0,0,0,0,0,0,30239,0,40077,25924,0,38642,21584,28526,44757,
+0,0,0,15276,33247,0,0,0,21210,0,0,37622,42201,0,0,41624,
+0,48809,35835,13190,0,18888,0,0,0,0,31350,0,0,28220,39398,0,
+34599,0,16478,0,17510,0,0,0,0,0,0,0,0,0,0,30135,
+35164,28622,0,0,0,7785,0,0,47392,0,17372,0,0,0,13256,0,
+0,0,0,0,0,0,0,47431,38137,0,0,501,44703,0,0,0,
+0,0,0,0,0,0,16007,16391,32862,43624,37434,41027,0,5280,18173,0,
+0,0,0,0,21376,0,0,0,0,0,0,0,40818,0,0,36246,
+0,0,0,14195,0,11041,0,0,0,14378,0,0,0,1929,23365,0,
+0,0,46648,0,0,0,35142,34775,0,20311,0,0,0,0,0,0,
+0,4455,3444,0,0,45427,0,0,16301,19048,0,0,0,8542,0,10002,
+0,0,0,0,0,0,0,25029,5585,22859,40565,10022,45209,40953,19841,0,
+0,38129,0,0,0,0,6477,0,0,0,6040,0,7462,18369,43542,0,
+0,0,0,27893,774,38601,99,41045,45285,0,0,0,0,0,0,0,
+0,0,0,0,0,4415,0,0,34087,1943,21717,39677,26148,7195,13673,0,
+0,0,0,4329,1125,17996,19916,34869,18072,43311,0,0,5292,17226,18641,20878,
+37830,0,39086,25948,24368,0,33791,21607,0,0,0,32758,0,0,0,0,
+0,40986,0,36877,46904,0,0,28728,0,25745,0,24667,41564,0,3586,714,
+0,0,0,0,0,0,1896,0,0,0,36261,24884,0,17999,0,0,
+0,4672,0,20732,3140,6639,27711,0,0,0,0,0,26894,40531,0,0,
+0,0,0,42773,0,0,0,17308,0,0,0,0,0,0,0,0,
+3539,0,0,0,0,0,0,40862,0,0,0,16848,30445,35620,0,0,
+46066,0,0,0,0,0,7216,33452,0,0,0,0,0,23018,0,28661,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+19256,0,0,17322,0,0,31785,43767,14783,8520,30896,0,0,0,0,0,
+32812,0,0,0,0,0,0,0,0,0,0,0,0,0,3256,42852,
+42898,48882,0,43368,0,9127,0,0,32016,0,39835,0,47438,0,0,30165,
+0,0,0,9743,30419,0,0,0,48105,0,0,0,0,0,0,21470,
+0,0,0,6115,0,0,44109,0,0,0,0,44531,0,0,0,0,
+5857,1475,4719,29567,29873,35202,36043,0,0,0,0,45178,0,0,0,0,
+0,46258,0,0,23918,0,0,47863,48382,0,28639,0,0,0,4689,42845,
+0,12490,0,0,0,0,43998,0,0,5984,0,0,26485,25193,38123,40019,
+0,11271,23646,32089,48119,34410,0,33802,11984,0,0,38604,0,0,0,27725,
+0,0,0,0,0,24858,0,43070,0,48005,22812,38308,0,0,0,29181,
+0,0,0,0,0,0,0,35013,45535,0,0,19376,18276,35547,0,0,
+0,0,0,3104,0,0,0,0,0,14639,0,0,0,0,26611,41775,
+0,0,0,0,0,0,0,0,0,0,9284,0,0,1129,0,11672,
+7388,20862,25273,31131,42432,0,0,43528,32471,0,0,33246,0,26637,0,27200,
+0,0,0,11698,0,0,35735,0,0,0,0,43546,0,0,0,0,
+10461,0,0,0,0,20686,0,0,0,0,0,0,7132,15268,46813,0,
+0,0,0,0,43327,0,0,0,0,22261,0,0,0,0,0,30975,
+7998,36675,40753,12557,0,0,0,0,0,0,16179,0,0,0,14943,0,
+0,43983,32436,0,0,0,1877,13940,0,0,0,0,0,0,0,0,
+39403,38419,7858,39204,0,0,0,0,40130,0,0,0,0,0,0,0,
+0,0,0,0,13234,0,0,15449,0,0,22779,0,19814,0,0,0,
+9073,15395,0,30536,0,0,9572,0,0,6479,0,0,0,10422,19131,24816,
+0,0,0,0,0,15359,0,0,1347,2070,0,0,0,0,0,0,
+0,0,0,0,0,41420,3921,12889,29752,32705,36488,0,0,0,0,0,
+42385,0,39164,48879,0,0,0,18344,0,0,0,0,20488,0,47287,0,
+0,0,43862,14099,0,18217,25896,41993,0,48520,0,0,0,0,0,0,
+0,8830,0,0,0,0,42611,26018,0,45556,0,0,20074,18075,0,0,
+1609,0,0,0,0,1752,0,0,0,0,0,10425,14403,28681,41778,0,
+14265,0,0,0,0,0,0,0,0,0,1439,2373,26682,28656,47255,0,
+33992,0,0,0,48531,0,0,2268,43426,45792,47413,0,0,0,30730,0,
+0,0,0,0,0,0,0,0,428,0,34647,0,16773,0,15662,7820,
+0,33330,43598,0,0,0,0,0,0,22040,0,0,0,38334,0,39469,
+0,0,0,0,0,0,0,34738,0,0,0,0,26372,46079,0,0,
+0,15539,0,0,3130,0,0,23567,0,0,0,0,0,0,14039,0,
+0,0,0,33655,0,0,0,10555,23806,0,0,0,0,0,20471,0,
+0,0,47028,0,0,46290,0,0,0,0,0,0,38189,0,0,0,
+0,18360,42056,42785,0,8393,4645,0,0,0,0,0,0,17903,0,0,
+0,510,0,0,0,2220,36598,0,18507,20845,30143,0,47223,0,0,0,
+0,0,0,0,7802,18377,0,0,5963,0,0,0,37647,7581,40115,0,
+0,0,27461,38952,0,12689,9519,2121,20898,42806,1787,0,17571,3358,0,24163,
+39533,0,9570,555,6778,9046,11276,27545,0,7567,19689,34465,45092,0,0,0,
+0,1407,27680,0,0,0,0,0,0,0,0,32917,0,40053,945,12492,
+26488,36432,0,0,0,0,0,6909,0,0,0,0,0,0,0,0,
+8060,48006,0,0,0,6613,0,40518,0,0,0,0,1865,0,0,0,
+0,0,0,0,0,0,0,0,0,0,14050,15605,0,0,0,0,
+0,0,0,26317,0,0,0,0,11804,20454,38651,0,0,0,0,0,
+0,4146,32952,46910,0,0,0,0,0,0,44859,30790,40017,0,0,0,
+0,0,0,0,16492,0,0,0,0,0,26713,35361,36323,0,0,21356,
+16543,19057,32240,48543,0,20656,28369,28490,0,0,0,0,43698,0,0,33593,
+0,0,0,0,15453,1739,9114,0,0,0,0,21321,40977,0,0,0,
+0,0,0,0,0,23566,0,0,28531,46828,28525,0,0,47755,0,0,
+0,0,0,0,0,0,5886,27821,40541,0,0,0,22050,0,0,0,
+0,0,41825,42135,19146,0,0,0,0,0,0,0,2912,0,43356,47373,
+0,12215,0,0,0,0,3814,21970,43682,25758,0,33677,0,0,0,0,
+0,0,0,0,0,4028,7606,0,5558,0,0,4448,4047,5566,37135,19224,
+21778,0,17966,0,0,0,14910,874,15076,30495,14971,38793,36856,0,0,27710,
+44924,25360,0,0,30211,0,0,0,0,0,0,0,0,0,41069,0,
+0,0,0,0,6623,39559,0,25164,33631,0,17038,0,0,27012,0,0,
+11458,0,0,0,37925,22968,37202,23154,0,0,43222,0,13592,26220,48894,0,
+0,0,0,0,0,0,11887,9732,0,4427,3385,0,0,48828,0,32500,
+0,43644,0,0,27216,21114,0,0,0,0,29938,0,0,34509,47180,29257,
+0,0,0,0,0,0,27486,35589,0,0,0,0,35095,0,0,0,
+0,0,16244,37166,0,0,0,0,0,36850,17242,0,0,314,0,0,
+0,36401,45531,0,0,0,0,8216,43517,0,7361,29981,0,0,0,19266,
+19674,41903,9881,0,0,12289,0,27706,0,0,36851,0,0,0,0,0,
+41443,0,0,21346,0,7896,0,0,0,29384,10340,38358,0,0,0,6863,
+0,8385,0,0,39440,4171,27623,18869,37298,29932,21627,10222,0,0,0,15383,
+0,47842,17070,0,5422,0,0,0,18218,0,0,0,0,0,0,11013,
+31145,0,0,44541,0,0,0,21115,1277,0,0,0,0,0,0,27282,
+0,25894,0,0,0,17011,0,0,0,0,36048,0,46135,0,0,0,
+0,46241,20017,0,0,47395,0,0,11551,38204,0,0,1499,0,6331,26734,
+34460,9730,26281,23216,32013,30488,35845,39019,42248,45568,0,0,8074,10640,18225,0,
+0,30470,16704,0,0,0,25283,27307,0,0,0,0,34479,40904,0,0,
+0,4219,0,0,0,0,0,31386,0,0,35337,0,0,17320,3868,20817,
+0,48498,0,0,0,0,0,0,0,10484,18622,45892,46461,0,0,0,
+0,0,0,21758,0,0,15940,0,0,18349,0,303,0,16702,42546,0,
+0,0,17603,0,0,0,0,43932,0,25042,39122,0,0,18043,0,0,
+0,9104,0,0,0,3320,0,0,0,19710,0,21938,0,0,0,0,
+39948,20304,25492,0,19365,37739,4127,28896,0,0,12003,0,0,1941,34546,0,
+0,0,10561,0,38367,0,0,0,5037,47292,9092,0,0,0,20287,6907,
+0,1284,0,0,41074,0,29287,39901,29833,35825,0,0,0,14691,0,17689,
+0,0,0,1290,0,0,0,0,0,0,38653,0,0,0,0,0,
+0,0,0,5925,0,0,0,28089,0,0,0,0,0,0,0,0,
+0,0,26936,0,0,25299,0,0,0,35757,23344,0,9203,3088,26507,11506,
+13818,25819,0,0,0,0,0,0,0,4632,0,0,0,0,0,0,
+35972,30872,0,0,0,0,6898,0,0,0,0,39006,17604,14756,19603,26042,
+9102,31716,20183,32908,43922,0,0,21932,0,47855,0,0,0,0,0,43874,
+16479,26668,0,6872,17304,0,0,0,31508,6082,17269,24961,17834,0,0,0,
+5020,0,3397,39341,13669,0,16671,0,16030,22696,0,0,46277,7008,40240,0,
+9707,38971,36738,327,20866,38136,0,0,0,0,0,0,0,0,15131,20703,
+0,30997,41696,0,17116,0,21721,23474,17926,21742,0,0,0,0,20522,0,
+0,0,0,28196,0,0,0,0,28479,29068,0,48540,11294,0,0,0,
+0,0,32490,14011,0,0,18911,0,0,31471,0,0,0,24563,15094,0,
+0,44781,0,0,0,31443,0,21152,0,12005,22094,0,0,30386,0,31774,
+0,0,0,0,0,4702,0,0,0,0,0,0,0,0,38560,0,
+0,0,0,0,0,0,9962,0,0,0,0,0,0,3242,0,0,
+0,0,0,0,24490,2051,668,40348,0,0,0,0,0,0,0,0,
+8559,0,0,0,0,0,0,0,0,0,0,0,0,34810,0,0,
+0,2240,0,0,34227,0,43388,0,0,0,5458,9133,12180,10798,41506,0,
+831,13739,17896,21454,24828,27377,33472,0,0,21903,0,0,0,0,0,0,
+0,43800,22042,43751,47506,0,0,0,45146,25067,0,0,0,19549,0,0,
+0,0,18616,0,0,33731,0,0,0,24971,0,40422,0,7936,32443,37403,
+0,0,0,5738,18108,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,22068,0,0,0,0,0,0,0,0,0,44467,15139,
+15349,38780,0,0,0,0,0,41717,0,0,46394,0,0,0,28859,38767,
+0,0,0,0,17306,29667,41815,0,0,0,15979,0,0,0,421,32934,
+0,0,0,0,0,0,43990,928,2669,14170,0,0,0,0,35430,0,
+27382,0,8939,0,14549,46684,12302,24847,25296,5883,2562,45780,0,396,4149,11890,
+20872,0,23534,4946,4527,46506,0,0,23369,0,32070,20458,0,19405,0,0,
+0,9159,0,21666,0,0,0,0,0,0,9875,0,0,34528,0,0,
+0,0,0,35685,46627,0,0,26142,35497,0,30618,0,0,0,0,0,
+23817,5039,0,2403,0,0,0,0,0,0,0,0,0,6110,0,36819,
+32390,12789,0,28317,0,0,45260,0,0,0,0,0,0,3556,26567,22546,
+3890,0,0,0,0,0,0,0,0,0,23748,0,2859,0,0,39114,
+23403,46849,0,0,0,18502,0,0,0,0,27331,14080,42291,20640,29486,0,
+0,28087,0,0,0,0,37660,0,21928,26474,32154,38926,0,0,0,15923,
+0,3003,11596,19578,0,30129,0,0,0,0,0,0,15946,0,0,12786,
+33603,0,0,0,20004,0,0,0,38234,20393,22557,0,0,30190,0,0,
+0,36944,13596,0,0,0,18126,29319,0,24460,48713,0,0,2886,0,28680,
+0,47872,0,0,0,0,10685,15326,0,1241,0,45162,22905,0,0,42506,
+0,8108,25993,32202,0,0,24086,34270,33910,21799,35556,48756,0,0,4419,30859,
+12877,0,0,25514,0,2936,0,30567,0,0,0,0,0,0,0,0,
+0,0,8551,11224,18294,39513,43743,0,23861,37270,33254,20450,0,0,0,0,
+0,0,0,0,25581,0,22109,3216,0,0,0,0,0,0,0,0,
+0,0,0,0,7029,0,0,0,0,0,21364,42343,7976,15189,0,0,
+0,18412,16566,35096,11939,0,0,0,0,0,0,0,0,14218,0,0,
+0,0,36556,0,45977,0,0,35644,0,0,0,0,0,47148,34152,6337,
+10910,7715,0,0,0,0,0,0,0,18189,0,0,0,46287,0,0,
+0,0,0,14285,0,19795,0,8505,20911,22630,14930,27021,30889,21155,5586,0,
+0,0,1308,0,38072,0,0,0,0,0,11413,0,0,0,0,0,
+0,0,44826,0,11235,0,21977,16855,5962,0,7884,0,0,698,9242,23790,
+15614,11330,47676,0,0,0,0,25704,31481,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,24968,18715,0,0,0,0,0,14993,
+0,0,4213,34531,0,0,0,0,0,0,33987,45793,0,0,20750,3111,
+34537,0,11784,2727,0,0,0,0,0,12029,44545,0,1337,0,0,0,
+0,0,0,0,0,32871,0,5042,0,0,15894,0,0,0,0,0,
+0,6508,0,28985,0,48724,0,0,0,11057,19897,0,4232,46980,42553,10655,
+0,0,0,9623,18475,4835,0,0,0,0,0,18166,0,47934,0,0,
+0,0,0,0,17623,23587,0,0,12600,21241,22044,41692,26883,9023,0,22816,
+0,0,0,0,14073,16799,17475,0,0,0,0,25395,0,0,0,0,
+0,0,0,0,14022,0,42741,18392,37014,0,0,0,34044,9723,0,0,
+0,7648,12448,14831,26265,28459,0,0,8727,0,37565,0,0,0,0,0,
+42184,48251,35340,0,0,0,48356,0,12028,0,0,0,0,0,7630,36470,
+2526,0,0,0,0,0,0,0,43814,0,0,48206,40032,0,0,0,
+0,0,9949,0,40719,36575,35708,0,18143,0,0,0,0,0,0,12208,
+15596,23334,24296,43409,0,0,1582,31238,22834,0,25877,0,2874,13253,33396,38990,
+0,0,26089,16203,26580,0,0,0,0,0,0,0,0,0,28051,17273,
+0,0,47722,0,35656,0,0,0,0,0,0,6843,12993,46388,0,0,
+0,0,25302,38821,0,0,0,0,0,0,0,0,0,0,0,0,
+0,38061,0,0,0,44948,23120,0,0,0,0,28556,0,36833,0,38888,
+37064,0,0,44890,45134,48315,17731,18095,27203,0,0,9607,0,0,0,0,
+0,0,0,0,0,0,25487,27421,0,24034,0,0,0,0,0,0,
+0,0,29976,0,0,2265,0,0,0,0,36826,33024,0,14570,2506,0,
+0,0,38235,0,0,6855,0,42774,4888,0,0,38631,24354,27045,0,0,
+0,43161,0,0,0,0,0,0,0,370,0,0,0,7100,0,29209,
+47864,0,5908,0,0,0,18984,32974,0,33679,0,0,14100,33446,0,0,
+0,0,0,0,0,4424,16055,0,0,0,0,0,6035,0,0,40902,
+0,0,0,0,0,8613,0,0,0,0,0,8262,0,0,0,35512,
+188,0,0,0,0,0,41603,0,0,0,0,0,0,20126,0,0,
+40384,0,0,0,13725,35470,0,0,0,0,0,0,2995,0,0,0,
+0,0,0,0,18919,20011,40507,0,0,0,0,0,0,0,0,0,
+13012,0,11136,0,0,0,0,0,0,30003,0,0,7307,27129,41790,0,
+0,0,0,0,0,0,0,0,0,10935,20942,21159,0,0,0,6667,
+0,7912,0,0,0,1976,0,41809,0,0,10787,0,536,687,9038,0,
+31939,0,0,36952,40390,0,0,30916,0,0,0,0,6259,42981,0,34658,
+0,0,47612,0,40380,0,0,23203,7199,17970,471,19586,47693,0,0,0,
+0,24557,29746,19500,0,0,0,4861,0,0,0,8693,15054,0,0,0,
+1842,46494,42778,2655,0,0,0,0,13184,0,0,19530,0,0,0,4337,
+48620,0,0,14076,22777,0,0,22408,25467,0,0,0,0,0,0,0,
+0,14399,45502,0,0,0,11636,0,0,0,46575,0,47565,21412,0,0,
+0,0,0,0,0,0,0,0,0,0,0,3810,0,0,14222,0,
+0,0,5573,0,23963,0,0,0,0,0,31390,0,0,39275,0,0,
+0,28512,0,0,0,0,0,17619,0,0,0,5808,0,0,0,0,
+48885,0,0,0,14851,31095,47629,0,0,0,0,0,0,4199,31258,0,
+0,28096,0,0,0,0,0,0,26364,22827,0,0,18579,0,0,0,
+0,0,0,45913,0,0,0,0,48287,0,0,0,0,0,0,0,
+0,0,0,0,718,26428,44866,9172,0,19957,33005,12952,30814,0,0,0,
+2398,45894,0,0,0,0,0,0,0,2454,0,0,0,5672,16316,42438,
+28555,46377,31072,27350,0,0,0,0,46951,38079,0,18531,45263,0,0,0,
+24060,0,0,0,0,0,7975,0,0,0,8925,9790,35878,0,40207,0,
+0,0,0,0,43710,0,0,0,0,0,0,0,23946,0,0,0,
+5935,7326,10522,0,4943,0,28870,0,0,0,0,0,10116,0,10499,0,
+0,0,0,0,0,0,0,0,0,0,22780,30943,0,0,0,0,
+0,0,12504,0,0,0,0,0,13548,2851,26127,26784,0,0,0,0,
+0,44327,0,22395,0,14112,26413,0,0,0,0,448,33859,33948,39912,0,
+0,0,0,0,13091,0,0,14318,15602,0,0,19933,32107,0,0,30580,
+0,0,0,0,0,39926,0,0,28482,36855,3735,5479,9833,16640,30266,5407,
+41091,0,0,0,6284,0,22525,26344,0,15650,0,0,0,0,0,0,
+0,18724,30408,11491,0,0,0,0,34080,0,0,0,0,44549,46857,0,
+0,13505,17847,0,0,0,18698,0,0,31548,0,18110,3747,0,0,27808,
+42923,48007,0,0,0,7639,0,0,32660,0,0,0,28468,42507,21403,0,
+25367,47894,5818,0,0,0,17175,0,0,0,0,6630,34752,31850,23266,0,
+0,40210,20127,0,0,0,0,6365,19317,28992,0,0,0,0,10960,22747,
+0,0,27172,0,0,0,18649,0,0,16298,42875,45726,0,0,70,38645,
+42092,0,0,32432,0,0,36866,0,0,0,17674,24157,0,0,45937,0,
+0,13187,8250,5846,12684,48093,41175,0,0,0,0,0,0,0,38057,0,
+0,0,0,0,0,0,0,0,0,0,0,0,24287,0,0,0,
+7065,11215,0,0,25132,5500,40637,48263,0,0,20129,7938,24201,7082,26675,0,
+37208,16600,25807,0,0,0,23627,0,4030,37519,0,0,0,7719,0,0,
+19001,0,0,40775,6555,0,0,38921,16644,0,10453,40001,0,40016,29736,34871,
+0,0,0,0,0,0,0,7851,21017,0,0,0,0,38717,0,0,
+0,45748,0,37582,0,36358,0,9673,48526,0,40269,0,44878,48811,0,0,
+25674,31215,0,30680,0,0,0,0,0,21688,0,2707,0,6760,0,8572,
+2217,38495,46762,16004,0,0,0,43804,0,0,0,20947,0,0,0,0,
+0,0,0,0,45302,0,3303,11844,0,0,0,23348,0,0,1109,17264,
+21621,14004,18243,42482,0,0,0,0,0,0,0,3472,27451,17018,41734,44492,
+0,0,0,26099,3487,23311,0,0,0,0,0,33237,0,0,33746,0,
+0,0,0,0,0,0,2330,0,0,0,36974,0,21322,3603,0,6127,
+0,5243,10373,0,0,28352,19034,25857,27373,31369,16524,13240,45097,0,17364,11539,
+0,33436,26757,1303,40029,45203,0,0,11601,33110,0,0,0,0,0,16641,
+25235,0,0,0,0,0,28191,14487,25207,0,0,0,30109,0,11649,0,
+0,33409,47085,0,36299,45846,43482,0,0,0,0,0,23714,0,0,0,
+18426,0,8170,34587,0,22993,42799,0,0,0,0,0,0,0,33892,0,
+0,29504,38456,0,0,1372,26676,42017,0,46929,0,6750,2552,18992,28806,9380,
+47517,32976,0,624,12151,24231,0,0,0,401,29193,19616,0,3973,0,39782,
+0,0,0,0,35955,46700,0,0,0,37567,0,22026,0,26904,29360,44791,
+40328,0,0,14628,17426,26255,33394,0,33540,44455,0,0,0,0,14354,40509,
+0,0,0,0,0,0,12259,8428,0,0,0,0,0,27522,37349,12519,
+0,0,0,0,0,16329,0,0,27775,0,0,0,0,5598,40273,0,
+3698,0,0,0,0,0,0,0,40270,0,0,12497,42372,0,36222,0,
+0,0,0,0,0,0,34880,23447,0,0,36405,0,38587,24083,0,35798,
+0,41805,33902,39688,0,0,0,20466,39184,19444,0,24507,25762,8092,0,0,
+0,0,46571,0,0,0,0,0,0,0,20099,0,12431,13778,24050,46510,
+0,0,0,34716,0,0,8193,23314,37324,0,0,14397,20052,43007,45623,0,
+0,20589,23459,0,41315,47973,0,0,1242,5307,0,15107,47835,0,0,0,
+0,0,13759,29442,15089,7401,0,0,0,22600,0,0,20654,4929,41364,0,
+2013,0,0,0,0,44529,0,10362,0,0,3146,45042,0,5150,0,0,
+0,0,0,0,0,0,0,0,1119,0,0,13962,0,0,0,0,
+0,0,0,43361,0,0,37723,0,12729,0,0,46567,48808,43308,0,21920,
+7486,0,0,0,0,0,8956,0,0,0,0,22151,0,2307,0,35324,
+22476,0,28484,12851,0,31331,0,0,46097,0,4248,0,33971,0,0,27470,
+0,0,0,6732,0,0,0,39641,0,17960,0,0,46769,0,0,0,
+45787,0,0,0,0,0,0,8543,22473,0,0,0,0,31460,0,13017,
+4306,0,0,0,15666,0,41360,0,0,0,0,1579,32508,47921,0,0,
+0,11820,0,0,0,244,0,0,0,0,13203,45420,37400,0,0,6142,
+0,0,0,0,0,0,0,0,11426,0,0,0,0,0,0,0,
+407,14174,44803,0,0,17267,9837,14788,35850,41900,0,0,25731,0,0,0,
+0,0,0,0,15781,0,0,9414,24584,0,0,0,0,0,0,0,
+41715,30091,0,47260,0,0,0,6221,0,0,0,0,26088,0,0,45908,
+0,0,44106,30523,48476,0,3300,38528,0,6492,0,0,1207,0,0,0,
+43269,0,18537,0,11514,0,0,0,0,0,20925,44827,44887,0,0,0,
+0,25986,7885,16819,14033,30412,0,30991,0,0,0,0,0,26494,0,0,
+0,19247,0,0,0,8238,0,19442,4854,37294,23780,0,0,0,1164,43677,
+0,44117,0,43521,1815,10468,23964,36871,0,0,28182,0,19311,33088,4806,22675,
+0,0,25597,0,41500,0,0,0,0,6184,10567,675,7241,0,0,8836,
+0,0,0,0,0,33699,0,20050,0,0,0,11924,15214,0,0,0,
+0,0,48734,0,0,43610,22707,43961,0,0,0,0,0,0,0,0,
+18735,14058,0,0,0,0,0,0,0,14092,0,33453,34141,2165,35087,10972,
+21525,38499,35820,0,1588,10421,0,0,0,0,0,0,0,29478,28506,0,
+0,12023,15224,31069,37942,41253,1878,45614,27508,46325,48555,0,23687,0,0,32371,
+0,0,0,0,0,9616,0,44896,0,0,0,0,0,0,0,4958,
+34743,0,12538,0,0,0,48245,0,0,0,0,31268,44067,34331,0,25443,
+0,10063,13633,14610,0,0,0,0,43889,0,0,0,0,0,48194,0,
+0,21631,5541,2336,9264,15162,22047,989,25368,3632,32619,48623,39453,5828,38053,2264,
+23523,0,0,0,33392,45191,0,0,0,0,0,0,0,0,0,0,
+0,43753,0,0,0,0,0,0,0,0,0,0,123,0,0,0,
+0,0,0,0,0,40400,0,17278,0,0,0,0,35036,0,0,0,
+35938,0,19861,36211,0,0,0,0,0,0,5645,5884,15013,40643,0,0,
+19590,0,17329,38809,17807,48783,34249,0,0,0,0,28353,0,0,0,0,
+0,0,0,38758,0,0,0,19596,40156,0,36493,40652,43684,17916,0,32531,
+13178,17763,20502,35348,20365,42235,0,0,0,45583,0,0,31449,0,0,0,
+0,0,8230,8508,10920,0,0,0,0,0,0,22646,0,0,0,317,
+21646,0,0,0,0,0,10890,0,18153,32560,48779,4282,24442,39378,0,0,
+0,30766,4922,36214,46091,0,47738,0,0,0,0,0,0,0,0,17083,
+0,0,0,0,0,0,0,18274,5610,6539,44239,0,0,19479,0,0,
+0,48310,0,0,0,0,32329,12470,0,0,0,0,6926,0,0,0,
+0,39499,2130,0,0,46894,0,0,0,0,0,27763,3610,0,6753,0,
+27687,0,0,12693,0,13698,0,16239,0,41658,0,0,29092,0,0,0,
+0,0,27715,0,0,0,0,4283,36886,46484,14937,0,0,0,19113,0,
+0,0,0,3861,32606,0,0,0,0,0,0,39123,0,42562,0,0,
+0,0,0,45661,47748,0,0,0,0,0,0,0,0,0,0,8809,
+21070,9152,0,4940,0,40512,0,0,0,0,0,0,0,0,0,34086,
+12398,0,0,0,4544,14479,0,0,0,6749,0,42710,0,9006,25991,42144,
+5132,0,0,0,0,48781,36459,0,0,0,0,13681,0,0,0,2281,
+14908,0,0,0,0,11083,22468,29585,0,0,0,12634,33638,0,0,0,
+45462,0,0,0,0,0,0,0,0,0,33197,0,0,0,6209,0,
+36694,5825,841,13252,37533,38284,0,0,0,23797,0,0,16727,48643,0,0,
+0,0,0,0,35309,28658,11457,0,4816,0,34051,0,0,0,0,0,
+31671,0,0,0,0,0,0,13377,30923,0,0,0,0,0,0,37490,
+0,6123,0,0,2611,0,0,0,0,0,0,30398,9462,0,0,0,
+18439,24931,0,0,0,39135,0,0,0,26125,38430,0,14147,16616,32248,0,
+0,0,6328,40118,0,0,0,0,15987,0,0,0,0,0,41592,0,
+12009,0,0,3255,0,18487,0,32599,0,26508,0,0,0,0,41317,0,
+42433,0,0,0,41705,43890,0,0,2439,0,0,0,38460,48230,26629,35633,
+0,10475,0,0,0,0,0,42266,23095,28063,36341,0,0,0,0,0,
+0,19329,0,0,0,863,0,21488,0,0,0,29773,39163,19354,23316,2840,
+0,0,17628,46877,24307,0,10006,0,0,32164,40556,0,0,21719,32959,0,
+0,0,19691,21582,24536,0,0,0,26671,0,0,0,0,4884,16238,16757,
+18514,0,0,16901,0,7684,30551,0,0,20791,0,0,0,10812,15700,48403,
+0,8998,0,0,0,0,0,24634,47616,0,37658,19019,24022,31696,19514,33144,
+24506,0,0,0,0,0,30064,0,20324,0,12044,32701,0,0,0,0,
+24893,30024,44917,0,42480,0,0,0,0,0,11568,0,25639,47298,0,0,
+0,0,0,7049,23123,0,47187,0,0,11256,0,0,0,11431,0,34582,
+0,0,0,594,0,0,0,0,0,0,0,0,0,30959,0,4859,
+16932,9768,46585,0,0,0,0,0,35530,0,0,20227,0,40196,0,21184,
+8758,0,42357,30309,0,0,42753,23631,0,0,0,17505,28743,32141,0,0,
+33776,0,4818,43263,0,0,45665,9392,0,0,5600,0,0,0,0,35914,
+0,7943,0,0,0,19363,38779,0,0,0,21054,0,0,0,0,0,
+0,0,0,0,0,0,0,40107,26692,0,0,0,45257,0,0,0,
+0,0,0,22809,41591,0,0,0,0,0,0,0,7231,37787,44160,0,
+14246,21706,0,0,27512,46845,0,38497,0,19085,32131,0,0,27947,36931,0,
+0,0,0,0,0,21901,0,0,0,0,0,32337,24048,0,0,19360,
+0,12637,43490,0,0,48151,0,28519,0,21426,38622,3497,9374,0,0,47556,
+0,0,0,21771,0,0,27158,0,0,19732,0,0,14514,19380,0,0,
+0,3020,3940,0,30110,0,12539,0,48866,0,0,20193,23515,48868,2218,40892,
+5834,42704,26047,0,32899,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,24670,26360,0,0,0,0,0,0,0,0,0,0,
+0,0,12805,39560,7329,6945,0,0,4543,0,25341,0,0,0,23989,0,
+0,0,0,14785,0,29191,29952,35991,0,1385,12763,0,0,0,21421,9389,
+21986,6919,4774,0,0,0,0,26403,0,0,25955,0,46129,13262,0,33428,
+0,0,21039,0,0,6391,0,0,0,0,0,0,0,0,5377,2324,
+0,0,0,0,0,0,0,0,44610,0,0,0,31182,0,0,0,
+0,40947,0,0,0,6483,0,0,0,0,0,0,4820,0,0,0,
+0,0,0,16957,47308,0,0,0,53,0,0,0,0,0,39422,0,
+0,2038,42690,0,5733,0,44914,19572,0,40455,0,0,0,0,0,0,
+0,0,48491,0,48297,5681,17488,0,29152,42377,0,0,26641,31674,0,3957,
+0,0,0,0,0,5717,0,0,18417,33666,10287,3531,0,0,22890,0,
+0,0,44359,0,0,0,0,0,0,0,32271,0,0,12863,0,0,
+11573,39609,28612,32692,0,0,40389,41598,5708,13892,41385,0,0,0,33000,0,
+0,8391,12819,9156,3031,23188,34057,0,0,0,14781,41392,5764,18658,0,17212,
+40251,0,0,0,26948,0,0,0,0,0,0,0,0,0,19323,13663,
+0,0,0,25369,35935,0,47072,0,0,0,24758,29580,44474,495,0,0,
+10206,7385,29856,0,0,0,8762,21420,42661,0,0,0,0,45437,0,0,
+0,0,0,0,36244,0,0,0,0,0,39109,0,0,0,0,0,
+0,0,0,0,16608,0,45756,24836,0,39371,0,0,0,0,12827,0,
+0,0,0,0,0,0,0,17743,33645,0,0,0,0,0,0,0,
+0,0,0,40566,0,11424,0,33534,41663,0,7408,0,0,0,0,19955,
+0,43903,0,19124,4974,0,10154,0,0,0,18303,33133,0,0,13487,0,
+0,22159,37012,39174,39709,44214,45459,0,0,0,0,0,34357,0,0,0,
+5525,0,3108,35292,38803,40421,0,0,0,3116,0,33037,0,44821,0,0,
+0,0,29151,28922,46873,0,0,25826,43587,48462,0,42967,0,7595,0,0,
+0,0,47073,0,0,0,0,0,43681,227,0,0,0,18313,0,0,
+0,0,0,0,0,0,0,37912,32686,32117,0,980,9865,40766,16491,0,
+0,0,0,40896,0,0,0,0,15911,0,0,0,6879,17967,24361,0,
+0,0,9330,0,0,42084,0,20384,31210,0,24839,9482,24888,0,0,0,
+8833,38996,0,30451,0,0,0,27910,0,26353,0,0,0,0,20739,20819,
+0,0,0,0,0,0,0,0,0,24663,7782,37553,7599,9066,7054,9657,
+14700,21957,27703,29173,670,25694,40505,42740,47825,48631,0,0,0,0,21287,22183,
+2732,45600,0,0,0,0,0,0,25572,0,0,6054,0,0,0,0,
+0,2188,0,22178,0,0,0,0,33818,45237,0,0,0,0,89,0,
+34655,48525,0,0,0,20266,31206,38371,0,0,0,0,9393,25449,20189,0,
+22947,0,0,0,24957,0,29574,9990,0,0,0,0,0,0,0,20860,
+23415,26248,31060,27385,16918,14693,21673,39991,0,0,0,0,0,40921,0,0,
+22358,12808,0,0,0,0,0,26437,38317,0,0,0,34639,0,0,38561,
+0,13067,0,28433,31691,32775,0,0,0,0,0,0,0,43648,0,741,
+0,0,0,7822,0,48256,0,0,0,0,139,0,9190,25026,0,14230,
+0,0,0,0,0,0,0,0,0,0,0,0,22659,0,15603,21661,
+0,0,23101,17780,23876,19255,0,0,14036,0,11251,24202,0,8533,0,0,
+15718,0,0,0,40580,0,0,43694,33214,0,0,0,10284,0,0,0,
+0,48301,0,48862,0,0,32671,0,0,0,45073,0,0,0,0,45331,
+0,4175,0,0,0,0,0,8541,0,7980,547,18309,0,17816,18763,0,
+0,20618,0,28600,0,0,0,0,0,0,29395,0,0,0,26880,1485,
+10569,0,0,35711,47038,0,0,19361,619,3160,0,0,0,42764,0,0,
+2185,0,0,0,0,2032,4808,27739,0,47587,0,0,0,0,0,0,
+0,0,0,24038,0,33270,0,0,0,0,0,0,0,4317,6297,0,
+0,0,39231,0,31392,0,0,30820,0,0,26807,0,0,0,0,3249,
+28624,0,0,0,0,0,0,0,14545,0,3599,39376,14624,0,0,0,
+0,0,0,0,0,0,0,0,0,0,14569,0,0,0,0,27708,
+0,17564,0,43253,0,0,0,0,0,3565,0,6839,11824,19214,0,0,
+0,21016,0,17387,37028,14477,0,0,17385,0,0,3354,26525,6138,7806,8214,
+0,0,0,0,0,0,0,39494,0,48574,0,0,0,26869,0,0,
+18103,0,0,0,27344,0,0,0,12612,0,29095,5,0,0,0,0,
+0,24319,0,0,0,0,0,31754,0,9401,0,0,0,0,17853,20561,
+27904,48383,9947,0,0,0,8476,0,0,0,0,0,0,0,0,30597,
+0,0,0,7099,0,0,0,42449,46408,28297,36126,48571,0,0,9355,0,
+0,0,24851,0,11517,3386,21749,24096,0,0,0,45291,0,0,0,0,
+0,14726,0,0,33564,14599,0,0,0,0,0,0,0,0,0,0,
+38750,0,38677,44427,0,0,0,0,36619,0,0,7587,13973,0,0,39867,
+44420,33513,0,7114,0,0,37560,0,0,0,0,0,0,0,0,0,
+0,37943,36528,0,0,0,776,1443,0,0,0,0,31676,7423,0,0,
+0,0,7215,0,0,0,0,0,16165,0,44544,0,0,0,0,0,
+0,0,32463,44876,0,38630,0,0,4313,42254,0,0,2585,0,0,0,
+22137,0,0,0,0,0,0,11835,0,35321,0,0,0,0,0,14618,
+0,12894,23183,8641,38443,39081,43383,15688,0,8550,0,0,8943,0,0,0,
+14811,30574,28049,42649,0,0,36400,0,0,0,0,0,0,11414,30202,0,
+0,0,25641,7421,0,16711,0,0,0,0,0,0,0,0,19881,0,
+0,0,0,0,0,18219,7878,0,0,0,0,0,0,31470,0,0,
+11351,6832,26658,31932,0,31064,0,0,36280,0,28847,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,28386,0,0,0,36263,
+0,0,0,45130,5786,48638,0,0,0,0,0,29355,0,46646,0,32068,
+0,21049,45835,0,0,0,0,29393,0,0,0,0,0,0,25690,0,
+0,0,0,31229,0,0,47012,0,42585,46752,0,0,0,0,0,0,
+0,11407,0,0,0,4375,0,0,0,14228,0,42043,0,0,0,27257,
+47400,0,0,0,31023,0,0,0,0,0,0,0,0,0,0,17052,
+32190,39279,0,0,0,0,34857,0,0,0,4782,0,0,0,0,0,
+39821,0,0,37817,0,0,0,2525,17873,27705,34327,0,0,2564,0,0,
+0,24633,1585,21546,47096,0,0,0,0,0,0,0,0,1523,17579,33033,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,9985,32149,0,0,4696,0,35284,0,9932,12696,47115,0,0,32491,0,
+0,0,0,0,9291,17939,0,0,0,0,3981,13372,27510,38570,0,0,
+0,46746,0,34652,0,0,0,0,0,33623,0,0,4365,26886,0,0,
+0,0,30815,28022,30906,1500,0,15861,0,0,0,0,0,40161,0,0,
+0,0,0,0,0,6733,8207,0,0,0,0,7618,0,0,0,0,
+1647,3737,0,27392,43381,44285,0,31896,0,0,0,0,12375,0,0,0,
+0,12175,0,0,0,639,15931,0,30401,36687,0,0,0,43236,0,3955,
+4303,40036,46936,0,0,0,17218,0,20972,19917,0,0,48562,0,0,0,
+0,0,26361,17036,18300,0,43176,0,10729,32176,0,0,0,15467,32649,0,
+0,0,0,20078,0,0,0,26420,46303,0,4231,0,0,20162,0,9317,
+27098,0,0,0,0,0,578,36215,18833,0,44111,0,0,20160,0,30839,
+10893,0,2615,0,0,0,44034,0,0,0,0,0,42060,46971,4743,25441,
+42228,0,0,0,0,0,0,0,11147,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,4272,7964,0,28501,0,0,0,25117,
+0,6642,0,11937,0,0,0,0,0,0,0,0,8746,0,2898,3566,
+24638,0,0,23305,37971,9989,29292,12083,31600,0,0,2574,22289,0,0,30611,
+0,11394,0,0,0,0,0,0,0,35880,34562,29699,44391,47174,0,0,
+0,0,43665,0,7007,13668,4893,24443,0,0,45722,0,0,36110,0,0,
+0,43452,8560,0,0,30083,0,38297,0,22282,0,0,0,0,0,0,
+21477,0,0,0,0,0,0,0,0,0,19251,0,0,0,0,0,
+0,2785,48747,0,0,0,19888,0,0,0,0,0,2830,0,27417,0,
+0,12104,0,0,0,0,0,14446,42893,0,0,0,29539,0,0,0,
+0,0,0,5982,0,0,0,0,0,0,15434,43168,0,0,0,0,
+7994,20148,4590,29408,0,9541,0,0,0,0,15289,0,0,1134,7409,0,
+14710,0,0,0,0,19599,0,0,0,24047,38362,0,0,0,0,4352,
+0,0,0,20231,33867,0,0,0,0,0,0,0,22751,40048,0,0,
+0,0,0,4659,0,33816,4678,14727,38159,0,0,0,4996,0,0,0,
+35982,36839,0,0,46735,0,21649,0,0,0,2221,0,0,0,0,13824,
+48440,0,0,24217,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,12456,0,6017,16708,38314,0,3821,0,0,0,45627,8460,17711,
+0,0,0,0,0,0,0,6418,0,0,4699,0,13801,0,0,0,
+0,0,0,21850,0,0,9044,34797,2581,14294,0,0,0,0,23118,26513,
+21408,47766,0,0,0,0,33315,40197,0,0,0,0,0,15976,0,0,
+0,30699,0,0,0,0,7003,29231,34362,0,0,0,0,0,0,0,
+0,0,21700,0,0,0,0,0,0,0,0,0,20047,0,0,0,
+0,0,0,23320,3956,1389,15267,17159,43463,0,0,0,0,0,13541,16074,
+2640,26835,703,12341,44596,1790,35739,0,0,48307,0,0,14480,0,0,0,
+0,0,0,0,0,16981,42486,30694,0,0,0,28144,47784,0,0,41930,
+47351,0,29761,0,0,29336,34235,4927,16229,18067,36731,0,33674,0,0,0,
+0,15811,0,0,1301,38875,0,0,0,0,33426,0,0,0,0,0,
+0,0,47627,4554,12562,17719,0,0,0,0,0,10782,0,3682,19566,20757,
+0,0,4830,0,0,0,0,3671,0,0,0,0,0,9425,14755,0,
+0,0,0,0,0,0,10781,0,0,0,0,0,29975,0,0,45526,
+0,23995,34894,45375,36809,0,0,0,25160,0,0,0,42754,39952,0,0,
+0,12403,22554,0,0,0,0,0,0,33741,0,0,0,0,0,0,
+0,0,0,0,38626,48260,0,0,0,0,46425,0,6226,0,0,0,
+0,1493,0,0,0,0,273,25496,26798,43723,0,22071,0,21381,0,0,
+0,0,0,0,25377,0,0,0,0,30323,22500,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,14465,8447,17229,41983,43303,0,
+34,39495,0,0,0,0,0,0,0,0,0,17151,37716,0,0,0,
+0,3786,9124,27108,0,0,0,0,0,17227,0,0,0,0,45091,24216,
+19704,0,0,38085,0,0,0,0,0,0,0,0,8524,23947,0,0,
+44643,0,2435,0,27207,0,0,0,0,0,0,0,0,12397,0,0,
+0,0,0,0,36766,47094,3345,0,0,0,0,0,0,0,0,0,
+20346,0,0,46073,0,2514,26640,10545,29221,31577,35108,14888,20976,0,32235,0,
+0,31780,0,0,29166,0,3499,33750,0,14577,0,16889,24457,40287,0,5843,
+2036,23935,0,0,0,18281,0,0,0,30638,9055,0,0,0,0,33476,
+0,0,0,0,0,0,0,47304,0,0,0,0,0,270,19667,24292,
+22565,0,0,0,0,0,0,0,0,0,6346,0,0,0,0,15814,
+883,28508,0,14751,0,43180,0,0,25609,0,0,19241,0,0,0,26520,
+39497,2387,4825,37877,37231,0,0,0,34514,0,15716,0,0,0,35220,0,
+0,0,0,0,0,0,35436,13071,0,0,25205,0,0,0,0,0,
+0,0,8136,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,37390,23338,23581,2539,42713,31167,0,0,0,0,9555,24819,0,
+36180,0,29972,0,35728,31776,41345,0,0,0,0,2214,24444,42832,13496,13558,
+15943,10695,28154,29532,9388,21061,0,43796,0,0,22877,30720,37230,37939,38719,5670,
+14204,29522,31001,48052,0,0,0,0,0,0,7461,9861,0,0,0,0,
+0,0,0,0,0,0,0,0,0,36961,0,0,0,21534,0,0,
+29994,23837,0,15838,0,0,0,0,0,40592,0,22798,0,19932,0,0,
+30394,0,16967,7522,0,0,15717,0,0,0,0,0,0,0,11233,0,
+0,434,0,30163,0,0,0,259,15686,0,0,0,0,0,43833,0,
+0,0,0,29440,39967,0,8455,0,0,0,43623,0,0,0,0,0,
+494,20073,42788,0,0,0,46139,0,0,0,0,37091,5095,20765,0,0,
+0,0,0,0,0,0,0,0,40526,3092,41837,0,0,0,0,0,
+0,0,0,0,5299,0,0,37628,28055,22983,0,0,0,0,0,0,
+28971,16617,0,30794,0,0,14677,0,19082,0,0,27396,0,0,44960,34381,
+0,14063,9777,46815,0,0,0,0,27826,214,48604,44459,0,0,0,45606,
+26556,0,0,0,34784,0,0,21038,16826,0,0,0,0,0,0,43660,
+0,0,39298,0,0,0,12325,0,0,0,0,0,0,0,0,0,
+0,0,7794,11772,0,0,0,0,0,0,36379,0,0,0,0,0,
+23125,33343,0,0,0,0,0,6998,29124,0,0,0,45009,0,46753,0,
+0,35330,0,0,0,0,17119,18350,25734,2685,9646,6819,27657,28299,33398,0,
+13088,0,6576,12679,13607,0,10293,14418,0,0,0,0,6430,0,0,0,
+0,0,4258,0,3195,0,0,0,0,0,0,820,0,0,0,0,
+0,0,0,0,893,15819,0,0,0,0,0,0,0,0,0,0,
+0,48544,0,0,8897,0,9993,23437,0,0,0,45680,46570,0,0,0,
+0,0,41396,2429,0,26690,0,0,0,0,17315,0,0,0,0,9363,
+0,41333,0,29061,0,6781,11275,0,5901,36072,0,34542,0,0,40847,42460,
+0,0,39188,0,3926,31555,0,21430,0,0,0,30269,0,0,0,8406,
+0,0,0,10045,0,0,0,0,30012,0,0,25939,45267,20103,30584,0,
+0,0,41504,0,39634,0,0,0,0,0,0,2557,48465,0,0,0,
+0,0,0,30326,0,0,0,862,0,21133,1673,45170,0,0,8134,0,
+0,0,0,0,0,0,18901,0,0,0,36586,0,11896,0,0,16552,
+0,0,0,0,20178,6461,23690,40399,0,0,22156,0,0,0,30653,0,
+0,33580,0,35446,0,28923,0,0,0,974,32072,0,0,0,0,0,
+36713,6177,0,0,19901,0,0,0,0,0,22857,0,0,8154,0,7789,
+0,0,0,28260,0,0,24207,0,0,46433,0,0,0,22865,34896,1293,
+0,12746,13721,46703,0,0,0,0,34791,44317,0,0,35342,0,0,0,
+6775,44951,37537,0,0,0,19625,48280,0,0,0,0,2759,33074,0,0,
+0,0,47333,0,0,32064,0,0,0,16535,0,0,0,6528,0,0,
+0,0,0,0,2831,0,17281,0,0,0,0,0,0,0,0,0,
+0,0,11587,15988,0,0,0,0,33657,27787,0,0,6114,0,0,0,
+0,9057,0,4601,35236,40229,0,8904,0,0,0,0,0,18920,37918,2675,
+0,0,8643,0,0,44844,12843,14320,25138,0,0,0,3693,10587,20120,16261,
+0,0,0,43049,0,0,0,0,0,17819,0,19695,29036,2811,26065,1882,
+24710,2584,5642,0,0,3388,14636,0,0,0,9981,0,0,0,0,0,
+22547,0,16120,20592,0,47393,0,0,3623,0,16028,0,0,0,0,42684,
+0,0,0,0,9000,44589,0,0,18082,7800,23272,27185,18091,35178,46795,5568,
+0,17927,0,28791,0,0,30298,27113,0,5716,0,32514,0,0,0,0,
+0,0,13212,0,0,0,13812,47010,0,0,0,0,0,0,0,1484,
+0,0,20124,0,0,37259,0,0,0,0,33326,7863,48502,21954,0,0,
+0,10380,18987,41172,46673,19480,0,5483,42728,8657,11223,32680,37416,0,19020,33137,
+0,0,0,18395,0,0,0,40680,27897,0,16675,0,0,0,0,0,
+4202,42057,0,10771,11562,34681,0,16912,19582,0,24624,22150,0,0,18867,4142,
+0,47473,0,1990,0,0,0,7539,20345,0,0,0,0,0,0,13764,
+0,32760,0,17126,3438,21881,0,0,0,0,0,0,0,0,46375,17093,
+0,0,0,0,0,0,11268,0,0,0,18055,0,0,0,0,0,
+0,34117,0,0,0,0,35153,0,0,20371,5228,40660,25103,2311,35701,12037,
+48348,0,0,0,0,0,0,0,41063,0,40923,0,19602,0,0,45714,
+24376,0,0,26267,0,21810,0,0,0,0,0,0,0,37536,0,21292,
+0,0,0,48655,9329,0,16626,0,0,42125,30196,41904,46030,0,0,0,
+3176,0,0,47090,0,0,0,3145,32643,0,19709,4809,37224,0,0,0,
+17752,0,0,10818,0,0,0,0,0,45144,0,0,25089,0,41127,0,
+0,23306,0,1789,0,7083,0,35266,41799,127,0,0,0,0,0,7328,
+11498,28987,0,0,5795,0,0,22866,0,0,0,41201,0,47244,0,0,
+0,2954,25021,31808,0,0,7283,0,0,0,0,0,5492,38147,22314,18703,
+0,0,0,0,0,0,36082,0,0,0,28829,0,13342,0,27256,0,
+0,0,0,0,41959,0,39593,24193,0,0,8538,35485,0,0,0,652,
+0,0,23336,26683,4048,0,43367,0,0,0,0,0,0,32854,33023,38907,
+12147,0,0,0,0,0,16410,0,0,0,0,29849,0,0,22561,43912,
+0,8752,48587,0,0,0,0,4113,15722,35704,38345,0,26785,0,7583,0,
+0,0,0,0,17975,292,0,30022,0,0,34217,15845,0,0,38632,0,
+0,0,42653,0,0,0,0,18188,0,0,0,10169,0,0,8778,0,
+0,0,12978,0,0,0,0,0,0,46431,0,0,0,0,231,0,
+0,0,0,0,17057,30418,3945,31759,33811,0,0,0,0,27210,0,0,
+11737,30566,47516,23023,0,0,0,36796,34303,0,0,0,2067,0,0,24505,
+0,0,0,38508,0,32904,32918,35058,0,0,0,0,0,0,0,0,
+33914,4240,0,48524,5285,26305,0,15296,16043,26045,9644,30254,44944,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,39232,45444,0,0,35180,4038,0,0,0,2456,0,13740,12752,34400,0,
+8412,0,0,0,0,0,0,0,0,16549,18164,0,0,30427,0,0,
+36328,0,0,580,4850,19660,23252,475,25837,0,33259,3907,0,20804,0,29715,
+0,0,46039,0,0,0,0,0,0,23921,0,41458,0,32995,0,0,
+0,0,0,0,0,0,13583,45131,0,0,0,0,0,0,0,0,
+17203,0,0,10480,0,0,0,0,43986,11003,0,44451,0,0,21953,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,26621,16765,0,5078,
+0,32698,35325,47812,0,0,2298,6779,0,0,0,0,0,0,0,0,
+15751,0,0,0,0,0,12670,0,0,0,0,0,10155,0,0,0,
+0,39610,35852,0,13858,41422,19533,18407,9944,9100,28037,36752,16303,0,0,10713,
+0,0,4945,0,0,0,0,38401,0,0,0,0,0,0,0,0,
+0,0,29984,0,0,0,37452,0,18022,31214,0,43194,0,22955,0,0,
+0,0,38537,0,0,0,0,0,0,0,0,0,46179,41518,0,0,
+0,14198,0,28711,0,24766,30652,39890,0,32620,42046,43662,0,0,33352,4300,
+0,0,0,9926,0,1204,42335,0,0,6983,40510,0,18327,0,0,0,
+0,0,3197,6318,0,0,0,0,0,0,0,0,0,0,0,0,
+0,4370,19631,20159,0,0,0,0,0,0,0,0,0,0,3782,9737,
+13040,44234,45647,23813,47618,5981,0,19093,0,0,11623,0,31450,2339,0,0,
+0,0,0,0,28958,0,0,15891,9230,43152,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,48507,14669,0,0,0,0,
+25596,11464,43346,0,21206,33384,32290,0,0,0,0,31745,31981,0,0,0,
+12638,0,26979,37374,0,5824,0,0,7777,20213,0,0,0,0,37280,3142,
+41776,0,0,48554,0,0,0,0,0,41492,0,0,0,19946,0,0,
+0,0,0,22658,0,41391,0,1236,10855,0,0,0,0,48874,0,0,
+31204,38812,0,0,0,20749,0,0,0,0,0,0,0,0,0,0,
+23603,0,0,0,0,0,0,0,0,0,0,0,7193,28734,0,11319,
+42490,48004,0,0,0,0,0,0,47150,0,0,0,45386,0,0,28543,
+24426,37652,11181,616,14778,38512,0,0,45904,0,0,19851,0,12526,0,4751,
+13625,0,12123,41980,0,0,13608,10806,0,19011,0,0,0,0,0,0,
+0,0,34173,0,0,0,40145,0,0,0,16898,20437,0,0,0,0,
+0,30460,14865,15110,0,0,0,0,30599,0,0,13434,0,0,0,0,
+6840,0,0,2355,17124,14060,5332,27052,39368,0,0,0,0,18606,34517,0,
+0,0,1656,35479,0,0,48817,0,0,0,0,47188,0,0,0,7494,
+45438,38407,0,0,46456,0,0,0,0,44905,6168,31924,2466,48188,32719,0,
+0,0,10501,0,0,0,0,0,48371,0,0,0,0,45332,0,0,
+27946,0,0,0,12962,0,6324,0,0,0,0,0,47997,0,0,0,
+26262,19166,0,0,0,28230,37663,0,0,0,23430,40884,19673,0,0,0,
+0,16445,0,31414,0,0,0,23015,33070,23498,0,24838,26363,0,1027,13602,
+0,0,0,39658,0,1390,3406,0,0,0,0,0,0,0,0,0,
+0,0,5502,0,36938,0,3057,0,5371,8257,21757,16830,33766,0,23299,46987,
+0,2743,36399,26182,42145,0,0,11921,0,0,0,31014,6179,8735,0,0,
+0,34687,6611,0,0,6971,16059,37861,39208,0,0,36571,0,34101,22529,41309,
+0,0,0,0,0,0,0,13697,0,0,0,0,43696,0,0,0,
+0,0,20484,29733,8526,2888,8500,0,0,0,0,25070,0,0,0,10565,
+2671,0,0,0,0,47265,37059,0,0,0,0,0,0,0,0,0,
+0,0,15093,9536,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,20712,23975,30318,0,38406,4679,27727,41950,0,2432,16253,
+0,9606,0,0,0,40248,0,0,575,18804,11552,35208,0,0,24918,0,
+0,30424,0,48478,0,0,4274,0,0,9180,0,18830,0,0,0,41979,
+9166,43138,0,16804,0,0,7415,11751,40358,44292,0,0,29842,31205,0,0,
+0,10017,0,0,0,0,0,36548,43098,0,0,23648,0,37184,0,21740,
+11936,0,0,0,29060,0,0,0,6394,1460,0,18781,5318,26853,43164,0,
+2105,35920,0,0,0,0,0,36964,2853,41480,0,0,0,0,0,0,
+0,0,0,0,0,0,0,6994,2660,3129,12332,0,22424,0,0,31454,
+0,35024,14216,0,0,0,0,0,0,28580,39389,0,0,0,0,0,
+0,10992,30703,31326,45407,0,0,0,0,0,0,0,0,0,0,21112,
+42501,31372,46295,0,0,0,0,3552,16116,28403,0,0,35332,38143,0,38452,
+6946,0,0,0,0,0,0,0,0,0,0,15477,0,3035,0,0,
+0,0,0,19207,12174,37077,43460,35705,11516,3437,29389,39957,0,0,2945,0,
+0,0,0,0,0,39984,628,11130,41582,43806,0,0,0,0,21550,34293,
+45189,0,0,0,0,0,0,35912,0,42426,30216,47611,0,0,29949,0,
+0,26164,0,0,34198,32782,0,0,0,0,0,23408,0,0,0,15418,
+0,0,0,24223,25291,2381,6631,0,0,0,0,1759,0,0,0,0,
+0,0,0,0,0,36465,0,0,4367,21989,32332,36094,17642,44126,0,0,
+10638,38827,18361,30058,0,0,0,45560,0,2803,24781,0,0,0,0,0,
+0,2854,40740,0,0,0,0,35978,40759,10578,0,0,42869,0,0,0,
+0,0,4054,17380,34650,0,0,0,0,0,0,0,0,1520,0,0,
+0,45429,0,0,0,23212,0,35059,0,23544,5997,26532,0,0,0,12564,
+0,0,0,0,0,0,0,0,0,0,33368,0,0,25133,38854,0,
+18021,0,0,0,0,12146,0,0,0,0,0,0,0,0,0,0,
+0,0,0,30449,27656,32480,43476,0,0,11845,3029,36226,16431,35718,0,0,
+12053,0,0,0,0,0,0,0,0,0,20828,0,11755,0,0,0,
+8218,0,0,0,0,0,17421,0,0,3304,26032,6051,19470,1449,2440,43114,
+21567,26396,47776,48771,0,0,0,0,0,11653,26479,16178,14275,39152,17888,0,
+0,5507,46604,48838,0,0,6721,0,41397,11611,0,0,37464,0,0,10691,
+15652,0,0,0,0,0,5426,9934,0,0,46937,0,8102,0,0,0,
+0,8562,29480,2502,43591,48707,0,0,0,0,20681,19171,39540,34693,0,0,
+22551,0,0,0,38559,0,36317,7173,33613,43004,0,0,36768,13504,0,14792,
+3886,21190,45065,48682,0,0,18596,17832,0,0,0,0,0,0,23885,0,
+30778,0,0,0,0,0,0,13075,24072,0,0,0,21025,0,24006,34302,
+29373,0,0,12460,11863,17745,0,17189,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,30356,12687,40572,0,0,0,0,0,0,
+0,0,0,29558,0,23238,0,35612,10444,18094,27243,48329,0,10907,32006,37650,
+6155,46909,36657,0,0,0,0,42587,0,37703,0,641,0,24021,0,0,
+23623,0,0,0,3866,0,0,0,0,0,0,0,0,19017,0,0,
+48202,0,0,0,0,0,0,0,0,0,26569,41897,38894,39699,0,0,
+44570,31492,47923,0,41579,0,0,0,0,34911,0,0,0,0,16251,0,
+0,0,0,0,0,0,43029,0,0,0,19982,26983,0,0,0,0,
+30679,0,0,0,0,0,0,22229,5724,0,0,0,0,0,0,0,
+0,3078,36797,0,37706,0,0,0,0,0,0,45701,0,0,0,0,
+0,31626,0,0,0,7780,0,0,0,0,3511,18850,0,0,36906,0,
+0,1530,0,8736,0,31595,35508,1428,9566,31115,45941,45453,0,0,0,0,
+0,0,0,25119,1195,3512,0,0,0,0,0,0,0,0,0,33391,
+24246,0,0,894,2664,36949,0,0,29706,0,3991,0,0,0,0,0,
+0,124,24648,0,0,0,0,0,0,0,0,0,28686,0,0,0,
+0,0,17841,0,43872,0,33756,0,0,0,0,22482,0,0,0,0,
+43434,0,0,0,0,47800,21779,43867,0,0,0,0,16209,7778,38873,39038,
+45251,0,0,34700,32325,33563,0,21697,24603,14078,0,0,0,13808,21715,35189,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,940,0,0,0,0,0,3485,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,12055,8977,0,0,0,16501,11227,
+28064,0,0,0,0,0,0,0,0,0,0,0,0,18766,0,0,
+0,0,0,15871,0,0,0,0,0,0,19868,0,40686,0,44758,43740,
+0,12183,0,0,0,0,0,14339,22086,25849,17309,0,0,0,0,0,
+0,39078,0,0,0,0,0,0,0,0,0,47175,0,0,0,39564,
+18260,13980,0,0,0,0,0,0,13393,6533,21913,0,0,0,0,0,
+0,0,0,0,0,0,19981,0,0,0,0,0,42347,40642,0,43183,
+45830,25452,0,0,0,0,0,43227,9812,38388,47237,0,0,0,0,0,
+0,0,0,0,0,0,32536,7106,25436,0,0,0,0,0,6562,0,
+0,0,0,42086,0,0,4291,9878,20230,6153,32086,0,13445,0,0,46754,
+0,645,0,35276,0,0,0,20349,34740,0,0,0,0,0,0,0,
+0,25584,0,0,0,0,0,0,0,0,11369,44028,0,0,0,0,
+22535,30742,0,14686,32515,0,0,34606,0,0,0,0,0,0,0,19801,
+0,21254,0,0,0,0,0,0,17498,22566,0,0,0,33124,46991,14860,
+0,0,0,0,0,0,29307,2633,0,9540,0,0,0,0,12436,39295,
+38728,0,0,0,10089,0,0,0,199,38133,46439,28469,47694,0,0,0,
+0,0,0,0,20879,0,0,20812,21558,21692,20447,5563,0,22584,0,0,
+0,0,18266,42289,48825,0,31195,0,0,0,0,0,23225,0,0,3065,
+11311,0,0,43468,34388,0,0,0,14392,0,1746,0,0,0,0,0,
+0,0,0,0,0,0,16326,33119,40595,0,0,0,43224,0,0,0,
+0,0,0,0,0,0,0,58,34153,34645,0,6830,0,0,28760,0,
+27847,0,0,0,38287,0,43151,0,0,0,23586,0,23826,0,0,0,
+0,0,7017,11487,0,31972,0,23496,25157,20728,40164,18444,43568,0,0,23610,
+0,0,0,0,26048,0,0,0,0,3373,20433,29881,36002,0,14558,35647,
+0,0,0,0,33727,0,37133,0,0,0,3434,0,19738,47026,0,13924,
+41197,14160,25387,0,0,0,0,43810,488,1274,10286,0,0,0,28801,16106,
+0,0,0,29232,0,0,0,0,28229,0,0,5214,0,0,8295,0,
+0,23666,0,0,0,3828,2378,46291,0,0,0,28194,31756,37035,33953,0,
+0,0,20820,0,0,0,0,0,0,0,0,33740,0,18647,26830,41713,
+0,0,38432,0,0,2347,6671,0,0,24089,41430,46595,46921,0,46860,0,
+26077,0,10919,0,0,0,0,43178,43404,0,0,0,5546,46063,7534,0,
+0,0,20255,33882,0,28061,33288,16128,777,0,28788,0,0,0,0,9738,
+37700,13449,0,0,0,0,32568,23213,0,0,0,0,27872,0,0,0,
+0,0,0,0,45206,37855,0,28587,11030,0,2884,13073,29871,37860,3150,0,
+0,19850,0,0,0,0,47008,0,18275,42287,0,0,0,0,0,12642,
+36804,0,0,0,0,0,13966,0,0,0,46578,0,0,48457,0,11406,
+0,0,0,0,0,44211,0,9711,0,0,0,0,0,0,28180,46116,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+31648,0,19199,0,39386,0,0,0,23240,0,12334,32377,0,0,0,0,
+0,0,0,0,0,0,0,31670,0,0,0,0,13321,0,0,44200,
+0,0,0,20424,0,0,0,25312,4444,0,18677,0,0,34484,19443,0,
+0,29414,48473,32267,0,4987,7376,0,7239,0,846,0,0,0,918,0,
+45869,0,0,0,0,0,10460,22373,28851,20455,0,0,39384,25874,46643,0,
+27489,0,0,0,36733,23039,40447,0,0,0,0,0,0,0,32359,0,
+0,0,0,22213,43055,0,0,0,0,24077,0,0,43629,0,0,42176,
+45530,0,0,0,0,0,0,2219,0,0,0,41627,11315,16893,41562,0,
+0,40139,29722,0,0,19536,0,0,0,33981,0,0,43721,44928,3543,23416,
+45334,0,0,28340,11571,41644,45163,28925,0,0,3367,0,13713,0,0,0,
+3484,0,0,0,0,0,35435,48754,0,1593,34577,0,41279,0,0,0,
+0,0,7566,21018,44275,11537,47404,4257,0,33930,0,20690,0,0,0,37518,
+21120,0,33168,29655,39949,11133,0,44201,0,0,0,0,0,15929,34631,20853,
+36590,29000,43366,0,0,12362,20340,0,0,0,0,0,0,7242,0,0,
+0,0,37073,0,0,0,0,0,18,0,0,0,0,0,0,0,
+0,16324,0,0,19272,0,0,0,0,22374,19511,0,13186,0,36288,40811,
+39755,0,0,0,5749,21132,14235,27860,17431,29366,0,0,0,0,0,0,
+4230,0,46653,0,0,0,0,0,0,0,0,22901,22982,0,0,0,
+0,0,18241,11236,36306,0,36678,38101,0,0,0,11427,0,0,0,0,
+31621,0,0,14189,21885,42219,0,26914,0,20557,20700,0,0,0,0,10654,
+0,37025,0,0,0,12818,0,0,0,0,0,42278,39095,20788,31427,0,
+0,0,0,0,0,0,0,910,0,1287,0,0,0,0,0,46836,
+0,0,41789,0,1423,37521,43134,0,0,17336,13205,45961,0,0,0,0,
+45035,2520,0,42368,0,0,0,30826,31382,0,0,13758,0,0,0,0,
+45554,0,0,4034,0,0,0,0,43565,0,0,0,0,0,13188,21982,
+37111,0,14508,0,19926,23959,25845,0,21435,0,32767,0,17347,24793,0,0,
+10796,0,0,0,0,0,37162,0,0,3684,34933,39478,0,25522,16828,47821,
+0,0,0,0,43516,23592,0,0,25171,14408,41801,3598,0,0,0,21755,
+2991,34071,0,0,0,0,0,0,0,0,46829,26212,32823,0,0,0,
+0,0,0,0,0,0,0,44744,0,31324,26648,40170,0,16450,0,0,
+0,0,0,0,0,0,0,0,0,10141,0,0,44569,0,0,14461,
+0,0,0,12699,18161,23637,37579,0,0,0,0,0,0,0,4499,16632,
+24986,36500,6043,0,0,0,0,34749,0,10296,8812,0,0,9071,19213,0,
+0,0,0,0,0,0,16646,3238,0,32307,0,0,0,0,0,0,
+0,0,0,0,0,0,0,42028,0,0,0,0,0,0,0,0,
+22541,22383,43627,14065,29588,0,0,0,0,37377,0,0,25945,28454,3948,34981,
+0,0,0,0,0,0,0,0,0,794,7561,44915,0,0,20825,0,
+0,0,0,0,0,6503,5944,12685,0,6637,8558,0,0,0,9041,41854,
+31571,4394,41595,0,0,34009,0,0,0,0,0,0,31708,28928,0,0,
+0,34025,0,31080,0,0,0,0,22145,0,0,0,34058,41726,26033,16080,
+41821,0,0,4728,0,0,5412,40187,0,18845,0,0,0,0,42036,17738,
+0,0,0,0,0,25108,0,17653,29271,19400,37763,14543,0,0,23954,0,
+0,0,25913,47356,30393,0,45620,0,5497,10402,0,0,0,0,41101,0,
+0,0,0,0,0,22308,22876,0,28422,0,0,0,0,0,0,0,
+0,38890,44963,47433,0,42855,26337,0,0,0,0,0,0,0,0,0,
+0,0,0,39520,0,0,0,0,34555,0,0,0,5591,0,0,0,
+0,0,42606,35463,0,0,0,0,0,30992,11209,0,0,0,0,0,
+0,21543,0,0,3106,0,11249,13731,30230,0,0,23857,0,44118,19638,0,
+0,0,0,20801,0,36516,0,14557,3728,20800,34669,0,0,0,7457,0,
+0,0,0,19041,17186,0,12750,0,0,0,8100,41225,0,0,0,0,
+26586,32404,0,0,0,0,0,13595,0,0,0,0,0,0,0,0,
+18971,0,0,0,24543,0,40594,0,47743,0,34067,0,0,14306,16102,46634,
+0,0,0,24017,25872,1566,0,21767,44367,0,0,0,25560,30827,46620,0,
+0,0,12531,0,120,0,14242,22923,0,0,0,0,0,0,38336,34105,
+0,29920,0,16123,0,0,9897,0,39847,0,0,0,10429,18894,27890,48313,
+8749,32561,29331,18494,27425,47634,21575,37751,0,0,15223,0,0,35932,0,33977,
+0,26179,0,0,0,2087,281,13882,27092,0,0,0,39870,0,27304,2850,
+43133,43338,7829,0,0,29843,36672,0,18847,14981,17956,19712,40357,0,0,0,
+25958,0,16942,0,0,0,0,0,0,0,5226,28888,0,0,0,5209,
+0,6367,0,0,0,5973,11255,15632,23294,47001,0,0,44676,0,0,0,
+0,0,40068,0,25347,0,0,18699,26326,0,0,33269,252,0,0,0,
+0,18996,19258,0,0,0,4794,0,0,0,0,0,0,0,0,22353,
+44528,0,44103,45864,0,0,0,0,0,0,0,0,0,34807,0,0,
+0,7992,0,0,41970,0,0,4432,0,7675,0,0,0,0,26951,40543,
+43507,20658,0,0,16310,25950,4211,7128,30338,19026,37711,17140,0,0,0,25456,
+0,38087,27329,0,0,8082,10964,18705,32199,0,0,0,0,24784,1100,0,
+0,0,0,0,36287,31929,9630,39488,0,0,7323,11203,0,23900,0,0,
+0,37952,0,42847,0,7987,0,0,40239,0,0,0,16831,21249,7094,31146,
+10220,0,44613,0,42816,0,0,0,41439,48148,26216,29525,0,0,0,32317,
+3376,42815,0,5284,29078,10196,0,0,0,0,39442,0,0,33935,0,23624,
+0,0,0,0,0,0,0,30793,0,0,0,0,16008,0,0,35355,
+46299,0,0,16705,14749,0,0,0,32874,3685,0,0,0,0,0,0,
+0,0,0,0,0,25969,26012,40808,0,0,0,0,0,3402,3949,14225,
+27820,36286,0,0,43244,0,0,30115,0,0,20975,0,0,0,0,16869,
+42451,0,0,38972,6000,45943,0,0,0,7335,29259,0,27362,0,7982,28821,
+10067,28088,47312,38790,0,0,0,0,0,0,0,0,11904,16131,31453,35088,
+0,0,0,0,0,0,44345,0,0,13553,0,28365,0,4950,24632,0,
+0,0,0,0,0,32461,0,0,0,0,4,0,0,0,43042,0,
+0,26144,0,0,0,0,35033,37124,0,0,0,0,0,5549,0,0,
+0,11680,0,14128,27884,4895,22978,45095,43807,0,1561,0,14752,0,0,43720,
+41758,0,18356,22081,0,0,0,0,0,0,46292,0,21455,22634,0,0,
+0,0,21806,0,0,0,0,30772,0,32593,26930,47804,0,0,0,29599,
+34276,0,0,0,25033,0,0,0,18414,0,0,0,0,0,0,0,
+0,0,0,0,0,0,15543,0,0,0,0,0,27772,40690,11376,42931,
+0,0,0,0,0,0,0,0,13143,0,0,0,23708,38110,0,40934,
+46687,0,0,0,46250,0,27269,30099,0,0,14433,44560,5721,0,27585,23931,
+4086,15677,0,0,34444,0,20644,31839,0,0,0,0,0,4964,20802,34308,
+0,8019,0,0,0,30930,29980,0,0,0,0,0,0,0,18533,0,
+0,0,0,0,0,0,1369,0,11528,0,38259,0,45719,0,0,0,
+0,29639,0,0,0,0,0,0,0,39954,0,0,0,0,0,23445,
+9980,13458,24283,0,0,5023,15393,30106,0,0,0,0,0,0,28152,0,
+0,41804,0,0,0,0,0,37409,0,0,35111,0,3430,0,17543,0,
+19101,0,0,17147,47084,23854,16929,40703,0,25489,0,0,0,0,47208,0,
+25535,0,0,0,0,0,36403,25056,0,46223,0,27283,0,0,46476,32144,
+0,17671,32979,40314,0,0,0,0,0,0,44274,0,0,0,33186,0,
+23483,0,0,0,1249,36466,5208,26718,43237,44689,13066,0,0,0,43034,0,
+0,0,0,0,0,28176,0,0,18496,47151,0,0,0,6647,8792,0,
+16354,0,0,0,0,0,0,0,0,0,0,0,13394,4773,0,0,
+7662,28963,43177,0,0,0,0,9963,16473,9782,0,0,23664,0,0,0,
+0,0,0,0,0,6408,0,0,34967,0,34547,0,0,37747,48184,13921,
+5310,22971,36474,0,0,0,31373,0,0,0,0,0,22237,0,0,0,
+0,0,19921,0,0,0,42680,0,0,22912,28836,0,0,0,0,40457,
+6348,0,5305,0,0,0,0,0,45305,0,0,0,0,35498,0,0,
+0,38876,0,30464,0,0,0,0,0,0,0,0,30552,0,0,44710,
+263,0,0,26663,35527,11471,0,0,0,0,0,0,8280,0,0,0,
+35403,17615,0,0,31605,4522,48768,0,0,0,0,13236,8981,0,0,47602,
+2248,0,0,0,39302,31323,0,0,0,0,0,0,0,17214,0,0,
+0,40790,0,0,0,47555,36550,0,0,25605,0,0,0,0,0,23731,
+19112,0,44921,0,27744,0,48128,0,0,0,0,28273,0,0,0,42572,
+34853,35570,0,0,0,0,0,0,0,0,8370,11416,0,0,0,0,
+0,24181,1143,42748,40371,20857,0,0,6573,0,0,0,0,0,0,32518,
+34735,17479,40682,14212,37698,0,9289,18598,0,7989,9892,30933,4827,7471,20803,46994,
+6011,38558,6923,0,0,21615,28534,10868,0,0,0,0,0,41781,48273,0,
+0,13257,18692,47462,0,0,0,0,0,29470,7387,0,0,0,0,0,
+31662,39783,36435,38844,0,0,0,0,0,0,0,0,2328,10041,12655,0,
+0,0,0,0,0,0,0,0,0,0,36445,0,0,0,0,0,
+0,0,0,39572,0,37710,41898,0,0,0,0,40761,0,0,0,39297,
+19953,0,40214,0,0,35500,0,16693,36140,0,0,0,0,0,37451,0,
+0,27718,0,0,36531,12748,0,0,0,0,0,0,47803,9620,21243,0,
+0,0,0,0,29314,0,0,28932,41183,0,0,0,0,0,0,0,
+0,8126,0,0,0,0,26251,0,21794,25136,44221,0,9966,30331,12347,34713,
+28192,35823,17244,48360,48762,0,0,0,0,0,29471,0,0,45485,0,6306,
+0,0,14563,0,0,11588,0,0,0,0,0,0,0,0,0,24770,
+0,0,0,0,26394,0,0,17462,0,0,0,32454,23955,0,0,33656,
+5359,46108,0,0,0,43686,12551,0,0,0,0,0,0,0,0,0,
+0,25079,462,0,44968,0,0,0,0,43942,0,0,0,0,0,44788,
+0,29611,18093,20678,39121,48137,39447,0,0,0,0,0,0,48661,0,0,
+324,365,26245,0,0,0,31249,37033,11430,5327,0,6632,11138,3806,46765,0,
+0,0,0,46343,0,0,0,0,0,0,3987,14363,24788,0,0,33556,
+0,0,0,0,0,0,0,0,0,1189,0,0,0,0,0,0,
+0,0,0,46792,0,0,0,0,1546,23903,0,0,10266,44471,0,0,
+0,0,0,0,0,19598,0,26094,0,9405,21434,0,0,0,0,46051,
+0,1623,44389,0,0,12719,0,0,0,27008,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5748,0,21100,0,0,0,0,0,
+47169,0,0,0,7396,0,0,0,0,0,0,32050,0,0,0,0,
+0,0,0,17758,0,0,0,2910,21224,0,0,0,44645,0,0,0,
+0,0,618,2516,0,0,0,0,0,0,38411,0,0,12076,33134,17627,
+0,7012,14650,0,0,0,21281,0,0,0,0,23435,0,0,0,4629,
+30134,0,0,0,0,0,0,19812,0,0,0,0,0,0,37463,0,
+0,0,0,45876,0,0,0,30324,11914,0,33002,0,0,0,0,10012,
+0,0,0,0,45819,0,0,0,30044,31322,3972,39248,0,0,0,0,
+0,0,0,0,0,0,0,25037,35003,36419,0,43671,0,11418,0,0,
+0,0,24583,44140,0,36785,0,0,39822,0,0,0,37566,45442,0,0,
+0,19742,43838,0,0,0,3496,32211,36784,0,0,0,0,0,17427,0,
+0,0,0,0,47778,0,0,36086,48107,0,0,0,0,0,0,7488,
+0,0,0,0,0,1006,29222,0,0,0,0,0,35067,17094,0,0,
+47170,0,0,0,17685,41445,0,0,0,0,0,4985,0,6618,0,0,
+0,0,0,0,10404,21523,16801,17617,24767,44815,0,0,0,0,19907,0,
+0,7247,0,0,0,35246,9751,45543,21579,0,0,0,0,0,0,0,
+0,31089,40613,40525,0,39846,0,0,0,9704,18135,28667,0,13221,46989,0,
+22323,0,0,20762,0,0,22763,0,0,29850,0,0,20663,24601,0,0,
+0,0,0,0,0,0,0,0,10728,0,0,0,0,0,0,0,
+18924,0,0,3479,0,0,0,0,0,0,30750,0,44398,0,0,0,
+0,20390,0,0,24180,0,481,31955,0,0,0,0,2201,0,16579,0,
+0,0,48340,0,0,0,0,0,40093,3360,0,0,0,0,0,0,
+13603,19304,31586,0,0,0,0,0,8845,13613,30725,38546,0,25806,15964,0,
+0,28134,0,0,0,43607,0,0,25439,0,0,17204,0,0,0,6374,
+11800,38930,0,35832,38798,41194,45422,0,0,13932,15749,0,0,41107,0,33388,
+45996,0,0,0,3144,30292,5145,4459,11558,13428,0,0,31702,0,0,13326,
+0,0,5106,0,0,0,48529,19204,0,15187,0,0,0,0,1313,0,
+0,23943,7741,0,0,0,0,0,37797,0,0,0,12024,0,0,0,
+47586,1922,8042,11880,0,28347,0,0,0,0,0,0,0,6870,465,28435,
+44189,0,0,25173,32879,24167,0,0,15320,0,0,0,43432,0,0,0,
+0,11110,0,0,44440,0,0,0,0,0,0,0,0,1278,4879,32716,
+33360,4845,11250,36009,15822,0,0,21147,35715,0,0,0,2348,30947,46340,0,
+0,0,41055,0,31194,24051,0,0,0,47221,0,0,0,0,0,0,
+0,15714,37295,0,0,22439,28325,31110,0,0,0,0,0,0,24335,0,
+0,0,0,0,18467,37745,44880,46908,0,18430,32277,28890,0,0,0,41404,
+0,0,0,0,0,0,0,16083,0,0,0,0,0,0,25504,0,
+0,0,0,0,0,30413,0,0,18452,23360,23263,47673,0,0,0,0,
+0,0,26192,32041,0,0,0,0,42599,46231,0,0,18597,0,0,0,
+0,0,30010,41572,0,14613,1552,28046,0,21392,34134,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,19620,0,0,34802,0,
+0,0,0,0,30218,0,0,4681,0,0,0,0,0,0,0,6494,
+13821,8048,0,0,0,0,0,8990,33054,20096,3362,16635,14502,0,0,40331,
+28935,30192,0,0,0,38700,12997,39476,37572,0,0,17669,31058,32282,33035,6375,
+14324,29995,41706,0,0,0,0,45456,0,10459,0,11603,4166,0,0,0,
+0,0,48414,0,0,0,0,0,0,37773,43395,37558,0,0,3576,0,
+0,45698,0,32872,0,0,0,0,0,19347,17651,0,33347,0,0,37274,
+0,0,5396,29704,39607,0,34603,0,0,0,0,0,0,0,0,0,
+0,0,26404,0,18436,11556,0,0,0,32674,38299,0,0,0,5159,6386,
+7485,23410,0,4896,0,0,0,46317,0,0,27187,25873,0,21499,0,0,
+27121,0,0,38307,0,0,0,0,0,0,36225,0,0,0,34785,0,
+27006,0,0,0,0,0,0,0,0,31969,0,2692,18023,11192,17657,27464,
+28877,17459,0,0,8548,0,0,0,0,0,0,0,0,20659,720,0,
+48437,18115,9161,25357,0,0,0,33775,680,2498,37461,46389,13837,47031,0,0,
+0,0,0,0,29016,25801,0,40794,0,0,0,23662,32370,45743,0,9036,
+43274,26907,41001,0,0,27525,0,0,0,0,37867,40534,0,0,22430,0,
+0,0,45474,0,34990,0,0,0,0,0,20605,0,0,0,0,0,
+0,44925,0,38937,0,0,0,23576,0,0,0,4091,0,0,0,28233,
+0,48699,0,0,15582,24486,14405,0,0,17721,37149,0,31911,17828,0,22670,
+0,0,35671,0,7819,22831,0,0,0,0,0,34304,27971,0,0,17868,
+0,0,0,35946,0,0,0,0,0,0,22944,34216,14527,0,0,26090,
+0,0,0,0,27640,29635,43965,44386,36109,0,0,0,0,0,0,0,
+0,0,0,0,7541,0,0,0,0,46562,0,0,21441,5840,0,0,
+0,0,0,7905,0,11245,0,0,37852,33552,0,0,0,0,0,0,
+6648,0,0,8078,0,0,0,0,42964,0,23557,42442,0,0,0,40958,
+0,0,0,42418,0,22996,0,0,0,0,0,0,3666,28900,0,33278,
+0,48569,0,0,0,0,0,0,15936,0,0,0,35615,0,0,28113,
+48037,0,4410,0,0,14470,22701,0,0,0,29632,0,0,0,21635,0,
+0,0,18311,0,0,11495,36577,0,0,23941,24855,34298,23332,7052,0,26999,
+40715,44017,7663,0,0,0,0,0,0,0,22720,0,12720,0,15103,0,
+24517,0,0,0,0,12744,21385,24058,45968,0,0,41538,2753,0,48141,37665,
+7260,0,18814,26521,45921,0,14436,30735,29226,22185,0,21092,21724,8125,42098,0,
+0,0,0,23147,15934,6589,0,0,0,30207,42559,0,0,0,21999,3523,
+0,0,0,0,0,0,29928,0,0,0,0,36089,0,0,0,0,
+0,6124,29654,0,31363,0,0,0,30563,43000,0,31613,27602,7876,24177,37459,
+4716,41952,6736,22062,36923,21099,0,637,32473,0,0,34326,0,8782,25510,0,
+0,0,4819,0,0,0,0,26131,0,0,0,0,5313,0,40216,0,
+0,0,0,0,11992,42782,33527,9137,34959,0,0,11569,0,0,0,0,
+5449,0,0,26517,0,0,0,13417,0,0,0,0,0,8848,0,0,
+0,0,0,18132,12310,0,44717,14251,0,0,0,40452,19954,16880,16477,42448,
+0,0,0,0,0,0,13701,0,0,0,0,0,0,41609,0,21076,
+40911,0,0,0,0,0,0,21406,13577,37839,0,0,0,2119,0,0,
+0,0,0,0,38830,0,0,0,0,0,0,0,12757,15709,0,41495,
+0,0,0,0,0,0,14723,32091,47155,2568,1742,25019,0,0,0,0,
+0,5443,0,0,0,0,0,29620,31124,19158,20288,0,0,0,37640,10087,
+25603,0,0,757,0,0,0,0,0,24300,9476,21910,0,4991,20711,0,
+9581,0,0,0,0,0,46213,0,0,33408,0,45644,0,46959,0,0,
+35957,0,0,0,0,0,0,18152,0,0,0,8132,41728,43659,0,0,
+38292,0,42048,42755,0,5401,21899,13198,0,0,0,0,0,0,27009,0,
+41800,12339,0,45954,0,0,27576,0,0,0,0,0,0,39043,0,0,
+869,44308,0,0,10331,34439,37172,0,0,0,0,0,0,0,32744,0,
+0,0,34182,0,7745,23710,0,0,0,0,0,17059,0,34078,0,18768,
+0,0,0,0,0,25213,0,23501,0,28006,0,0,0,3578,0,26579,
+0,0,0,0,0,0,0,0,0,0,17086,0,0,3265,0,0,
+18600,21945,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,44713,10841,0,0,6978,41165,0,0,0,0,18857,47044,
+0,48042,0,36305,39253,45589,40418,0,0,0,47623,0,0,19819,0,40721,
+0,26960,48411,0,0,28219,972,0,0,0,0,9621,26918,38817,16040,0,
+0,0,0,31399,0,43821,0,0,0,0,35928,3298,0,0,0,0,
+0,16681,30629,0,0,0,29597,37370,0,0,0,0,5772,9505,11329,31645,
+0,0,0,0,0,0,0,0,0,0,0,0,0,15669,0,0,
+0,0,8875,0,0,0,0,0,12891,33471,40438,690,7262,20364,27712,0,
+0,0,48454,15805,16537,45449,25562,33093,27523,0,5734,0,0,36414,0,20932,
+0,0,0,0,0,0,0,30533,0,0,0,0,45605,0,0,0,
+25709,22083,0,0,0,0,16934,0,48703,27728,0,0,0,944,0,0,
+37071,0,0,0,0,1013,0,38668,0,0,1795,0,7622,0,787,3875,
+0,0,12343,0,4596,4849,0,0,0,0,31798,0,21201,25180,14261,0,
+0,0,0,0,0,0,0,0,0,0,0,0,18111,0,37437,0,
+0,19310,11398,31155,0,0,0,0,0,10111,24537,24831,0,29929,0,0,
+1549,16495,0,0,48541,0,0,0,0,6580,0,0,0,0,0,0,
+0,0,0,0,0,25365,0,0,0,5464,30844,0,0,0,0,0,
+0,0,0,0,323,30345,0,0,0,1569,0,0,0,11888,0,0,
+4235,35014,0,18180,0,0,0,36076,46599,29101,0,0,0,18771,0,0,
+40513,0,0,0,0,0,0,0,0,7799,31856,18352,34032,0,0,0,
+0,0,0,27342,0,0,0,0,0,0,0,0,2043,42129,19649,0,
+0,0,0,0,0,0,0,0,41318,0,0,21341,11345,21004,28593,14950,
+35177,41168,0,0,0,0,0,44865,0,23022,4910,0,0,0,0,672,
+0,0,0,0,0,34827,0,0,0,33732,45470,5597,0,0,0,0,
+0,28817,0,0,0,0,0,23915,9495,17746,47056,0,0,46115,0,47339,
+1114,16060,0,0,43440,0,0,0,2542,0,0,7265,9277,16235,0,0,
+0,31771,20323,23477,0,0,0,0,0,0,0,39020,15933,0,23867,0,
+0,0,0,0,0,0,0,0,0,0,0,24468,0,0,129,3516,
+0,0,0,0,0,42032,0,0,0,0,17821,0,16966,32376,0,0,
+0,0,8807,0,0,27313,39382,13407,20850,48720,0,0,0,43789,0,0,
+0,0,35683,44074,43602,0,0,0,0,0,1985,17466,0,19776,0,0,
+31538,23531,0,0,0,0,0,0,0,0,10568,0,0,43943,0,0,
+6668,0,48416,0,0,0,37778,0,0,0,29702,0,0,0,0,0,
+0,0,21077,0,0,0,0,0,0,0,5551,0,0,21863,37815,0,
+0,0,0,0,0,0,0,32598,20014,0,7145,8235,25361,17369,239,0,
+46242,0,0,31592,46038,0,0,37612,25838,0,0,0,0,0,0,0,
+0,21489,0,48759,16750,0,13654,0,27015,0,0,0,44001,1206,0,0,
+0,0,41088,6561,0,0,0,0,0,0,0,0,736,0,0,28328,
+0,17765,11242,35099,39116,40366,0,0,0,0,0,0,0,0,4263,13767,
+0,16460,0,4673,0,0,0,0,0,0,0,0,0,28647,26603,0,
+0,0,0,13373,15667,19029,29528,0,0,5575,24148,0,46768,0,41423,0,
+0,0,0,34792,32101,45574,0,0,0,0,0,47349,31150,42634,0,0,
+36682,0,2935,0,0,45655,0,0,0,0,19061,5067,0,0,0,8103,
+0,0,0,45851,0,0,18029,0,0,0,0,41596,0,0,0,16945,
+0,0,13884,0,0,0,1240,0,0,0,29452,36584,0,4275,0,0,
+0,0,32510,8124,0,0,33887,0,0,0,0,45406,43978,0,39516,5519,
+47641,0,0,0,0,7255,0,0,0,0,0,0,0,0,0,0,
+0,0,17991,33211,0,0,42731,0,0,0,0,0,21639,0,0,0,
+0,0,0,5277,0,0,0,0,32029,32984,0,0,0,0,13785,0,
+15703,0,27875,0,0,0,0,26171,37870,42149,0,2055,40275,0,0,0,
+0,0,0,0,42660,0,0,0,0,0,0,0,46206,0,19306,25323,
+0,0,38756,21711,0,0,0,0,0,0,0,0,0,42292,0,0,
+0,1015,32825,24743,0,30471,25856,0,1852,3567,12567,26743,0,0,0,0,
+0,0,0,0,0,0,32550,34533,20759,0,11615,0,37979,29584,0,16385,
+0,30352,23807,0,18277,5254,16346,7842,23050,0,43239,31506,43091,13841,0,0,
+10383,11085,0,0,0,37950,0,0,0,0,0,0,0,0,0,0,
+0,25310,0,0,37223,46552,28882,44501,0,18914,2985,25947,35159,22729,36228,14879,
+0,0,0,0,21569,40063,12602,0,0,0,0,22192,719,0,0,0,
+0,23307,12058,0,0,0,876,0,0,0,0,34495,36088,0,0,0,
+0,0,0,29234,0,13416,0,0,0,0,0,0,0,0,16094,0,
+6967,0,38801,0,0,0,41984,22007,0,0,0,10616,0,43855,0,26841,
+0,0,0,21319,5406,12223,17791,0,42165,0,0,0,0,0,0,0,
+0,0,0,0,0,0,4871,25574,0,13800,0,0,0,0,0,19055,
+0,35373,0,0,0,0,0,15232,0,0,38322,0,0,0,0,19662,
+0,0,0,0,0,31130,12615,20841,46387,0,0,0,0,0,0,28139,
+15954,11148,34427,0,0,0,0,0,0,0,0,29594,12269,31594,0,34984,
+20787,29648,27861,31722,0,0,0,0,0,36106,26381,17650,46514,0,2659,197,
+6960,13189,21337,9810,28504,40621,0,0,0,0,0,0,0,0,0,0,
+35881,0,18849,0,0,0,0,0,23979,0,0,38935,32642,0,0,0,
+0,0,0,0,0,0,15212,3799,0,0,7627,0,16206,46148,0,0,
+15338,0,1077,0,9602,8044,25228,0,21177,4717,0,35271,0,15645,0,4382,
+1575,7178,42242,15102,0,0,0,0,0,0,0,0,33036,0,5200,34602,
+39541,0,0,41129,0,9390,4863,0,0,0,45980,7334,34387,0,0,0,
+0,0,0,20501,0,41676,38936,0,1081,0,0,0,0,0,0,0,
+0,0,0,9293,0,0,16353,11190,0,4932,27677,0,0,0,0,0,
+10684,46724,0,0,30156,0,0,0,0,0,41007,0,0,28626,39228,0,
+0,0,0,0,0,0,0,0,24475,36035,0,0,0,0,0,0,
+0,0,0,0,0,15408,0,0,0,0,14215,0,0,16291,0,21843,
+0,0,0,0,14854,30744,0,0,21019,30349,33175,0,0,39146,26875,10730,
+6943,39734,0,23031,26153,7889,0,35297,0,0,13762,33439,44093,10510,0,0,
+0,0,0,0,0,4064,24512,19718,39104,0,0,41327,0,13805,0,0,
+0,0,42877,3196,0,0,25276,0,0,44250,43617,48333,27905,0,0,0,
+0,0,0,0,0,0,0,0,0,1028,0,16438,0,0,0,0,
+2580,11278,29089,0,0,0,20948,0,0,0,0,0,0,8665,0,42392,
+0,0,20277,24272,39216,47881,0,0,0,0,0,40451,47419,0,0,13398,
+0,0,0,0,0,0,0,0,2233,0,18588,0,0,1094,0,0,
+0,0,584,29762,0,0,0,0,0,0,17139,11220,0,4420,0,0,
+40089,0,0,16684,15613,40616,0,0,34824,0,222,27981,40756,0,0,0,
+44325,0,31976,0,0,0,0,3636,28583,10232,1936,0,17410,0,21087,0,
+0,0,23768,0,0,37371,32445,22108,0,16968,17444,5744,0,0,0,18333,
+30833,42301,43761,33189,46035,43926,0,7776,0,0,0,0,0,29990,0,0,
+0,0,0,0,0,5789,29113,0,0,0,0,0,2080,5979,48833,20647,
+0,9218,0,0,0,0,0,0,0,0,0,48133,0,0,0,0,
+14983,3278,3953,45027,0,5212,0,0,0,34222,0,0,0,0,0,0,
+30175,0,5664,0,0,0,0,0,0,21145,0,2331,8160,0,0,0,
+0,0,0,0,6953,0,0,0,48446,42044,0,29627,23221,0,0,0,
+0,0,0,0,0,0,0,0,21051,7104,0,16485,3297,0,0,0,
+0,0,43653,0,17506,29712,38082,0,0,0,0,0,0,0,0,0,
+0,28537,0,0,11895,44238,46083,14391,23607,0,0,6016,15969,0,0,0,
+0,0,0,0,8528,0,0,0,0,10574,0,0,0,19844,260,0,
+36651,0,46722,8759,18254,28284,30830,0,0,0,47114,0,0,0,0,0,
+14389,0,0,0,0,0,0,21856,0,0,0,0,0,0,5111,16714,
+0,39630,28905,15241,46525,16903,0,3230,0,0,21331,9523,0,0,0,0,
+0,18851,0,0,0,0,0,0,0,0,1246,0,0,0,0,0,
+0,0,25153,0,38665,0,0,0,0,47505,0,0,0,0,0,40299,
+19033,0,0,0,26204,28869,18681,20479,0,0,0,0,0,0,0,0,
+14089,42929,0,36090,0,20599,0,0,0,2442,0,0,0,25163,0,0,
+0,46380,0,9301,0,0,0,0,41102,0,0,0,7425,12822,0,10837,
+45708,0,0,0,0,41247,16444,0,0,0,6543,0,0,0,0,45979,
+0,0,25760,0,0,0,14353,14939,41978,33381,42309,0,0,0,0,47900,
+0,0,12473,0,0,0,0,0,0,0,0,0,36102,0,0,47507,
+0,0,48848,46224,31559,40702,0,27498,0,0,0,0,0,0,0,28784,
+0,0,0,0,0,19489,0,28864,0,5792,32563,0,33207,14266,0,23579,
+42208,0,5064,48645,17404,0,18610,0,0,0,0,7204,0,0,0,17276,
+0,0,0,0,37804,14859,0,25287,0,0,0,34917,0,0,17502,0,
+0,0,11832,0,0,0,0,0,0,0,41650,0,0,0,0,178,
+38775,0,0,0,0,0,0,0,44188,0,0,0,0,38390,0,0,
+0,0,0,46045,0,0,0,0,29419,0,0,5435,26425,0,0,0,
+0,27606,0,581,48886,0,15366,0,0,43520,0,0,0,10352,0,0,
+0,0,0,46455,0,29399,0,0,3137,0,0,36724,38531,24106,21576,34569,
+37713,45670,28739,0,0,0,0,14012,0,0,0,0,0,0,0,10120,
+12445,14173,0,0,0,0,0,0,9386,4376,0,0,0,21452,0,35299,
+0,34307,24402,19425,29886,26256,36800,36600,39712,0,0,0,19992,9235,0,0,
+0,1646,0,6451,0,13784,0,1507,0,41741,16558,25759,30921,5634,48231,0,
+0,4305,25141,0,0,0,0,0,0,0,0,0,0,0,0,4857,
+1839,23421,0,21391,0,0,25167,44515,0,36262,37284,0,0,0,0,0,
+0,42926,33806,38967,0,19499,21397,0,0,0,10618,0,0,0,46104,0,
+0,41273,0,31498,16998,0,0,40037,0,0,0,0,0,0,0,0,
+0,30387,0,0,48547,0,0,0,32102,0,0,6601,37066,1107,0,0,
+0,34532,46464,25716,24598,48536,0,46517,0,30671,0,0,38515,0,0,0,
+35248,0,42386,39137,0,0,0,0,0,0,0,0,0,0,0,1162,
+0,0,0,18666,19150,22196,32214,37188,0,0,0,0,32534,0,0,0,
+0,0,0,0,0,0,1257,34206,0,43166,47389,25434,27371,28592,42759,3120,
+0,12330,26375,0,0,26769,0,0,43695,0,18892,31406,44170,4800,34213,0,
+0,38203,0,0,0,0,0,46414,0,0,0,0,0,36011,0,0,
+24688,37470,38784,48112,48558,0,13233,6537,29364,48389,0,0,11629,0,9618,41645,
+45186,29002,34964,39045,0,0,36664,0,0,33829,0,0,0,0,0,0,
+0,7853,9559,26896,0,0,0,0,0,0,4193,25277,29432,29716,11377,46579,
+37046,0,0,0,25245,37398,0,48728,0,0,0,0,0,0,0,12732,
+3934,0,0,19449,0,0,45511,0,0,0,0,0,0,0,3445,0,
+0,16594,0,0,0,0,0,0,42830,0,0,0,14043,29795,0,0,
+0,0,2433,34238,0,0,0,40498,2341,6860,31684,42990,43372,29324,0,26500,
+41324,0,20418,0,0,30184,0,15352,0,0,0,27604,0,0,0,0,
+37185,0,12067,0,0,0,0,0,6882,37766,0,0,0,0,0,0,
+27583,15415,0,0,0,34534,0,0,0,0,46761,0,0,0,0,0,
+0,0,47569,0,0,0,0,0,0,0,0,13752,0,0,0,0,
+0,6219,0,0,0,10864,0,0,0,0,0,0,44647,0,2802,43228,
+0,0,0,0,10507,36193,0,0,0,17521,39708,28115,47898,0,0,0,
+38008,0,0,0,0,0,0,0,7160,36271,37730,10257,19315,40710,41200,0,
+17616,19756,39599,45575,0,0,0,0,0,0,0,0,44660,153,0,3156,
+33755,0,0,2120,25567,31086,0,15719,0,0,31213,0,0,0,0,0,
+0,24099,0,0,45228,0,15379,0,5711,0,0,0,20421,9107,2990,39073,
+29040,30719,0,16121,7874,0,40629,0,0,0,0,40789,20815,38125,0,0,
+0,0,0,0,11865,0,16908,41084,0,0,29427,0,0,26978,0,0,
+0,0,0,39961,0,0,0,0,0,0,9258,0,48192,42038,31129,0,
+4968,0,0,0,4197,0,0,38003,46977,0,43603,0,0,0,0,0,
+0,0,34832,0,0,6730,38286,31141,46275,48387,29726,0,0,0,0,0,
+0,0,20388,45142,0,0,0,0,25269,5189,26443,34330,45839,0,0,0,
+0,0,0,21113,34348,40465,648,20748,0,3188,42090,0,31998,26806,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,33526,0,0,0,
+0,0,0,1161,15597,19330,0,0,0,0,0,0,0,0,0,0,
+0,35136,0,15240,0,0,0,0,0,0,0,0,0,0,0,15273,
+0,30704,0,15020,0,29615,25791,41517,0,28002,45201,0,21592,0,0,0,
+0,0,0,16777,29322,26655,39672,0,0,0,0,17709,6827,0,0,0,
+0,0,46184,0,0,0,38741,15518,44473,34085,0,47476,11581,0,0,0,
+21510,0,3816,36806,0,26001,0,0,0,0,0,26386,0,0,17296,0,
+0,37152,8073,3219,26694,45808,0,0,0,35561,0,0,0,0,43299,0,
+0,4777,4264,0,0,0,0,0,0,0,41203,2278,0,0,9923,26205,
+0,0,0,24029,0,41684,21134,0,40500,0,0,0,0,0,0,0,
+0,44902,0,0,0,2200,0,0,10633,0,0,0,0,0,0,0,
+0,0,0,0,0,44606,0,44299,3691,0,0,0,33012,0,0,0,
+0,504,13170,0,0,12246,0,0,0,46192,17487,0,0,0,0,0,
+0,0,0,31551,15284,32911,43882,15694,32038,48861,0,0,0,32375,21030,0,
+0,0,5830,0,0,0,0,0,0,11731,47871,0,0,19132,0,29196,
+0,0,0,0,0,0,1092,0,0,0,0,0,32696,42662,42566,0,
+15448,0,0,0,0,0,0,0,0,0,2077,42178,14447,0,26581,33718,
+42189,0,0,35257,18592,0,0,0,27327,0,0,0,0,0,0,44078,
+34311,42836,4516,40771,0,29194,24110,29785,0,0,0,0,11229,16877,0,1732,
+0,0,0,0,3508,47496,0,0,0,0,30621,0,48354,15440,0,12530,
+0,0,0,16504,0,0,10407,33303,36292,0,41772,35699,2197,0,0,41885,
+0,0,0,0,0,0,4758,0,0,0,0,29118,0,0,0,47234,
+32340,0,45976,0,4361,0,18129,35910,0,27166,2289,0,0,0,26341,16199,
+0,0,0,41625,0,0,0,0,0,37931,0,41077,0,0,0,0,
+0,8637,15999,1025,20417,5099,41008,47646,0,0,0,0,23511,23553,0,45033,
+19498,44326,31057,6132,45472,0,12914,0,0,0,0,12622,19714,25030,0,0,
+0,0,32677,0,0,34425,0,0,27831,12692,0,0,0,41890,0,0,
+0,4109,26915,0,0,0,0,0,0,9719,18379,27058,0,0,0,0,
+27978,0,16153,0,0,0,0,0,0,31037,0,23276,2164,26034,45539,0,
+0,0,0,0,0,0,17734,0,0,0,15563,20906,0,10314,1361,11309,
+0,0,27215,0,0,0,0,8566,24491,48172,0,0,39127,0,10312,0,
+0,16802,24462,0,0,0,0,0,13300,35100,0,13368,23808,0,0,0,
+16609,47939,0,0,0,0,0,0,0,0,1045,3863,0,0,0,0,
+0,20353,7009,36892,15640,48257,0,0,12613,0,0,0,0,0,0,9022,
+0,0,0,0,0,20846,0,0,33773,0,0,0,15091,0,37661,0,
+0,0,16130,0,0,0,18930,0,0,0,0,0,29383,0,0,0,
+0,0,0,6553,35335,0,17845,0,0,0,0,0,0,0,0,0,
+0,0,3483,0,655,2624,0,0,0,34862,0,28621,0,0,0,0,
+8049,15990,19469,0,44825,304,0,0,0,0,0,0,0,0,45990,0,
+0,0,0,0,21217,7478,0,3127,0,3923,0,40798,0,0,0,0,
+33273,0,28259,0,0,0,0,0,25275,0,0,0,0,0,0,41855,
+32389,0,0,41578,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,3772,0,0,18397,0,0,3184,0,0,
+0,0,0,0,0,0,0,18983,23747,1654,15445,19745,0,0,0,0,
+0,0,33010,39139,30378,0,0,0,0,0,0,43316,0,0,0,0,
+0,0,0,0,0,0,16905,0,0,8600,26535,0,0,0,0,0,
+47599,0,0,0,0,0,29397,35966,0,24561,0,0,0,0,0,0,
+0,0,0,0,5291,0,5091,46423,0,0,0,0,0,0,0,4286,
+5858,38216,39502,40453,0,0,0,0,0,0,6172,1450,10801,29160,45888,0,
+0,0,0,0,0,297,36136,0,0,44463,0,0,0,26483,0,0,
+0,0,0,2005,14474,0,0,0,36769,0,1359,0,0,0,42538,46262,
+0,42659,0,41086,0,7095,33796,0,17339,48721,0,0,0,0,0,17001,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,1430,9524,21247,47912,0,6134,0,0,0,0,0,25295,0,17266,
+0,24641,0,0,0,29789,28990,0,0,0,44370,18450,21781,0,0,0,
+0,0,44092,19622,35855,0,21743,0,0,35939,30333,13664,39791,0,0,0,
+0,43337,36926,0,0,38121,0,0,0,0,0,8536,0,9744,30832,0,
+0,23418,31942,35729,16243,0,0,4026,44959,0,0,0,0,19355,0,13655,
+23358,0,0,31841,0,3729,5171,14889,0,12300,0,0,47330,6847,31000,11620,
+0,9184,0,0,0,0,12722,0,0,0,0,23242,0,0,0,0,
+0,0,0,0,0,37346,0,0,0,31814,0,46125,0,0,15777,26115,
+0,21765,15344,34677,0,0,0,0,36592,0,32161,0,0,0,0,0,
+12854,18741,11212,26440,0,34246,0,37813,0,0,0,0,12186,7203,12648,32035,
+19283,33219,0,0,48062,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,22060,0,28752,9214,0,0,0,1210,16122,0,0,0,
+0,0,0,22858,0,0,24040,47320,0,31916,0,0,29283,0,0,0,
+23110,36535,0,0,0,27667,44790,0,0,43631,646,14157,0,0,6644,29529,
+15507,36176,48511,0,0,0,0,0,26903,7206,0,0,17047,9795,31526,0,
+28228,0,0,0,0,18479,0,0,0,46841,0,17356,0,0,10191,14959,
+16156,17562,0,0,40602,0,0,0,29621,28993,0,0,25129,42317,0,13682,
+26846,25464,39702,24456,0,0,0,31652,12678,0,0,0,0,12794,15099,33052,
+0,0,0,0,0,0,0,44817,12128,16338,4564,24792,28450,0,0,0,
+2540,15153,21979,43545,22474,25914,45934,0,0,0,40223,0,1938,17860,0,0,
+0,0,0,0,24981,45409,0,0,0,0,12661,0,10665,0,10399,0,
+0,4310,29420,0,21334,0,43888,0,45811,0,0,12994,27397,0,0,14568,
+8389,4469,0,0,0,0,0,0,0,0,0,11272,0,0,0,0,
+0,0,2242,2730,40997,0,0,12396,14634,0,0,0,0,0,15230,23244,
+0,46208,0,18469,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,2034,4128,17976,23771,40236,40477,29831,0,0,0,0,39574,4915,24732,
+326,7027,33729,0,0,0,0,0,42633,0,0,0,0,0,30787,0,
+0,23838,34711,35602,46366,27856,15900,28854,0,0,29063,48379,1556,0,0,0,
+0,0,0,21896,0,0,29279,0,0,0,0,42008,0,0,0,0,
+21907,20031,0,0,0,0,23809,37900,36277,6951,12491,41870,47274,0,0,0,
+0,0,0,9698,22700,0,0,0,25981,16162,35503,0,8540,46573,16911,0,
+0,0,15881,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,47200,0,0,4703,22887,44497,48217,0,37962,0,0,0,0,38028,
+29906,32,0,3135,0,31576,19191,0,0,4241,0,0,0,47890,0,0,
+0,0,0,0,0,0,0,0,0,0,0,8628,24118,0,0,15548,
+0,824,14326,1920,20428,19117,12935,20018,21854,6156,11523,25014,39519,0,0,14476,
+27543,0,0,7235,21599,27157,28894,30272,31306,42544,23703,39535,48009,0,0,11316,
+0,0,0,0,0,0,0,33847,0,19666,0,0,0,0,38608,9285,
+47332,0,0,19494,0,45958,0,11141,0,0,0,0,0,0,0,0,
+0,43600,0,0,24085,0,47235,0,0,0,0,19545,0,0,0,0,
+0,0,8957,31503,0,0,20192,0,0,10471,0,0,14940,33561,0,0,
+0,0,45211,0,0,0,13711,39131,0,0,0,0,0,0,0,0,
+27351,0,0,16883,28036,0,8670,0,45014,0,0,19370,0,0,0,0,
+18758,22092,0,0,0,0,150,0,0,0,0,0,5352,36413,0,0,
+0,0,0,0,27403,5163,0,15495,18682,0,36079,18581,0,0,0,0,
+0,0,0,12717,0,0,11010,32666,0,0,35524,0,0,0,0,0,
+0,0,0,0,0,0,0,13304,1558,0,0,38221,0,0,24812,0,
+0,0,0,0,32533,0,0,0,0,0,0,8067,0,9761,10388,47628,
+0,0,0,37535,36113,33206,0,20156,0,41919,46633,0,0,16115,0,0,
+0,0,111,34734,24151,0,0,18527,44132,0,24746,0,22057,40831,17855,0,
+0,0,0,0,0,0,22035,0,0,0,0,0,0,24849,46144,0,
+46052,18634,0,7449,0,0,21469,0,0,0,0,0,0,0,0,0,
+25462,40857,17128,24204,0,0,0,0,0,0,0,0,25071,43023,33494,39998,
+0,0,0,0,0,16082,40738,0,30023,27980,0,0,0,0,0,0,
+0,0,5872,45106,15185,46196,0,0,0,0,0,6210,0,0,0,0,
+0,0,778,5631,0,0,0,0,0,0,36144,0,0,0,21760,0,
+975,11807,37768,41111,44678,14807,44883,0,16219,0,0,0,0,18811,12086,34433,
+40300,43707,0,0,0,0,0,0,0,25266,44814,0,0,0,0,0,
+38730,0,0,0,0,4647,35689,0,43483,0,0,0,0,0,0,0,
+0,3697,18497,0,0,45699,0,24347,39817,33634,9369,47718,0,16290,0,0,
+14804,0,0,0,30782,0,0,0,0,0,0,0,0,0,0,0,
+0,0,23353,43711,20097,23971,0,22245,26789,0,0,0,0,18673,10820,0,
+43396,0,0,22897,31388,37058,48226,24969,0,0,0,0,0,0,16994,35679,
+36782,45350,0,7708,0,0,6435,21282,44661,0,0,0,0,0,0,0,
+0,45017,879,0,0,0,0,5141,1987,14372,32384,0,36834,0,0,0,
+0,0,0,0,47488,0,15977,0,0,30348,0,0,46405,16411,40044,0,
+0,0,0,0,0,0,22965,0,0,9565,0,0,0,0,0,0,
+0,3382,30400,0,10674,44543,0,0,22388,0,3551,29683,45086,23382,0,0,
+26957,0,32900,0,0,27717,31216,0,0,0,43175,0,20088,34056,0,0,
+0,0,17499,44422,0,0,13244,0,0,0,7269,19422,24433,0,0,0,
+5124,0,27071,0,0,4923,0,0,17775,0,0,28334,0,0,0,30357,
+0,0,0,0,0,25331,0,9664,0,0,33837,1615,0,0,18691,0,
+0,7784,0,609,0,0,0,43080,0,20710,0,0,0,0,15464,0,
+45107,0,0,39500,0,30474,9300,0,6298,0,0,0,0,0,34027,0,
+0,0,0,0,22556,0,0,18416,0,0,0,0,18008,415,14928,0,
+0,0,46271,21040,0,44623,0,0,20191,0,0,11128,0,16118,30351,31746,
+33745,0,0,0,0,36021,0,36623,4027,0,0,48704,0,0,0,0,
+0,0,0,23750,24414,42167,0,0,0,35226,0,1892,0,0,10958,12585,
+1074,0,0,0,0,0,0,17321,24668,0,28431,35645,39335,44086,0,0,
+0,0,0,0,0,0,15219,46359,0,0,12063,0,43736,0,0,0,
+0,0,0,0,0,0,22806,0,39294,1758,9694,20525,37312,40458,28818,7575,
+0,0,9994,0,0,0,0,2650,0,30093,1413,0,0,5565,21329,0,
+38764,0,0,0,0,0,0,0,35453,0,0,11165,20531,0,0,0,
+0,0,0,0,10929,28198,0,0,0,30017,0,33022,9269,0,0,22129,
+19008,0,0,20153,0,0,0,48632,0,0,0,0,0,0,0,0,
+0,18792,0,289,0,9701,19679,8287,16417,33266,0,0,0,21315,0,0,
+0,0,0,0,17556,22832,13747,17464,46694,0,0,0,26773,0,0,0,
+0,2695,0,0,0,0,3846,34408,42951,17238,0,0,47283,0,0,0,
+0,0,0,20811,25289,0,0,0,0,0,0,0,0,0,0,4252,
+0,10951,0,46606,0,0,0,0,0,42712,42798,6975,0,0,32487,0,
+0,0,0,0,0,5844,0,3708,0,0,0,16556,0,0,0,0,
+38217,0,0,0,0,0,0,11942,0,0,0,0,0,38551,15553,0,
+34172,31980,0,30557,17054,0,0,0,0,4174,45037,0,3884,38652,10768,0,
+31349,0,4319,0,16171,11530,25088,0,10979,0,31573,24860,0,0,32762,16465,
+0,13069,0,0,0,0,30086,0,4369,0,0,0,25714,0,0,0,
+0,0,0,0,0,5684,29682,0,0,0,33779,0,0,0,0,1059,
+0,0,27985,0,0,22231,0,0,0,0,0,0,0,0,0,0,
+0,21363,0,39819,12182,32184,0,0,0,0,0,36451,0,28186,0,0,
+0,5249,0,0,14337,16762,0,0,2458,2742,27422,0,1508,0,33890,40521,
+0,0,0,22884,19116,45964,0,0,0,0,37932,3247,0,0,0,0,
+0,0,0,8793,0,23075,0,0,0,0,5148,20831,22204,0,32492,0,
+18092,14736,13938,0,5264,25928,0,0,0,0,0,33620,0,0,7542,0,
+47423,0,0,0,2246,24590,0,43817,0,32924,0,8633,31647,0,0,38799,
+0,31835,35655,0,24832,45488,4752,0,0,18269,32142,0,22115,0,0,0,
+0,0,0,4360,0,0,0,0,0,36257,39681,0,0,0,0,0,
+38949,46326,0,0,43158,0,44076,0,0,0,386,8416,0,0,0,31031,
+0,16089,22969,0,12610,21080,42984,0,0,25423,15997,19501,0,0,8774,0,
+0,0,46420,0,0,10614,18018,46217,46309,0,0,0,0,0,45012,13054,
+0,0,0,44029,4061,0,0,0,9788,0,0,9417,0,0,0,0,
+0,0,0,0,12179,9125,4346,12199,26466,0,20161,25181,0,0,0,39085,
+0,0,0,0,10956,0,0,17634,36107,0,0,16547,16340,0,0,24362,
+0,0,38824,0,0,38699,0,0,0,0,0,20910,0,0,0,0,
+0,0,0,0,39625,0,0,42115,0,0,11324,0,44525,0,0,6717,
+20649,14616,27919,38231,45080,33244,0,0,0,0,0,47714,38331,0,0,0,
+0,0,16486,47199,0,0,10588,0,28344,0,0,0,0,28236,0,0,
+0,0,0,0,0,957,7880,21141,0,0,0,0,0,24780,0,0,
+25830,3829,0,0,0,0,0,0,0,39891,30985,26134,0,0,33375,0,
+1796,0,0,0,21425,22285,0,0,26838,0,47058,0,0,0,0,0,
+33862,0,0,0,0,0,24194,17594,30543,27317,0,0,0,0,0,46542,
+27509,0,10473,39165,0,0,0,36901,0,37001,0,9415,0,0,0,19491,
+40918,0,0,0,0,0,0,2151,40701,43431,0,0,0,0,24690,0,
+36029,43664,0,0,11640,27214,0,0,26285,32261,0,0,0,6478,38883,35534,
+40289,0,0,0,9603,0,0,0,0,0,27726,0,0,0,0,0,
+0,0,6039,7893,22311,0,0,0,0,36238,0,3166,0,0,25742,0,
+0,0,24521,1397,1983,1998,0,39080,0,0,0,0,32049,42535,3700,21815,
+35364,48804,5403,0,0,15305,0,0,39971,6131,30895,34369,46984,0,47486,0,
+0,9422,0,0,0,24904,48695,8161,0,0,0,0,22790,32987,40028,0,
+0,0,21264,0,21448,11840,0,0,4843,0,7551,0,42096,0,0,0,
+0,0,0,34811,3767,0,0,0,0,1142,36981,38161,1166,25870,39046,0,
+0,0,0,0,42213,0,41992,0,20741,0,0,8932,0,0,0,9281,
+25918,43069,0,0,0,0,0,0,26304,20946,0,0,0,29583,5833,34353,
+3961,8387,0,0,0,0,29439,36396,34138,21888,39254,0,0,48725,0,0,
+0,0,0,0,0,44658,37842,0,42618,0,0,0,0,0,0,0,
+0,0,0,0,0,2873,0,0,0,0,0,20071,0,0,0,19439,
+0,0,0,31666,32723,11960,37736,0,0,11291,17946,0,0,0,0,0,
+10649,0,0,0,0,0,0,0,0,21418,0,21082,42856,45242,0,0,
+2027,25957,30094,33276,12197,0,0,2154,42390,0,0,18284,42456,0,0,0,
+28598,0,0,0,0,0,8164,0,22925,34492,27431,37685,3225,40825,0,399,
+0,0,0,0,0,0,0,0,0,34426,35287,14858,0,0,0,0,
+0,0,0,0,8302,0,0,0,35015,0,0,0,0,0,0,0,
+20387,0,29404,0,0,0,0,0,1551,14801,0,0,0,0,0,0,
+0,0,0,40961,0,0,10451,0,0,0,0,16670,0,0,0,0,
+0,0,20936,0,10124,38577,0,0,18362,0,0,35684,0,4172,20696,0,
+31650,0,13871,0,0,0,32014,0,0,0,1702,42373,0,7577,27205,27507,
+0,0,0,15641,0,6143,0,31474,0,0,0,0,0,0,0,0,
+34259,38183,0,0,0,0,0,0,12272,0,0,0,0,0,31878,18204,
+0,0,0,40437,0,0,0,0,0,0,15841,5919,7506,15806,0,0,
+9113,0,0,20443,31208,0,0,36478,38868,0,0,0,12458,0,15865,33919,
+0,0,0,0,0,4685,0,0,0,0,0,40075,0,0,35256,0,
+0,0,0,0,45529,37186,0,41272,0,0,0,0,0,0,0,0,
+0,0,0,42531,0,0,0,0,7652,9525,30226,39211,40074,17736,19758,29961,
+39233,43836,44898,46410,37228,0,0,24478,0,0,0,0,0,27192,0,0,
+0,0,0,8482,11777,19800,13087,0,0,0,3432,30954,0,41482,8148,0,
+0,38477,0,41030,0,0,24761,0,0,0,0,0,24224,0,0,6203,
+13479,44488,0,0,38857,0,0,0,0,0,0,0,0,0,0,38228,
+0,0,0,45132,0,0,0,0,0,33427,12041,0,0,0,9153,0,
+11786,12356,0,34805,0,0,0,0,0,28880,46093,0,0,0,906,0,
+19542,0,0,0,7918,18432,35244,23493,0,36235,24982,22494,0,0,7164,13840,
+0,0,0,0,0,0,0,0,0,0,0,0,41770,45164,0,0,
+0,28648,9583,0,0,0,0,0,46105,0,38013,115,0,0,0,33879,
+45234,47074,8219,4250,31438,23575,45880,0,0,10236,7888,39325,10876,15369,40822,4481,
+20639,27760,0,0,2505,23346,30194,33438,0,3630,17332,0,0,0,34803,410,
+5317,46409,47403,0,0,0,6176,6198,32816,0,0,9105,0,0,4431,29141,
+0,42025,0,0,0,0,27037,22093,28206,0,37737,0,0,26703,35090,35696,
+23751,42899,0,0,0,48778,0,0,0,0,0,0,0,43421,0,0,
+31563,30743,0,0,0,0,0,0,0,33146,0,0,0,0,0,0,
+0,0,0,0,0,0,17751,0,0,0,0,0,0,0,3675,0,
+35367,37609,0,0,30673,39684,0,0,0,0,0,0,0,18726,0,6133,
+9667,20259,26922,0,0,0,48646,0,0,30662,31301,0,0,4132,8610,31302,
+45044,0,39420,40462,0,0,16058,13395,0,18202,0,0,0,0,9091,46190,
+0,1662,24156,43170,0,44774,0,0,36948,8424,34821,85,11592,0,15623,0,
+0,0,0,0,0,47659,0,40078,0,0,0,0,0,0,0,0,
+0,0,0,5871,0,0,0,0,0,22410,0,0,43058,0,2541,0,
+0,0,0,0,0,3635,0,0,40894,0,0,0,0,31617,8485,20185,
+0,0,17096,11208,0,0,0,0,7862,0,3960,0,0,2132,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,3968,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,41152,0,39552,
+25507,0,0,5074,47976,7372,42420,0,0,9467,372,20235,47013,0,0,0,
+0,40999,0,0,0,0,0,27277,0,16498,0,0,9446,0,0,27770,
+0,0,11142,0,0,2725,0,0,0,48449,0,13568,0,39053,39692,0,
+24571,0,0,0,48795,21001,43896,0,0,0,0,0,0,0,0,0,
+0,8813,0,0,0,12221,31370,29765,36794,0,0,0,0,0,0,0,
+0,0,28620,0,0,0,0,0,44576,0,0,0,44122,0,0,7495,
+45929,16586,0,0,5882,17609,0,0,0,0,0,0,0,8469,16935,0,
+0,29853,0,0,0,0,0,0,32024,0,0,0,0,5788,0,0,
+25115,0,0,0,0,45779,0,0,15114,0,0,0,0,0,46075,0,
+19467,991,26124,0,0,11635,19528,0,0,0,0,0,0,0,28610,0,
+8903,0,0,0,0,2915,0,0,13481,0,0,0,37423,0,31318,0,
+0,0,13084,40436,0,6023,0,0,0,0,0,0,0,48305,22250,0,
+0,0,46851,0,0,0,19707,46474,6546,26714,5218,47275,47346,0,19209,47494,
+31192,38580,32915,25761,35810,48223,0,0,0,0,18696,48565,0,0,0,35987,
+23561,44687,30962,0,0,0,0,0,0,0,3194,26110,0,33739,0,0,
+34466,0,30617,0,0,0,0,0,0,0,47861,0,0,0,41098,0,
+0,0,24025,0,27855,30220,0,8101,43043,0,47708,18145,0,3646,0,0,
+0,0,41553,6407,20394,0,0,0,0,0,0,0,0,2893,14455,24125,
+0,0,8427,0,0,42334,0,0,19267,28357,44217,0,0,0,0,0,
+0,43192,38181,0,0,0,0,3771,0,0,0,0,0,32367,25502,0,
+0,0,13684,38564,0,0,31183,0,0,0,543,34822,0,0,31858,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,12198,0,
+25754,39805,7637,29901,36221,0,0,5753,20228,34386,0,41097,0,0,0,0,
+36661,0,8582,0,27066,0,0,0,0,0,0,0,0,39147,0,0,
+0,0,41816,0,0,0,0,0,24472,0,0,0,19930,31978,30952,36212,
+2496,18482,27161,32287,42737,14463,0,34744,44811,0,10201,0,0,0,0,23616,
+0,27766,0,0,0,36751,24366,4371,28845,0,18672,39251,0,0,23760,45290,
+509,13709,29925,38431,47662,5490,0,0,44042,0,0,0,0,15457,0,0,
+42848,0,18917,0,0,29229,0,0,13281,0,0,45280,0,36802,25210,8583,
+13996,23040,35114,0,0,0,0,0,0,6884,26575,5743,0,31004,44566,0,
+0,0,0,14762,16044,22485,24978,27095,30399,14298,16090,39178,42051,38684,44204,0,
+0,11120,0,0,0,3843,13672,0,0,0,6835,0,0,0,0,6052,
+0,0,0,0,0,1937,0,0,0,9404,35857,0,36443,0,21089,0,
+0,0,0,2652,30466,22101,35548,0,0,0,0,0,0,0,46068,0,
+0,0,0,12594,0,0,0,11331,0,0,0,8150,25379,0,29455,0,
+0,37898,0,0,23090,0,0,0,1874,8145,8617,14551,0,9302,0,0,
+0,0,37833,0,0,0,0,0,0,0,0,21961,0,3544,0,0,
+0,0,0,0,0,0,42775,41176,28143,44255,0,4032,15416,20481,0,0,
+0,0,33690,0,39969,0,0,0,3294,48164,43816,0,31829,0,0,0,
+0,0,0,0,110,0,0,35571,0,0,0,0,37549,0,0,0,
+0,4975,39939,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,23825,14210,16619,0,0,0,0,8960,0,0,0,0,16623,739,
+0,0,0,0,46708,5998,35717,0,0,0,21893,17963,15508,34615,0,0,
+36742,0,0,0,0,0,0,0,0,0,0,0,40293,34030,37315,0,
+0,0,31984,34692,0,0,0,0,0,0,31739,26987,36596,27082,37407,0,
+39546,0,0,40725,0,0,0,27188,16526,0,2752,0,0,0,0,0,
+0,0,0,0,0,0,0,44801,0,26323,0,0,0,0,35666,11387,
+0,0,19448,16348,22625,0,0,0,0,0,0,0,0,13477,44249,0,
+0,15655,0,0,4636,0,17,0,0,0,0,34576,7248,8575,23841,41795,
+4538,42577,0,0,36372,21053,0,0,31246,0,3330,36894,0,0,0,0,
+0,0,0,25926,0,25932,0,19728,0,0,0,32997,0,15213,43111,0,
+0,9713,0,0,40470,0,0,0,0,1610,0,0,0,0,0,0,
+13161,7032,40823,0,0,0,0,0,0,0,0,0,35120,0,0,0,
+919,0,0,48312,0,0,0,0,0,28738,0,0,0,0,8208,14355,
+0,0,0,0,38494,25615,0,0,20241,0,0,0,0,35428,0,0,
+26559,5802,0,0,0,5583,0,0,0,0,0,0,0,0,0,3738,
+26992,0,26060,0,0,7016,0,0,0,0,0,19225,36756,0,0,35652,
+0,15710,0,0,39849,0,0,0,0,0,19036,0,0,0,0,0,
+3970,0,0,30582,5794,43386,18962,32584,0,0,25425,26085,0,16322,0,0,
+0,0,0,0,14740,0,0,0,0,22300,42997,24131,0,0,0,0,
+0,0,0,37232,38852,28929,45059,21788,30633,48504,0,0,0,0,31549,43526,
+0,42346,0,37940,10762,0,0,0,0,0,0,0,40134,0,0,0,
+0,0,0,0,37626,0,0,11989,45945,0,15527,0,0,14743,45177,0,
+0,40434,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,8239,0,0,1607,32181,5344,13390,0,0,4355,0,0,0,208,0,
+0,0,0,27234,47698,0,10839,0,0,24260,41139,0,12404,0,12472,21685,
+0,11194,12900,8557,10827,32245,43153,30395,0,20790,25688,0,39322,0,0,0,
+0,0,0,47500,0,0,0,0,19136,0,0,34359,0,43411,0,0,
+0,0,0,15760,0,0,0,0,0,0,0,0,0,1328,0,20347,
+0,3648,0,0,18890,0,0,0,0,0,0,0,0,0,40691,10127,
+13984,0,0,0,3361,41177,0,0,0,0,17225,0,0,0,5070,0,
+17023,28274,0,0,0,0,41118,20338,6506,0,43457,10514,37659,0,0,0,
+32424,11064,0,14507,46741,10299,48039,36937,13464,0,0,0,0,19220,0,0,
+34757,41948,46011,0,0,0,8383,0,0,0,0,0,0,0,5712,0,
+0,0,0,625,0,0,0,0,2472,33210,45848,0,21252,0,0,23980,
+27972,23167,44707,11766,0,0,0,0,0,0,0,0,7704,2747,0,21366,
+1417,46767,27539,0,0,0,0,11411,9271,0,0,0,23912,0,0,0,
+0,0,24657,28128,0,0,0,31108,0,0,0,0,0,41882,34033,340,
+0,45939,5669,21826,0,0,0,0,0,0,0,6320,22661,0,0,0,
+9722,18183,0,0,0,0,0,10889,18536,0,0,455,7360,0,2262,0,
+0,0,25815,0,0,0,0,29794,0,0,0,0,0,0,0,44124,
+39197,0,0,0,0,0,2396,0,13601,26791,0,0,0,0,0,0,
+0,31341,5125,0,0,0,30892,3359,36385,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,42285,0,0,0,0,
+0,33886,0,0,0,0,21507,28566,10589,0,0,0,37871,2602,41126,0,
+27295,7503,0,0,0,19875,20485,0,22590,0,0,0,0,0,0,0,
+41685,8892,28345,36363,0,0,19462,31590,0,29004,23746,34829,0,0,0,3252,
+12377,3491,632,7450,25066,5428,30494,34826,24923,48573,36745,19973,22512,27590,0,0,
+11946,0,0,0,4609,0,0,0,10664,0,0,0,0,0,25052,37545,
+0,0,0,0,0,12608,28891,0,43590,0,0,0,29606,9232,0,0,
+0,0,0,29884,44289,31912,0,28798,28804,39983,0,0,0,8496,25655,0,
+0,0,36603,38384,30625,0,0,0,0,15412,0,0,0,0,26100,0,
+104,1220,7036,24173,34342,0,8087,18236,45836,18133,0,0,26209,47295,0,0,
+0,0,0,0,0,0,0,18501,0,0,30899,0,0,0,0,0,
+0,0,0,20021,0,0,44401,0,0,0,0,0,9803,0,0,30868,
+0,0,0,36064,0,0,0,19193,0,0,0,31601,9631,0,0,5644,
+0,0,0,0,0,1062,2648,8513,36504,26891,47632,0,0,0,40231,3288,
+13310,17601,0,0,0,0,31818,0,0,0,0,0,0,0,45871,0,
+0,0,0,0,48815,0,3066,0,44584,0,0,42062,0,0,32873,15148,
+0,0,0,0,0,25063,0,0,0,0,38956,0,16098,0,0,0,
+0,0,0,0,24529,0,0,0,0,0,0,0,0,23799,44057,0,
+0,0,0,0,0,0,28561,5488,0,10149,24821,18307,0,0,23217,17661,
+0,0,37899,0,0,0,6025,44850,0,0,44220,47630,0,17559,26723,18718,
+43076,22608,47509,45052,0,4440,0,0,30222,0,11716,0,17593,48213,10606,10819,
+17082,28699,40155,14712,44068,285,0,0,36022,27647,0,0,0,0,0,5177,
+0,0,0,0,0,0,29512,0,10985,0,20321,25869,0,21548,0,0,
+29931,393,0,0,11821,0,0,20094,13618,26426,0,3654,11860,20824,30604,13097,
+36645,41859,0,22392,0,0,7919,0,44725,21189,0,0,0,0,0,0,
+20404,21708,26138,0,2555,21501,33719,36154,35599,0,0,0,0,0,47545,0,
+15257,0,0,0,0,35415,37580,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,48782,38641,0,0,47149,47315,1461,
+15715,15878,42361,0,0,43552,0,41021,4400,0,0,0,0,0,0,38707,
+8291,0,0,0,0,0,16713,8920,0,0,0,0,0,16025,0,0,
+6075,0,0,0,0,19906,3640,15280,0,4301,2008,10474,36245,0,27756,44984,
+0,0,0,31701,39511,17549,0,0,33309,39390,931,0,0,0,0,16731,
+17343,24948,21782,36172,45439,0,0,4866,0,0,0,0,0,0,0,0,
+0,0,0,18097,45458,0,0,0,0,0,0,0,0,0,1026,0,
+0,0,0,176,40741,21429,43108,0,22013,47853,19404,44766,0,0,0,33743,
+0,44159,0,0,0,31152,1138,0,0,0,0,0,30166,45545,5319,0,
+29289,13127,10538,4224,11258,39842,0,0,30478,0,0,0,0,0,0,25772,
+0,22487,0,26819,0,19659,29105,21342,0,0,41989,0,0,28436,0,0,
+0,0,0,0,0,0,0,35308,11323,1733,35201,15541,0,0,0,29640,
+0,31419,5909,0,0,0,0,0,44241,35397,0,16885,18573,28093,47558,45533,
+0,0,22483,0,0,15778,0,0,0,29409,0,2881,0,31537,0,0,
+0,0,0,27751,0,0,8345,0,0,0,0,0,0,0,2447,27773,
+0,8088,0,0,0,42103,0,0,31736,25976,0,31965,44193,28765,0,8604,
+0,0,0,3834,0,42749,0,0,26759,0,0,18465,0,0,0,22256,
+9588,34929,48136,0,0,0,0,0,5093,20092,46142,35564,42120,0,0,38238,
+0,0,41662,22938,0,0,6193,16027,7174,0,0,0,12813,26241,0,0,
+5550,29370,30303,47552,0,0,0,22138,17041,0,0,0,0,0,0,0,
+0,0,2993,28086,0,0,14760,0,2379,0,0,17396,6116,21522,38733,43950,
+0,0,0,26350,0,0,0,0,0,9697,0,1395,0,0,46485,0,
+0,0,0,16525,0,0,33929,0,436,25009,0,0,0,0,9433,7645,
+0,36660,32113,0,0,0,0,0,0,0,0,0,0,0,0,9311,
+18113,0,0,15216,0,22736,0,0,34345,44141,0,0,18773,47075,33205,0,
+0,0,0,0,0,22337,0,0,0,0,0,0,11803,0,0,26708,
+37432,0,0,0,0,19960,0,0,0,0,0,0,0,0,0,45617,
+17857,0,0,0,0,0,0,0,2517,0,0,42871,26920,28731,44728,26461,
+35149,42185,25920,13193,0,0,0,34524,9951,0,0,0,0,0,0,0,
+25126,0,0,0,1435,9805,20238,4551,16523,0,0,7972,0,28359,0,27032,
+0,0,0,0,36417,0,0,0,0,0,27105,0,0,0,42705,0,
+31609,11301,18565,0,0,0,23472,30317,0,0,0,0,0,37049,0,0,
+0,0,9502,46730,0,0,0,5835,0,0,0,0,0,0,21248,0,
+0,13251,30369,0,0,0,20870,0,0,2524,0,0,0,28645,0,0,
+0,0,0,11444,36311,0,18700,0,0,24993,0,0,0,0,0,0,
+0,0,43675,0,0,28633,0,10488,0,23506,46166,0,0,11993,0,2783,
+5487,0,33894,0,0,31744,0,0,0,0,0,0,0,0,0,0,
+25243,0,0,0,0,0,0,19751,0,0,0,18118,0,6687,0,0,
+0,0,0,21679,0,24069,0,0,28389,255,0,19785,34332,0,40942,0,
+0,0,0,0,14302,28278,0,20931,0,43643,44509,0,636,0,0,0,
+0,0,0,26473,35261,0,0,0,2085,28212,40083,0,0,36917,37446,0,
+0,0,0,0,0,20586,0,0,0,0,0,18679,39538,0,0,40041,
+0,0,33941,0,0,36712,0,0,0,0,0,0,0,0,0,41871,
+0,0,0,0,0,0,0,0,30784,0,0,0,0,0,37983,13043,
+0,42080,0,0,0,0,0,0,0,0,0,0,0,21947,30709,0,
+0,0,1901,47291,32331,0,0,44945,0,36911,0,0,0,13861,4982,17839,
+47882,10104,0,7839,3526,997,17936,0,14956,0,11237,10952,0,13930,40204,0,
+8300,0,0,2430,29125,6212,0,18321,0,27658,43647,0,0,17969,0,0,
+0,0,0,44411,0,36972,0,4674,0,30530,0,8139,1008,42543,11001,34106,
+20514,48252,0,0,0,17539,0,0,0,0,45683,0,0,22095,0,0,
+0,14500,0,23967,0,0,0,0,0,0,0,9325,0,47876,0,0,
+0,0,0,18756,23133,0,0,14725,22022,0,0,32192,0,16667,0,46322,
+0,45566,0,0,46462,0,45195,17133,0,27552,0,0,0,0,0,0,
+43880,0,0,0,18638,8674,19669,0,0,0,0,25370,0,32209,0,431,
+0,0,19194,0,18846,0,0,0,0,158,0,0,0,0,9906,45160,
+0,39527,7218,38565,0,0,0,0,0,0,0,33491,0,0,0,0,
+0,45008,0,36889,1021,46210,3061,0,0,33978,47832,0,0,22267,0,47456,
+0,0,0,31230,0,0,0,42016,0,0,0,35871,0,0,0,0,
+0,0,0,0,0,26755,0,0,24123,29946,30157,0,0,0,0,32427,
+0,0,0,0,0,0,9049,41389,0,0,30616,5138,0,0,3764,0,
+118,30791,41005,0,0,0,0,0,0,5810,0,0,0,0,0,23966,
+0,0,0,0,0,44753,0,42205,0,0,0,0,0,0,38543,0,
+27476,0,17693,0,17581,0,32590,42421,47331,0,0,0,0,16983,44721,0,
+41756,46711,0,0,0,0,0,0,42797,32236,0,0,0,0,0,0,
+0,0,0,13524,0,0,0,0,0,0,0,0,30829,0,30925,0,
+12359,0,0,0,24369,0,25457,13939,0,0,0,0,0,36346,0,17154,
+0,0,1565,13534,0,0,0,15105,7657,1383,0,16065,18130,0,0,7553,
+8023,0,0,31040,0,0,0,27145,0,0,0,0,0,32570,12992,0,
+0,48365,0,0,34192,0,0,21369,29006,36670,10899,47595,0,34758,31431,0,
+0,13989,0,0,0,0,7378,3744,28285,0,29156,0,0,0,18131,0,
+7037,435,8227,0,0,0,0,0,0,0,20830,22206,0,0,0,0,
+0,0,0,1362,27114,34082,0,0,0,12940,3200,0,0,0,0,0,
+0,0,40834,25868,47548,42401,0,40793,16001,0,33880,30013,0,14040,35138,7398,
+48596,0,9216,0,0,0,0,34589,0,41908,0,0,15759,726,29633,0,
+0,0,0,0,0,44172,27869,35766,46925,0,0,0,0,0,0,0,
+0,14351,0,0,0,16487,0,0,0,0,14183,0,6885,0,0,0,
+0,0,0,0,0,45898,0,0,0,39024,37548,0,22184,0,0,45240,
+0,0,0,37164,43794,0,0,0,0,0,45971,27991,0,0,0,0,
+23571,0,0,0,0,46805,29423,44640,0,0,0,0,0,0,0,6360,
+0,0,9149,0,0,0,38678,0,0,0,1235,0,0,0,0,0,
+0,0,0,0,15823,48229,11248,31768,0,0,0,0,0,0,0,0,
+0,0,0,0,25871,38845,0,21055,0,0,0,36950,0,11646,0,34350,
+0,0,0,12686,0,0,0,0,0,0,0,0,0,9233,13238,23436,
+0,11963,0,0,0,41777,16036,0,33579,0,0,0,0,0,0,39550,
+24735,0,0,11102,4000,19886,35606,0,0,0,0,8174,33008,8232,37910,10790,
+40865,41352,0,0,0,27649,34930,36865,0,0,0,0,0,0,0,31665,
+2823,44406,0,0,0,0,629,12959,0,0,0,0,28210,0,0,0,
+0,16073,17697,13302,19254,0,21772,0,0,0,0,4072,15691,31398,31769,42295,
+48174,0,0,36933,0,0,0,0,0,25717,0,7713,0,0,0,0,
+0,0,0,0,0,0,16240,4104,0,0,0,0,0,0,2434,0,
+21777,21395,23724,0,0,0,0,43958,4775,16126,24330,30593,0,0,0,0,
+0,0,0,0,0,25505,0,0,0,27632,32670,0,0,32439,0,0,
+12659,17907,0,0,18970,0,0,0,0,19833,27624,0,0,0,0,0,
+9098,48580,0,0,25343,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,16789,0,0,0,0,0,12654,35265,
+0,0,36960,0,0,0,20111,0,0,0,30798,0,27232,0,0,0,
+769,36208,0,0,0,0,0,0,36669,0,0,0,0,28759,0,5297,
+658,0,0,0,0,0,15245,0,40772,0,15314,0,0,0,0,0,
+0,33451,0,8471,0,0,0,0,0,574,10095,0,0,0,0,0,
+0,22596,0,0,0,0,44019,0,1294,0,39229,43518,18065,0,6260,44169,
+47448,41308,0,0,0,0,35492,29437,11094,19943,0,0,20699,11818,3988,40548,
+0,0,0,0,0,0,0,40562,0,0,0,0,15400,28372,0,0,
+42407,692,1099,27453,0,20079,0,0,0,0,0,0,0,0,0,0,
+4523,0,0,0,0,1802,11372,23824,46844,0,0,0,0,0,0,17633,
+40480,0,47532,0,10013,14498,0,12266,0,0,0,0,0,0,16517,40930,
+0,45336,2104,18578,1306,0,0,0,34704,44851,46089,0,47184,25444,0,0,
+7205,11183,0,3013,0,4637,34963,0,30659,0,0,24846,0,23596,0,0,
+0,0,0,33751,0,0,6470,0,20754,23285,26056,29136,0,0,0,21671,
+41915,0,0,0,0,0,0,0,0,4330,0,0,0,23206,0,0,
+0,0,9453,26678,0,0,1972,45032,27211,17678,23371,0,0,0,0,9851,
+35331,36763,0,0,16467,30007,0,0,16193,21993,0,0,0,11673,0,0,
+23520,0,33208,0,0,0,0,0,0,0,45225,45865,47015,0,31615,34083,
+0,0,0,0,0,0,21951,21182,15510,21670,46459,44705,0,32183,0,0,
+25949,0,45030,0,0,0,0,0,0,0,15182,37129,0,0,17985,12922,
+0,0,37253,38266,0,22020,0,0,0,0,3416,41094,38704,16904,0,0,
+7925,26673,26923,33194,47879,48758,0,0,43594,31307,0,0,0,0,0,26808,
+0,0,19913,0,10845,0,0,0,0,0,0,0,0,0,20273,0,
+0,0,0,0,0,0,0,8237,30727,0,24120,3924,40922,18315,39597,0,
+17386,0,0,0,0,0,0,14301,6295,19842,22345,42932,0,0,0,0,
+13085,0,0,0,23091,0,6645,0,0,8217,0,0,0,0,0,0,
+36160,24908,3811,32373,43290,31974,0,0,44303,38004,0,0,0,6373,47701,0,
+0,0,0,36056,40169,0,0,39310,3920,0,29210,0,0,0,33996,0,
+0,0,6207,0,6330,26188,0,48534,17902,0,0,27997,0,0,0,0,
+4789,47609,0,0,0,33932,47594,27547,0,0,0,0,0,37169,0,12307,
+0,0,0,0,15919,0,33061,0,0,7734,34158,0,0,0,0,1095,
+0,0,26335,0,0,0,40919,0,41162,8187,0,0,0,0,0,15708,
+22198,0,0,0,0,0,0,37600,0,5536,17073,0,0,19713,0,41832,
+0,44097,15554,46353,0,0,11519,27457,0,0,18515,0,0,0,33489,0,
+44279,47103,0,0,27218,35154,0,0,0,9517,0,0,0,30572,0,0,
+0,0,0,0,0,0,15485,22106,0,38557,0,0,0,13425,39653,0,
+32953,0,0,0,0,0,25592,30502,0,14234,8609,8452,0,1009,14197,22422,
+35489,0,19818,0,0,0,0,33058,0,38111,42116,16400,0,0,10263,0,
+0,0,38158,1584,0,0,24127,23754,12159,47886,0,0,47132,6376,0,44547,
+0,46667,0,0,0,33524,0,0,0,0,7923,0,203,33918,0,0,
+37201,44242,0,0,0,0,0,0,0,0,0,29083,0,0,0,0,
+0,44976,0,46482,46421,0,0,0,0,13716,0,0,204,0,12716,0,
+0,28165,0,19790,38833,0,23694,27526,41824,41135,0,0,0,0,16266,7860,
+33538,34300,44313,34991,37573,0,0,11333,0,0,46618,0,4239,0,0,28825,
+0,0,0,0,4619,0,0,0,0,41039,0,38071,0,0,34136,0,
+0,0,37901,45113,0,0,32725,27927,0,21887,3164,24012,45402,42187,48314,0,
+0,5695,11750,19892,33643,40148,24084,0,0,0,0,9641,17026,46692,0,0,
+0,0,10115,35070,0,22532,3655,23390,39518,0,0,37916,0,0,18461,46293,
+21689,35748,0,0,46070,18855,18034,1406,0,30284,0,42702,0,0,35132,36846,
+0,7826,0,0,43683,0,10550,0,12413,0,0,48064,0,15003,44179,48590,
+0,1479,0,0,6061,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,31951,0,0,26544,0,0,16588,
+0,0,0,0,0,0,42829,29862,12136,0,0,15501,39623,43104,0,38042,
+0,0,0,31825,0,24185,0,10228,0,0,0,0,0,0,6930,522,
+0,42399,43208,0,0,0,0,0,0,0,0,0,0,0,3838,12133,
+0,0,7767,0,0,0,0,0,0,35783,47417,0,0,1338,17575,0,
+0,0,0,7667,18258,27578,1259,31611,35477,42906,0,0,0,0,27734,0,
+0,32405,36614,41833,0,0,0,0,40395,24000,1286,0,0,0,0,0,
+0,8318,48296,9131,0,2909,25327,0,0,0,0,0,0,0,0,0,
+30869,0,0,13108,0,0,38777,0,0,0,0,7864,0,0,0,0,
+0,0,0,0,8386,42935,0,0,0,0,0,10865,31833,33625,0,0,
+0,0,0,0,0,25435,38466,0,0,0,0,0,0,0,22793,45265,
+0,16916,23277,0,0,0,47626,16514,46530,3267,0,0,0,0,0,0,
+0,4553,40587,0,0,0,0,0,24955,0,0,0,47083,0,0,19078,
+20938,0,0,0,0,0,36095,9342,37499,0,4873,40291,30481,0,0,0,
+0,0,0,0,46664,0,30482,3205,0,0,0,0,0,0,0,0,
+0,0,46,26924,0,0,0,0,0,40976,0,2698,21766,32552,0,0,
+0,0,0,0,0,0,47048,0,0,0,0,10477,25282,10280,47111,0,
+0,0,4204,0,0,0,0,0,31781,0,0,0,0,0,0,21236,
+0,0,0,0,0,19922,27499,45523,0,0,15070,0,0,0,0,35158,
+0,47502,0,0,0,0,39853,0,39220,13629,0,0,0,0,0,0,
+0,21694,0,1666,45563,0,0,0,0,0,0,0,39733,42119,6802,0,
+0,37619,0,42623,0,18374,27312,28761,0,0,0,0,0,0,0,0,
+9763,24189,35734,14145,39669,12424,40482,21085,30886,0,0,0,0,0,45148,0,
+4388,0,15638,0,0,0,30907,8070,45567,3374,0,0,0,31581,33425,0,
+29575,0,0,0,0,0,0,0,0,0,0,47772,0,10223,0,0,
+0,0,0,0,0,32239,0,0,41205,3668,0,0,0,47614,0,0,
+0,0,0,0,7793,0,0,0,0,38946,0,42987,0,16321,11512,0,
+0,0,0,32640,0,0,14232,0,0,37155,0,27780,592,3933,9585,11722,
+27984,31429,31707,42410,2315,36142,0,32501,32565,0,0,0,0,0,0,0,
+48311,26837,0,25214,11300,14115,0,5837,10442,0,0,39881,0,0,38075,18728,
+29417,0,0,22929,40830,47777,44554,45467,7594,32318,23898,31725,0,0,0,22674,
+22368,36473,0,2769,43994,0,0,27829,0,48346,44010,0,0,4406,0,0,
+0,0,0,9239,0,0,433,10304,6437,17658,29534,40885,7669,8202,5461,23170,
+0,0,0,0,0,0,0,0,0,0,0,0,0,5260,37468,0,
+0,0,40021,0,0,31889,31091,0,0,41547,28072,0,0,0,0,0,
+0,12113,42834,0,0,0,0,0,0,0,0,1772,0,0,10779,12260,
+32730,0,0,0,29316,48650,0,0,0,0,14906,13308,46130,0,0,0,
+30458,0,0,29541,0,0,0,0,0,0,0,0,5952,0,29311,16783,
+0,0,21925,41052,0,0,8084,10723,21272,29948,0,0,0,0,0,0,
+0,36070,36811,13776,46212,39358,0,0,0,0,25646,0,1797,13918,14845,0,
+0,4853,29553,0,45049,0,35121,38671,0,0,0,0,0,0,0,0,
+32425,0,0,25223,41408,0,24325,0,0,14973,0,8344,35614,0,34670,0,
+0,0,0,19867,0,20631,39710,0,10835,30261,17486,0,0,0,0,37285,
+46748,1356,0,0,0,0,0,0,30950,0,0,12832,0,1007,0,0,
+0,0,0,0,0,0,0,0,0,0,7738,4503,24823,36074,0,18837,
+32399,21844,44240,0,0,45412,4894,13933,21847,0,29701,0,0,0,42839,17645,
+30821,0,0,0,0,0,0,0,0,0,0,5771,0,0,0,0,
+9096,0,0,0,14588,22639,20172,33156,0,0,0,48445,13004,14390,0,0,
+0,0,0,0,0,0,33934,0,40635,29568,0,0,0,0,0,0,
+0,0,0,32962,43973,17720,31755,22972,44835,0,0,0,13364,0,0,0,
+0,18196,27692,0,0,0,36882,35574,42988,0,31517,8158,12193,27724,10897,0,
+0,0,0,0,0,0,0,0,41166,0,0,0,26250,0,14711,0,
+0,0,0,0,32170,41022,29138,24612,0,0,46677,0,0,0,0,48236,
+0,0,0,7995,10764,46947,0,0,0,0,40640,13978,25765,0,38093,13714,
+37780,0,23105,3718,33686,35107,0,0,0,0,35816,16247,23879,25660,0,0,
+0,7370,10320,0,0,21457,0,0,0,40444,41512,0,16974,33961,0,0,
+0,0,18522,0,0,24639,15000,0,0,0,0,0,30362,13630,0,0,
+0,0,0,0,0,0,0,0,25325,1057,0,0,0,48517,0,0,
+0,0,0,42019,3712,0,0,0,0,0,0,0,0,0,4939,34706,
+48173,0,0,0,0,20320,30341,45394,0,0,28397,0,0,0,6239,0,
+21153,27838,0,8116,0,8366,29957,35221,0,0,0,31527,14531,0,38462,13733,
+0,0,0,0,0,0,0,0,0,29793,0,0,40723,0,0,0,
+0,0,0,28016,35353,0,0,0,0,0,1952,0,0,26818,0,0,
+0,0,20827,0,0,6725,47290,0,0,11727,0,0,36681,41356,0,41293,
+0,0,20252,0,0,0,0,0,349,16601,0,0,18951,0,9429,32799,
+0,0,24496,0,0,4832,0,0,0,0,16866,30048,42547,0,0,0,
+48859,0,0,0,0,0,0,0,0,0,0,48578,0,0,0,0,
+0,0,9889,45245,1374,0,0,0,0,0,8204,0,0,28187,0,37731,
+7270,0,0,0,0,9960,24714,46466,0,25930,0,0,0,0,47735,26711,
+14094,46341,0,20122,21386,7364,40931,32946,35531,1064,31688,0,0,13224,0,0,
+0,45536,0,0,45709,44394,0,0,0,0,0,7740,22610,37351,46354,0,
+6838,30080,5915,0,0,15799,4614,33170,47482,42102,0,21789,15884,23060,0,25416,
+0,0,9515,17930,0,0,0,0,0,13399,33514,0,0,0,0,0,
+0,0,33359,6129,28181,40483,0,38974,0,0,26607,0,0,0,44787,0,
+486,0,0,29134,33517,18353,0,0,0,0,0,0,0,0,0,7285,
+27729,0,0,12454,3836,12283,23077,0,0,0,0,26717,0,0,0,0,
+2793,0,0,0,0,7413,0,0,0,0,18123,0,12601,0,34525,0,
+0,0,7950,0,0,0,0,0,0,0,20462,1881,0,0,28747,13107,
+0,0,0,0,0,0,0,0,6089,25012,1602,48602,0,0,32152,24266,
+17624,45268,0,0,10025,0,0,0,0,0,19655,0,0,0,0,24218,
+0,0,3589,23302,2894,37039,0,0,13147,0,0,0,0,32312,41568,0,
+0,0,36812,0,0,0,13564,15144,46015,0,25412,0,0,0,0,0,
+0,0,0,0,0,0,0,46663,0,0,0,0,0,0,0,12352,
+0,0,0,0,38152,7827,16907,31273,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,44445,5017,0,21216,7448,0,2919,9595,
+42688,0,0,0,0,0,0,0,6169,22396,2028,27579,0,0,30278,0,
+0,0,42468,0,0,0,0,0,0,0,11297,0,31250,0,0,0,
+26165,18154,12535,40519,0,0,0,0,6300,19281,24002,37397,40414,22989,13014,42750,
+0,0,0,0,0,0,0,6651,0,0,0,0,5735,0,0,0,
+0,0,0,0,42255,47021,0,29892,0,11819,0,45221,0,19694,0,14678,
+30355,34754,0,0,0,0,0,0,0,18798,47474,0,0,0,0,15625,
+0,39207,0,0,0,0,0,14714,0,0,0,0,0,0,0,0,
+44592,0,16048,34612,34867,38725,42381,48204,0,5691,10168,23033,15664,1822,44180,0,
+0,0,32876,0,0,38260,11155,33647,0,26932,0,0,0,0,44738,0,
+21450,0,15882,4473,0,0,46146,0,35141,0,0,0,0,0,0,0,
+0,30140,0,12520,0,0,5779,0,0,0,0,0,0,0,12907,845,
+6342,23759,39242,11079,19702,6821,0,0,0,0,12379,43916,0,0,10182,0,
+0,3328,0,0,0,0,0,0,42612,0,17914,0,0,15319,0,0,
+0,0,0,0,0,0,44697,0,0,29547,0,0,0,11370,0,0,
+0,0,0,0,0,0,1339,0,0,0,0,0,38026,28366,6268,41803,
+4563,22573,20863,33937,41888,0,0,0,0,6208,0,0,0,0,0,34544,
+35089,0,0,0,0,24484,0,0,0,0,0,2563,28727,0,0,20452,
+0,1918,32580,40040,12783,27233,0,13905,0,0,0,0,32140,16630,40309,0,
+0,0,23460,45678,0,29258,0,0,4496,0,0,0,25143,0,16739,2230,
+23508,8745,26590,28387,0,0,0,43805,0,0,48412,0,23149,0,21405,0,
+35171,1857,0,0,12148,27149,47165,0,43691,0,31186,0,0,0,0,0,
+0,0,0,48484,0,0,0,12100,0,0,0,0,0,0,3357,31987,
+0,28429,35517,0,0,0,0,0,0,0,0,0,532,0,37314,0,
+0,0,0,0,0,11986,12514,0,6359,23324,0,0,0,0,0,0,
+0,38918,44913,0,21490,0,0,0,0,0,14891,829,17714,37563,0,0,
+42542,29030,29352,30785,35471,23304,36116,1473,22317,7349,28999,0,44360,7856,27920,39807,
+29983,4120,22926,0,0,0,0,0,0,44677,0,45899,0,0,457,48362,
+0,6244,0,0,2773,0,30337,0,0,0,0,0,0,0,0,0,
+0,25598,0,30647,0,25268,0,0,25821,14321,25043,0,22203,17824,0,0,
+0,0,0,0,0,0,0,0,0,0,0,21542,26736,28652,0,24697,
+0,21972,26534,0,0,0,3873,11436,45986,0,40611,34663,0,32702,46640,0,
+0,0,0,36659,48553,0,0,31056,2424,0,45693,26334,0,0,0,0,
+0,41224,19729,20852,46556,0,0,38681,0,0,44453,0,0,0,18680,0,
+0,0,0,0,0,0,42896,11214,0,27672,0,0,0,0,0,42351,
+43189,0,0,10375,12399,0,0,39162,0,0,0,0,0,35999,40241,0,
+0,0,34291,0,25244,45771,43028,0,0,0,3155,6014,0,0,0,0,
+0,0,0,32185,32700,0,0,0,0,19912,0,0,0,0,11979,10083,
+0,39349,0,0,25428,0,4098,17480,0,7278,0,0,0,0,0,39261,
+0,0,0,0,0,0,0,0,0,0,0,0,476,32400,0,21974,
+43200,0,0,0,33316,2393,0,1583,9578,11567,12043,4597,12707,18529,15973,29955,
+33520,34455,0,0,48158,0,19576,0,0,0,0,21600,5225,33832,0,0,
+0,0,0,0,33951,0,0,0,42663,0,28809,0,0,0,33112,21935,
+0,37615,0,24076,36394,0,0,13144,0,0,1477,34760,8320,0,0,41212,
+0,523,30047,37636,0,15206,30425,0,15446,40626,20794,0,4309,30939,30882,36181,
+25362,0,0,10676,45100,0,0,0,2412,0,11503,0,11670,0,16672,0,
+0,0,0,0,0,0,0,46891,0,0,0,0,0,41611,0,0,
+0,0,0,0,0,35320,0,983,15275,16952,0,35307,37574,8098,0,12596,
+0,13219,30624,45169,0,0,0,0,45570,0,0,24055,47354,0,0,22735,
+0,9659,0,0,0,5755,0,0,0,0,46157,0,0,19609,34245,45423,
+0,0,3139,0,0,30456,26172,17022,33609,0,0,8787,28842,0,32422,44153,
+45292,0,0,0,41798,0,0,0,0,0,26291,0,0,0,0,0,
+15067,0,0,20598,0,0,0,22131,0,0,0,0,0,0,23117,12941,
+36757,0,28039,0,15540,16481,17224,0,0,0,0,0,0,0,7901,41114,
+10446,0,0,35889,24564,474,4480,20519,32450,0,5803,10043,15016,36430,28393,21433,
+14883,14015,37539,45330,0,0,0,41178,7124,33420,14380,20442,37041,44971,27503,33709,
+46913,0,0,0,17152,0,0,37502,48347,0,46251,0,44177,7781,0,0,
+0,22737,31923,44025,0,0,6191,0,2071,45436,0,0,25782,29008,0,44974,
+0,5804,24927,0,33539,0,5240,15243,0,15742,27519,0,0,35827,0,33991,
+38896,42772,0,0,0,42511,11099,0,0,0,0,0,0,30862,38737,0,
+0,0,27263,0,24211,4957,0,0,0,41259,0,0,16512,0,0,0,
+0,25156,28899,0,0,8756,17568,48557,0,10637,23784,0,40158,0,26598,0,
+43186,28650,0,7554,1104,0,0,0,0,0,0,0,23981,0,21898,0,
+0,0,0,0,0,0,0,0,0,0,0,21359,0,0,0,0,
+0,0,0,0,35133,42584,0,0,27879,0,0,22548,10328,20133,26969,10947,
+0,0,0,0,0,14600,142,0,23228,0,0,0,0,0,13268,0,
+0,47266,3943,27348,20565,12323,48835,0,27740,0,4153,15007,47757,7436,0,0,
+0,0,0,0,0,605,7507,0,0,0,0,0,0,0,0,0,
+8622,0,12447,16958,30837,0,0,0,0,0,0,0,0,0,4115,0,
+23914,2536,0,0,0,0,1710,15234,6180,44037,0,0,40504,0,0,0,
+0,0,0,0,11428,4333,0,257,6482,12503,15097,1955,42885,0,0,0,
+29015,0,2740,14836,22930,45455,0,0,0,26149,41280,0,32954,0,1648,0,
+0,0,0,0,15075,35937,0,0,0,0,0,0,36200,0,0,22991,
+23119,3606,0,0,0,0,38789,4063,0,0,0,0,0,31335,0,0,
+0,0,0,0,0,0,0,26827,46390,5762,0,28343,34507,0,0,0,
+0,33140,0,35624,0,0,0,0,0,0,45298,43205,14894,9154,10213,17659,
+27462,0,0,19014,27581,45082,48096,0,0,0,34114,25080,0,11609,0,0,
+0,2414,0,0,0,34491,32446,0,0,0,119,3119,7915,9577,0,0,
+0,0,32126,0,0,0,0,0,0,0,16554,0,0,582,0,0,
+13829,0,0,0,26482,17072,0,0,0,0,0,42714,0,2297,16690,0,
+0,0,48624,38393,0,0,31342,0,0,0,0,36505,21707,0,0,0,
+2474,23668,45121,0,0,0,19531,0,0,23392,29066,0,6352,0,10680,38176,
+48438,0,0,0,3901,31376,0,3079,0,0,5312,35854,0,31741,0,37724,
+33519,0,6325,0,0,0,0,0,0,40147,0,0,0,27324,0,0,
+0,0,0,724,0,16784,0,0,0,0,37654,0,0,0,0,29424,
+0,0,18003,0,0,0,0,35756,0,0,37104,24463,0,0,0,0,
+0,17020,38360,48858,0,0,39589,40524,0,0,0,6182,35350,0,26422,47819,
+0,38031,0,14872,26377,0,0,0,0,0,31257,4905,10062,0,0,0,
+6334,10044,47896,0,0,13662,0,0,0,33038,747,25031,0,0,0,0,
+0,0,1847,3201,0,0,2693,0,47089,5066,0,0,0,0,0,47663,
+0,0,0,0,38887,41687,0,0,20773,0,0,0,0,0,0,0,
+46168,0,3173,0,0,0,52,17817,48773,0,0,7353,14272,15270,0,0,
+0,0,0,0,0,0,45508,0,0,29217,0,0,13396,0,22850,0,
+19051,46597,0,38691,0,0,0,0,0,0,0,4963,41760,35411,0,0,
+0,0,0,0,0,0,0,0,978,0,0,0,0,14038,21981,39831,
+0,11854,20571,0,0,0,0,0,0,0,25793,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,21409,0,0,24736,19088,0,0,
+0,3241,0,38280,47721,31048,0,0,0,36055,0,28635,32847,43883,11144,30989,
+48812,36175,27689,0,0,0,0,0,0,0,45500,0,0,0,0,30781,
+0,0,0,0,0,0,18453,6371,0,13211,0,0,0,0,0,19474,
+22749,29361,44094,15426,4998,24683,8780,32061,4088,6887,27287,34127,43062,0,0,0,
+0,37956,46448,5441,0,32699,38324,0,22243,34924,0,15374,0,25469,0,0,
+17681,0,43112,4177,4549,28772,41982,313,0,803,5328,12036,14522,37682,43605,0,
+8580,23601,0,9280,31706,0,0,22318,0,0,0,0,0,0,0,0,
+0,0,33900,0,9650,14938,42499,47749,0,0,0,0,0,4126,29465,0,
+0,0,0,28713,41257,0,18844,0,0,33362,43730,41472,0,0,25768,12441,
+837,26849,0,0,0,0,0,20515,42131,0,0,0,0,35830,41465,0,
+0,0,0,0,0,0,1531,23816,35869,28280,0,0,0,28724,3734,23092,
+30503,0,0,0,0,0,0,0,0,0,42087,0,17893,0,0,29865,
+0,25292,0,33410,0,0,0,0,20726,0,0,46253,19122,19671,0,20834,
+0,0,0,0,0,46458,0,0,7668,805,4919,0,0,41613,0,1762,
+12033,42972,44712,0,0,0,0,18339,32073,0,0,0,11320,0,0,22070,
+19873,37142,20997,35559,17137,0,0,0,0,0,0,47300,0,7158,43976,3525,
+20348,38490,2972,0,0,0,38257,0,0,0,3110,0,0,0,0,0,
+24067,25135,29950,37492,42593,0,6560,14573,25679,0,0,0,0,0,0,0,
+3227,47706,14548,22533,0,0,0,0,0,0,0,0,0,0,43391,0,
+0,41252,43014,0,0,32559,0,0,0,0,22284,0,0,0,0,0,
+0,0,0,0,10892,26516,42860,0,0,23542,35205,44311,2152,0,0,0,
+18853,0,0,0,0,10912,0,0,34936,29741,7391,11366,0,0,47246,0,
+0,41262,27372,0,0,0,0,0,0,0,0,32494,21775,10091,0,27366,
+0,12909,27391,0,0,23205,0,0,0,48823,0,23112,16536,46345,0,10423,
+0,0,0,12189,0,0,31933,0,0,0,0,0,0,38414,0,31105,
+0,0,21191,0,0,0,16034,31046,0,0,0,0,38288,0,0,11990,
+27836,0,3932,1590,2734,33192,27061,9191,19206,0,0,45418,0,0,0,0,
+0,33335,24562,7686,41179,23656,0,0,0,0,0,4090,32285,0,0,0,
+0,0,0,0,0,0,0,48114,42575,8725,8865,0,0,0,18874,32850,
+44199,45150,0,0,0,0,27600,0,22785,28803,10009,0,0,0,0,0,
+19332,0,0,45038,0,0,0,0,32849,2171,0,0,0,0,0,0,
+0,0,0,0,0,0,31163,0,0,0,0,0,0,15808,0,41585,
+0,0,35345,7830,34360,0,42071,36332,0,35724,9364,0,45226,849,42953,45352,
+0,5256,45396,0,0,0,0,0,0,14278,21033,0,0,0,0,0,
+0,0,0,0,0,0,0,25908,0,9752,24709,24811,38076,15538,9791,20401,
+38754,40325,13062,0,38089,34069,41887,25977,0,16409,12464,0,27465,28056,47581,41537,
+0,0,0,0,29438,40730,0,7156,0,7188,0,46010,0,0,0,32123,
+0,25579,0,0,19794,13653,29788,44307,0,0,0,0,0,0,0,0,
+0,0,0,0,0,41792,22433,1659,33400,42326,0,0,11346,0,39524,0,
+8429,0,26408,37061,21378,32790,0,0,0,0,0,0,11846,0,0,0,
+0,0,0,0,0,19221,1713,18263,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,27737,0,0,41556,0,0,0,0,0,0,
+0,0,11088,23810,19290,0,26986,0,6948,0,0,21088,0,38461,0,16741,
+39905,0,4003,0,29830,0,0,0,0,0,0,0,0,33145,0,0,
+25853,40079,0,0,24454,0,0,0,0,0,9437,0,0,0,0,48748,
+0,0,0,0,0,0,21831,0,0,0,0,31533,33393,0,0,0,
+0,0,0,0,33619,19835,0,0,0,0,0,0,0,0,0,10193,
+0,26738,0,0,0,42858,10030,8574,39308,33596,0,0,0,0,40310,0,
+33152,0,0,0,0,0,21633,0,13053,0,0,37192,16860,0,0,0,
+22471,2575,25833,0,0,0,0,101,440,7097,43924,0,45114,4520,21625,0,
+0,0,22748,0,0,0,0,0,0,0,0,0,0,10553,47806,0,
+0,0,0,0,0,0,7641,0,0,0,0,30668,40606,0,0,37389,
+0,0,0,0,0,0,11988,0,0,0,3608,0,0,7306,18371,0,
+44100,0,47213,0,0,0,0,1481,0,0,44004,0,0,33298,0,46814,
+0,0,0,0,0,0,0,22464,0,0,0,0,0,0,14984,0,
+6532,0,0,15077,16989,29596,42348,0,23042,0,0,17705,0,0,0,0,
+404,0,36671,0,0,0,0,0,0,0,0,13795,0,0,0,0,
+0,0,0,0,19816,0,0,0,12664,13314,0,0,0,37859,0,0,
+0,0,28461,41326,5090,0,0,10623,0,0,21444,0,0,0,0,0,
+10989,13543,17388,28410,24941,0,0,8646,1442,0,22626,0,48369,19349,0,0,
+0,41723,0,0,0,0,0,35819,0,0,46848,0,16002,0,0,10249,
+15584,26383,33395,2313,0,0,0,0,0,0,0,0,0,0,3324,0,
+0,8590,0,0,0,8400,0,1432,0,0,0,0,0,0,0,16557,
+21031,42402,0,0,0,21463,0,0,31068,0,0,21268,0,3008,0,0,
+23178,0,0,0,0,0,0,0,0,0,20611,0,0,1680,0,0,
+21056,0,40435,0,0,0,0,0,0,0,7547,0,0,0,5562,32509,
+35985,46855,0,0,0,0,47994,0,0,0,27208,4780,23245,34705,13159,10125,
+48335,0,0,0,0,16937,0,38404,0,0,0,39613,0,0,20190,0,
+0,0,42463,0,26528,46946,0,0,0,5251,0,0,0,0,24498,0,
+0,0,30897,12726,0,0,44745,25497,0,0,46225,0,0,3064,34104,0,
+0,0,0,0,0,0,0,34267,0,0,0,21296,0,0,0,0,
+42878,0,7088,0,11086,11281,16182,0,29278,0,0,0,15555,0,0,0,
+24518,5154,0,0,47690,0,6836,0,7736,0,0,0,0,0,0,0,
+0,0,0,27059,0,37936,0,0,0,0,2779,14873,39704,179,23250,47140,
+0,16188,0,0,31456,0,18778,0,0,0,0,0,36750,0,0,0,
+0,0,26301,7514,0,0,0,0,0,48278,0,0,20415,25501,26499,48649,
+0,0,0,0,0,0,0,0,0,0,0,4566,17610,0,34731,0,
+0,28853,0,0,0,0,26233,40665,0,0,854,0,2714,0,0,0,
+22296,0,0,0,15486,0,0,0,0,3726,9151,0,0,0,0,0,
+21127,0,0,0,6714,41640,0,0,0,0,0,17454,0,2072,13611,442,
+0,10039,13670,13329,0,17188,0,0,0,0,0,0,13600,47131,0,0,
+0,0,6183,0,27753,9554,0,0,0,11053,31028,9916,6351,0,0,0,
+0,36602,0,44505,0,0,36919,27332,42528,0,4937,0,23795,0,41116,0,
+0,0,0,0,0,0,0,17879,44937,0,0,0,0,0,0,0,
+1611,0,29745,0,34473,0,0,0,0,0,0,0,48436,0,0,0,
+0,0,0,0,41856,0,0,0,0,30541,0,0,34945,0,2530,0,
+0,0,0,36477,0,0,0,0,45862,31222,0,32909,47138,0,18895,0,
+0,0,0,0,0,0,0,0,0,21185,0,36329,0,0,0,0,
+0,0,0,31144,45572,0,0,0,0,0,0,46337,0,0,0,0,
+0,0,42700,11922,0,511,20175,0,0,0,0,48163,15658,35399,10069,22961,
+10339,47948,0,0,0,0,0,5969,0,0,27088,38376,0,0,0,0,
+0,0,1756,18939,0,37004,23363,20835,0,5530,47875,0,0,17870,35187,31114,
+35814,0,27633,15332,33031,26429,29526,34240,36026,21838,0,0,0,0,0,0,
+0,42752,0,0,45015,0,0,0,0,0,0,0,0,0,42212,0,
+0,0,42342,3169,0,0,0,0,0,0,0,0,0,31309,47106,0,
+0,0,0,0,793,0,0,0,37216,0,0,0,38124,12206,0,0,
+0,0,0,3289,0,0,0,0,0,0,0,0,0,20006,11000,35039,
+0,0,0,18134,16740,0,17670,0,0,0,13279,48203,0,0,28906,48731,
+0,0,0,0,0,36397,0,287,0,0,32621,0,0,16938,43667,0,
+0,22067,0,34306,0,26510,40049,0,0,0,0,21629,0,0,0,0,
+0,0,0,0,69,12457,10878,36612,0,0,0,35161,0,0,3147,4189,
+4904,47445,0,0,0,0,0,0,0,0,0,38273,0,0,14304,11125,
+0,0,0,0,18203,37084,0,0,0,11397,0,0,0,0,0,0,
+6999,0,0,0,0,0,37448,33721,39505,48094,6619,0,16350,29281,0,0,
+47164,0,0,0,0,0,0,0,0,0,12905,0,0,0,0,0,
+0,0,35112,48726,1133,0,0,0,0,0,10268,39629,0,0,48746,1657,
+19054,22542,0,0,0,0,0,0,38250,0,29242,0,0,0,23836,20283,
+18561,24825,41487,0,0,0,0,0,0,587,0,0,0,15329,0,0,
+7655,47621,0,0,0,7844,0,0,20889,0,0,41565,0,22842,0,11891,
+0,40046,0,0,0,0,0,0,0,7046,47858,45064,0,0,0,0,
+8601,0,0,0,0,42616,0,0,0,0,0,16433,0,0,0,18187,
+29297,0,23036,25790,30779,0,0,0,0,8306,0,0,0,0,21511,36456,
+0,3118,43035,0,0,19811,5057,20198,0,2417,3742,0,0,18332,23261,25183,
+0,0,25970,0,0,12401,17358,11659,43163,0,0,8018,12106,21597,35818,0,
+0,26457,0,0,0,0,32577,0,0,48021,34948,10381,0,0,0,0,
+0,0,0,0,37610,0,0,0,0,11574,0,22073,0,0,0,0,
+42565,0,19896,0,0,6063,0,26057,0,0,0,0,3458,37022,43877,44552,
+0,0,36746,31171,0,0,12230,15768,23525,30676,38724,4259,0,20095,0,0,
+41386,0,0,0,45076,0,0,0,0,48641,1130,0,0,0,0,26365,
+0,0,0,28350,27281,32216,0,44895,0,0,0,0,0,5705,27501,0,
+0,0,19560,42524,44171,0,0,0,0,0,0,0,0,0,8258,44820,
+0,0,0,0,0,759,36562,46281,0,0,0,4108,40707,0,0,26812,
+34522,35567,0,0,0,0,0,0,0,44414,0,0,0,0,0,0,
+37352,0,0,0,0,13319,39682,0,0,8453,14109,0,0,0,0,29505,
+45741,0,0,0,0,0,0,0,0,0,0,0,21927,36753,0,0,
+0,0,0,27963,29106,43136,0,0,30437,4020,0,37476,22189,0,31332,0,
+0,37896,5397,0,43230,0,0,0,23973,0,1783,10224,18574,23779,28723,0,
+33292,47691,47729,8683,18695,0,0,0,0,0,0,0,0,27193,8034,6859,
+23563,0,0,0,14024,29657,38047,0,0,0,41016,0,0,0,0,0,
+20877,0,0,0,0,0,0,2327,18427,32153,5630,34194,38851,0,0,0,
+0,0,37645,0,0,9409,0,0,0,0,0,0,0,0,0,6500,
+13825,19553,0,16111,45802,0,0,0,0,0,0,4467,29543,33870,0,0,
+0,0,8731,2206,2244,334,16148,36634,25542,25073,10644,38999,41880,0,0,0,
+0,0,0,41771,44066,0,0,0,27456,48373,0,0,0,0,3287,34292,
+11812,0,0,0,0,0,22597,0,36526,0,0,0,0,0,27231,46636,
+0,14459,6877,19504,0,46868,0,0,40493,0,0,0,0,0,18455,0,
+0,0,0,10396,32120,0,0,0,0,0,24415,15192,23866,0,21398,0,
+0,0,5595,18424,0,0,5385,23100,23159,0,0,0,4031,21502,0,20684,
+0,0,0,0,5793,0,0,5199,34453,6552,7728,0,0,0,16054,9387,
+39098,0,0,5605,0,0,27483,0,0,16095,24906,0,0,0,0,0,
+8224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+39567,0,0,0,0,0,0,24773,4057,0,0,30573,0,31928,0,0,
+10217,0,0,23260,0,0,0,13463,0,35941,0,10,22207,0,0,0,
+26613,0,0,14538,0,0,0,37814,39017,48744,11541,11713,26079,46437,411,0,
+0,0,0,0,2887,29295,2765,0,0,0,0,0,48266,0,0,0,
+0,0,0,0,32547,0,0,0,0,30945,0,0,0,8470,7659,0,
+0,0,0,0,0,0,24064,29088,44357,30689,0,0,10432,47992,0,0,
+9444,0,0,3009,14379,28289,25974,46544,0,0,0,0,2470,40192,0,0,
+0,0,0,0,0,0,0,0,0,23458,17063,20167,38856,0,25906,1399,
+3378,4083,3161,17389,1184,41631,22623,0,5511,0,0,0,0,0,0,0,
+0,16399,0,0,0,0,48836,3964,0,0,0,0,0,0,0,0,
+0,0,0,3995,0,0,36373,0,0,17034,6534,14815,42472,24404,0,0,
+0,0,31816,43977,48306,10428,28742,35433,0,0,43780,29858,0,0,0,0,
+40080,15515,0,0,0,15601,21516,0,41192,33749,46811,0,0,0,0,0,
+0,0,22810,8531,22550,0,0,40697,0,0,0,33135,0,0,0,0,
+0,0,0,0,0,1175,7381,0,0,0,0,0,0,0,23274,0,
+0,0,0,0,0,0,0,35354,14327,18575,37858,44127,0,0,0,0,
+0,0,0,47678,48060,0,0,16398,41286,0,0,0,0,35923,0,0,
+36031,18954,0,0,0,0,0,28363,0,0,0,0,15043,0,0,0,
+0,0,14827,0,40025,0,0,0,0,0,40654,22429,21091,0,0,0,
+0,17769,0,0,22775,0,41895,0,0,2658,0,32244,6380,0,42671,0,
+8880,15226,0,0,0,0,0,0,0,0,0,0,0,0,5010,0,
+34798,0,28746,0,47747,0,0,0,47640,0,0,0,0,0,0,0,
+36431,12439,0,0,0,0,0,1470,0,6220,0,0,3054,0,32832,0,
+0,0,1281,0,17507,33300,0,0,0,0,0,0,0,0,0,0,
+6283,0,19855,0,0,0,42959,8743,0,0,26549,0,0,0,0,2511,
+35833,0,0,0,0,44982,0,11093,46117,0,0,0,9035,0,0,0,
+0,3549,0,0,0,19682,0,0,29514,0,0,0,17980,38410,0,0,
+33415,0,0,0,0,32201,2594,13316,0,40082,29344,0,0,0,2827,27900,
+9772,12013,38060,31531,0,0,42126,13960,0,3115,0,32891,0,0,0,11306,
+10576,38988,0,0,0,0,0,0,0,21541,43343,0,41336,0,0,0,
+9080,35128,37816,0,0,0,0,0,0,0,0,21873,25374,0,0,0,
+0,0,0,12767,11343,17941,30888,37047,36491,0,10702,0,0,0,21564,18401,
+16896,0,0,0,42529,23617,0,0,0,19070,0,0,0,0,0,0,
+44376,0,11462,0,39323,0,0,0,28440,0,0,0,2870,0,0,0,
+0,0,21801,14619,0,0,0,29796,0,0,42305,0,0,11221,0,35387,
+21656,0,42053,19395,39158,0,0,0,28831,0,0,0,7804,44052,12878,25188,
+0,0,0,0,45180,0,0,0,0,0,37988,0,47660,0,7845,0,
+48881,42550,0,0,0,18068,0,26809,24375,48850,0,0,10413,0,0,0,
+0,0,27839,0,0,0,4331,0,0,0,0,0,47377,525,0,30955,
+0,18976,0,0,0,0,41256,0,0,0,34154,0,0,0,14352,0,
+0,10575,40103,29114,0,37999,0,21136,0,0,0,4106,0,0,0,0,
+0,0,0,0,0,0,0,0,46729,0,0,7638,40800,0,0,0,
+13779,44891,0,0,40340,15293,31681,0,0,0,46652,0,0,0,26008,0,
+14706,20044,0,0,0,0,0,17852,0,0,25556,0,0,0,0,0,
+1801,0,23533,0,4928,44009,0,36195,0,37632,0,44732,37260,0,0,0,
+30322,35162,22549,31775,35469,1176,34070,37930,25293,0,0,23949,0,45654,0,0,
+29208,0,4517,0,0,36331,0,0,21459,0,1139,28673,38138,28536,0,0,
+0,0,0,0,26105,38826,0,12713,0,30112,43427,6787,19761,0,0,0,
+0,40469,0,0,0,0,0,35407,0,0,20539,0,41751,37420,18861,9900,
+0,0,0,32327,47204,0,0,0,0,0,0,24122,0,0,32986,0,
+0,44808,37689,44715,0,0,0,0,0,0,24338,0,0,25406,0,0,
+7013,15571,0,0,0,0,18981,0,0,48466,20087,20149,28541,20242,28108,44943,
+0,0,0,0,0,6167,15313,2099,0,0,0,46468,40649,44831,0,0,
+0,0,0,0,0,0,22074,0,0,15221,0,0,0,0,0,36951,
+0,0,0,0,0,0,0,0,0,0,18400,0,0,0,0,0,
+0,0,22642,34523,0,0,0,0,30148,0,0,0,0,0,0,0,
+10259,1766,45184,29822,0,27036,0,12297,36209,13943,40821,0,17239,39858,0,15609,
+0,0,0,925,0,0,0,0,0,16688,7475,0,0,0,0,0,
+6550,0,0,0,25789,28272,0,0,39286,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30492,
+16650,20668,0,23309,37343,41928,0,0,0,0,0,7565,9468,30687,0,9828,
+0,0,0,0,42202,0,0,0,0,0,0,40430,0,0,0,0,
+22105,0,9899,19200,43663,48723,0,0,0,0,0,0,45266,0,8226,0,
+8827,38016,0,0,7774,26600,43447,43742,45247,0,0,13033,33993,0,0,0,
+0,0,34851,0,0,0,0,0,0,7955,11608,11644,15154,0,0,0,
+21791,0,47156,683,18391,23558,0,0,0,0,0,24739,0,0,7184,0,
+0,17249,0,0,0,0,0,0,38175,0,0,41677,0,0,0,9371,
+0,35557,12107,33198,12546,17687,31347,38776,0,0,0,46191,0,0,0,0,
+8205,21716,42470,0,0,0,0,0,0,0,0,0,0,0,0,36579,
+0,31198,36455,0,0,0,0,0,0,0,0,42231,0,4936,0,28395,
+40671,0,0,0,29034,0,0,41686,337,0,0,5741,39856,0,0,30164,
+0,0,0,12078,0,0,0,0,0,0,21807,9822,30313,42850,0,0,
+34787,0,0,0,28074,12145,22655,0,44131,0,0,0,0,806,0,0,
+20199,9135,43056,0,0,0,6378,26643,0,0,38773,0,0,13325,0,0,
+0,0,0,44431,6817,34129,35877,0,24939,30179,0,0,29801,17648,0,0,
+0,0,0,0,0,0,0,0,0,35315,27755,0,0,0,0,32855,
+30938,39222,0,0,41830,20818,0,7085,0,0,0,0,0,6688,16837,26868,
+30592,32766,0,45357,13151,39247,46034,29149,0,0,0,17727,45704,45881,0,0,
+0,0,0,25776,27472,36289,0,0,0,0,0,33591,0,13078,0,0,
+29080,0,0,0,0,10027,26022,0,0,24977,0,0,26632,29663,0,0,
+20922,23640,34273,0,0,0,0,25557,40979,0,0,0,0,12229,0,14586,
+12364,0,0,0,1144,0,0,0,0,0,0,0,15048,0,0,0,
+0,6892,0,0,0,18813,27806,0,0,21537,0,4472,0,0,2407,0,
+0,0,0,8975,0,45390,0,0,0,0,14662,0,0,13397,35642,3519,
+23048,47964,0,0,14270,27681,0,0,0,0,12487,0,2989,16944,47463,31458,
+45045,0,48047,8894,17690,24863,0,0,17222,0,0,20490,0,10369,0,0,
+0,0,0,0,0,24343,0,24169,0,33,0,34825,0,0,0,2721,
+0,13582,46551,0,0,0,19908,0,0,30000,33331,0,0,43857,0,0,
+0,0,4040,8483,39118,45803,4588,0,0,0,0,20026,39909,0,36270,39411,
+0,35392,0,13164,0,0,0,0,0,0,0,34171,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+29711,0,0,0,0,0,14456,0,0,0,0,0,0,13052,35934,0,
+0,0,1505,17829,38001,0,0,0,0,37848,0,0,0,47087,0,0,
+0,8545,0,0,0,13631,0,0,0,0,0,0,0,44207,11520,17090,
+0,0,0,0,39854,0,0,0,47998,0,0,8130,0,0,0,0,
+0,18816,39875,0,0,27934,0,0,0,0,0,0,0,4226,0,35993,
+1898,0,3253,21156,0,0,0,17540,0,0,0,0,0,0,23,0,
+0,0,0,38141,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,18491,0,5476,0,0,12558,5648,7250,46956,0,0,0,0,
+10192,40969,0,0,41167,0,11103,0,0,30506,0,0,0,0,0,13174,
+17179,26902,39170,0,0,0,0,0,0,25442,0,0,0,0,35063,34167,
+32644,0,0,0,0,33009,0,0,0,10519,0,13963,0,0,0,732,
+28733,35969,0,0,26506,37845,0,0,0,0,0,0,0,0,0,12681,
+13403,0,0,46590,0,0,0,25573,0,43101,28849,0,0,0,0,29531,
+44685,0,0,0,26020,46163,0,0,19688,42696,38987,43779,48691,0,16423,47280,
+0,34237,0,4380,31983,0,11338,15123,21396,0,0,0,0,0,0,0,
+0,0,0,46031,0,0,0,0,15330,20807,0,0,25816,0,0,26197,
+47281,0,0,0,0,0,22266,0,0,14957,5072,0,10785,0,0,47069,
+0,0,34742,38702,39195,0,0,0,0,48113,33127,46046,0,33637,45868,36130,
+0,0,15466,0,0,24519,0,0,1317,41879,0,0,0,41353,46727,36042,
+14689,0,0,0,0,13715,46103,0,13100,0,10010,0,0,0,0,45612,
+1926,30380,9749,42605,48270,0,0,21912,18752,0,0,31948,0,0,0,15361,
+0,0,11690,0,0,21726,0,7873,0,44143,0,0,0,0,0,21138,
+35616,0,29771,35238,0,13266,0,0,16892,0,0,0,0,27068,23333,0,
+39825,0,2757,16339,47916,0,0,0,0,36352,0,0,0,0,0,0,
+38496,42237,0,0,22679,0,0,0,26097,0,47212,8472,0,0,0,0,
+0,274,0,0,0,0,19423,8671,0,0,43207,0,11938,26800,0,16404,
+0,0,0,0,0,0,0,1280,0,30208,0,0,0,0,0,0,
+0,34835,0,0,0,0,27982,45599,0,0,0,0,0,0,19369,2737,
+0,40878,0,0,18665,38853,10777,19208,21029,25065,0,13867,0,0,9213,29839,
+37309,34689,41493,47418,0,0,46760,0,0,0,5966,0,0,15461,0,0,
+6893,0,1862,20554,10283,0,26083,0,13001,0,0,0,0,4339,22097,0,
+0,0,15690,0,6894,0,0,0,17193,24155,29091,0,0,0,0,0,
+0,3074,0,0,66,41905,0,0,0,0,27635,26705,0,29146,0,24989,
+0,0,0,45856,0,0,0,0,0,0,19987,0,0,0,0,16000,
+0,0,0,11926,46297,35291,37606,0,5889,47161,0,0,0,0,0,0,
+0,22633,0,0,0,0,346,6600,10704,24791,29737,20378,24340,0,22496,8016,
+10813,0,12137,28683,34231,1528,7209,0,0,4598,19205,0,0,0,0,0,
+0,0,0,0,0,26039,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,37246,0,0,0,0,34684,0,12937,0,33967,46403,
+4511,0,0,21514,0,34494,0,0,35628,0,0,0,12149,0,21718,0,
+4117,0,0,0,0,26765,0,0,0,0,0,0,25564,9470,27024,32503,
+0,0,6074,0,0,0,1393,26937,23887,27072,22891,32415,34472,41241,43425,0,
+43473,17660,48832,0,0,0,24466,0,18862,29308,0,38289,46323,0,0,0,
+40486,0,0,0,0,0,0,0,0,0,0,0,39480,0,0,0,
+0,36978,0,0,0,26206,0,0,5410,29155,6684,0,0,0,0,0,
+0,0,0,0,11686,0,0,984,0,0,0,0,35659,0,0,24945,
+0,0,11951,19947,24334,36959,0,18458,28047,5599,14812,28277,0,15316,0,25668,
+27043,3813,6273,0,0,0,0,0,0,0,0,871,0,0,0,40102,
+0,0,0,0,0,12753,35258,0,0,10754,16658,1140,20601,0,16637,24837,
+10756,0,0,0,0,0,0,0,0,6455,0,0,0,3347,0,0,
+0,48053,0,0,25667,0,2920,0,0,0,0,0,0,0,0,0,
+0,0,32548,0,0,0,0,5331,10230,17392,20743,24686,27280,44853,37174,0,
+0,41575,8788,0,0,0,0,14918,0,0,0,22356,0,41766,0,0,
+18473,0,0,0,0,0,0,0,0,0,0,0,0,33324,35885,0,
+9560,35252,0,0,0,0,0,0,29909,20854,0,0,0,0,42153,34034,
+0,31887,0,0,8808,32228,0,0,0,0,733,0,0,3141,0,0,
+22705,12243,0,27401,34181,0,0,0,18505,880,26006,27265,0,38985,9192,41454,
+48415,0,37203,0,10445,33299,31479,35580,0,0,0,0,0,0,0,0,
+37561,0,0,22330,38224,0,0,0,0,35214,0,35509,0,0,0,0,
+0,37265,43020,11590,0,32936,0,0,0,0,0,0,36683,0,0,0,
+7644,0,0,0,0,41254,45733,37550,25627,11269,0,11661,0,0,0,6868,
+16343,25891,31935,38884,42823,48268,0,34503,0,14081,0,0,6247,39968,0,41313,
+44252,0,0,0,0,0,19965,41267,0,0,0,0,0,0,0,0,
+42241,34095,47915,0,0,23585,0,21980,44746,18790,19151,2820,14188,9938,33946,0,
+0,0,0,0,0,0,91,0,21837,0,0,18972,419,41361,0,0,
+0,0,0,6421,28927,0,0,0,10950,0,0,0,0,0,0,0,
+0,44997,0,0,0,0,0,0,0,0,0,0,37750,0,22841,0,
+17208,0,0,0,7694,12370,42322,7296,0,0,0,0,0,0,0,0,
+0,0,13357,28119,0,13034,0,24750,0,0,0,34130,0,0,0,0,
+0,0,0,19424,28423,18898,0,25083,0,5658,0,0,0,0,0,0,
+0,39459,0,0,0,27562,27652,35383,43866,0,24754,33571,34184,0,246,6170,
+0,0,0,0,0,0,0,0,0,0,10366,34199,0,19089,0,0,
+0,34617,43287,0,0,5108,0,0,0,0,33463,0,0,0,0,0,
+0,18396,0,0,34610,0,13866,0,14047,0,0,0,0,0,0,0,
+0,426,0,0,0,0,0,0,0,0,43913,0,0,0,45739,7953,
+12835,0,0,36873,46109,42870,0,13720,27868,0,0,0,0,0,0,0,
+0,0,0,0,31226,44223,2934,0,0,0,0,0,0,0,0,0,
+28392,0,0,0,0,6654,26568,0,0,11087,0,0,0,18941,18968,0,
+0,0,2011,0,32843,0,34536,24205,0,43875,21503,5785,0,0,0,0,
+0,0,0,34720,37974,0,0,0,0,0,0,0,12262,29233,0,32529,
+40259,0,40373,19685,0,0,0,0,0,0,0,0,0,41143,30095,0,
+0,0,0,0,0,0,48513,0,0,26519,1469,0,28132,0,0,0,
+0,0,0,0,0,0,0,16527,45749,0,0,0,42689,0,0,0,
+48219,37225,31271,0,0,13171,0,0,0,22654,11978,27540,27611,0,20182,0,
+0,0,0,0,44486,14857,15124,0,22694,0,0,33213,0,0,0,0,
+14159,48058,0,0,8099,46350,0,38529,0,0,0,0,0,0,0,0,
+0,0,29714,34050,46744,12345,0,0,27236,0,6392,0,0,0,0,0,
+0,0,6242,42670,17043,16605,26388,38343,38352,0,8178,47529,0,0,19997,2992,
+29475,35954,149,0,0,0,19914,8414,20376,0,0,18640,0,16652,0,0,
+0,0,0,0,0,0,0,0,0,36831,23485,15771,2559,11830,22329,0,
+0,0,13621,0,27572,0,0,35023,0,6932,41737,0,2605,0,0,22463,
+0,13243,0,14657,0,19905,44336,0,0,0,0,1707,0,0,0,0,
+35786,0,0,0,0,12486,40456,0,0,0,21937,0,0,24318,0,0,
+0,3344,8712,0,0,0,0,0,41988,0,20359,36058,0,47895,43392,0,
+0,34144,0,0,0,0,0,0,0,0,20629,0,0,0,0,0,
+0,27504,35371,0,0,0,0,0,0,0,0,0,0,34493,0,0,
+0,0,0,0,28404,0,0,0,0,32966,0,0,0,0,0,0,
+0,33337,0,0,41942,0,0,0,0,0,0,2229,20981,0,0,0,
+0,0,0,0,21842,21636,0,0,10151,0,18235,28757,0,34059,30864,0,
+0,0,0,0,15692,40396,48716,33558,0,48186,15795,30245,44462,0,21601,0,
+0,0,0,34480,0,0,0,17629,0,42360,19509,0,0,0,0,0,
+0,0,0,0,0,17091,35676,0,0,0,21577,0,0,0,0,0,
+37742,0,0,0,40353,0,0,0,0,21568,19396,0,3248,16085,0,0,
+7281,0,29228,0,24874,0,0,1501,37269,0,0,27000,31472,32018,17700,40312,
+43220,0,34725,10696,0,0,0,0,0,38628,0,16987,0,0,0,38392,
+43827,0,0,0,0,39304,26852,15993,7716,0,41817,0,0,0,0,38191,
+0,0,4942,26175,0,0,0,0,0,43462,0,0,0,23407,0,0,
+0,0,0,5623,0,31922,34800,18648,35944,0,0,0,5263,0,0,0,
+852,0,0,13495,24737,0,2776,0,8057,20638,30382,0,21318,0,0,12025,
+0,0,4738,0,43221,13935,0,47737,0,9740,0,0,0,0,0,81,
+7061,10239,19971,35605,45601,48057,0,0,0,26450,26679,0,11035,0,16175,0,
+0,32941,28947,19513,47969,42910,0,0,0,38211,0,0,27031,48482,28373,0,
+0,0,0,0,0,0,0,0,0,7147,0,0,0,0,0,0,
+0,0,0,0,0,7920,19693,17875,0,0,0,0,1708,0,0,37508,
+18087,0,0,22403,0,13756,0,0,0,0,0,0,48391,0,0,0,
+0,0,0,1226,18734,0,29298,0,0,0,9775,5281,0,0,0,0,
+0,38035,8140,7443,0,0,0,0,23190,23227,39076,0,0,6603,0,0,
+0,18793,23359,0,0,0,0,0,0,0,33118,20232,0,0,0,2443,
+0,0,0,22999,0,0,0,0,0,27384,21703,10738,27620,0,22840,0,
+0,14917,0,0,43021,0,48860,0,0,0,0,0,23046,0,0,0,
+24032,19942,0,0,0,9866,13299,0,0,0,0,0,0,0,4347,0,
+0,0,0,0,0,0,0,14257,0,8844,26132,0,0,0,15040,0,
+0,0,0,416,0,0,24779,0,0,0,0,34177,0,0,0,0,
+0,0,4475,34174,24165,24658,6785,37629,48891,0,0,0,0,10763,0,0,
+5432,3282,9731,0,46875,0,0,0,0,0,0,0,0,28712,28068,20374,
+1642,20944,29799,25805,0,0,0,0,0,0,23399,9986,41158,0,0,0,
+15634,0,0,0,0,0,0,0,37639,39291,0,0,15707,43989,0,20698,
+0,0,0,0,0,0,0,19633,0,14884,12241,0,0,0,32419,13112,
+15463,40674,7510,47183,0,0,25708,0,0,0,0,0,0,0,0,21142,
+30969,0,27642,31761,0,0,5881,0,0,0,0,0,0,0,11018,0,
+4483,29996,31879,0,0,21604,0,0,9435,35078,0,0,14881,0,0,0,
+0,0,0,8942,32358,36989,0,0,0,0,0,0,43216,0,0,0,
+0,43026,33653,0,17865,0,0,0,0,3157,0,0,18329,0,0,11740,
+0,0,28500,0,0,23275,29495,0,25353,25689,424,0,34540,46347,0,0,
+0,0,0,29093,0,6104,0,0,13570,32613,0,0,27395,0,40168,44388,
+0,0,9028,28070,0,5770,15927,22732,44886,11472,14793,3286,0,0,0,0,
+0,29401,30559,0,0,18125,1981,0,0,24479,26971,27660,0,0,42107,46141,
+12723,0,0,0,0,0,0,0,47540,0,0,41346,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,7367,0,0,0,0,0,
+0,0,0,0,0,0,0,3514,9580,0,33196,2479,27619,27315,0,42425,
+0,0,38301,0,0,0,0,39705,0,0,0,0,0,0,0,0,
+0,34557,0,23682,0,7521,0,0,0,0,0,0,0,0,0,0,
+0,0,41986,0,0,0,0,42197,0,0,0,0,0,0,46457,0,
+0,34150,0,19102,0,22339,0,0,0,0,0,0,11364,0,0,0,
+0,0,24355,0,0,18038,0,0,0,0,0,0,0,0,0,0,
+0,11779,11703,2507,14651,38059,44301,3343,0,0,0,15796,0,22640,5404,8798,
+0,19374,0,0,0,0,0,6918,35721,40578,0,0,0,0,0,31967,
+13658,0,0,0,0,0,32023,0,0,3643,26551,3557,0,43583,29652,0,
+13486,34773,19367,10830,32853,0,1980,0,0,1414,42838,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,46756,0,0,
+0,0,0,0,0,0,0,0,0,0,0,16959,0,0,0,0,
+0,0,0,0,0,11043,23057,41622,45344,0,0,0,0,0,0,0,
+35533,8820,48750,0,0,0,0,0,0,0,0,42626,0,0,0,27625,
+0,0,0,6752,0,0,0,0,0,5521,12484,0,0,0,31629,0,
+48422,6022,0,9809,17313,0,16669,0,0,19994,0,0,32027,45884,0,34018,
+0,32467,0,39274,34277,0,23636,0,14716,0,0,3179,5269,0,0,28917,
+32259,0,0,0,20055,0,0,0,15238,0,15378,28968,0,0,0,0,
+0,1378,35278,0,0,0,37332,0,0,7000,22030,0,8659,24975,0,0,
+0,0,0,11749,13954,0,0,0,0,0,0,21559,0,0,0,2515,
+45854,32567,0,0,0,17407,0,0,0,33943,0,0,0,46967,0,0,
+0,13072,20379,28623,0,0,36185,0,0,0,0,0,22221,6434,0,0,
+0,20197,26956,43279,0,39052,41883,47538,0,0,0,0,0,15528,0,9842,
+0,20467,46136,0,0,0,33001,4771,32017,42224,0,24406,12918,0,0,0,
+26084,13137,42914,9968,29917,34312,17858,35909,0,0,0,0,25172,32175,12430,37386,
+0,0,38709,0,755,35670,24882,0,0,42954,0,0,0,0,0,0,
+0,0,0,0,0,0,0,41359,21994,31451,0,0,0,10377,3381,31979,
+0,0,245,0,0,0,0,26751,0,0,0,0,0,27906,0,0,
+0,0,0,0,0,0,0,0,13569,0,0,0,0,0,0,0,
+41222,0,0,0,0,0,0,0,0,0,24899,2784,0,22692,0,0,
+0,16852,30979,23766,0,0,0,0,0,37180,0,0,0,0,0,9609,
+44849,0,0,0,0,6510,20896,0,0,0,0,0,0,0,0,0,
+0,0,32495,34847,0,0,0,0,43086,0,36653,0,0,350,0,0,
+9407,23058,0,0,8223,0,0,0,0,0,0,0,0,0,0,0,
+43525,0,0,0,0,29126,0,0,12523,14513,19160,30640,0,0,32303,0,
+0,2413,0,0,14483,15821,16785,0,0,17164,0,0,0,0,0,47025,
+666,0,0,0,0,0,0,0,0,43036,0,0,5469,0,32076,0,
+0,0,0,0,3690,36997,0,0,0,0,0,0,8740,0,1199,0,
+8004,0,0,0,0,21828,28375,31568,33305,0,6516,18671,0,0,0,0,
+0,8898,0,0,0,0,0,14695,35293,0,0,35055,109,31720,0,18513,
+3507,4280,9919,1504,19664,25192,30431,9598,44361,5933,0,0,46872,0,0,0,
+4842,42137,44867,0,0,0,25170,0,33658,0,0,0,46763,39571,0,0,
+0,0,21603,41171,0,0,4969,48570,14016,0,0,0,1716,24373,22824,6897,
+0,0,10292,21611,33499,0,0,37556,0,35255,0,0,20090,0,39048,0,
+0,0,0,19381,0,0,35722,0,0,0,0,15831,1632,5294,10609,13220,
+0,0,0,0,5498,0,0,20695,19418,0,13687,0,0,28391,10449,13901,
+14953,35940,0,0,11145,1841,0,0,4292,5109,12240,0,0,0,16882,0,
+18128,25676,47741,0,0,0,3787,0,18347,0,33238,23820,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,24206,0,114,0,
+47303,0,0,0,25823,0,0,0,0,0,0,0,0,33302,31668,35736,
+0,13616,15262,0,0,0,0,46328,29454,0,0,8866,7808,26135,0,0,
+0,0,0,0,6189,43398,0,0,41594,0,5215,21784,0,0,48786,0,
+0,996,0,29634,0,34024,0,0,0,19569,7399,45278,0,0,0,0,
+0,0,0,24105,0,0,0,0,7930,0,0,0,0,0,0,0,
+0,47112,0,0,6008,19837,40099,0,0,11985,24712,0,27482,0,35831,0,
+0,0,0,0,1867,45687,46003,40700,0,0,0,0,0,19769,46878,0,
+0,13055,0,0,6472,0,31317,3272,4097,0,0,0,19672,0,0,30052,
+3774,0,35072,19192,0,28515,0,0,0,4882,0,0,12682,0,28222,0,
+0,24689,10146,11314,0,0,0,0,0,0,37989,0,0,0,0,0,
+48486,0,0,11796,0,0,0,0,18296,18136,4757,18828,0,0,0,0,
+12542,0,0,0,0,0,0,37786,38796,0,0,0,5737,30661,0,43500,
+0,0,29552,0,0,0,3515,0,0,0,35576,0,0,0,0,0,
+0,9178,0,0,42813,0,0,0,0,24578,0,42000,0,43589,35539,0,
+0,15604,32449,27016,24053,5766,0,0,0,0,0,0,0,0,0,26917,
+28401,0,31221,32196,0,0,0,0,15815,1975,20664,7288,8794,4402,13823,22605,
+0,46874,0,0,30321,19532,4322,0,0,0,0,0,10306,14475,0,0,
+0,0,0,20902,0,0,0,0,3628,28327,43093,0,0,0,6370,0,
+39585,28773,30299,0,0,2951,14653,0,0,0,0,0,12166,0,38593,0,
+0,0,0,0,0,0,0,11446,0,0,0,8144,0,0,3730,0,
+0,0,0,10541,22553,24153,0,46757,27936,9208,0,4760,47289,3021,0,0,
+0,0,0,33768,0,0,48439,11368,17065,6972,48722,0,0,0,0,0,
+0,963,28269,47869,0,0,0,0,0,0,0,0,42996,0,14358,12038,
+0,0,0,0,0,0,0,0,0,0,47843,0,42310,0,0,32521,
+1670,1879,20463,36112,43495,12724,45373,7446,45933,40916,10357,12046,19465,25159,42384,4425,
+19084,16462,26761,0,0,39270,0,9832,0,0,7682,0,33878,0,16737,0,
+0,0,0,0,7481,0,0,31651,0,37666,0,5851,12135,0,0,35184,
+41365,0,15758,12954,0,0,0,4362,28676,5690,28288,0,0,11655,0,0,
+30059,0,22248,9564,16286,33995,7091,0,5127,0,33797,10765,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,43272,0,0,0,10297,13868,
+42534,35901,27310,0,0,30801,0,0,0,44107,7245,7342,18934,21868,0,0,
+41265,0,0,18908,0,19945,0,0,0,29778,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,17375,0,0,35522,0,0,35148,0,
+0,0,0,423,20208,25094,40523,0,5678,0,0,0,0,0,0,0,
+0,12124,14896,30067,0,20229,33176,33537,0,12105,36558,0,0,0,0,13218,
+19727,31628,40938,0,12561,0,0,0,0,0,0,10759,19447,46175,15104,26601,
+0,0,11456,0,0,4644,0,0,0,2561,0,0,0,0,0,0,
+19988,0,0,23869,0,27613,0,0,0,16336,27488,0,0,0,0,0,
+0,0,0,0,0,38335,0,0,13511,0,0,11443,0,19929,19786,0,
+5016,15133,0,0,34091,0,0,39836,34621,0,39736,37268,1067,29973,0,0,
+0,0,22518,4665,0,0,0,0,0,15779,0,10584,0,33129,0,0,
+0,27774,0,0,0,46090,9042,2961,0,14867,0,6828,0,0,0,0,
+1771,7411,0,0,0,0,0,0,0,0,0,0,19397,19401,0,43353,
+34654,0,0,41173,0,1524,0,46783,82,12016,17143,0,0,0,30967,0,
+0,0,0,0,0,23450,0,0,0,0,0,0,12656,0,0,0,
+0,0,0,0,0,0,27147,0,3801,31525,41150,0,37687,12597,0,0,
+0,4623,0,41478,0,0,0,0,0,19735,38112,0,0,0,0,0,
+0,0,0,0,0,44368,0,24725,3419,36941,0,0,0,31477,39185,0,
+23785,35219,0,0,0,16915,0,0,0,0,0,0,0,0,1217,17770,
+24716,48617,0,0,0,41451,0,0,0,0,0,43033,30641,0,33518,0,
+0,0,0,0,17447,25254,38306,38981,31405,12085,0,36913,0,0,0,0,
+0,0,21094,0,14666,45973,0,10552,0,0,0,0,0,0,0,0,
+0,0,0,0,0,4412,0,0,0,0,14694,0,0,0,0,2320,
+0,20205,0,13679,23986,0,0,0,10996,4949,0,0,0,0,291,10397,
+0,0,0,1786,42439,11374,0,0,0,16119,0,0,0,0,37438,0,
+0,0,0,34405,0,6147,0,6942,41285,0,0,0,0,0,1572,0,
+0,31212,41282,0,0,39920,20138,16032,25968,0,0,31158,0,0,0,0,
+9052,0,0,0,0,0,0,38503,0,10536,0,0,0,3574,0,0,
+0,0,0,28679,38193,0,0,17611,34989,5594,39472,0,0,16427,0,23788,
+27675,0,6759,22721,0,11285,0,0,0,11040,6060,0,0,0,0,17550,
+0,7601,39150,0,19430,0,30681,0,41672,0,38258,0,32457,0,0,29457,
+0,0,44953,0,0,10739,22428,0,0,0,0,0,0,0,0,0,
+0,0,0,23265,0,27405,0,0,31279,0,0,0,5418,0,30139,0,
+11006,0,12929,18543,27531,28030,0,0,0,31097,0,0,32305,0,0,0,
+0,0,36963,0,0,0,0,15668,0,24984,0,21959,0,0,0,0,
+0,34470,0,0,0,11257,45597,0,0,0,0,7759,0,0,0,23858,
+0,0,2863,30020,0,0,0,0,6314,41668,27754,0,10848,8253,0,0,
+0,0,0,5757,0,0,0,2428,44413,0,0,31270,0,0,0,36018,
+0,0,0,0,0,43673,243,17772,17968,20959,35319,38115,0,14202,0,0,
+0,26017,0,26685,0,9461,15595,0,0,44225,0,0,0,0,45081,0,
+0,0,0,0,31625,33972,27939,0,0,46149,0,0,0,0,0,26199,
+2839,0,5504,23917,34553,0,0,12570,25547,47387,0,13796,33323,0,2192,34674,
+36230,0,0,0,1231,0,0,0,0,0,0,0,29293,0,884,0,
+0,0,0,0,22706,0,0,14473,26441,0,27083,0,29939,40685,40955,0,
+11743,9814,31620,19677,36170,13312,36599,0,0,13450,0,0,0,0,4924,38080,
+22582,43960,47655,0,0,0,0,0,0,40536,0,10225,0,10582,31512,0,
+0,0,33635,0,0,24245,0,8129,17084,38274,0,27765,0,0,17917,18863,
+0,13502,0,0,0,0,0,0,0,4812,0,0,0,0,0,0,
+0,0,0,12255,0,0,10334,45516,0,0,25820,0,0,0,40546,0,
+6480,9957,0,0,0,0,0,31269,0,0,0,0,961,32295,0,47407,
+0,0,0,0,0,0,0,43312,0,16406,21215,0,0,0,0,43674,
+0,0,0,39271,44089,31973,25092,30672,38009,0,37749,0,0,16736,0,32595,
+0,25879,37113,565,22107,0,19998,0,0,4770,11931,20157,0,16117,0,0,
+0,0,37048,48670,3637,19564,26322,40306,46040,0,23611,0,0,0,0,0,
+21,0,0,0,44996,0,28380,39806,0,0,0,0,0,0,47870,0,
+0,0,0,19675,0,0,0,43588,0,0,2438,0,0,0,13705,0,
+0,0,8775,0,0,0,0,0,0,0,25905,0,30141,31513,0,0,
+0,10245,0,0,0,29108,0,0,0,19157,26831,37617,45248,0,0,0,
+0,0,0,30025,39720,0,12380,0,0,0,0,44095,0,0,0,28020,
+33289,40897,33572,0,24617,32242,0,0,5505,7059,0,1030,8937,9696,0,7875,
+0,0,18449,0,0,0,0,0,0,15407,0,0,0,0,0,14199,
+12031,41957,0,0,0,0,0,0,0,0,0,14442,23769,38283,18644,19543,
+21992,25921,8077,38623,35251,0,15892,0,0,0,0,0,0,0,3461,42862,
+0,19651,32828,46901,0,0,0,0,0,0,0,0,0,23929,0,0,
+0,0,0,0,0,18607,965,9553,35523,13228,35084,28571,30319,37367,42776,3436,
+0,0,0,0,0,0,0,0,0,0,0,31425,0,0,22984,0,
+0,27651,0,0,0,295,17030,27923,44670,0,0,3410,24685,0,0,0,
+0,3651,14688,0,0,0,39144,0,26967,0,0,0,11429,8823,0,0,
+0,0,0,0,0,0,42880,0,0,0,0,0,0,0,0,0,
+0,0,0,40858,43240,19163,0,0,22757,40397,0,0,0,0,25085,0,
+19071,20061,40043,40945,0,0,19357,0,47788,0,0,0,13902,32586,0,0,
+26009,0,0,21389,0,0,22647,0,47504,30922,0,0,0,0,0,23384,
+10749,30538,0,0,0,0,0,0,40929,0,42306,15404,0,0,21411,40427,
+48228,31844,36655,0,1251,26111,22321,29872,29979,0,0,0,4547,14659,23201,39521,
+38618,0,3279,0,0,0,30512,29863,10802,0,0,0,0,17390,40383,0,
+0,9351,15535,0,0,23843,29436,8166,37032,44964,0,0,0,0,0,30273,
+0,0,0,0,0,3099,33922,46858,24606,38722,0,0,0,0,0,12153,
+17606,6795,13880,21613,17977,1963,5999,35668,39160,0,0,0,6559,23507,34335,0,
+4569,43508,0,0,0,0,24364,41305,0,43527,0,0,0,0,43097,0,
+0,0,0,14044,0,0,0,0,0,0,0,0,0,21723,0,0,
+40693,0,0,12042,20483,0,398,0,0,0,0,0,0,0,0,6784,
+0,0,0,42729,0,0,0,0,0,15657,0,0,0,0,0,0,
+9917,17513,0,0,41320,22208,30132,0,31953,0,33759,37507,39182,22839,48653,0,
+34815,13070,38468,0,0,0,15649,0,0,0,0,7546,0,18974,17869,22187,
+0,0,43380,0,0,25710,10476,0,7103,0,0,31436,33173,37469,41009,44530,
+0,5641,0,0,43050,9699,0,0,3393,39141,0,0,0,0,0,0,
+9604,154,39321,0,0,0,1060,15836,23667,0,47059,0,0,47852,0,0,
+0,11389,0,0,45776,0,0,0,17812,24822,5693,40745,26312,2111,40776,8181,
+0,16595,2376,42938,0,0,0,0,39401,0,0,0,0,0,14368,0,
+0,0,0,16744,0,38370,42835,0,20477,0,36547,0,0,0,0,0,
+2848,14925,25890,37497,39245,39456,0,0,0,0,0,0,0,0,20343,0,
+44900,41087,0,0,0,0,27493,18052,42307,0,0,9549,0,46493,0,0,
+0,5663,0,21357,0,0,0,0,0,7055,47318,0,0,0,0,12030,
+0,0,0,38050,0,0,371,15930,45648,0,0,0,16666,9800,33559,24962,
+0,16928,15207,23003,0,0,0,0,28740,16726,20978,21667,14816,47557,0,39643,
+32189,47378,0,0,0,0,24465,45800,0,41896,43030,0,0,0,0,0,
+22110,0,0,0,0,0,34115,4575,0,22509,0,14916,5922,18474,29878,27044,
+0,37245,0,14280,0,0,38195,0,0,0,45153,0,0,0,28590,0,
+0,41941,0,0,0,28441,0,0,0,0,0,35388,0,0,0,0,
+29244,0,0,0,9670,16664,0,0,0,0,2166,30238,31589,0,0,37115,
+0,0,22621,34958,35272,0,0,0,0,0,0,36378,33253,0,0,0,
+35450,0,0,0,34241,0,0,0,8768,16947,31815,0,0,33830,41892,0,
+0,16900,44780,0,0,27434,0,0,0,27557,0,13181,38127,0,47844,0,
+0,0,4885,14120,0,23471,750,7828,25576,40985,0,17982,0,32322,0,34980,
+35926,0,19793,23859,0,0,48560,0,0,0,0,8602,0,0,41955,0,
+0,28241,0,0,10968,0,47095,42514,0,2168,0,2923,35583,0,0,0,
+7406,37112,0,0,0,0,0,14920,0,0,0,26652,7154,4531,38617,0,
+0,22489,6490,8907,0,0,0,0,0,0,0,0,45111,0,0,0,
+0,0,0,0,0,0,40092,0,0,10605,0,48155,0,0,0,0,
+0,0,0,41050,0,0,0,13508,0,0,0,11357,0,0,0,0,
+0,0,0,0,0,0,0,0,46541,26710,37002,22948,0,0,0,0,
+0,0,0,0,0,0,0,0,0,19053,6292,13424,45999,333,29053,29897,
+36710,46339,5049,0,0,44472,0,0,39775,0,0,0,0,0,10500,0,
+0,18896,0,0,0,0,0,0,45755,42849,0,0,0,0,0,0,
+5258,35467,15956,22742,31812,12498,15908,26003,0,0,0,0,0,0,0,0,
+0,0,0,0,8829,0,0,0,0,0,0,0,36637,0,0,4792,
+40329,43278,0,0,0,0,0,0,0,0,0,8669,0,0,0,3291,
+0,0,0,22681,33760,7166,42622,45158,1750,17262,25652,0,0,0,48516,0,
+26531,47779,0,3780,29744,0,0,0,0,0,0,19884,8651,13412,0,0,
+0,23689,0,0,0,10437,0,24130,1949,29836,15804,0,0,0,0,0,
+0,0,19028,9108,11578,9507,24115,30515,33841,41869,45147,1058,25413,0,0,0,
+24236,9579,25917,38524,0,0,0,48801,0,0,0,0,0,0,0,0,
+0,0,8490,0,0,0,0,0,17191,14529,21015,13510,21497,7832,37796,20077,
+47342,0,0,10081,27827,3999,0,0,0,0,0,17265,0,0,0,0,
+472,539,47081,0,0,0,0,0,45016,0,0,0,0,19802,22704,0,
+0,0,43314,11415,0,0,0,26805,15665,0,0,39288,0,4951,27511,3349,
+29334,0,0,0,0,0,0,0,0,26659,0,9584,31103,26843,5592,0,
+0,28930,4121,33187,44542,0,0,0,22609,0,0,0,0,35741,958,0,
+0,11092,0,0,18171,23025,0,0,16,0,0,27491,0,0,0,15789,
+16274,0,0,16779,0,0,0,0,0,0,0,0,7476,3060,41484,0,
+0,0,0,24604,8458,0,0,9020,14999,44271,0,0,0,0,0,40638,
+0,0,0,0,0,0,0,0,0,0,34893,22852,32629,17511,0,0,
+0,0,0,0,0,20130,27299,37493,0,0,0,0,0,0,0,0,
+0,0,4392,0,48837,0,0,0,17015,0,0,0,0,0,0,0,
+0,2374,47922,0,0,0,0,0,0,0,0,0,16101,41376,2864,8005,
+14646,0,0,25867,0,6041,0,796,21530,0,0,0,864,0,17448,0,
+31535,37388,45924,0,20718,47610,0,0,0,0,0,8190,0,0,0,0,
+0,0,0,0,0,0,0,994,32163,40762,45230,43858,0,0,0,0,
+15044,0,15456,21081,0,37063,0,0,18871,6751,0,0,23923,46361,17402,0,
+0,0,0,0,0,19637,5903,0,0,0,0,0,0,9353,0,0,
+0,14517,18594,46555,0,0,0,0,0,11172,25616,0,0,0,10455,0,
+0,0,0,24649,29806,20977,6083,3681,0,0,0,0,0,0,0,39315,
+0,37134,0,0,0,0,16728,13182,27079,34333,5955,31219,39475,39424,0,0,
+0,0,0,0,0,25952,0,0,0,0,0,0,25381,0,0,45887,
+6727,0,0,15017,0,0,0,0,0,0,0,37714,0,0,0,0,
+0,34554,45638,0,0,0,0,32243,0,0,37221,0,0,10852,0,18684,
+0,17602,2522,0,36210,0,17446,0,17906,0,0,0,0,0,15246,24704,
+14214,6053,10392,0,6173,0,0,44873,8816,0,28059,45948,0,0,0,25004,
+0,12095,2712,36364,0,0,0,0,0,0,43064,0,29476,0,0,33569,
+14131,14713,0,173,36060,0,0,0,0,13083,30738,43003,0,39790,0,0,
+38676,0,0,0,0,0,15816,0,0,0,0,0,0,0,0,0,
+0,4591,0,42665,0,0,0,16167,34274,45327,0,44727,44885,45770,14314,20391,
+31957,36105,0,0,0,515,9856,21783,15239,26608,34682,0,43790,0,47390,0,
+0,35888,0,0,0,0,0,0,0,0,0,39240,0,0,0,14561,
+15812,41211,0,41447,0,0,0,0,0,0,35691,10493,24037,21480,34516,22899,
+0,0,1864,30741,32106,0,0,0,0,6796,0,0,44375,0,0,0,
+0,6899,46949,48227,0,15906,18891,0,0,0,0,0,0,0,0,0,
+0,0,21471,5197,20876,8684,31598,0,0,9011,23550,37338,0,0,0,0,
+0,26330,44341,598,0,0,0,5155,0,0,0,0,0,42937,0,20930,
+38712,42411,47542,0,0,0,0,32754,4508,17862,19579,45816,48679,0,0,22906,
+0,0,0,0,0,4767,0,0,15580,42479,32659,0,0,0,43759,0,
+0,0,0,3892,43551,0,13455,0,37281,39486,0,0,0,19744,9278,36370,
+0,0,0,0,45218,0,0,0,0,0,0,0,0,37552,0,0,
+0,0,14013,41968,0,0,8058,0,0,0,0,14985,35520,37019,38451,0,
+48418,0,23677,38470,0,0,0,0,20844,16832,0,0,0,0,0,0,
+0,37704,0,0,4592,0,21208,0,11180,18995,43509,0,0,40277,41159,0,
+0,38504,42200,35196,14008,39264,0,612,0,0,0,46180,0,0,0,12090,
+17032,19301,32776,0,2846,8215,41655,0,0,0,0,32938,0,4125,13255,0,
+0,6128,12494,16166,0,14903,3192,12392,0,39284,0,0,0,0,0,0,
+48099,0,4655,0,22004,5237,21234,38731,0,14948,0,881,0,17979,0,6410,
+0,19911,0,3584,47736,12273,0,0,0,0,0,0,0,0,0,46257,
+0,0,0,48500,0,18990,31557,0,0,21414,24814,43514,0,26026,0,0,
+0,0,0,0,43749,0,30330,21158,28858,9972,0,0,0,24722,12928,47216,
+0,0,0,0,0,0,0,30994,0,0,0,0,47841,32587,0,0,
+0,0,45424,0,44469,0,0,0,0,0,0,0,18039,0,0,0,
+14410,27349,0,0,0,0,0,22344,0,19601,4021,0,0,24980,0,4191,
+45348,0,0,0,0,0,11347,0,0,0,12150,0,0,0,0,0,
+0,0,0,0,47503,0,0,0,0,48830,39794,47674,0,0,498,540,
+0,0,0,0,0,16522,0,0,0,0,10288,0,20952,22372,35755,0,
+0,0,48022,0,0,34598,6466,13869,0,0,0,0,0,0,0,0,
+0,0,0,0,9421,0,12614,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,458,24524,0,38729,0,0,0,0,0,27854,0,
+0,0,0,31075,0,33328,0,0,0,0,0,0,0,22014,3763,0,
+0,22359,0,0,0,14608,17337,0,33630,0,47240,0,0,7558,41923,41149,
+0,0,0,0,16184,0,32877,2300,0,0,0,0,8110,25893,0,0,
+0,0,9297,0,39072,0,0,0,0,0,0,0,0,26944,0,28421,
+0,4129,38771,47226,0,0,19187,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,34023,39210,35979,5848,0,0,450,0,11871,
+0,0,0,34432,39799,0,0,0,0,0,26972,43512,19753,3015,30430,0,
+0,44331,0,7129,2202,4561,0,0,0,0,0,0,359,28632,0,0,
+0,33250,0,47535,0,0,0,0,0,0,0,0,3302,0,0,156,
+19436,0,0,0,0,0,28745,12865,31242,18121,502,36297,0,0,30737,12371,
+7600,0,0,660,2146,19466,21361,31540,0,0,0,27047,0,11349,22652,17677,
+0,0,0,0,47966,1386,2342,0,0,0,0,0,0,0,0,10113,
+0,14451,0,18027,17768,0,0,25150,0,0,12886,34193,12764,3040,23102,23848,
+0,0,0,0,0,0,0,5296,33617,0,0,0,0,0,24762,0,
+0,0,0,0,0,0,0,22988,0,0,2838,9548,41002,0,0,0,
+0,0,0,0,0,4368,0,23330,22896,24940,0,27414,0,17937,0,0,
+0,0,0,0,9563,0,0,28700,0,3770,7933,0,0,0,0,3338,
+0,31619,41536,14799,0,0,0,12006,0,0,0,0,0,0,0,41927,
+0,0,0,0,0,35429,29569,26367,0,11798,29396,0,0,12702,0,0,
+0,3905,0,0,42182,28548,0,36980,0,0,0,6215,0,0,0,36347,
+0,0,9215,0,0,0,2073,15503,6412,31039,35542,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,10573,16809,21279,0,16572,12683,
+0,0,0,21219,0,6702,29262,0,0,0,31565,0,0,0,23234,0,
+0,0,0,10416,11831,0,34913,0,0,28514,0,5727,0,48145,0,0,
+0,0,18940,30260,41813,3329,0,32253,48011,0,0,0,0,33007,0,0,
+33581,0,0,0,43382,0,0,0,0,0,0,6158,5041,0,0,0,
+47271,0,0,0,23773,0,0,0,0,0,10281,5972,43448,11095,5606,12563,
+0,18170,48326,0,18363,26275,27221,44077,0,0,0,0,29734,17125,35828,36607,
+9189,42211,0,0,0,0,27454,33049,32504,0,0,0,0,0,14484,34049,
+0,0,24310,47760,35174,4356,0,17953,0,0,34320,46961,0,32846,43214,46001,
+48321,0,25427,21432,40912,0,0,0,0,9729,0,22872,18048,0,15285,0,
+0,0,0,0,0,0,19177,0,0,0,0,1764,0,0,21354,3030,
+40553,47020,40157,4545,20493,22169,0,0,0,0,32726,38589,0,0,34818,0,
+14554,0,0,0,19699,5683,17283,17376,40576,0,44807,3152,28951,0,0,0,
+31087,0,0,35410,33842,0,0,0,0,0,0,48849,9442,0,0,39748,
+17474,18070,8905,0,0,4178,6079,44364,0,0,0,9010,8479,0,22288,3273,
+1084,11104,47317,0,27198,24265,0,0,0,0,0,0,0,0,0,0,
+26122,0,39637,23290,0,11129,26217,0,1904,5006,11788,47109,0,0,43863,96,
+9345,0,27666,0,0,0,0,0,0,0,0,0,0,0,19237,0,
+0,0,0,0,0,28102,21167,10766,0,40960,0,0,0,1147,0,19341,
+31421,0,0,0,20474,21648,0,0,38865,0,0,0,0,0,0,22759,
+22875,23139,43811,0,0,0,0,0,0,0,3783,0,0,0,0,0,
+42636,18747,48790,0,0,0,0,0,0,0,0,0,0,16950,0,31583,
+37656,0,0,0,0,0,14253,0,0,0,39328,0,29951,0,4902,0,
+0,0,22847,0,3174,0,0,0,2903,0,0,32665,0,0,4053,25811,
+48421,8292,0,0,0,0,0,0,36173,0,0,46137,0,0,0,0,
+0,42441,0,0,33014,0,0,0,19340,9059,12841,0,24925,45040,12895,0,
+0,0,25122,0,37917,0,12823,0,0,3746,14357,0,0,0,12644,0,
+0,6586,8710,0,5826,0,0,16906,0,38866,0,0,0,0,39611,0,
+0,0,20961,4043,0,0,0,38806,5921,40206,0,0,0,0,10570,46647,
+0,0,0,0,0,46081,0,0,36859,44810,7434,35974,0,0,0,0,
+0,13334,0,0,0,4033,0,0,0,0,0,0,0,0,41405,0,
+43044,332,26480,0,0,12934,0,0,0,0,27789,35185,0,0,0,6774,
+0,0,0,0,0,0,21990,0,0,23812,33629,39565,441,5761,0,0,
+0,0,0,0,0,0,12932,0,0,0,0,0,21168,0,0,0,
+0,20920,0,4439,20734,31102,43419,31849,0,0,0,0,0,0,0,28151,
+39950,0,8172,0,19305,44348,0,26411,0,0,0,0,0,0,0,0,
+0,0,21634,13976,0,0,8724,40209,0,0,0,0,0,6071,6970,0,
+14702,19169,33772,36854,0,9893,0,0,9207,36234,0,6719,8114,0,0,17673,
+40038,47245,0,40601,0,0,0,0,2310,5329,47032,0,0,0,0,0,
+16135,23315,0,15061,0,0,0,0,0,0,0,19657,0,0,0,18539,
+0,0,25137,32810,0,18124,0,0,13745,0,0,0,0,0,0,13834,
+0,0,0,0,37339,0,46981,0,0,0,0,0,0,36052,0,0,
+0,0,41782,0,0,27977,0,0,0,0,0,0,0,0,0,0,
+0,36467,0,0,0,8933,47941,0,0,39176,43864,0,22232,15970,24232,15158,
+0,0,44015,23521,44208,48419,38638,22669,35385,0,0,0,0,0,0,0,
+0,48521,47019,39110,47590,48169,0,0,0,0,0,0,0,0,0,0,
+0,6917,13833,1679,0,0,25072,2156,0,0,0,27103,0,41082,0,0,
+0,10264,14671,0,0,37095,40286,0,6187,0,0,31905,27956,0,0,0,
+0,0,0,0,0,0,0,0,7232,13117,20339,0,44950,0,48546,0,
+0,0,26268,48044,0,0,0,0,0,0,19257,0,26585,29472,37057,0,
+0,42259,0,29921,46591,0,0,0,0,0,0,0,37460,47808,0,0,
+14064,24933,0,0,0,0,0,6699,31659,35400,0,0,0,0,2800,0,
+13303,0,46650,40734,0,0,23618,0,41368,0,2397,0,0,0,14989,0,
+0,0,0,0,0,33265,12309,46269,0,27217,1760,47936,0,0,0,0,
+0,1502,0,0,0,0,0,0,37826,38533,4456,0,0,9830,3246,45632,
+0,0,0,0,0,0,0,23976,14127,0,0,0,13907,0,0,0,
+44536,0,0,44054,0,0,0,0,0,24243,0,0,0,8157,0,16564,
+21836,0,14960,0,47809,0,0,0,0,0,0,43117,21181,26181,4045,0,
+33583,16228,0,19574,0,0,0,41181,15264,28044,47797,0,0,46032,0,0,
+0,0,0,0,0,42983,0,0,0,0,29589,5934,15825,22792,31377,0,
+0,0,0,0,0,0,0,27138,0,329,21350,0,38838,0,10163,8639,
+20224,41593,48489,0,35147,45993,0,48432,27918,0,0,0,0,0,1468,19345,
+40868,0,41044,0,0,0,41403,0,0,13988,0,15681,3669,0,34946,24451,
+0,0,0,36845,37399,38635,37721,48767,0,0,0,0,0,0,0,0,
+0,20612,0,0,0,24652,2500,0,17233,0,0,0,17406,44500,41215,0,
+34616,0,29357,12834,11612,15347,15876,0,0,0,0,0,0,0,35637,32476,
+0,0,0,0,0,0,29685,0,0,23730,7414,43223,0,7355,0,0,
+0,0,6275,4260,0,47530,0,0,29942,0,0,0,0,8420,0,0,
+0,3172,0,21608,0,0,0,0,31020,0,0,0,0,28405,1910,43057,
+0,0,0,0,22472,0,1410,15166,0,0,31161,0,0,0,34389,0,
+0,0,0,18509,0,0,17361,31224,0,0,4323,8045,40182,45152,0,0,
+0,0,0,0,17365,0,0,15611,0,38423,13686,0,0,28984,0,0,
+0,0,18064,38300,0,0,0,0,22811,0,0,0,35776,0,11790,12264,
+26133,31239,44651,0,0,0,0,3428,16351,36629,45168,0,0,0,37140,0,
+0,0,40826,0,0,0,0,23291,0,0,25285,16300,30993,0,0,0,
+0,7536,41144,6255,0,0,22960,0,0,0,0,0,0,0,31579,34831,
+44894,0,45782,0,0,0,0,0,0,0,0,0,0,0,30556,0,
+36259,23874,0,0,1022,0,0,0,24440,0,0,0,18629,10900,15971,11624,
+9988,39249,44617,1315,0,0,0,0,12358,0,0,0,0,0,0,0,
+1331,0,0,0,0,0,47723,0,0,33504,0,25486,0,1919,7604,37097,
+8012,16956,30316,47880,0,23775,0,0,37107,0,0,0,0,0,18325,24239,
+42918,0,0,0,269,19109,38965,0,24499,47440,0,47061,0,24596,0,0,
+0,0,0,0,32731,0,13999,0,0,3689,41626,0,0,9779,0,0,
+0,0,3153,686,14133,19386,0,24109,0,39375,0,11189,7771,44723,0,0,
+0,0,0,0,0,0,47511,0,19362,20104,0,0,0,0,0,0,
+32770,0,0,17158,28507,0,0,0,0,593,0,4076,74,0,0,0,
+0,0,0,0,0,0,0,20315,23345,0,0,3390,0,0,22786,2529,
+4744,6245,0,0,0,0,0,0,0,32622,0,0,21626,7301,20188,0,
+0,0,14955,0,2513,47773,0,0,0,0,0,22235,0,0,1319,1855,
+0,0,0,0,0,0,0,0,0,47848,0,0,0,0,0,0,
+0,0,0,0,0,14176,0,0,42029,0,40653,0,0,38134,10203,0,
+0,0,548,0,15135,0,0,0,0,0,16144,43599,32842,0,0,0,
+0,0,0,17370,0,3202,0,19172,0,0,0,2409,14625,19372,0,0,
+0,0,0,46151,0,0,0,0,13574,0,0,48332,0,17443,0,0,
+0,0,0,0,22979,44605,0,0,15839,26735,0,0,0,0,42170,0,
+0,0,21009,0,0,27379,29770,0,0,45695,0,0,832,0,0,0,
+0,479,0,0,0,0,0,0,9928,32292,6015,17127,0,0,0,14085,
+0,0,46717,0,0,39050,0,0,0,0,0,10792,0,0,0,0,
+0,7498,0,0,0,0,0,14030,0,0,0,0,0,29110,0,0,
+0,0,0,0,33456,0,41362,0,0,0,28794,0,0,0,0,29387,
+2927,0,0,0,0,46134,37914,0,20420,0,0,27805,44346,29819,0,0,
+0,0,0,33174,0,0,0,0,21792,45608,42915,0,0,10554,18587,48732,
+0,0,27857,0,0,0,0,0,0,0,0,0,0,0,0,27645,
+0,8192,0,18899,41610,0,0,0,18518,46861,13000,4595,28145,0,0,0,
+0,1322,0,0,15355,12756,0,8521,14427,0,0,0,0,0,11836,0,
+5756,0,46750,0,0,0,0,0,0,0,0,0,42886,24549,23045,28216,
+37543,0,0,734,964,0,21802,0,37762,23629,24645,0,43300,161,3207,18530,
+0,0,0,0,7614,12202,0,0,0,0,39167,0,10145,0,0,47675,
+0,0,0,0,0,0,14759,21519,36213,8031,33575,0,16435,17800,26895,12321,
+40326,0,34458,22671,0,0,30957,35948,7850,464,14340,17260,18390,38290,48431,48673,
+0,34482,0,0,0,0,14365,0,30381,0,0,37402,0,0,0,0,
+0,0,0,0,0,26306,0,0,0,0,0,29582,14154,1216,31944,42614,
+0,0,10046,45364,0,0,0,0,19227,0,0,0,0,0,34613,0,
+20725,42339,0,0,0,47050,0,23401,39252,10930,0,23386,2117,0,0,0,
+0,35495,48680,0,0,37607,13693,0,0,0,37282,6735,0,0,23920,9177,
+41066,46645,0,19979,0,2868,12231,15522,0,0,0,0,0,0,4077,11161,
+28303,0,0,0,45656,0,0,0,0,0,32364,0,0,0,0,36143,
+0,19512,0,0,10140,40659,0,29641,28970,0,46696,0,0,0,0,0,
+0,0,0,0,0,6803,0,12478,0,0,28339,11448,0,0,17232,25478,
+39601,17973,18958,19119,30770,32045,41740,0,0,31136,0,0,0,0,29823,0,
+0,0,12237,19798,0,0,0,0,0,0,37056,0,0,0,10450,14238,
+0,0,0,48442,0,0,0,0,0,0,11020,0,13106,0,42757,0,
+0,8664,0,40980,0,0,0,10745,46488,0,0,0,26263,0,0,1880,
+0,0,0,28258,0,29720,11962,10987,0,0,0,16653,0,0,0,0,
+47364,0,0,0,8781,0,0,27953,0,20084,0,0,0,10808,0,27249,
+0,0,0,0,44532,28878,0,36236,11998,43951,0,0,0,0,0,13102,
+14096,0,6232,0,0,0,0,5951,0,20534,46407,5343,7691,28306,18314,37876,
+37986,0,0,12672,14947,0,0,0,0,0,0,15525,0,0,37037,0,
+9249,0,6287,135,0,9077,0,0,0,0,37513,0,0,45306,0,0,
+22376,0,0,0,0,0,0,0,0,20001,36269,44027,40564,0,0,46527,
+45804,0,0,3488,4208,34401,25286,0,0,3781,10888,19320,34113,37292,41174,0,
+35423,0,0,45525,8895,0,18193,6289,43217,31147,0,0,0,0,0,0,
+0,0,31099,0,23404,0,0,9824,22341,8623,3563,10237,25722,33167,36017,0,
+0,16157,0,0,0,0,0,0,0,0,0,0,21950,30034,0,0,
+0,20154,0,0,0,43809,0,0,14840,0,0,47750,43474,6572,0,11669,
+37608,43897,26373,41295,0,0,16293,20691,4748,0,0,0,0,4234,7812,40948,
+28550,0,0,32482,0,0,0,0,0,0,0,0,0,5936,44227,0,
+0,0,0,0,0,0,40903,0,0,27824,0,0,0,0,0,0,
+0,0,0,0,40668,47045,9053,47384,13623,0,0,0,25475,0,0,36560,
+0,0,0,2604,0,3481,21787,18428,33003,34885,0,0,31656,0,48084,0,
+0,0,0,0,0,0,28434,35582,0,0,0,40067,38418,40619,0,0,
+20423,30005,0,0,0,0,0,0,48380,0,0,768,26346,30001,0,37353,
+0,0,32939,38471,0,0,0,0,0,17013,0,0,0,0,635,0,
+0,0,35408,0,7096,0,0,2860,0,0,0,43787,0,21118,0,45910,
+0,0,0,0,0,0,0,0,0,0,0,5637,33421,0,0,0,
+0,36900,0,45353,0,20408,0,12529,18805,25485,44016,0,47770,0,0,0,
+0,0,0,0,27393,21722,27131,0,0,21175,37523,0,0,43793,0,0,
+0,0,0,16109,0,0,45598,0,0,0,0,0,27569,35876,0,0,
+0,0,0,0,0,0,0,0,37213,0,16763,42256,0,0,299,9399,
+0,0,0,0,0,0,0,45411,0,0,0,0,0,38436,4502,24018,
+30200,0,0,0,19047,31360,0,13209,0,0,38037,0,41460,0,10998,0,
+32453,0,11096,24259,42945,0,0,28170,0,4099,0,0,0,0,0,0,
+0,0,22466,38994,0,0,0,0,0,0,30936,0,0,0,0,43389,
+0,0,0,0,0,17826,0,42485,0,0,0,37248,11954,20894,48095,26879,
+0,0,0,0,4603,0,0,0,0,57,11201,0,0,47359,0,22733,
+26865,0,16988,0,40695,0,0,0,42796,14932,15367,23076,30256,43341,37431,29388,
+23427,10894,33939,4484,48639,0,0,38368,0,0,0,0,15059,0,0,9334,
+15957,22828,29661,0,0,43962,0,0,0,0,0,1538,954,0,0,0,
+41109,5929,22990,37080,43791,22957,19350,47984,0,0,11761,485,0,0,13339,30537,
+40662,0,0,32077,0,0,0,0,8891,42413,0,0,44438,0,0,0,
+0,31132,3012,9538,37120,22688,46737,0,0,1053,26289,43679,0,0,0,0,
+0,0,0,0,0,0,16357,0,742,0,0,0,0,0,39700,0,
+23761,0,29629,0,0,0,0,0,46422,34771,26397,0,0,0,15817,24796,
+42859,0,0,0,0,0,28164,35744,0,0,0,7849,14258,0,0,4447,
+14963,19037,30142,12248,48509,0,0,24321,0,0,0,10656,15731,25104,30648,36904,
+0,0,0,0,36927,0,0,34363,6675,0,0,0,43846,4233,14021,0,
+0,0,0,0,0,0,19248,39356,40935,0,0,0,0,0,0,0,
+0,0,0,41866,22719,0,0,0,0,12306,0,0,23777,0,0,0,
+17040,27478,32662,33588,0,0,0,40797,42196,0,40563,0,0,26054,0,0,
+0,33267,0,0,0,0,23239,38105,0,0,8806,37583,0,0,0,0,
+0,0,4613,22680,0,15864,18255,21617,31244,21313,47080,0,0,0,19168,0,
+0,0,0,0,0,0,0,0,8516,13116,46581,47168,0,12051,5349,32206,
+0,0,41917,0,0,0,0,0,0,0,5893,0,0,0,0,0,
+24008,0,0,0,0,31202,0,0,0,0,0,13532,21853,0,0,12740,
+0,5916,0,0,0,26829,0,19670,0,0,0,0,0,0,4277,0,
+0,0,0,0,833,30252,0,0,21536,0,0,0,0,0,0,39918,
+8733,41434,0,25961,0,0,0,0,0,40150,0,0,0,0,0,0,
+0,44036,16345,0,32502,0,0,41125,0,9385,22032,7373,0,0,0,7015,
+0,0,16531,25499,0,0,0,0,0,0,0,0,0,14791,0,0,
+0,19497,5668,19736,0,0,0,0,0,0,0,0,0,47435,0,0,
+0,33853,0,22805,0,0,0,0,4470,0,22437,2033,24119,0,0,11899,
+0,7346,20832,39102,0,0,21135,0,0,47248,0,0,14962,0,0,0,
+0,0,6166,12501,45119,0,46953,0,0,0,14256,0,0,12704,0,0,
+0,0,45729,46666,0,2308,22787,36946,0,0,0,0,0,0,0,0,
+0,0,857,42034,0,0,0,0,48853,0,0,0,0,0,0,0,
+0,26695,0,0,0,0,0,0,0,21277,0,14633,0,0,460,33950,
+0,30578,24179,47469,0,0,0,0,16707,0,0,29412,36730,37316,0,0,
+0,0,8952,15828,38077,0,0,17504,38506,20268,2809,38647,44380,38074,36472,47820,
+0,0,36932,0,17531,10208,32694,0,0,1729,0,0,18370,0,0,4753,
+0,10851,0,39827,21643,0,0,0,19882,0,23411,32369,29216,9872,35056,14185,
+0,0,28607,0,17563,0,0,3455,7140,5210,0,0,39683,0,0,10540,
+0,28415,37182,0,5614,4221,0,0,0,0,0,21498,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,5399,0,0,16519,0,0,
+0,10050,31846,31997,0,0,0,0,0,0,0,0,0,35346,43700,0,
+27996,48648,13452,46681,0,0,44457,0,0,6968,34464,0,0,0,0,0,
+0,0,0,0,0,0,1854,22155,26720,41974,0,0,0,0,10433,0,
+0,0,0,19976,22080,0,0,0,0,35191,48409,0,0,0,15944,0,
+0,0,5877,0,0,0,10448,0,0,0,0,0,28953,0,18302,6258,
+34565,14056,0,3047,13888,11809,36165,29085,46691,0,0,0,0,0,0,0,
+0,0,0,26080,0,0,13093,10727,0,38459,46932,48656,36169,37163,46247,0,
+0,0,0,0,0,36314,40256,0,0,39760,0,0,0,0,0,0,
+21172,0,0,26878,12817,24990,27742,48796,0,0,0,40246,42265,44809,0,7315,
+10705,0,0,27676,0,12480,0,42121,19222,0,0,0,0,48162,0,0,
+19184,0,15188,35963,35034,0,0,37651,0,0,0,0,19236,0,0,1568,
+45507,0,0,0,0,0,33531,0,0,0,0,5839,0,30531,15516,0,
+0,0,0,41682,0,0,27771,41999,0,0,19000,0,9562,31867,18375,0,
+0,0,0,0,0,0,0,45140,0,0,0,9101,36585,0,0,0,
+0,0,0,0,0,2775,0,0,0,0,0,0,0,0,0,12196,
+0,38786,0,22033,0,0,0,0,0,9939,0,0,42210,0,37016,43150,
+5791,0,2127,17353,0,0,27902,0,0,0,0,24312,0,0,14396,0,
+0,0,0,29757,42009,0,35390,0,866,38787,0,0,0,0,45473,0,
+8495,30167,0,16272,0,0,0,0,17947,30764,0,0,45579,3896,24161,0,
+0,10136,0,0,0,572,0,0,0,0,0,44156,0,0,34189,0,
+0,0,45231,0,0,0,0,0,13942,0,0,0,0,20577,0,32603,
+42956,22849,0,11021,7570,11480,16077,27691,37471,42164,42936,42941,0,0,0,0,
+0,10135,14175,0,0,46732,0,0,0,0,0,0,0,0,48170,0,
+0,0,0,0,0,0,43083,0,0,0,0,0,0,0,22327,37199,
+0,0,20614,31612,0,0,0,10160,0,0,0,0,0,0,28578,44524,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,40106,14091,15180,41748,42298,31938,43895,45649,0,0,32423,0,0,0,0,
+0,0,0,0,0,0,37834,4075,0,0,0,42233,0,0,0,2683,
+0,0,0,28785,39916,0,45960,34020,42175,1212,11884,46373,47337,0,0,0,
+0,0,0,0,0,0,7939,0,0,0,0,0,44047,10513,10071,0,
+17570,271,0,1601,14017,1685,5831,26574,0,37933,0,0,0,38858,0,0,
+0,0,45046,0,18211,3568,44338,0,0,0,160,0,0,0,9136,11056,
+28252,17961,23296,33944,38581,0,0,0,11767,39975,0,0,20470,34813,0,0,
+0,0,32896,0,0,0,0,8275,29084,0,45515,8976,0,0,0,0,
+0,0,0,42857,0,0,0,0,0,0,26756,23938,0,0,0,11026,
+29903,0,0,0,0,1700,0,0,0,0,0,0,38963,0,24098,0,
+0,0,0,0,0,34915,0,0,0,0,0,0,0,17910,0,0,
+0,0,0,0,0,2147,30089,0,0,0,0,0,0,10706,0,0,
+0,23373,24777,6236,23202,3898,23829,7348,8704,25437,28287,38055,0,0,0,0,
+0,0,0,0,0,0,6692,0,0,0,33707,0,24004,6900,0,0,
+0,0,36014,0,0,0,9533,26021,0,0,0,0,7310,0,0,0,
+0,0,38476,0,0,0,36529,0,0,0,24640,0,0,0,0,0,
+0,4718,47049,20234,26861,0,0,0,0,5639,7473,0,0,0,0,0,
+0,0,0,0,0,0,0,35442,0,32438,0,0,6197,0,29433,0,
+0,0,7407,5493,28160,0,0,32975,0,0,0,26984,0,24552,33689,47866,
+25319,36792,0,9846,27347,0,0,43181,38500,0,0,14530,37069,0,41358,0,
+0,4161,0,23350,9716,48358,14935,0,0,27355,0,34269,0,0,0,0,
+0,13105,45796,0,0,0,0,38363,29369,7608,0,0,0,0,0,0,
+0,0,0,0,0,18879,0,0,0,31139,17762,0,0,41736,0,0,
+4821,0,23016,44931,0,0,0,0,9173,0,0,0,0,37177,41589,0,
+11719,0,37426,0,4493,35021,0,0,0,0,0,0,24214,0,0,0,
+0,0,0,22158,0,0,6264,0,0,0,4807,0,0,0,0,0,
+42340,0,4898,0,28511,0,11454,0,42440,0,4786,33443,0,0,0,34782,
+0,0,28265,21858,0,0,37368,0,34954,0,0,0,0,0,15340,27301,
+1097,0,9908,0,0,0,27174,0,0,15651,38318,38583,40003,36967,46327,24643,
+0,0,0,0,3800,0,6030,0,0,0,0,0,0,43339,0,23957,
+0,44628,43639,0,0,0,25219,0,27140,0,0,6931,7479,14750,0,0,
+0,0,0,0,0,15479,21467,0,0,0,7697,0,0,0,7518,0,
+0,0,0,0,0,0,0,0,10699,9961,0,0,44662,3971,16542,17802,
+8579,15901,268,14469,39209,0,46996,39346,39570,48286,45241,15304,0,0,24184,0,
+39033,35754,9527,6755,0,20200,32558,0,23116,1329,0,0,0,0,0,0,
+29945,0,0,27917,0,0,0,0,12277,0,0,0,117,24522,25000,0,
+0,28238,17076,44482,0,0,0,0,0,0,0,0,0,30749,20265,15788,
+20891,0,0,14129,28822,42924,39112,44841,0,0,0,3997,6740,18690,0,0,
+0,0,0,19477,0,0,0,0,44526,21915,0,0,0,14769,0,20402,
+0,0,0,0,0,43572,0,5235,0,0,11287,0,0,48103,24620,0,
+0,0,0,0,0,47128,0,0,0,0,0,0,36646,0,0,0,
+40163,0,0,0,22259,0,0,959,0,0,32742,0,1373,30755,46053,0,
+0,0,0,0,0,0,39908,0,0,0,520,42328,26845,38880,45151,0,
+25539,31321,10870,48269,0,0,0,122,1037,14163,48640,0,44087,0,0,0,
+0,0,0,0,42489,37684,38441,0,0,0,37038,37486,0,0,0,14167,
+0,43322,0,0,14315,0,0,0,0,0,0,31961,40274,0,6281,0,
+0,62,14211,0,0,0,12411,0,0,0,6738,16872,0,0,0,28604,
+44546,0,37094,24840,867,13961,0,32431,0,30213,0,0,0,32417,0,0,
+0,29966,0,4711,0,7528,0,0,0,0,0,0,0,0,0,24331,
+0,38847,0,6985,12320,36930,39857,0,0,0,0,0,0,0,0,0,
+0,0,33663,0,0,41348,14346,39409,0,29199,37044,0,0,0,0,0,
+0,8893,4797,0,0,0,10761,30786,0,0,0,45463,0,13462,0,0,
+0,0,0,0,0,3424,24944,0,26727,0,0,0,0,11762,12385,46960,
+6447,0,0,0,19095,10975,26642,26702,0,0,0,0,40159,0,0,0,
+25420,0,0,0,34594,42487,0,0,0,0,35404,0,0,0,0,5146,
+8576,10963,0,0,39884,0,0,0,0,0,39522,0,0,26260,33333,0,
+0,0,18357,0,0,0,0,0,0,0,0,0,0,0,0,15698,
+34262,8342,29899,8319,0,0,0,0,13157,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,34883,42383,0,0,
+0,0,0,25074,0,0,0,0,0,0,0,14997,0,0,0,0,
+11940,27035,0,0,0,0,0,34374,0,0,0,41187,41753,0,0,0,
+0,0,0,23776,27177,24436,0,0,0,32075,0,0,34526,0,0,0,
+0,0,0,34718,0,0,38625,0,0,0,0,2782,3680,5130,0,0,
+0,0,23902,0,0,1272,33962,12840,0,18054,0,3492,14181,30579,0,13791,
+15392,26774,43909,0,0,0,0,0,0,17168,0,5045,40406,38685,0,0,
+12855,7564,0,38154,0,0,0,0,0,0,18900,43701,0,0,21883,0,
+0,0,0,0,40752,41533,0,0,0,0,0,0,40887,0,0,0,
+0,20173,0,3775,13885,11033,0,0,38578,0,3795,29264,34643,180,0,0,
+19252,0,0,17338,0,0,0,0,0,0,0,20593,0,0,0,0,
+0,2832,36424,48197,28509,40742,0,0,0,0,0,0,0,20314,19767,30263,
+0,0,28311,0,39935,0,0,0,0,0,0,45101,0,0,0,0,
+26964,0,0,0,0,0,0,0,0,0,0,0,0,33281,0,0,
+0,0,0,0,7710,14247,36582,1495,0,0,0,42609,2344,0,992,0,
+0,0,0,9054,0,0,0,0,0,22907,39238,11622,43754,0,0,20169,
+3583,38569,48696,0,2178,2889,38097,0,0,0,0,0,29326,0,7292,24592,
+0,0,0,0,0,5467,15030,0,0,0,0,0,0,0,0,31200,
+0,0,0,0,14241,35795,0,0,14139,0,0,0,0,8347,47787,0,
+0,22894,46685,25336,0,12780,0,0,28048,0,0,0,0,0,0,0,
+0,13927,0,4314,0,44720,47130,0,0,0,46557,0,0,0,41516,17825,
+7871,43122,47639,0,0,0,9690,29325,43964,0,10886,6389,3449,10175,32407,43486,
+0,0,10179,0,42252,0,0,0,0,0,0,2199,33422,0,0,0,
+0,0,22835,0,0,0,21786,0,0,0,25385,43027,7647,0,0,0,
+0,25020,0,0,0,0,0,12802,0,24430,44419,22613,0,0,19809,0,
+27497,0,0,46310,31641,0,45359,0,0,0,22365,0,0,0,0,0,
+0,0,0,22425,20890,25500,0,7504,0,0,0,0,0,33418,0,0,
+0,2016,10026,14559,41288,0,0,2717,0,0,24407,3629,4989,42733,6837,7961,
+0,0,0,17080,0,0,0,0,0,24152,0,0,15524,0,0,0,
+0,21570,39753,0,32907,6099,39332,6757,45116,34180,47932,0,0,0,0,0,
+17219,34060,35586,36715,0,0,0,14846,9804,25617,14116,32544,0,0,2216,0,
+0,0,14503,33059,0,34904,48055,0,0,0,0,5910,40055,0,0,0,
+0,0,0,32764,0,0,0,26716,31871,0,34428,35549,0,420,10529,29672,
+0,0,0,0,8072,0,29119,0,0,0,17782,0,0,28025,32204,0,
+0,0,0,0,0,0,0,24188,0,28642,0,0,2257,5429,9943,14510,
+24111,42887,44296,19402,36510,0,0,0,19096,0,0,22505,31584,0,0,0,
+0,0,22034,0,38820,0,0,0,0,0,27886,29050,0,0,0,0,
+0,22450,0,0,32996,0,0,3370,0,0,32058,0,38240,29516,0,0,
+0,0,0,0,5577,18743,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,41543,45555,0,8403,0,0,0,0,15620,38062,0,
+0,0,0,0,0,0,0,0,0,0,0,0,42588,0,43586,0,
+34630,0,27132,0,1773,0,0,27154,0,0,39161,0,18937,0,0,33220,
+0,48357,17319,2607,0,0,0,31909,34074,0,43975,0,33965,0,0,0,
+25944,0,0,0,30469,0,0,0,0,0,0,0,0,0,0,24104,
+44258,27473,0,0,0,0,0,0,0,0,0,18689,20797,0,0,0,
+0,22299,0,0,0,0,35860,0,0,0,0,42667,0,0,2980,7557,
+18335,35282,33722,33039,39544,33788,2761,0,0,33700,35000,0,0,0,0,0,
+0,36621,0,0,18955,0,0,0,0,0,0,0,15011,40542,4931,0,
+0,0,0,0,13578,9645,39608,42825,0,0,0,0,0,0,32114,0,
+5611,0,0,0,0,0,32284,3369,0,40829,46123,13217,34506,35374,9500,0,
+22577,14715,19562,9454,41996,44539,10829,26680,0,0,0,0,0,6413,8760,11770,
+13862,0,0,0,0,0,0,0,31805,0,4401,0,28957,0,19134,0,
+23157,0,0,0,0,2987,23863,16703,1731,0,41818,0,0,0,46261,0,
+0,0,0,0,0,0,0,0,10516,0,0,0,0,0,0,0,
+30935,0,0,34908,8197,0,33318,0,0,0,0,0,0,5012,0,0,
+0,0,0,0,8284,42708,0,0,0,0,21074,19079,0,0,46610,36953,
+38464,24713,36544,47980,0,3925,23465,0,0,0,0,0,14819,14649,152,27811,
+0,0,0,0,4092,0,0,15287,20532,23568,13694,19375,0,0,0,0,
+0,0,0,34839,0,0,0,0,40975,25911,24219,0,0,0,0,0,
+18803,29042,45288,0,0,12712,44491,0,0,0,45604,18010,19391,0,0,0,
+16851,16136,45222,0,2060,0,0,14520,12806,2345,20403,35631,32233,8411,0,27326,
+0,0,0,24170,19686,0,0,23079,0,0,6088,0,11469,23880,0,8474,
+31836,40951,0,6465,0,9935,0,0,0,0,13204,0,0,13202,3463,0,
+0,0,0,0,0,6303,0,0,43011,0,0,0,0,14422,18897,0,
+0,0,0,41023,21520,2947,21238,22881,28080,0,351,0,0,0,0,0,
+0,0,0,5236,44291,0,0,18406,0,0,0,0,0,40224,0,0,
+0,0,0,29571,0,18231,0,42735,0,0,0,0,0,0,0,0,
+0,0,4140,0,0,0,0,11292,0,24614,0,16578,27999,0,0,0,
+46255,26905,20258,23328,38746,46535,47468,0,0,0,0,0,0,0,0,0,
+0,20010,0,0,0,0,14521,0,0,15163,0,0,0,0,0,0,
+0,11262,0,6327,24963,18884,0,0,18657,0,0,33532,43479,15497,30107,10231,
+26478,0,0,0,0,0,0,39027,42190,0,0,14323,0,0,0,0,
+0,2578,0,0,0,13374,0,26156,0,0,0,0,0,0,0,17688,
+29772,38168,0,0,0,0,29339,38348,0,47319,17663,45548,42283,0,0,36438,
+0,21286,21293,0,0,0,17904,0,35105,25628,23764,27039,11542,0,0,0,
+14604,0,0,0,0,23804,10860,25471,0,0,0,0,0,13418,0,0,
+2994,18059,4489,0,0,0,800,29753,39648,0,0,0,0,12122,46520,0,
+0,0,13104,0,0,0,0,16768,0,0,0,4530,0,0,48160,0,
+0,0,0,23907,0,43613,0,0,0,0,0,0,0,16687,0,0,
+0,0,0,32712,43450,0,0,0,0,0,0,0,0,0,8737,29735,
+29378,29818,48388,0,0,0,20054,0,16304,0,35071,0,0,18148,36429,22438,
+45740,0,0,0,0,0,0,0,0,2892,14086,33464,31240,25751,33065,0,
+23742,0,0,0,0,0,0,0,15236,0,16454,2976,44278,0,0,0,
+21235,0,17742,45482,0,0,0,31156,0,0,0,5266,48390,37358,0,40941,
+31501,32921,0,47544,0,0,0,5960,44555,14912,28185,0,0,0,0,0,
+22335,0,0,12739,0,0,0,15498,0,3326,17450,46441,0,0,0,0,
+4179,28844,22645,0,0,0,30405,33807,0,0,31616,42446,8974,0,0,0,
+4457,27845,748,7259,8104,36359,0,0,0,0,0,0,4192,0,0,0,
+0,0,0,9506,18106,0,0,30204,23409,27447,0,0,0,13460,42652,0,
+196,0,0,0,19733,44184,0,0,3687,0,3475,14450,10029,0,0,0,
+0,0,0,0,0,0,43345,8435,39889,47568,0,6274,42744,0,0,0,
+0,0,0,0,0,0,0,48368,6150,0,0,0,0,0,0,10636,
+0,0,12837,19561,0,0,0,0,0,0,19959,14523,26863,27197,0,34365,
+0,20685,0,29751,8770,9633,0,7151,0,0,37425,0,0,0,0,0,
+0,31789,0,0,35836,0,0,0,0,0,0,0,0,0,0,0,
+5775,0,18265,35235,0,0,0,46659,0,38117,17293,22342,0,0,15867,125,
+14532,21531,0,0,0,46770,0,0,0,0,27716,31892,41851,0,15101,0,
+0,0,0,23419,0,6609,0,1608,0,0,0,0,0,39897,35285,45590,
+0,0,0,0,0,0,0,0,0,23295,29694,14107,29623,0,0,0,
+0,40943,41768,0,0,5948,8945,0,46893,0,0,0,0,0,3379,7125,
+0,0,0,23364,26379,0,0,0,0,0,25025,0,0,0,41544,21751,
+0,0,44315,47850,0,0,43054,0,20045,3900,19143,36039,34921,2093,0,39289,
+0,0,0,0,0,0,8842,0,24435,0,0,0,14330,33536,12960,7332,
+0,0,0,3647,16067,47353,0,0,4562,0,0,0,20358,37702,0,0,
+0,0,39773,13540,40031,46766,702,8228,32759,25217,24327,28446,0,0,41079,0,
+0,15,0,0,0,0,0,0,0,0,0,0,32822,48625,6824,0,
+0,0,10079,0,0,0,0,46639,0,0,32727,0,2629,0,0,11597,
+16865,385,32594,0,0,0,0,35146,39002,2756,11409,0,0,0,0,0,
+31445,0,40600,0,40323,0,20755,0,0,0,0,0,39747,22501,17046,0,
+25044,32886,26892,5018,0,0,0,13121,41700,0,0,0,5101,13533,0,42840,
+0,3190,27144,17757,0,0,45838,0,29545,36038,37194,0,0,0,0,0,
+6310,0,15483,0,0,17166,27274,46022,0,288,31251,0,0,0,32729,0,
+1519,0,6973,0,0,25110,37803,909,23187,0,14965,21384,0,0,0,0,
+0,0,0,0,26416,0,0,0,0,40140,9227,0,0,0,0,0,
+0,1285,19643,0,0,2627,2718,0,0,0,0,141,0,0,17095,22962,
+25637,0,0,41731,46516,14196,140,34159,0,0,0,0,0,0,0,21565,
+0,0,0,5602,10825,13678,35882,46537,0,0,40225,0,0,0,2638,20526,
+615,0,0,0,0,28256,0,0,36402,0,0,12527,30046,0,0,0,
+0,0,0,0,0,0,0,0,6171,7934,28481,3541,27697,0,0,0,
+0,0,0,0,0,44218,0,0,0,0,0,10034,30913,0,0,20840,
+0,0,40781,0,0,36581,7532,2969,0,0,20030,0,0,14428,7698,0,
+0,0,0,40837,16440,29491,0,0,39696,0,0,31364,13317,0,0,0,
+0,0,0,0,0,29130,0,11746,0,35760,37921,40033,0,30172,0,15784,
+0,0,0,22684,37883,45521,0,0,30752,0,0,0,0,0,16050,0,
+0,0,0,48760,46837,0,0,7089,0,16899,40588,0,0,24459,0,5419,
+0,0,0,21845,25909,0,0,34163,42134,42519,46616,0,0,0,19910,44666,
+45897,0,33490,0,0,41497,0,0,0,0,0,0,0,47744,0,0,
+33178,41767,15809,0,16548,0,0,0,0,0,0,0,0,0,0,0,
+27823,19407,33872,45486,0,0,0,0,0,3218,0,0,0,7746,12913,44533,
+0,0,0,18854,0,0,0,0,3165,0,44679,0,0,0,0,0,
+47601,0,0,5423,0,0,0,0,0,0,46675,0,0,29968,0,0,
+0,0,0,0,0,15358,0,9419,45068,0,0,0,18839,0,0,0,
+6886,29086,17240,0,0,34309,0,0,0,37946,0,0,0,0,13723,43893,
+16631,21653,42942,0,0,0,0,42600,0,16602,0,10943,0,0,0,0,
+0,0,16161,16683,21197,0,0,0,26198,37226,22490,662,39093,37693,42250,27883,
+0,0,0,5950,0,47958,0,21222,0,0,0,0,0,0,0,0,
+0,44899,11958,43232,38744,0,0,0,0,0,0,0,0,0,0,38310,
+0,0,0,0,38482,42109,0,1187,0,15157,0,39962,23335,0,28605,8489,
+0,40699,0,0,0,0,6627,14587,0,0,0,0,0,0,17676,13305,
+41095,0,0,39285,0,37873,0,15877,6487,39301,41450,0,0,0,0,0,
+37052,28009,0,44476,0,35459,14359,17851,46451,43853,0,9065,23793,43039,0,0,
+0,0,0,0,0,0,0,0,0,37062,0,0,11975,0,0,0,
+0,0,0,0,0,10285,11391,0,0,0,0,0,0,0,0,0,
+0,0,6038,1977,13852,40735,0,0,0,0,22730,1872,0,0,0,0,
+0,17621,0,3895,0,0,21504,0,0,0,0,0,4759,6977,6495,5718,
+0,0,47913,0,0,0,0,0,40971,0,0,37620,0,0,0,0,
+0,0,0,0,0,0,0,0,24897,27213,27255,36483,0,0,0,20926,
+0,0,0,0,0,0,0,43608,0,0,0,0,0,27903,20581,0,
+34935,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2049,18478,33155,32470,0,7568,41112,35826,22481,35796,47857,0,0,28073,36902,39749,
+0,0,0,0,0,6761,0,0,0,0,38521,38889,0,0,0,0,
+0,0,0,0,0,0,0,45724,0,0,0,0,0,0,0,0,
+0,0,0,45613,0,1714,0,28071,34065,19153,23441,32198,26539,38855,47703,0,
+0,20572,0,0,23956,18821,0,0,0,12311,26788,0,17638,0,0,14350,
+8615,0,0,20219,18549,0,0,14966,0,0,0,9676,17810,0,0,15917,
+0,0,0,21571,34271,0,0,0,0,0,0,40802,0,0,0,12444,
+23008,24983,47277,0,0,0,8146,19481,27023,37013,39999,0,0,0,0,0,
+0,0,1875,19584,0,13173,41331,0,0,0,0,48374,0,3797,0,0,
+0,6424,0,0,25187,47382,0,0,0,37105,9736,42293,0,0,0,0,
+0,0,0,0,12751,0,37495,0,11605,4450,0,0,0,0,8093,23466,
+25543,11124,0,0,0,0,39400,0,47018,0,0,21117,0,0,0,0,
+15995,0,0,0,0,0,0,0,0,0,5408,0,0,0,16275,17552,
+0,0,0,19918,0,36152,0,0,36772,10871,20826,0,0,0,1452,0,
+1357,8094,31328,25446,0,0,0,29866,0,0,0,0,0,0,0,6858,
+44833,0,0,0,0,30454,0,10743,0,0,0,0,710,0,0,0,
+0,0,27614,43469,0,0,0,0,2170,0,0,16805,0,0,33041,0,
+0,17067,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,26758,15983,0,0,10534,6438,0,0,0,0,0,23672,
+0,7700,0,0,5898,0,0,240,0,17801,47134,0,0,0,0,0,
+0,0,0,19847,0,34671,33997,0,0,0,45814,0,7945,17803,28189,43968,
+0,9146,0,45403,0,0,20888,0,6383,4082,0,0,0,0,0,0,
+0,26035,0,0,1715,33864,0,25987,0,0,18663,9665,0,0,0,0,
+0,0,0,0,0,3789,45311,27790,0,37578,43142,30350,0,0,0,38206,
+44785,0,0,0,6199,0,35222,0,0,30137,16455,0,0,0,33044,45916,
+16226,0,0,34157,41867,0,0,5135,39784,0,0,0,0,0,0,0,
+14882,28383,29709,28268,38901,43301,0,27318,29175,6816,0,0,0,36684,47862,6460,
+8499,0,0,22167,0,0,0,0,42158,0,48078,0,11008,16023,20578,26955,
+0,0,0,13167,31465,0,7452,0,0,0,31177,0,0,0,0,0,
+0,6762,12276,11479,19032,36536,34923,0,0,0,0,44155,0,0,7484,43277,
+0,0,9058,11089,23652,0,0,0,0,0,31490,0,0,0,0,0,
+0,0,5357,14594,41322,36295,5333,0,7405,0,0,46230,0,23835,16824,26804,
+42930,44690,12595,12292,47261,35740,0,0,0,0,0,0,0,0,0,0,
+0,0,9319,0,37969,47197,27648,28518,0,0,6230,0,0,0,0,0,
+2404,19457,0,7848,24926,0,0,0,25476,306,0,0,5647,0,0,3245,
+0,0,0,0,0,0,29497,0,0,0,0,0,0,42429,0,0,
+0,4229,0,0,0,0,0,0,0,0,0,44582,0,0,0,46594,
+0,0,8514,33139,47907,3581,10847,16347,36369,0,0,0,0,0,0,0,
+0,18420,0,0,0,2422,6419,0,43157,0,8180,0,35382,40843,39977,0,
+40737,0,950,0,0,0,0,23699,0,0,0,0,23106,48766,0,32338,
+0,0,0,0,23002,22975,24813,31795,0,0,0,0,0,0,0,0,
+0,0,0,43621,0,0,36003,19262,37854,43400,0,25097,46235,32380,0,0,
+38339,0,0,0,0,40769,0,0,0,0,0,0,0,0,0,0,
+0,0,0,7371,12087,2824,0,0,0,12912,40866,9984,40973,36300,0,12409,
+0,0,0,0,0,0,0,0,0,37674,0,12111,0,45510,473,19077,
+31361,0,0,0,0,23041,41355,0,13271,0,37369,0,0,29306,40726,0,
+46950,0,3702,0,27485,0,0,18645,38405,46806,0,0,44181,0,0,0,
+0,0,5615,0,0,0,0,0,36267,0,0,0,0,0,0,0,
+0,0,0,0,0,18256,0,0,0,0,0,30663,47911,0,20336,0,
+0,7643,0,0,26015,0,0,1086,0,0,36171,0,0,0,0,31008,
+0,0,5326,0,47293,0,0,0,14055,0,7869,20628,5865,0,0,0,
+0,0,0,28552,0,45391,3213,20657,0,0,16373,0,0,0,0,0,
+0,0,34005,11243,15375,0,0,0,24476,31703,0,0,0,24513,32168,319,
+30119,16606,29147,37289,47846,0,0,36124,0,0,3617,0,0,0,0,0,
+22190,2674,12293,0,0,0,9504,18906,25249,0,0,0,21624,0,0,0,
+32980,0,3395,0,0,0,0,0,20500,0,8065,0,46232,0,0,0,
+34539,0,0,0,0,27914,0,0,42031,0,0,36829,0,0,12906,0,
+0,0,0,18489,0,48469,0,0,0,39624,0,0,18477,7267,17455,34888,
+34607,0,0,0,0,42625,0,3611,0,0,0,0,0,0,0,0,
+293,11151,46200,16878,0,0,0,0,0,0,18998,0,0,0,0,0,
+0,0,1040,35343,9097,30081,0,0,0,0,0,0,31394,0,0,33828,
+0,0,39771,25852,0,38814,44499,0,11625,22826,30715,0,0,2357,0,17842,
+0,13134,13378,45795,46158,47185,25481,0,0,0,0,0,0,0,0,44970,
+0,0,2106,35217,46797,0,17569,28855,4214,8459,10650,23438,33587,0,0,381,
+0,0,15318,0,0,15031,0,0,0,0,0,29660,0,0,0,11119,
+0,34500,41590,0,0,45801,0,0,0,12737,23600,29848,0,0,0,0,
+13419,35695,0,0,0,0,0,0,0,0,5241,0,0,0,0,0,
+37589,0,11383,0,43332,21720,0,13757,0,0,0,0,0,0,0,33574,
+0,0,0,0,0,38275,0,0,0,19692,35218,0,0,35198,46028,0,
+0,13289,0,0,0,0,0,0,0,0,1690,46316,0,19762,0,12060,
+0,0,2810,0,6400,0,38285,47695,7680,0,0,0,30789,0,0,22270,
+0,0,0,0,26542,0,0,0,18058,0,0,11126,0,0,0,0,
+0,0,0,0,0,0,35386,0,0,0,0,0,0,0,0,0,
+0,0,0,32672,0,0,0,0,4167,20935,4526,0,15764,10859,0,0,
+0,48331,0,0,10040,0,0,0,0,0,14603,0,0,0,44897,0,
+12549,0,0,0,0,0,0,0,0,0,18282,10199,18322,0,0,0,
+45866,0,0,34149,0,0,0,0,21871,41873,0,25206,0,0,0,0,
+15155,31066,0,0,0,0,32982,0,0,0,1844,24114,0,0,0,0,
+0,0,0,0,0,0,0,0,13536,0,0,0,3366,40970,26418,0,
+0,0,0,1012,0,15146,0,11373,0,5046,0,0,0,23908,0,0,
+0,30101,0,41661,0,0,0,0,26240,0,0,0,42736,0,39037,41412,
+0,0,38650,38683,0,0,2719,10672,20781,0,0,28560,0,0,0,0,
+20738,39508,0,0,0,0,0,0,0,0,24900,0,23514,43284,0,0,
+0,0,38084,31254,40605,0,0,0,8801,0,0,0,0,0,0,0,
+0,0,18719,0,5097,0,19604,0,0,4875,27630,22346,0,0,9797,35179,
+7277,33851,0,0,0,0,4847,0,0,14626,0,0,7320,0,0,44978,
+0,44163,38067,0,7825,0,0,0,30891,46824,21793,0,0,0,0,38351,
+0,24138,12507,10891,0,0,0,0,0,0,0,0,0,24595,0,12318,
+0,0,0,0,0,0,0,42949,0,2841,0,0,0,0,0,43445,
+0,0,0,47682,46935,0,0,0,0,3409,1543,27048,36576,44165,5860,0,
+0,0,43481,0,11627,0,2940,29247,0,25046,0,1589,10260,39871,43484,0,
+0,35305,36024,18017,0,48210,0,25184,5311,8410,0,0,0,8288,34011,0,
+0,23985,0,0,16625,0,0,0,0,43705,21368,0,0,0,0,0,
+0,31404,38017,0,18554,0,39244,16662,42966,0,10414,10879,0,0,0,0,
+0,0,0,29578,3257,0,0,0,7304,36591,0,0,0,11055,27556,20570,
+31062,0,33486,0,9769,0,14761,0,0,0,43226,35301,45713,22587,11049,0,
+0,2050,0,34337,20040,14996,0,0,0,0,0,13516,0,1396,0,0,
+0,0,3504,4537,46715,0,0,0,0,0,0,11570,41283,0,44977,10577,
+31900,7001,48318,38103,8036,0,37160,0,3028,0,8814,0,10780,0,5578,0,
+0,0,0,0,0,0,0,0,0,41473,0,0,0,0,0,0,
+7362,19537,0,9771,13423,0,0,21388,42095,0,0,0,34596,0,0,34870,
+0,0,0,0,0,35600,11816,0,0,17882,19715,42920,10156,30191,42162,0,
+0,16470,0,16315,0,0,10973,0,0,0,39917,48027,0,0,8689,29759,
+45172,0,0,0,0,0,0,0,21035,0,0,35518,0,0,0,0,
+0,0,0,0,43834,0,0,5054,0,0,0,0,0,8090,0,0,
+0,24694,0,0,0,0,0,0,16195,0,0,4411,0,0,0,818,
+0,28611,0,0,0,0,781,20180,0,25778,0,25147,7150,10183,40205,0,
+32150,0,28889,47667,0,0,0,0,0,0,0,0,0,0,0,5700,
+0,0,0,0,0,0,24953,24485,39387,0,42104,0,3181,38355,0,0,
+37366,0,47679,0,35763,25515,18176,0,0,0,46668,38600,48512,0,18448,0,
+0,0,0,29218,0,3683,12566,17895,0,8267,0,0,41906,40020,0,17596,
+0,0,0,0,0,0,0,26207,0,25967,0,0,0,0,42218,0,
+24374,0,2535,0,0,0,17526,23565,46385,0,15193,36371,0,42721,10393,14404,
+31211,28848,10384,0,25344,43063,45124,0,38400,15435,0,0,0,0,0,26228,
+8983,9898,30306,0,0,0,0,22277,0,0,0,0,0,21310,0,0,
+0,17355,21821,30296,0,0,0,0,0,0,0,0,0,20448,43535,18614,
+0,0,0,27368,447,0,0,0,0,0,0,0,43355,43053,29299,0,
+0,19613,11513,0,0,27030,0,0,0,8554,41617,0,0,0,0,0,
+0,0,0,0,18004,25304,15782,21367,27833,47443,0,0,39751,0,9331,27962,
+0,31661,0,0,0,0,11154,4506,8408,12467,30971,0,0,14922,11877,24642,
+0,0,25239,20758,0,0,27100,11336,0,0,33682,0,0,0,0,0,
+32542,32048,0,9199,0,0,23559,0,0,0,0,7470,0,0,0,0,
+0,0,0,0,0,0,0,18127,36223,0,0,0,0,0,12336,0,
+0,37966,0,0,0,4668,35098,0,22398,0,31157,0,0,0,0,0,
+0,0,14828,23706,41398,0,39396,0,0,0,0,0,0,0,0,0,
+0,0,27966,0,0,0,30147,0,0,0,0,11501,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,445,27110,0,14631,8777,0,
+0,0,0,0,0,0,0,5958,0,0,29763,0,29524,0,0,0,
+0,0,5211,0,0,0,2932,0,0,23168,0,0,0,0,0,24117,
+14768,45477,0,0,0,28879,0,0,0,1767,0,15098,212,0,0,0,
+0,0,0,0,0,39717,0,0,0,19556,0,0,9003,0,0,0,
+0,0,0,0,7393,0,0,0,0,0,0,0,0,0,4567,42483,
+6722,21681,0,30613,9076,809,0,0,0,19164,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,41081,0,40372,13437,0,0,47573,35805,
+25842,0,0,21037,46376,0,0,13076,39792,0,0,0,19293,32328,35157,0,
+0,0,0,0,0,0,0,0,38023,0,11131,0,47086,0,0,0,
+0,0,33108,0,0,0,47479,0,0,0,0,4658,18229,937,9198,0,
+0,0,0,17497,0,14638,0,0,0,45702,48212,0,8432,1988,44415,0,
+0,0,28815,0,0,8884,0,0,18139,22664,35902,0,0,0,2577,8210,
+26762,14295,28697,0,283,0,0,0,0,0,7219,9465,0,0,16654,0,
+0,0,0,0,40582,37138,0,0,0,5638,30919,0,0,0,16187,11475,
+0,42261,0,0,32969,0,46523,16746,0,0,0,0,42892,43285,0,39108,
+0,14692,0,29668,0,30455,0,0,29243,20318,20974,27555,0,0,0,0,
+0,37043,0,0,0,0,20775,28409,0,39263,0,0,0,0,0,0,
+0,0,0,0,0,8473,0,0,0,7859,0,0,12550,36832,0,0,
+0,0,0,0,0,10962,6575,21137,39087,35349,0,0,16168,780,16476,0,
+21750,0,16760,40859,36994,28860,47554,0,19741,10234,0,0,0,24391,0,39364,
+13804,0,45308,0,44603,45518,0,8765,16172,0,20123,0,0,0,0,0,
+19836,0,44933,0,0,0,0,0,0,0,28364,0,0,0,0,0,
+0,0,0,0,27275,0,0,23705,0,37953,14765,21262,0,0,0,13498,
+0,0,0,0,0,14699,32413,18795,0,0,0,0,15294,34399,39787,0,
+30360,37585,0,0,0,0,0,0,46324,0,23499,0,0,0,0,0,
+0,22745,0,0,0,0,0,0,44870,0,4046,17311,18717,0,0,20643,
+15849,0,0,0,27135,0,33933,0,0,0,0,0,0,34179,2113,9222,
+13013,48401,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,2041,0,0,0,0,0,0,10479,0,0,0,
+0,0,0,0,0,0,0,4007,47425,0,0,0,20291,44934,20039,0,
+0,40608,0,0,0,0,0,0,0,0,0,0,0,0,10180,0,
+21849,29520,0,0,39257,0,46501,0,0,0,0,15685,0,0,0,33153,
+0,31635,19983,0,8941,0,0,0,0,0,0,17192,34947,41969,0,0,
+0,0,0,0,4070,8481,0,0,0,12234,11738,39415,22350,18433,26196,33720,
+41509,21058,1817,31518,33404,0,0,0,0,0,0,1458,0,22739,0,0,
+0,0,0,0,0,0,0,44173,26927,0,22946,28792,47194,2375,0,13765,
+40385,22800,45546,48893,0,0,34263,0,0,0,8448,8846,0,0,0,0,
+0,5373,0,0,0,0,0,0,0,28015,0,0,0,0,5659,26431,
+36264,0,0,0,0,0,48566,27986,0,0,27757,0,0,0,0,0,
+0,0,0,28246,10583,48630,0,35709,0,0,0,0,0,0,0,7616,
+6368,33116,45252,0,5007,0,41621,0,0,0,37805,0,0,23146,0,0,
+0,0,0,39830,0,0,0,36511,0,0,0,0,0,13156,28443,31185,
+44035,15086,6715,42913,21464,0,0,0,0,0,23504,0,3034,0,0,0,
+0,0,0,0,0,0,0,48663,0,7302,3501,5798,46226,0,45075,0,
+25238,0,0,0,0,22591,38605,0,0,30186,44988,0,4684,20705,23500,33646,
+0,0,0,19142,1640,0,0,9219,0,0,22174,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,12261,0,0,0,0,0,0,
+1275,0,15222,46638,0,0,0,0,0,30603,8054,0,0,0,0,0,
+28662,13890,30241,1437,45109,0,38891,0,30028,0,0,0,8645,11654,13913,17027,
+43363,25612,0,0,0,12021,24129,2007,0,0,0,0,0,39726,0,0,
+26487,28123,2271,11265,0,0,0,0,0,42685,0,0,0,0,0,0,
+0,32609,0,0,34351,0,0,38549,0,0,0,0,0,0,0,0,
+14031,0,11572,18019,10776,18434,0,15912,0,0,0,40004,0,0,0,16677,
+4776,4203,45754,0,0,0,6463,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2137,0,23425,0,19654,0,0,311,7230,27588,39654,0,
+13216,34301,40404,3699,0,0,0,0,36308,0,0,0,0,30440,13544,35579,
+45737,45185,0,0,0,29056,0,0,0,0,0,0,0,0,0,35420,
+0,0,0,0,0,0,0,26981,10386,4390,30514,0,0,0,0,0,
+11210,14088,25384,0,35491,0,0,0,0,0,0,0,0,8314,0,0,
+44857,0,0,12354,0,5985,0,0,0,0,0,0,13587,37771,0,516,
+3736,5783,14281,4560,30236,32342,35425,14656,32493,23924,42697,0,0,30874,39727,1115,
+10512,30960,1441,0,529,0,0,0,0,0,0,0,26286,0,0,0,
+0,23108,42532,20856,0,0,0,0,23153,2550,0,0,28767,41300,39407,0,
+0,77,8463,16621,0,0,22446,0,23007,0,31111,0,32864,0,0,0,
+47725,0,36650,0,0,0,0,0,0,0,0,10862,1459,31734,0,0,
+26340,0,0,0,0,0,0,37376,0,0,0,0,0,0,0,0,
+0,0,0,28316,0,0,4589,0,0,10024,42992,0,20939,0,7092,1778,
+24868,34352,41263,0,0,34914,0,0,0,0,0,0,10853,0,0,48870,
+13590,23354,24182,46577,0,33034,0,36534,0,0,0,20196,0,0,0,25626,
+0,0,0,0,0,43261,0,0,0,0,0,0,0,30122,0,0,
+0,0,0,0,0,16686,0,0,0,0,0,0,43769,0,0,11502,
+0,0,0,0,0,0,43072,48686,12584,22301,0,5696,0,22578,12867,0,
+28379,0,0,7516,45674,26850,37881,10211,40612,44147,0,31552,0,0,0,25648,
+0,0,0,0,0,0,2140,0,0,0,43724,0,0,689,0,17945,
+17121,44480,0,26833,0,0,0,0,22869,0,0,0,0,3601,0,12338,
+0,7356,0,0,0,0,11403,0,0,0,0,37503,38669,0,0,0,
+0,0,0,0,0,0,0,30823,0,43845,0,0,0,7605,0,34084,
+0,0,0,0,0,0,0,0,0,0,35866,7463,21472,0,36673,0,
+0,0,0,0,0,37242,0,1447,1692,0,0,43622,0,0,0,0,
+22220,3014,45863,0,30835,0,40550,37692,21521,0,40119,47758,0,0,0,0,
+0,30248,0,48271,0,0,0,9081,27748,40484,0,0,47263,0,0,0,
+0,2180,7883,21006,24830,0,0,0,0,2482,26358,0,17453,0,0,0,
+0,0,0,0,0,4278,0,36725,0,0,0,0,12946,39269,0,0,
+0,0,0,0,2815,10202,14067,0,0,23549,0,0,0,0,0,0,
+0,0,12203,0,0,0,0,0,888,0,0,0,0,0,6404,0,
+0,0,0,0,4640,29035,0,12353,0,5656,21919,37003,0,0,0,0,
+0,18431,10291,30432,47118,20089,0,28758,0,24609,0,0,36546,40924,1672,0,
+44353,0,0,6036,7161,33151,0,0,19230,0,1885,0,0,0,0,9384,
+0,0,0,0,0,0,0,0,0,6813,0,0,0,31483,0,0,
+0,0,13290,0,0,0,0,13814,23734,41370,0,0,0,0,21032,7764,
+48182,0,0,0,0,32574,0,0,0,0,0,0,0,0,0,0,
+0,24136,0,23013,0,0,42582,0,47160,0,0,44410,30846,46372,0,0,
+0,0,0,0,0,14309,0,0,0,31913,0,0,0,40166,0,0,
+0,34971,0,0,0,12010,32409,2109,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,28669,22170,39885,0,0,0,0,0,0,0,
+0,0,14951,0,0,0,0,0,0,1800,0,0,0,0,0,31052,
+0,0,24384,0,0,0,15797,25199,38680,11868,32026,45926,47219,0,0,42478,
+0,3911,34976,28521,0,2362,48140,0,0,0,0,0,0,0,0,41170,
+39959,0,0,0,0,20736,28118,0,0,0,0,0,0,10400,0,0,
+0,42415,0,0,4165,0,0,0,45915,5351,3768,42709,41703,24192,31930,41843,
+0,0,0,5807,38661,0,0,0,0,0,0,0,0,0,21065,40599,
+0,0,0,0,0,0,0,0,0,43310,0,14579,2938,20652,5992,0,
+0,9349,33414,0,0,0,0,0,0,46695,0,0,0,0,5324,6766,
+14941,7790,7837,20134,23340,38739,20871,28856,43349,0,48693,0,0,0,0,19298,
+35289,2078,37443,0,0,15730,0,0,0,0,0,0,0,1482,0,0,
+28976,0,0,45571,0,0,31201,46775,67,22934,0,0,0,4935,0,0,
+0,1994,25454,0,0,0,0,19879,0,27682,30642,21958,45296,0,0,27077,
+0,15488,46896,15348,0,0,22663,0,0,30282,39769,0,0,16971,0,0,
+0,0,0,0,24379,3824,7693,14052,44551,0,46884,0,0,0,0,0,
+9847,0,36662,0,28062,0,5337,44247,0,40027,0,0,0,0,6748,0,
+39667,0,0,0,0,0,0,0,3893,0,0,30361,0,0,0,27127,
+0,0,14478,147,0,0,33654,0,6057,11184,16645,0,0,0,0,0,
+0,18852,0,0,0,43001,506,0,0,0,0,0,2227,0,7751,16255,
+24637,0,0,0,29447,0,0,30589,6238,0,7941,0,0,0,0,0,
+8863,0,11691,45607,0,0,18267,0,33516,0,12632,0,0,13854,41160,0,
+0,0,0,0,0,0,0,2057,11907,14166,0,0,0,17150,13451,0,
+0,0,41413,18923,0,0,8220,39886,0,12326,18907,0,21174,0,0,0,
+0,0,32166,0,0,24289,0,0,43829,0,0,7477,0,848,0,0,
+0,12367,0,0,0,0,0,0,29159,41483,47027,0,0,0,0,29572,
+0,7489,0,26795,44320,6322,0,5395,0,0,0,0,0,16673,0,0,
+0,0,0,24386,0,9997,0,0,0,0,0,0,0,0,697,0,
+0,35360,0,0,11390,10564,13755,0,26467,4299,43967,22103,41599,0,0,30453,
+28335,0,0,0,24241,0,43870,0,0,0,0,0,9702,16356,21150,0,
+0,2288,43179,0,28674,24481,31591,0,0,0,0,0,0,0,27194,0,
+0,0,0,0,0,0,0,0,0,0,0,29462,7490,0,0,0,
+0,25698,1695,0,0,0,0,0,0,0,0,0,0,3842,0,39313,
+21963,0,0,0,0,0,32033,0,20329,5116,32791,0,0,0,0,3426,
+36103,0,0,0,0,7615,36129,0,0,17428,0,0,0,4642,0,0,
+0,0,0,0,0,0,0,0,9426,44133,0,0,0,13320,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,24494,44556,0,0,0,0,0,19156,45297,0,0,0,
+0,16364,0,39417,43323,0,0,3470,0,12039,0,0,0,0,1433,45351,
+0,0,0,0,0,26793,0,0,29461,0,0,0,0,0,0,0,
+0,33787,0,34966,0,18340,6379,0,31861,0,0,31572,41338,2193,41383,47321,
+0,13074,34518,34856,0,0,0,0,0,0,19137,0,42509,0,0,0,
+11970,32562,0,0,0,41058,0,47037,0,0,7031,0,1079,27444,0,8009,
+35181,43746,0,0,0,21304,31968,0,0,39434,40879,45761,0,0,0,4965,
+0,0,0,0,0,0,6018,36540,0,98,0,0,24774,0,0,4195,
+40218,0,0,0,36421,0,0,0,0,0,41829,22479,0,1681,21026,37827,
+0,6810,12465,12446,20617,6093,0,0,0,0,18632,0,0,0,0,2256,
+4297,13309,12194,16026,35396,23189,0,0,0,0,0,0,8826,0,917,0,
+37067,0,0,0,0,0,33113,0,0,14615,0,35752,0,0,17522,29248,
+0,0,0,0,42271,0,0,0,0,0,0,2929,17635,0,0,0,
+0,0,0,41689,0,0,0,0,0,15470,0,0,0,0,0,0,
+0,0,0,0,0,0,9624,0,14356,25186,27086,0,0,0,25242,0,
+0,0,0,33406,0,48884,1050,0,0,14495,24630,25718,0,0,0,15403,
+0,24928,0,0,4273,24011,35562,42681,0,0,0,46399,0,14720,0,16453,
+0,48533,0,0,0,0,0,0,4414,45923,0,0,27779,0,0,1,
+0,0,0,0,0,9683,0,0,4856,0,8750,35863,36663,11553,0,0,
+0,0,437,0,42928,30677,14049,0,0,11473,1177,12451,45294,44366,48220,0,
+0,11482,0,38279,0,25553,32348,0,33554,0,0,0,0,0,0,0,
+17136,2917,25288,30422,0,0,34618,0,36891,0,0,25479,0,0,0,39392,
+28933,0,0,0,0,0,15082,0,0,0,19324,0,0,0,0,0,
+395,14152,35259,0,0,0,10209,31304,34673,0,0,0,0,3112,43144,10904,
+0,0,28013,13366,33545,40013,40805,13213,22338,0,11283,8625,30529,0,3162,0,
+0,0,44284,2558,0,17350,0,0,0,0,5186,30649,41449,0,0,0,
+0,5011,42921,0,0,20128,6335,0,0,11980,7026,0,0,23137,43126,0,
+17253,0,0,0,0,0,0,0,0,0,0,13345,0,0,0,0,
+0,0,37758,0,11965,0,31677,0,0,0,0,0,0,5056,0,31764,
+15025,0,0,40692,47813,0,0,0,0,0,0,0,0,0,4688,20945,
+0,0,26075,16948,10732,10608,46356,14317,0,2723,17662,0,0,0,0,7030,
+10491,0,0,0,0,0,39780,0,8769,29769,0,0,0,0,25240,0,
+0,0,13562,20562,3809,29260,26027,0,0,22453,0,0,0,36457,17071,0,
+45232,0,43766,0,0,28823,0,42367,0,0,0,18336,0,0,0,0,
+48399,0,0,0,7090,47712,34279,0,0,0,0,0,0,0,0,23965,
+34903,12212,20848,47405,0,0,0,0,6602,48066,0,0,0,0,37934,36161,
+13026,39362,0,0,0,3645,38372,38928,0,0,7404,0,0,0,0,23598,
+32293,0,0,0,0,0,0,1316,34220,0,0,24976,33825,0,12645,8953,
+46369,0,0,0,0,0,0,0,0,0,7664,26002,0,0,33030,16419,
+2266,0,0,20992,0,18020,46583,0,0,0,36542,21274,0,0,44716,40907,
+21474,3776,16424,0,33530,0,0,0,35113,0,0,4626,35779,41819,48841,43999,
+0,0,0,6861,0,0,16876,0,0,0,0,1599,30281,36284,16732,38447,
+42059,0,0,0,0,36606,0,0,47218,0,18191,0,48878,0,0,27767,
+37489,41155,40057,0,0,31872,0,0,0,0,4826,11303,29890,0,0,0,
+35486,17625,38908,16047,0,11991,38014,23434,26550,0,0,0,15161,15636,46809,0,
+21960,0,0,12782,0,0,27419,0,8992,36635,4176,0,3540,0,0,4210,
+22752,42186,10187,0,23453,0,0,0,0,0,17643,29530,47475,0,0,11022,
+5895,0,34572,0,0,0,0,1850,22175,20276,31884,38829,1664,0,23138,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,12173,0,0,
+0,0,0,14830,0,0,12226,0,0,0,0,0,0,11756,32128,0,
+0,0,0,0,0,16919,0,0,1717,7538,46710,0,0,0,0,0,
+0,0,0,0,9337,22915,0,0,12361,6777,44972,5358,40460,48789,35129,0,
+0,0,0,0,0,38823,0,0,43770,0,28338,0,0,25231,0,0,
+0,0,0,0,0,0,37576,23284,0,0,0,31902,0,10047,0,0,
+31059,16241,0,0,0,0,0,0,0,5747,0,0,0,39406,0,0,
+0,33725,0,1763,48714,0,0,0,0,0,21060,0,0,0,0,0,
+0,48642,0,17449,4152,35046,0,45325,0,0,0,0,0,0,0,1342,
+4373,20867,48309,10411,32732,40321,0,26635,19615,0,0,0,7208,0,35639,13632,
+0,0,0,0,23034,0,0,39035,0,39194,0,0,0,0,0,47734,
+0,0,0,0,19110,0,0,0,24255,0,43172,6525,42055,48179,16267,0,
+0,0,5559,26239,0,0,18559,21449,46847,36178,18464,27328,0,0,0,5621,
+7246,0,0,20610,32066,0,2009,33800,0,0,0,0,0,0,31743,0,
+0,5604,4421,0,0,33043,215,44373,42960,24282,45395,0,25461,35535,0,0,
+0,0,0,0,0,0,0,0,0,18832,36448,42545,45619,0,0,47730,
+0,0,38762,37973,16230,0,0,0,0,0,0,0,0,16993,20117,0,
+0,0,0,0,34168,0,0,7787,47978,0,0,0,0,0,26130,0,
+0,0,17314,0,0,0,0,14201,48456,40557,4073,0,0,0,42118,0,
+0,0,0,0,28197,21968,0,0,0,0,0,0,8997,0,0,39987,
+13676,10692,13245,33086,34100,36538,10492,19456,21735,0,0,0,0,0,2290,0,
+0,0,0,28162,0,0,23815,0,0,0,29887,0,0,0,0,10682,
+73,42719,0,8701,0,0,0,11076,22886,0,0,32797,0,0,43808,0,
+0,0,13651,0,0,23464,0,0,0,0,0,40807,47428,22488,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3036,0,0,0,0,0,0,13379,38209,10336,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,4315,11851,16057,0,0,0,0,
+0,0,19849,0,34497,0,0,45562,5989,16550,13917,16613,29029,35156,0,0,
+13049,16604,0,0,20307,0,0,0,42552,0,0,0,0,0,0,25644,
+29446,11135,23219,37173,11152,0,0,0,0,0,34474,0,0,0,0,0,
+0,0,0,0,20465,9520,8255,0,0,0,0,0,31402,16041,0,0,
+0,0,0,36857,0,39573,5052,0,0,16332,37888,35862,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,13710,0,0,0,0,
+0,0,0,0,0,35336,0,0,48183,0,0,0,0,0,0,13922,
+2603,0,26495,23988,0,44521,0,0,41513,31807,0,3929,4791,25140,26061,12331,
+17886,26929,34344,46483,0,0,43625,0,0,18328,0,0,0,0,0,0,
+0,0,27892,43137,0,0,0,35669,42417,0,0,0,0,0,0,0,
+27278,0,13815,29421,0,0,0,0,37196,0,0,21929,46927,0,0,46008,
+0,30728,0,0,0,0,0,0,0,37664,0,0,3495,0,0,0,
+5117,0,0,0,28412,8926,36247,0,0,0,0,20217,0,0,0,4608,
+16592,27608,0,0,0,2239,11902,9508,36844,0,0,0,0,0,0,0,
+0,4565,8377,0,2902,0,0,0,0,0,0,0,0,0,1046,17254,
+30072,0,0,0,34195,0,0,0,0,0,0,0,0,14071,11857,21552,
+23632,0,24024,0,0,0,0,0,0,22012,46332,0,22405,926,0,0,
+0,37793,0,0,0,0,0,18040,31842,0,28378,0,0,0,0,0,
+0,40672,44775,0,0,0,0,0,16507,41248,0,0,0,0,0,28012,
+45992,0,9487,0,16642,14161,24469,27321,37568,40176,0,0,0,0,47459,6276,
+0,0,0,0,6765,0,41232,0,0,0,0,23420,0,44510,0,0,
+39303,0,0,0,9310,30953,34703,4587,7971,0,0,0,0,23174,9117,0,
+0,21447,0,0,5129,0,0,1930,8561,27179,27270,11266,34644,0,13579,0,
+0,5118,0,0,0,0,24381,27057,0,0,0,0,0,5103,27293,6571,
+23767,0,26741,0,34471,0,7454,6227,0,0,0,0,0,0,0,3254,
+12525,0,0,5486,1649,13111,48242,0,7960,0,0,0,0,0,8652,14991,
+27959,32178,35772,0,0,0,0,0,0,0,0,0,0,36539,45682,24492,
+0,0,23492,0,0,30751,42745,0,0,0,0,0,0,0,0,39025,
+0,0,0,0,0,0,19619,45217,0,0,0,47598,22568,0,18524,0,
+22209,0,0,0,27593,16991,20407,35417,25161,3423,25766,40848,42725,589,5303,13537,
+37036,0,34121,23220,36755,10671,0,30660,37695,0,28846,0,13387,0,0,42540,
+0,0,0,0,0,0,0,0,32844,35091,0,14010,0,48378,0,0,
+37846,8791,43697,0,0,0,0,0,37992,0,0,0,0,0,0,0,
+0,0,0,0,5991,0,0,31118,0,0,0,0,0,0,0,0,
+32442,0,0,0,0,207,0,0,0,0,43900,0,0,0,0,0,
+0,0,0,34406,0,0,0,0,1178,0,0,27309,37411,0,43394,7240,
+0,0,35116,0,5279,0,0,0,0,0,0,0,26959,0,39826,0,
+0,2383,0,0,0,0,0,0,0,0,22860,0,26167,0,28125,31316,
+0,19683,112,0,0,0,36533,0,19754,0,31284,0,0,48785,0,40925,
+16365,0,0,0,0,0,33691,0,38303,0,1833,21894,0,10008,29774,14820,
+44508,0,17354,33803,0,37841,6744,25743,25355,31441,25802,41806,45829,41206,18704,0,
+1995,0,0,0,9147,9339,0,0,0,0,0,20745,32060,0,19161,0,
+0,24014,24342,31721,0,30227,46559,0,0,0,0,0,39955,0,0,0,
+33799,0,0,17002,17799,0,0,0,33215,0,44561,0,0,31851,0,4734,
+14192,38548,20957,37954,27661,46533,33503,0,0,12949,0,31444,0,0,0,0,
+0,0,0,0,0,34538,15902,34125,0,0,0,10354,0,37982,0,0,
+0,0,0,8936,0,7162,0,42063,24079,0,0,5381,16066,46155,0,17118,
+37593,0,0,25321,0,8349,0,0,0,0,0,0,0,9636,42461,36803,
+0,0,38510,12308,46061,0,0,11827,8404,47441,10926,0,0,0,34962,24295,
+28346,36335,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+26113,40333,0,22558,0,0,7968,0,46023,0,0,37624,39931,10635,6254,43894,
+0,0,0,0,0,0,0,22713,24702,0,0,0,17992,19265,0,0,
+0,37365,0,18410,0,0,9613,0,26254,28694,6307,10298,35022,26412,0,22090,
+0,0,25265,0,0,0,0,0,44174,27514,31546,12669,13638,17929,41065,18028,
+44280,48034,0,0,0,0,16105,2425,27320,0,0,0,7227,0,0,0,
+0,36848,22260,22347,0,0,20823,0,31462,0,0,0,1721,2895,0,0,
+45840,33957,15591,0,0,0,0,0,0,10559,0,0,0,0,0,15429,
+0,0,0,0,0,20999,25855,17494,35050,0,0,0,4606,0,0,9352,
+0,0,0,9918,0,0,0,0,0,26966,0,47971,0,0,0,16716,
+0,0,0,6673,7111,12936,0,0,7107,0,0,0,0,0,0,0,
+0,47713,0,0,8796,1440,0,0,5350,0,0,3440,0,0,0,0,
+47422,0,17844,0,0,0,0,0,0,45920,0,9276,11054,0,0,0,
+0,26229,36992,0,20310,15810,26744,32743,0,0,0,0,0,33346,0,0,
+0,0,0,13427,0,0,0,0,0,0,13926,0,0,27189,546,39317,
+0,0,25248,0,0,0,0,0,764,27322,0,0,0,0,0,0,
+20270,0,0,11841,12951,0,47572,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,46021,0,0,0,0,9909,0,0,47686,44706,0,
+0,0,5473,0,19964,33184,37328,22082,46682,30685,5838,0,0,0,0,8839,
+14926,0,0,0,15410,43451,0,0,0,0,0,33850,0,25705,0,30359,
+0,29560,0,0,0,0,0,0,0,1917,32143,41960,38253,0,0,0,
+40547,0,0,0,0,0,13110,13122,14763,25246,30655,0,0,0,0,16792,
+22819,0,0,0,0,44113,10600,37209,0,0,0,0,0,0,24809,9373,
+0,0,0,0,1039,41893,1031,0,0,0,0,0,1273,0,15398,0,
+0,46056,11586,46194,0,10509,12754,0,14394,0,0,0,0,0,0,0,
+0,30825,0,5607,42113,0,0,0,0,18090,0,0,0,0,0,0,
+37428,0,0,443,5437,47785,5153,0,21347,0,0,0,0,0,0,10289,
+0,0,0,0,0,0,0,0,28243,0,14137,0,3639,22390,0,20058,
+0,35904,0,27626,32940,38170,0,0,0,0,0,0,0,0,0,9083,
+1808,0,0,0,0,0,0,0,0,25956,23142,0,0,0,0,21320,
+26860,0,0,0,0,0,0,0,0,0,0,38364,7735,20721,0,394,
+0,0,0,0,0,0,0,18184,0,83,0,0,0,0,0,8711,
+35377,0,10139,0,39461,0,0,21713,0,0,0,34183,0,32475,33162,0,
+33334,28244,1903,4341,5959,0,0,0,0,12018,0,24895,0,0,0,0,
+0,37326,0,39598,0,0,0,0,0,0,42123,8501,0,0,0,0,
+0,46780,18799,0,0,0,0,0,6263,4051,0,41429,0,0,0,0,
+0,0,0,0,25996,15087,0,0,46318,0,0,0,0,35303,3183,39911,
+0,0,0,0,0,45318,0,0,0,44838,0,0,0,14802,32088,0,
+0,11017,30678,0,0,0,0,0,815,22148,3858,33099,0,0,0,0,
+0,0,0,0,0,0,0,31338,0,0,10000,37330,0,0,0,0,
+0,11905,41997,0,0,26389,0,18551,14205,14734,34499,0,0,48253,15932,17922,
+20883,0,0,0,1368,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,22497,30036,26238,0,0,0,0,36487,0,0,44591,
+29533,0,0,0,0,0,35456,9157,0,5949,47577,0,0,9459,0,0,
+0,0,0,0,34336,37480,0,0,0,1650,6047,48275,0,0,0,0,
+7531,28954,0,0,0,36613,25727,13896,22898,0,0,13995,0,0,0,0,
+0,0,23248,17381,34037,0,0,20806,0,0,17346,0,0,0,32809,4430,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,40271,0,
+0,0,0,12438,32927,0,0,0,0,13297,0,0,0,0,26296,0,
+0,0,0,0,0,0,7911,0,0,0,0,0,0,16005,12125,0,
+37653,0,0,0,0,0,0,0,0,0,0,0,0,37302,0,26547,
+0,0,11004,22036,0,0,0,31166,0,0,0,7549,0,0,33649,0,
+7924,25407,0,48609,0,0,0,0,0,0,0,0,0,0,10734,0,
+29692,0,0,0,0,0,0,0,0,13208,22976,46997,0,0,0,0,
+22054,29025,30507,0,0,31051,0,0,10277,0,0,0,31689,35344,36293,0,
+7308,0,0,0,18228,19090,6130,21948,43668,46614,0,9266,0,0,0,0,
+4220,3325,11247,43741,21660,17565,0,21042,9936,48295,0,45223,26638,42627,18883,0,
+7279,0,38646,0,0,551,44116,0,0,0,0,8351,29989,34891,22367,0,
+26218,0,10467,0,4581,0,0,0,42435,0,11923,0,0,0,0,0,
+28301,17055,0,0,0,0,0,38073,44733,0,0,0,9545,0,15168,45633,
+0,45421,0,45750,0,0,0,23357,0,0,25715,0,0,0,0,0,
+28983,47962,2436,34927,28653,12214,0,0,0,0,0,0,627,0,35351,0,
+0,0,0,13659,42074,0,0,19035,0,35968,5268,39523,45264,0,0,0,
+10882,0,24541,0,0,0,0,0,0,16833,0,0,0,24553,26615,0,
+0,0,32745,5366,8477,37909,47383,0,0,0,0,0,0,0,7439,8771,
+42263,26729,0,0,0,0,7234,21645,0,0,0,5175,41600,0,0,42203,
+0,35797,0,44813,0,0,0,29254,0,0,0,0,0,0,0,0,
+0,29696,0,0,0,0,28122,0,0,0,0,0,0,0,0,0,
+0,18182,7168,0,0,0,0,0,0,34244,27669,37373,0,0,0,15612,
+0,0,0,0,0,0,0,44598,0,0,37681,47302,0,45400,0,0,
+0,0,0,0,0,0,10601,0,6149,47309,19463,25983,32059,0,1154,39718,
+0,35794,15622,40763,28492,0,0,0,0,0,0,30015,1784,7701,8883,18149,
+31232,0,0,6634,0,0,0,20836,32092,0,0,31813,0,0,0,18788,
+0,0,0,0,24775,42268,785,0,0,0,0,0,0,0,9913,0,
+29499,0,0,0,16697,0,0,0,0,6070,7317,0,0,25779,0,0,
+0,0,21619,37068,0,0,47434,0,48539,0,0,45239,0,27002,0,28166,
+0,0,0,0,0,0,0,0,1446,0,0,0,0,33824,0,11873,
+26481,30444,20356,38696,40409,41963,0,0,0,16766,7509,21122,23851,0,0,3992,
+0,0,0,0,0,33317,8438,0,0,0,0,0,39203,0,0,0,
+13380,0,0,0,0,0,0,0,0,33480,0,47636,0,0,0,0,
+34280,0,11225,0,2630,0,0,0,20438,0,0,37447,0,0,0,3641,
+5247,8325,29764,784,18669,34283,0,18334,0,0,0,0,9255,37006,0,0,
+26938,0,0,0,0,1979,31937,0,2531,20793,0,31493,0,0,18683,31109,
+37889,38164,25538,0,0,0,0,27448,39824,0,0,0,0,42986,24776,18933,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,41853,0,0,0,14913,0,0,0,0,0,0,0,6338,8626,
+33838,22539,35431,47910,364,3283,0,0,7809,0,0,0,0,0,7894,0,
+0,0,0,6729,0,0,0,20331,10164,0,22211,0,0,11241,12849,20752,
+20651,11157,21010,0,37449,4345,0,0,0,0,0,0,23741,0,28502,0,
+0,0,44316,0,22537,0,2499,0,0,0,0,0,13567,0,0,0,
+0,0,0,3692,38467,0,0,0,0,0,0,0,0,0,11420,0,
+1454,14790,0,0,23650,0,10861,0,41794,0,0,0,19972,0,0,28819,
+19755,0,1600,0,0,0,0,0,34126,0,0,23937,33528,0,0,0,
+18446,0,20297,4269,9158,22889,28750,30968,3720,0,0,0,0,9798,0,0,
+868,36737,0,13627,0,0,0,4366,27041,0,0,37137,0,0,0,0,
+0,0,0,26502,0,0,0,23140,0,20735,0,0,0,35839,0,0,
+10307,26856,0,47593,0,1091,2112,47829,0,14771,32961,32020,0,0,4687,0,
+23978,38705,0,1614,0,0,0,0,0,18838,4157,0,0,17107,0,0,
+2405,46955,37879,0,0,0,0,1618,0,45645,0,0,0,47453,0,0,
+0,0,0,21325,0,0,0,0,0,5029,31366,0,9240,16977,26630,30905,
+47956,0,0,0,0,0,38694,36976,0,18534,0,0,0,0,0,0,
+31299,0,14106,0,0,0,0,0,0,0,19356,26242,18451,27954,44797,0,
+0,44621,0,0,0,37288,0,0,0,0,0,0,39545,0,0,0,
+0,0,0,15898,8229,0,0,0,0,0,0,0,0,0,0,41877,
+0,0,0,0,0,16103,0,0,0,0,0,0,27251,23035,0,0,
+0,0,0,0,0,0,7760,26311,6448,31614,44487,24137,0,0,16152,9489,
+35016,18382,34750,13141,0,0,0,0,0,0,0,2493,0,0,4404,24261,
+0,27641,36551,38872,0,0,0,0,0,0,0,0,2102,0,0,0,
+0,0,0,0,0,0,0,0,9314,0,0,0,0,3743,0,0,
+0,0,42790,0,3661,20069,31502,0,0,0,0,0,0,0,0,0,
+0,168,0,21672,0,0,0,11496,29877,0,0,15679,17472,0,0,0,
+33370,0,0,0,0,1494,40141,0,0,46288,0,0,0,0,0,0,
+0,0,0,0,8273,13928,14829,2062,13734,0,8430,0,0,0,0,40873,
+0,5447,12603,16035,0,34626,0,0,0,26297,0,0,0,36296,0,40378,
+0,0,26523,16738,0,0,0,0,1629,37183,0,0,21820,0,0,0,
+0,0,12578,0,0,0,41344,0,0,0,7384,27429,36196,1946,0,0,
+0,0,0,0,27506,0,0,0,17282,29184,0,0,43171,48083,0,9821,
+0,0,0,0,0,0,38187,13382,0,749,0,40633,45824,23723,23991,45922,
+0,0,28782,0,0,0,0,0,0,14347,0,0,9794,1388,0,0,
+0,0,0,36046,2953,7937,0,0,0,16838,20859,9030,0,0,48472,0,
+0,0,0,0,31179,0,0,39361,0,3830,0,8668,0,0,0,0,
+0,0,20400,41747,31729,35680,0,35604,41745,0,13059,0,33848,0,0,10995,
+27988,44075,0,22448,0,8032,34715,0,0,0,35511,18101,0,0,0,1740,
+40042,0,0,0,0,0,0,0,0,0,17952,1811,0,0,250,0,
+0,0,0,47951,0,0,0,38269,0,0,0,0,41546,0,0,34724,
+0,0,0,0,13426,26777,0,0,0,0,0,0,0,0,0,0,
+0,0,44935,0,0,17993,35283,0,0,0,0,0,15727,0,0,0,
+0,4162,0,0,0,0,0,0,29630,0,0,0,33664,46147,44889,43783,
+0,0,0,0,22643,0,0,33834,0,0,10632,0,7523,25174,35838,13708,
+24417,24859,24437,27636,0,0,0,0,29413,29619,0,0,9321,0,0,11226,
+0,37171,0,0,6981,6165,0,0,43505,0,0,0,0,8405,29905,40835,
+0,32785,18636,32028,45461,1222,0,15972,0,34678,7467,28625,0,0,0,46199,
+0,0,4163,18872,41199,42247,3467,0,0,0,19878,0,0,0,0,39426,
+5224,13573,28664,0,33275,6979,24336,32774,0,15986,42493,0,0,0,0,19411,
+0,0,0,0,0,0,7183,43938,0,0,0,26369,46007,0,0,25561,
+0,0,0,5484,0,0,21906,33369,0,0,5402,9941,29386,0,0,0,
+0,0,34881,0,0,0,18441,38813,0,0,0,0,4570,0,41793,11322,
+36127,0,0,0,6111,0,8675,0,5113,10327,46057,0,22940,0,5298,0,
+0,0,0,0,0,0,0,43334,0,0,12955,0,0,924,4956,16466,
+14240,19031,0,0,0,0,0,19629,15565,22516,39214,41990,0,10770,17109,0,
+0,0,4953,22480,38805,48601,0,0,0,10248,0,13036,23962,0,0,0,
+3258,0,0,0,0,0,11044,1225,38718,0,0,28105,0,0,0,0,
+0,0,0,556,0,0,772,0,0,0,0,41218,0,0,17740,46509,
+0,25006,0,0,0,0,0,9193,32532,0,0,0,705,0,0,3998,
+5191,24285,28812,0,0,0,0,46181,39343,0,0,17469,16311,0,0,0,
+14453,0,6790,2061,28718,0,0,0,0,8570,21965,45768,46622,0,0,0,
+0,45093,39639,0,0,0,0,0,0,0,0,0,8642,0,0,0,
+0,0,0,35565,16257,17987,0,0,36073,0,0,0,0,0,6253,0,
+16150,41476,0,45938,34135,0,0,0,0,0,0,31199,0,0,23262,14575,
+43812,0,0,10931,28570,35506,911,14435,0,16940,0,0,0,0,0,40813,
+0,0,0,0,0,33405,0,27764,0,0,0,0,0,0,0,22491,
+0,0,0,6901,43606,1083,0,0,40679,0,0,31300,43319,0,0,0,
+0,0,17716,38563,48757,44452,0,0,2021,0,0,0,0,0,0,0,
+0,0,28523,0,16961,0,10658,0,0,0,30120,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,48792,0,0,0,38897,0,
+0,5192,0,32639,0,0,28638,0,38768,0,0,0,0,28354,9974,44058,
+33077,20729,36348,45190,46993,34004,2488,0,0,29067,0,0,0,44002,0,34435,
+0,0,0,2301,0,0,0,15437,0,0,0,0,0,0,0,2958,
+0,37485,0,0,45339,0,0,0,0,43819,43359,0,0,12239,12488,13063,
+0,0,0,0,0,0,0,622,0,0,0,0,0,0,0,20494,
+2771,0,0,0,0,0,0,0,0,2548,22116,0,14075,0,42865,13231,
+23158,26259,0,0,11402,27271,0,0,25614,0,0,10867,0,0,4357,0,
+262,42657,0,0,9254,33544,0,14254,20012,36309,0,0,0,0,0,0,
+32592,9838,0,9718,15300,0,0,0,8761,0,0,25678,0,46657,0,0,
+0,19107,0,0,0,46940,36298,0,28161,0,0,0,0,0,0,42952,
+0,0,0,18546,31947,37266,4669,0,0,0,38523,24532,0,2476,0,0,
+0,0,4495,32210,0,0,0,0,0,0,34863,0,0,0,1266,0,
+17255,0,0,0,32585,0,28827,5537,31646,0,41128,0,13635,40185,5937,30804,
+42093,0,16678,0,0,0,45684,0,29864,34898,0,0,48426,0,0,12581,
+0,0,0,0,0,0,0,24303,0,0,0,0,0,39405,0,0,
+0,0,0,0,0,0,5166,32793,0,0,16396,0,0,7572,15482,0,
+0,40788,0,0,0,14142,14964,46478,46831,0,14001,36872,0,0,0,17120,
+0,0,31142,0,14975,21768,821,8353,0,0,0,0,0,0,0,38135,
+35913,48481,37453,0,46852,0,0,4188,48147,0,0,0,0,25966,47525,0,
+0,27345,39590,14512,0,0,0,34633,0,0,0,38562,0,22111,0,0,
+0,0,0,27164,0,0,21439,6299,26728,32551,46898,0,11483,0,0,26168,
+0,37210,0,0,0,0,0,37623,0,0,0,0,42356,0,0,0,
+0,0,33688,0,0,18264,22460,0,0,0,0,0,30259,0,0,0,
+0,0,0,0,38239,0,0,0,0,0,12536,5879,10697,0,0,0,
+0,0,0,43543,0,0,0,0,0,0,0,0,0,28629,0,2042,
+43750,0,1518,0,36783,0,0,0,24582,0,0,0,0,0,0,0,
+0,0,0,22056,31975,0,0,13572,0,0,2905,0,0,28097,13561,0,
+0,20768,4198,11595,0,43031,0,30940,43658,0,35274,0,42177,0,21050,0,
+0,0,0,0,0,8274,0,0,3731,37869,11295,0,10924,28778,0,0,
+21874,0,0,0,0,13860,27084,39568,0,0,0,8360,21934,0,26839,31823,
+32865,0,0,39924,0,0,0,0,0,0,19618,0,0,0,0,4709,
+17334,28977,0,0,0,0,10628,18177,0,0,0,47211,33180,0,0,5975,
+0,34574,0,0,0,0,0,20940,0,0,0,34297,0,0,0,0,
+0,0,0,25622,0,0,5976,18635,23070,23455,29241,47649,0,36091,0,0,
+47450,48827,0,0,32926,39149,0,23236,16941,28307,0,0,7519,25771,30342,15307,
+18878,42889,45271,0,0,0,0,0,0,0,0,0,0,8678,37516,40875,
+39009,28367,27814,36427,0,0,0,0,0,35536,0,0,0,503,0,38469,
+33373,0,0,32836,0,0,30588,0,0,0,20785,42106,0,0,0,0,
+0,0,13584,0,18525,1969,10119,0,0,0,12908,0,0,0,37234,0,
+0,0,0,2746,45367,45295,0,0,10527,34026,14171,42270,46014,47002,7152,0,
+0,9377,0,24439,1001,7066,10204,0,0,0,0,0,0,0,10318,48283,
+0,0,0,0,43213,0,0,41161,26661,0,0,36787,19757,25825,32964,0,
+0,0,29750,0,0,1192,35267,0,0,0,0,0,0,0,0,48618,
+0,0,0,0,0,0,0,6812,28915,0,0,11928,32396,41701,0,0,
+0,24317,0,0,0,39143,9034,46319,0,0,0,0,0,0,1098,25490,
+30706,0,0,23462,0,0,0,0,0,0,0,41847,40052,0,0,0,
+0,0,14718,29782,0,0,0,37408,36717,0,0,0,0,2614,0,0,
+16576,17684,0,0,0,0,0,29710,0,37976,0,0,0,0,0,0,
+15462,0,0,15141,16227,38997,0,17470,0,0,0,0,0,0,0,0,
+0,0,35454,0,0,0,0,17162,7543,45356,0,19676,0,6950,36168,0,
+0,0,12630,10261,43501,27931,48150,0,0,18810,0,0,0,0,23414,0,
+0,0,0,0,30836,15753,0,11971,0,0,0,0,0,4363,0,4662,
+0,46965,0,22172,0,0,43302,31945,42809,0,20478,0,0,14229,0,34886,
+0,0,0,0,0,0,0,0,40514,0,7706,24560,40949,33485,0,0,
+0,0,0,36995,0,0,3625,35029,0,0,0,45372,0,0,18367,0,
+0,14667,0,40227,0,0,0,0,0,0,0,0,22113,35916,0,0,
+0,40779,0,0,0,0,45435,0,0,0,0,0,0,8439,16196,23693,
+0,27365,45707,31140,0,0,0,29165,42453,0,0,0,0,0,0,0,
+0,37096,0,0,46502,25706,15045,40898,0,5194,47887,22559,0,0,10057,35326,
+2678,0,17280,0,23727,22238,0,11585,363,34278,31016,38687,25551,39056,40264,42354,
+47256,48031,35577,0,0,48069,0,0,0,10130,25168,0,0,8176,0,42698,
+0,0,0,0,0,37060,0,0,0,0,18731,0,0,0,12103,0,
+0,0,0,0,0,0,0,0,0,31986,31029,36006,40844,1267,38715,13051,
+38265,45001,43553,45333,0,0,0,0,23910,0,0,0,0,0,0,0,
+6652,34527,0,0,0,24613,25303,0,8443,0,5692,0,0,0,0,0,
+35061,0,0,0,0,0,0,0,38210,0,0,0,21200,12804,15989,18278,
+30062,23547,41539,10651,47372,0,12019,44125,29321,0,0,7130,33441,39923,25795,28974,
+29255,48014,0,0,43841,0,42746,0,0,0,0,0,0,13547,0,0,
+0,18957,1956,9688,0,0,0,6925,38425,673,0,16372,0,0,0,0,
+30040,0,0,35065,0,0,15803,44722,0,0,0,0,0,0,0,0,
+0,0,912,38342,0,0,0,3177,0,0,0,10809,0,0,0,0,
+9999,11260,0,0,26677,0,24539,23942,0,0,3939,7512,33083,0,0,40467,
+0,0,0,13560,0,0,27003,0,0,0,0,0,0,0,0,5035,
+32765,0,1457,14227,5368,29054,28688,0,0,0,0,0,0,9959,0,6606,
+0,0,2646,44021,25354,12728,28840,617,33488,36013,14839,46966,20913,0,0,0,
+47143,0,1061,11310,0,0,0,36490,9693,0,0,0,0,26282,48597,0,
+0,0,0,37959,0,46320,0,47276,0,32526,37676,22620,48581,0,0,22931,
+0,18929,0,45003,0,20893,27387,0,46612,0,36999,0,0,0,0,0,
+0,0,41281,28407,0,0,0,0,0,44631,0,15561,0,0,30927,0,
+0,0,43139,0,2232,28524,34483,44112,0,0,0,0,0,527,4464,17730,
+9248,20672,0,20457,38481,0,0,0,19708,0,0,27983,22364,17412,24738,0,
+0,23552,25106,7002,0,0,0,0,0,11709,13527,3454,19141,35363,0,0,
+0,0,0,43393,0,5850,7815,37880,28399,0,0,0,2729,0,0,0,
+0,37263,0,0,42883,0,0,0,16263,0,29992,0,0,0,0,0,
+0,0,0,17530,0,37726,0,0,14398,0,0,0,0,0,0,0,
+0,5393,0,0,48568,27128,28279,0,0,0,0,0,0,7426,8011,14053,
+21596,23984,30288,41647,0,0,0,38621,0,0,10167,9521,6538,0,0,35759,
+2807,10877,12537,32257,0,16062,17289,21173,47455,48091,0,0,0,0,0,24233,
+0,29400,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,8137,41210,5289,0,32343,0,28480,46041,265,0,
+0,45547,0,7167,10774,0,0,40983,0,0,0,0,0,0,0,0,
+47097,47930,5050,0,0,0,0,355,25175,33710,37197,11078,0,29609,32728,0,
+6746,0,0,0,0,35761,0,0,0,0,0,0,0,0,0,0,
+0,11288,0,0,0,32704,0,0,0,0,0,0,0,0,0,29600,
+0,15879,0,12958,0,0,0,0,182,0,11882,14682,0,0,0,0,
+0,0,0,11505,0,45875,0,0,0,0,0,29079,0,0,0,0,
+0,0,0,35822,43640,0,38514,0,2941,0,0,0,34697,11046,20216,45642,
+0,30792,16788,0,0,0,0,31313,47746,18253,6073,8972,35085,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,39259,47279,
+10537,14635,0,0,38667,10420,47471,0,0,0,0,0,0,0,0,34892,
+20177,0,0,0,38,14297,0,0,0,39618,0,29565,9186,32655,0,0,
+0,0,0,0,0,26014,0,0,0,0,0,0,0,0,44843,0,
+0,0,0,0,41085,31461,41292,0,23595,0,0,40178,0,0,48667,0,
+0,0,0,27019,0,40497,0,27695,0,17374,0,0,47865,0,0,0,
+0,0,0,0,0,0,0,0,0,27639,0,0,0,0,0,0,
+0,0,0,0,3593,26102,25421,48159,0,0,12132,29267,15441,3414,30768,0,
+0,0,0,0,10317,0,0,0,11870,35650,48495,0,0,0,46834,26327,
+0,0,0,3710,17303,0,0,0,48453,38745,11973,18402,0,18553,6347,1953,
+6361,31934,30476,48579,17317,0,4612,2711,43777,0,5417,0,0,0,0,4995,
+0,0,0,22470,19316,0,0,0,0,0,0,0,0,31245,0,0,
+0,25351,0,0,0,0,0,0,0,41,27290,0,0,23527,0,0,
+0,0,11332,33141,32769,0,0,28837,0,0,31078,43415,13749,0,36564,0,
+0,0,0,18404,0,0,0,0,0,0,0,0,0,5051,15780,0,
+0,0,0,39956,0,34726,13347,7051,19202,20760,0,0,27442,22193,12742,46124,
+0,19069,36159,0,0,3965,0,46596,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,47487,0,43824,0,48363,
+0,4386,0,0,0,425,0,0,0,43641,0,0,24500,29509,0,0,
+0,0,0,0,1907,0,0,0,10866,10372,0,0,34515,549,0,0,
+29167,39260,0,0,42639,12633,0,0,0,0,0,0,0,0,0,0,
+0,0,3095,32372,13847,37413,0,46499,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,4227,0,0,0,3199,0,
+0,0,0,0,43920,0,30534,25721,0,0,0,0,0,0,0,0,
+0,0,42909,0,0,0,0,2203,0,0,0,0,0,16276,0,0,
+0,0,0,0,18049,29885,42494,42551,0,31694,9165,6908,0,0,0,0,
+3839,44674,0,10109,0,35918,0,0,36625,0,39000,42955,0,0,0,0,
+0,40765,41202,14259,22937,0,0,0,0,42454,0,0,0,0,0,31794,
+0,0,0,44979,0,0,0,0,0,0,11070,0,19148,0,0,0,
+0,38278,13003,36282,31949,0,0,0,13389,13531,0,0,0,26249,0,38837,
+0,0,0,0,0,12647,0,0,0,8,0,23413,0,29356,21102,0,
+0,0,3862,0,11312,0,0,3292,0,0,0,31275,29310,9818,0,0,
+0,3420,0,3456,38792,0,0,4243,22455,0,18935,21811,42474,0,0,0,
+0,20582,21020,0,0,0,41037,0,0,0,0,0,38606,0,0,46592,
+0,0,0,17103,0,16847,0,0,0,0,0,18013,43289,10482,0,0,
+0,40511,0,0,0,0,0,0,0,1959,26925,31509,0,0,0,0,
+0,0,0,0,40009,7314,14504,17954,33706,29207,0,0,4693,13191,31566,0,
+31723,0,48157,0,41836,19403,0,0,0,0,0,0,31170,46170,0,0,
+4435,10639,42042,0,8200,31740,0,40359,0,0,15975,46221,25610,0,0,20067,
+0,0,0,0,0,0,0,45509,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,47326,0,2385,24256,9408,26858,0,0,
+9398,0,0,0,0,34806,24263,45238,0,5384,0,41124,0,36283,37655,0,
+0,5475,29982,0,0,1309,0,32709,0,0,0,29376,0,11730,0,0,
+7882,0,0,10443,0,0,13429,0,0,0,13490,0,0,0,0,0,
+4583,0,13864,0,0,0,0,0,0,13844,0,1944,18775,0,1603,0,
+4585,16545,41047,0,0,0,18422,0,0,0,0,33291,0,0,0,0,
+0,0,0,30966,0,0,0,0,0,9150,0,0,47361,0,0,13461,
+42980,0,9194,32601,0,0,0,21422,0,0,0,4389,0,15772,20722,0,
+0,0,0,0,0,12093,26823,20881,32278,45408,0,0,0,28111,0,0,
+11388,33586,4379,4504,0,0,0,0,0,0,0,0,34029,0,0,0,
+9210,35053,0,43143,47139,0,0,0,0,0,0,33684,0,0,0,9483,
+24629,0,0,0,16682,0,0,35552,40984,1476,41972,0,0,0,0,3915,
+0,0,0,0,0,44260,4112,4714,31071,0,0,0,0,0,0,0,
+0,0,0,916,0,0,0,0,3518,35768,0,0,16589,0,24587,9733,
+0,15165,0,0,0,20767,18393,22121,37630,43418,0,0,0,0,0,0,
+9841,13993,22024,0,0,0,0,28360,3049,2285,30713,37110,38636,6578,48674,0,
+40988,0,0,23241,0,32788,0,0,0,20864,31653,0,0,0,0,0,
+19580,3951,0,0,0,35560,23136,36986,0,0,16509,48690,12382,6262,0,38491,
+0,40747,3024,37271,7948,38353,0,0,12426,0,0,0,0,42142,0,0,
+3261,15066,0,0,0,0,8680,0,0,47919,0,0,0,0,0,22313,
+0,0,0,24398,27802,0,0,0,0,0,11211,22048,13507,0,0,0,
+43417,0,0,0,0,13388,0,0,0,0,0,0,0,0,0,4900,
+17760,27244,0,24943,0,41852,0,35062,0,18802,0,8299,34196,38944,0,0,
+0,0,27146,0,0,25010,42267,0,0,0,0,0,0,0,43616,0,
+0,0,0,0,0,0,39196,0,5416,0,22000,0,0,37108,0,0,
+13370,9496,10831,33407,0,44578,45365,6062,13986,8697,0,0,0,0,12012,0,
+25334,0,0,0,13343,48545,0,0,0,45551,0,24656,0,2706,0,0,
+33235,47497,20937,0,3050,35401,0,0,0,0,0,34424,11773,0,0,38383,
+0,0,0,0,10221,0,0,2576,21745,24323,0,0,0,0,0,0,
+30146,0,0,7482,0,22994,0,0,0,0,33988,0,20281,0,1163,0,
+4761,0,0,0,0,8658,6883,7110,34325,0,47171,0,43373,0,0,0,
+0,11707,18820,45825,0,0,26070,0,0,25298,0,0,0,16296,31032,17981,
+0,0,38879,0,5713,23012,22302,23597,17754,43693,44351,38429,0,0,0,0,
+10355,0,0,18826,36201,39498,0,5246,7762,8083,0,2523,0,0,0,0,
+0,0,0,5151,19270,48300,29358,0,0,3674,43563,0,0,0,0,0,
+0,0,0,0,25590,0,0,0,0,8822,37995,0,0,48420,0,0,
+24150,0,3486,11771,14262,28989,0,0,0,10707,0,0,36864,10376,0,23911,
+16010,47125,0,17891,43306,18571,0,0,0,0,0,0,38174,0,0,5156,
+25713,14995,27654,42699,17704,18801,44754,0,40666,0,0,0,0,0,0,37081,
+0,0,28251,33021,13895,21813,38627,0,0,0,13589,0,0,0,39412,38947,
+0,0,0,0,0,15350,0,0,0,8955,0,0,0,0,0,0,
+16875,0,48276,29225,0,0,1055,0,0,45025,32540,0,15472,12154,0,28824,
+14471,31112,46970,0,46649,0,0,0,0,31515,0,0,39686,33873,45513,10767,
+42917,0,6720,30983,0,0,0,0,0,0,0,0,20529,0,0,0,
+0,0,0,25619,18797,43708,25897,0,6612,0,46429,21193,0,0,0,12698,
+45235,0,0,0,0,5523,15827,3942,0,36327,0,33909,25599,0,0,0,
+0,39241,0,40816,491,20546,45478,10799,22210,34010,40381,46020,0,0,0,37051,
+0,0,4262,14035,0,0,35488,0,0,0,0,30521,12462,13139,0,0,
+15713,0,18210,32314,15228,0,0,0,0,0,0,26867,42894,48272,7634,0,
+0,34346,0,0,45561,0,0,30607,15122,22878,30974,26051,0,0,37937,0,
+0,0,0,0,17231,46417,1065,0,0,0,0,21482,0,0,2643,0,
+0,23659,0,0,0,23121,0,0,0,0,0,36770,12466,23006,0,45544,
+0,0,0,22740,1419,0,44759,3206,21729,0,12201,0,0,0,0,0,
+0,10157,45138,0,0,5760,1451,27162,0,0,541,0,0,24277,0,0,
+0,4798,8805,40784,0,45227,0,0,0,0,0,30078,47053,12227,48124,0,
+0,0,21971,27190,14146,20917,0,0,13969,0,16114,19820,0,0,32378,21756,
+0,0,0,0,37505,0,0,0,40002,16288,0,13241,12389,26222,30185,33705,
+0,0,0,0,33125,32539,0,7552,43849,0,0,45581,0,18776,14443,48718,
+9458,15935,0,0,0,0,0,0,0,0,0,0,0,35478,0,0,
+0,0,0,42971,48839,0,0,23318,37418,15735,33876,15842,5457,25450,3653,31162,
+24121,0,38069,0,27410,0,0,0,22363,0,6984,13285,0,0,0,0,
+0,0,0,0,0,0,9340,25311,37784,0,0,18550,0,0,0,0,
+0,0,0,25647,0,0,0,31918,12278,7084,0,25681,0,0,22166,0,
+38532,42743,47888,0,0,9354,36567,39829,0,0,0,0,30817,0,0,37320,
+0,0,0,0,0,0,8714,11718,0,0,6108,0,0,24974,38185,39213,
+0,0,41186,0,0,0,0,0,0,36251,30570,12576,29748,41306,0,28591,
+36815,28972,0,0,0,0,0,31190,32112,0,0,0,0,0,0,0,
+27178,9001,34260,40023,23517,0,0,0,0,0,0,0,0,15037,31253,0,
+0,0,0,12363,0,0,43531,19263,15854,41219,0,0,0,27075,17024,42191,
+44583,0,0,0,0,0,46338,30462,16366,39153,48515,22415,9992,41310,0,19203,
+0,0,18643,0,0,0,37581,9528,32684,0,0,0,0,0,0,0,
+28208,0,0,0,0,0,0,0,0,0,23683,0,0,0,0,47107,
+0,8571,14895,0,5238,0,0,14623,0,0,17913,0,0,33938,13538,0,
+29382,45822,0,0,0,0,0,0,187,0,0,0,5120,0,0,0,
+0,34310,0,0,0,45972,0,44466,45471,0,0,0,0,0,0,40379,
+0,2965,4487,28790,19284,48738,0,43198,1846,22173,27430,30441,16407,13353,16800,28491,
+32669,0,0,0,22998,33855,0,0,0,19589,0,0,0,0,44129,0,
+18905,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+8705,35263,0,34289,0,0,0,37092,0,3124,36452,0,0,0,0,0,
+0,0,0,2847,0,0,0,0,0,0,0,0,0,0,47347,0,
+34223,9002,32496,0,0,0,0,8837,0,0,0,5956,17911,0,11637,0,
+0,44999,0,15675,8564,12653,15965,21424,0,0,0,0,0,0,0,0,
+32115,0,0,19546,46397,0,0,0,36123,0,2623,4813,10918,6693,41835,0,
+0,0,0,7986,11864,29345,38066,0,0,43939,2789,5206,0,21404,5902,0,
+12301,0,22799,0,0,0,0,0,0,0,46029,38399,24508,0,0,0,
+0,21908,0,0,18341,26563,7886,15063,9967,21394,0,30307,42140,42810,0,0,
+0,0,0,0,42496,14082,33282,20962,13970,22921,0,25630,42094,0,0,0,
+8201,23278,0,0,0,0,0,0,0,0,19634,15115,36807,39772,0,0,
+0,0,5376,0,0,0,10487,0,0,0,23502,0,0,0,40743,43575,
+0,10418,0,0,15491,0,0,0,0,29766,0,0,0,0,40535,0,
+45047,0,26359,43837,35803,0,0,0,0,0,0,0,2890,0,16493,5398,
+13485,19176,41525,13475,34103,1806,44942,45167,0,0,0,17536,0,0,0,45610,
+0,0,0,0,15438,0,0,0,0,0,0,30630,46974,0,19080,0,
+0,0,0,47899,32434,0,0,0,27563,21759,0,22091,0,0,23422,27916,
+26560,26701,45668,0,0,29797,39133,0,0,0,13177,38544,0,0,0,0,
+0,0,23165,42758,11983,0,0,0,0,33753,0,0,0,0,0,0,
+0,121,0,0,0,0,0,15676,0,0,0,0,0,0,0,20066,
+0,0,0,0,0,30802,0,2144,22502,0,0,0,25700,0,0,28066,
+32435,7133,3831,22427,28885,0,0,0,36386,0,0,39894,0,0,0,0,
+0,0,29978,773,48479,13421,20568,0,38800,0,0,28649,4868,0,50,0,
+0,46406,7903,0,29230,39893,0,1171,0,0,0,0,28109,10769,0,0,
+0,26571,34836,0,0,0,0,0,0,13090,28852,0,0,3707,0,5436,
+47815,29581,33056,9655,9815,0,0,0,0,24530,0,33659,0,0,0,5203,
+40522,33355,0,0,0,0,0,0,0,0,20995,35998,15217,40417,0,26004,
+0,32985,0,30358,0,11706,0,0,0,23467,33618,31819,0,0,0,1812,
+763,6952,24345,42904,29407,0,0,47918,38329,29174,45815,0,0,0,0,0,
+0,0,7877,0,0,0,38657,32300,0,0,0,0,0,17585,33599,1559,
+2804,25256,30118,38848,32693,27797,22435,33356,31886,34729,44823,27778,0,0,0,0,
+17275,0,0,0,0,0,41351,4205,0,0,0,29246,0,0,0,0,
+0,0,0,1674,0,28883,0,0,23098,1017,0,0,0,0,0,0,
+0,0,0,0,23398,28231,0,35907,0,0,0,0,14244,0,0,0,
+0,0,0,0,0,0,0,0,4395,0,0,0,0,0,0,0,
+30088,0,7758,0,35956,0,0,0,0,48205,0,0,0,0,0,0,
+0,0,0,0,34710,7798,0,0,44987,23086,0,0,0,0,34215,0,
+20677,22987,0,0,0,32579,25720,0,25035,43569,0,0,0,0,0,0,
+0,0,0,0,0,22413,0,0,0,0,37595,18031,0,0,0,0,
+0,0,0,6188,0,0,22298,0,2462,27460,8177,30508,35381,41190,0,0,
+0,45689,0,40748,0,0,0,0,2210,0,13381,24907,16730,35269,44798,0,
+0,0,0,0,17915,0,0,0,0,0,27570,0,0,41041,31840,0,
+0,5182,35389,41934,43012,0,0,0,0,0,0,13807,45966,0,0,28651,
+22005,0,38063,36406,6990,26276,0,0,0,35540,0,48082,0,16984,26594,24452,
+0,0,0,29188,0,0,0,0,0,0,0,45847,0,25415,0,0,
+30228,0,26888,32516,40257,40717,0,20,0,0,0,0,0,0,3784,10059,
+0,0,0,11742,5817,20849,0,0,0,7420,0,6874,0,0,0,41757,
+0,16484,8672,0,30177,9921,10158,0,0,1438,44802,21776,0,0,0,0,
+22357,30535,0,0,31534,32074,0,15357,33912,0,23337,33082,4397,0,24550,0,
+0,0,29688,1346,1639,5442,46156,0,0,0,4343,0,0,2788,13809,0,
+0,27896,0,0,0,0,0,15004,22306,0,0,0,1816,4442,0,0,
+20792,0,42763,653,29987,0,13318,0,0,13344,0,43407,0,0,0,8700,
+0,0,0,0,0,15339,38530,0,0,0,2570,28602,0,0,0,0,
+0,36338,0,0,0,0,0,0,0,0,0,39703,0,0,0,0,
+0,0,44090,0,0,10546,0,0,0,23881,0,0,0,24082,0,27107,
+0,0,0,0,19963,36779,0,0,47789,0,0,3530,48404,0,0,0,
+0,0,0,24789,0,0,0,0,0,35279,14406,19308,32414,0,0,19885,
+4287,0,15577,36881,12195,11121,23831,0,33632,0,0,0,28967,2162,0,0,
+0,40184,34510,0,0,0,0,8105,18237,39113,30116,0,48678,0,0,48494,
+0,0,0,40420,0,30697,0,0,0,0,0,0,24661,0,0,0,
+17759,0,0,0,0,0,0,21220,0,0,0,0,0,0,0,9304,
+19840,0,14292,16192,46549,24514,48633,0,9202,0,36355,0,0,0,3561,0,
+0,0,0,0,0,0,15736,16920,45198,0,37291,17134,44688,10619,18015,0,
+28586,0,17618,33762,0,0,18271,16560,0,0,41010,0,31658,0,907,0,
+0,0,0,0,0,10603,0,0,0,10967,0,2333,18457,20155,7148,22380,
+0,0,0,0,0,29783,0,25809,0,0,0,0,0,0,11052,0,
+0,0,0,0,32937,19195,10078,28452,0,12904,0,0,0,0,0,0,
+3154,2957,0,0,0,10775,0,15353,0,0,13384,0,0,0,25735,45786,
+14025,0,0,0,31603,0,0,0,0,0,0,21300,46236,34889,44571,0,
+0,0,610,0,0,0,0,8304,0,0,0,0,35182,0,0,0,
+5667,0,0,0,0,0,0,0,0,9860,0,0,0,0,0,0,
+0,0,44400,0,0,0,0,0,0,17932,19950,0,45759,921,0,12651,
+23850,0,10693,0,5643,0,0,0,0,28090,0,0,0,27700,28562,36578,
+42795,32647,37669,10106,46985,0,0,30988,31094,0,40261,0,0,0,0,0,
+43225,0,0,6610,0,0,0,0,0,0,0,0,0,0,0,15670,
+2453,31311,48875,0,0,0,0,39016,11696,0,9995,0,0,0,19279,47513,
+18730,18499,0,28802,12459,0,0,0,0,0,0,0,38361,45577,46838,0,
+0,0,29291,38245,0,0,0,0,0,5438,0,0,0,24922,37156,48193,
+25895,0,0,0,0,0,0,1798,0,0,0,46785,3550,0,0,0,
+0,0,41791,0,0,0,0,19607,47771,0,31748,0,0,24850,0,0,
+0,0,0,0,0,0,0,0,0,24044,48450,24013,0,0,0,42965,
+6991,0,0,0,0,0,0,9885,0,0,2590,27881,42513,39501,0,0,
+0,20211,0,0,33121,38244,41889,0,0,15100,0,0,0,0,48277,0,
+2780,8231,14789,44424,45122,0,19588,0,0,0,0,10036,42215,0,0,0,
+0,30483,32042,0,38321,4799,24857,0,0,0,46887,0,0,0,0,0,
+0,0,0,0,0,0,27607,0,0,0,0,0,8271,0,0,42711,
+0,38220,47379,0,24551,0,0,24250,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,39312,0,0,0,14,0,
+15653,0,0,0,0,0,0,0,0,0,0,0,0,7430,48089,0,
+0,0,8027,26732,0,0,0,0,0,0,0,0,0,4911,15938,27955,
+28748,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21336,
+512,1668,37088,0,0,0,0,0,0,0,43329,0,0,38660,0,37027,
+31315,0,30553,27561,0,0,0,0,0,5653,0,0,17553,0,0,0,
+0,0,20300,28781,0,0,0,0,0,0,33122,0,0,0,42948,0,
+26284,10934,24956,18486,0,9238,26049,0,0,0,0,0,27533,28232,0,0,
+0,4692,0,0,0,0,0,15042,18637,0,16220,0,0,0,0,0,
+31618,0,0,0,0,0,0,3058,0,0,0,36665,2956,22662,24078,16376,
+0,0,0,0,48051,0,48092,0,0,0,23638,41907,0,0,0,0,
+5862,40574,0,21835,9358,0,33413,25011,0,0,88,17117,0,0,0,12858,
+0,0,2153,0,0,0,0,16342,33702,0,4960,0,0,0,0,40174,
+0,0,0,0,0,0,0,48364,0,23097,29072,24196,29646,36627,0,0,
+0,3802,0,0,0,0,1297,13042,23014,37798,42576,37347,46188,33397,0,22892,
+0,0,29214,0,24635,4769,0,0,0,30150,5267,37074,14797,30522,37570,30623,
+46378,31389,0,0,0,0,0,45949,0,0,0,1527,0,13722,0,18927,
+19485,0,0,0,0,0,0,0,0,40502,0,0,0,40305,0,0,
+0,19216,0,0,0,0,0,17572,17848,45659,0,0,38263,0,0,0,
+0,0,0,0,0,0,44433,0,33251,0,0,0,24691,2866,0,0,
+0,0,2267,0,18558,0,0,0,0,0,0,21335,0,10483,9862,0,
+13438,22066,0,0,0,43203,0,0,0,0,0,5714,0,45512,0,0,
+0,9610,0,0,30061,33437,0,0,0,0,0,44493,0,32988,0,0,
+0,0,1894,4952,35893,0,0,18510,0,21154,0,0,0,0,9197,0,
+0,4784,0,0,12884,0,0,14810,2644,40268,1616,0,0,0,0,17613,
+0,0,37475,0,0,37116,45128,0,44614,0,0,45662,5456,0,0,0,
+18623,0,0,0,0,39070,0,0,0,0,0,0,0,0,0,35887,
+0,0,30253,0,4453,16668,0,0,0,0,0,9251,0,0,0,0,
+0,0,0,37613,0,0,0,0,9905,0,0,0,0,26362,0,0,
+0,0,32397,0,15121,22959,0,0,22384,16583,0,0,0,35811,0,0,
+12002,37614,44245,0,0,19276,0,1596,15450,0,0,0,0,26657,0,28636,
+0,0,0,0,0,0,0,0,0,0,0,0,40151,0,0,0,
+0,0,33648,0,0,15801,26912,0,0,28901,0,0,0,28539,0,0,
+611,0,0,0,43601,0,0,0,0,0,0,0,0,9432,0,0,
+0,0,0,4150,0,0,0,0,31660,33064,36083,36666,0,0,0,44144,
+0,30497,0,0,0,0,0,0,23551,35738,0,0,0,0,0,16018,
+22319,29674,31854,14864,31970,40356,48098,0,0,0,0,0,0,0,0,18777,
+0,0,36344,0,0,11419,44020,0,0,0,5244,30294,44562,0,0,0,
+6077,0,30686,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,23473,1366,0,0,0,0,3559,23994,34570,42286,0,0,0,345,
+6363,30442,37874,46833,0,0,0,0,0,0,0,0,799,35848,0,0,
+0,0,10005,26318,32830,0,47065,0,0,0,8085,0,0,0,30946,48291,
+0,0,0,0,21827,38489,24910,0,0,0,0,0,0,0,26504,0,
+466,0,0,36188,0,18146,0,0,0,0,0,33905,0,0,0,24902,
+0,23113,0,0,0,12084,0,0,15360,42068,42853,0,0,0,0,13754,
+0,0,0,5736,5894,19966,0,0,0,0,33224,9940,17878,32703,0,9144,
+0,3794,41270,0,22734,0,0,18617,0,29112,0,0,9754,0,0,6724,
+6697,0,0,0,18116,0,0,5346,26321,0,35468,0,0,0,0,0,
+0,23639,17441,0,0,0,0,18580,0,0,0,429,0,0,0,0,
+0,0,0,6228,16902,0,0,0,0,20632,0,0,0,0,24284,1137,
+44654,0,0,0,32466,0,0,0,0,44228,0,0,0,0,21067,0,
+46315,0,0,0,0,0,46853,0,0,25804,0,0,0,0,0,0,
+6791,0,0,0,0,0,0,0,0,0,0,0,30562,0,0,0,
+0,0,0,29577,0,0,0,0,7363,0,26704,0,9700,0,31417,43638,
+0,0,0,0,0,0,0,0,7665,19583,17706,18678,0,0,3833,0,
+0,0,0,37857,15242,24544,47493,0,0,0,15376,0,15204,0,0,0,
+9513,35953,42808,46862,21164,0,0,0,0,0,0,43929,0,0,0,0,
+0,0,0,2212,38808,20028,0,0,0,0,31079,1305,24695,28606,10321,40215,
+0,0,0,0,0,22508,0,0,0,0,25863,14273,0,0,0,0,
+22524,15385,3453,16091,38755,47329,5954,0,6505,0,0,8828,32707,2814,15351,26157,
+38305,25531,0,17940,0,21256,17085,22269,22977,0,0,37961,0,0,36518,0,
+0,38713,30608,0,1848,0,29368,0,0,0,25571,46254,40704,0,0,0,
+0,42112,0,0,0,46227,45060,2183,8616,36153,47965,9223,0,0,0,0,
+34219,0,34679,0,0,19860,0,0,13906,0,0,0,14976,5071,48425,0,
+0,0,0,0,0,1000,0,11327,0,0,0,0,0,0,8988,0,
+38483,0,11002,0,0,0,19974,15147,36936,10337,0,0,0,0,0,18563,
+0,0,29816,0,0,10434,43557,0,0,0,19493,26082,6316,28291,25527,2231,
+27878,29071,35405,41457,44877,0,0,0,0,0,0,0,0,0,0,31159,
+0,0,0,41099,34230,5582,0,0,0,17518,24554,0,0,16775,0,459,
+0,0,31758,0,0,0,0,45224,0,0,0,2097,0,0,0,0,
+0,28533,0,0,0,0,0,31053,0,0,0,0,24861,0,0,0,
+0,0,0,39762,44322,35723,0,0,5472,14102,0,0,0,0,0,0,
+0,17234,0,16480,3634,11909,17755,0,28261,21005,0,0,0,0,0,0,
+0,0,16242,0,0,0,46336,0,0,0,42139,47539,0,0,0,0,
+0,29511,0,35211,0,0,0,29177,0,38933,0,5907,17884,29828,0,0,
+0,0,22295,46153,31713,36703,44312,0,0,0,0,0,0,43099,22053,39989,
+0,17016,23573,0,0,13035,0,0,0,0,18566,43052,0,33051,0,33595,
+0,0,0,0,0,0,0,0,0,0,0,31164,0,0,32286,36476,
+48035,0,0,0,47429,0,40190,36322,0,25673,0,0,0,0,0,29501,
+0,22514,0,0,0,0,0,13727,0,0,12304,0,0,38365,14431,0,
+0,6966,0,4663,41485,7374,0,18384,19427,23974,9573,44698,31793,28488,0,0,
+0,34717,0,0,0,0,0,0,5555,7508,35044,0,0,0,0,9652,
+7492,0,0,13513,0,0,31959,34519,0,0,0,0,0,22863,0,11362,
+45621,0,40877,0,0,0,0,0,0,31820,0,0,0,42592,0,0,
+0,46968,4276,0,0,0,0,20934,0,5088,26073,39342,14645,0,0,13931,
+14497,0,0,0,0,0,0,0,0,8819,0,0,321,0,0,0,
+0,0,7368,29315,0,0,0,0,0,0,39664,0,32256,0,17327,0,
+0,0,5688,19413,22117,25358,0,0,27053,0,0,0,15324,0,11710,0,
+33102,13771,0,0,0,0,0,23011,0,23367,28457,0,0,0,0,1360,
+0,0,15331,0,33584,46244,6758,0,0,0,31415,0,0,0,7311,46738,
+0,0,0,0,0,43475,0,0,0,0,0,94,45499,8789,0,0,
+0,4559,0,0,43191,0,0,0,28966,0,0,9335,0,0,0,47381,
+47460,0,0,0,0,0,0,43305,0,26645,21650,1924,18774,0,0,0,
+0,0,0,16845,0,0,0,47177,0,0,0,0,33874,0,807,0,
+0,0,0,0,2017,0,0,0,0,0,0,0,0,2291,14535,0,
+0,0,0,0,46054,48471,0,44659,34212,0,0,0,0,0,1506,45405,
+0,0,68,0,0,0,0,7225,0,0,0,0,0,35143,0,0,
+3442,0,47127,42673,43077,0,39925,0,0,0,1136,28478,45074,46507,0,0,
+0,0,0,3941,0,0,37207,8185,28129,0,0,0,0,16840,35144,0,
+19383,36705,22349,0,7212,22933,36191,22814,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,16749,0,0,0,0,0,0,0,6640,38769,
+0,20233,20799,25279,0,0,0,0,0,0,0,0,40026,18066,27241,37205,
+0,0,0,0,312,0,0,16302,0,0,0,8047,12499,33236,41545,45857,
+15225,25352,48608,29026,0,0,0,19005,43650,0,40990,0,25263,4147,34579,0,
+0,0,0,0,0,0,0,0,0,0,22728,0,0,0,0,0,
+0,0,0,0,0,0,23539,0,0,1557,13914,19830,40441,0,0,0,
+43919,27264,34207,760,0,15761,0,44633,0,0,0,6512,17411,21436,30448,0,
+31606,14118,14584,33798,40030,41067,43576,0,0,0,0,0,0,29695,0,0,
+47108,0,15916,0,0,0,0,0,0,0,0,40171,696,6815,20633,43102,
+0,0,0,29680,0,0,0,38192,0,18114,0,0,0,0,0,0,
+0,36642,26345,22369,0,31025,0,0,39671,0,2449,0,0,37512,0,0,
+29593,9480,28033,26876,45615,0,0,0,0,41571,0,0,47817,0,0,0,
+8790,30841,20499,32779,12733,0,39157,0,0,14305,0,0,0,0,0,0,
+1574,0,0,0,27479,0,13265,41841,0,0,36647,13350,16069,0,14685,32664,
+0,25024,0,24503,0,0,0,7611,0,0,0,16061,0,0,25459,0,
+0,42526,0,24023,0,853,0,2545,0,25951,0,13160,0,41620,0,0,
+0,0,0,0,0,47269,0,0,5430,0,0,0,0,0,31724,0,
+0,0,0,0,32611,37891,0,0,0,0,0,34769,0,0,0,0,
+0,0,0,0,0,16980,47082,0,0,0,7303,0,27837,6856,37575,0,
+30745,35106,5814,6249,20646,0,31486,0,0,33856,41656,0,0,0,0,0,
+20585,0,0,0,35526,0,8247,28076,0,45279,0,0,0,42148,0,11813,
+0,0,0,8052,0,0,41786,0,25322,19274,0,0,0,0,0,24400,
+0,0,1712,0,0,0,4521,0,715,0,25907,0,0,33284,0,42637,
+0,0,0,0,0,36630,0,44837,0,0,0,0,0,32474,0,45585,
+0,0,0,18079,27073,8053,28000,0,4206,47454,0,0,0,0,21861,0,
+0,0,0,0,0,2968,0,0,0,0,0,32841,33888,0,45718,0,
+0,0,0,0,0,0,0,0,0,0,0,30733,42172,0,0,0,
+0,0,31931,0,0,9368,13292,0,0,18007,23127,47596,26501,0,16429,0,
+19275,44496,0,0,0,0,0,0,0,0,14313,0,17756,34161,0,28865,
+0,0,0,16306,33233,48822,26587,0,0,14754,0,0,41105,0,32147,38433,
+17729,0,16328,0,0,0,0,0,0,33694,0,10957,0,0,0,40298,
+5478,0,38716,0,39258,0,0,0,0,0,13024,34343,0,0,0,36843,
+47574,0,0,19120,0,0,0,0,24528,0,0,12556,0,0,0,0,
+0,0,10391,0,0,0,0,43574,0,0,0,981,23405,0,0,18273,
+0,36810,0,0,0,0,816,20505,0,9452,6072,25372,0,29573,0,0,
+13981,41490,0,18262,28939,0,34008,0,0,35172,47622,43357,22534,0,0,6574,
+0,0,0,0,16260,1330,36227,19278,26627,0,0,0,0,17216,0,0,
+0,0,0,0,0,0,27747,0,0,0,0,0,0,0,0,2758,
+46071,10549,0,14542,0,0,0,34558,0,14093,20516,31374,34521,32811,40015,0,
+8985,0,30978,40212,0,0,0,16887,0,0,31085,0,5040,0,0,9174,
+0,30941,38810,40463,0,0,3314,29077,0,16362,0,0,0,0,0,30198,
+0,0,0,35183,28010,0,0,21651,0,0,0,40195,10185,0,0,23461,
+15364,0,0,0,0,11715,0,0,11025,43210,42141,0,0,0,0,0,
+33958,0,0,0,27011,0,0,0,1111,0,0,0,0,22443,0,48417,
+0,0,0,0,0,0,0,0,0,0,0,2431,0,0,0,0,
+1691,46009,0,1820,0,0,0,38910,943,0,12417,0,19106,0,0,0,
+0,0,5576,0,39010,0,24798,40698,0,0,43467,0,0,0,0,10937,
+41891,4661,0,0,1085,0,30090,31026,0,0,0,18244,0,0,20106,0,
+0,0,0,0,0,9494,0,0,5939,2634,47897,0,0,0,0,17639,
+0,7331,7730,26980,0,0,0,0,5706,0,0,14944,22951,46272,0,4441,
+0,0,0,0,0,0,41773,20662,23686,0,0,0,8843,0,0,17299,
+0,34960,0,11465,16567,25383,0,0,0,0,0,0,0,0,0,0,
+29169,23256,0,0,0,0,0,0,0,0,0,0,0,24061,37237,0,
+30724,48705,8857,0,0,0,0,0,0,22120,0,5195,0,0,0,9784,
+15961,21680,31943,0,0,0,8611,17574,45380,4730,0,9263,11879,15843,29922,0,
+25607,0,0,0,0,0,0,11164,0,2943,0,16160,34242,0,0,0,
+0,33185,11789,9760,0,0,0,0,0,26913,0,15606,31181,44954,0,0,
+16756,0,0,43911,0,0,0,0,0,0,0,12925,35513,0,23457,23830,
+0,0,0,13666,39265,0,0,12390,0,0,0,39706,21258,0,43739,9347,
+0,0,0,0,0,0,0,0,0,165,30443,0,0,21606,23669,0,
+36640,0,17820,0,0,0,0,38225,0,0,21157,41244,8038,36420,8511,17415,
+16299,0,0,0,0,0,0,45188,16221,0,16418,0,0,0,0,2662,
+0,0,17523,40464,48359,21921,22928,0,31485,0,0,0,0,0,45691,0,
+0,0,9674,31173,0,8916,22154,0,0,0,9245,0,22856,0,36920,46391,
+0,0,21886,0,0,0,0,0,0,0,0,0,0,0,39801,4586,
+16360,0,38385,0,0,0,0,0,0,43331,0,0,24845,2573,0,46205,
+0,0,0,0,0,0,11589,6055,0,0,0,0,0,0,0,25915,
+0,0,0,0,0,20868,0,0,0,0,0,0,0,0,15116,0,
+36158,37258,41416,0,0,0,0,0,967,0,0,0,32646,19296,0,0,
+0,0,26174,29057,0,0,0,0,38542,0,0,0,0,0,92,21299,
+0,23883,0,28820,31387,27617,0,0,0,0,9512,0,0,0,40411,42236,
+0,0,0,0,12495,38179,25267,0,0,23953,28169,45890,0,0,126,24672,
+0,0,0,7511,15994,0,0,0,0,0,0,26166,0,0,0,38453,
+14919,0,0,0,40614,10427,0,0,0,43764,18287,0,0,42693,40334,0,
+0,0,0,26939,27938,21496,6290,0,0,40479,22520,0,0,0,13239,2015,
+20717,27155,31728,45582,47437,0,0,0,0,84,27937,0,0,6450,0,0,
+32768,37994,0,18823,10060,40673,0,0,0,30041,0,0,0,0,0,0,
+0,0,0,0,0,0,35906,0,47957,37236,0,0,0,0,0,0,
+0,0,0,0,4555,0,0,0,15142,0,40442,30136,30901,34636,0,0,
+0,0,21232,40058,0,0,9831,0,0,0,28637,11062,26258,40783,38114,3122,
+40491,33781,38333,4266,24915,27935,41414,42471,31908,12885,8081,25002,31510,0,0,0,
+1651,9474,37915,0,47166,0,0,4594,20337,0,0,0,0,0,20624,0,
+39697,0,0,0,0,0,0,0,37683,0,0,0,39548,5574,10923,0,
+0,0,0,0,0,10722,32291,42831,13830,32361,0,14704,0,34781,13145,0,
+0,0,0,38984,0,26195,0,0,0,43242,0,0,0,0,0,11648,
+0,0,0,0,0,0,0,0,20990,0,0,5081,0,20517,0,201,
+5730,14276,20240,40749,46101,0,26496,0,19779,26108,0,0,28866,15897,45154,31718,
+0,5336,0,0,0,0,0,0,4805,0,20730,0,0,35461,0,3332,
+33432,0,38373,42007,0,0,0,0,0,0,0,0,0,0,23757,0,
+0,38871,27801,0,0,18654,0,7978,32260,0,16924,22571,47078,18950,40338,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,9070,0,0,
+18238,16927,0,0,0,0,0,0,27296,0,13020,6857,34459,9937,12875,37602,
+21897,1560,39714,45366,48890,0,0,0,0,0,0,0,0,0,0,23171,
+28300,16457,0,2688,32385,8547,0,0,0,30016,21379,3657,0,9955,0,33255,
+29011,40316,23871,24674,45902,5918,21036,39946,0,0,0,0,0,0,0,32631,
+1172,45414,0,0,0,0,0,0,0,23944,32025,0,0,0,4218,0,
+0,48628,0,14780,87,0,0,0,0,0,0,0,9887,3473,0,0,
+0,0,0,0,0,10521,0,0,18348,0,0,0,0,0,0,40252,
+48264,0,0,0,2234,13109,33915,20641,18893,1529,36224,38760,19990,19874,43966,46529,
+18035,0,18239,0,0,17509,1829,32681,29540,0,47340,0,17833,0,44702,38607,
+48775,32866,16922,45099,22027,0,0,0,0,0,0,29817,0,0,0,0,
+0,0,0,0,0,591,0,0,0,0,0,0,0,2625,0,0,
+172,11230,0,0,0,17181,0,0,14101,7545,29318,35977,0,0,0,0,
+0,0,0,0,0,0,0,2107,7115,15870,9682,36316,0,0,0,21890,
+0,0,0,0,0,8679,17178,23626,38151,6929,0,0,0,0,0,1497,
+1909,16742,0,0,37238,28670,7402,9589,27494,38714,39394,0,0,0,0,0,
+0,0,34601,0,0,1019,34098,12996,15211,0,0,0,17408,0,0,11515,
+3068,0,0,15966,0,17837,0,47178,0,0,0,0,0,0,38795,0,
+1788,9632,0,0,0,25606,24210,43465,0,0,0,0,0,0,0,5379,
+5652,20406,40598,44197,0,0,0,0,0,32860,36047,0,0,0,13365,18429,
+21939,0,0,1048,0,0,22818,39464,0,32657,0,9094,0,0,38979,0,
+33615,0,33312,0,27609,46911,0,8143,31314,23599,33444,47324,0,0,0,5811,
+0,0,0,0,0,0,34950,0,43364,0,0,0,0,0,6523,0,
+0,0,0,16170,38002,0,0,0,0,0,0,7582,37279,0,184,982,
+0,0,0,0,0,235,9043,0,0,0,18295,0,0,21003,0,0,
+0,0,0,0,35290,39631,40069,14488,0,0,0,0,0,0,45942,17849,
+26230,0,43184,11711,18104,0,0,0,8797,0,0,0,0,0,0,22619,
+0,0,0,40568,0,0,7186,0,0,0,0,0,0,9090,10688,0,
+0,573,0,0,0,0,0,0,0,26348,0,0,16375,0,0,0,
+0,0,0,0,0,0,0,25900,29445,15846,1534,0,0,35873,40799,0,
+27305,28413,37965,26215,0,0,7146,34955,0,0,24654,19328,47414,3143,0,0,
+0,0,29910,39530,11123,13386,5405,34657,46220,39427,14923,48614,7444,0,0,0,
+46154,7382,13114,0,0,0,39307,17712,0,36566,0,0,0,0,38863,0,
+0,36888,37822,37522,18729,21753,46926,30329,48285,0,0,0,43907,0,0,33628,
+34225,0,44563,0,0,17995,29535,12073,39549,1792,19081,0,0,0,0,0,
+0,0,0,0,0,0,0,0,21456,0,0,12071,35445,43699,0,0,
+0,0,0,0,0,0,0,0,0,9128,0,31787,0,28319,0,0,
+0,0,0,9015,0,18688,1973,0,0,0,0,0,0,0,0,0,
+0,41884,0,0,20305,0,3879,13916,0,0,24570,41629,0,0,0,0,
+29280,0,0,41251,0,0,0,44861,0,0,0,39380,0,0,0,3215,
+19961,13214,26246,31482,42888,48591,15678,0,0,0,14457,0,0,0,17994,0,
+0,0,0,43015,43304,0,6767,0,43131,23695,0,0,0,0,38034,0,
+0,0,31500,0,0,0,48239,0,0,0,43162,44166,22019,0,0,0,
+0,0,24003,39391,42963,0,0,9283,0,0,0,0,0,27835,29738,0,
+44664,31054,0,0,0,0,17017,0,0,0,0,0,0,0,0,0,
+13792,4023,12117,30998,7656,14311,4445,18270,32129,41646,12121,0,0,8039,0,0,
+0,1496,2794,25744,0,0,0,17804,0,0,0,0,0,0,0,45071,
+0,0,0,0,20435,5904,7661,18096,23255,0,0,0,46219,0,0,0,
+0,0,0,13881,0,0,0,0,0,44232,39722,12990,0,0,0,0,
+48877,16140,25221,44779,45196,0,0,48687,0,35868,0,0,0,5625,0,0,
+0,0,0,16037,0,0,2480,35465,38816,23729,46334,3773,0,0,37494,0,
+0,0,0,0,0,24930,0,0,29519,27201,0,0,0,0,0,0,
+24132,28295,0,0,11494,18102,28456,0,5880,30917,39922,24247,16897,0,0,33794,
+0,23778,0,0,0,0,0,8890,0,0,0,42320,0,0,36909,13027,
+30187,0,0,0,0,42726,13545,13,21307,15793,18047,20701,9764,34487,0,0,
+0,0,0,26063,0,0,11594,14224,0,0,0,0,0,0,24419,38932,
+0,0,27571,11545,0,0,0,26825,21618,0,10652,44048,32258,7861,0,0,
+0,0,0,13688,44248,0,0,0,26989,13028,20250,22122,17632,31757,14773,41226,
+48110,0,28486,40926,0,0,0,8162,0,26566,0,0,15334,34629,0,0,
+0,0,0,0,0,0,0,0,1653,26484,0,33600,0,8553,43596,0,
+0,37337,24501,20530,9402,0,0,0,0,12991,4814,34992,0,0,28771,12999,
+0,0,0,0,0,0,0,43649,0,0,0,33160,27964,0,0,0,
+0,0,3732,27369,18292,0,32182,0,0,39490,3522,0,20294,0,27195,5845,
+42447,0,0,0,0,23476,0,0,30021,1152,0,0,0,15195,18548,0,
+40815,41006,0,0,0,4630,0,2209,24790,36828,23375,0,4035,23470,0,0,
+47549,36339,0,0,14729,0,0,0,0,0,38446,0,0,0,0,0,
+16995,0,0,0,0,8248,0,0,0,0,0,29276,0,0,0,0,
+0,5806,3765,26674,47484,0,0,0,32932,1858,31596,36183,37757,0,34299,0,
+0,28737,0,0,26933,0,0,35774,0,0,4638,45524,39661,0,0,34143,
+0,38119,41496,0,0,890,0,26522,0,0,0,25261,0,0,0,0,
+0,0,42124,0,14648,0,0,7327,0,42249,0,0,0,0,42677,6969,
+18748,41319,22855,0,0,36249,0,16363,42706,0,0,13295,20769,46866,0,13383,
+36827,0,9164,3652,24270,0,0,4723,14875,5008,29263,24139,29290,0,0,0,
+0,0,0,0,0,7969,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,33075,0,3490,39107,0,
+15088,0,0,9558,0,12014,0,0,0,0,0,0,0,25226,41563,0,
+0,0,0,0,0,0,40167,0,0,0,0,0,13605,1116,0,0,
+5702,0,0,46454,9316,0,1768,0,0,0,0,0,47066,0,0,0,
+0,0,0,3259,46202,0,0,37363,0,22710,40387,4740,0,6582,0,11776,
+0,34015,0,42314,0,0,28234,0,0,0,0,11721,46492,0,29954,0,
+20034,0,1488,0,0,20545,0,32272,0,0,0,30496,0,42672,0,5086,
+0,47126,48654,0,25770,24135,0,0,46357,0,0,0,0,0,0,0,
+11153,25274,27160,28384,0,44183,0,12483,0,0,0,0,0,24660,0,5089,
+31466,33084,8050,41073,0,0,29576,30145,0,0,38943,23107,29451,0,0,1827,
+626,13994,24473,25402,30867,40258,47830,0,0,0,0,15244,40855,45430,0,0,
+0,33130,0,0,0,0,0,0,46621,0,0,0,0,0,11632,15734,
+15138,28946,10515,32678,0,0,0,40352,0,0,0,0,0,8581,37350,0,
+12298,0,0,17555,32848,0,0,0,0,0,16146,39333,43324,0,0,0,
+0,0,0,0,0,0,0,10055,3950,17584,35742,0,0,0,0,0,
+0,0,16733,0,0,0,0,0,0,0,11745,2207,19103,0,0,0,
+0,0,0,0,0,0,0,29249,15687,0,0,0,24741,0,0,0,
+0,0,767,13696,0,8818,0,22552,0,0,0,26203,33982,39777,44085,0,
+0,0,0,0,46386,0,38045,14009,29347,35025,0,0,0,2445,15095,0,
+0,9662,47715,30076,22741,0,0,0,22162,9196,32804,0,0,0,1688,0,
+0,0,0,0,988,24808,0,0,21461,35702,29140,0,32746,33511,39065,42299,
+48735,45355,0,24395,32116,0,0,9894,32522,0,0,0,0,0,0,0,
+0,0,0,27926,0,0,0,0,0,0,25919,0,0,0,46110,0,
+34845,0,0,9260,0,0,0,25865,23856,17599,23530,0,0,0,0,42366,
+0,37206,0,18000,0,0,48017,38449,0,6799,0,0,0,0,6194,0,
+0,0,0,0,39168,48372,0,22065,0,0,14885,0,0,0,0,0,
+45643,10495,0,0,27580,0,42333,0,0,31868,0,0,30718,0,0,0,
+18739,0,12743,34373,0,0,0,0,0,0,22939,10033,0,32162,0,41357,
+0,0,0,27386,0,21969,0,0,39569,33477,24252,0,0,0,0,17400,
+0,0,1807,0,0,0,9780,34378,0,0,23096,12736,24235,600,0,0,
+0,43188,0,0,0,0,0,38666,0,10645,0,0,0,0,0,0,
+0,25118,0,0,12112,35537,0,16009,0,0,0,0,0,0,0,31439,
+0,0,0,0,0,19880,0,0,6876,47251,0,0,0,43734,0,0,
+16679,39988,0,28442,0,0,0,0,0,0,0,0,20994,0,38711,17744,
+0,0,0,0,30375,42179,9418,0,0,26147,0,0,0,17341,0,0,
+0,0,0,14696,0,0,46819,44990,0,0,21752,26391,0,0,0,0,
+0,18057,0,0,39273,2984,20954,8001,0,0,0,0,16812,0,0,0,
+0,0,0,5516,0,0,0,0,0,0,0,40571,0,0,25227,0,
+28936,33143,23786,0,0,10914,0,0,2044,0,20296,0,0,0,37990,0,
+0,0,37198,0,24113,6381,44302,17974,0,4899,0,0,0,43716,0,0,
+0,0,37906,0,0,22087,0,31351,0,0,24350,31853,0,0,0,10382,
+0,19384,0,0,19529,11626,35476,46245,12045,21984,46810,17397,8963,0,15581,0,
+0,0,12981,0,0,38223,0,0,0,0,24332,0,0,0,8246,0,
+0,0,0,44120,0,0,0,0,45006,0,0,0,0,7840,18308,2461,
+12167,3059,22970,0,0,0,0,0,0,0,26338,36985,0,0,0,16634,
+0,23175,0,0,0,0,6119,15556,43241,0,0,17883,0,35716,19650,42358,
+0,0,0,0,0,4284,46284,13113,30722,0,48165,0,21931,0,40466,0,
+0,0,30627,0,2666,0,422,0,11122,6050,0,33662,48816,11466,8183,14737,
+43127,0,0,0,0,0,0,36063,0,0,0,0,0,0,47301,0,
+20086,0,0,0,1503,34970,0,0,19924,22077,39348,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,6567,0,
+47466,0,0,18964,2862,0,29564,0,0,0,0,0,5723,0,10687,47416,
+0,0,0,0,0,0,0,0,0,34965,0,0,0,0,0,0,
+9253,0,18037,0,0,19174,0,0,0,31015,0,18517,40413,0,31826,0,
+0,0,0,0,0,0,0,0,12569,0,0,0,18841,23010,11137,0,
+0,0,0,0,0,0,0,0,6308,0,0,0,12791,48712,0,0,
+0,0,4416,339,21027,0,0,0,0,1718,0,37241,0,0,0,23064,
+0,0,0,0,0,0,16145,8592,0,0,8699,0,0,0,0,0,
+0,0,0,0,4181,0,20303,0,0,0,0,0,0,5421,0,406,
+2091,45382,0,17964,0,0,0,0,0,6343,0,0,0,0,0,0,
+43923,4918,8283,0,0,13971,0,0,0,0,0,0,0,0,0,0,
+0,11069,25934,0,2074,0,0,0,0,0,0,0,14655,0,0,10282,
+0,0,0,29644,0,0,0,8958,32535,0,0,10786,0,0,0,0,
+0,0,0,0,37119,0,0,0,0,0,0,0,0,0,48393,0,
+0,0,0,0,0,0,0,43123,0,7898,27389,23185,39180,16528,45022,0,
+0,0,7629,29687,0,0,0,0,1637,26041,20195,0,0,16607,0,0,
+0,13223,0,0,0,0,0,0,2276,0,0,0,0,2883,30783,8908,
+34786,45641,0,0,0,0,0,4500,14090,0,35097,0,0,7733,14874,0,
+0,0,0,0,31899,0,0,3529,22280,22361,27909,0,0,13827,0,0,
+0,20214,20397,0,0,0,0,0,0,0,1838,7755,37635,0,0,31921,
+0,0,4741,38422,0,0,0,47658,0,45370,0,33177,0,0,33105,30527,
+28103,0,0,0,0,0,0,0,46312,0,0,0,0,13853,23524,0,
+0,27994,0,0,19065,0,0,0,0,0,17652,282,0,8784,33147,42518,
+0,19461,0,0,32392,0,0,0,13542,42970,0,3356,3301,25005,0,0,
+0,0,0,36816,34676,0,0,0,0,40846,0,0,0,0,0,487,
+0,0,0,0,0,0,28522,15574,2565,0,60,9778,39187,44283,0,0,
+0,0,0,3825,7056,0,0,0,26565,0,0,0,0,0,0,0,
+0,0,27952,0,0,45216,1415,0,0,0,0,17366,4451,0,0,707,
+0,0,18746,25912,26994,34843,34928,0,0,12178,0,24304,34918,12711,0,0,
+0,0,0,11032,48434,5161,0,13459,41154,0,0,43444,0,47247,2477,0,
+0,21683,0,7763,0,0,21104,0,0,0,0,26401,28594,23701,0,0,
+0,0,0,8419,36574,0,2296,6399,32145,48582,0,0,0,0,40631,0,
+0,0,8322,0,0,0,0,36450,18460,29129,44588,46676,0,0,0,0,
+0,0,18931,0,0,0,19261,0,0,0,23135,0,0,0,16443,13641,
+29349,0,0,48101,0,0,0,0,31536,34590,0,0,14742,33551,38350,9307,
+0,28965,31788,0,14239,24515,47633,0,0,0,0,0,8371,0,0,0,
+0,21687,31128,0,0,0,0,29094,18977,0,3614,0,0,0,0,38036,
+0,3468,11185,0,0,0,0,45944,0,0,28078,20697,28582,0,24574,30347,
+33738,0,0,0,15741,15830,41494,0,4701,19639,0,46938,0,27380,3364,0,
+0,669,12406,15533,0,0,0,0,0,0,0,0,266,32165,0,0,
+0,0,0,39514,5746,0,4988,8588,37734,0,0,0,0,2189,0,32429,
+0,46885,0,0,0,0,11757,0,0,0,0,0,0,45558,11878,0,
+0,0,44031,0,0,24314,43666,0,0,14108,0,0,0,0,0,18245,
+0,16408,36597,35473,0,0,0,0,31553,0,0,0,0,37717,0,0,
+0,0,0,0,0,0,0,0,0,0,0,35167,0,42475,0,0,
+0,0,27367,39517,45602,42061,0,0,0,0,0,0,0,0,0,43333,
+0,0,0,0,0,0,0,0,0,0,9403,0,0,0,0,0,
+0,0,0,0,0,0,0,4293,0,44538,0,25558,0,0,2306,38939,
+0,23293,0,2284,8415,34765,2762,9179,0,0,38480,0,0,0,5494,0,
+0,37903,0,34415,0,0,0,29561,10572,0,14934,26193,0,27125,4631,16926,
+0,0,0,0,0,0,28950,0,0,23782,30848,0,0,0,0,0,
+12790,46393,0,0,0,0,0,0,0,0,0,0,0,40675,0,19920,
+261,0,0,25034,0,1541,0,37256,0,0,21785,0,0,0,0,33319,
+46304,48681,40583,0,0,12160,43109,0,0,11714,25125,1351,29070,0,0,966,
+32084,0,1156,10595,11204,0,0,28581,0,0,0,0,22936,12351,29649,25401,
+0,10126,28136,7834,32960,0,0,0,30468,0,0,25650,0,0,0,0,
+11606,47583,0,20464,0,1863,20556,0,0,0,0,21889,32294,0,0,28028,
+24771,936,44517,0,0,11889,37530,0,0,0,9511,0,0,0,0,0,
+4294,34275,48441,21818,0,0,0,0,41467,42151,0,35296,0,0,0,33777,
+0,0,0,0,0,0,0,0,26961,0,0,0,0,0,0,37722,
+0,0,12820,12190,0,0,0,0,44041,9143,0,0,0,0,0,0,
+33293,0,0,0,44879,0,0,0,0,31869,0,113,48846,0,0,0,
+0,7053,0,26093,0,0,47710,0,0,0,26592,15578,0,0,13826,0,
+0,0,0,0,0,0,0,0,0,11548,40219,0,26616,0,0,17881,
+0,39628,0,0,6530,0,28677,39458,15837,44892,0,0,0,0,10653,6705,
+17398,41156,0,2930,40711,0,0,11199,17170,44594,31834,0,0,33304,0,31236,
+0,25480,16127,26464,6402,30987,19196,42946,0,0,0,30262,10131,34253,0,0,
+35884,1247,8987,38319,16569,5278,11801,37591,42707,0,0,0,0,33212,0,0,
+0,39140,0,0,0,0,0,0,12920,30009,0,13783,0,0,31475,0,
+0,0,7063,0,0,14622,0,0,0,0,6491,0,20009,1336,0,0,
+38849,0,35767,798,3051,0,9685,0,0,0,6989,0,33582,0,0,46660,
+0,0,0,4790,47485,0,0,0,0,0,17554,0,0,0,3588,0,
+30666,0,30071,40792,0,0,0,0,0,0,0,0,19866,45313,2677,0,
+0,32714,0,16132,0,0,9726,0,0,42406,0,0,0,26462,0,0,
+0,0,0,0,0,2610,0,0,20714,1547,0,0,0,0,0,0,
+0,0,0,0,0,9008,0,31830,0,0,0,0,44822,0,0,20523,
+0,24358,35594,0,0,0,0,0,34808,0,0,0,0,0,21851,18506,
+0,11693,0,0,0,0,0,0,0,19796,27340,0,8912,18425,0,0,
+36179,0,0,0,28867,0,0,0,14674,0,0,0,22144,0,0,0,
+0,36428,0,0,0,0,0,0,42405,13695,0,47650,0,0,0,43051,
+0,0,0,0,0,8587,15372,0,26952,36674,0,0,37456,0,0,0,
+0,0,0,0,0,0,0,0,42890,7775,19027,35661,48840,24622,3902,41427,
+17465,0,6910,11007,0,0,0,0,0,0,0,29460,0,9436,0,0,
+38173,0,12402,0,0,0,30289,24856,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,27238,30472,0,0,1754,20608,33372,26515,37422,
+0,0,2392,0,12853,0,4870,0,0,0,47052,16864,0,14307,46082,0,
+0,20907,0,0,0,0,0,18206,0,0,0,0,4462,17703,31602,43248,
+21747,0,0,0,0,0,0,0,0,41744,10648,19765,28704,21288,0,2473,
+0,0,0,0,0,8484,0,34957,0,0,0,0,0,4408,6428,0,
+0,0,0,0,0,0,0,38487,45054,40630,12305,0,0,0,0,36555,
+0,39798,0,0,38613,0,13737,0,0,30762,3546,0,0,0,0,0,
+29562,3072,33885,0,0,0,0,0,8763,42876,0,0,0,0,10490,43936,
+0,0,35135,1622,25236,11072,37920,3752,38434,38486,38116,40982,42159,0,0,0,
+19215,40213,0,0,0,0,0,4633,4828,0,42430,0,0,1971,0,0,
+0,0,21116,0,0,0,0,6556,33100,0,25749,0,0,0,0,23298,
+35494,0,40062,0,0,14245,25785,38120,0,0,0,0,0,0,0,0,
+11829,24176,0,46182,0,0,0,0,0,0,0,44049,0,0,0,0,
+0,0,0,0,15674,46988,8075,12119,0,427,12394,20574,46246,0,13050,43959,
+0,0,0,0,0,22219,27993,0,0,44503,0,0,0,0,5892,0,
+0,0,0,0,0,0,0,31274,0,0,48008,17429,23951,5096,20683,28242,
+35409,0,22499,38246,0,0,0,0,0,25458,0,0,47893,0,0,11470,
+3191,0,0,10821,0,0,33814,0,0,0,0,0,38033,17850,0,27206,
+0,19575,41522,0,0,6097,0,0,0,46787,0,0,0,0,0,0,
+0,46854,8171,0,0,0,0,38968,47398,31119,0,0,0,949,38656,0,
+0,15156,0,0,0,37517,0,44747,0,0,0,0,38614,0,0,0,
+0,35151,0,16189,32171,45584,0,8969,15740,0,0,0,0,0,0,4463,
+0,0,0,0,0,34102,3285,0,0,0,0,30813,42414,19045,5036,35394,
+26458,30637,24631,25851,0,0,0,0,0,1628,0,0,31234,0,550,0,
+0,0,0,0,0,8605,17786,0,48588,0,31982,2418,0,0,0,38736,
+0,0,45519,0,0,0,0,25051,0,7963,0,0,4970,21630,1965,20855,
+43045,0,0,31895,0,0,21022,35195,40727,13056,13274,42445,0,2052,1831,21211,
+0,40610,4318,6121,35487,0,0,0,15177,0,18887,0,0,0,0,0,
+0,0,0,8063,2598,45067,27262,0,0,0,0,0,0,25237,31282,0,
+0,0,19706,10134,0,36486,0,20706,0,24422,32002,0,0,0,0,0,
+0,0,35730,0,0,0,0,0,34637,46707,0,0,0,0,45594,23451,
+0,0,36966,43548,45343,0,0,40886,0,41012,0,0,18619,35672,0,0,
+0,0,0,0,0,44860,28898,0,11028,0,25666,241,0,17691,25182,29235,
+6161,0,0,0,0,0,0,13523,0,0,0,0,0,46513,29481,47233,
+30516,0,0,0,3331,4143,0,0,0,39327,39982,0,15915,0,4216,38386,
+26614,0,19483,0,5510,13997,1785,11917,27199,0,30949,0,0,0,0,0,
+0,0,41137,163,0,22416,0,0,0,0,0,0,0,42327,25757,46840,
+0,0,0,0,505,0,0,0,14697,0,0,23251,34286,0,0,0,
+0,0,0,0,47692,48177,2237,5340,0,0,0,0,25,23093,0,0,
+18403,15442,43876,41032,0,0,30283,0,0,0,0,7222,17797,19949,0,3853,
+0,0,2944,16143,0,0,21493,34571,46957,7999,0,0,0,0,18714,0,
+0,0,33931,0,0,0,0,0,2596,5863,0,30977,45282,0,0,0,
+10884,0,0,28909,0,0,0,44154,0,15033,21695,25625,46772,47575,0,0,
+0,0,0,0,0,0,11927,0,0,0,0,0,17515,0,0,0,
+0,0,0,0,0,0,0,0,0,7678,12680,0,0,0,0,8861,
+40382,0,14496,6656,5253,33884,38041,0,38294,0,0,993,10724,19453,22607,46085,
+0,0,0,0,0,0,0,0,5348,0,0,0,0,28783,3244,42973,
+0,0,0,0,0,19845,0,0,0,0,0,0,20091,0,0,0,
+23134,0,0,0,0,36601,41289,41657,0,0,0,0,7544,41444,0,0,
+0,7120,0,26044,0,43250,0,22665,31247,34285,6288,31424,22134,29554,37075,20016,
+0,0,8786,0,28787,43582,44907,0,24372,38708,0,0,0,0,0,42091,
+0,0,0,0,13639,39097,39198,28833,43266,0,15914,0,0,0,0,13964,
+41831,25800,25013,44652,1780,9268,29956,0,0,22078,0,0,0,0,0,34699,
+0,0,0,0,0,0,0,0,0,0,0,8930,46589,42563,0,0,
+18753,0,0,0,0,0,0,29323,0,6845,0,0,0,0,0,0,
+7520,29023,0,0,454,621,47672,0,2236,36545,31021,42243,0,36716,0,0,
+11166,0,0,0,0,33314,37509,23081,0,0,0,0,0,0,0,38802,
+48029,0,0,3105,3336,33789,29855,19092,37222,0,0,31633,0,0,0,0,
+0,19810,0,0,0,39655,2538,22521,15631,0,24046,31288,0,0,0,0,
+25194,0,0,33377,42079,44888,28,28321,8716,0,0,0,0,0,47481,0,
+0,36508,12803,0,10360,47217,0,0,0,46508,0,0,0,35294,0,37065,
+40279,0,0,0,0,0,0,29468,0,0,0,0,27109,43129,26514,0,
+0,0,3650,0,0,0,48774,0,0,0,0,0,0,0,0,0,
+0,11174,29998,16471,0,0,0,0,26493,45085,0,0,0,22176,0,0,
+0,0,22076,0,0,0,11893,0,0,0,46058,0,15766,1794,28218,0,
+0,0,11047,27184,0,0,0,0,9587,30287,46880,0,0,0,0,0,
+0,0,18259,46298,0,0,42976,0,0,13911,0,0,38166,0,0,0,
+43120,0,0,40217,0,0,0,22764,16093,17871,22862,43466,0,38157,32781,0,
+0,0,0,0,0,0,28895,3883,20065,43859,0,0,31857,42765,10011,42617,
+0,0,0,0,0,0,26503,0,24222,18312,0,0,43384,37240,0,38337,
+2138,3494,48123,0,0,0,10683,21535,2084,0,39096,46869,0,0,0,0,
+0,0,21589,18305,36000,0,0,0,0,0,7887,0,0,0,0,2537,
+0,1408,39860,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,27793,14767,31749,27858,43291,44962,5616,39616,0,0,32607,0,0,0,
+25850,0,0,0,37657,0,0,13998,20924,0,18708,32803,34502,36668,18520,43765,
+48330,0,1455,0,0,0,0,1818,31919,0,0,38184,0,42041,0,0,
+0,10496,30884,45269,25057,0,0,0,0,0,41690,5968,0,2123,0,0,
+33627,0,0,0,0,0,28292,0,0,0,0,0,6326,8357,40996,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32159,0,0,0,0,0,0,0,0,6949,27245,46364,0,17230,490,0,
+0,0,0,0,0,0,0,678,0,0,15390,0,0,37929,0,0,
+0,33553,0,3233,15199,35737,0,20429,0,0,35197,0,0,0,0,0,
+41246,0,27809,0,0,0,26664,0,0,0,0,0,28209,41459,0,43351,
+0,0,34854,0,46569,14299,37200,0,0,28988,0,0,0,0,0,0,
+0,0,0,29612,39330,4334,0,0,39973,0,0,0,37996,0,0,48097,
+0,24760,47093,0,7344,0,0,0,0,0,0,0,0,10470,0,28424,
+30055,14866,0,0,0,0,0,0,13848,14019,10657,1580,12980,13376,9005,29390,
+45805,47967,23099,0,0,18109,0,0,0,0,0,0,0,0,0,0,
+36318,0,3919,0,0,0,19118,0,0,0,0,0,0,0,0,0,
+0,0,0,13278,0,40684,13469,41720,0,0,10235,0,16358,0,44941,0,
+0,0,0,0,0,0,36874,0,0,22760,0,0,33241,44819,0,37477,
+0,0,0,1398,0,0,0,0,5971,0,27435,33665,0,0,0,20842,
+0,0,43532,0,13550,20833,3917,3044,15807,29503,30038,0,2136,30098,0,0,
+0,2416,26200,16029,7412,23270,1749,28834,0,0,0,0,16795,0,33257,0,
+12500,33602,12964,0,25495,40290,0,46106,0,0,0,5293,0,8738,0,0,
+0,7284,0,46835,1532,21373,43433,0,0,8437,5587,16946,9344,35545,5777,33822,
+43757,0,7291,0,0,1748,0,155,41938,25382,0,0,0,0,0,47215,
+0,0,0,0,22743,4878,0,0,17157,0,0,1256,15084,42173,0,0,
+12765,31993,5024,0,43718,6672,38387,12288,13401,40833,41912,38454,33980,44565,46665,38898,
+0,0,0,0,10426,0,0,0,0,0,7610,1849,0,0,0,0,
+0,23094,0,9857,28411,0,0,34041,0,0,0,0,0,0,0,0,
+42905,0,0,0,0,0,0,23909,29490,0,7456,29473,24887,19557,8265,4110,
+25578,0,0,0,0,0,20042,0,0,0,15406,30682,6122,0,0,16441,
+0,0,0,11036,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,7119,0,0,0,14533,0,31954,0,0,0,0,43455,43952,
+1311,29618,0,19610,0,0,0,0,0,38177,34294,39725,22171,24147,30314,0,
+36502,0,0,28084,31554,0,0,0,0,0,1227,0,0,0,19154,13811,
+0,0,0,0,41239,42344,0,0,0,0,34656,29821,2004,27631,31664,9883,
+35038,0,0,32249,0,27134,0,0,0,16921,40998,33891,35886,3912,0,0,
+0,0,46249,30473,0,6034,0,0,0,0,31340,0,0,0,0,21324,
+26449,0,0,0,39436,0,0,0,0,2019,27438,7817,28892,0,0,0,
+0,0,7313,0,0,0,0,5275,0,0,0,0,34922,0,576,26662,
+0,0,0,0,14413,5466,33032,0,27679,30594,0,0,21998,0,0,2599,
+0,0,41797,45630,0,0,0,0,0,0,0,0,11699,16532,25105,28777,
+0,20551,15594,11385,34429,30079,0,8352,8128,27437,620,40554,23660,13836,0,1370,
+2068,17885,21045,20692,0,0,0,0,0,0,0,23391,12521,30365,46588,10481,
+47950,0,0,0,0,45490,11279,0,0,0,0,0,0,0,0,0,
+0,0,0,10922,0,0,13276,25733,16996,0,29517,38640,0,0,9449,0,
+0,0,46438,0,27010,39698,0,0,5801,9840,32177,0,7440,25216,0,0,
+0,0,0,0,5561,0,0,0,0,0,0,0,0,0,19231,0,
+0,0,0,18576,0,25839,46252,0,0,0,0,0,0,0,14000,0,
+0,9684,40901,0,0,0,14637,0,12662,44104,0,0,25155,0,0,0,
+18812,0,3306,16459,20680,15363,28644,36392,4407,0,0,24262,0,0,0,0,
+0,3986,8636,33660,11075,0,0,0,0,12386,0,0,9328,0,0,0,
+0,315,22656,29317,22397,36759,0,14255,12211,13079,13132,13982,7464,27701,8442,25783,
+31138,43470,47592,34094,0,0,0,0,0,0,36780,0,0,0,0,14567,
+15775,0,0,29007,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,22100,0,0,16791,47665,19823,0,13751,0,0,35502,0,3138,
+22239,30353,0,0,1014,0,0,0,0,0,0,16224,24947,45955,0,14931,
+0,0,0,0,0,44828,0,28545,0,6783,37078,0,17196,41967,0,0,
+0,0,0,0,10817,43931,0,0,0,13878,0,0,0,0,0,0,
+0,0,0,17580,0,33445,27958,43292,0,0,0,23574,48049,0,0,13793,
+0,19503,0,0,0,0,0,0,0,0,0,0,0,0,18601,15639,
+0,0,0,0,0,10580,0,0,0,0,11118,17726,25982,0,0,0,
+0,0,48523,48857,6844,0,45534,44382,23794,0,0,0,46992,0,0,0,
+0,0,0,45928,0,0,0,0,0,0,0,32039,0,0,37455,36301,
+0,0,16212,0,0,0,14911,35026,3222,23977,42234,40244,36842,24610,15967,14331,
+48763,36970,14701,14977,47348,0,0,0,0,0,35347,0,0,0,0,32458,
+0,0,28091,0,0,24787,31134,7274,0,0,0,0,11660,0,13131,0,
+37359,46086,0,0,0,0,23313,28559,35474,36918,0,31567,0,0,0,0,
+0,26128,16978,24889,0,0,19652,0,27762,0,3102,10970,0,0,14338,25290,
+0,0,0,0,0,0,0,0,0,0,5128,35922,5842,8095,24438,0,
+0,0,0,13615,0,42462,29760,0,0,0,0,0,35496,0,30620,0,
+0,0,0,8487,16846,0,0,0,0,0,46204,0,0,0,0,3168,
+0,42388,0,0,0,27,20271,0,0,0,0,0,0,0,13683,28807,
+0,0,0,16305,0,0,30805,0,0,34751,0,33804,0,12646,0,31384,
+0,0,0,0,36408,24967,0,7073,0,0,19936,0,0,0,0,33960,
+23254,0,12517,8614,26316,0,0,0,0,3435,21194,0,0,40533,0,0,
+0,0,0,19746,36068,0,0,0,0,0,0,0,0,0,46331,0,
+0,0,44384,19152,467,17894,0,0,0,18661,0,24593,0,36847,39005,0,
+17461,0,0,24390,42756,0,0,0,32203,35569,0,7071,0,0,0,0,
+0,0,0,0,10833,20510,21123,11825,12995,13275,0,24488,0,0,0,40628,
+0,0,0,0,9954,24273,2837,46889,0,0,0,0,40820,30060,44793,0,
+0,12541,1334,0,38327,42530,0,24187,0,21581,0,0,0,0,0,0,
+0,5355,0,28663,0,1262,0,12092,0,0,0,0,0,34229,0,23423,
+0,0,0,0,0,24360,0,39866,32893,14998,38892,0,30851,0,0,21163,
+0,0,0,15558,31753,0,0,47206,6440,0,24455,4518,0,0,0,8111,
+20489,38380,0,0,15027,6001,0,4622,21075,0,0,0,19919,0,0,0,
+0,0,0,47121,38998,0,39479,0,22515,0,0,48211,0,0,0,40520,
+0,37791,0,0,33604,0,45657,11222,0,0,0,32801,0,0,0,0,
+0,6545,8650,5698,9205,27150,0,0,30860,47961,0,0,1003,2463,12747,30121,
+46165,0,0,0,0,0,0,0,0,39818,0,17268,0,19773,2204,0,
+0,0,38046,4433,27603,39200,0,4599,33045,10731,41719,4705,21445,25211,20950,2503,
+0,0,0,17003,32368,0,0,29546,0,0,0,0,0,0,10364,0,
+0,21917,0,0,28730,0,0,34014,0,0,0,0,0,0,0,32950,
+26067,0,0,0,0,526,3071,11039,16307,35462,0,0,0,20955,0,0,
+0,0,39283,0,0,0,0,0,0,0,0,0,0,0,7779,0,
+0,0,0,0,16295,342,0,0,26968,0,0,29671,0,0,40005,0,
+32734,0,0,11694,42394,0,0,46088,38049,0,45088,9759,0,0,0,0,
+0,39083,38906,24538,0,0,24591,0,0,0,18639,0,0,27951,2946,20325,
+0,22575,0,0,0,0,0,8374,5570,5819,25349,0,0,0,0,0,
+42396,0,0,0,26612,0,0,0,0,1271,14731,0,0,33103,0,0,
+0,0,0,4265,38122,18767,0,0,0,0,27452,16197,27662,0,15342,36330,
+35921,0,0,0,16107,0,0,32605,0,0,0,0,817,20210,30265,0,
+0,28137,0,4256,29944,0,0,0,0,13515,11111,0,5047,0,0,0,
+9728,20796,27877,16696,0,0,0,0,0,48408,44,8003,0,0,0,0,
+0,0,0,0,0,0,0,37515,0,0,0,11701,0,0,34770,0,
+0,0,0,0,7050,17330,0,0,0,0,0,0,0,0,0,0,
+3594,39485,0,0,47631,0,22244,0,0,0,0,15078,48600,0,35698,0,
+11350,19399,18155,12280,27957,34723,23865,0,0,0,0,0,35223,20590,0,0,
+0,0,0,0,16011,0,0,0,0,0,0,875,15492,20328,0,0,
+34614,0,0,0,0,25307,0,0,0,0,0,20508,2198,21554,30277,17877,
+6422,18233,27359,26354,0,0,25589,0,0,0,0,0,0,0,43538,0,
+2942,0,38905,2169,0,0,0,0,0,0,0,14155,25651,14774,28417,0,
+38703,0,0,0,0,0,0,0,34012,0,0,16568,0,35008,0,0,
+19473,11982,0,0,0,0,0,0,0,43379,37836,0,0,14444,15346,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28503,
+0,0,0,18618,0,0,0,0,0,32010,8334,0,0,0,0,45050,
+0,0,0,8732,17345,18612,40449,0,0,0,2897,0,0,0,25755,40071,
+0,21213,33258,28797,0,0,0,0,0,0,0,0,0,0,18613,0,
+0,0,0,0,0,0,48023,22018,46346,0,0,0,0,0,0,0,
+0,0,0,0,0,0,47297,0,0,0,0,9516,11546,26625,34438,0,
+0,0,14640,11273,0,0,0,0,0,0,14672,47527,0,0,0,0,
+0,0,0,0,35069,0,0,32720,0,0,0,0,0,0,0,0,
+48013,0,0,37759,0,6558,18624,29570,0,48299,0,0,0,43529,0,0,
+0,0,0,0,0,0,0,0,16019,20707,26405,29923,36061,0,16520,22417,
+35692,0,0,0,0,0,32517,0,48222,0,0,0,25824,0,0,46077,
+36652,0,45696,0,35229,0,211,45384,0,0,0,0,7282,8688,0,30257,
+0,0,0,0,0,0,0,0,0,0,5590,0,0,0,12412,7352,
+0,0,0,0,0,0,0,0,17305,40853,0,34759,0,6659,0,0,
+0,0,13959,0,0,39785,0,0,0,0,42269,0,9708,30328,0,0,
+0,0,0,24015,27818,39029,0,0,0,0,0,20553,0,0,0,0,
+16185,0,0,0,0,0,0,0,0,0,0,11799,0,0,0,0,
+0,40253,0,48806,0,0,12387,0,0,23675,5262,2124,9825,0,0,0,
+0,0,0,44504,0,6526,15921,3148,0,0,35703,24965,0,0,20322,24875,
+0,0,41214,0,0,0,0,0,0,0,0,0,0,46505,0,12872,
+0,0,0,0,6850,0,0,0,0,0,0,24066,0,31888,0,9903,
+0,264,15696,35452,37998,26253,0,15179,12156,0,0,0,95,0,46384,0,
+0,0,3284,10279,45255,0,0,48458,0,42232,0,0,0,0,24042,43362,
+0,0,0,0,42443,0,11739,0,0,0,0,3823,42934,46776,6514,0,
+0,9237,31782,0,0,10698,6782,0,11791,43925,0,0,0,0,24949,0,
+0,0,0,0,0,10642,0,26672,17088,10068,0,0,40501,0,0,0,
+19865,0,0,0,0,0,0,4781,31910,0,0,21353,651,22853,8563,42070,
+0,0,0,0,48551,0,0,0,0,15672,0,0,7957,0,36701,18570,
+0,29673,33835,3989,8598,0,0,34748,0,44834,28532,33792,43592,27148,4246,45672,
+0,0,0,0,0,0,0,0,0,0,0,0,35992,0,0,0,
+0,0,22180,0,0,0,0,0,0,43979,13359,0,0,0,0,0,
+19066,0,0,0,0,17145,0,15887,0,44309,0,0,9855,6987,12668,47461,
+0,5137,29309,0,39554,0,0,30006,40836,25200,0,0,0,0,0,0,
+42900,2871,14430,46764,0,20076,10981,0,0,5799,0,12185,47412,0,0,28520,
+45710,26,0,0,0,0,0,0,0,0,0,11557,0,0,0,48844,
+7597,16374,0,21942,25634,0,0,0,0,10946,26435,0,0,0,39605,0,
+0,0,6823,0,0,0,0,0,0,0,0,0,12862,0,0,37125,
+0,0,5679,0,0,0,0,0,0,0,1770,0,0,200,15062,3353,
+5339,32444,38961,0,30053,1891,32667,0,47560,0,0,0,0,0,0,25828,
+30748,37378,0,0,23380,30996,23958,30039,44639,0,0,10465,0,0,0,0,
+28619,0,26417,0,0,0,0,0,0,10788,0,0,0,13341,0,30870,
+48522,453,3083,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3910,0,0,0,0,0,4137,29022,0,0,0,42395,0,6922,39738,19111,
+43313,14303,0,0,0,0,0,0,0,45769,0,0,47385,0,0,32354,
+43193,14607,16280,0,0,10932,0,0,0,35961,0,4715,10144,0,0,0,
+11910,0,0,0,32191,0,0,0,28142,32403,0,0,0,0,9306,9979,
+0,0,41679,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,15337,26469,0,0,0,0,0,0,0,37752,22683,0,0,19495,
+0,0,3392,0,0,0,0,0,0,0,41531,47987,0,0,0,25813,
+0,0,6700,0,0,32875,0,0,0,47054,22236,0,0,22635,0,0,
+0,42738,6206,0,0,0,0,21655,0,0,0,8028,0,0,5048,0,
+0,30315,0,0,16888,19717,22797,0,28388,0,16985,40448,0,0,0,21481,
+27530,0,18025,0,0,0,0,7891,21622,47742,34170,20615,48398,0,0,0,
+0,9493,7172,408,0,22283,0,0,0,0,0,31990,0,0,0,0,
+0,33748,0,0,0,0,0,0,0,0,0,47371,0,0,15587,0,
+34887,0,0,0,13509,0,3835,45820,21301,29518,0,23821,0,44642,18765,39190,
+0,0,0,0,7743,0,0,0,0,0,0,0,0,0,0,44300,
+0,17207,0,0,0,0,12589,0,0,0,0,0,0,0,20776,6393,
+0,0,0,0,25438,25536,39532,3876,14068,45651,0,0,36273,0,2390,0,
+1223,13286,0,0,6484,15261,0,0,23173,45335,0,0,0,0,0,0,
+48294,0,0,26302,0,46672,29211,2589,20998,0,0,0,39813,0,0,10694,
+0,0,12324,0,0,0,0,0,0,24359,24497,0,0,28205,0,0,
+0,0,0,0,6109,0,0,0,0,47798,40530,0,0,0,0,0,
+0,0,0,0,40364,14968,0,0,0,0,0,39457,0,0,0,0,
+0,0,0,3375,0,41704,0,1728,21407,48455,0,11476,17205,26790,35250,0,
+0,0,0,0,0,0,249,0,0,0,0,0,5608,0,0,0,
+0,14852,28789,33592,0,2966,36485,0,0,0,0,28872,0,0,0,38450,
+0,8910,0,0,3521,8991,0,0,0,0,28678,0,0,0,0,3090,
+0,24393,0,0,17092,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,2501,5190,11296,35653,24160,0,0,34620,0,0,0,9140,
+0,0,0,5471,19344,0,0,31428,24628,35466,0,8376,0,24242,44829,0,
+32433,42304,13945,44288,10410,0,3321,0,0,18490,33371,0,0,0,6323,22340,
+23264,0,0,0,0,0,0,21555,0,0,0,18272,30144,46044,0,32215,
+0,1908,37907,0,0,0,0,12618,0,0,0,25394,12876,2047,0,0,
+0,0,36707,0,0,6954,21976,38742,41475,0,0,0,0,0,0,24509,
+0,1063,3229,23535,42332,25980,0,0,0,0,1624,0,0,48447,2066,29844,
+38940,0,0,0,0,31564,0,0,0,37772,1895,31055,0,8131,0,0,
+0,0,17037,25798,0,26842,0,0,0,0,4656,0,0,0,0,0,
+12337,0,0,14332,0,29919,0,0,0,0,0,48304,0,21415,0,0,
+0,0,0,0,31098,0,0,0,6065,15506,0,0,0,0,41623,0,
+0,0,0,0,3384,27970,29874,33735,38180,0,34234,46383,45495,0,17541,0,
+0,0,0,0,0,0,0,17393,24128,34816,0,23229,2931,5687,9220,26524,
+33256,36051,0,0,0,0,0,0,20002,28104,0,0,0,13535,0,0,
+0,5131,0,0,0,0,0,0,45995,0,0,18351,2010,0,0,0,
+0,0,20426,40304,41581,0,0,24328,0,9491,33715,0,0,0,0,0,
+0,0,40085,0,0,0,36081,0,0,0,0,0,0,0,3817,16158,
+0,41035,0,0,0,0,0,0,4579,0,8662,0,17295,0,0,15746,
+41709,0,0,37598,0,0,0,28631,0,0,0,0,0,0,0,0,
+0,27034,44495,0,0,0,5719,31765,0,0,0,0,0,12340,0,0,
+33078,0,0,20434,0,23676,0,0,0,0,0,0,25649,40368,41754,43930,
+0,0,0,33858,0,35817,33985,38293,0,3250,47181,40292,0,0,19348,0,
+18806,36436,36499,0,0,0,0,0,20286,3415,0,0,22738,0,0,0,
+0,0,0,0,0,0,0,0,0,21995,0,0,0,0,29557,24301,
+37840,0,0,0,0,14787,5657,3849,45051,35040,0,8270,45833,46443,0,0,
+0,0,31875,28126,39042,0,0,9045,0,0,0,0,0,5867,0,0,
+26864,28886,20964,25404,0,0,0,0,0,0,8706,0,0,0,0,0,
+0,0,0,0,0,0,44310,20053,26665,18921,0,0,0,597,0,0,
+0,0,0,0,43562,48375,0,21119,2700,8962,12512,0,0,0,0,0,
+0,7977,16770,0,0,37777,0,0,43317,44856,0,24534,0,0,33541,34793,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,35775,0,
+0,0,0,0,545,7970,46302,0,9586,0,33385,0,0,17114,10358,0,
+0,0,0,0,22023,23084,29058,0,5876,42168,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,18712,3954,37895,0,0,0,0,0,
+0,0,36067,0,29777,0,819,34842,20689,45952,0,22581,0,0,23891,0,
+0,0,0,0,0,0,0,0,0,0,0,0,10452,17477,7318,0,
+0,17965,38437,0,0,0,0,42180,0,0,0,15112,17897,0,0,20166,
+0,0,0,25203,33467,0,0,0,0,29739,29933,48395,0,0,16112,0,
+0,43619,0,0,7179,0,0,0,0,0,9715,31296,0,6938,0,0,
+0,0,43533,32800,0,0,0,41452,0,42539,14540,0,0,0,0,0,
+0,0,0,0,0,0,30863,0,24659,0,0,0,11080,0,0,16232,
+0,0,0,0,0,0,5482,39761,0,48289,0,0,0,0,0,5286,
+34383,36691,40332,44981,7338,43233,0,17438,32080,0,0,0,40871,0,0,0,
+0,0,0,0,0,35778,0,0,0,42300,0,0,41929,42097,21129,7447,
+19870,8921,891,21526,16334,45011,0,0,0,24389,41296,11015,0,0,31073,1120,
+31726,12667,16012,25523,29371,8289,9211,45105,31528,0,0,21187,3134,4749,18301,22414,
+0,0,20869,0,46584,0,0,0,36610,0,0,33183,0,47589,9450,0,
+0,0,44257,0,0,0,20682,39642,0,0,0,0,0,0,0,979,
+0,0,8751,15494,46867,0,28978,0,0,3713,0,37145,46714,0,0,26512,
+0,29802,14824,0,0,0,0,35049,0,0,0,0,13006,0,17467,0,
+0,0,0,0,4207,7023,0,0,0,32835,0,11728,0,0,29869,0,
+0,22817,7855,16759,0,0,0,0,0,43258,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,38498,0,0,0,0,0,0,
+0,0,30264,20380,0,0,0,33714,0,20108,23162,45404,0,0,17110,0,
+0,39441,47366,22589,25371,0,0,26990,0,0,0,0,0,28690,0,0,
+0,0,0,0,0,0,0,0,21524,0,0,0,0,16378,23289,0,
+0,0,0,0,38354,0,0,0,6426,29693,0,0,0,39377,0,0,
+0,0,0,46572,0,3311,0,0,0,1196,1478,14178,0,0,0,0,
+14385,21128,0,0,0,17146,0,0,0,0,0,0,0,0,0,0,
+0,0,0,20007,0,0,11170,13327,28684,0,0,0,0,0,0,0,
+0,0,47296,6519,0,0,0,48793,0,0,18405,0,41428,47740,25585,0,
+0,31383,37531,44665,0,0,36407,0,0,0,48660,0,0,0,0,0,
+48854,16735,47828,0,35150,12368,32421,32085,31217,0,45493,0,46905,0,0,0,
+0,0,0,0,0,15682,30711,45552,0,6743,0,0,0,0,0,0,
+37440,40683,0,0,1056,0,4381,0,0,0,41113,0,0,0,4933,15150,
+0,0,0,41072,0,0,0,0,0,566,0,1291,32336,0,0,22761,
+20666,26303,0,0,0,8043,0,0,0,0,0,0,0,26530,0,0,
+0,23151,19167,40728,0,0,0,0,24580,17184,0,0,19335,0,18866,31906,
+46067,0,0,0,21545,0,32683,0,32497,17830,0,32019,43060,28911,14135,0,
+35584,0,0,0,36935,0,0,0,0,0,0,19846,30237,0,0,0,
+0,0,0,0,0,0,0,0,194,45853,0,0,0,0,0,26749,
+17460,0,0,0,0,0,1925,4398,11600,0,0,7651,18824,33852,0,33006,
+37644,0,0,0,0,42409,2058,35989,0,643,0,0,0,0,0,0,
+0,19859,0,0,10096,0,0,0,0,22287,46282,2861,12437,0,31397,12139,
+0,0,0,0,22821,22126,0,0,0,28092,0,8687,37355,0,31117,0,
+0,0,41474,0,12163,14825,38864,36799,20093,2158,11668,0,0,0,19899,0,
+7988,27436,0,32022,0,24421,0,43256,0,8380,15263,28455,0,0,0,39262,
+0,0,31655,0,0,0,0,38256,0,0,13909,30774,8887,4200,41033,21166,
+0,0,10326,0,0,0,0,0,29723,0,0,32136,0,0,0,11665,
+37808,38757,0,0,0,0,17439,39740,0,0,0,0,0,23589,19282,0,
+0,0,0,25973,0,0,0,0,20289,0,0,0,0,36367,0,0,
+0,0,0,0,0,43719,0,0,0,0,31187,6789,40303,0,0,38807,
+0,17167,0,0,0,0,0,42791,0,382,0,3758,45413,0,0,0,
+0,0,6820,25348,0,0,0,5207,0,0,0,0,0,0,0,27171,
+21401,44416,0,0,0,0,0,20151,0,0,0,0,42787,0,0,6591,
+0,0,0,4804,32298,0,0,0,0,29603,15194,0,0,0,0,13261,
+16933,0,11862,38130,0,0,0,0,0,788,0,0,46728,29425,0,0,
+35122,0,0,21387,0,0,0,0,0,0,0,0,0,0,0,0,
+0,17290,20413,10533,28430,45580,7069,0,1078,42021,0,0,19701,0,0,18938,
+0,0,0,0,0,6889,7868,27119,0,46234,0,1292,0,0,0,0,
+0,0,39450,0,0,0,0,0,0,0,0,29515,0,0,29435,43566,
+47076,0,19170,27915,7383,0,0,0,8337,0,15748,0,0,48791,14037,0,
+0,35115,13546,0,22848,42978,0,29143,0,0,0,28147,0,0,6229,42722,
+0,0,6947,20033,12256,24942,0,0,12315,0,25702,0,0,0,0,20267,
+0,0,0,46107,0,4976,0,0,41725,0,0,41277,31067,38054,0,0,
+0,0,0,0,8938,0,0,0,0,0,24527,0,0,19068,17620,12110,
+0,0,0,32478,0,0,0,30558,0,20600,0,3500,0,4396,12096,14877,
+27242,35931,28850,0,34932,0,0,0,0,0,0,8886,0,0,0,0,
+0,7981,20813,26030,35490,17172,37993,32648,30297,33460,41947,16782,35004,42274,44553,12452,
+45443,0,0,30595,0,44975,0,0,0,0,0,0,0,47232,0,0,
+17081,665,0,0,0,15904,25719,0,0,0,0,0,0,0,0,20139,
+47189,0,0,0,24841,0,0,0,0,0,0,38574,0,35950,47515,35593,
+43342,19525,44450,47406,2020,11386,40468,0,0,0,8804,31802,41876,2194,24299,33639,
+32735,0,0,0,0,0,0,0,2653,0,44102,0,46808,0,0,0,
+39657,0,0,0,13985,0,0,0,7703,27803,0,0,0,0,0,0,
+0,0,8000,0,0,0,37478,27276,0,0,47314,0,28475,0,0,0,
+48430,0,29827,19139,0,0,33945,0,0,0,14890,2791,40391,44024,0,0,
+0,0,0,0,0,0,15978,40091,0,0,0,17068,0,0,0,0,
+34975,0,2079,0,0,0,0,0,11692,0,0,0,0,27968,0,0,
+0,0,31012,0,0,0,44060,19550,0,31395,5618,9639,0,0,0,33095,
+20709,26537,47163,0,0,0,6773,0,0,0,0,0,0,27990,0,23054,
+24655,0,0,0,0,11299,26011,661,19904,36565,0,0,0,0,0,0,
+0,0,48349,0,21941,0,0,11656,0,0,0,0,0,0,0,2546,
+0,9853,10906,0,30771,0,596,0,0,0,29559,0,0,0,0,28627,
+0,0,0,0,0,0,0,0,0,21169,21879,29045,35846,0,0,0,
+0,0,0,0,0,6756,26278,0,8621,0,0,19644,43522,0,36517,5535,
+0,0,1041,0,0,13162,0,0,0,0,0,4855,1310,22452,23862,18904,
+35603,0,0,13497,29245,32858,35035,0,44229,0,0,0,0,0,42138,46850,
+0,19016,0,0,0,0,21744,9727,2825,27889,47017,1167,11342,0,12282,0,
+27566,7233,37821,0,17062,0,0,0,24820,0,0,0,0,0,10717,38366,
+33367,0,16181,8301,40944,0,0,0,33411,377,0,0,36639,0,23606,42991,
+0,0,0,12869,17546,11852,0,0,0,0,0,0,0,24559,0,0,
+0,0,0,0,0,0,7654,0,0,0,0,45841,1298,29653,30980,11367,
+44335,29164,45055,28708,13333,35314,46398,47705,0,35075,0,37283,0,28428,0,0,
+0,0,27517,44637,0,0,0,0,25315,0,23899,22303,331,0,0,15152,
+0,0,0,0,7187,0,0,0,0,0,20838,0,913,0,0,0,
+12299,45532,0,0,6643,7357,30598,193,35856,14958,21566,0,0,0,6120,22467,
+0,0,9956,0,24036,43218,0,41863,0,0,38931,0,0,0,0,0,
+26996,41426,0,0,0,0,0,0,0,44377,0,19226,34592,18192,40625,0,
+3094,18050,0,0,0,16986,0,0,0,29168,0,23644,0,0,0,0,
+0,0,0,20441,11874,0,0,0,0,21289,0,0,43231,0,0,0,
+26452,0,0,0,0,0,27080,0,0,0,0,0,18323,0,37746,0,
+0,0,42308,4803,24964,0,0,0,39292,12628,30632,39985,0,0,0,2464,
+0,0,32241,0,0,0,0,0,0,0,25888,45058,0,0,0,0,
+0,0,44202,0,0,0,17300,30043,0,17217,0,4921,0,0,0,0,
+0,47358,0,4065,0,0,0,0,0,1791,0,0,0,13081,0,6806,
+45141,0,45417,0,0,0,0,0,0,37949,0,0,0,0,0,0,
+0,0,41342,11264,0,0,15502,12314,22883,48187,45214,0,0,0,24071,0,
+0,42739,0,0,0,17270,0,8901,0,0,0,0,0,0,0,0,
+18483,40713,0,0,0,0,0,0,0,0,18541,0,2639,28057,45867,40978,
+0,2030,0,0,0,0,0,0,0,7254,0,0,0,28467,24611,42349,
+10518,0,0,0,0,0,4288,42827,0,0,24912,27069,0,0,0,0,
+0,0,22010,0,19551,4802,39351,1761,8240,35673,23580,33576,0,32910,0,0,
+0,0,47520,0,0,0,0,0,22954,21512,47327,47982,42979,0,41456,0,
+0,0,11994,0,0,11583,32030,33764,0,0,37132,42281,0,0,0,42881,
+0,3175,37144,0,0,35032,0,0,3706,14051,42515,35216,0,0,47805,0,
+0,0,7257,0,45735,0,0,0,0,42365,47940,0,0,0,0,0,
+0,0,0,0,0,41455,33703,14842,0,26644,21437,0,0,0,31237,0,
+29012,0,0,1699,37960,21701,0,0,0,0,0,45790,44003,0,43918,0,
+0,0,0,0,0,45634,29628,9501,5722,3571,27381,5869,0,0,0,0,
+48181,11859,17251,0,0,0,0,0,0,0,22836,0,39360,0,28032,0,
+0,0,32773,11678,28496,40646,25099,0,20118,0,0,0,0,17551,25429,22564,
+38200,0,0,0,0,0,0,32802,25247,0,40827,0,0,48308,0,0,
+0,0,0,0,0,0,0,0,0,0,42049,0,4864,0,0,41680,
+0,25773,0,0,0,11425,0,0,0,0,0,0,15790,0,0,0,
+0,0,0,0,22874,0,18041,23182,0,40842,0,0,0,7588,0,0,
+0,0,8802,14172,35733,28585,30160,0,0,0,13404,14597,0,33348,0,0,
+0,0,0,28756,0,0,0,0,0,0,9356,0,0,48575,0,0,
+0,0,0,0,0,40555,0,0,0,896,47775,0,28472,0,0,1968,
+0,0,0,0,0,0,7118,0,0,0,0,0,41151,0,0,0,
+19507,28351,0,43830,0,33230,0,0,0,0,0,0,0,0,8503,16283,
+0,0,0,0,0,22572,0,0,0,38128,0,20082,34128,37310,0,32851,
+42171,0,0,31685,0,812,13947,20264,23361,17983,1035,11196,17050,18796,14490,25769,
+38197,36798,47224,22240,17889,22028,46446,0,0,0,0,0,47938,0,0,0,
+0,0,0,0,0,0,0,0,39145,0,0,1283,16139,0,11667,11764,
+12035,0,0,0,0,0,8309,5560,33730,0,0,14386,0,0,0,0,
+0,0,21375,0,0,7428,0,46561,0,0,0,0,0,0,0,0,
+0,38846,0,42169,1545,30423,12141,0,0,0,21702,0,0,0,0,0,
+23739,671,6224,10161,24815,0,0,0,0,0,0,12987,24937,30911,35398,0,
+0,0,0,0,19555,0,0,0,0,0,0,45611,0,0,0,0,
+6319,0,0,15562,0,0,0,0,17892,0,0,0,22377,0,0,0,
+34823,0,18201,19783,24917,0,0,33181,0,0,0,32223,0,0,0,43831,
+0,17284,0,16503,0,0,0,0,0,27412,0,0,0,0,0,0,
+22381,18200,35359,46481,14823,0,0,0,0,0,0,18631,2999,23231,27063,7143,
+0,0,0,44282,28296,0,0,5928,0,47370,887,4649,13168,0,0,30436,
+0,0,0,0,0,0,0,0,0,17368,0,0,0,0,0,19455,
+35566,0,0,0,12882,0,12927,0,0,0,0,0,0,0,0,32581,
+0,0,0,0,0,0,0,29815,0,0,20280,0,0,0,33325,13058,
+0,14511,0,0,0,0,26465,0,0,0,0,0,0,0,0,0,
+6118,0,0,48443,0,17644,45316,7201,0,0,0,0,0,17776,0,7666,
+0,0,0,4779,33844,40060,43071,0,0,10530,0,0,0,8595,0,0,
+0,0,0,0,0,0,0,0,0,6677,0,0,15009,31762,0,40122,
+0,0,0,0,32553,0,0,40817,2797,15559,2856,36954,37835,38241,47868,10353,
+2763,4941,0,0,20567,0,0,34254,0,0,0,11944,0,0,0,44110,
+0,43013,0,0,0,0,16539,0,43488,0,0,0,0,0,0,0,
+0,0,0,14425,38340,27484,0,39193,0,0,0,0,47889,48171,37458,0,
+0,6913,17142,29631,0,24297,34186,0,0,0,0,0,0,0,4739,0,
+11565,44273,15920,34208,0,19944,21737,45098,0,0,0,0,0,0,20679,0,
+0,0,0,0,0,0,33179,20174,0,38341,0,2254,39882,42311,0,22434,
+0,0,0,0,0,0,43268,0,0,25875,44590,0,0,4307,22864,28659,
+0,0,0,0,21305,0,0,0,33126,0,0,0,41479,0,0,0,
+0,0,23753,0,0,0,0,31699,0,0,0,24929,34334,0,7141,0,
+0,0,2708,0,0,40087,10171,0,0,0,0,0,7340,0,0,0,
+44649,5301,19292,29206,0,0,0,8800,0,44182,0,0,0,18376,8686,8494,
+44065,0,15428,39172,29215,0,0,22746,7765,7609,29510,0,0,48719,0,10793,
+39579,0,0,0,2118,0,0,0,0,0,39059,18078,0,15323,0,42150,
+0,0,0,0,0,0,0,0,48831,0,0,41796,0,0,0,0,
+0,0,0,0,30691,0,0,14602,23283,23657,18925,43167,0,3178,39963,0,
+38765,0,0,0,13447,0,0,0,0,2673,41953,29187,17534,0,0,0,
+29329,3025,39874,0,0,0,0,36325,38519,0,0,24848,0,0,0,0,
+45925,0,43410,19611,8249,22974,43219,0,0,0,0,0,0,0,10797,0,
+0,0,39372,0,21657,29613,42155,0,0,0,0,0,47498,0,13125,48594,
+0,0,0,7427,0,0,0,0,0,43702,0,0,2686,0,0,8394,
+0,0,37179,0,0,0,0,0,46712,0,0,0,12893,15659,0,0,
+25111,0,0,0,0,7289,0,0,4251,26064,0,0,0,0,0,21509,
+6423,0,0,0,0,0,0,0,8888,0,0,0,0,43106,0,0,
+0,24523,0,33351,0,0,0,41583,39477,16281,36368,0,0,0,0,0,
+0,48120,0,0,0,0,42675,0,0,0,0,0,0,0,0,8279,
+46467,24227,10556,21494,0,0,0,0,0,1514,10678,10466,0,0,0,0,
+0,22616,32388,0,0,0,43437,31731,0,0,0,0,35444,27683,0,0,
+0,28969,0,21339,0,0,0,0,23387,0,0,0,0,0,0,4897,
+0,36658,43871,3812,24950,24070,40814,7211,0,0,0,0,0,0,46528,0,
+0,46512,10435,0,0,0,0,0,0,0,0,0,0,0,15322,0,
+0,0,0,0,0,15981,42558,0,0,1775,1884,9605,32455,0,0,0,
+0,0,0,0,0,15411,40586,0,0,29908,41924,0,37364,6997,0,0,
+0,21066,34112,0,0,0,0,13680,27736,33171,18584,34905,558,40211,43315,3002,
+38389,44213,26380,17445,44742,30068,47840,0,0,30818,0,0,0,0,0,21259,
+0,0,0,0,0,0,0,0,0,0,4962,0,0,0,19760,35568,
+43678,0,6707,0,46392,0,0,0,0,0,0,23385,30100,872,0,0,
+0,22774,0,0,5420,0,13859,0,0,0,0,0,0,0,0,0,
+0,20350,40221,0,0,31297,0,3380,32456,0,0,0,0,13642,23280,27468,
+31371,0,0,36643,0,1193,0,0,31380,45388,0,47091,0,0,0,2190,
+3869,46863,35068,0,0,0,0,0,0,0,0,0,15303,33294,45176,0,
+0,0,0,38689,0,0,0,0,40133,0,2735,0,0,0,1931,0,
+0,0,0,3967,0,0,26271,36633,0,26357,43905,0,0,0,0,23177,
+9138,0,0,0,48146,0,0,0,48803,0,0,32222,32956,38146,0,0,
+0,9915,0,0,37856,42312,28601,17434,0,0,0,0,0,0,0,18676,
+39670,0,0,0,39235,0,8212,0,35117,35370,0,8632,0,34266,46843,0,
+0,9869,0,0,0,0,34316,0,0,0,12209,6964,47838,0,0,41894,
+19072,34879,47060,54,48003,0,0,0,0,3307,0,0,7207,47914,14660,0,
+0,0,0,19614,0,0,0,0,0,0,0,0,0,942,8986,12455,
+0,34819,4977,20449,9886,28120,0,0,10332,0,37725,41910,0,0,0,13335,
+18975,32146,0,33523,0,0,32212,22009,39724,46725,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,26424,0,0,0,19223,
+0,0,7677,14562,0,0,0,15860,0,6302,0,0,0,0,0,43577,
+0,36728,28762,44671,0,0,0,0,0,0,0,0,0,0,0,0,
+12870,4552,15484,17920,4997,40914,0,9014,0,11828,0,0,0,0,6026,32929,
+47653,0,0,0,0,0,0,15592,0,0,0,0,0,20036,0,0,
+0,0,0,0,23005,0,27696,15169,29330,0,0,11232,0,0,36202,11774,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+8341,35613,35667,0,55,0,18615,47561,23126,0,0,15945,22690,0,39861,0,
+0,0,0,0,0,0,22714,0,0,0,0,8141,0,17420,21966,0,
+0,13480,41148,0,13446,0,39941,0,0,0,0,0,0,14223,48068,0,
+24696,0,0,0,0,0,0,0,0,0,0,0,0,19229,0,0,
+28912,0,0,0,0,0,47585,48745,0,0,0,36119,0,0,0,0,
+32483,0,29523,9,43612,10094,0,0,0,8629,0,0,2828,14322,0,43354,
+0,0,0,0,0,0,8821,0,0,0,47123,0,10622,0,0,27378,
+25061,41245,44253,0,2406,0,0,0,11508,44039,13846,0,0,0,38140,15251,
+0,0,0,0,0,0,6521,26828,48386,0,0,0,0,0,39014,0,
+0,0,0,20147,1243,46690,0,0,0,18586,44927,0,0,0,0,24080,
+0,0,6691,29150,0,0,39900,0,0,0,286,10976,20308,0,0,0,
+33104,0,45751,0,0,10117,30571,9863,33667,38588,39562,0,0,46286,25836,0,
+0,11353,21704,26881,9120,37886,6768,40899,41193,0,0,38594,0,0,13732,15913,
+0,0,0,0,0,0,21484,0,7979,0,37450,25740,32869,5542,39865,0,
+40066,27924,0,0,0,0,11098,34190,0,0,0,36789,0,0,0,0,
+0,38205,35821,0,0,0,0,0,0,46587,18240,13831,0,0,0,27812,
+3085,22263,5234,24665,0,0,29718,0,0,0,0,0,3714,5589,0,15523,
+0,0,0,19716,31524,0,0,38000,0,0,0,0,5217,0,4085,0,
+0,47267,0,0,0,0,0,0,0,0,33046,48303,17898,12976,0,0,
+0,28250,21125,29342,0,3931,0,0,0,0,0,0,0,12072,7621,0,
+0,33836,0,0,0,34448,0,0,0,0,0,37555,0,0,0,0,
+7149,0,0,15174,12761,25165,27659,30601,0,0,0,31476,0,25225,27018,36559,
+0,1744,7185,7892,12427,34236,43948,0,0,46973,0,0,0,32428,23755,4194,
+29662,0,44650,0,10832,0,0,0,0,0,0,23444,26871,0,0,0,
+0,7460,0,0,0,0,0,8017,32597,0,0,17784,28453,30914,38917,8785,
+0,25222,0,31354,0,0,0,0,0,8264,8721,25127,0,0,0,0,
+0,32914,6431,0,34848,0,25047,0,0,33826,12094,13092,36458,0,0,31898,
+0,47357,0,10472,12200,41738,0,0,0,16420,23594,26439,12605,31870,30367,35635,
+36513,48249,0,0,16425,46355,0,15958,0,0,0,31821,0,0,26050,25008,
+26877,44668,0,0,0,16200,0,45379,0,0,0,0,12943,0,0,0,
+0,18498,0,0,10585,21160,0,11855,0,0,0,47022,42804,0,6141,31735,
+0,18198,0,37396,34321,28054,0,16648,0,0,8673,25862,0,0,0,20882,
+0,0,0,0,0,8747,0,0,0,0,0,0,23326,20140,17836,15824,
+15586,41411,44534,46138,1954,7752,12355,37586,32944,14084,8316,12785,21126,37997,0,22160,
+0,0,0,1856,0,0,0,0,0,0,0,0,9112,43820,0,0,
+29898,33260,0,0,0,0,0,0,24671,19244,26269,0,0,0,0,0,
+0,0,0,0,0,39236,0,0,0,0,0,0,753,0,0,0,
+562,41878,0,0,27459,45984,0,0,41954,26189,35207,0,47528,14426,0,0,
+19519,0,46480,0,0,9464,0,0,19648,0,0,0,13298,24172,0,0,
+0,0,0,0,0,27137,7445,0,23839,13622,33812,0,0,11763,0,37541,
+0,0,0,0,0,0,0,33364,35123,23906,0,26393,42933,18488,0,0,
+0,0,6621,25359,10560,31049,0,0,39281,0,0,36718,33094,0,42216,19228,
+0,37625,35543,0,0,0,5633,8189,33989,25854,9247,34972,16463,32972,0,0,
+0,5087,29602,35970,0,0,0,0,0,0,0,8449,12366,46635,0,0,
+0,0,0,0,7379,22426,37445,0,0,0,0,47849,12708,19060,0,8444,
+0,27266,15616,31327,31235,0,0,38774,0,0,0,23612,0,0,0,0,
+0,0,0,0,21736,17605,27182,0,0,0,34973,0,39679,0,35874,0,
+827,0,0,0,0,0,0,26792,0,16390,38969,0,0,0,0,0,
+0,0,0,5149,25431,39770,42581,0,32827,0,42403,0,40913,27912,23614,7496,
+34251,46917,0,0,0,4877,0,0,0,19408,3032,0,20085,46626,38132,0,
+40073,8061,0,0,22294,47262,0,0,0,0,7792,0,0,0,0,0,
+0,0,6811,5780,18784,0,0,0,0,31634,0,0,16381,0,0,0,
+0,0,8456,0,26688,0,0,0,0,0,0,1644,0,0,0,0,
+0,1215,3969,26087,0,0,1228,0,41323,0,0,0,0,42458,0,0,
+3558,0,0,0,0,0,0,0,0,16472,1299,20780,0,0,0,4837,
+0,0,0,46895,0,0,0,0,0,0,0,0,0,38295,29913,22052,
+47051,0,0,0,0,0,0,0,0,0,0,22804,46006,7555,36849,0,
+0,7870,39243,44446,0,0,0,0,0,0,0,0,0,0,0,0,
+35657,0,0,0,0,0,6771,0,0,0,0,0,0,0,0,0,
+0,26013,0,7556,0,0,0,0,0,0,0,0,0,42882,0,3170,
+0,0,0,0,0,0,0,0,27237,17424,34685,37021,0,0,0,0,
+17747,0,21007,35009,46503,0,12419,0,0,0,0,0,0,0,19018,28138,
+33166,0,0,0,35834,23341,34035,29429,28709,46276,0,0,36685,0,0,14069,
+0,1821,7846,0,30392,0,0,0,0,25050,0,7944,0,0,33708,0,
+0,0,0,0,0,44961,22920,30267,37123,45626,0,0,0,7419,20409,0,
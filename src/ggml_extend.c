@@ -105,6 +105,16 @@ ggml_tensor_stat_st ggml_tensor_stat(const struct ggml_tensor* T)
     return stat;
 }
 
+void ggml__backend_set_n_threads(ggml_backend_t backend, int n_threads)
+{
+	ggml_backend_dev_t dev = ggml_backend_get_device(backend);
+	ggml_backend_reg_t reg = ggml_backend_dev_backend_reg(dev);
+	ggml_backend_set_n_threads_t func = ggml_backend_reg_get_proc_address(reg,
+		"ggml_backend_set_n_threads");
+	if (func)
+		func(backend, n_threads);
+}
+
 #define ggml_tensor_export_CODE(TYPE,CONV) do { \
 	const TYPE *tp = T->data; \
 	for (int64_t i3=0; i3<t3n; ++i3) \
@@ -201,11 +211,6 @@ struct ggml_tensor* ggml_nn_attention(struct ggml_context* ctx,
 	struct ggml_tensor* q, struct ggml_tensor* k, struct ggml_tensor* v, 
 	bool mask)
 {
-//#ifdef USE_FLASH_ATTENTION
-//	assert(q->ne[0] == v->ne[0]);
-//	return ggml_flash_attn_ext(ctx, q, k, v, NULL, 1.0f, 0.0f);
-//	// [N * n_head, n_token, d_head]
-//#else
     float d_head = (float)q->ne[0];
 	struct ggml_tensor *kq;
 
@@ -218,5 +223,66 @@ struct ggml_tensor* ggml_nn_attention(struct ggml_context* ctx,
 
 	return ggml_mul_mat(ctx, v, kq);
 	// [N * n_head, n_token, d_head]
-//#endif
+}
+
+#ifndef GGML_KQ_MASK_PAD
+#define GGML_KQ_MASK_PAD  1
+#endif
+
+struct ggml_tensor* ggml_nn_attention_flash(struct ggml_context* ctx,
+	struct ggml_tensor* q, struct ggml_tensor* k, struct ggml_tensor* v, 
+	bool mask)
+{
+	float d_head = (float)q->ne[0];
+	struct ggml_tensor *m=NULL, *x;
+
+	if (!ggml_is_contiguous(q)) q = ggml_cont(ctx, q);
+	if (k->type != GGML_TYPE_F16) k = ggml_cast(ctx, k, GGML_TYPE_F16);
+	if (v->type != GGML_TYPE_F16) v = ggml_cast(ctx, v, GGML_TYPE_F16);
+
+	if (mask) {
+		// Causal mask: 0 or -inf, the rows are padded as ggml requires
+		const int64_t n_q = q->ne[1], n_k = k->ne[1];
+		x = ggml_new_tensor_2d(ctx, GGML_TYPE_F32, n_k,
+			GGML_PAD(n_q, GGML_KQ_MASK_PAD));  //shape only
+		m = ggml_scale(ctx, ggml_arange(ctx, 0, n_k, 1), 0);  //zeros
+		m = ggml_repeat(ctx, m, x);
+		m = ggml_diag_mask_inf_inplace(ctx, m, 0);
+		m = ggml_cast(ctx, m, GGML_TYPE_F16);
+	}
+
+	x = ggml_flash_attn_ext(ctx, q, k, v, m, 1.0f / sqrt(d_head), 0, 0);
+	ggml_flash_attn_ext_set_prec(x, GGML_PREC_F32);
+	return x;
+}
+
+struct ggml_tensor* ggml_nn_attention_chunked(struct ggml_context* ctx,
+	struct ggml_tensor* q, struct ggml_tensor* k, struct ggml_tensor* v, 
+	bool mask, int n_chunk)
+{
+	const int64_t n_tok = q->ne[1];
+	if (!(n_chunk > 0 && n_chunk < n_tok))
+		return ggml_nn_attention(ctx, q, k, v, mask);
+
+	float d_head = (float)q->ne[0];
+	struct ggml_tensor *out, *qc, *kq;
+
+	// Each chunk result is written in place into out.
+	// The chain of ggml_set_inplace makes the chunks be computed one after
+	// the other, so their kq matrices can share the same memory.
+	out = ggml_new_tensor_3d(ctx, GGML_TYPE_F32, v->ne[1], n_tok, q->ne[2]);
+	for (int64_t i0=0; i0<n_tok; i0+=n_chunk) {
+		int64_t n = ccMIN(n_chunk, n_tok - i0);
+		qc = ggml_view_3d(ctx, q, q->ne[0], n, q->ne[2], q->nb[1], q->nb[2],
+			q->nb[1] * i0);
+		kq = ggml_mul_mat(ctx, k, qc);  // [N * n_head, n, n_k]
+		kq = ggml_scale_inplace(ctx, kq, 1.0f / sqrt(d_head));
+		if (mask)  // query token i0+j sees the keys up to i0+j
+			kq = ggml_diag_mask_inf_inplace(ctx, kq, i0);
+		kq = ggml_soft_max_inplace(ctx, kq);
+		kq = ggml_mul_mat(ctx, v, kq);  // [N * n_head, n, d_head]
+		out = ggml_set_inplace(ctx, out, kq, out->nb[1], out->nb[2],
+			out->nb[3], out->nb[1] * i0);
+	}
+	return out;
 }
@@ -4,6 +4,7 @@
 #pragma once
 #include "ccommon/stream.h"
 #include "ggml.h"
+#include "ggml-backend.h"
 #include <inttypes.h>
 
 #define GGML_SHAPE_FMT  "%"PRId64"x%"PRId64"x%"PRId64"x%"PRId64
@@ -52,6 +53,9 @@ typedef struct {
 
 ggml_tensor_stat_st ggml_tensor_stat(const struct ggml_tensor* T);
 
+// Sets the number of threads if the backend supports it (e.g. CPU)
+void ggml__backend_set_n_threads(ggml_backend_t backend, int n_threads);
+
 // Operations
 
 void ggml_chunk_(struct ggml_context* ctx,
@@ -75,6 +79,27 @@ ggml_debug_export(struct ggml_context* ctx, struct ggml_tensor* t,
 
 // Neural networks operations
 
+// q: [N, n_token, d_head], k: [N, n_k, d_head], v: [N, d_head, n_k]
+// Returns: [N, n_token, d_head]
 struct ggml_tensor* ggml_nn_attention(struct ggml_context* ctx,
 	struct ggml_tensor* q, struct ggml_tensor* k, struct ggml_tensor* v, 
 	bool mask);
+
+/* Attention with ggml_flash_attn_ext: the kq matrix is never stored.
+ * K and V are converted to F16, the accumulation is in F32.
+ * q: [N, n_head, n_token, d_head]
+ * k, v: [N, n_head, n_k, d_head]
+ * Returns: [N, n_token, n_head, d_head]
+ */
+struct ggml_tensor* ggml_nn_attention_flash(struct ggml_context* ctx,
+	struct ggml_tensor* q, struct ggml_tensor* k, struct ggml_tensor* v, 
+	bool mask);
+
+/* Like ggml_nn_attention, but the queries are processed in chunks of
+ * n_chunk tokens, so that only the kq matrix of one chunk is in memory
+ * at a time instead of the full [n_token, n_k] one.
+ * n_chunk=0 or >= n_token: same as ggml_nn_attention.
+ */
+struct ggml_tensor* ggml_nn_attention_chunked(struct ggml_context* ctx,
+	struct ggml_tensor* q, struct ggml_tensor* k, struct ggml_tensor* v, 
+	bool mask, int n_chunk);
@@ -9,6 +9,13 @@
 #include <string.h>
 #include <math.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#define LT_SIMD  _Pragma("omp simd")
+#else
+#define LT_SIMD
+#endif
+
 static const char g_base64_chars[] =
 	"ABCDEFGHIJKLMNOPQRSTUVWXYZ" "abcdefghijklmnopqrstuvwxyz" "0123456789" "+/";
 
@@ -60,6 +67,63 @@ void ltensor_copy_slice(LocalTensor* dst, const LocalTensor* src,
 		dp[i0*ds0 +i1*ds1 +i2*ds2 +i3*ds3] = sp[i0*ss0 +i1*ss1 +i2*ss2 +i3*ss3];
 }
 
+/* Latent operations */
+
+int g_ltensor_n_thread = 0;
+
+// Elements per task, smaller tensors are done in one thread
+#define LT_OP_BLOCK  (1<<14)
+
+void ltensor_op_run(size_t n, LtOpFunc func, void* user)
+{
+	long nb = (n + LT_OP_BLOCK-1) / LT_OP_BLOCK;
+#ifdef _OPENMP
+	int nt = g_ltensor_n_thread > 0 ? g_ltensor_n_thread : omp_get_max_threads();
+	if (nt > nb) nt = nb;
+	if (nt < 1) nt = 1;  //empty tensor: num_threads must be positive
+	#pragma omp parallel for num_threads(nt) schedule(static) if(nt > 1)
+#endif
+	for (long b=0; b<nb; ++b) {
+		size_t i0 = b * LT_OP_BLOCK,
+		       i1 = i0 + LT_OP_BLOCK < n ? i0 + LT_OP_BLOCK : n;
+		func(user, i0, i1);
+	}
+}
+
+typedef struct {
+	float *o;
+	const float *x, *y, *z;
+	float a, b, c;
+} LtLinComb;
+
+static
+void ltensor_lincomb_op(void* user, size_t i0, size_t i1)
+{
+	const LtLinComb *A = user;
+	float *o=A->o, a=A->a, b=A->b, c=A->c;
+	const float *x=A->x, *y=A->y, *z=A->z;
+	if (z) {
+		LT_SIMD for (size_t i=i0; i<i1; ++i) o[i] = a*x[i] + b*y[i] + c*z[i];
+	} else if (y) {
+		LT_SIMD for (size_t i=i0; i<i1; ++i) o[i] = a*x[i] + b*y[i];
+	} else {
+		LT_SIMD for (size_t i=i0; i<i1; ++i) o[i] = a*x[i];
+	}
+}
+
+void ltensor_lincomb3(LocalTensor* out, float a, const LocalTensor* x,
+	float b, const LocalTensor* y, float c, const LocalTensor* z)
+{
+	assert( !y || ltensor_shape_equal(x, y) );
+	assert( !z || ltensor_shape_equal(x, z) );
+	if (out != x && out != y && out != z) ltensor_resize_like(out, x);
+	assert( ltensor_shape_equal(out, x) );
+	if (!z) c = 0;
+	if (!y) { y = z;  b = c;  z = NULL;  c = 0; }
+	LtLinComb A = { out->d, x->d, y ? y->d : NULL, z ? z->d : NULL, a, b, c };
+	ltensor_op_run(ltensor_nelements(x), ltensor_lincomb_op, &A);
+}
+
 int ltensor_finite_check(const LocalTensor* S)
 {
 	ltensor_for(*S,i,0)
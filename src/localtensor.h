@@ -152,6 +152,38 @@ void log_ltensor_stats(int loglvl, const LocalTensor* S, const char* desc);
 #define log_debug3_ltensor(T, D) \
 	log_ltensor_stats(LOG_LVL_DEBUG3, (T), (D))
 
+/* Latent operations
+ * Element-wise operations over whole tensors. The work is split in blocks
+ * run in parallel (if compiled with OpenMP), the loops are simple enough
+ * to be vectorized by the compiler.
+ */
+
+// Number of threads for the latent operations (0: all available)
+extern int g_ltensor_n_thread;
+
+// Operation over the elements [i0,i1)
+typedef void (*LtOpFunc)(void* user, size_t i0, size_t i1);
+
+/* Calls func over consecutive ranges covering [0,n), possibly in parallel.
+ * func must only write to the elements in its range.
+ */
+void ltensor_op_run(size_t n, LtOpFunc func, void* user);
+
+/* out = a*x + b*y + c*z
+ * y and z may be NULL to skip their terms. out may be any of the inputs,
+ * otherwise it is resized like x.
+ */
+void ltensor_lincomb3(LocalTensor* out, float a, const LocalTensor* x,
+	float b, const LocalTensor* y, float c, const LocalTensor* z);
+
+// out = a*x + b*y
+static inline
+void ltensor_lincomb(LocalTensor* out, float a, const LocalTensor* x,
+	float b, const LocalTensor* y)
+{
+	ltensor_lincomb3(out, a, x, b, y, 0, NULL);
+}
+
 // Reduces the sizes by the factors.
 // Can be done inplace (dst = src).
 void ltensor_downsize(LocalTensor* dst, const LocalTensor* src,
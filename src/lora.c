@@ -3,104 +3,221 @@
  */
 #include "lora.h"
 #include "ccommon/logging.h"
+#include "ccommon/bisect.h"
 #include "ggml.h"
 #include <math.h>
 
-int lora_apply_inner(TSTensorEntry* dst, TSTensorEntry* ld, TSTensorEntry* lu,
-	TSTensorEntry *ls, TSTensorEntry *la, float mult, MLCtx* C)
+// Limits of each group of tensors merged with one computation
+#define LORA_GROUP_N    128
+#define LORA_GROUP_NEL  (32<<20)  //elements of the targets
+
+typedef struct {
+	TSTensorEntry *dst, *ld, *lu;
+	unsigned n0, n1, n_inner;
+	float scale;
+	TSTensorData td_ld, td_lu, td_dst;
+	MLTensor *t_ld, *t_lu, *t_dst, *t_out;
+} LoraTarget;
+
+static
+void lora_target_free(LoraTarget* T)
+{
+	tstore_tdata_free(&T->td_dst);
+	tstore_tdata_free(&T->td_lu);
+	tstore_tdata_free(&T->td_ld);
+}
+
+/* Undo */
+
+void lora_undo_free(LoraUndo* undo)
+{
+	vec_forp(struct LoraOrig, undo->items, o, 0)
+		alloc_free(g_allocator, o->data);
+	vec_free(undo->items);
+	undo->size = 0;
+}
+
+// Keeps a copy of td, the data of e before being modified
+static
+void lora_undo_save(LoraUndo* undo, TSTensorEntry* e, const TSTensorData* td)
+{
+	BISECT_RIGHT_DECL(found, idx, 0, vec_count(undo->items),
+		undo->items[i_].e->key - e->key);
+	if (found) return;  //keep the original
+
+	struct LoraOrig o = { e, td->dtype, NULL, td->size };
+	o.data = alloc_alloc(g_allocator, td->size);
+	memcpy(o.data, td->data, td->size);
+	vec_insert(undo->items, idx, 1, &o);
+	undo->size += td->size;
+}
+
+int lora_undo_revert(LoraUndo* undo)
+{
+	int R=0;
+	TSTensorData td={0};
+
+	vec_forp(struct LoraOrig, undo->items, o, 0) {
+		// Nothing to do if the converted data is not in the cache anymore
+		BISECT_RIGHT_DECL(found, idx, 0, vec_count(o->e->cache),
+			o->e->cache[i_].dtype - o->dtype);
+		if (!found) continue;
+
+		TRY( tstore_tensor_data_get(o->e, o->dtype,
+			TSTDG_F_PERM | TSTDG_F_WRITE, &td) );
+		assert( td.size == o->size );
+		memcpy(td.data, o->data, td.size);
+		R++;
+	}
+
+end:
+	if (R<0) log_error("lora undo: %x", -R);
+	lora_undo_free(undo);
+	return R;
+}
+
+/* Apply */
+
+static
+int lora_target_prep(LoraTarget* T, TSTensorEntry* ls, TSTensorEntry* la,
+	float mult)
 {
 	int R=1;
-	TSTensorData td_ld={0}, td_lu={0}, td_dst={0};
-	
-	unsigned n_inner = ld->shape[ld->shape_n-1],
-	         n0 = tstore_tensor_count(ld) / n_inner,
-			 n1 = tstore_tensor_count(lu) / n_inner;
+	TSTensorData td={0};
+	TSTensorEntry *dst=T->dst, *ld=T->ld, *lu=T->lu;
+
+	T->n_inner = ld->shape[ld->shape_n-1];
+	T->n0 = tstore_tensor_count(ld) / T->n_inner;
+	T->n1 = tstore_tensor_count(lu) / T->n_inner;
 
 	if (!(dst->shape_n >= 2 &&
 		ld->shape_n == dst->shape_n &&
 		lu->shape_n == dst->shape_n &&
-		tstore_tensor_count(dst) == n0 * n1))
+		tstore_tensor_count(dst) == (uint64_t)T->n0 * T->n1))
 	{
 		ERROR_LOG(-1, "lora up/down invalid shapes");
 	}
 
-	// Must init ggml before any tensor conversion
-	mlctx_begin(C, "lora");
-	C->c.flags_e |= MLB_F_QUIET;
-
 	// Scale get
 	float scale=1;
 	if (ls) {
-		TRY( tstore_tensor_data_get(ls, TS_DTYPE_F32, 0, &td_ld) );
-		scale = *(float*)td_ld.data;
+		TRY( tstore_tensor_data_get(ls, TS_DTYPE_F32, 0, &td) );
+		scale = *(float*)td.data;
 	}
 	else if (la) {
-		TRY( tstore_tensor_data_get(la, TS_DTYPE_F32, 0, &td_ld) );
-		scale = *(float*)td_ld.data / n_inner;
+		TRY( tstore_tensor_data_get(la, TS_DTYPE_F32, 0, &td) );
+		scale = *(float*)td.data / T->n_inner;
 	}
 	scale *= mult;
 	assert( scale > 0 );
-	
-	// Get data
+	T->scale = scale;
+
+end:
+	tstore_tdata_free(&td);
+	return R;
+}
+
+/* Merges a group of targets with one computation.
+ * The targets are converted in parallel, then the data of each one is
+ * uploaded and the result written back into its permanent store data.
+ */
+static
+int lora_apply_group(LoraTarget* tgts, unsigned n, MLCtx* C, LoraUndo* undo)
+{
+	int R=1;
+	TSTensorEntry **ents=NULL;  //vector
+	TSDType *dtypes=NULL;  //vector
+
+	// Must init ggml before any tensor conversion
+	mlctx_begin(C, "lora");
+	C->c.flags_e |= MLB_F_QUIET;
+
 	int wtype = C->c.wtype;
 	int tsdt = tstore_dtype_from_ggml(wtype);
 	assert( tsdt > 0 );
-	
-	TRY( tstore_tensor_data_get(ld , tsdt, 0, &td_ld ) );
-	TRY( tstore_tensor_data_get(lu , tsdt, 0, &td_lu ) );
-	TRY( tstore_tensor_data_get(dst, tsdt, TSTDG_F_PERM | TSTDG_F_WRITE, &td_dst) );
+
+	// Get data
+	for (unsigned i=0; i<n; ++i) {
+		vec_push(ents, tgts[i].ld);   vec_push(dtypes, tsdt);
+		vec_push(ents, tgts[i].lu);   vec_push(dtypes, tsdt);
+		vec_push(ents, tgts[i].dst);  vec_push(dtypes, tsdt);
+	}
+	TRY( tstore_tensors_convert(vec_count(ents), ents, dtypes) );
+
+	for (unsigned i=0; i<n; ++i) {
+		LoraTarget *T = &tgts[i];
+		TRY( tstore_tensor_data_get(T->ld, tsdt, 0, &T->td_ld) );
+		TRY( tstore_tensor_data_get(T->lu, tsdt, 0, &T->td_lu) );
+		TRY( tstore_tensor_data_get(T->dst, tsdt,
+			TSTDG_F_PERM | TSTDG_F_WRITE, &T->td_dst) );
+		if (undo) lora_undo_save(undo, T->dst, &T->td_dst);
+	}
 
 	// Make graph
-	MLTensor *t_ld, *t_lu, *t_dst, *t_out;
-	t_ld  = mlctx_input_new(C, "ld" , wtype, n0, n_inner, 1, 1);
-	t_lu  = mlctx_input_new(C, "lu" , wtype, n_inner, n1, 1, 1);
-	t_dst = mlctx_input_new(C, "dst", wtype, n0, n1, 1, 1);
-	
-	t_out = ggml_cont(C->cc, ggml_transpose(C->cc, t_ld));
-	t_out = ggml_mul_mat(C->cc, t_lu, t_out);
-	t_out = ggml_cont(C->cc, ggml_transpose(C->cc, t_out));
-	t_out = ggml_scale_inplace(C->cc, t_out, scale);
-	t_out = ggml_add_inplace(C->cc, t_dst, t_out);
-	
-	mlctx_tensor_add(C, "output", t_out);
+	for (unsigned i=0; i<n; ++i) {
+		LoraTarget *T = &tgts[i];
+		T->t_ld  = mlctx_input_new(C, "ld" , wtype, T->n0, T->n_inner, 1, 1);
+		T->t_lu  = mlctx_input_new(C, "lu" , wtype, T->n_inner, T->n1, 1, 1);
+		T->t_dst = mlctx_input_new(C, "dst", wtype, T->n0, T->n1, 1, 1);
+		// The result is written directly in the store memory if possible
+		mlctx_input_host_bind(C, T->t_dst, T->td_dst.data);
+
+		MLTensor *t = ggml_cont(C->cc, ggml_transpose(C->cc, T->t_ld));
+		t = ggml_mul_mat(C->cc, T->t_lu, t);
+		t = ggml_cont(C->cc, ggml_transpose(C->cc, t));
+		t = ggml_scale_inplace(C->cc, t, T->scale);
+		t = ggml_add_inplace(C->cc, T->t_dst, t);
+		T->t_out = mlctx_output_add(C, t);
+	}
+	mlctx_tensor_add(C, "output", tgts[n-1].t_out);
 	TRY( mlctx_prep(C) );
 
 	// Set inputs
-	ggml_backend_tensor_set(t_ld , td_ld .data, 0, td_ld .size);
-	ggml_backend_tensor_set(t_lu , td_lu .data, 0, td_lu .size);
-	ggml_backend_tensor_set(t_dst, td_dst.data, 0, td_dst.size);
+	for (unsigned i=0; i<n; ++i) {
+		LoraTarget *T = &tgts[i];
+		ggml_backend_tensor_set(T->t_ld, T->td_ld.data, 0, T->td_ld.size);
+		ggml_backend_tensor_set(T->t_lu, T->td_lu.data, 0, T->td_lu.size);
+		if (T->t_dst->data != T->td_dst.data)
+			ggml_backend_tensor_set(T->t_dst, T->td_dst.data, 0,
+				T->td_dst.size);
+	}
 
 	// Compute
 	TRY( mlctx_compute(C) );
 
-	// Store output
-	assert( ggml_nbytes(t_out) == td_dst.size );
-	ggml_backend_tensor_get(t_out, td_dst.data, 0, td_dst.size);
-	
-	// Check
-	float v=0;
-	if (wtype == GGML_TYPE_F16)
-		v = ggml_fp16_to_fp32(*(ggml_fp16_t*)td_dst.data);
-	else if (wtype == GGML_TYPE_F32)
-		v = *(float*)td_dst.data;
-	if (!isfinite(v))
-		ERROR_LOG(-1, "NaN in LoRA result");
+	// Store outputs
+	for (unsigned i=0; i<n; ++i) {
+		LoraTarget *T = &tgts[i];
+		assert( ggml_nbytes(T->t_out) == T->td_dst.size );
+		if (T->t_out->data != T->td_dst.data)
+			ggml_backend_tensor_get(T->t_out, T->td_dst.data, 0,
+				T->td_dst.size);
+
+		// Check
+		float v=0;
+		if (wtype == GGML_TYPE_F16)
+			v = ggml_fp16_to_fp32(*(ggml_fp16_t*)T->td_dst.data);
+		else if (wtype == GGML_TYPE_F32)
+			v = *(float*)T->td_dst.data;
+		if (!isfinite(v))
+			ERROR_LOG(-1, "NaN in LoRA result");
+	}
 
 end:
 	mlctx_end(C);
-	tstore_tdata_free(&td_dst);
-	tstore_tdata_free(&td_lu);
-	tstore_tdata_free(&td_ld);
+	for (unsigned i=0; i<n; ++i) lora_target_free(&tgts[i]);
+	vec_free(dtypes);
+	vec_free(ents);
 	return R;
 }
 
 int lora_apply(TensorStore* ts_dst, TensorStore* ts_lora, float mult,
-	MLCtx* ctx)
+	MLCtx* ctx, LoraUndo* undo)
 {
 	int R=1;
 	StrSlice name={0};
-	TSTensorData td={0};
 	DynStr tmps=NULL;
+	LoraTarget *tgts=NULL;  //vector
 
 	vec_forp(TSTensorEntry, ts_lora->tensors, ld, 0) {
 		name = strsto_get(ts_lora->ss, ld->key);
@@ -125,14 +242,32 @@ int lora_apply(TensorStore* ts_dst, TensorStore* ts_lora, float mult,
 		dstr_appendz(tmps, ".alpha");
 		TSTensorEntry *la = tstore_tensor_get(ts_lora, tmps);
 
-		// Apply
-		log_debug("lora apply %.*s", (int)name.s, name.b);
-		TRY( lora_apply_inner(dst, ld, lu, ls, la, mult, ctx) );
+		LoraTarget T = { dst, ld, lu };
+		TRY( lora_target_prep(&T, ls, la, mult) );
+		vec_push(tgts, T);
 	}
+	name = (StrSlice){0};
+
+	// Apply by groups
+	unsigned i0=0, n_grp=0;
+	while (i0 < vec_count(tgts)) {
+		unsigned i1=i0;
+		uint64_t nel=0;
+		do nel += (uint64_t)tgts[i1].n0 * tgts[i1].n1;
+		while (++i1 < vec_count(tgts) && i1-i0 < LORA_GROUP_N &&
+			nel + (uint64_t)tgts[i1].n0 * tgts[i1].n1 <= LORA_GROUP_NEL);
+
+		log_debug("lora apply group %u-%u", i0, i1);
+		TRY( lora_apply_group(&tgts[i0], i1-i0, ctx, undo) );
+		i0 = i1;
+		n_grp++;
+	}
+	log_debug("lora tensors:%u groups:%u", vec_count(tgts), n_grp);
 
 end:
-	if (R<0) log_error("lora tensor '%.*s': %x", (int)name.s, name.b, -R);
-	tstore_tdata_free(&td);
+	if (R<0 && name.s)
+		log_error("lora tensor '%.*s': %x", (int)name.s, name.b, -R);
+	vec_free(tgts);
 	dstr_free(tmps);
 	return R;
 }
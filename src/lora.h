@@ -8,5 +8,29 @@
 #include "ccompute/tensorstore.h"
 #include "mlblock.h"
 
+/* Original data of the tensors modified by lora_apply, to revert them
+ * without converting again the whole model.
+ */
+typedef struct {
+	struct LoraOrig {
+		TSTensorEntry *e;
+		TSDType dtype;
+		void *data;  //owned copy
+		size_t size;
+	} *items;  //vector, key sorted
+	size_t size;
+} LoraUndo;
+
+/* Merges the LoRA into the weights of ts_dst (converted to ctx->c.wtype).
+ * undo: if not NULL, the original data of the modified tensors not yet
+ * present is added to it.
+ */
 int lora_apply(TensorStore* ts_dst, TensorStore* ts_lora, float mult,
-	MLCtx* ctx);
+	MLCtx* ctx, LoraUndo* undo);
+
+/* Restores the original data of the tensors and empties undo.
+ * Returns the number of tensors restored.
+ */
+int lora_undo_revert(LoraUndo* undo);
+
+void lora_undo_free(LoraUndo* undo);
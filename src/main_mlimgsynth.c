@@ -50,6 +50,9 @@ APP_NAME_VERSION "\n"
 "  --ilatent PATH       Input latent tensor.\n"
 "  --ilmask PATH        Input latent mask tensor.\n"
 "  -o --output PATH     Output image path.\n"
+"                       With a batch, an index is added: out.png -> out-1.png.\n"
+"  --batch-size INT     Number of images to generate simultaneously.\n"
+"                       Each image i uses the seed SEED+i.\n"
 "  --no-prompt-parse BOOL  Use prompt as raw text, do not parse emphasis or loras.\n"
 "\n"
 "Models and backend:\n"
@@ -61,13 +64,24 @@ APP_NAME_VERSION "\n"
 "  --lora-dir PATH      Directory to search for LoRA's found in the prompt as:\n"
 "                       <lora:NAME:MULT>\n"
 "                       where NAME is the file name without extension.\n"
+"  --lora-runtime BOOL  Apply the LoRA's during the computation instead of\n"
+"                       merging them. Changing them does not reload the model.\n"
 "  -b --backend NAME    Backend for computation (passed to GGML).\n"
 "  -t --threads INT     Number of threads to use in the CPU backend.\n"
-"  --unet-split BOOL    Split each unet steps to reduce memory usage.\n"
+"  --unet-split INT     Split each unet steps to reduce memory usage.\n"
+"                       1: rebuild each part on every step (least memory).\n"
+"                       2: keep both parts during the generation (faster).\n"
+"  --unet-kv-pre BOOL   Compute the prompt cross attention K/V only once.\n"
 "  --vae-tile INT       Encode and decode images using tiles of NxN pixels.\n"
 "                       Reduces memory usage. On doubt, try 512.\n"
+"                       PNG and JPEG outputs are saved while decoding.\n"
+"  --vae-tile-workers INT  Number of tiles computed in parallel (CPU only).\n"
+"  --attn-chunk INT     Compute the attention in chunks of N query tokens.\n"
+"                       Reduces memory usage with large images (try 1024).\n"
 "  --weight-type NAME   Use this data type for some model weights.\n"
 "                       Useful to quantize and reduce memory usage (try q8_0).\n"
+"  --weight-cache PATH  Directory to cache the converted weights between runs.\n"
+"                       Avoids quantizing them again with --weight-type.\n"
 "\n"
 "Sampling:\n"
 "  -S --seed INT        RNG seed.\n"
@@ -314,50 +328,124 @@ end:
 	return R;
 }
 
-int cli_image_save(const Image* img, const char* info_text, const char* path)
+const ImageCodec* cli_image_save_codec(const char* path)
+{
+	if (cli_path_pipe_is(path))
+		return img_codec_by_name("pnm");
+	return img_codec_detect_filename(path, IMG_OF_SAVE);
+}
+
+// Opens the output and sets the metadata, ready to save an image
+int cli_image_save_open(ImageIO* imgio, Stream* stm, const char* info_text,
+	const char* path)
 {
 	int R=1;
-	Stream stm={0};
-	ImageIO imgio={0};
 	DynStr tmps=NULL;
 	
 	log_debug("Saving image to '%s'", path);
 
-	const ImageCodec* codec;
-	if (cli_path_pipe_is(path)) {
-		codec = img_codec_by_name("pnm");
-	}
-	else {
-		codec = img_codec_detect_filename(path, IMG_OF_SAVE);
-		if (!codec)
-			ERROR_LOG(-1, "Cannot find an image codec to save '%s'", path);
-	}
+	const ImageCodec* codec = cli_image_save_codec(path);
+	if (!codec)
+		ERROR_LOG(-1, "Cannot find an image codec to save '%s'", path);
 
-	TRY( cli_stream_open(&stm, path, SOF_CREATE) );
+	TRY( cli_stream_open(stm, path, SOF_CREATE) );
 
-	TRY( imgio_open_stream(&imgio, &stm, IMG_OF_SAVE, codec) );
+	TRY( imgio_open_stream(imgio, stm, IMG_OF_SAVE, codec) );
 
 	if (info_text) {
 		const char *info_key = "parameters";
 		dstr_copyz(tmps, info_key);
 		dstr_push(tmps, '\0');
 		dstr_appendz(tmps, info_text);
-		int r = imgio_value_set(&imgio, IMG_VALUE_METADATA, tmps,
+		int r = imgio_value_set(imgio, IMG_VALUE_METADATA, tmps,
 				dstr_count(tmps)+1);
 		if (r<0)
 			log_warning("Cannot write '%s' in '%s'", info_key, path);
 	}
 
-	TRY( imgio_save(&imgio, img) );
-
 end:
 	if (R<0) log_error("Cannot save image to '%s'", path );
 	dstr_free(tmps);
+	return R;
+}
+
+int cli_image_save(const Image* img, const char* info_text, const char* path)
+{
+	int R=1;
+	Stream stm={0};
+	ImageIO imgio={0};
+
+	TRY( cli_image_save_open(&imgio, &stm, info_text, path) );
+	TRY_LOG( imgio_save(&imgio, img), "Cannot save image to '%s'", path );
+
+end:
 	imgio_free(&imgio);
 	stream_close(&stm, 0);
 	return R;
 }
 
+// Output path of an image in the batch: adds the index before the extension
+const char* cli_batch_path(DynStr* ptmps, const char* path, int idx,
+	int n_batch)
+{
+	if (n_batch <= 1 || cli_path_pipe_is(path)) return path;
+	const char *ext = path_extdot(path);
+	dstr_copy(*ptmps, ext-path, path);
+	dstr_printfa(*ptmps, "-%d%s", idx+1, ext);
+	return *ptmps;
+}
+
+/* Saves the images while they are decoded (MLIS_OPT_IMAGE_SINK).
+ */
+typedef struct {
+	const char *path;
+	int n_batch;
+	struct CliImageOut { ImageIO imgio; Stream stm; } *outs;  //vector
+	DynStr tmps;
+} CliImageSink;
+
+static
+void cli_image_sink_close(struct CliImageOut* o)
+{
+	imgio_free(&o->imgio);
+	stream_close(&o->stm, 0);
+}
+
+static
+void cli_image_sink_free(CliImageSink* S)
+{
+	vec_for(S->outs,i,0) cli_image_sink_close(&S->outs[i]);
+	vec_free(S->outs);
+	dstr_free(S->tmps);
+}
+
+static
+int cli_image_sink(void* user, MLIS_Ctx* ctx, const MLIS_Image* band,
+	int idx, unsigned y, unsigned h)
+{
+	int R=1;
+	CliImageSink *S = user;
+	struct CliImageOut *o = &S->outs[idx];
+	const char *path = cli_batch_path(&S->tmps, S->path, idx, S->n_batch);
+
+	if (y == 0) {
+		cli_image_sink_close(o);
+		const char *info = mlis_infotext_get(ctx, idx);
+		TRY( cli_image_save_open(&o->imgio, &o->stm, info, path) );
+	}
+
+	Image img = mlis_image_to_image(band);
+	TRY_LOG( imgio_save_rows(&o->imgio, &img, y, h),
+		"Cannot save image to '%s'", path );
+	
+	if (y + band->h == h)
+		cli_image_sink_close(o);
+
+end:
+	if (R<0) cli_image_sink_close(o);
+	return R;
+}
+
 int cli_tensor_load(MLIS_Tensor* ten, const char* path)
 {
 	int R=1;
@@ -447,6 +535,8 @@ int mlis_cli_generate(MLIS_CliOptions* opt, MLIS_Ctx* ctx)
 	int tuflags=0;
 	const char *path;
 	Image image={0};
+	DynStr tmps=NULL;
+	CliImageSink sink={0};
 
 	// Load input image for img2img
 	if ((path = opt->path_input_image)) {
@@ -481,17 +571,39 @@ int mlis_cli_generate(MLIS_CliOptions* opt, MLIS_Ctx* ctx)
 	if (tuflags)
 		mlis_option_set(ctx, MLIS_OPT_TENSOR_USE_FLAGS, tuflags);
 
+	// With tiles, save the images by rows while they are decoded
+	int n_batch=1, vae_tile=0;
+	mlis_option_get(ctx, MLIS_OPT_BATCH_SIZE, &n_batch);
+	mlis_option_get(ctx, MLIS_OPT_VAE_TILE, &vae_tile);
+	if ((path = opt->path_output_image) && vae_tile > 0) {
+		const ImageCodec *codec = cli_image_save_codec(path);
+		if (codec && codec->save.rows) {
+			sink.path = path;
+			sink.n_batch = n_batch;
+			vec_resize_zero(sink.outs, n_batch);
+			mlis_option_set(ctx, MLIS_OPT_IMAGE_SINK, cli_image_sink, &sink);
+		}
+	}
+
 	mlis_generate(ctx);
 	
-	// Save output image
-	if ((path = opt->path_output_image)) {
-		MLIS_Image *img = mlis_image_get(ctx, 0);
-		const char *info = mlis_infotext_get(ctx, 0);
-		Image image = mlis_image_to_image(img);
-		TRY( cli_image_save(&image, info, path) );
+	// Save output images
+	if ((path = opt->path_output_image) && !sink.outs) {
+		for (int i=0; i<n_batch; ++i) {
+			MLIS_Image *img = mlis_image_get(ctx, i);
+			const char *info = mlis_infotext_get(ctx, i);
+			Image image = mlis_image_to_image(img);
+			TRY( cli_image_save(&image, info,
+				cli_batch_path(&tmps, path, i, n_batch)) );
+		}
 	}
 
 end:
+	if (sink.outs) {
+		mlis_option_set(ctx, MLIS_OPT_IMAGE_SINK, NULL, NULL);
+		cli_image_sink_free(&sink);
+	}
+	dstr_free(tmps);
 	img_free(&image);
 	return R;
 }
@@ -0,0 +1,764 @@
+/* Copyright 2025, Alejandro A. García <aag@zorzal.net>
+ * SPDX-License-Identifier: MIT
+ *
+ * Offline benchmark of the model stages (UNet, VAE, CLIP, LoRA) using
+ * synthetic models with random weights. No model files are needed.
+ * The results are written as JSON.
+ */
+#include "ccommon/timing.h"
+#include "ccommon/logging.h"
+#include "ccommon/stream.h"
+#include "ccommon/rng_philox.h"
+#include "ccompute/tensorstore.h"
+#include "mlblock.h"
+#include "localtensor.h"
+#include "unet.h"
+#include "vae.h"
+#include "clip.h"
+#include "lora.h"
+#include "ggml-backend.h"
+#include <sys/resource.h>
+#include <stdio.h>
+#include <math.h>
+
+const char help_string[] =
+	"Usage: mlimgsynth-bench [OPTIONS]\n"
+	"Benchmark the model stages using synthetic models with random weights.\n"
+	"The results are written as JSON.\n"
+	"Lists are comma separated, all the combinations are run.\n"
+	"\n"
+	"Options:\n"
+	"  -m NAME     Model: sd1 (default), sd2, sdxl.\n"
+	"  -s LIST     Stages: unet, vae-decode, vae-encode, clip, lora.\n"
+	"              Default: unet,vae-decode,clip.\n"
+	"  -S LIST     Image sizes as WxH (default: model native size).\n"
+	"  -t LIST     CPU threads (default: backend default).\n"
+	"  -T LIST     Weights types (default: f16).\n"
+	"  -n INT      Repetitions of each stage (UNet steps, default 4).\n"
+	"  -B INT      Batch size (default 1).\n"
+	"  -b NAME     Backend (passed to GGML).\n"
+	"  -w INT      VAE tile size in pixels (default 0: no tiling).\n"
+	"  -W INT      VAE tile workers.\n"
+	"  -r INT      LoRA rank (default 32).\n"
+	"  -a INT      Attention queries chunk size (default 0: disabled).\n"
+	"  -o PATH     Output file (default stdout).\n"
+	"\n"
+	"  -q          Quiet: reduces information output\n"
+	"  -v          Verbose: increases information output\n"
+	"  -d          Enables debug output\n"
+	"  -h          Print this message\n"
+	;
+
+typedef struct {
+	const char *name;
+	const UnetParams *unet;
+	const VaeParams *vae;
+	const ClipParams *clip, *clip2;
+	unsigned img_size;  //native
+	int clip_skip;
+} BenchModel;
+
+static const BenchModel g_models[] = {
+	{ "sd1",  &g_unet_sd1,  &g_vae_sd1,  &g_clip_vit_l_14, NULL, 512, 1 },
+	{ "sd2",  &g_unet_sd2,  &g_vae_sd1,  &g_clip_vit_h_14, NULL, 768, 2 },
+	{ "sdxl", &g_unet_sdxl, &g_vae_sdxl, &g_clip_vit_l_14,
+		&g_clip_vit_bigg_14, 1024, 2 },
+};
+
+typedef struct {
+	const char *stage, *unit;
+	unsigned w, h, n_batch, n_thread;
+	int wtype;
+	unsigned n_run;
+	double t_setup,  //graph build and weights load
+	       t_first, t_sum, t_min,  //t_mean excludes the first run
+	       thrp_f;  //throughput = thrp_f / t_mean
+	size_t mem_backend;
+	long rss_peak;
+	bool rss_stage;  //rss_peak of this stage only, else of the whole process
+} BenchResult;
+
+typedef struct {
+	MLCtx ctx;
+	TensorStore ts;
+	StringStore ss;
+	Stream so;
+	RngPhilox rng;
+	const BenchModel *model;
+	BenchResult *results;  //vector
+	int ts_wtype;  //weights type of the random tensors in ts
+
+	struct {
+		const char *model, *stages, *sizes, *threads, *wtypes,
+		           *backend, *path_out;
+		int n_rep, n_batch, vae_tile, vae_workers, lora_rank;
+	} c;
+} Bench;
+
+void bench_free(Bench* B)
+{
+	mlctx_resident_clear(&B->ctx);
+	mlctx_free(&B->ctx);
+	if (B->ctx.backend) ggml_backend_free(B->ctx.backend);
+	tstore_free(&B->ts);
+	strsto_free(&B->ss);
+	stream_close(&B->so, 0);
+	vec_free(B->results);
+}
+
+// Load options from command line arguments
+int bench_argv_load(Bench* B, int argc, char* argv[])
+{
+	int R=1;
+
+	int i, j;
+	for (i=1; i<argc; ++i) {
+		char * arg = argv[i];
+		if (arg[0] == '-') {
+			char opt;
+			for (j=1; (opt = arg[j]); ++j) {
+				char * next = (i+1 < argc) ? argv[i+1] : "";
+				switch (opt) {
+				case 'm':  B->c.model   = next; i++; break;
+				case 's':  B->c.stages  = next; i++; break;
+				case 'S':  B->c.sizes   = next; i++; break;
+				case 't':  B->c.threads = next; i++; break;
+				case 'T':  B->c.wtypes  = next; i++; break;
+				case 'b':  B->c.backend = next; i++; break;
+				case 'o':  B->c.path_out = next; i++; break;
+				case 'n':  B->c.n_rep       = atoi(next); i++; break;
+				case 'B':  B->c.n_batch     = atoi(next); i++; break;
+				case 'w':  B->c.vae_tile    = atoi(next); i++; break;
+				case 'W':  B->c.vae_workers = atoi(next); i++; break;
+				case 'r':  B->c.lora_rank   = atoi(next); i++; break;
+				case 'a':  B->ctx.c.attn_chunk = atoi(next); i++; break;
+				case 'q':  log_level_inc(-LOG_LVL_STEP); break;
+				case 'v':  log_level_inc(+LOG_LVL_STEP); break;
+				case 'd':  log_level_set(LOG_LVL_DEBUG); break;
+				case 'h':
+					return 0;
+				default:
+					ERROR_LOG(-1, "Unknown option '%c'", opt);
+				}
+			}
+		}
+		else {
+			ERROR_LOG(-1, "Excess of arguments");
+		}
+	}
+
+	// Defaults
+	IFFALSESET(B->c.model, "sd1");
+	IFFALSESET(B->c.stages, "unet,vae-decode,clip");
+	IFFALSESET(B->c.threads, "0");
+	IFFALSESET(B->c.wtypes, "f16");
+	IFNPOSSET(B->c.n_rep, 4);
+	IFNPOSSET(B->c.n_batch, 1);
+	IFNPOSSET(B->c.lora_rank, 32);
+
+end:
+	return R;
+}
+
+/* Copies in buf the next item of the comma separated list *ps.
+ * Returns false at the end of the list.
+ */
+static
+bool list_next(const char** ps, char* buf, size_t bufsz)
+{
+	const char *s=*ps, *e;
+	if (!s || !*s) return false;
+	e = strchr(s, ',');
+	if (!e) e = s + strlen(s);
+	size_t n = ccMIN((size_t)(e - s), bufsz-1);
+	memcpy(buf, s, n);
+	buf[n] = 0;
+	*ps = *e ? e+1 : e;
+	return true;
+}
+
+// Initialize after configuration
+int bench_setup(Bench* B)
+{
+	int R=1, r;
+
+	for (unsigned i=0; i<COUNTOF(g_models); ++i)
+		if (!strcmp(g_models[i].name, B->c.model)) B->model = &g_models[i];
+	if (!B->model) ERROR_LOG(-1, "Unknown model '%s'", B->c.model);
+
+	if (B->c.path_out) {
+		r = stream_open_file(&B->so, B->c.path_out, SOF_CREATE);
+		TRY_LOG(r, "Could not open '%s'", B->c.path_out );
+	} else {
+		r = stream_open_std(&B->so, STREAM_STD_OUT, SOF_WRITE);
+		TRY_LOG(r, "Could not open stdout");
+	}
+
+	if (B->c.backend)
+		B->ctx.backend = ggml_backend_init_by_name(B->c.backend, NULL);
+	else
+		B->ctx.backend = ggml_backend_init_best();
+	if (!B->ctx.backend) ERROR_LOG(-1, "ggml backend init");
+	log_info("Backend: %s", ggml_backend_name(B->ctx.backend));
+
+	B->ts.ss = &B->ss;
+	B->ctx.tstore = &B->ts;
+	B->ctx.ss = &B->ss;
+	B->ctx.c.wtype = GGML_TYPE_F16;
+	B->ctx.c.flags = MLB_F_FUSED_QKV;  //like the library
+	B->rng.seed = 1;
+	unet_params_init();
+
+end:
+	return R;
+}
+
+/* Synthetic weights */
+
+/* Fills t with random values like a trained model would have:
+ * normal with std 1/sqrt(fan_in) for the weights, ones for the 1-D weights
+ * (normalization) and zeros for the biases.
+ */
+static
+int bench_tensor_random(Bench* B, const MLTensor* t, StrSlice name,
+	TSTensorData* td)
+{
+	int R=1;
+	float *tmp=NULL;
+
+	int n_dims = ggml_n_dims(t);
+	size_t n_row = ggml_nrows(t), n_col = t->ne[0],
+	       n_tot = n_row * n_col;
+	float v_1d = -1;
+	if (n_dims == 1)
+		v_1d = strsl_endswith(name, strsl_static("bias")) ? 0 : 1;
+	float std = 1 / sqrt(n_tot / t->ne[n_dims-1]);
+
+	if (n_col % ggml_blck_size(t->type))
+		ERROR_LOG(-1, "tensor '%.*s' invalid row size %zu for type %s",
+			(int)name.s, name.b, n_col, ggml_type_name(t->type));
+
+	int dt = tstore_dtype_from_ggml(t->type);
+	if (dt < 0) ERROR_LOG(-1, "unsupported tensor type %s",
+		ggml_type_name(t->type));
+
+	size_t sz = ggml_row_size(t->type, n_col) * n_row;
+	*td = (TSTensorData){ .dtype=dt, .data=alloc_alloc(g_allocator, sz),
+		.size=sz, .ownmem=1, .perm=1 };
+
+	// Rows processed at once
+	// Each tensor has its own sequence, independent of the fill order
+	size_t n_chunk = ccMAX(1, 65536 / n_col);
+	RngPhilox rng = { .seed = B->rng.seed + strsto_find(&B->ss, name) };
+
+	#pragma omp parallel for private(tmp)
+	for (size_t r0=0; r0<n_row; r0+=n_chunk) {
+		size_t nr = ccMIN(n_chunk, n_row - r0), n = nr * n_col;
+		tmp = alloc_alloc(g_allocator, n * sizeof(float));
+		if (v_1d >= 0)
+			for (size_t i=0; i<n; ++i) tmp[i] = v_1d;
+		else {
+			rng_philox_randn_at(&rng, r0*n_col, n, tmp);
+			for (size_t i=0; i<n; ++i) tmp[i] *= std;
+		}
+		ggml_quantize_chunk(t->type, tmp, td->data, r0*n_col, nr, n_col, NULL);
+		alloc_free(g_allocator, tmp);
+	}
+
+end:
+	return R;
+}
+
+/* Builds a graph with the parameters of a stage and adds random values for
+ * the ones not yet in the tensor store.
+ */
+static
+int bench_params_fill(Bench* B, const char* tprefix,
+	MLTensor* (*build)(MLCtx*, const void*), const void* par)
+{
+	int R=1;
+	MLCtx *C = &B->ctx;
+	unsigned n=0;
+	size_t sz=0;
+
+	// Without fused params, the store has the same tensors as a model file
+	int flags = C->c.flags;
+	C->c.flags &= ~MLB_F_FUSED_QKV;
+	C->c.n_tensor_max = 10240;
+	mlctx_begin(C, "bench params");
+	build(C, par);
+	MLTensor *result = vec_last(C->tensors,0).tensor;
+	mlctx_tensor_add(C, tprefix, result);
+	TRY( mlctx_load_prep(C) );
+
+	double t = timing_time();
+	vec_forp(MLCtxTensor, C->tensors, p, 0)
+	{
+		if (!(p->tensor && p->tensor->op == GGML_OP_NONE)) continue;
+		if (tstore_tensor_getk(&B->ts, p->key)) continue;
+
+		const MLTensor *pt = p->tensor;
+		TSTensorData td={0};
+		TRY( bench_tensor_random(B, pt, strsto_get(&B->ss, p->key), &td) );
+
+		TSTensorEntry e = { .dtype=td.dtype, .size=td.size,
+			.shape_n=ggml_n_dims(pt) };
+		for (unsigned i=0; i<COUNTOF(e.shape); ++i) e.shape[i] = pt->ne[i];
+		vec_push(e.cache, td);
+		tstore_tensor_addk(&B->ts, p->key, &e);
+		sz += td.size;
+		n++;
+	}
+	if (n) log_info("%s random params: %u %.1fMiB {%.3fs}", tprefix,
+		n, sz / (1024.0*1024.0), timing_time() - t);
+
+end:
+	mlctx_end(C);
+	C->c.n_tensor_max = 0;
+	C->c.flags = flags;
+	return R;
+}
+
+static
+MLTensor* bench_build_unet(MLCtx* C, const void* par)
+{
+	const UnetParams *P = par;
+	MLTensor *x, *t, *c, *l=NULL;
+	x = mlctx_input_new(C, "x", GGML_TYPE_F32, 8, 8, 4, 1);
+	t = mlctx_input_new(C, "t", GGML_TYPE_F32, 1, 1, 1, 1);
+	c = mlctx_input_new(C, "c", GGML_TYPE_F32, P->n_ctx, 77, 1, 1);
+	if (P->ch_adm_in)
+		l = mlctx_input_new(C, "l", GGML_TYPE_F32, P->ch_adm_in, 1, 1, 1);
+	return mlb_unet_denoise(C, x, t, c, l, P);
+}
+
+static
+MLTensor* bench_build_vae_dec(MLCtx* C, const void* par)
+{
+	const VaeParams *P = par;
+	MLTensor *x = mlctx_input_new(C, "latent", GGML_TYPE_F32, 8, 8, P->ch_z, 1);
+	return mlb_sdvae_decoder(C, x, P);
+}
+
+static
+MLTensor* bench_build_vae_enc(MLCtx* C, const void* par)
+{
+	const VaeParams *P = par;
+	MLTensor *x = mlctx_input_new(C, "img", GGML_TYPE_F32, 64, 64, P->ch_x, 1);
+	return mlb_sdvae_encoder(C, x, P);
+}
+
+// All the CLIP params, including the features projection
+static
+MLTensor* bench_build_clip(MLCtx* C, const void* par)
+{
+	const ClipParams *P = par;
+	MLTensor *x = mlctx_input_new(C, "tokens", GGML_TYPE_I32, P->n_token,1,1,1);
+	x = mlb_clip_text(C, x, NULL, P, -1, true);
+	mlctx_output_add(C, x);
+	x = mlb_clip_text_proj(C, x, 1);
+	return mlctx_tensor_add(C, "text", x);
+}
+
+/* Peak resident memory */
+
+// Resets the peak to the current resident memory (Linux only)
+static
+bool rss_peak_reset(void)
+{
+	FILE *f = fopen("/proc/self/clear_refs", "w");
+	if (!f) return false;
+	bool ok = fputs("5", f) >= 0;
+	if (fclose(f) != 0) ok = false;
+	return ok;
+}
+
+// Peak resident memory since the last reset, -1 if unknown
+static
+long rss_peak_get(void)
+{
+	long v=-1;
+	char line[128];
+	FILE *f = fopen("/proc/self/status", "r");
+	if (!f) return -1;
+	while (fgets(line, sizeof(line), f))
+		if (sscanf(line, "VmHWM: %ld kB", &v) == 1) break;
+	fclose(f);
+	return v < 0 ? -1 : v * 1024L;
+}
+
+/* Results */
+
+static
+BenchResult* bench_result_new(Bench* B, const char* stage, const char* unit,
+	unsigned w, unsigned h, unsigned n_batch, unsigned n_thread)
+{
+	vec_push(B->results, ((BenchResult){ .stage=stage,
+		.unit=unit, .w=w, .h=h, .n_batch=n_batch, .n_thread=n_thread,
+		.wtype=B->ctx.c.wtype }));
+	BenchResult *r = &vec_last(B->results,0);
+	r->rss_stage = rss_peak_reset();
+	return r;
+}
+
+static
+void bench_result_time(BenchResult* r, double t)
+{
+	if (!r->n_run++) { r->t_first = t;  r->t_min = t; }
+	MINSET(r->t_min, t);
+	r->t_sum += t;
+}
+
+static
+void bench_result_end(Bench* B, BenchResult* r)
+{
+	r->rss_peak = r->rss_stage ? rss_peak_get() : -1;
+	if (r->rss_peak < 0) {  //fallback: peak of the whole process
+		struct rusage ru={0};
+		getrusage(RUSAGE_SELF, &ru);
+		r->rss_peak = ru.ru_maxrss * 1024L;
+		r->rss_stage = false;
+	}
+	r->mem_backend = B->ctx.info.mem_total;
+	log_info("%s %ux%u: first %.3fs min %.3fs", r->stage, r->w, r->h,
+		r->t_first, r->t_min);
+}
+
+/* Stages */
+
+static
+int bench_unet(Bench* B, unsigned w, unsigned h, unsigned n_thread)
+{
+	int R=1;
+	MLCtx *C = &B->ctx;
+	const UnetParams *P = B->model->unet;
+	UnetState U={0};
+	LocalTensor x={0}, dx={0}, cond={0}, label={0};
+	const int f = B->model->vae->f_down;
+	unsigned lw = w/f, lh = h/f, n_batch = B->c.n_batch;
+
+	TRY( bench_params_fill(B, "unet", bench_build_unet, P) );
+
+	ltensor_resize(&x, lw, lh, P->n_ch_in, n_batch);
+	rng_randn(ltensor_nelements(&x), x.d);
+	ltensor_resize(&cond, P->n_ctx, 77, 1, 1);
+	rng_randn(ltensor_nelements(&cond), cond.d);
+	if (P->ch_adm_in) {
+		ltensor_resize(&label, P->ch_adm_in, 1, 1, 1);
+		rng_randn(ltensor_nelements(&label), label.d);
+	}
+
+	BenchResult *r = bench_result_new(B, "unet", "it/s", w, h, n_batch,
+		n_thread);
+	r->thrp_f = 1;
+
+	double t = timing_time();
+	C->c.tprefix = "unet";
+	TRY( unet_denoise_init(&U, C, P, lw, lh, n_batch, UNET_SPLIT_NONE, false) );
+	r->t_setup = timing_time() - t;
+
+	for (int i=0; i<B->c.n_rep; ++i) {
+		t = timing_time();
+		TRY( unet_denoise_run(&U, &x, &cond, &label, 1, &dx) );
+		bench_result_time(r, timing_time() - t);
+	}
+	bench_result_end(B, r);
+
+end:
+	unet_denoise_free(&U);
+	mlctx_end(C);
+	ltensor_free(&label);
+	ltensor_free(&cond);
+	ltensor_free(&dx);
+	ltensor_free(&x);
+	return R;
+}
+
+static
+int bench_vae(Bench* B, unsigned w, unsigned h, unsigned n_thread,
+	bool encode)
+{
+	int R=1;
+	MLCtx *C = &B->ctx;
+	const VaeParams *P = B->model->vae;
+	LocalTensor img={0}, latent={0};
+	const int f = P->f_down;
+	unsigned n_batch = encode ? 1 : B->c.n_batch;  //encode: no batch
+
+	TRY( bench_params_fill(B, "vae",
+		encode ? bench_build_vae_enc : bench_build_vae_dec, P) );
+
+	BenchResult *r = bench_result_new(B, encode ? "vae-encode" : "vae-decode",
+		"MPix/s", w, h, n_batch, n_thread);
+	r->thrp_f = w * h * n_batch * 1e-6;
+
+	C->c.tprefix = "vae";
+	for (int i=0; i<B->c.n_rep; ++i) {
+		double t = timing_time();
+		if (encode) {
+			ltensor_resize(&img, w, h, P->ch_x, 1);
+			ltensor_for(img,j,0) img.d[j] = (j % 251) / 250.0;
+			TRY( sdvae_encode(C, P, &img, &latent, B->c.vae_tile,
+				B->c.vae_workers) );
+		} else {
+			ltensor_resize(&latent, w/f, h/f, P->ch_z, n_batch);
+			rng_randn(ltensor_nelements(&latent), latent.d);
+			TRY( sdvae_decode(C, P, &latent, &img, B->c.vae_tile,
+				B->c.vae_workers, NULL) );
+		}
+		bench_result_time(r, timing_time() - t);
+	}
+	bench_result_end(B, r);
+
+end:
+	ltensor_free(&latent);
+	ltensor_free(&img);
+	return R;
+}
+
+static
+int bench_clip(Bench* B, unsigned n_thread)
+{
+	int R=1;
+	MLCtx *C = &B->ctx;
+	LocalTensor embed={0}, feat={0};
+	int32_t *tokens=NULL;  //vector
+
+	// CLIP and OpenCLIP for SDXL, the second one with features
+	const ClipParams *Ps[2] = { B->model->clip, B->model->clip2 };
+	const char *tprefix[2] = { "clip", "clip2" };
+	for (int k=0; k<2 && Ps[k]; ++k)
+		TRY( bench_params_fill(B, tprefix[k], bench_build_clip, Ps[k]) );
+
+	BenchResult *r = bench_result_new(B, "clip", "prompt/s", 0, 0, 1,
+		n_thread);
+	r->thrp_f = 1;
+
+	unsigned n_tok = Ps[0]->n_token - 2;
+	vec_resize(tokens, n_tok);
+	vec_for(tokens,i,0) tokens[i] = (i * 7919 + 1) % Ps[0]->n_vocab;
+
+	for (int i=0; i<B->c.n_rep; ++i) {
+		double t = timing_time();
+		for (int k=0; k<2 && Ps[k]; ++k) {
+			C->c.tprefix = tprefix[k];
+			TRY( clip_text_encode(C, Ps[k], n_tok, tokens, &embed,
+				k ? &feat : NULL, B->model->clip_skip, true) );
+		}
+		bench_result_time(r, timing_time() - t);
+	}
+	bench_result_end(B, r);
+
+end:
+	vec_free(tokens);
+	ltensor_free(&feat);
+	ltensor_free(&embed);
+	return R;
+}
+
+/* Applies a synthetic LoRA to all the UNet attention projections.
+ */
+static
+int bench_lora(Bench* B, unsigned n_thread)
+{
+	int R=1;
+	MLCtx *C = &B->ctx;
+	TensorStore ts={ .ss=&B->ss };
+	DynStr name=NULL;
+	unsigned rank = B->c.lora_rank, n=0;
+
+	if (!(C->c.wtype == GGML_TYPE_F16 || C->c.wtype == GGML_TYPE_F32)) {
+		log_warning("lora: weights type %s not supported, skipped",
+			ggml_type_name(C->c.wtype));
+		return 0;
+	}
+
+	TRY( bench_params_fill(B, "unet", bench_build_unet, B->model->unet) );
+
+	// Make the LoRA tensors
+	C->c.n_tensor_max = 0;
+	mlctx_begin(C, "bench lora");  //ggml init for the conversions
+	vec_forp(TSTensorEntry, B->ts.tensors, e, 0) {
+		StrSlice s = strsto_get(&B->ss, e->key);
+		if (!(e->shape_n == 2 && strstr(s.b, ".attn") &&
+			strsl_suffix_trim(&s, strsl_static("_proj.weight")) ))
+			continue;
+
+		const char *sfx[2] = { "_proj.lora_down.weight", "_proj.lora_up.weight" };
+		unsigned ne[2][2] = { {e->shape[0], rank}, {rank, e->shape[1]} };
+		for (int k=0; k<2; ++k) {
+			MLTensor *t = ggml_new_tensor_2d(C->cp, C->c.wtype,
+				ne[k][0], ne[k][1]);
+			dstr_copy(name, s.s, s.b);
+			dstr_appendz(name, sfx[k]);
+			TSTensorData td={0};
+			TRY( bench_tensor_random(B, t, strsl_fromd(name), &td) );
+			TSTensorEntry le = { .dtype=td.dtype, .size=td.size, .shape_n=2,
+				.shape={ne[k][0], ne[k][1], 1, 1} };
+			vec_push(le.cache, td);
+			tstore_tensor_add(&ts, name, &le);
+		}
+		n++;
+	}
+	mlctx_end(C);
+
+	BenchResult *r = bench_result_new(B, "lora", "layer/s", 0, 0, 1, n_thread);
+	r->thrp_f = n;
+
+	for (int i=0; i<B->c.n_rep; ++i) {
+		double t = timing_time();
+		TRY( lora_apply(&B->ts, &ts, 1.0 / B->c.n_rep, C, NULL) );
+		bench_result_time(r, timing_time() - t);
+	}
+	bench_result_end(B, r);
+
+	// The weights changed
+	mlctx_resident_clear(C);
+
+end:
+	tstore_free(&ts);
+	dstr_free(name);
+	return R;
+}
+
+/* Output */
+
+int bench_json_write(Bench* B)
+{
+	Stream *so = &B->so;
+	stream_printf(so, "{\"model\":\"%s\",\"backend\":\"%s\",\"results\":[",
+		B->model->name, ggml_backend_name(B->ctx.backend));
+	vec_forp(BenchResult, B->results, r, 0) {
+		double t_mean = r->n_run > 1 ?
+			(r->t_sum - r->t_first) / (r->n_run - 1) : r->t_sum;
+		stream_printf(so, "%s\n{\"stage\":\"%s\",\"width\":%u,\"height\":%u"
+			",\"batch\":%u,\"threads\":%u,\"wtype\":\"%s\",\"runs\":%u"
+			",\"t_setup\":%.6f,\"t_first\":%.6f,\"t_mean\":%.6f,\"t_min\":%.6f"
+			",\"throughput\":%.6g,\"unit\":\"%s\""
+			",\"mem_backend\":%zu,\"rss_peak\":%ld"
+			",\"rss_peak_scope\":\"%s\"}",
+			r == B->results ? "" : ",",
+			r->stage, r->w, r->h, r->n_batch, r->n_thread,
+			ggml_type_name(r->wtype), r->n_run,
+			r->t_setup, r->t_first, t_mean, r->t_min,
+			t_mean > 0 ? r->thrp_f / t_mean : 0, r->unit,
+			r->mem_backend, r->rss_peak,
+			r->rss_stage ? "stage" : "process");
+	}
+	stream_str_put(so, "\n]}\n");
+	return stream_flush(so);
+}
+
+/* Main loop */
+
+#define IF_STAGE(NAME) \
+	else if (!strcmp(s_stage, NAME))
+
+static
+int bench_run_stages(Bench* B, unsigned n_thread)
+{
+	int R=1;
+	char s_stage[32], s_wh[32], s_size[32];
+
+	for (const char *l_stg=B->c.stages;
+		list_next(&l_stg, s_stage, sizeof(s_stage)); )
+	{
+		if (0) ;
+		IF_STAGE("clip") {
+			TRY( bench_clip(B, n_thread) );
+			continue;
+		}
+		IF_STAGE("lora") {
+			TRY( bench_lora(B, n_thread) );
+			continue;
+		}
+
+		// Stages that depend on the image size
+		const char *l_size = B->c.sizes;
+		if (!l_size) {
+			sprintf(s_size, "%ux%u", B->model->img_size, B->model->img_size);
+			l_size = s_size;
+		}
+		while (list_next(&l_size, s_wh, sizeof(s_wh))) {
+			unsigned w=0, h=0;
+			if (sscanf(s_wh, "%ux%u", &w, &h) != 2 || !w || !h ||
+				w % 64 || h % 64)
+				ERROR_LOG(-1, "Invalid image size '%s' (WxH, multiples of 64)",
+					s_wh);
+
+			if (0) ;
+			IF_STAGE("unet") {
+				TRY( bench_unet(B, w, h, n_thread) );
+			}
+			IF_STAGE("vae-decode") {
+				TRY( bench_vae(B, w, h, n_thread, false) );
+			}
+			IF_STAGE("vae-encode") {
+				TRY( bench_vae(B, w, h, n_thread, true) );
+			}
+			else {
+				ERROR_LOG(-1, "Unknown stage '%s'", s_stage);
+			}
+		}
+	}
+
+end:
+	return R;
+}
+
+int bench_run(Bench* B)
+{
+	int R=1;
+	char s_type[16], s_thr[16];
+	MLCtx *C = &B->ctx;
+
+	for (const char *l_type=B->c.wtypes;
+		list_next(&l_type, s_type, sizeof(s_type)); )
+	{
+		int dt = tstore_dtype_fromz(s_type);
+		if (dt <= 0) ERROR_LOG(-1, "Unknown weights type '%s'", s_type);
+		C->c.wtype = tstore_dtype_to_ggml(dt);
+		if (B->ts_wtype != C->c.wtype) {  //new random weights
+			mlctx_resident_clear(C);
+			tstore_free(&B->ts);
+			B->ts_wtype = C->c.wtype;
+		}
+		log_info("Weights type: %s", ggml_type_name(C->c.wtype));
+
+		for (const char *l_thr=B->c.threads;
+			list_next(&l_thr, s_thr, sizeof(s_thr)); )
+		{
+			unsigned n_thread = atoi(s_thr);
+			if (n_thread > 0)
+				ggml__backend_set_n_threads(C->backend, n_thread);
+			g_ltensor_n_thread = n_thread;
+			g_tstore_n_thread = n_thread;
+
+			TRY( bench_run_stages(B, n_thread) );
+		}
+	}
+
+end:
+	return R;
+}
+
+int main(int argc, char* argv[])
+{
+	int R=0, r;
+	Bench bench={0};
+
+	TRY( r = bench_argv_load(&bench, argc, argv) );
+	if (!r) {
+		puts(help_string);
+		return 0;
+	}
+
+	TRY( bench_setup(&bench) );
+	TRY( bench_run(&bench) );
+	TRY( bench_json_write(&bench) );
+
+end:
+	if (R<0) log_error("error exit: %x", -R);
+	bench_free(&bench);
+	return -R;
+}
@@ -7,6 +7,8 @@
 #include "ccommon/logging.h"
 #include "ccommon/stream.h"
 #include "ccompute/tensorstore.h"
+#include "ccompute/tensorstore_gguf.h"
+#include "tensor_name_conv.h"
 #include <inttypes.h>
 
 #define F_MIB  (1.0 / (1024.0*1024.0))
@@ -23,6 +25,8 @@ const char help_string[] =
 	"  checksum      Calculate tensors checksums.\n"
 	"  convert       Convert all float tensors to the target type.\n"
 	"  extract       Extract one tensor.\n"
+	"  compile       Write a GGUF model ready to be loaded by mlimgsynth without\n"
+	"                renaming or converting tensors. -T sets the weight type.\n"
 	"\n"
 	"Options:\n"
 	"  -i          Input file (- for stdin)\n"
@@ -128,9 +132,13 @@ int tsu_setup(TStoreUtil* S)
 		TRY_LOG(r, "Could not open stdout");
 	}
 
+	// Model tensors with the internal names
+	TSCallback cb = { tnconv_tstore_cb },
+	          *pcb = (S->c.cmd && !strcmp(S->c.cmd, "compile")) ? &cb : NULL;
+
 	log_debug("Loading...");
 	double t = timing_time();
-	TRY( tstore_read(&S->sti, &S->si, NULL, NULL) );
+	TRY( tstore_read(&S->sti, &S->si, NULL, pcb) );
 	t = timing_time() - t;
 	log_info("Load header {%.3fms}", t*1e3);
 
@@ -198,6 +206,80 @@ end:
 #undef TFILTER
 }
 
+// Write a model with the internal tensor names and the data types used by
+// mlimgsynth, so that it can be memory mapped and used directly
+int tsu_compile(TStoreUtil* S)
+{
+	int R=1;
+	TensorStore sto={ .ss=&S->ss };
+	TSTensorData td={0};
+
+	if (!S->c.path_out)
+		ERROR_LOG(-1, "use -o to set the output file");
+
+	int wtype = 0;  //default: keep the type of the model
+	if (S->c.s_dtype) {
+		wtype = tstore_dtype_fromz(S->c.s_dtype);
+		if (!(wtype > 0))
+			ERROR_LOG(-1, "unknown weight type '%s'", S->c.s_dtype);
+	}
+
+#define TFILTER(E) \
+	((E)->dtype == TS_DTYPE_F64 || \
+	 (E)->dtype == TS_DTYPE_F32 || \
+	 (E)->dtype == TS_DTYPE_F16 || \
+	 (E)->dtype == TS_DTYPE_BF16 )
+
+	tstore_copy_from(&sto, &S->sti);
+	vec_forp(TSTensorEntry, sto.tensors, e, 0) {
+		if (!TFILTER(e)) continue;
+		switch (tnconv_param_kind(strsto_get(&S->ss, e->key), e->shape_n)) {
+		case TNCONV_P_LINEAR:  if (wtype) e->dtype = wtype;  break;
+		case TNCONV_P_CONV:    e->dtype = TS_DTYPE_F16;  break;
+		default:               e->dtype = TS_DTYPE_F32;  break;
+		}
+	}
+
+	if (!tstore_meta_get(&sto, TNCONV_META_NAMES).t)
+		TRY( tstore_meta_adds(&sto, TNCONV_META_NAMES, "internal") );
+	if (!tstore_meta_get(&sto, "general.alignment").t) {
+		Any v = { .t=ANY_T_UINT32, .p={ .u32=32 } };
+		TRY( tstore_meta_add(&sto, "general.alignment", &v) );
+	}
+
+	double t = timing_time();
+	
+	TRY( tstore_write(&sto, &S->so, &ts_cls_gguf, NULL) );
+
+	unsigned n_conv=0;
+	vec_for(sto.tensors, i, 0) {
+		TSTensorEntry *ti = &S->sti.tensors[i],
+		              *to = &sto.tensors[i];
+		
+		log_debug("tensor '%s' %s -> %s", strsto_get(&S->ss, ti->key).b,
+			tstore_dtype_str(ti->dtype),
+			tstore_dtype_str(to->dtype));
+		TRY( tstore_tensor_data_get(ti, to->dtype, 0, &td) );
+
+		TRY_LOG( stream_seek(&S->so, to->offset, 0), "output seek" );
+		TRY_LOG( stream_write_chk(&S->so, td.size, td.data), "write" );
+
+		n_conv += to->dtype != ti->dtype;
+	}
+	TRY( stream_flush(&S->so) );
+
+	t = timing_time() - t;
+	log_info("Compile done: %u tensors, %u converted {%.3fs}",
+		vec_count(sto.tensors), n_conv, t);
+
+end:
+	if (R<0) log_error("compile at %zu", stream_pos_get(&S->so));
+	tstore_tdata_free(&td);
+	tstore_free(&sto);
+	return R;
+#undef TFILTER
+}
+
 // Check that all tensors can be read and report the speed
 int tsu_bench(TStoreUtil* S)
 {
@@ -337,6 +419,9 @@ int main(int argc, char* argv[])
 	IF_CMD("extract") {
 		TRY( tsu_tensor_extract(&tsu) );
 	}
+	IF_CMD("compile") {
+		TRY( tsu_compile(&tsu) );
+	}
 	else {
 		ERROR_LOG(-1, "Unknown command '%s'", tsu.c.cmd);
 	}
@@ -3,7 +3,9 @@
  */
 #include "mlblock.h"
 #include "ccommon/timing.h"
+#include "ccommon/bisect.h"
 #include <inttypes.h>
+#include <stdlib.h>
 
 #define F_MIB  (1.0 / (1024.0*1024.0))
 
@@ -17,12 +19,163 @@
 #define id_fromz(X)  strsto_add(C->ss, strsl_fromz(X))
 #define id_str(X)  strsto_get(C->ss, X).b
 
+enum {
+	MLCTX_CS_NONE,
+	MLCTX_CS_NEW,    //to be stored in the cache when prepared
+	MLCTX_CS_READY,  //prepared, to be stored in the cache
+};
+
+// Flags that change the computation
+#define MLCTX_CACHE_KEY_FLAGS \
+	(MLB_F_MULTI_COMPUTE | MLB_F_RESIDENT | MLB_F_XKV_INPUT | MLB_F_FUSED_QKV)
+
+static
+void mlctx_cache_entry_free(MLCtxCacheEntry* E)
+{
+	if (E->allocr) ggml_gallocr_free(E->allocr);
+	vec_forp(ggml_backend_buffer_t, E->hbufs, b, 0)
+		ggml_backend_buffer_free(*b);
+	vec_free(E->hbufs);
+	vec_free(E->tensors);
+	vec_free(E->inputs);
+	vec_free(E->outputs);
+	if (E->cc) ggml_free(E->cc);
+	if (E->cp) ggml_free(E->cp);
+	MEM_ZERO(*E);
+}
+
+// Move the current computation to E
+static
+void mlctx_detach(MLCtx* C, MLCtxCacheEntry* E)
+{
+	*E = (MLCtxCacheEntry){ .cp=C->cp, .cc=C->cc, .graph=C->graph,
+		.allocr=C->allocr_ext ? NULL : C->allocr, .tensors=C->tensors, .inputs=C->inputs,
+		.outputs=C->outputs, .result=C->result, .hbufs=C->hbufs,
+		.name=C->c.name, .tprefix=C->c.tprefix, .flags=C->cache.flags,
+		.key=C->cache.key, .wtype=C->c.wtype, .n_input=C->cache.n_input,
+		.info=C->info, .tuse=C->cache.tick };
+	C->cp = C->cc = NULL;
+	C->graph = NULL;
+	C->allocr = NULL;
+	C->tensors = NULL;
+	C->inputs = C->outputs = NULL;
+	C->result = NULL;
+	C->hbufs = NULL;
+}
+
+// Make E the current computation
+static
+void mlctx_attach(MLCtx* C, const MLCtxCacheEntry* E)
+{
+	C->cp      = E->cp;
+	C->cc      = E->cc;
+	C->graph   = E->graph;
+	C->allocr  = E->allocr;
+	C->tensors = E->tensors;
+	C->inputs  = E->inputs;
+	C->outputs = E->outputs;
+	C->result  = E->result;
+	C->hbufs   = E->hbufs;
+	C->info.mem_params  = E->info.mem_params;
+	C->info.mem_compute = E->info.mem_compute;
+	C->info.mem_total   = E->info.mem_total;
+	C->info.mem_host    = E->info.mem_host;
+}
+
+static
+void mlctx_cache_put(MLCtx* C, MLCtxCacheEntry* E)
+{
+	// Remove the least recently used
+	if (vec_count(C->cache.entries) >= C->c.cache_n) {
+		size_t imin=0;
+		vec_for(C->cache.entries,i,1)
+			if (C->cache.entries[i].tuse < C->cache.entries[imin].tuse)
+				imin = i;
+		mllog_debug("graph cache remove: %s", C->cache.entries[imin].name);
+		mlctx_cache_entry_free(&C->cache.entries[imin]);
+		vec_remove(C->cache.entries, imin, 1);
+	}
+	vec_push(C->cache.entries, *E);
+}
+
+void mlctx_cache_clear(MLCtx* C)
+{
+	vec_forp(MLCtxCacheEntry, C->cache.entries, e, 0)
+		mlctx_cache_entry_free(e);
+	vec_free(C->cache.entries);
+}
+
+static
+bool mlctx_cache_match(const MLCtx* C, const MLCtxCacheEntry* E)
+{
+	if (!(E->key == C->cache.key &&
+		E->flags == (C->c.flags_e & MLCTX_CACHE_KEY_FLAGS) &&
+		E->wtype == C->c.wtype &&
+		!strcmp(E->name, C->c.name) &&
+		(E->tprefix == C->c.tprefix || (E->tprefix && C->c.tprefix &&
+			!strcmp(E->tprefix, C->c.tprefix))) &&
+		E->n_input == vec_count(C->inputs) ))
+		return false;
+	vec_for(C->inputs,i,0) {
+		if (!(E->inputs[i]->type == C->inputs[i]->type &&
+			ggml_are_same_shape(E->inputs[i], C->inputs[i]) &&
+			!strcmp(E->inputs[i]->name, C->inputs[i]->name) ))
+			return false;
+	}
+	return true;
+}
+
+bool mlctx_cache_get(MLCtx* C, uint64_t key)
+{
+#if !USE_GGML_SCHED
+	if (!C->c.cache_n) return false;
+	C->cache.tick++;
+	C->cache.key = key;
+	C->cache.n_input = vec_count(C->inputs);
+	
+	vec_forp(MLCtxCacheEntry, C->cache.entries, e, 0) {
+		if (!mlctx_cache_match(C, e)) continue;
+		
+		// Replace the current computation, without graph yet
+		MLCtxCacheEntry E = *e;
+		vec_remove(C->cache.entries, e - C->cache.entries, 1);
+		mlctx_free(C);
+		mlctx_attach(C, &E);
+		C->cache.flags = E.flags;
+		C->cache.state = MLCTX_CS_READY;
+		C->info.n_cache_hit++;
+		mllog_debug("%s graph cache hit", C->c.name);
+		return true;
+	}
+
+	C->cache.flags = C->c.flags_e & MLCTX_CACHE_KEY_FLAGS;
+	C->cache.state = MLCTX_CS_NEW;
+	C->info.n_cache_miss++;
+#endif
+	return false;
+}
+
+static
+void mlctx_profile_clear(MLCtx* C)
+{
+	vec_free(C->prof.t_node);
+	vec_free(C->prof.events);
+	if (C->prof.ctx) ggml_free(C->prof.ctx);
+	MEM_ZERO(C->prof);
+}
+
 void mlctx_free(MLCtx* C)
 {
-	if (C->allocr) {
-		ggml_gallocr_free(C->allocr);
-		C->allocr=NULL;
+	if (C->prof.n_compute && C->graph) {
+		DynStr path = dstr_stack(64);
+		dstr_printf(path, "dump-prof-%s", C->c.name);
+		// Names like "UNet 1/2" are not valid file names
+		dstr_for(path, i, 0) if (path[i] == '/' || path[i] == ' ') path[i] = '_';
+		mlctx_profile_dump(C, path);
 	}
+	mlctx_profile_clear(C);
+	vec_free(C->alloc_ts);
+
 #if USE_GGML_SCHED
 	if (C->sched) {
 		ggml_backend_sched_free(C->sched);
@@ -34,16 +187,13 @@ void mlctx_free(MLCtx* C)
 	}
 #endif
 	
-	vec_free(C->tensors);
-	vec_free(C->inputs);
-	C->result = NULL;
-	if (C->cc) {
-		ggml_free(C->cc);
-		ggml_free(C->cp);
-		C->cc = NULL;
-		C->cp = NULL;
-		C->graph = NULL;
-	}
+	MLCtxCacheEntry E;
+	mlctx_detach(C, &E);
+	if (C->cache.state == MLCTX_CS_READY && C->c.cache_n > 0)
+		mlctx_cache_put(C, &E);
+	else
+		mlctx_cache_entry_free(&E);
+	C->cache.state = MLCTX_CS_NONE;
 }
 
 void mlctx_end(MLCtx* C)
@@ -51,17 +201,45 @@ void mlctx_end(MLCtx* C)
 	mlctx_free(C);
 }
 
+void mlctx_resident_clear(MLCtx* C)
+{
+	mlctx_cache_clear(C);  //may use the resident tensors
+	vec_forp(MLCtxResGroup, C->res.groups, g, 0) {
+		ggml_backend_buffer_free(g->buf);
+		ggml_free(g->ctx);
+	}
+	vec_forp(ggml_backend_buffer_t, C->res.hbufs, b, 0)
+		ggml_backend_buffer_free(*b);
+	vec_free(C->res.groups);
+	vec_free(C->res.hbufs);
+	vec_free(C->res.tensors);
+	C->res.mem = 0;
+}
+
+// Tensors added for each runtime LoRA branch (params and ops), at most
+#define MLCTX_LORA_N_TENSOR  16
+
+static inline
+size_t mlctx_tensor_max(const MLCtx* C)
+{
+	return C->c.n_tensor_max + vec_count(C->lora.items) * MLCTX_LORA_N_TENSOR;
+}
+
 void mlctx_begin(MLCtx* C, const char* name)
 {
 	mlctx_free(C);
+	vec_resize(C->lora.hooks, 0);
 	IFFALSESET(C->c.n_tensor_max, GGML_DEFAULT_GRAPH_SIZE);
-	size_t size = ggml_tensor_overhead() * C->c.n_tensor_max
-				+ ggml_graph_overhead();
+	size_t size = ggml_tensor_overhead() * mlctx_tensor_max(C)
+				+ ggml_graph_overhead_custom(mlctx_tensor_max(C), false);
 	C->cc = ggml_init((struct ggml_init_params){ size, NULL, true });
 	C->cp = ggml_init((struct ggml_init_params){ size, NULL, true });
 	C->c.name = name ? name : "";
 	C->c.flags_e = C->c.flags;
+	unsigned n_hit = C->info.n_cache_hit, n_miss = C->info.n_cache_miss;
 	MEM_ZERO(C->info);
+	C->info.n_cache_hit  = n_hit;
+	C->info.n_cache_miss = n_miss;
 }
 
 int mlctx_load_prep(MLCtx* C)
@@ -87,8 +265,8 @@ int mlctx_load_prep(MLCtx* C)
 			if (name) dstr_push(name, C->c.tpath_sep);
 			dstr_appendz(name, id_str(p->name));
 
+			p->key = id_fromz(name);  //store tensor full name
 			if (p->tensor->op == GGML_OP_NONE) {  //param
-				p->key = id_fromz(name);  //store tensor full name
 				dstr_resize(name, nlen);
 			}
 			else {  //block
@@ -104,10 +282,15 @@ end:
 	return R;
 }
 
+static
+int mlctx_lora_inject(MLCtx* C, MLTensor** presult);  //below
+
 int mlctx_build(MLCtx* C, MLTensor* result)
 {
 	int R=1;
 	assert(!C->graph);
+
+	TRYR( mlctx_lora_inject(C, &result) );
 	
 	if (C->c.flags_e & MLB_F_DUMP) {
 		DynStr path = dstr_stack(64);
@@ -129,7 +312,8 @@ int mlctx_build(MLCtx* C, MLTensor* result)
 			// Allows the computation can be repeated without reloading
 			// the parameters.
 			// Will increase memory usage, but it is not so much usually.
-			if (C->c.flags_e & MLB_F_MULTI_COMPUTE)
+			if (C->c.flags_e & MLB_F_MULTI_COMPUTE ||
+				C->cache.state == MLCTX_CS_NEW)
 				ggml_set_output(p->tensor);
 		}
 	}
@@ -142,13 +326,15 @@ int mlctx_build(MLCtx* C, MLTensor* result)
 	C->result = result;
 
 	// Computation graph
-	C->graph = ggml_new_graph_custom(C->cc, C->c.n_tensor_max, false);
+	C->graph = ggml_new_graph_custom(C->cc, mlctx_tensor_max(C), false);
 
 	vec_forp(MLCtxTensor, C->tensors, p, 0) {
 		if (p->name == MLB_NAME_SPLIT) {  //TODO: split == output ?
     		ggml_build_forward_expand(C->graph, p->tensor);
 		}
 	}
+	vec_for(C->outputs,i,0)
+		ggml_build_forward_expand(C->graph, C->outputs[i]);
 
     ggml_build_forward_expand(C->graph, result);
 	mllog_debug("graph size:%d n_nodes:%d",
@@ -164,8 +350,19 @@ int mlctx_alloc(MLCtx* C)
 
 #if !USE_GGML_SCHED
 	assert(!C->allocr);
-	C->allocr = ggml_gallocr_new(
-		ggml_backend_get_default_buffer_type(C->backend) );
+	if (C->allocr_ext) {
+		// Tensors to allocate again before each computation
+		for (MLTensor *t=ggml_get_first_tensor(C->cp); t;
+			t=ggml_get_next_tensor(C->cp, t))
+			if (!t->data) vec_push(C->alloc_ts, t);
+		for (MLTensor *t=ggml_get_first_tensor(C->cc); t;
+			t=ggml_get_next_tensor(C->cc, t))
+			if (!t->data) vec_push(C->alloc_ts, t);
+		C->allocr = C->allocr_ext;
+	}
+	else
+		C->allocr = ggml_gallocr_new(
+			ggml_backend_get_default_buffer_type(C->backend) );
 
 	mllog_debug("allocating memory");
 	if (!ggml_gallocr_reserve(C->allocr, C->graph))  //this allocates
@@ -175,9 +372,11 @@ int mlctx_alloc(MLCtx* C)
 
 	size_t s = ggml_gallocr_get_buffer_size(C->allocr, 0);
 	assert( s < (size_t)1024*1024*1024*1024 );
-	C->info.mem_total = s;
-	C->info.mem_compute = C->info.mem_total > C->info.mem_params ?
-		C->info.mem_total - C->info.mem_params : 0;
+	// Params in the graph buffer (not resident nor in host memory)
+	size_t mp = (C->c.flags_e & MLB_F_RESIDENT) ? 0 :
+		C->info.mem_params - C->info.mem_host;
+	C->info.mem_compute = s > mp ? s - mp : 0;
+	C->info.mem_total = C->info.mem_compute + C->info.mem_params;
 
 #else
 	assert(!C->sched);
@@ -229,7 +428,8 @@ int mlctx_build_alloc(MLCtx* C, MLTensor* result)
 
 #define TSTDG_R_CONVERT  2
 
-int tstore_tensor_read(TSTensorEntry* S, struct ggml_tensor* t)
+int tstore_tensor_read_part(TSTensorEntry* S, struct ggml_tensor* t,
+	unsigned i_part, unsigned n_part)
 {
 	int R=1;
 
@@ -240,7 +440,7 @@ int tstore_tensor_read(TSTensorEntry* S, struct ggml_tensor* t)
 	//		if (S->shape[i] != t->ne[i]) break;
 	//}
 	//if (i != S->shape_n)
-	if (ggml_nelements(t) != tstore_tensor_count(S))
+	if (ggml_nelements(t) != tstore_tensor_count(S) * n_part)
 		ERROR_LOG(-1, "wrong shape (%u): %ux%ux%ux%u -> "
 			"%"PRId64"x%"PRId64"x%"PRId64"x%"PRId64, i,
 			S->shape[0], S->shape[1], S->shape[2], S->shape[3],
@@ -254,7 +454,10 @@ int tstore_tensor_read(TSTensorEntry* S, struct ggml_tensor* t)
 	TSTensorData td={0};
 	int flags = TSTDG_F_PERM;  //TODO: only if it will be used multiple times
 	TRY( R = tstore_tensor_data_get(S, target, flags, &td) );
-	ggml_backend_tensor_set(t, td.data, 0, td.size);
+	size_t sz = ggml_nbytes(t) / n_part;
+	if (td.size != sz)
+		ERROR_LOG(-1, "wrong data size: %zu -> %zu", td.size, sz);
+	ggml_backend_tensor_set(t, td.data, sz * i_part, sz);
 	tstore_tdata_free(&td);
 
 	if (target != S->dtype) R = TSTDG_R_CONVERT;
@@ -263,9 +466,415 @@ end:
 	return R;
 }
 
-int mlctx_tstore_load(MLCtx* C, TensorStore* ts)
+/* Fused parameters: concatenation along the last dimension of several
+ * tensors of the store. Loaded from the parts if not found in the store.
+ */
+static const struct {
+	const char *name, *parts[3];
+} g_mlctx_fused[] = {
+	{ "qkv_proj", { "q_proj", "k_proj", "v_proj" } },  //MLB_F_FUSED_QKV
+};
+
+/* Stores in *out the name of the part i_part of the parameter full.
+ * Returns the number of parts, or 0 if it is not a fused parameter.
+ */
+static
+unsigned mlctx_fused_part_name(const MLCtx* C, const char* full,
+	unsigned i_part, DynStr* out)
+{
+	for (unsigned i=0; i<COUNTOF(g_mlctx_fused); ++i) {
+		// Find the name as a path component: "<pre>.qkv_proj.<post>"
+		const char *fname = g_mlctx_fused[i].name, *p = full;
+		size_t len = strlen(fname);
+		while ((p = strstr(p, fname)) &&
+			!((p == full || p[-1] == C->c.tpath_sep) &&
+			  (p[len] == 0 || p[len] == C->c.tpath_sep)))
+			p += len;
+		if (!p) continue;
+
+		dstr_copy(*out, p - full, full);
+		dstr_appendz(*out, g_mlctx_fused[i].parts[i_part]);
+		dstr_appendz(*out, p + len);
+		return COUNTOF(g_mlctx_fused[i].parts);
+	}
+	return 0;
+}
+
+/* Loads the parameter t from its parts.
+ * Returns 0 if it is not a fused parameter.
+ */
+static
+int mlctx_param_fused_read(MLCtx* C, TensorStore* ts, MLTensor* t,
+	StringInt key)
+{
+	int R=0, r;
+	DynStr name=NULL;
+	const char *full = id_str(key);
+
+	unsigned n_part = mlctx_fused_part_name(C, full, 0, &name);
+	for (unsigned j=0; j<n_part; ++j) {
+		if (j) mlctx_fused_part_name(C, full, j, &name);
+		TSTensorEntry *e = tstore_tensor_get(ts, name);
+		if (!e) ERROR_LOG(-1, "tensor '%s' not found", name);
+		TRY_LOG(r = tstore_tensor_read_part(e, t, j, n_part),
+			"could not read tensor '%s'", name);
+		if (!R) R = 1;
+		if (r == TSTDG_R_CONVERT) R = r;
+	}
+
+end:
+	dstr_free(name);
+	return R;
+}
+
+/* Runtime LoRA */
+
+static
+TSTensorEntry* mlctx_lora_entry(const MLCtx* C, StringInt key)
+{
+	vec_forp(MLCtxLora, C->lora.items, L, 0) {
+		if (L->kdown == key) return L->down;
+		if (L->kup   == key) return L->up;
+	}
+	return NULL;
+}
+
+// Store entry of a parameter, from the tensor store or the LoRA's
+static
+TSTensorEntry* mlctx_param_entry(const MLCtx* C, TensorStore* ts,
+	StringInt key)
+{
+	TSTensorEntry *e = tstore_tensor_getk(ts, key);
+	if (!e && vec_count(C->lora.items)) e = mlctx_lora_entry(C, key);
+	return e;
+}
+
+int mlctx_lora_add(MLCtx* C, StringInt key, TSTensorEntry* down,
+	TSTensorEntry* up, float scale)
+{
+	DynStr name = dstr_stack(64);
+	MLCtxLora L = { key, .down=down, .up=up, .scale=scale };
+	// Unique keys, the loaded data is not reused
+	unsigned id = C->lora.n_id++;
+	dstr_printf(name, "lora:%u:down", id);
+	L.kdown = id_fromz(name);
+	dstr_printf(name, "lora:%u:up", id);
+	L.kup = id_fromz(name);
+
+	BISECT_RIGHT_DECL(found, idx, 0, vec_count(C->lora.items),
+		C->lora.items[i_].key - key);
+	while (found && idx < vec_count(C->lora.items) &&
+		C->lora.items[idx].key == key) idx++;
+	vec_insert(C->lora.items, idx, 1, &L);
+	mlctx_cache_clear(C);  //the graphs change
+	return 1;
+}
+
+void mlctx_lora_clear(MLCtx* C)
+{
+	if (vec_count(C->lora.items)) mlctx_cache_clear(C);
+	vec_free(C->lora.items);
+	vec_free(C->lora.hooks);
+}
+
+void mlctx_lora_hook(MLCtx* C, MLTensor* w, MLTensor* x, MLTensor* out,
+	const int* conv)
+{
+	if (!vec_count(C->lora.items)) return;
+	MLCtxLoraHook h = { w, x, out };
+	if (conv) {
+		h.s0 = conv[0];  h.s1 = conv[1];
+		h.p0 = conv[2];  h.p1 = conv[3];
+		h.d0 = conv[4];  h.d1 = conv[5];
+	}
+	vec_push(C->lora.hooks, h);
+}
+
+/* Makes the branch of L for the hook h: scale * U (D x).
+ * n_out: number of outputs (rows of the weight or of the fused part).
+ */
+static
+MLTensor* mlctx_lora_branch(MLCtx* C, const MLCtxLoraHook* h,
+	const MLCtxLora* L, MLTensor* x, int64_t n_out)
+{
+	const MLTensor *w = h->w;
+	MLTensor *d, *u;
+	int64_t rank = L->down->shape[L->down->shape_n-1];
+	if (h->s0) {  //conv2d
+		d = ggml_new_tensor_4d(C->cp, GGML_TYPE_F16,
+			w->ne[0], w->ne[1], w->ne[2], rank);
+		u = ggml_new_tensor_4d(C->cp, GGML_TYPE_F16, 1, 1, rank, n_out);
+	} else {
+		d = ggml_new_tensor_2d(C->cp, GGML_TYPE_F16, w->ne[0], rank);
+		u = ggml_new_tensor_2d(C->cp, GGML_TYPE_F16, rank, n_out);
+	}
+	if (!(tstore_tensor_count(L->down) == ggml_nelements(d) &&
+		tstore_tensor_count(L->up) == ggml_nelements(u)))
+	{
+		log_error("lora '%s' invalid up/down shapes", id_str(L->key));
+		return NULL;
+	}
+	ggml_format_name(d, "%s.lora_down", id_str(L->key));
+	ggml_format_name(u, "%s.lora_up", id_str(L->key));
+
+	// Before the result, that must be the last
+	size_t i = vec_count(C->tensors) - 1;
+	vec_insert(C->tensors, i, 1, &((MLCtxTensor){ d, L->kdown, L->kdown }));
+	vec_insert(C->tensors, i+1, 1, &((MLCtxTensor){ u, L->kup, L->kup }));
+
+	if (h->s0) {
+		x = ggml_conv_2d(C->cc, d, x, h->s0, h->s1, h->p0, h->p1, h->d0, h->d1);
+		x = ggml_conv_2d(C->cc, u, x, 1, 1, 0, 0, 1, 1);
+	} else {
+		x = ggml_mul_mat(C->cc, d, x);
+		x = ggml_mul_mat(C->cc, u, x);
+	}
+	return ggml_scale(C->cc, x, L->scale);
+}
+
+typedef struct {
+	const MLTensor *a;
+	MLTensor *b;
+} MLCtxTensorSubst;
+
+static
+MLTensor* mlctx_subst_get(const MLCtxTensorSubst* v, MLTensor* t)
+{
+	vec_forr(v, i) if (v[i].a == t) return v[i].b;
+	return t;
+}
+
+/* Adds the LoRA branches to the hooked layers, after mlctx_load_prep.
+ * The previous uses of each layer output are replaced by the sum.
+ */
+static
+int mlctx_lora_inject(MLCtx* C, MLTensor** presult)
+{
+	int R=1;
+	MLCtxTensorSubst *subst=NULL;  //vector
+	DynStr name=NULL;
+	unsigned n=0;
+
+	if (!vec_count(C->lora.hooks)) return 0;
+
+	// Last tensor before the branches
+	MLTensor *last=NULL;
+	for (MLTensor *t=ggml_get_first_tensor(C->cc); t;
+		t=ggml_get_next_tensor(C->cc, t))
+		last = t;
+
+	vec_forp(MLCtxLoraHook, C->lora.hooks, h, 0)
+	{
+		StringInt wkey=-1;
+		vec_forr(C->tensors, i)
+			if (C->tensors[i].tensor == h->w) { wkey = C->tensors[i].key;  break; }
+		if (wkey < 0) continue;
+
+		MLTensor *x = mlctx_subst_get(subst, h->x), *sum = h->out;
+		int64_t n_out = h->s0 ? h->w->ne[3] : h->w->ne[1];
+		unsigned n_part = mlctx_fused_part_name(C, id_str(wkey), 0, &name);
+		for (unsigned j=0; j<(n_part ? n_part : 1); ++j) {
+			StringInt key = wkey;
+			if (n_part) {
+				mlctx_fused_part_name(C, id_str(wkey), j, &name);
+				key = strsto_find(C->ss, strsl_fromd(name));
+				if (key < 0) continue;
+			}
+
+			BISECT_RIGHT_DECL(found, idx, 0, vec_count(C->lora.items),
+				C->lora.items[i_].key - key);
+			if (!found) continue;
+			while (idx > 0 && C->lora.items[idx-1].key == key) idx--;
+			
+			for (; idx < vec_count(C->lora.items) &&
+				C->lora.items[idx].key == key; ++idx)
+			{
+				MLTensor *y = mlctx_lora_branch(C, h, &C->lora.items[idx], x,
+					n_part ? n_out / n_part : n_out);
+				if (!y) ERROR_LOG(-1, "%s lora branch", C->c.name);
+				if (n_part)  //fused: add to the rows of the part
+					sum = ggml_acc(C->cc, sum, y, sum->nb[1], sum->nb[2],
+						sum->nb[3], sum->nb[0] * (n_out / n_part) * j);
+				else
+					sum = ggml_add(C->cc, sum, y);
+				n++;
+			}
+		}
+		if (sum != h->out)
+			vec_push(subst, ((MLCtxTensorSubst){ h->out, sum }));
+	}
+
+	// Replace the uses of the outputs
+	for (MLTensor *t=ggml_get_first_tensor(C->cc); t;
+		t=ggml_get_next_tensor(C->cc, t))
+	{
+		for (unsigned i=0; i<GGML_MAX_SRC; ++i)
+			if (t->src[i]) t->src[i] = mlctx_subst_get(subst, t->src[i]);
+		if (t->view_src) t->view_src = mlctx_subst_get(subst, t->view_src);
+		if (t == last) break;
+	}
+	vec_forp(MLCtxTensor, C->tensors, p, 0)
+		if (p->tensor) p->tensor = mlctx_subst_get(subst, p->tensor);
+	vec_for(C->outputs, i, 0)
+		C->outputs[i] = mlctx_subst_get(subst, C->outputs[i]);
+	*presult = mlctx_subst_get(subst, *presult);
+
+	mllog_debug("%s lora branches: %u", C->c.name, n);
+
+end:
+	dstr_free(name);
+	vec_free(subst);
+	return R;
+}
+
+/* Loads the parameter t from the store.
+ */
+static
+int mlctx_param_read(MLCtx* C, TensorStore* ts, MLTensor* t, StringInt key)
+{
+	int R=1;
+	TSTensorEntry *e = mlctx_param_entry(C, ts, key);
+	if (e) {
+		TRY_LOG(R = tstore_tensor_read(e, t),
+			"could not read tensor '%s'", id_str(key));
+	}
+	else {
+		TRY( R = mlctx_param_fused_read(C, ts, t, key) );
+		if (!R) ERROR_LOG(-1, "tensor '%s' not found", id_str(key));
+	}
+end:
+	return R;
+}
+
+/* List of store tensors to convert in parallel before loading them.
+ * The fused parameters are not included, they are converted when read.
+ */
+typedef struct {
+	TSTensorEntry **ents;  //vector
+	TSDType *dtypes;  //vector
+} MLCtxConvList;
+
+static
+void mlctx_conv_add(MLCtx* C, MLCtxConvList* L, TensorStore* ts,
+	MLTensor* t, StringInt key)
+{
+	TSTensorEntry *e = mlctx_param_entry(C, ts, key);
+	if (!e) return;
+	int target = tstore_dtype_from_ggml(t->type);
+	if (target < 0 || target == e->dtype ||
+		ggml_nelements(t) != tstore_tensor_count(e))
+		return;  //errors are reported when read
+	vec_push(L->ents, e);
+	vec_push(L->dtypes, target);
+}
+
+static
+int mlctx_conv_run(MLCtx* C, MLCtxConvList* L)
+{
+	int R=1;
+	if (vec_count(L->ents)) {
+		double t = timing_time();
+		TRY( tstore_tensors_convert(vec_count(L->ents), L->ents, L->dtypes) );
+		mllog_debug2("%s params converted n:%u {%.3fs}", C->c.name,
+			(unsigned)vec_count(L->ents), timing_time() - t);
+	}
+end:
+	vec_free(L->dtypes);
+	vec_free(L->ents);
+	return R;
+}
+
+/* Parameters loader.
+ * The parameters are read in the order of the file, in steps of about
+ * MLCTX_LOAD_STEP bytes. The next step is prefetched by the system in the
+ * background while the current one is converted (in parallel) and uploaded.
+ */
+#define MLCTX_LOAD_STEP  (64<<20)
+
+typedef struct {
+	MLTensor *t;
+	StringInt key;
+	TSTensorEntry *e;  //NULL for fused parameters
+} MLCtxLoadItem;
+
+static
+int mlctx_load_item_cmp(const void* pa, const void* pb)
+{
+	const TSTensorEntry *a = ((const MLCtxLoadItem*)pa)->e,
+	                    *b = ((const MLCtxLoadItem*)pb)->e;
+	if (!a || !b) return (!a) - (!b);  //fused last
+	if (a->stm != b->stm) return (uintptr_t)a->stm < (uintptr_t)b->stm ? -1 : 1;
+	return (a->offset > b->offset) - (a->offset < b->offset);
+}
+
+/* Prefetch the items from i0 up to MLCTX_LOAD_STEP bytes.
+ * Returns the index of the end of the step.
+ */
+static
+size_t mlctx_load_prefetch(const MLCtxLoadItem* items, size_t i0)
+{
+	size_t i=i0, n=vec_count(items);
+	uint64_t sz=0, beg=0, end=0;
+	Stream *stm=NULL;
+	for (; i<n && items[i].e && (i==i0 || sz < MLCTX_LOAD_STEP); ++i) {
+		const TSTensorEntry *e = items[i].e;
+		sz += e->size;
+		// Join contiguous ranges
+		if (e->stm == stm && e->offset <= end) {
+			if (end < e->offset + e->size) end = e->offset + e->size;
+			continue;
+		}
+		if (stm) stream_control(stm, STREAM_CMD_PREFETCH, beg, end - beg);
+		stm = e->stm;
+		beg = e->offset;
+		end = e->offset + e->size;
+	}
+	if (stm) stream_control(stm, STREAM_CMD_PREFETCH, beg, end - beg);
+	if (i == i0 && i < n) i++;  //fused
+	return i;
+}
+
+/* Load the parameters in items. Sorts the vector.
+ */
+static
+int mlctx_params_load(MLCtx* C, TensorStore* ts, MLCtxLoadItem* items)
 {
 	int R=1, r;
+	size_t n = vec_count(items);
+	if (!n) return 1;
+
+	vec_forp(MLCtxLoadItem, items, it, 0)
+		it->e = mlctx_param_entry(C, ts, it->key);
+	qsort(items, n, sizeof(*items), mlctx_load_item_cmp);
+
+	size_t i0=0, i1 = mlctx_load_prefetch(items, 0);
+	while (i0 < n) {
+		size_t i2 = mlctx_load_prefetch(items, i1);  //next step
+
+		MLCtxConvList conv={0};
+		for (size_t i=i0; i<i1; ++i)
+			if (items[i].e)
+				mlctx_conv_add(C, &conv, ts, items[i].t, items[i].key);
+		TRY( mlctx_conv_run(C, &conv) );
+
+		for (size_t i=i0; i<i1; ++i) {
+			mllog_debug2("loading tensor '%s'", id_str(items[i].key));
+			TRY( r = mlctx_param_read(C, ts, items[i].t, items[i].key) );
+			C->info.n_conv += (r == TSTDG_R_CONVERT);
+		}
+		
+		i0 = i1;
+		i1 = i2;
+	}
+
+end:
+	return R;
+}
+
+int mlctx_tstore_load(MLCtx* C, TensorStore* ts)
+{
+	int R=1;
+	MLCtxLoadItem *items=NULL;  //vector
 	
 	mllog_info("%s loading params...", C->c.name);
 	double t = timing_time();
@@ -273,23 +882,279 @@ int mlctx_tstore_load(MLCtx* C, TensorStore* ts)
 	vec_forrp(MLCtxTensor, C->tensors, p)
 	{
 		if (!(p->tensor && p->tensor->op == GGML_OP_NONE)) continue;
+		if (p->host) continue;  //already in place
+		vec_push(items, ((MLCtxLoadItem){ p->tensor, p->key }));
+	}
+	TRY( mlctx_params_load(C, ts, items) );
 
-		TSTensorEntry *e = tstore_tensor_getk(ts, p->key);
-		if (!e) ERROR_LOG(-1, "tensor '%s' not found", id_str(p->key));
-		
-		mllog_debug2("loading tensor '%s'", id_str(p->key));
-		TRY_LOG(r = tstore_tensor_read(e, p->tensor),
+	C->info.t_load += timing_time() - t;
+	mllog_info("%s params loaded (converted: %u) {%.3fs}",
+		C->c.name, C->info.n_conv, C->info.t_load);
+
+end:
+	vec_free(items);
+	return R;
+}
+
+#if !USE_GGML_SCHED
+static inline
+bool mlctx_host_bind_is(const MLCtx* C)
+{
+	return ggml_backend_dev_type(ggml_backend_get_device(C->backend))
+		== GGML_BACKEND_DEVICE_TYPE_CPU;
+}
+
+/* Make the tensor use the host memory data, without copying it.
+ * Only with the CPU backend, the data must be aligned.
+ * The new buffer is added to the vector *pbufs.
+ */
+static
+ggml_backend_buffer_t mlctx_tensor_host_ptr(MLCtx* C, MLTensor* t, void* data,
+	ggml_backend_buffer_t** pbufs)
+{
+	size_t sz = ggml_nbytes(t);
+	if (!(mlctx_host_bind_is(C) &&
+		(uintptr_t)data % ggml_backend_get_alignment(C->backend) == 0))
+		return NULL;
+
+	ggml_backend_buffer_t buf = ggml_backend_dev_buffer_from_host_ptr(
+		ggml_backend_get_device(C->backend), data, sz, sz);
+	if (!buf) return NULL;
+	ggml_backend_tensor_alloc(buf, t, data);
+	vec_push(*pbufs, buf);
+	return buf;
+}
+
+/* Make the tensor point directly to the store data, without copying it.
+ * Only used with the CPU backend, the data must be permanent (e.g. mmap'd)
+ * and aligned. The new buffer is added to the vector *pbufs.
+ * Returns 0 if not possible, then the tensor must be loaded normally.
+ */
+static
+int mlctx_tensor_host_bind(MLCtx* C, TSTensorEntry* e, MLTensor* t,
+	ggml_backend_buffer_t** pbufs)
+{
+	int R=1;
+	TSTensorData td={0};
+
+	int target = tstore_dtype_from_ggml(t->type);
+	if (target < 0 || ggml_nelements(t) != tstore_tensor_count(e))
+		return 0;  //tstore_tensor_read reports the error
+
+	TRY( tstore_tensor_data_get(e, target, TSTDG_F_PERM, &td) );
+	if (!(td.perm && td.size == ggml_nbytes(t))) return 0;
+
+	ggml_backend_buffer_t buf = mlctx_tensor_host_ptr(C, t, td.data, pbufs);
+	if (!buf) return 0;
+	ggml_backend_buffer_set_usage(buf, GGML_BACKEND_BUFFER_USAGE_WEIGHTS);
+
+	R = (target != e->dtype) ? TSTDG_R_CONVERT : 1;
+end:
+	return R;
+}
+
+/* Bind the parameters to the store memory when possible.
+ * Call after mlctx_build and before mlctx_alloc.
+ */
+static
+int mlctx_params_host_bind(MLCtx* C, TensorStore* ts)
+{
+	int R=1, r;
+	unsigned n=0;
+	double t = timing_time();
+
+	MLCtxConvList conv={0};
+	vec_forp(MLCtxTensor, C->tensors, p, 0)
+	{
+		if (!(p->tensor && p->tensor->op == GGML_OP_NONE)) continue;
+		mlctx_conv_add(C, &conv, ts, p->tensor, p->key);
+	}
+	TRY( mlctx_conv_run(C, &conv) );
+
+	vec_forp(MLCtxTensor, C->tensors, p, 0)
+	{
+		if (!(p->tensor && p->tensor->op == GGML_OP_NONE)) continue;
+		if (p->tensor->data) { p->host = true;  continue; }  //repeated
+
+		TSTensorEntry *e = mlctx_param_entry(C, ts, p->key);
+		if (!e) continue;  //mlctx_tstore_load reports the error
+
+		TRY_LOG(r = mlctx_tensor_host_bind(C, e, p->tensor, &C->hbufs),
 			"could not read tensor '%s'", id_str(p->key));
+		if (!r) continue;
+		p->host = true;
 		C->info.n_conv += (r == TSTDG_R_CONVERT);
+		C->info.mem_host += ggml_nbytes(p->tensor);
+		n++;
+	}
+
+	C->info.t_load += timing_time() - t;
+	mllog_debug("%s params bound to host memory n:%u size:%zu",
+		C->c.name, n, C->info.mem_host);
+
+end:
+	return R;
+}
+
+static
+MLTensor* mlctx_resident_get(const MLCtx* C, StringInt key, size_t* pidx)
+{
+	BISECT_RIGHT_DECL(found, idx, 0, vec_count(C->res.tensors),
+		C->res.tensors[i_].key - key);
+	if (pidx) *pidx = idx;
+	return found ? C->res.tensors[idx].tensor : NULL;
+}
+
+/* Make the graph parameters use the resident tensors.
+ * The parameters not yet resident are allocated and loaded first.
+ * Call after mlctx_build and before mlctx_alloc.
+ */
+static
+int mlctx_resident_bind(MLCtx* C, TensorStore* ts)
+{
+	int R=1, r;
+	MLCtxResGroup g={0};
+	StringInt *knew=NULL;  //vector
+	MLCtxLoadItem *items=NULL;  //vector
+	size_t idx;
+	unsigned n_new=0, n_alloc=0;
+	
+	double t = timing_time();
+
+	// New parameters
+	vec_forp(MLCtxTensor, C->tensors, p, 0)
+	{
+		if (!(p->tensor && p->tensor->op == GGML_OP_NONE)) continue;
+		if (mlctx_lora_entry(C, p->key)) continue;  //loaded each time
+		if (mlctx_resident_get(C, p->key, &idx)) continue;
+
+		if (!g.ctx) {
+			size_t sz = ggml_tensor_overhead() * vec_count(C->tensors);
+			g.ctx = ggml_init((struct ggml_init_params){ sz, NULL, true });
+		}
+		MLTensor *T = ggml_dup_tensor(g.ctx, p->tensor);
+		vec_insert(C->res.tensors, idx, 1,
+			&((MLCtxTensor){ T, p->key, p->key }));
+		vec_push(knew, p->key);
+	}
+
+	if (g.ctx) {
+		mllog_info("%s loading params...", C->c.name);
+		vec_push(C->res.groups, g);
+		n_new = vec_count(knew);
+
+		MLCtxConvList conv={0};
+		vec_for(knew,i,0)
+			mlctx_conv_add(C, &conv, ts, mlctx_resident_get(C, knew[i], NULL),
+				knew[i]);
+		TRY( mlctx_conv_run(C, &conv) );
+
+		// Use the store memory directly if possible
+		bool host = mlctx_host_bind_is(C);
+		vec_for(knew,i,0) {
+			TSTensorEntry *e = mlctx_param_entry(C, ts, knew[i]);
+			r = 0;
+			if (host && e) {  //fused params are not in the store
+				MLTensor *T = mlctx_resident_get(C, knew[i], NULL);
+				TRY_LOG(r = mlctx_tensor_host_bind(C, e, T, &C->res.hbufs),
+					"could not read tensor '%s'", id_str(knew[i]));
+				C->info.n_conv += (r == TSTDG_R_CONVERT);
+			}
+			if (!r) knew[n_alloc++] = knew[i];
+		}
+
+		// Allocate and load the rest
+		if (n_alloc) {
+			g.buf = ggml_backend_alloc_ctx_tensors(g.ctx, C->backend);
+			if (!g.buf)
+				ERROR_LOG(-1, "%s could not allocate parameter tensors",
+					C->c.name);
+			ggml_backend_buffer_set_usage(g.buf,
+				GGML_BACKEND_BUFFER_USAGE_WEIGHTS);
+			vec_last(C->res.groups,0).buf = g.buf;
+			C->res.mem += ggml_backend_buffer_get_size(g.buf);
+		}
+
+		for (unsigned i=0; i<n_alloc; ++i)
+			vec_push(items, ((MLCtxLoadItem){
+				mlctx_resident_get(C, knew[i], NULL), knew[i] }));
+		TRY( mlctx_params_load(C, ts, items) );
+	}
+
+	// Bind
+	vec_forp(MLCtxTensor, C->tensors, p, 0)
+	{
+		if (!(p->tensor && p->tensor->op == GGML_OP_NONE)) continue;
+		if (mlctx_lora_entry(C, p->key)) continue;
+		p->host = true;  //not to be loaded
+		if (p->tensor->data) continue;  //repeated
+		MLTensor *T = mlctx_resident_get(C, p->key, NULL);
+		if (!(T->type == p->tensor->type && ggml_are_same_shape(T, p->tensor)))
+			ERROR_LOG(-1, "resident tensor '%s' mismatch: "
+				GGML_TYPESHAPE_FMT " -> " GGML_TYPESHAPE_FMT, id_str(p->key),
+				GGML_TYPESHAPE_ARGS(T), GGML_TYPESHAPE_ARGS(p->tensor));
+		ggml_backend_tensor_alloc(T->buffer, p->tensor, T->data);
 	}
 
 	C->info.t_load = timing_time() - t;
-	mllog_info("%s params loaded (converted: %u) {%.3fs}",
-		C->c.name, C->info.n_conv, C->info.t_load);
+	if (n_new)
+		mllog_info("%s params loaded (new: %u, in-place: %u, converted: %u, "
+			"resident: %.1fMiB) {%.3fs}", C->c.name, n_new, n_new - n_alloc,
+			C->info.n_conv, C->res.mem * F_MIB, C->info.t_load);
 
 end:
+	if (R<0) mlctx_resident_clear(C);  //some tensor may not be loaded
+	vec_free(items);
+	vec_free(knew);
 	return R;
 }
+#endif
+
+bool mlctx_input_host_bind(MLCtx* C, MLTensor* t, void* data)
+{
+#if !USE_GGML_SCHED
+	return mlctx_tensor_host_ptr(C, t, data, &C->hbufs);
+#else
+	return false;
+#endif
+}
+
+#if !USE_GGML_SCHED
+// Computes the graph one node at a time, measuring the time of each one.
+// Slower than a normal computation, specially for small ops.
+static
+int mlctx_compute_profile(MLCtx* C)
+{
+	int n = ggml_graph_n_nodes(C->graph);
+	if (!C->prof.ctx) {
+		size_t sz = ggml_graph_overhead_custom(1, false);
+		C->prof.ctx = ggml_init((struct ggml_init_params){ sz, NULL, true });
+		C->prof.graph = ggml_new_graph_custom(C->prof.ctx, 1, false);
+		C->prof.t_start = timing_time();
+	}
+	if (vec_count(C->prof.t_node) != n) {
+		if (C->prof.n_compute) return GGML_STATUS_FAILED;  //graph changed
+		vec_resize_zero(C->prof.t_node, n);
+	}
+
+	double t_beg = timing_time();
+	for (int i=0; i<n; ++i) {
+		ggml_graph_clear(C->prof.graph);
+		ggml_graph_add_node(C->prof.graph, ggml_graph_node(C->graph, i));
+		double t0 = timing_time();
+		int r = ggml_backend_graph_compute(C->backend, C->prof.graph);
+		if (r) return r;
+		double dt = timing_time() - t0;
+		C->prof.t_node[i] += dt;
+		vec_push(C->prof.events, ((MLCtxProfEvent){ i,
+			t0 - C->prof.t_start, dt }));
+	}
+	vec_push(C->prof.events, ((MLCtxProfEvent){ MLCTX_PROF_COMPUTE,
+		t_beg - C->prof.t_start, timing_time() - t_beg }));
+	C->prof.n_compute++;
+	return 0;
+}
+#endif
 
 int mlctx_compute(MLCtx* C)
 {
@@ -298,7 +1163,8 @@ int mlctx_compute(MLCtx* C)
 	mllog_info("%s compute", C->c.name);
 	double t = timing_time();
 #if !USE_GGML_SCHED
-	int r = ggml_backend_graph_compute(C->backend, C->graph);
+	int r = (C->c.flags_e & MLB_F_PROFILE) ? mlctx_compute_profile(C)
+		: ggml_backend_graph_compute(C->backend, C->graph);
 #else
 	int r = ggml_backend_sched_graph_compute(C->sched, C->graph);
 #endif
@@ -311,16 +1177,64 @@ end:
 	return R;
 }
 
-int mlctx_prep(MLCtx* C)
+int mlctx_realloc(MLCtx* C)
+{
+	int R=1;
+#if !USE_GGML_SCHED
+	if (!C->allocr_ext) return 1;
+	vec_for(C->alloc_ts,i,0) {
+		C->alloc_ts[i]->data = NULL;
+		C->alloc_ts[i]->buffer = NULL;
+	}
+	// Reserve makes a new allocation plan for this graph
+	if (!ggml_gallocr_reserve(C->allocr, C->graph) ||
+		!ggml_gallocr_alloc_graph(C->allocr, C->graph))
+		ERROR_LOG(-1, "%s could not allocate memory", C->c.name);
+	// Params in the graph memory (not resident nor in host memory)
+	TRY( mlctx_tstore_load(C, C->tstore) );
+end:
+#endif
+	return R;
+}
+
+static
+int mlctx_prep_(MLCtx* C)
 {
 	TRYRB(-1, vec_count(C->tensors) > 0);
 	MLTensor *result = vec_last(C->tensors,0).tensor;
 	if (C->c.tprefix) mlctx_tensor_add(C, C->c.tprefix, result);
+#if !USE_GGML_SCHED
+	if (C->c.flags_e & MLB_F_RESIDENT) {
+		TRYR( mlctx_load_prep(C) );
+		TRYR( mlctx_build(C, result) );
+		TRYR( mlctx_resident_bind(C, C->tstore) );
+		TRYR( mlctx_alloc(C) );
+		if (vec_count(C->lora.items))  //not resident
+			TRYR( mlctx_tstore_load(C, C->tstore) );
+		return 1;
+	}
+	if (mlctx_host_bind_is(C)) {
+		TRYR( mlctx_load_prep(C) );
+		TRYR( mlctx_build(C, result) );
+		TRYR( mlctx_params_host_bind(C, C->tstore) );
+		TRYR( mlctx_alloc(C) );
+		TRYR( mlctx_tstore_load(C, C->tstore) );
+		return 1;
+	}
+#endif
 	TRYR( mlctx_build_alloc(C, result) );
 	TRYR( mlctx_tstore_load(C, C->tstore) );
 	return 1;
 }
 
+int mlctx_prep(MLCtx* C)
+{
+	if (C->cache.state == MLCTX_CS_READY) return 1;  //from the cache
+	TRYR( mlctx_prep_(C) );
+	if (C->cache.state == MLCTX_CS_NEW) C->cache.state = MLCTX_CS_READY;
+	return 1;
+}
+
 int mlctx_run_(MLCtx* C, LocalTensor* out, const LocalTensor** inputs)
 {
 	int R=1;
@@ -385,3 +1299,207 @@ end:
 	stream_close(&stm, 0);
 	return R;
 }
+
+/* Profiling results */
+
+// Ops that do not compute anything
+static inline
+bool mlctx_op_is_view(enum ggml_op op)
+{
+	return op == GGML_OP_NONE || op == GGML_OP_VIEW || op == GGML_OP_RESHAPE ||
+		op == GGML_OP_PERMUTE || op == GGML_OP_TRANSPOSE;
+}
+
+/* Finds the innermost block (full name id) of each graph node, -1 if none.
+ * The tensors are stored in the compute context in order of creation, so the
+ * ops of a block are those between its begin (see mlctx_block_begin) and
+ * its output.
+ */
+static
+void mlctx_profile_blocks(const MLCtx* C, StringInt* blk)
+{
+	struct Span { size_t beg, end; StringInt key; } *spans=NULL;  //vector
+	size_t *stack=NULL;  //vector
+	const char *base = ggml_get_mem_buffer(C->cc);
+	size_t used = ggml_used_mem(C->cc);
+
+	vec_forp(const MLCtxTensor, C->tensors, p, 0) {
+		if (p->name == MLB_NAME_BLOCK_BEGIN)
+			vec_push(stack, p->key);
+		else if (p->name != MLB_NAME_SPLIT && p->tensor->op != GGML_OP_NONE) {
+			size_t beg = vec_count(stack) ? vec_pop(stack) : 0;
+			size_t end = (const char*)p->tensor - base;
+			vec_push(spans, ((struct Span){ beg, end, p->key }));
+		}
+	}
+
+	int n = ggml_graph_n_nodes(C->graph);
+	for (int i=0; i<n; ++i) {
+		size_t pos = (const char*)ggml_graph_node(C->graph, i) - base;
+		blk[i] = -1;
+		if (pos >= used) continue;
+		size_t beg=0;
+		vec_forp(struct Span, spans, s, 0) {
+			if (s->beg <= pos && pos <= s->end && (blk[i] < 0 || s->beg > beg)) {
+				blk[i] = s->key;
+				beg = s->beg;
+			}
+		}
+	}
+
+	vec_free(stack);
+	vec_free(spans);
+}
+
+typedef struct {
+	const char *name;
+	double t;
+	unsigned n;
+} MLCtxProfStat;
+
+static
+int mlctx_prof_stat_cmp(const void* a, const void* b)
+{
+	double ta = ((const MLCtxProfStat*)a)->t, tb = ((const MLCtxProfStat*)b)->t;
+	return (ta < tb) - (ta > tb);  //descending
+}
+
+static
+void mlctx_prof_stat_write(Stream* out, const char* title, MLCtxProfStat* v,
+	double t_total)
+{
+	qsort(v, vec_count(v), sizeof(*v), mlctx_prof_stat_cmp);
+	stream_printf(out, "\n%s:\n%12s %6s %8s  %s\n", title,
+		"time(ms)", "%", "count", "name");
+	vec_forp(MLCtxProfStat, v, p, 0)
+		stream_printf(out, "%12.3f %6.2f %8u  %s\n", p->t*1e3,
+			p->t / t_total * 100, p->n, p->name);
+}
+
+static
+void mlctx_prof_stat_add(MLCtxProfStat** pv, const char* name, double t)
+{
+	vec_forp(MLCtxProfStat, *pv, p, 0)
+		if (!strcmp(p->name, name)) { p->t += t;  p->n++;  return; }
+	vec_push(*pv, ((MLCtxProfStat){ name, t, 1 }));
+}
+
+int mlctx_profile_dump(MLCtx* C, const char* path_base)
+{
+	int R=1;
+	Stream stm={0};
+	DynStr path=NULL;
+	StringInt *blk=NULL;  //vector
+	MLCtxProfStat *st_op=NULL, *st_self=NULL, *st_incl=NULL;  //vectors
+	double *t_self=NULL, *t_incl=NULL;  //vectors, by name id
+	unsigned *n_self=NULL, *n_incl=NULL;  //vectors, by name id
+
+	int n = ggml_graph_n_nodes(C->graph);
+	if (vec_count(C->prof.t_node) != n) ERROR_LOG(-1, "invalid profile");
+	
+	vec_resize(blk, n);
+	mlctx_profile_blocks(C, blk);
+
+	// Chrome trace: computations and blocks in one thread, ops in other
+	dstr_printf(path, "%s.json", path_base);
+	TRY_LOG( stream_open_file(&stm, path, SOF_CREATE),
+		"could not open '%s'", path);
+
+	stream_str_put(&stm, "{\"traceEvents\":[\n");
+	stream_printf(&stm, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+		"\"tid\":1,\"args\":{\"name\":\"%s\"}},\n", C->c.name);
+	stream_str_put(&stm, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+		"\"tid\":2,\"args\":{\"name\":\"ops\"}}");
+	
+	int b_cur=-1;  //current block span
+	double b_t0=0, b_t1=0;
+	vec_forp(MLCtxProfEvent, C->prof.events, e, 0) {
+		int b = e->node == MLCTX_PROF_COMPUTE ? -1 : blk[e->node];
+		if (b != b_cur && b_cur >= 0)  //end of the block span
+			stream_printf(&stm, ",\n{\"name\":\"%s\",\"cat\":\"block\","
+				"\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+				id_str(b_cur), b_t0*1e6, (b_t1-b_t0)*1e6);
+		if (b != b_cur) b_t0 = e->t0;
+		b_cur = b;
+		b_t1 = e->t0 + e->dt;
+		
+		if (e->node == MLCTX_PROF_COMPUTE) {
+			stream_printf(&stm, ",\n{\"name\":\"%s\",\"cat\":\"compute\","
+				"\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+				C->c.name, e->t0*1e6, e->dt*1e6);
+			continue;
+		}
+		
+		const MLTensor *t = ggml_graph_node(C->graph, e->node);
+		if (mlctx_op_is_view(t->op)) continue;
+		stream_printf(&stm, ",\n{\"name\":\"%s\",\"cat\":\"%s\","
+			"\"ph\":\"X\",\"pid\":1,\"tid\":2,\"ts\":%.3f,\"dur\":%.3f,"
+			"\"args\":{\"node\":%u,\"block\":\"%s\","
+			"\"shape\":\"" GGML_TYPESHAPE_FMT "\"}}",
+			ggml_op_desc(t), ggml_op_desc(t), e->t0*1e6, e->dt*1e6, e->node,
+			b >= 0 ? id_str(b) : "", GGML_TYPESHAPE_ARGS(t));
+	}
+	stream_str_put(&stm, "\n]}\n");
+	stream_close(&stm, 0);
+
+	// Statistics
+	unsigned n_id = strsto_next_idx(C->ss);
+	vec_resize_zero(t_self, n_id);
+	vec_resize_zero(t_incl, n_id);
+	vec_resize_zero(n_self, n_id);
+	vec_resize_zero(n_incl, n_id);
+	double t_total=0;
+	for (int i=0; i<n; ++i) {
+		const MLTensor *t = ggml_graph_node(C->graph, i);
+		double dt = C->prof.t_node[i];
+		t_total += dt;
+		if (!mlctx_op_is_view(t->op))
+			mlctx_prof_stat_add(&st_op, ggml_op_desc(t), dt);
+		if (blk[i] < 0) continue;
+		t_self[blk[i]] += dt;
+		n_self[blk[i]]++;
+		// Add to all the parent blocks
+		StrSlice ss = strsto_get(C->ss, blk[i]);
+		while (1) {
+			StringInt id = strsto_find(C->ss, ss);
+			if (id >= 0) { t_incl[id] += dt;  n_incl[id]++; }
+			while (ss.s > 0 && ss.b[ss.s-1] != C->c.tpath_sep) ss.s--;
+			if (!ss.s--) break;
+		}
+	}
+	for (unsigned i=0; i<n_id; ++i) {
+		if (n_self[i])
+			vec_push(st_self, ((MLCtxProfStat){ id_str(i), t_self[i], n_self[i] }));
+		if (n_incl[i])
+			vec_push(st_incl, ((MLCtxProfStat){ id_str(i), t_incl[i], n_incl[i] }));
+	}
+
+	// Text summary
+	dstr_printf(path, "%s.txt", path_base);
+	TRY_LOG( stream_open_file(&stm, path, SOF_CREATE),
+		"could not open '%s'", path);
+	
+	stream_printf(&stm, "%s profile: %u computations, %d nodes, "
+		"total %.3fs (%.3fs per computation)\n", C->c.name, C->prof.n_compute,
+		n, t_total, t_total / C->prof.n_compute);
+	mlctx_prof_stat_write(&stm, "By op type", st_op, t_total);
+	mlctx_prof_stat_write(&stm, "By block (own ops, count: nodes)",
+		st_self, t_total);
+	mlctx_prof_stat_write(&stm, "By block (including sub-blocks, count: nodes)",
+		st_incl, t_total);
+	
+	log_info("%s profile written to '%s.{json,txt}'", C->c.name, path_base);
+
+end:
+	stream_close(&stm, 0);
+	dstr_free(path);
+	vec_free(blk);
+	vec_free(st_op);
+	vec_free(st_self);
+	vec_free(st_incl);
+	vec_free(t_self);
+	vec_free(t_incl);
+	vec_free(n_self);
+	vec_free(n_incl);
+	return R;
+}
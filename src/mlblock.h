@@ -16,9 +16,6 @@
 #include "ggml-backend.h"
 #include "ggml_extend.h"
 
-//TODO: load: if CPU backend, do not copy tensor data
-//TODO: option: free compute, keep params in memory
-
 typedef struct ggml_tensor MLTensor;
 
 enum {
@@ -33,14 +30,54 @@ enum MLCtxFlags {
 	MLB_F_QUIET			= 2,
 	//(debug) Dump the computation graph to a file
 	MLB_F_DUMP			= 4,
+	// Keep the parameters in memory between computations (see res)
+	// Not supported with USE_GGML_SCHED.
+	MLB_F_RESIDENT		= 8,
+	// Cross attention K/V projections are inputs (see mlb_basic_transf)
+	MLB_F_XKV_INPUT		= 16,
+	//(debug) Time each graph node, the results are written by mlctx_end
+	// to a Chrome trace and a text summary (see mlctx_profile_dump)
+	MLB_F_PROFILE		= 32,
+	// Self-attention Q/K/V projections with one matmul (qkv_proj).
+	// The fused weights are made at load time from q_proj, k_proj and v_proj.
+	MLB_F_FUSED_QKV		= 64,
 };
 
 typedef struct {
 	MLTensor *tensor;
 	StringInt name,
 	          key;  //Full name to load from the tensor store
+	bool host;  //Data points to the tensor store memory, no need to load
 } MLCtxTensor;
 
+typedef struct {
+	struct ggml_context *ctx;
+	ggml_backend_buffer_t buf;
+} MLCtxResGroup;
+
+typedef struct MLCtxCacheEntry MLCtxCacheEntry;
+
+// LoRA branch of a parameter: scale * up * down (see mlctx_lora_add)
+typedef struct {
+	StringInt key,  //target parameter (e.g. "unet.[...].weight")
+	          kdown, kup;  //keys of the LoRA parameters
+	TSTensorEntry *down, *up;
+	float scale;
+} MLCtxLora;
+
+// Layer where LoRA branches may be added (see mlctx_lora_hook)
+typedef struct {
+	MLTensor *w, *x, *out;
+	int s0, s1, p0, p1, d0, d1;  //conv2d parameters, s0=0 for linear
+} MLCtxLoraHook;
+
+typedef struct {
+	unsigned node;  //graph node index, MLCTX_PROF_COMPUTE for the whole graph
+	double t0, dt;  //seconds since the first computation
+} MLCtxProfEvent;
+
+#define MLCTX_PROF_COMPUTE  ((unsigned)-1)
+
 typedef struct {
 	ggml_backend_t backend;  //Fill
 	TensorStore *tstore;  //Fill
@@ -49,6 +86,8 @@ typedef struct {
 	struct ggml_context *cp, *cc; //params, compute
 	struct ggml_cgraph *graph;
     ggml_gallocr_t allocr;
+	ggml_gallocr_t allocr_ext;  //Optional, shared allocator (see mlctx_realloc)
+	MLTensor ** alloc_ts;  //vector, tensors allocated with allocr_ext
 
 #if USE_GGML_SCHED
 	ggml_backend_t backend2;  //Fill
@@ -58,7 +97,35 @@ typedef struct {
 	
 	MLCtxTensor * tensors;  //vector
 	MLTensor ** inputs;  //vector
+	MLTensor ** outputs;  //vector, additional outputs
 	MLTensor * result;
+	ggml_backend_buffer_t * hbufs;  //vector, params using tensor store memory
+
+	// Resident parameters, kept between computations with MLB_F_RESIDENT.
+	// Not free'd by mlctx_free, use mlctx_resident_clear.
+	struct {
+		MLCtxResGroup * groups;  //vector
+		ggml_backend_buffer_t * hbufs;  //vector
+		MLCtxTensor * tensors;  //vector, key sorted
+		size_t mem;
+	} res;
+
+	// LoRA's applied at runtime as low-rank branches of the linear and
+	// conv2d layers (see mlctx_lora_add). Not free'd by mlctx_free.
+	struct {
+		MLCtxLora * items;  //vector, key sorted
+		MLCtxLoraHook * hooks;  //vector, layers of the current computation
+		unsigned n_id;
+	} lora;
+
+	// Cache of built and allocated computations (see c.cache_n).
+	// Cleared by mlctx_resident_clear.
+	struct {
+		MLCtxCacheEntry * entries;  //vector
+		uint64_t tick, key;
+		int flags, state;
+		unsigned n_input;  //inputs created before mlctx_cache_get
+	} cache;
 
 	// Configuration
 	struct {
@@ -69,22 +136,85 @@ typedef struct {
 		const char *name;  //Computation name, set by mlctx_begin
 		int flags;  //MLB_F_*
 		int flags_e;  //Flags valid until the next mlctx_begin
+		unsigned cache_n;  //Max. number of cached computations (0: disabled)
+		unsigned attn_chunk;  //Attention queries chunk size (0: disabled)
 	} c;
 
 	// Information/statistics
 	struct MLCtxInfo {
-		size_t mem_params, mem_compute, mem_total;
+		size_t mem_params, mem_compute, mem_total,
+		       mem_host;  //params using the tensor store memory
 		double t_load, t_compute;
 		unsigned n_compute, n_conv;
+		unsigned n_cache_hit, n_cache_miss;  //cumulative
 	} info;
+
+	// Profiling with MLB_F_PROFILE, cleared by mlctx_free
+	struct {
+		double *t_node;  //vector, total time of each graph node
+		MLCtxProfEvent *events;  //vector
+		struct ggml_context *ctx;
+		struct ggml_cgraph *graph;  //single node graph
+		double t_start;
+		unsigned n_compute;
+	} prof;
 } MLCtx;
 
+struct MLCtxCacheEntry {
+	struct ggml_context *cp, *cc;
+	struct ggml_cgraph *graph;
+	ggml_gallocr_t allocr;
+	MLCtxTensor * tensors;
+	MLTensor ** inputs, ** outputs, * result;
+	ggml_backend_buffer_t * hbufs;
+	const char *name, *tprefix;
+	int flags, wtype;
+	unsigned n_input;  //inputs compared on lookup, the rest are from the build
+	uint64_t key;
+	struct MLCtxInfo info;
+	uint64_t tuse;  //last use tick
+};
+
 void mlctx_free(MLCtx* C);
 
 void mlctx_begin(MLCtx* C, const char* name);
 
 void mlctx_end(MLCtx* C);
 
+// Free the resident parameters and the cached computations.
+// Must be called when the backend or the tensor store data changes.
+void mlctx_resident_clear(MLCtx* C);
+
+void mlctx_cache_clear(MLCtx* C);
+
+/* Runtime LoRA
+ * Instead of merging the LoRA into the weights, a branch is added to the
+ * computation: out = W x + scale * U (D x). This allows to change the LoRA's
+ * without reloading the model. The stores of down and up must be kept open
+ * until mlctx_lora_clear. Clears the graphs cache.
+ */
+int mlctx_lora_add(MLCtx* C, StringInt key, TSTensorEntry* down,
+	TSTensorEntry* up, float scale);
+
+void mlctx_lora_clear(MLCtx* C);
+
+/* Called by the layers after building out from x with the weight w.
+ * conv: stride, padding and dilation of a conv2d, or NULL for a linear layer.
+ */
+void mlctx_lora_hook(MLCtx* C, MLTensor* w, MLTensor* x, MLTensor* out,
+	const int* conv);
+
+/* Reuse a cached computation with the same name, inputs and flags.
+ * key: any other value that changes the computation graph.
+ * Call after creating the inputs. Only these are compared, the inputs added
+ * while building (e.g. the K/V with MLB_F_XKV_INPUT) are part of the entry.
+ * If it returns true, the computation is ready: do not build it, use
+ * C->inputs, C->outputs and C->result instead of the previous tensors. mlctx_prep may be called, it does nothing.
+ * Otherwise, build the computation as usual, it will be stored in the cache
+ * on mlctx_end.
+ */
+bool mlctx_cache_get(MLCtx* C, uint64_t key);
+
 // All in one
 int mlctx_run_(MLCtx* C, LocalTensor* out, const LocalTensor** inputs);
 #define mlctx_run(C,O,...) \
@@ -94,28 +224,61 @@ int mlctx_run_(MLCtx* C, LocalTensor* out, const LocalTensor** inputs);
 // Pending: set input, compute, get output, free
 int mlctx_prep(MLCtx* C);
 
+/* Makes the input t use the host memory data directly (CPU backend only),
+ * then it does not need to be set and in-place results are written there.
+ * Call before mlctx_prep. Returns false if not possible.
+ */
+bool mlctx_input_host_bind(MLCtx* C, MLTensor* t, void* data);
+
 /* Step by step interface */
 
 // No need to call build
 void mlctx_block_graph_dump(const MLCtx* C, Stream* out);
 int mlctx_block_graph_dump_path(const MLCtx* C, const char* path);
 
+// Store in the key of each tensor its full name in the tensor store
+int mlctx_load_prep(MLCtx* C);
+
 int mlctx_build_alloc(MLCtx* C, MLTensor* result);
 
 int mlctx_tstore_load(MLCtx* C, TensorStore* ts);
 
 int mlctx_compute(MLCtx* C);
 
+/* With a shared allocator (allocr_ext), allocates the graph again because
+ * other graphs may have used the same memory. Call before setting the inputs
+ * of each computation. Does nothing without allocr_ext.
+ */
+int mlctx_realloc(MLCtx* C);
+
+/* Write the profiling results of the current computation:
+ * <path_base>.json: Chrome trace (chrome://tracing or ui.perfetto.dev).
+ * <path_base>.txt: time by op type and by block name.
+ * Called by mlctx_end with MLB_F_PROFILE, as "dump-prof-<name>".
+ */
+int mlctx_profile_dump(MLCtx* C, const char* path_base);
+
 /* aux */
 
-int tstore_tensor_read(TSTensorEntry*, struct ggml_tensor*);
+/* Reads the tensor data from the store into the part i_part of n_part equal
+ * parts of t (split along the last dimension).
+ */
+int tstore_tensor_read_part(TSTensorEntry*, struct ggml_tensor* t,
+	unsigned i_part, unsigned n_part);
+
+static inline
+int tstore_tensor_read(TSTensorEntry* S, struct ggml_tensor* t) {
+	return tstore_tensor_read_part(S, t, 0, 1);
+}
 
 /* Functions to define blocks */
 
 static inline
 void mlctx_block_begin(MLCtx* C)
 {
-	vec_push(C->tensors, ((MLCtxTensor){ NULL, MLB_NAME_BLOCK_BEGIN }));
+	// Position of the next tensor in the compute context (see mlctx_profile)
+	StringInt pos = ggml_used_mem(C->cc);
+	vec_push(C->tensors, ((MLCtxTensor){ NULL, MLB_NAME_BLOCK_BEGIN, pos }));
 	log_debug2("ML block begin");
 }
 
@@ -131,6 +294,15 @@ MLTensor* mlctx_tensor_add(MLCtx* C, const char* name, MLTensor* tensor)
 	return tensor;
 }
 
+// Additional output, kept in C->outputs
+static inline
+MLTensor* mlctx_output_add(MLCtx* C, MLTensor* tensor)
+{
+	ggml_set_output(tensor);
+	vec_push(C->outputs, tensor);
+	return tensor;
+}
+
 static inline
 MLTensor* mlctx_split_add(MLCtx* C, MLTensor* tensor)
 {
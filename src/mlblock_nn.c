@@ -19,11 +19,13 @@ MLTensor* mlb_nn_linear(MLCtx* C, MLTensor* x, int n_out, bool bias)
 	mlctx_block_begin(C);
 	int n_in = x->ne[0];
 	w = MLN("weight", ggml_new_tensor_2d(C->cp, C->c.wtype, n_in, n_out));
+	MLTensor *x0 = x;
     x = ggml_mul_mat(C->cc, w, x);
     if (bias) {
 		b = MLN("bias", ggml_new_tensor_1d(C->cp, GGML_TYPE_F32, n_out));
         x = ggml_add(C->cc, x, b);
     }
+	mlctx_lora_hook(C, w, x0, x, NULL);
 	return x;
 }
 
@@ -41,6 +43,7 @@ MLTensor* mlb_nn_conv2d(MLCtx* C, MLTensor* x,
 	// Warning: conv_2d works only with F16
 	w = MLN("weight",
 		ggml_new_tensor_4d(C->cp, GGML_TYPE_F16, k0, k1, ch_in, ch_out));
+	MLTensor *x0 = x;
     x = ggml_conv_2d(C->cc, w, x, s0,s1, p0,p1, d0,d1);
 
 	if (bias) {
@@ -51,6 +54,7 @@ MLTensor* mlb_nn_conv2d(MLCtx* C, MLTensor* x,
     }
     // x: [N, ch_out, h, w]
 
+	mlctx_lora_hook(C, w, x0, x, (int[]){ s0, s1, p0, p1, d0, d1 });
 	return x;
 }
 
@@ -187,8 +191,10 @@ MLTensor* mlb_feed_forward(MLCtx* C, MLTensor* x, int d_out, int mult)
 }
 
 //ref: diffusers/models/attention_processor.py: class Attention
-MLTensor* mlb_attn_mhead(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
-	int d_out, int d_embed, int n_head, bool mask, bool bias, bool bias_out)
+static
+MLTensor* mlb_attn_mhead_(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
+	int d_out, int d_embed, int n_head, bool mask, bool bias, bool bias_out,
+	bool kv_proj)
 {
 	GGML_ASSERT( q->ne[3] == 1 );
 	GGML_ASSERT( k->ne[3] == 1 );
@@ -200,27 +206,42 @@ MLTensor* mlb_attn_mhead(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
 	GGML_ASSERT( d_head * n_head == d_embed );
 
 	mlctx_block_begin(C);
-	q = MLN("q_proj", mlb_nn_linear(C, q, d_embed, bias));
-	q = ggml_reshape_4d(C->cc, q, d_head, n_head, nq1, nq2);
+	if (kv_proj && q == k && k == v && (C->c.flags_e & MLB_F_FUSED_QKV)) {
+		// Self-attention: one matmul, q, k and v are views of the result
+		MLTensor *x = MLN("qkv_proj", mlb_nn_linear(C, q, d_embed*3, bias));
+		size_t nb_h = x->nb[0] * d_head, o = x->nb[0] * d_embed;
+		q = ggml_view_4d(C->cc, x, d_head, n_head, nq1, nq2,
+			nb_h, x->nb[1], x->nb[2], 0);
+		k = ggml_view_4d(C->cc, x, d_head, n_head, nk1, nk2,
+			nb_h, x->nb[1], x->nb[2], o);
+		v = ggml_view_4d(C->cc, x, d_head, n_head, nv1, nv2,
+			nb_h, x->nb[1], x->nb[2], o*2);
+	}
+	else {
+		q = MLN("q_proj", mlb_nn_linear(C, q, d_embed, bias));
+		q = ggml_reshape_4d(C->cc, q, d_head, n_head, nq1, nq2);
+		if (kv_proj) k = MLN("k_proj", mlb_nn_linear(C, k, d_embed, bias));
+		k = ggml_reshape_4d(C->cc, k, d_head, n_head, nk1, nk2);
+		if (kv_proj) v = MLN("v_proj", mlb_nn_linear(C, v, d_embed, bias));
+		v = ggml_reshape_4d(C->cc, v, d_head, n_head, nv1, nv2);
+	}
+
+#ifdef USE_FLASH_ATTENTION
+	q = ggml_permute(C->cc, q, 0, 2, 1, 3);  //[N, n_head, n_tok, d_head]
+	k = ggml_permute(C->cc, k, 0, 2, 1, 3);
+	v = ggml_permute(C->cc, v, 0, 2, 1, 3);
+	v = ggml_nn_attention_flash(C->cc, q, k, v, mask);
+	//[N, n_tok, n_head, d_head]
+#else
 	q = ggml_cont(C->cc, ggml_permute(C->cc, q, 0, 2, 1, 3));
 	q = ggml_reshape_3d(C->cc, q, d_head, nq1, n_head * nq2);
 
-	k = MLN("k_proj", mlb_nn_linear(C, k, d_embed, bias));
-	k = ggml_reshape_4d(C->cc, k, d_head, n_head, nk1, nk2);
 	k = ggml_cont(C->cc, ggml_permute(C->cc, k, 0, 2, 1, 3));
 	k = ggml_reshape_3d(C->cc, k, d_head, nk1, n_head * nk2);
 
-	v = MLN("v_proj", mlb_nn_linear(C, v, d_embed, bias));
-	v = ggml_reshape_4d(C->cc, v, d_head, n_head, nv1, nv2);
-
-#ifdef USE_FLASH_ATTENTION
-	v = ggml_cont(C->cc, ggml_permute(C->cc, v, 0, 2, 1, 3));
-	v = ggml_reshape_3d(C->cc, v, d_head, nv1, n_head * nv2);
-	v = ggml_flash_attn_ext(C->cc, q, k, v, NULL, 1.0f, 0.0f);
-#else
 	v = ggml_cont(C->cc, ggml_permute(C->cc, v, 1, 2, 0, 3));
 	v = ggml_reshape_3d(C->cc, v, nv1, d_head, n_head * nv2);
-	v = ggml_nn_attention(C->cc, q, k, v, mask);
+	v = ggml_nn_attention_chunked(C->cc, q, k, v, mask, C->c.attn_chunk);
 	v = ggml_reshape_4d(C->cc, v, d_head, nq1, n_head, nq2);
 	v = ggml_cont(C->cc, ggml_permute(C->cc, v, 0, 2, 1, 3));
 #endif
@@ -230,6 +251,32 @@ MLTensor* mlb_attn_mhead(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
 	return v;
 }
 
+MLTensor* mlb_attn_mhead(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
+	int d_out, int d_embed, int n_head, bool mask, bool bias, bool bias_out)
+{
+	return mlb_attn_mhead_(C, q, k, v, d_out, d_embed, n_head,
+		mask, bias, bias_out, true);
+}
+
+MLTensor* mlb_attn_mhead_kv(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
+	int d_out, int d_embed, int n_head, bool mask, bool bias, bool bias_out)
+{
+	return mlb_attn_mhead_(C, q, k, v, d_out, d_embed, n_head,
+		mask, bias, bias_out, false);
+}
+
+// K and V projections from mlb_attn_mhead, added as outputs
+MLTensor* mlb_attn_kv_proj(MLCtx* C, MLTensor* k, MLTensor* v,
+	int d_embed, bool bias)
+{
+	mlctx_block_begin(C);
+	k = MLN("k_proj", mlb_nn_linear(C, k, d_embed, bias));
+	v = MLN("v_proj", mlb_nn_linear(C, v, d_embed, bias));
+	mlctx_output_add(C, k);
+	mlctx_output_add(C, v);
+	return v;
+}
+
 //ref: diffusers/models/activations.py: class BasicTransformerBlock
 MLTensor* mlb_basic_transf(MLCtx* C, MLTensor* x, MLTensor* c,
 	int d_out, int d_embed, int n_head)
@@ -242,8 +289,17 @@ MLTensor* mlb_basic_transf(MLCtx* C, MLTensor* x, MLTensor* c,
 	x = ggml_add(C->cc, x, r);
 	r = x;
 	x = MLN("norm2", mlb_nn_layer_norm(C, x, true, true, 0));
-	x = MLN("attn2", mlb_attn_mhead(C, x,c,c,
-		d_out, d_embed, n_head, false, false, true));
+	if (C->c.flags_e & MLB_F_XKV_INPUT) {
+		// Projections computed before with mlb_basic_transf_xkv
+		MLTensor *k, *v;
+		k = mlctx_input_new(C, "xk", GGML_TYPE_F32, d_embed, c->ne[1], c->ne[2], 1);
+		v = mlctx_input_new(C, "xv", GGML_TYPE_F32, d_embed, c->ne[1], c->ne[2], 1);
+		x = MLN("attn2", mlb_attn_mhead_kv(C, x,k,v,
+			d_out, d_embed, n_head, false, false, true));
+	}
+	else
+		x = MLN("attn2", mlb_attn_mhead(C, x,c,c,
+			d_out, d_embed, n_head, false, false, true));
 	x = ggml_add(C->cc, x, r);
 	r = x;
 	x = MLN("norm3", mlb_nn_layer_norm(C, x, true, true, 0));
@@ -251,3 +307,9 @@ MLTensor* mlb_basic_transf(MLCtx* C, MLTensor* x, MLTensor* c,
 	x = ggml_add(C->cc, x, r);
 	return x;
 }
+
+MLTensor* mlb_basic_transf_xkv(MLCtx* C, MLTensor* c, int d_embed)
+{
+	mlctx_block_begin(C);
+	return MLN("attn2", mlb_attn_kv_proj(C, c, c, d_embed, false));
+}
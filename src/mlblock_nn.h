@@ -37,5 +37,20 @@ MLTensor* mlb_feed_forward(MLCtx* C, MLTensor* x, int d_out, int mult);
 MLTensor* mlb_attn_mhead(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
 	int d_out, int d_embed, int n_head, bool mask, bool bias, bool bias_out);
 
+// Like mlb_attn_mhead, but k and v are already projected
+MLTensor* mlb_attn_mhead_kv(MLCtx* C, MLTensor* q, MLTensor* k, MLTensor* v,
+	int d_out, int d_embed, int n_head, bool mask, bool bias, bool bias_out);
+
+MLTensor* mlb_attn_kv_proj(MLCtx* C, MLTensor* k, MLTensor* v,
+	int d_embed, bool bias);
+
+/* With MLB_F_XKV_INPUT, the cross attention K/V projections of the context c
+ * are taken from new inputs instead, c is only used for its shape.
+ */
 MLTensor* mlb_basic_transf(MLCtx* C, MLTensor* x, MLTensor* c,
 	int d_out, int d_embed, int n_head);
+
+/* Cross attention K/V projections of the context c, added as outputs.
+ * Used to compute them once when c does not change.
+ */
+MLTensor* mlb_basic_transf_xkv(MLCtx* C, MLTensor* c, int d_embed);
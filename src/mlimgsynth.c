@@ -11,6 +11,7 @@ typedef struct LocalTensor MLIS_Tensor;
 #include "ccommon/fsutil.h"
 #include "ccommon/rng_philox.h"
 #include "ccompute/tensorstore.h"
+#include "ccompute/tensorstore_gguf.h"
 
 #include "localtensor.h"
 #include "prompt_preproc.h"
@@ -128,6 +129,40 @@ void mlis_tensor_to_image(const MLIS_Tensor* T, MLIS_Image* I, int idx)
 	}
 }
 
+// Repeats a tensor with a batch of one to fill n_batch.
+static
+int mlis_tensor_batch_repeat(MLIS_Tensor* T, int n_batch)
+{
+	if (T->n[3] == n_batch) return 1;
+	if (T->n[3] != 1) return MLIS_E_UNKNOWN;
+
+	LocalTensor tmp={0};
+	size_t n = ltensor_nelements(T);
+	ltensor_resize(&tmp, T->n[0], T->n[1], T->n[2], n_batch);
+	for (int b=0; b<n_batch; ++b)
+		ARRAY_COPY(tmp.d + n*b, T->d, n);
+	
+	tmp.flags |= T->flags & LT_F_READY;
+	ltensor_free(T);
+	*T = tmp;
+	return 1;
+}
+
+// Concatenates two tensors with a batch of one, repeating each n times:
+// dst = [a]*n + [b]*n
+static
+void mlis_tensor_batch_cat(MLIS_Tensor* dst, const MLIS_Tensor* a,
+	const MLIS_Tensor* b, int n)
+{
+	assert( ltensor_shape_equal(a, b) && a->n[3] == 1 );
+	size_t ne = ltensor_nelements(a);
+	ltensor_resize(dst, a->n[0], a->n[1], a->n[2], n*2);
+	for (int i=0; i<n; ++i) {
+		ARRAY_COPY(dst->d + ne*i    , a->d, ne);
+		ARRAY_COPY(dst->d + ne*(n+i), b->d, ne);
+	}
+}
+
 static
 int mlis_tensor_from_image(MLIS_Tensor* T, const MLIS_Image* I)
 {
@@ -290,6 +325,14 @@ g_option_attr[MLIS_OPT__LAST+1] = {
 	{ "model_type" },
 	{ "weight_type" },
 	{ "no_prompt_parse" },
+	{ "keep_weights" },
+	{ "graph_cache" },
+	{ "unet_kv_pre" },
+	{ "vae_tile_workers" },
+	{ "image_sink" },
+	{ "attn_chunk" },
+	{ "weight_cache" },
+	{ "lora_runtime" },
 };
 
 IMPL_ENUM_FUNC(stage, MLIS_Stage, -1)
@@ -307,6 +350,10 @@ typedef struct MLIS_Ctx {
 	MLCtx ctx;
 	TensorStore tstore;
 	Stream stm_model, stm_tae;
+	TensorStore tstore_wc;  // Converted weights cache
+	Stream stm_wc;
+	uint64_t wc_key;  // Model key for the cache, 0 if not calculated
+	unsigned wc_n;  // Number of tensors in the cache file
 	DenoiseSampler sampler;  // Sampler options inside
 	StringStore ss;
 
@@ -322,13 +369,23 @@ typedef struct MLIS_Ctx {
 		int flags;
 	} *loras;  //vector
 
+	// Open LoRA files applied at runtime (MLIS_CF_LORA_RUNTIME)
+	struct MLIS_LoraRt {
+		TensorStore ts;
+		Stream stm;
+	} **lora_rt;  //vector
+	// LoRA's merged into the weights in memory, and the original data of the
+	// modified tensors to revert them
+	struct MLIS_LoraCfg *loras_merged;  //vector
+	LoraUndo lora_undo;
+
 	// After a function returns an error (<0), this will have its description.
 	// Don't overwrite.
 	char *errstr;  //dynstr
 	
-	// Last generated image parameters textual description to be incluided in the
-	// metadata. Don't overwrite.
-	char *infotext;  //dynstr
+	// Last generated images parameters textual description to be incluided in
+	// the metadata. One for each image in the batch. Don't overwrite.
+	DynStr *infotext;  //vector
 	
 	// Tensor used and produced during generation.
 	// Managed internally, there is no need to explicitly create or free them.
@@ -340,6 +397,7 @@ typedef struct MLIS_Ctx {
 
 	// Tokens vector
 	int32_t *tokens;  //vector
+	ClipTokCache tokc;  // Tokenizer words cache
 	float *tokens_weights;  //vector  //TODO: tensor?
 	
 	// Image for mlis_image_get
@@ -355,6 +413,10 @@ typedef struct MLIS_Ctx {
 	MLIS_Callback callback;
 	void *callback_ud;  // User-reserved data to be used by the callback
 
+	// User image sink, receives the decoded images by bands of rows.
+	MLIS_ImageSink sink;
+	void *sink_ud;
+
 	// User-specified error handler
 	MLIS_ErrorHandler errh;
 	void *errh_ud;
@@ -375,7 +437,8 @@ typedef struct MLIS_Ctx {
 		       path_model,     // Path to model file. Mandatory.
 		       path_tae,       // Path to TAE model.
 		       path_lora_dir,  // Path to the directory with LoRA files.
-			   path_aux;       // Path to auxiliary file (e.g. clip vocabulary)
+			   path_aux,       // Path to auxiliary file (e.g. clip vocabulary)
+			   path_wcache;    // Directory of the converted weights cache
 		       //path_vae,
 		       //path_clip,
 		
@@ -394,6 +457,7 @@ typedef struct MLIS_Ctx {
 					height,     // Image height in pixels
 					clip_skip,
 					vae_tile,   // Reduces memory usage, try with 512
+					vae_tile_workers,  // Tiles computed in parallel
 					n_batch,    // Number of images to generate simultaneously
 					n_thread;
 
@@ -421,6 +485,13 @@ enum MLIS_ConfigFlag {
 	MLIS_CF_NO_DECODE		= 4,
 	// Do not parse the prompt to extract weighting or loras
 	MLIS_CF_NO_PROMPT_PARSE	= 8,
+	// Keep the model weights in the backend memory between generations
+	MLIS_CF_KEEP_WEIGHTS	= 16,
+	// Keep both unet halves during the generation (with MLIS_CF_UNET_SPLIT)
+	MLIS_CF_UNET_SPLIT_KEEP	= 32,
+	// Precompute the cross attention K/V of the conditioning
+	MLIS_CF_UNET_KV_PRE		= 64,
+	MLIS_CF_LORA_RUNTIME	= 128,
 	//MLIS_CF_PROMPT_NO_PROC
 	MLIS_CF_MODEL_TYPE_SET	= 0x1000,
 	MLIS_CF_WEIGHT_TYPE_SET = 0x2000,
@@ -430,6 +501,7 @@ enum MLIS_DumpFlag {
 	MLIS_DUMP_MODEL		= 1,
 	MLIS_DUMP_LORA		= 2,
 	MLIS_DUMP_GRAPH		= 4,
+	MLIS_DUMP_PROFILE	= 8,
 };
 
 enum MLIS_ReadyFlag {
@@ -437,6 +509,7 @@ enum MLIS_ReadyFlag {
 	MLIS_READY_MODEL		= 2,
 	MLIS_READY_LORAS		= 4,
 	MLIS_READY_RNG			= 8,
+	MLIS_READY_WEIGHTS		= 16,
 };
 
 enum MLIS_LoraFlag {
@@ -468,9 +541,11 @@ MLIS_Ctx* mlis_ctx_create_i(int version)
 	S->ctx.tstore = &S->tstore;
 	S->ctx.ss = &S->ss;
 	S->tstore.ss = &S->ss;
+	S->tstore_wc.ss = &S->ss;
 
 	// Default options
 	S->ctx.c.wtype = GGML_TYPE_F16;
+	S->ctx.c.flags = MLB_F_FUSED_QKV;
 	S->c.cfg_scale = 7;  //TODO: is it possible to detect a model-optimal value?
 	
 	return S;
@@ -487,22 +562,46 @@ void mlis_cfg_loras_free(MLIS_Ctx* S)
 	S->rflags &= ~MLIS_READY_LORAS;
 }
 
+static
+void mlis_loras_merged_clear(MLIS_Ctx* S)
+{
+	vec_for(S->loras_merged,i,0)
+		dstr_free(S->loras_merged[i].path);
+	vec_free(S->loras_merged);
+	lora_undo_free(&S->lora_undo);
+}
+
+static
+void mlis_lora_rt_clear(MLIS_Ctx* S)
+{
+	mlctx_lora_clear(&S->ctx);
+	vec_for(S->lora_rt,i,0) {
+		tstore_free(&S->lora_rt[i]->ts);
+		stream_close(&S->lora_rt[i]->stm, 0);
+		alloc_free(g_allocator, S->lora_rt[i]);
+	}
+	vec_free(S->lora_rt);
+}
+
 static
 void mlis_free(MLIS_Ctx* S)
 {
 	//TODO: use a local allocator and free all at once?
 	dstr_free(S->errstr);
-	dstr_free(S->infotext);
+	vec_for(S->infotext,i,0) dstr_free(S->infotext[i]);
+	vec_free(S->infotext);
 	dstr_free(S->c.backend);
 	dstr_free(S->c.be_params);
 	dstr_free(S->c.path_model);
 	dstr_free(S->c.path_tae);
 	dstr_free(S->c.path_lora_dir);
+	dstr_free(S->c.path_wcache);
 	dstr_free(S->c.prompt_raw);
 	dstr_free(S->c.nprompt_raw);
 	prompt_text_free(&S->c.prompt);
 	prompt_text_free(&S->c.nprompt);
 	vec_free(S->tokens);
+	clip_tok_cache_free(&S->tokc);
 	vec_free(S->tokens_weights);
 
 	vec_free(S->backend_info.devs);
@@ -520,9 +619,14 @@ void mlis_free(MLIS_Ctx* S)
 	ltensor_free(&S->nlabel);
 
 	dnsamp_free(&S->sampler);
+	mlis_lora_rt_clear(S);
+	mlis_loras_merged_clear(S);
 	mlctx_free(&S->ctx);
+	mlctx_resident_clear(&S->ctx);
 	stream_close(&S->stm_tae, 0);
 	tstore_free(&S->tstore);
+	tstore_free(&S->tstore_wc);
+	stream_close(&S->stm_wc, 0);
 	stream_close(&S->stm_model, 0);
 	strsto_free(&S->ss);
 	if (S->ctx.backend)
@@ -986,74 +1090,6 @@ end:
 	ERROR_HANDLE_END("mlis_option_get")
 }
 
-static
-int open_clip_attn_conv(TensorStore* ts, const TSTensorEntry *e, const char* name)
-{
-	TSTensorEntry new={0};
-	DynStr tmps = dstr_stack(128);
-	StrSlice ss = strsl_fromz(name);
-
-	const char *type;
-	if (strsl_suffixz_trim(&ss, "in_proj_bias")) type = "bias";
-	else if (strsl_suffixz_trim(&ss, "in_proj_weight")) type = "weight";
-	else return 0;
-
-	unsigned idim = e->shape[1] == 1 ? 0 : 1;
-
-	if (!(e->shape[idim] % 3 == 0)) {
-		log_error("invalid open_clip tensor '%s'", name);
-		return -1;
-	}
-
-	new = *e;
-	new.shape[idim] /= 3;
-	new.size /= 3;
-	
-	dstr_copy(tmps, ss.s, ss.b);
-	dstr_appendz(tmps, "q_proj.");
-	dstr_appendz(tmps, type);
-	tstore_tensor_add(ts, tmps, &new);
-	new.offset += new.size;
-	
-	dstr_copy(tmps, ss.s, ss.b);
-	dstr_appendz(tmps, "k_proj.");
-	dstr_appendz(tmps, type);
-	tstore_tensor_add(ts, tmps, &new);
-	new.offset += new.size;
-	
-	dstr_copy(tmps, ss.s, ss.b);
-	dstr_appendz(tmps, "v_proj.");
-	dstr_appendz(tmps, type);
-	tstore_tensor_add(ts, tmps, &new);
-
-	return 1;
-}
-
-static
-int tensor_callback_main(void* user, TensorStore* ts, TSTensorEntry* te,
-	DynStr* pname)
-{
-	int r;
-	DynStr newname = dstr_stack(128);
-
-	// Rename tensors to uniform names
-	TRYR( r = tnconv_sd(strsl_fromd(*pname), &newname) );
-	if (r == 0) {  //unused
-		log_debug2("unused tensor '%s'", *pname);
-		return 0;
-	}
-
-	if (r == TNCONV_R_QKV_PROJ) {
-		// Convert from openclip attention projection in one tensor
-		// to three tensors.
-		TRYR( open_clip_attn_conv(ts, te, newname) );
-		return 0;  //do not save the original tensor
-	}
-
-	dstr_copyd(*pname, newname);
-	return 1;
-}
-
 static
 int tensor_callback_prefix_add(void* user, TensorStore* ts, TSTensorEntry* te,
 	DynStr* pname)
@@ -1109,7 +1145,7 @@ int mlis_lora_load_apply(MLIS_Ctx* S, const char* path, float mult)
 	if (S->c.dump_flags & MLIS_DUMP_LORA)
 		TRY( tstore_info_dump_path(&ts, "dump-tensors-lora.txt") );
 
-	TRY( lora_apply(&S->tstore, &ts, mult, &S->ctx) );
+	TRY( lora_apply(&S->tstore, &ts, mult, &S->ctx, &S->lora_undo) );
 
 end:
 	if (R<0) log_error("lora apply '%s': %x", path, -R);
@@ -1117,14 +1153,124 @@ end:
 }
 
 static
-void ggml__backend_set_n_threads(ggml_backend_t backend, int n_threads)
+int mlis_lora_load_rt(MLIS_Ctx* S, const char* path, float mult)
 {
-	ggml_backend_dev_t dev = ggml_backend_get_device(backend);
-	ggml_backend_reg_t reg = ggml_backend_dev_backend_reg(dev);
-	ggml_backend_set_n_threads_t func = ggml_backend_reg_get_proc_address(reg,
-		"ggml_backend_set_n_threads");
-	if (func)
-		func(backend, n_threads);
+	int R=1;
+	DynStr tmps=NULL;
+	TSTensorData td={0};
+	
+	log_debug("lora runtime: '%s' %g", path, mult);
+
+	struct MLIS_LoraRt *L = alloc_new(g_allocator, struct MLIS_LoraRt, 1);
+	L->ts.ss = &S->ss;
+	vec_push(S->lora_rt, L);  //free'd by mlis_lora_rt_clear
+
+	TRY_LOG( stream_open_file(&L->stm, path, SOF_READ | SOF_MMAP),
+		"could not open '%s'", path);
+
+	TSCallback cb = { tensor_callback_lora };
+	TRY( tstore_read(&L->ts, &L->stm, NULL, &cb) );
+	
+	if (S->c.dump_flags & MLIS_DUMP_LORA)
+		TRY( tstore_info_dump_path(&L->ts, "dump-tensors-lora.txt") );
+
+	// Same scale as lora_apply
+	vec_forp(TSTensorEntry, L->ts.tensors, ld, 0) {
+		StrSlice name = strsto_get(L->ts.ss, ld->key);
+		if (!( strsl_suffix_trim(&name, strsl_static(".lora_down.weight")) ))
+			continue;
+
+		dstr_copy(tmps, name.s, name.b);
+		dstr_appendz(tmps, ".lora_up.weight");
+		TSTensorEntry *lu = tstore_tensor_get(&L->ts, tmps);
+		if (!lu) ERROR_LOG(-1, "lora up tensor not found: %s", tmps);
+
+		float scale=1;
+		dstr_copy(tmps, name.s, name.b);
+		dstr_appendz(tmps, ".scale");
+		TSTensorEntry *e = tstore_tensor_get(&L->ts, tmps);
+		if (e) {
+			TRY( tstore_tensor_data_get(e, TS_DTYPE_F32, 0, &td) );
+			scale = *(float*)td.data;
+		}
+		else {
+			dstr_copy(tmps, name.s, name.b);
+			dstr_appendz(tmps, ".alpha");
+			if ((e = tstore_tensor_get(&L->ts, tmps))) {
+				TRY( tstore_tensor_data_get(e, TS_DTYPE_F32, 0, &td) );
+				scale = *(float*)td.data / ld->shape[ld->shape_n-1];
+			}
+		}
+		tstore_tdata_free(&td);
+
+		dstr_copy(tmps, name.s, name.b);
+		dstr_appendz(tmps, ".weight");
+		TRY( mlctx_lora_add(&S->ctx, strsto_add(&S->ss, strsl_fromd(tmps)),
+			ld, lu, scale * mult) );
+	}
+
+end:
+	if (R<0) log_error("lora runtime '%s': %x", path, -R);
+	tstore_tdata_free(&td);
+	dstr_free(tmps);
+	return R;
+}
+
+/* Loads the configured LoRA's. The merged LoRA's are changed incrementally:
+ * if the previous ones are the first of the list, only the new ones are
+ * applied. Otherwise, the modified tensors are reverted first, the rest of
+ * the weights are not touched.
+ */
+static
+int mlis_loras_setup(MLIS_Ctx* S)
+{
+	int R=1, r;
+	bool merge = vec_count(S->loras) && !(S->c.flags & MLIS_CF_LORA_RUNTIME);
+	double t;
+
+	mlis_lora_rt_clear(S);
+
+	// Number of merged LoRA's that are kept
+	unsigned n_keep=0;
+	while (merge && n_keep < vec_count(S->loras_merged) &&
+		n_keep < vec_count(S->loras) &&
+		!strcmp(S->loras[n_keep].path, S->loras_merged[n_keep].path) &&
+		S->loras[n_keep].mult == S->loras_merged[n_keep].mult)
+		n_keep++;
+
+	if (n_keep < vec_count(S->loras_merged)) {
+		t = timing_time();
+		mlctx_resident_clear(&S->ctx);
+		TRY( r = lora_undo_revert(&S->lora_undo) );
+		mlis_loras_merged_clear(S);
+		n_keep = 0;
+		t = timing_time() - t;
+		log_info("LoRA's reverted: %d tensors {%.3fs}", r, t);
+	}
+
+	if (n_keep == vec_count(S->loras)) return 1;
+
+	t = timing_time();
+	if (merge) mlctx_resident_clear(&S->ctx);
+	vec_for(S->loras,i,n_keep) {
+		if (!merge) {
+			TRY( mlis_lora_load_rt(S, S->loras[i].path, S->loras[i].mult) );
+			continue;
+		}
+		TRY( mlis_lora_load_apply(S, S->loras[i].path, S->loras[i].mult) );
+		struct MLIS_LoraCfg m = S->loras[i];
+		m.path = NULL;
+		dstr_copyd(m.path, S->loras[i].path);
+		vec_push(S->loras_merged, m);
+	}
+	t = timing_time() - t;
+	log_info("LoRA's %s: %u {%.3fs}", merge ? "applied" : "loaded",
+		vec_count(S->loras) - n_keep, t);
+
+end:
+	// The weights may be partially modified
+	if (R<0) S->rflags &= ~MLIS_READY_WEIGHTS;
+	return R;
 }
 
 static
@@ -1133,6 +1279,7 @@ int mlis_backend_init(MLIS_Ctx* S)
 	int R=1;
 	
 	if (S->ctx.backend) {
+		mlctx_resident_clear(&S->ctx);
 		ggml_backend_free(S->ctx.backend);
 		S->ctx.backend = NULL;
 	}
@@ -1148,6 +1295,8 @@ int mlis_backend_init(MLIS_Ctx* S)
 
 	if (S->c.n_thread > 0)
 		ggml__backend_set_n_threads(S->ctx.backend, S->c.n_thread);
+	g_ltensor_n_thread = S->c.n_thread;
+	g_tstore_n_thread = S->c.n_thread;
 
 #if USE_GGML_SCHED  //old code
 	if (!S->ctx.backend2) {
@@ -1172,6 +1321,11 @@ int mlis_model_load(MLIS_Ctx* S)
 	if (!(S->c.path_model))  //TODO: allow to set the model by parts
 		ERROR_LOG(MLIS_E_UNKNOWN, "No model file set");
 
+	// Previous model, its metadata would be mixed with the new one
+	tstore_free(&S->tstore);
+	stream_close(&S->stm_tae, 0);
+	stream_close(&S->stm_model, 0);
+
 	double t = timing_time();
 	if (S->c.path_model) {
 		log_debug("Loading model header from '%s'", S->c.path_model);
@@ -1179,7 +1333,7 @@ int mlis_model_load(MLIS_Ctx* S)
 			SOF_READ | SOF_MMAP),
 			"could not open '%s'", S->c.path_model);
 		log_debug("model stream class: %s", S->stm_model.cls->name);
-		TSCallback cb = { tensor_callback_main };
+		TSCallback cb = { tnconv_tstore_cb };
 		TRY( tstore_read(&S->tstore, &S->stm_model, NULL, &cb) );
 	}
 
@@ -1248,6 +1402,175 @@ end:
 	return R;
 }
 
+/* Converted weights cache
+ */
+#define MLIS_WCACHE_VERSION  1
+
+static inline
+uint64_t hash_fnv1a(uint64_t h, size_t n, const void* data)
+{
+	const uint8_t *p = data;
+	for (size_t i=0; i<n; ++i) h = (h ^ p[i]) * 0x100000001b3ULL;
+	return h;
+}
+
+/* Key to identify the model in the weights cache: hash of the tensors names,
+ * types and shapes, and of the start of their data (to tell apart models
+ * fine-tuned from the same base) without reading the whole file.
+ */
+static
+int mlis_model_key(MLIS_Ctx* S, uint64_t* pkey)
+{
+	int R=1;
+	uint64_t h = 0xcbf29ce484222325ULL ^ MLIS_WCACHE_VERSION;
+
+	vec_forp(TSTensorEntry, S->tstore.tensors, e, 0) {
+		StrSlice name = strsto_get(&S->ss, e->key);
+		h = hash_fnv1a(h, name.s, name.b);
+		h = hash_fnv1a(h, sizeof(e->dtype), &e->dtype);
+		h = hash_fnv1a(h, sizeof(e->shape), e->shape);
+
+		size_t sz = e->size < 256 ? e->size : 256;
+		TRY( stream_seek(e->stm, e->offset, 0) );
+		if (stream_read_prep(e->stm, sz) < sz)
+			ERROR_LOG(-1, "model read at %"PRIu64, e->offset);
+		h = hash_fnv1a(h, sz, stream_buffer_get(e->stm, NULL));
+	}
+
+	*pkey = h;
+end:
+	return R;
+}
+
+static
+void mlis_wcache_path(MLIS_Ctx* S, DynStr* out)
+{
+	const char *name = path_tail(S->c.path_model);
+	dstr_printf(*out, "%s/%.*s.%s.wcache.gguf", S->c.path_wcache,
+		(int)(path_extdot(name) - name), name,
+		ggml_type_name(S->ctx.c.wtype));
+}
+
+/* The cache of S->tstore must be cleared before, it may point to this data.
+ */
+static
+void mlis_wcache_close(MLIS_Ctx* S)
+{
+	tstore_free(&S->tstore_wc);
+	stream_close(&S->stm_wc, 0);
+	S->wc_n = 0;
+}
+
+/* Load the converted weights from the cache file, if it exists and it
+ * matches the model. Errors are not fatal, the weights are converted again.
+ */
+static
+int mlis_wcache_load(MLIS_Ctx* S)
+{
+	int R=1;
+	DynStr path=NULL;
+	char key[24];
+
+	mlis_wcache_close(S);
+
+	if (!S->wc_key) TRY( mlis_model_key(S, &S->wc_key) );
+
+	mlis_wcache_path(S, &path);
+	if (!file_exists(path)) {
+		log_debug("weights cache not found: '%s'", path);
+		R = 0;
+		goto end;
+	}
+
+	double t = timing_time();
+	TRY_LOG( stream_open_file(&S->stm_wc, path, SOF_READ | SOF_MMAP),
+		"could not open '%s'", path);
+	TRY( tstore_read(&S->tstore_wc, &S->stm_wc, NULL, NULL) );
+
+	sprintf(key, "%016"PRIx64, S->wc_key);
+	Any v = tstore_meta_get(&S->tstore_wc, "mlis.wcache.key");
+	if (!(v.t == ANY_T_STRING && !strcmp(v.p.cp, key))) {
+		log_info("Weights cache outdated: '%s'", path);
+		mlis_wcache_close(S);
+		R = 0;
+		goto end;
+	}
+
+	TRY( R = tstore_cache_read(&S->tstore, &S->tstore_wc) );
+	S->wc_n = R;
+
+	t = timing_time() - t;
+	log_info("Weights cache loaded: %u tensors {%.3fs}", S->wc_n, t);
+
+end:
+	if (R<0) {
+		log_warning("weights cache '%s' not used: %x", path, -R);
+		tstore_cache_clear(&S->tstore);
+		mlis_wcache_close(S);
+		R = 0;
+	}
+	dstr_free(path);
+	return R;
+}
+
+/* Write the cache file again if more weights were converted than loaded from
+ * it. Not with LoRA's, the converted weights would include them.
+ */
+static
+int mlis_wcache_save(MLIS_Ctx* S)
+{
+	int R=1, r;
+	DynStr path=NULL, tpath=NULL;
+	Stream stm={0};
+	TensorStore ts={ .ss=&S->ss };
+	char key[24];
+
+	if (dstr_empty(S->c.path_wcache) || vec_count(S->loras_merged)) return 0;
+
+	unsigned n=0;
+	vec_forp(TSTensorEntry, S->tstore.tensors, e, 0) {
+		vec_forp(TSTensorData, e->cache, d, 0)
+			if (d->dtype != e->dtype) { n++;  break; }
+	}
+	if (n <= S->wc_n) return 0;
+
+	if (!S->wc_key) TRY( mlis_model_key(S, &S->wc_key) );
+
+	double t = timing_time();
+	mlis_wcache_path(S, &path);
+	dstr_printf(tpath, "%s.tmp", path);
+	TRY_LOG( stream_open_file(&stm, tpath, SOF_CREATE),
+		"could not open '%s'", tpath);
+
+	sprintf(key, "%016"PRIx64, S->wc_key);
+	TRY( tstore_meta_adds(&ts, "mlis.wcache.key", key) );
+	TRY( tstore_meta_adds(&ts, "mlis.wcache.wtype",
+		ggml_type_name(S->ctx.c.wtype)) );
+
+	TRY( r = tstore_cache_write(&S->tstore, &ts, &stm, &ts_cls_gguf) );
+	TRY( stream_close(&stm, 0) );
+
+	// The previous file may be still mapped, this is fine on POSIX systems
+	if (rename(tpath, path) != 0)
+		ERROR_LOG(-1, "could not rename '%s'", tpath);
+	S->wc_n = n;
+
+	t = timing_time() - t;
+	log_info("Weights cache saved: %u tensors '%s' {%.3fs}", r, path, t);
+
+end:
+	if (R<0) {
+		log_warning("weights cache save: %x", -R);
+		stream_close(&stm, 0);
+		if (tpath) remove(tpath);
+		R = 0;
+	}
+	tstore_free(&ts);
+	dstr_free(tpath);
+	dstr_free(path);
+	return R;
+}
+
 int mlis_setup(MLIS_Ctx* S)
 {
 	if (S->signature != CTX_SIGNATURE) {
@@ -1269,6 +1592,11 @@ int mlis_setup(MLIS_Ctx* S)
 	}
 
 	if (!(S->rflags & MLIS_READY_MODEL)) {
+		mlctx_resident_clear(&S->ctx);
+		// Converted and LoRA weights are from the previous model
+		S->rflags &= ~MLIS_READY_WEIGHTS;
+		S->wc_key = 0;
+
 		// Model parameters header load
 		TRY( mlis_model_load(S) );
 
@@ -1278,24 +1606,29 @@ int mlis_setup(MLIS_Ctx* S)
 		S->rflags |= MLIS_READY_MODEL;
 	}
 	
-	if (!(S->rflags & MLIS_READY_LORAS)) {
+	if (!(S->rflags & MLIS_READY_WEIGHTS)) {
 		// Clear cache'd tensors that could have previous loras applied
 		tstore_cache_clear(&S->tstore);
+		mlctx_resident_clear(&S->ctx);
+		mlis_wcache_close(S);
+		mlis_loras_merged_clear(S);
 
-		// Load loras
-		if (vec_count(S->loras)) {
-			double t = timing_time();
-			vec_for(S->loras,i,0) {
-				TRY( mlis_lora_load_apply(S, S->loras[i].path, S->loras[i].mult) );
-			}
-			t = timing_time() - t;
-			log_info("LoRA's applied: %u {%.3fs}", vec_count(S->loras), t);
-		}
-		
+		if (!dstr_empty(S->c.path_wcache))
+			TRY( mlis_wcache_load(S) );
+
+		S->rflags |= MLIS_READY_WEIGHTS;
+		S->rflags &= ~MLIS_READY_LORAS;
+	}
+	
+	if (!(S->rflags & MLIS_READY_LORAS)) {
+		TRY( mlis_loras_setup(S) );
 		S->rflags |= MLIS_READY_LORAS;
 	}
 
 	ccFLAG_SET( S->ctx.c.flags, MLB_F_DUMP, S->c.dump_flags & MLIS_DUMP_GRAPH );
+	ccFLAG_SET( S->ctx.c.flags, MLB_F_PROFILE,
+		S->c.dump_flags & MLIS_DUMP_PROFILE );
+	ccFLAG_SET( S->ctx.c.flags, MLB_F_RESIDENT, S->c.flags & MLIS_CF_KEEP_WEIGHTS );
 
 end:
 	ERROR_HANDLE_END("mlis_setup")
@@ -1313,7 +1646,8 @@ int mlis_image_encode(MLIS_Ctx* S, const LocalTensor* image, LocalTensor* latent
 		TRY( sdtae_encode(&S->ctx, S->tae_p, image, latent) );
 	} else {
 		S->ctx.c.tprefix = "vae";
-		TRY( sdvae_encode(&S->ctx, S->vae_p, image, latent, S->c.vae_tile) );
+		TRY( sdvae_encode(&S->ctx, S->vae_p, image, latent, S->c.vae_tile,
+			S->c.vae_tile_workers) );
 		
 		// Sample if needed
 		if (latent->n[2] == S->vae_p->d_embed*2)
@@ -1330,6 +1664,25 @@ end:
 	ERROR_HANDLE_END("mlis_image_encode")
 }
 
+// Converts a band of decoded rows and passes it to the user sink
+static
+int mlis_image_sink_band(void* user, const LocalTensor* band, int y, int h)
+{
+	int R=1;
+	MLIS_Ctx *S = user;
+
+	if (ltensor_finite_check(band) < 0 )
+		ERROR_LOG(MLIS_E_NAN, "NaN found in decoded image");
+
+	for (int i=0; i<band->n[3]; ++i) {
+		mlis_tensor_to_image(band, &S->imgex, i);
+		TRY( S->sink(S->sink_ud, S, &S->imgex, i, y, h) );
+	}
+
+end:
+	return R;
+}
+
 int mlis_image_decode(MLIS_Ctx* S, const LocalTensor* latent, LocalTensor* image,
 	int flags)
 {
@@ -1337,18 +1690,24 @@ int mlis_image_decode(MLIS_Ctx* S, const LocalTensor* latent, LocalTensor* image
 
 	TRY( mlis_setup(S) );
 	
+	const VaeRowSink sink = { mlis_image_sink_band, S };
+	image->flags &= ~LT_F_READY;
+
 	if (S->c.flags & MLIS_CF_USE_TAE) {
 		S->ctx.c.tprefix = "tae";
 		TRY( sdtae_decode(&S->ctx, S->tae_p, latent, image) );
+		if (S->sink) TRY( mlis_image_sink_band(S, image, 0, image->n[1]) );
 	} else {
 		S->ctx.c.tprefix = "vae";
-		TRY( sdvae_decode(&S->ctx, S->vae_p, latent, image, S->c.vae_tile) );
+		TRY( sdvae_decode(&S->ctx, S->vae_p, latent, image, S->c.vae_tile,
+			S->c.vae_tile_workers, S->sink ? &sink : NULL) );
 	}
 
-	if (ltensor_finite_check(image) < 0 )
-		ERROR_LOG(MLIS_E_NAN, "NaN found in encoded latent");
-	
-	image->flags |= LT_F_READY;
+	if (!S->sink) {
+		if (ltensor_finite_check(image) < 0 )
+			ERROR_LOG(MLIS_E_NAN, "NaN found in decoded image");
+		image->flags |= LT_F_READY;
+	}
 	
 	//TODO: call for each tile?
 	TRYR( mlis_callback(S, MLIS_STAGE_IMAGE_DECODE, 1, 1) );
@@ -1388,7 +1747,7 @@ int mlis_prompt_text_tokenize(MLIS_Ctx* S, const PromptText* prompt,
 
 	vec_forp(struct PromptTextChunk, prompt->chunks, p, 0) {
 		unsigned n = vec_count(*ptokvec);
-		TRY( clip_tokenize(clip_p, p->text, ptokvec) );
+		TRY( clip_tokenize(clip_p, p->text, ptokvec, &S->tokc) );
 
 		vec_resize(*pwvec, vec_count(*ptokvec));
 		vec_for(*pwvec, i, n) (*pwvec)[i] = p->w;  // Weights
@@ -1423,7 +1782,8 @@ end:
 static
 int mlis_clip_tokens_encode(MLIS_Ctx* S,
 	unsigned n_token, const int32_t* tokens, const float* weights,
-	LocalTensor* embed, LocalTensor* feat, MLIS_SubModel model, int flags)
+	LocalTensor* embed, LocalTensor* feat, MLIS_SubModel model, int flags,
+	int clip_skip)
 {
 	int R=1;
 
@@ -1451,7 +1811,7 @@ int mlis_clip_tokens_encode(MLIS_Ctx* S,
 	bool b_norm = !(flags & MLIS_CTEF_NO_NORM);
 	S->ctx.c.tprefix = tprefix;
 	TRY( clip_text_encode(&S->ctx, clip_p, n_token,
-		tokens, embed, feat, S->c.clip_skip, b_norm) );
+		tokens, embed, feat, clip_skip, b_norm) );
 	
 	// Apply token weights
 	if (weights && embed) {
@@ -1475,7 +1835,11 @@ int mlis_clip_text_encode(MLIS_Ctx* S, const char* text,
 	int n;
 	int32_t *tokens;
 	TRY( n = mlis_text_tokenize(S, text, &tokens, model) );
-	TRY( mlis_clip_tokens_encode(S, n, tokens, NULL, embed, feat, model, flags) );
+	// With the features, the embeddings are also from the last layer
+	int clip_skip = S->c.clip_skip;
+	if (feat) { clip_skip = -1;  flags &= ~MLIS_CTEF_NO_NORM; }
+	TRY( mlis_clip_tokens_encode(S, n, tokens, NULL, embed, feat, model, flags,
+		clip_skip) );
 
 end:
 	ERROR_HANDLE_END("mlis_clip_text_encode")
@@ -1515,11 +1879,12 @@ int mlis_text_cond_encode(MLIS_Ctx* S, const PromptText* prompt,
 		MLIS_SUBMODEL_CLIP) );
 
 	TRY( mlis_clip_tokens_encode(S, n_token, tokens, weights, cond, NULL,
-		MLIS_SUBMODEL_CLIP, cte_flags) );
+		MLIS_SUBMODEL_CLIP, cte_flags, S->c.clip_skip) );
 
 	if (S->unet_p->cond_label) {
-		TRY( mlis_clip_tokens_encode(S, n_token, tokens, weights, &tmpt, NULL, 
-			MLIS_SUBMODEL_CLIP2, cte_flags) );
+		// Embeddings and label features in one computation
+		TRY( mlis_clip_tokens_encode(S, n_token, tokens, weights, &tmpt, label,
+			MLIS_SUBMODEL_CLIP2, cte_flags, S->c.clip_skip) );
 
 		// Concatenate both text embeddings
 		//TODO: create function
@@ -1537,10 +1902,6 @@ int mlis_text_cond_encode(MLIS_Ctx* S, const PromptText* prompt,
 			ARRAY_COPY(cond->d+n_emb*i1+n_emb1, tmpt.d+n_emb2*i1, n_emb2);
 			ARRAY_COPY(cond->d+n_emb*i1, cond->d+n_emb1*i1, n_emb1);
 		}
-		
-		//TODO: no need to reprocess from scratch...
-		TRY( mlis_clip_tokens_encode(S, n_token, tokens, NULL, NULL, label, 
-			MLIS_SUBMODEL_CLIP2, 0) );
 
 		// Complete label embedding
 		assert( label->n[0]==n_emb2 &&
@@ -1565,7 +1926,9 @@ end:
 struct dxdt_args {
 	MLIS_Ctx *S;
 	UnetState *unet;
-	LocalTensor *cond, *label, *uncond, *unlabel, *tmpt;
+	LocalTensor *cond, *label, *uncond, *unlabel, *tmpt, *tmpx;
+	// cond and uncond in the same batch: cond/label contain both
+	bool cfg_batch;
 };
 
 static
@@ -1574,13 +1937,32 @@ int mlis_denoise_dxdt(Solver* sol, float t, const LocalTensor* x,
 {
 	if (!(t >= 0)) return 0;
 	struct dxdt_args *A = sol->user;
+	float f = A->S->c.cfg_scale;
 	
+	if (A->cfg_batch) {
+		// Conditional and unconditional denoising in one computation
+		size_t n = ltensor_nelements(x);
+		ltensor_resize(A->tmpx, x->n[0], x->n[1], x->n[2], x->n[3]*2);
+		ARRAY_COPY(A->tmpx->d    , x->d, n);
+		ARRAY_COPY(A->tmpx->d + n, x->d, n);
+		
+		TRYR( unet_denoise_run(A->unet, A->tmpx, A->cond, A->label, t,
+			A->tmpt) );
+		
+		// Views of each half of the output
+		LocalTensor dc = *x, du = *x;
+		dc.flags = du.flags = 0;
+		dc.d = A->tmpt->d;
+		du.d = A->tmpt->d + n;
+		ltensor_lincomb(dx, f, &dc, 1-f, &du);
+		return 1;
+	}
+
 	TRYR( unet_denoise_run(A->unet, x, A->cond, A->label, t, dx) );
 	
-	float f = A->S->c.cfg_scale;
 	if (f > 1) {
 		TRYR( unet_denoise_run(A->unet, x, A->uncond, A->unlabel, t, A->tmpt) );
-		ltensor_for(*dx,i,0) dx->d[i] = dx->d[i]*f + A->tmpt->d[i]*(1-f);
+		ltensor_lincomb(dx, f, dx, 1-f, A->tmpt);
 	}
 	
 	return 1;
@@ -1590,9 +1972,10 @@ int mlis_denoise_dxdt(Solver* sol, float t, const LocalTensor* x,
  * Usually saved along with generated images.
  */
 static
-void mlis_infotext_update(MLIS_Ctx* S, unsigned w, unsigned h)
+void mlis_infotext_update(MLIS_Ctx* S, unsigned w, unsigned h, int idx)
 {
-	DynStr *out = &S->infotext;
+	assert( idx < vec_count(S->infotext) );
+	DynStr *out = &S->infotext[idx];
 
 	dstr_resize(*out, 0);
 
@@ -1600,7 +1983,7 @@ void mlis_infotext_update(MLIS_Ctx* S, unsigned w, unsigned h)
 	dstr_printfa(*out, "%s\n", S->c.prompt_raw);
 	if (!dstr_empty(S->c.nprompt_raw))
 		dstr_printfa(*out, "Negative prompt: %s\n", S->c.nprompt_raw);
-	dstr_printfa(*out, "Seed: %"PRIu64, g_rng.seed);
+	dstr_printfa(*out, "Seed: %"PRIu64, g_rng.seed + idx);
 	dstr_printfa(*out, ", Sampler: %s", mlis_method_str(S->sampler.c.method));
 	if (S->sampler.c.s_ancestral == 1)
 		dstr_printfa(*out, " ancestral");
@@ -1635,10 +2018,7 @@ int mlis_generate(MLIS_Ctx* S)
 {
 	ERROR_HANDLE_BEGIN
 	UnetState unet={0};
-	LocalTensor tmpt={0};
-
-	if (S->c.n_batch > 1)
-		ERROR_LOG(MLIS_E_UNKNOWN, "Batch size > 1 not supported yet.");
+	LocalTensor tmpt={0}, tmpx={0}, cfg_cond={0}, cfg_label={0};
 
 	TRY( mlis_setup(S) );
 	
@@ -1647,7 +2027,8 @@ int mlis_generate(MLIS_Ctx* S)
 	
 	int vae_f = S->vae_p->f_down,
 		w = S->c.width  / vae_f,
-		h = S->c.height / vae_f;
+		h = S->c.height / vae_f,
+		n_batch = S->c.n_batch > 0 ? S->c.n_batch : 1;
 
 	// Encode initial image (img2img)
 	if (S->c.tuflags & MLIS_TUF_IMAGE)
@@ -1662,15 +2043,20 @@ int mlis_generate(MLIS_Ctx* S)
 		w = S->latent.n[0];
 		h = S->latent.n[1];
 		log_debug3_ltensor(&S->latent, "input latent");
+		// Same initial latent for all the batch
+		if (mlis_tensor_batch_repeat(&S->latent, n_batch) < 0)
+			ERROR_LOG(MLIS_E_UNKNOWN, "input latent batch size (%d) does not "
+				"match the batch size (%d)", S->latent.n[3], n_batch);
 	}
 	else
 	{
 		log_debug("Empty initial latent");
-		ltensor_resize(&S->latent, w, h, S->unet_p->n_ch_in, 1);
+		ltensor_resize(&S->latent, w, h, S->unet_p->n_ch_in, n_batch);
 		memset(S->latent.d, 0, ltensor_nbytes(&S->latent));
 	}
 	int w_img = w * vae_f, h_img = h * vae_f;
 	log_info("Output size: %ux%u", w_img, h_img);
+	if (n_batch > 1) log_info("Batch size: %d", n_batch);
 
 	// Image mask -> latent mask
 	if (S->c.tuflags & MLIS_TUF_MASK)
@@ -1720,9 +2106,24 @@ int mlis_generate(MLIS_Ctx* S)
 	S->sampler.nfe_per_dxdt = (S->c.cfg_scale > 1) ? 2 : 1;
 	S->sampler.c.lmask = ltensor_good(&S->lmask) ? &S->lmask : NULL;
 
-	struct dxdt_args A = { .S=S, .unet=&unet, .tmpt=&tmpt,
+	struct dxdt_args A = { .S=S, .unet=&unet, .tmpt=&tmpt, .tmpx=&tmpx,
 		.cond=&S->cond, .uncond=&S->ncond,
 		.label=&S->label, .unlabel=&S->nlabel };
+
+	// CFG: conditional and unconditional denoising in the same batch.
+	// Not with unet split, because it doubles the compute memory.
+	int n_batch_unet = n_batch;
+	if (S->c.cfg_scale > 1 && !(S->c.flags & MLIS_CF_UNET_SPLIT) &&
+		ltensor_shape_equal(&S->cond, &S->ncond) && S->cond.n[3] == 1)
+	{
+		mlis_tensor_batch_cat(&cfg_cond, &S->cond, &S->ncond, n_batch);
+		if (ltensor_good(&S->label))
+			mlis_tensor_batch_cat(&cfg_label, &S->label, &S->nlabel, n_batch);
+		A.cond  = &cfg_cond;
+		A.label = &cfg_label;
+		A.cfg_batch = true;
+		n_batch_unet *= 2;
+	}
 	S->sampler.solver.dxdt = mlis_denoise_dxdt;
 	S->sampler.solver.user = &A;
 	
@@ -1730,8 +2131,11 @@ int mlis_generate(MLIS_Ctx* S)
 	
 	// Prepare computation
 	S->ctx.c.tprefix = "unet";
-	TRY( unet_denoise_init(&unet, &S->ctx, S->unet_p, w, h,
-		S->c.flags & MLIS_CF_UNET_SPLIT) );
+	int split = !(S->c.flags & MLIS_CF_UNET_SPLIT) ? UNET_SPLIT_NONE :
+		(S->c.flags & MLIS_CF_UNET_SPLIT_KEEP) ? UNET_SPLIT_KEEP :
+		UNET_SPLIT_STEP;
+	TRY( unet_denoise_init(&unet, &S->ctx, S->unet_p, w, h, n_batch_unet,
+		split, S->c.flags & MLIS_CF_UNET_KV_PRE) );
 	
 	log_info("Generating "
 		"(solver: %s, sched: %s, ancestral: %g, snoise: %g, cfg-s: %g, steps: %d"
@@ -1744,7 +2148,7 @@ int mlis_generate(MLIS_Ctx* S)
 	// Denoising / generation / sampling
 	int r;
 	while ((r = dnsamp_step(&S->sampler, &S->latent)) > 0) {
-		S->prg.nfe = unet.nfe;
+		S->prg.nfe = unet.nfe * (A.cfg_batch ? 2 : 1);
 		TRY( mlis_callback(S, MLIS_STAGE_DENOISE, S->sampler.i_step,
 			S->sampler.n_step) );
 	}
@@ -1752,36 +2156,49 @@ int mlis_generate(MLIS_Ctx* S)
 	
 	mlctx_end(&S->ctx);  
 
+	// One information text for each image
+	// Before decoding, so that it is available to the image sink
+	vec_for(S->infotext,i,0) dstr_free(S->infotext[i]);
+	vec_resize_zero(S->infotext, n_batch);
+	for (int i=0; i<n_batch; ++i)
+		mlis_infotext_update(S, w_img, h_img, i);
+
 	// Decode
 	if (!(S->c.flags & MLIS_CF_NO_DECODE))
 	{
 		TRY( mlis_image_decode(S, &S->latent, &S->image, 0) );
 	}
 
-	//
-	mlis_infotext_update(S, w_img, h_img);
-
 	//
 	mlis_prompt_clear(S);
 
 	log_info("Generation done {%.3fs}", timing_time() - t_start);
 
+	TRY( mlis_wcache_save(S) );
+	if (S->ctx.c.cache_n)
+		log_debug("graph cache hits:%u misses:%u",
+			S->ctx.info.n_cache_hit, S->ctx.info.n_cache_miss);
+
 end:
+	ltensor_free(&cfg_label);
+	ltensor_free(&cfg_cond);
+	ltensor_free(&tmpx);
 	ltensor_free(&tmpt);
+	unet_denoise_free(&unet);
 	mlctx_end(&S->ctx);
 	ERROR_HANDLE_END("mlis_generate")
 }
 
 MLIS_Image* mlis_image_get(MLIS_Ctx* S, int idx)
 {
-	if (idx != 0) {
-		dstr_copyz(S->errstr, "only image idx=0 supported");
+	if (!(S->image.flags & LT_F_READY)) {
+		dstr_copyz(S->errstr, "image not ready");
 		mlis_error_handle(S, MLIS_E_UNKNOWN);
 		return NULL;
 	}
 
-	if (!(S->image.flags & LT_F_READY)) {
-		dstr_copyz(S->errstr, "image not ready");
+	if (!(0 <= idx && idx < S->image.n[3])) {
+		dstr_printf(S->errstr, "invalid image index %d", idx);
 		mlis_error_handle(S, MLIS_E_UNKNOWN);
 		return NULL;
 	}
@@ -1793,11 +2210,11 @@ MLIS_Image* mlis_image_get(MLIS_Ctx* S, int idx)
 
 const char* mlis_infotext_get(MLIS_Ctx* S, int idx)
 {
-	if (idx != 0) {
-		dstr_copyz(S->errstr, "only image idx=0 supported");
+	if (!(0 <= idx && idx < vec_count(S->infotext))) {
+		dstr_printf(S->errstr, "invalid image index %d", idx);
 		mlis_error_handle(S, MLIS_E_UNKNOWN);
 		return NULL;
 	}
 
-	return S->infotext;
+	return S->infotext[idx];
 }
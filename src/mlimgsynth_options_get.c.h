@@ -15,4 +15,10 @@ OPTION( PROMPT ) {
 OPTION( NPROMPT ) {
 	ARG_STR( S->c.nprompt_raw );
 }
+OPTION( BATCH_SIZE ) {
+	ARG_C( S->c.n_batch > 0 ? S->c.n_batch : 1, int );
+}
+OPTION( VAE_TILE ) {
+	ARG_C( S->c.vae_tile, int );
+}
 //TODO: complete
@@ -170,21 +170,65 @@ OPTION( VAE_TILE ) {
 	ARG_INT(i, 0, 65535, 0)
 	S->c.vae_tile = i;
 }
+OPTION( VAE_TILE_WORKERS ) {
+	ARG_INT(i, 0, 256, 0)
+	S->c.vae_tile_workers = i;
+}
 OPTION( UNET_SPLIT ) {
+#ifdef ARG_IS_STR
+	int b;
+	if (parse_bool(strsl_fromz(vcur), &b) > 0) {
+		ccFLAG_SET(S->c.flags, MLIS_CF_UNET_SPLIT, b);
+		S->c.flags &= ~MLIS_CF_UNET_SPLIT_KEEP;
+		goto done;
+	}
+#endif
+	ARG_INT(i, 0, 2, 0)
+	ccFLAG_SET(S->c.flags, MLIS_CF_UNET_SPLIT, i > 0);
+	ccFLAG_SET(S->c.flags, MLIS_CF_UNET_SPLIT_KEEP, i == 2);
+}
+OPTION( UNET_KV_PRE ) {
+	ARG_BOOL(en)
+	ccFLAG_SET(S->c.flags, MLIS_CF_UNET_KV_PRE, en);
+}
+OPTION( ATTN_CHUNK ) {
+	ARG_INT(i, 0, 1<<24, 0)
+	S->ctx.c.attn_chunk = i;
+	mlctx_cache_clear(&S->ctx);  //the graphs change
+}
+OPTION( WEIGHT_CACHE ) {
+	ARG_STR_NO_PARSE(path, 0, 65535)
+	dstr_copy(S->c.path_wcache, path.s, path.b);
+	S->rflags &= ~MLIS_READY_WEIGHTS;  //reload the cache
+}
+OPTION( LORA_RUNTIME ) {
 	ARG_BOOL(en)
-	ccFLAG_SET(S->c.flags, MLIS_CF_UNET_SPLIT, en);
+	ccFLAG_SET(S->c.flags, MLIS_CF_LORA_RUNTIME, en);
+	S->rflags &= ~MLIS_READY_LORAS;
+}
+OPTION( GRAPH_CACHE ) {
+	ARG_INT(i, 0, 64, 0)
+	S->ctx.c.cache_n = i;
+	mlctx_cache_clear(&S->ctx);
+}
+OPTION( KEEP_WEIGHTS ) {
+	ARG_BOOL(en)
+	ccFLAG_SET(S->c.flags, MLIS_CF_KEEP_WEIGHTS, en);
+	if (!en) mlctx_resident_clear(&S->ctx);
 }
 OPTION( WEIGHT_TYPE ) {
+	// Validated before clearing the weights converted before
 #ifdef ARG_IS_STR
-	int id = tstore_dtype_fromz(vcur);
-	id = tstore_dtype_to_ggml(id);
-	if (id >= 0) {
-		S->ctx.c.wtype = id;
-		S->c.flags |= MLIS_CF_WEIGHT_TYPE_SET;
-		goto done;
+	int i = tstore_dtype_to_ggml( tstore_dtype_fromz(vcur) );
+	if (i < 0) {
+		ARG_INT(j, -1, GGML_TYPE_COUNT-1, 0)
+		i = j;
 	}
-#endif
+#else
 	ARG_INT(i, -1, GGML_TYPE_COUNT-1, 0)
+#endif
+	mlctx_resident_clear(&S->ctx);
+	S->rflags &= ~MLIS_READY_WEIGHTS;
 	if (i == -1) {  //unset
 		S->ctx.c.wtype = GGML_TYPE_F16;
 		S->c.flags &= ~MLIS_CF_WEIGHT_TYPE_SET;
@@ -208,6 +252,12 @@ OPTION( CALLBACK ) {
 	S->callback = func;
 	S->callback_ud = user;
 }
+OPTION( IMAGE_SINK ) {
+	ARG_C(func, MLIS_ImageSink)
+	ARG_C(user, void*)
+	S->sink = func;
+	S->sink_ud = user;
+}
 OPTION( ERROR_HANDLER ) {
 	ARG_C(func, MLIS_ErrorHandler)
 	ARG_C(user, void*)
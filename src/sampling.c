@@ -95,25 +95,63 @@ end:
 	return R;
 }
 
+typedef struct {
+	float *x;
+	const float *x0, *m;
+	size_t n_plane;
+} MaskApplyOp;
+
+static
+void dnsamp_mask_apply_op(void* user, size_t i, size_t e)
+{
+	const MaskApplyOp *A = user;
+	while (i < e) {  //the mask is the same for each channel & batch
+		size_t j = i % A->n_plane,
+		       n = ccMIN(e - i, A->n_plane - j);
+		float *x = A->x + i;
+		const float *x0 = A->x0 + i, *m = A->m + j;
+		for (size_t k=0; k<n; ++k) x[k] = x0[k] * m[k] + x[k] * (1-m[k]);
+		i += n;
+	}
+}
+
 void dnsamp_mask_apply(DenoiseSampler* S, LocalTensor* x)
 {
-	int n0 = x->n[0], n1 = x->n[1], n2 = x->n[2],
-		s1 = n0, s2 = n0*n1;
-	assert( ltensor_shape_check(S->c.lmask, n0, n1, 1, 1) );
-	for (int i2=0; i2<n2; ++i2)
-	for (int i1=0; i1<n1; ++i1)
-	for (int i0=0; i0<n0; ++i0) {
-		float m = S->c.lmask->d[i0 +i1*s1];
-		int i = i0 +i1*s1 +i2*s2;
-		x->d[i] = S->x0.d[i] * m + x->d[i] * (1-m);
+	assert( ltensor_shape_check(S->c.lmask, x->n[0], x->n[1], 1, 1) );
+	MaskApplyOp A = { x->d, S->x0.d, S->c.lmask->d, x->n[0]*x->n[1] };
+	ltensor_op_run(ltensor_nelements(x), dnsamp_mask_apply_op, &A);
+}
+
+typedef struct {
+	float *out;
+	RngPhilox rng;
+	size_t n_img;
+} NoiseOp;
+
+static
+void dnsamp_noise_op(void* user, size_t i, size_t e)
+{
+	const NoiseOp *A = user;
+	while (i < e) {
+		size_t b = i / A->n_img,
+		       j = i % A->n_img,
+		       n = ccMIN(e - i, A->n_img - j);
+		RngPhilox rng = { A->rng.seed + b, A->rng.offset };
+		rng_philox_randn_at(&rng, j, n, A->out + i);
+		i += n;
 	}
 }
 
 void dnsamp_noise_add(DenoiseSampler* S, LocalTensor* x, float sigma)
 {
 	ltensor_resize_like(&S->noise, x);
-	rng_randn(ltensor_nelements(&S->noise), S->noise.d);
-	ltensor_for(*x,i,0) x->d[i] += S->noise.d[i] * sigma;
+	// Each image in the batch uses its own seed (seed + index).
+	// The first one is the same as generating without batch.
+	// The slices are generated in parallel, same result as in sequence.
+	NoiseOp A = { S->noise.d, g_rng, ltensor_nelements(x) / x->n[3] };
+	ltensor_op_run(ltensor_nelements(x), dnsamp_noise_op, &A);
+	g_rng.offset++;
+	ltensor_lincomb(x, 1, x, sigma, &S->noise);
 }
 
 int dnsamp_step(DenoiseSampler* S, LocalTensor* x)
@@ -83,7 +83,7 @@ int solver_euler_step(Solver* S, float t, LocalTensor* x)
 {
 	float dt = t - S->t;
 	TRYR( solver_dxdt(S, S->t, x, &S->dx) );
-	ltensor_for(*x,i,0) x->d[i] += S->dx.d[i] * dt;
+	ltensor_lincomb(x, 1, x, dt, &S->dx);
 	return 1;
 }
 
@@ -104,15 +104,14 @@ int solver_heun_step(Solver* S, float t, LocalTensor* x)
 	LocalTensor *d1 = solver_tmp_get_resize_like(S, x);
 
 	TRYR( solver_dxdt(S, S->t, x, &S->dx) );
-	ltensor_for(*x,i,0) x1->d[i] = x->d[i] + S->dx.d[i] * dt;
+	ltensor_lincomb(x1, 1, x, dt, &S->dx);
 
 	if (!(t > 0)) {  //last step: just euler
-		ltensor_for(*x,i,0) x->d[i] = x1->d[i];
+		ltensor_copy(x, x1);
 	}
 	else {  //2nd order correction
 		TRYR( solver_dxdt(S, t, x1, d1) );
-		ltensor_for(*x,i,0)
-			x->d[i] += (S->dx.d[i] + d1->d[i]) * 0.5 * dt;
+		ltensor_lincomb3(x, 1, x, 0.5*dt, &S->dx, 0.5*dt, d1);
 	}
 	
 	return 1;
@@ -134,6 +133,27 @@ dx2_i = (dx_i - dx_{i-1}) / dt_{i-1}
 dx3_i = (dx2_i - dx2_{i-1}) / dt_{i-1}
       = (dx_i - dx_{i-1}) / dt_{i-1}^2 - (dx_{i-1} - dx_{i-2}) / (dt_{i-1} dt_{i-2})
  */
+typedef struct {
+	float *x, *dp1, *dp2;
+	const float *dx;
+	float dt, idtp, f2, f3;
+} Taylor3Op;
+
+static
+void solver_taylor3_op(void* user, size_t i0, size_t i1)
+{
+	const Taylor3Op *A = user;
+	float *x=A->x, *dp1=A->dp1, *dp2=A->dp2;
+	const float *dx=A->dx;
+	for (size_t i=i0; i<i1; ++i) {
+		float d2 = (dx[i] - dp1[i]) * A->idtp,
+			  d3 = (d2 - dp2[i]) * A->idtp;
+		x[i] = (x[i] + dx[i] * A->dt) + (d2 * A->f2 + d3 * A->f3);
+		dp1[i] = dx[i];
+		dp2[i] = d2;
+	}
+}
+
 int solver_taylor3_step(Solver* S, float t, LocalTensor* x)
 {
 	float dt = t - S->t;
@@ -146,19 +166,13 @@ int solver_taylor3_step(Solver* S, float t, LocalTensor* x)
 		  *dp2 = lt_dp2->d;
 
 	TRYR( solver_dxdt(S, S->t, x, &S->dx) );
-	ltensor_for(*x,i,0) x->d[i] += S->dx.d[i] * dt;
 	
-	// 2nd and 3nd order corrections
+	// Euler plus 2nd and 3nd order corrections
 	float idtp = S->i_step >= 1 ? 1 / dt_prev[0] : 0,
 	      f2 = S->i_step >= 1 ? dt*dt/2 : 0,
 		  f3 = S->i_step >= 2 ? dt*dt*dt/6 : 0;
-	ltensor_for(*x,i,0) {
-		float d2 = (S->dx.d[i] - dp1[i]) * idtp,
-			  d3 = (d2 - dp2[i]) * idtp;
-		x->d[i] += d2 * f2 + d3 * f3;
-		dp1[i] = S->dx.d[i];
-		dp2[i] = d2;
-	}
+	Taylor3Op A = { x->d, dp1, dp2, S->dx.d, dt, idtp, f2, f3 };
+	ltensor_op_run(ltensor_nelements(x), solver_taylor3_op, &A);
 	
 	dt_prev[0] = dt;
 	return 1;
@@ -204,6 +218,27 @@ x_{i+1} = a_i x_i - b_i D_i
 if c_i == 0:
 	x_{i+1} = x_i + (sigma_{i+1} - sigma_i) dx_i   (Euler)
  */
+typedef struct {
+	float *x, *dprev;
+	const float *dx;
+	float a, c, sigma;
+} Dpmpp2mOp;
+
+static
+void solver_dpmpp2m_op(void* user, size_t i0, size_t i1)
+{
+	const Dpmpp2mOp *A = user;
+	float *x=A->x, *dprev=A->dprev, a=A->a, c=A->c, sigma=A->sigma;
+	const float *dx=A->dx;
+	for (size_t i=i0; i<i1; ++i) {
+		float d0 = x[i] - sigma * dx[i],
+		      d1 = dprev[i],
+		      d  = (1+c) * d0 - c * d1;
+		x[i] = a * x[i] + (1-a) * d;
+		dprev[i] = d0;
+	}
+}
+
 int solver_dpmpp2m_step(Solver* S, float t, LocalTensor* x)
 {
 	LocalTensor *vars = solver_tmp_get_resize(S, 1,1,1,1);
@@ -218,13 +253,8 @@ int solver_dpmpp2m_step(Solver* S, float t, LocalTensor* x)
 		c = 0;
 
 	TRYR( solver_dxdt(S, S->t, x, &S->dx) );
-	ltensor_for(*x,i,0) {
-		float d0 = x->d[i] - S->t * S->dx.d[i],
-		      d1 = dprev->d[i],
-		      d  = (1+c) * d0 - c * d1;
-		x->d[i] = a * x->d[i] + (1-a) * d;
-		dprev->d[i] = d0;
-	}
+	Dpmpp2mOp A = { x->d, dprev->d, S->dx.d, a, c, S->t };
+	ltensor_op_run(ltensor_nelements(x), solver_dpmpp2m_op, &A);
 
 	vars->d[0] = h;
 	return 1;
@@ -270,20 +300,18 @@ int solver_dpmpp2s_step(Solver* S, float t, LocalTensor* x)
 
 	if (!(t > 0)) {  //last step: just euler
 		float dt = t - S->t;
-		ltensor_for(*x,i,0) x->d[i] += S->dx.d[i] * dt;
+		ltensor_lincomb(x, 1, x, dt, &S->dx);
 	}
 	else {
 		float t1 = sqrt(t * S->t),
 			  dt1 = t1 - S->t,
 			  a = t / S->t;
 
-		ltensor_for(*x,i,0) x1->d[i] = x->d[i] + S->dx.d[i] * dt1;
+		ltensor_lincomb(x1, 1, x, dt1, &S->dx);
 	
 		TRYR( solver_dxdt(S, t1, x1, dx1) );
-		ltensor_for(*x,i,0) {
-			float d = x1->d[i] - t1 * dx1->d[i];
-			x->d[i] = a * x->d[i] + (1-a) * d;
-		}
+		// x = a x + (1-a) (x1 - t1 dx1)
+		ltensor_lincomb3(x, a, x, 1-a, x1, -(1-a)*t1, dx1);
 	}
 
 	return 1;
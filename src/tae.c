@@ -105,8 +105,10 @@ int sdtae_encode(MLCtx* C, const SdTaeParams* P,
 	
 	MLTensor *input = mlctx_input_new(C, "img", GGML_TYPE_F32,
 		LT_SHAPE_UNPACK(*img) );
-	MLTensor *output = mlb_sdtae_encoder(C, input, P);
-	mlctx_tensor_add(C, "encoder.layers", output);
+	if (!mlctx_cache_get(C, 0)) {
+		MLTensor *output = mlb_sdtae_encoder(C, input, P);
+		mlctx_tensor_add(C, "encoder.layers", output);
+	}
 
 	TRY( mlctx_run(C, latent, img) );
 
@@ -119,14 +121,16 @@ int sdtae_decode(MLCtx* C, const SdTaeParams* P,
 {
 	int R=1;
 
-	TRY( ltensor_shape_check_log(latent, "latent", 0,0,4,1) );
+	TRY( ltensor_shape_check_log(latent, "latent", 0,0,4,0) );
 	
 	mlctx_begin(C, "TAE decode");
 	
 	MLTensor *input = mlctx_input_new(C, "latent", GGML_TYPE_F32,
 		LT_SHAPE_UNPACK(*latent));
-	MLTensor *output = mlb_sdtae_decoder(C, input, P);
-	mlctx_tensor_add(C, "decoder.layers", output);
+	if (!mlctx_cache_get(C, 0)) {
+		MLTensor *output = mlb_sdtae_decoder(C, input, P);
+		mlctx_tensor_add(C, "decoder.layers", output);
+	}
 
 	TRY( mlctx_run(C, img, latent) );
 
@@ -2,6 +2,7 @@
  * SPDX-License-Identifier: MIT
  */
 #include "tensor_name_conv.h"
+#include "ccommon/logging.h"
 
 static inline
 int char_sep_is(char c) {
@@ -322,3 +323,96 @@ int tnconv_sd(StrSlice name, DynStr *out)
 	if (R > 0) dstr_append(*out, name.s, name.b);  // Copy tail
 	return R;
 }
+
+static
+int open_clip_attn_conv(TensorStore* ts, const TSTensorEntry *e, const char* name)
+{
+	TSTensorEntry new={0};
+	DynStr tmps = dstr_stack(128);
+	StrSlice ss = strsl_fromz(name);
+
+	const char *type;
+	if (strsl_suffixz_trim(&ss, "in_proj_bias")) type = "bias";
+	else if (strsl_suffixz_trim(&ss, "in_proj_weight")) type = "weight";
+	else return 0;
+
+	unsigned idim = e->shape[1] == 1 ? 0 : 1;
+
+	if (!(e->shape[idim] % 3 == 0)) {
+		log_error("invalid open_clip tensor '%s'", name);
+		return -1;
+	}
+
+	new = *e;
+	new.shape[idim] /= 3;
+	new.size /= 3;
+	
+	dstr_copy(tmps, ss.s, ss.b);
+	dstr_appendz(tmps, "q_proj.");
+	dstr_appendz(tmps, type);
+	tstore_tensor_add(ts, tmps, &new);
+	new.offset += new.size;
+	
+	dstr_copy(tmps, ss.s, ss.b);
+	dstr_appendz(tmps, "k_proj.");
+	dstr_appendz(tmps, type);
+	tstore_tensor_add(ts, tmps, &new);
+	new.offset += new.size;
+	
+	dstr_copy(tmps, ss.s, ss.b);
+	dstr_appendz(tmps, "v_proj.");
+	dstr_appendz(tmps, type);
+	tstore_tensor_add(ts, tmps, &new);
+
+	return 1;
+}
+
+int tnconv_tstore_cb(void* user, TensorStore* ts, TSTensorEntry* te,
+	DynStr* pname)
+{
+	int r;
+	DynStr newname = dstr_stack(128);
+
+	// Compiled model (tstore-util compile)
+	if (tstore_meta_get(ts, TNCONV_META_NAMES).t) return 1;
+
+	// Rename tensors to uniform names
+	TRYR( r = tnconv_sd(strsl_fromd(*pname), &newname) );
+	if (r == 0) {  //unused
+		log_debug2("unused tensor '%s'", *pname);
+		return 0;
+	}
+
+	if (r == TNCONV_R_QKV_PROJ) {
+		// Convert from openclip attention projection in one tensor
+		// to three tensors.
+		TRYR( open_clip_attn_conv(ts, te, newname) );
+		return 0;  //do not save the original tensor
+	}
+
+	dstr_copyd(*pname, newname);
+	return 1;
+}
+
+// Suffixes of the linear layers weights (mlb_nn_linear)
+static const char * g_tnconv_linear[] = {
+	"_proj.weight",  //q/k/v/out_proj (attention), emb_proj (resnet)
+	".proj.weight",  //GEGLU
+	".net.2.weight",  //feed forward
+	".fc1.weight", ".fc2.weight",  //clip mlp
+	"time_embed.0.weight", "time_embed.2.weight",
+	"label_embed.0.weight", "label_embed.2.weight",
+	"embed.token.weight",
+};
+
+int tnconv_param_kind(StrSlice name, unsigned n_dim)
+{
+	if (n_dim <= 1) return TNCONV_P_OTHER;
+	for (unsigned i=0; i<COUNTOF(g_tnconv_linear); ++i)
+		if (strsl_endswith(name, strsl_fromz(g_tnconv_linear[i])))
+			return TNCONV_P_LINEAR;
+	if (strsl_endswith(name, strsl_static("position.weight")) ||
+		strsl_endswith(name, strsl_static("text_proj")))
+		return TNCONV_P_OTHER;
+	return TNCONV_P_CONV;
+}
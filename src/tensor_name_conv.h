@@ -6,6 +6,7 @@
 #pragma once
 #include "ccommon/vector.h"
 #include "ccommon/strslice.h"
+#include "ccompute/tensorstore.h"
 
 int tnconv_sd(StrSlice name, DynStr *out);
 
@@ -14,3 +15,25 @@ enum tensor_name_convert_result_t {
 	TNCONV_R_GOOD = 1,
 	TNCONV_R_QKV_PROJ = 2,
 };
+
+/* Tensor store read callback for model files: renames the tensors with
+ * tnconv_sd and splits the OpenCLIP attention input projections.
+ * Models with the TNCONV_META_NAMES metadata are kept as they are.
+ */
+int tnconv_tstore_cb(void* user, TensorStore* ts, TSTensorEntry* te,
+	DynStr* pname);
+
+// Metadata set in models which tensors have already the internal names
+#define TNCONV_META_NAMES  "mlis.tensor_names"
+
+/* Kind of model parameter of a tensor with an internal name, as created by
+ * the model code: linear weights use the configured weight type, convolution
+ * kernels are F16 and the rest F32.
+ */
+int tnconv_param_kind(StrSlice name, unsigned n_dim);
+
+enum tensor_name_param_kind_t {
+	TNCONV_P_OTHER = 0,
+	TNCONV_P_LINEAR = 1,
+	TNCONV_P_CONV = 2,
+};
@@ -0,0 +1,115 @@
+/* Copyright 2025, Alejandro A. García <aag@zorzal.net>
+ * SPDX-License-Identifier: MIT
+ *
+ * Test of the attention implementations (flash and chunked) against the
+ * reference ggml_nn_attention, on the CPU backend.
+ */
+#include "ggml_extend.h"
+#include "ggml-alloc.h"
+#include "ggml-backend.h"
+#include "ccommon/rng_philox.h"
+#include "test_common.h"
+
+typedef struct {
+	int d_head, n_q, n_k, n_head;
+	bool mask;
+	const char *desc;
+} AttnCase;
+
+static
+float max_abs_diff(unsigned n, const float* a, const float* b)
+{
+	float m=0;
+	for (unsigned i=0; i<n; ++i) {
+		float d = a[i] - b[i];
+		if (d < 0) d = -d;
+		if (!(d <= m)) m = d;  //NaN propagates
+	}
+	return m;
+}
+
+static
+void tensor_randn(struct ggml_tensor* t)
+{
+	unsigned n = ggml_nelements(t);
+	float *d = malloc(n * sizeof(float));
+	rng_randn(n, d);
+	ggml_backend_tensor_set(t, d, 0, n * sizeof(float));
+	free(d);
+}
+
+static
+void test_case(ggml_backend_t be, const AttnCase* P)
+{
+	struct ggml_context *ctx = ggml_init((struct ggml_init_params){
+		ggml_tensor_overhead() * 256 + ggml_graph_overhead(), NULL, true });
+
+	// q: [n_head, n_q, d_head], k, v: [n_head, n_k, d_head]
+	struct ggml_tensor *q, *k, *v, *vt, *r0, *r1, *r2;
+	q = ggml_new_tensor_3d(ctx, GGML_TYPE_F32, P->d_head, P->n_q, P->n_head);
+	k = ggml_new_tensor_3d(ctx, GGML_TYPE_F32, P->d_head, P->n_k, P->n_head);
+	v = ggml_new_tensor_3d(ctx, GGML_TYPE_F32, P->d_head, P->n_k, P->n_head);
+	vt = ggml_cont(ctx, ggml_permute(ctx, v, 1, 0, 2, 3));  //[.., d_head, n_k]
+
+	r0 = ggml_nn_attention(ctx, q, k, vt, P->mask);
+	r1 = ggml_nn_attention_chunked(ctx, q, k, vt, P->mask, P->n_q / 3 + 1);
+	r2 = ggml_nn_attention_flash(ctx, q, k, v, P->mask);
+	r2 = ggml_cont(ctx, ggml_permute(ctx, r2, 0, 2, 1, 3));  //like r0
+
+	struct ggml_cgraph *graph = ggml_new_graph(ctx);
+	ggml_build_forward_expand(graph, r0);
+	ggml_build_forward_expand(graph, r1);
+	ggml_build_forward_expand(graph, r2);
+
+	ggml_backend_buffer_t buf = ggml_backend_alloc_ctx_tensors(ctx, be);
+	if (!buf) error("%s: alloc", P->desc);
+	tensor_randn(q);
+	tensor_randn(k);
+	tensor_randn(v);
+	if (ggml_backend_graph_compute(be, graph))
+		error("%s: compute", P->desc);
+
+	unsigned n = ggml_nelements(r0);
+	assert_int(ggml_nelements(r1), n, "%s: chunked shape", P->desc);
+	assert_int(ggml_nelements(r2), n, "%s: flash shape", P->desc);
+	float *o0 = malloc(n * sizeof(float)),
+	      *o1 = malloc(n * sizeof(float)),
+	      *o2 = malloc(n * sizeof(float));
+	ggml_backend_tensor_get(r0, o0, 0, n * sizeof(float));
+	ggml_backend_tensor_get(r1, o1, 0, n * sizeof(float));
+	ggml_backend_tensor_get(r2, o2, 0, n * sizeof(float));
+
+	float e1 = max_abs_diff(n, o0, o1),
+	      e2 = max_abs_diff(n, o0, o2);
+	debug("%s: chunked err %g, flash err %g", P->desc, e1, e2);
+	if (!(e1 < 1e-5)) error("%s: chunked error %g", P->desc, e1);
+	// K and V are F16 in the flash path
+	if (!(e2 < 5e-3)) error("%s: flash error %g", P->desc, e2);
+
+	free(o2);
+	free(o1);
+	free(o0);
+	ggml_backend_buffer_free(buf);
+	ggml_free(ctx);
+}
+
+int main(int argc, char* argv[])
+{
+	ggml_backend_t be = ggml_backend_init_by_type(
+		GGML_BACKEND_DEVICE_TYPE_CPU, NULL);
+	if (!be) error("CPU backend init");
+
+	const AttnCase cases[] = {
+		{ 64,  77,  77, 12, true,  "CLIP causal" },
+		{ 40, 256, 256,  8, false, "UNet self-attention" },
+		{ 40, 256,  77,  8, false, "UNet cross-attention" },
+		{ 64, 100, 100,  4, true,  "causal, odd size" },
+		{ 512, 64,  64,  1, false, "VAE mid-block" },
+	};
+	for (unsigned i=0; i<sizeof(cases)/sizeof(*cases); ++i)
+		test_case(be, &cases[i]);
+
+	ggml_backend_free(be);
+	log("TEST OK "__FILE__);
+	return 0;
+}
@@ -0,0 +1,67 @@
+/* Copyright 2025, Alejandro A. García <aag@zorzal.net>
+ * SPDX-License-Identifier: MIT
+ *
+ * Test of the MLCtx computations cache, on the CPU backend.
+ * Like the UNet with MLB_F_XKV_INPUT, some inputs are created while building.
+ */
+#include "mlblock.h"
+#include "test_common.h"
+
+#define N  16
+
+// Builds (or reuses) x + y*2, y is created during the build
+static
+void test_run(MLCtx* C, float x, float y, bool hit)
+{
+	float buf[N];
+	unsigned n_hit = C->info.n_cache_hit;
+
+	mlctx_begin(C, "test");
+	C->c.flags_e |= MLB_F_MULTI_COMPUTE | MLB_F_QUIET;
+	MLTensor *t_x = mlctx_input_new(C, "x", GGML_TYPE_F32, N,1,1,1);
+	if (!mlctx_cache_get(C, 0)) {
+		MLTensor *t_y = mlctx_input_new(C, "y", GGML_TYPE_F32, N,1,1,1);
+		mlctx_tensor_add(C, "output",
+			ggml_add(C->cc, t_x, ggml_scale(C->cc, t_y, 2)));
+	}
+	if (mlctx_prep(C) < 0) error("prep");
+
+	assert_int(C->info.n_cache_hit - n_hit, hit, "cache hit");
+	assert_int(vec_count(C->inputs), 2, "number of inputs");
+
+	for (unsigned i=0; i<N; ++i) buf[i] = x;
+	ggml_backend_tensor_set(C->inputs[0], buf, 0, sizeof(buf));
+	for (unsigned i=0; i<N; ++i) buf[i] = y;
+	ggml_backend_tensor_set(C->inputs[1], buf, 0, sizeof(buf));
+	if (mlctx_compute(C) < 0) error("compute");
+
+	ggml_backend_tensor_get(C->result, buf, 0, sizeof(buf));
+	for (unsigned i=0; i<N; ++i)
+		if (buf[i] != x + y*2) error("result %u: %g", i, buf[i]);
+
+	mlctx_end(C);
+}
+
+int main(int argc, char* argv[])
+{
+	TensorStore ts={0};
+	StringStore ss={0};
+	MLCtx C = { .tstore=&ts, .ss=&ss };
+	C.backend = ggml_backend_init_by_type(GGML_BACKEND_DEVICE_TYPE_CPU, NULL);
+	if (!C.backend) error("CPU backend init");
+	C.c.wtype = GGML_TYPE_F32;
+	C.c.cache_n = 2;
+
+	test_run(&C, 1, 2, false);
+	log("first computation built");
+	test_run(&C, 3, 4, true);
+	log("second computation from the cache");
+	test_run(&C, 5, 6, true);
+
+	mlctx_resident_clear(&C);
+	mlctx_lora_clear(&C);
+	ggml_backend_free(C.backend);
+	strsto_free(&ss);
+	log("TEST OK "__FILE__);
+	return 0;
+}
@@ -7,6 +7,7 @@
 #include "ccommon/rng_philox.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 /* Seed: 0, Offset: 0, n: 12
  -0.92466259
@@ -40,6 +41,19 @@ int main(int argc, char* argv[])
 	t = timing_time() - t;
 	fprintf(stderr, "%d numbers in %.3fms (%.3fns/num)\n", n, t*1e3, t*1e9/n);
 	for (unsigned i=0; i<n; ++i) printf("%12.8f\n", out[i]);
+
+	// Slices generated apart must match the sequence
+	float *part = malloc(sizeof(float)*n);
+	if (!part) { printf("out of memory\n"); return 1; }
+	rng.offset--;
+	for (unsigned i=0, s=1; i<n; i+=s, s=s*2+1)
+		rng_philox_randn_at(&rng, i, (n-i < s ? n-i : s), part+i);
+	for (unsigned i=0; i<n; ++i)
+		if (memcmp(&part[i], &out[i], sizeof(float))) {
+			fprintf(stderr, "slice mismatch at %u: %.8f != %.8f\n",
+				i, part[i], out[i]);
+			return 1;
+		}
 	
 	return 0;
 }
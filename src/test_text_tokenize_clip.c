@@ -64,6 +64,10 @@ int main(int argc, char* argv[])
 	TEST("\xe3\x81\xbe\xe3\x81\x82\xe3\x80\x81\xe3\x81\x8a\xe5\xbe\x85\xe3\x81\xa1\xe3\x81\xaa\xe3\x81\x95\xe3\x81\x84\xe3\x80\x82", 4813, 122, 4813, 480, 45262, 4813, 232, 161, 122, 227, 4813, 94, 29104, 4813, 243, 38850, 38000);
 	// Long text. Split words.
 	TEST("Stable Diffusion is a deep learning, text-to-image model released in 2022 based on diffusion techniques.", 10492, 18656, 9364, 533, 320, 3383, 2378, 267, 4160, 268, 531, 268, 2867, 2863, 3410, 530, 17, 15, 17, 273, 2812, 525, 18656, 9364, 1782, 697, 7715, 269);
+	// Long words, not cached and longer than the BPE stack buffer
+	TEST("pneumonoultramicroscopicsilicovolcanoconiosis and antidisestablishmentarianismantidisestablishmentarianismantidisestablishmentarianism", 28714, 749, 20253, 9800, 535, 532, 1065, 901, 1556, 13697, 9916, 78, 39031, 13903, 537, 3120, 4262, 7726, 12658, 1585, 29980, 595, 723, 555, 4262, 7726, 12658, 1585, 29980, 595, 723, 555, 4262, 7726, 12658, 1585, 44351);
+	// Repeated, from the words cache
+	TEST("a dog jumping", 320, 1929, 11476);
 
 	log("TEST OK "__FILE__);
 	mlis_ctx_destroy(&ctx);
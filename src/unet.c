@@ -144,6 +144,19 @@ MLTensor* mlb_spatial_transf(MLCtx* C, MLTensor* x, MLTensor* ctx,
 	return x;
 }
 
+static
+MLTensor* mlb_spatial_transf_xkv(MLCtx* C, MLTensor* ctx, int d_embed,
+	int n_depth)
+{
+	char name[32];
+	mlctx_block_begin(C);
+	for (int i=0; i<n_depth; ++i) {
+		sprintf(name, "transf.%d", i);
+		ctx = MLN(name, mlb_basic_transf_xkv(C, ctx, d_embed));
+	}
+	return ctx;
+}
+
 MLTensor* mlb_unet__embed(MLCtx* C, MLTensor* time, MLTensor* label,
 	const UnetParams* P)
 {
@@ -280,6 +293,44 @@ MLTensor* mlb_unet_denoise(MLCtx* C, MLTensor* x, MLTensor* time, MLTensor* ctx,
 	return x;
 }
 
+MLTensor* mlb_unet_xkv(MLCtx* C, MLTensor* ctx, const UnetParams* P)
+{
+	char name[64];
+	MLTensor *x=NULL;
+	mlctx_block_begin(C);
+
+	// Same order as mlb_unet__in/mid/out
+	int im=0, i_blk=0, ds=1;
+	for (; P->ch_mult[im]; ++im) {
+		if (im) { ds *= 2; i_blk++; }
+		for (unsigned j=0; j<P->n_res_blk; ++j) {
+			i_blk++;
+			if (static_vector_in(P->attn_res, ds)) {
+				sprintf(name, "in.%d.1", i_blk);
+				x = MLN(name, mlb_spatial_transf_xkv(C, ctx,
+					P->n_ch * P->ch_mult[im], P->transf_depth[im]));
+			}
+		}
+	}
+
+	im--;
+	x = MLN("mid.1", mlb_spatial_transf_xkv(C, ctx,
+		P->n_ch * P->ch_mult[im], P->transf_depth[im]));
+
+	for (unsigned i_oblk=0; im>=0; --im) {
+		for (unsigned j=0; j<P->n_res_blk+1; ++j, ++i_oblk) {
+			if (static_vector_in(P->attn_res, ds)) {
+				sprintf(name, "out.%d.1", i_oblk);
+				x = MLN(name, mlb_spatial_transf_xkv(C, ctx,
+					P->n_ch * P->ch_mult[im], P->transf_depth[im]));
+			}
+			if (im != 0 && j == P->n_res_blk) ds /= 2;
+		}
+	}
+
+	return x;
+}
+
 void unet_params_init()
 {
 	if (g_log_sigmas_sd[0]) return;
@@ -333,49 +384,262 @@ float unet_t_to_sigma(const UnetParams* P, float t)
 	return exp(ls);
 }
 
+/* Builds the two halves of the UNet in S->half.
+ * They are kept for all the steps and share the compute memory, which is
+ * that of the biggest half. The outputs of the first half (x, embedding and
+ * skip connections) are copied to a separate buffer, which is used directly
+ * as the inputs of the second one.
+ */
+static
+int unet_split_keep_init(UnetState* S, MLCtx* C, const UnetParams* P,
+	unsigned lw, unsigned lh, unsigned n_batch)
+{
+	int R=1;
+	MLTensor *t_x, *t_t, *t_c, *t_l=NULL, *t_e, *out, **tstack=NULL,
+	         **src=NULL, **dst=NULL;  //vectors, first half outputs to inputs
+
+	ggml_backend_buffer_type_t buft =
+		ggml_backend_get_default_buffer_type(C->backend);
+	S->allocr = ggml_gallocr_new(buft);
+	for (int i=0; i<2; ++i) {
+		S->half[i] = (MLCtx){ .backend=C->backend, .tstore=C->tstore,
+			.ss=C->ss, .c=C->c, .lora.items=C->lora.items,
+			.allocr_ext=S->allocr };
+		// Own params, out of the shared memory, free'd with the halves
+		S->half[i].c.flags |= MLB_F_RESIDENT;
+		S->half[i].c.cache_n = 0;
+	}
+
+	// First half
+	MLCtx *H = &S->half[0];
+	mlctx_begin(H, "UNet 1/2");
+	H->c.flags_e |= MLB_F_MULTI_COMPUTE;
+
+	t_x = mlctx_input_new(H, "x", GGML_TYPE_F32, lw, lh, 4, n_batch);
+	t_t = mlctx_input_new(H, "t", GGML_TYPE_F32, n_batch,1,1,1);
+	t_c = mlctx_input_new(H, "c", GGML_TYPE_F32, P->n_ctx, 77, n_batch, 1);
+	if (P->ch_adm_in)
+		t_l = mlctx_input_new(H, "l", GGML_TYPE_F32, P->ch_adm_in, n_batch,1,1);
+	
+	mlctx_block_begin(H);
+	t_e = mlb_unet__embed(H, t_t, t_l, P);
+	out = mlb_unet__in(H, t_x, t_e, t_c, P, &tstack);
+	out = mlb_unet__mid(H, out, t_e, t_c, P);
+	vec_push(src, out);
+	vec_push(src, t_e);
+	vec_for(tstack,i,0) vec_push(src, tstack[i]);
+
+	// Second half
+	H = &S->half[1];
+	mlctx_begin(H, "UNet 2/2");
+	H->c.flags_e |= MLB_F_MULTI_COMPUTE;
+	
+	t_x = mlctx_input_new(H, "x", GGML_TYPE_F32, GGML_SHAPE_UNPACK(out));
+	t_e = mlctx_input_new(H, "e", GGML_TYPE_F32, GGML_SHAPE_UNPACK(t_e));
+	t_c = mlctx_input_new(H, "c", GGML_TYPE_F32, P->n_ctx, 77, n_batch, 1);
+	vec_push(dst, t_x);
+	vec_push(dst, t_e);
+	vec_for(tstack,i,0) {
+		tstack[i] = mlctx_input_new(H, "skip", GGML_TYPE_F32,
+			GGML_SHAPE_UNPACK(tstack[i]));
+		vec_push(dst, tstack[i]);
+	}
+
+	mlctx_block_begin(H);
+	mlb_unet__out(H, t_x, t_e, t_c, P, &tstack);
+
+	// Buffer for the inputs of the second half
+	size_t sz=0, align = ggml_backend_get_alignment(C->backend);
+	vec_for(dst,i,0) sz += GGML_PAD(ggml_backend_buft_get_alloc_size(buft,
+		dst[i]), align);
+	S->bridge = ggml_backend_alloc_buffer(C->backend, sz);
+	if (!S->bridge) ERROR_LOG(-1, "UNet split inputs allocation");
+	struct ggml_tallocr ta = ggml_tallocr_new(S->bridge);
+
+	// The first half copies its outputs there, the result (x) the last
+	H = &S->half[0];
+	vec_forr(dst,i) {
+		ggml_tallocr_alloc(&ta, dst[i]);
+		MLTensor *t = ggml_new_tensor(H->cp, GGML_TYPE_F32, GGML_MAX_DIMS,
+			dst[i]->ne);
+		ggml_backend_tensor_alloc(S->bridge, t, dst[i]->data);
+		t = ggml_cpy(H->cc, src[i], t);
+		if (i > 0) mlctx_output_add(H, t);
+		else mlctx_tensor_add(H, "out", t);
+	}
+
+	TRY( mlctx_prep(&S->half[0]) );
+	TRY( mlctx_prep(&S->half[1]) );
+	log_debug("UNet split inputs: %.1fMiB", sz / (1024.0*1024.0));
+
+end:
+	vec_free(dst);
+	vec_free(src);
+	vec_free(tstack);
+	return R;
+}
+
+void unet_denoise_free(UnetState* S)
+{
+	for (int i=0; i<2; ++i) {
+		mlctx_free(&S->half[i]);
+		mlctx_resident_clear(&S->half[i]);
+		vec_free(S->half[i].lora.hooks);  //lora.items is shared
+	}
+	if (S->bridge) {
+		ggml_backend_buffer_free(S->bridge);
+		S->bridge = NULL;
+	}
+	if (S->allocr) {
+		ggml_gallocr_free(S->allocr);
+		S->allocr = NULL;
+	}
+	for (int i=0; i<2; ++i) {
+		vec_for(S->kv[i].kv,j,0) ltensor_free(&S->kv[i].kv[j]);
+		vec_free(S->kv[i].kv);
+		S->kv[i].cond = NULL;
+	}
+	S->kv_cur = NULL;
+}
+
 int unet_denoise_init(UnetState* S, MLCtx* C, const UnetParams* P,
-	unsigned lw, unsigned lh, bool split)
+	unsigned lw, unsigned lh, unsigned n_batch, int split, bool kv_pre)
 {
 	int R=1;
 
 	unet_params_init();  //global
-		
+	
+	IFFALSESET(n_batch, 1);
 	C->c.n_tensor_max = 10240;
 
-	if (!split) {
+	if (split == UNET_SPLIT_KEEP) {
+		TRY( unet_split_keep_init(S, C, P, lw, lh, n_batch) );
+	}
+	else if (split == UNET_SPLIT_NONE) {
 		// Prepare computation
 		mlctx_begin(C, "UNet");
 		C->c.flags_e |= MLB_F_MULTI_COMPUTE;
 
 		MLTensor *t_x, *t_t, *t_c, *t_l=NULL;
-		t_x = mlctx_input_new(C, "x", GGML_TYPE_F32, lw, lh, 4, 1);
-		t_t = mlctx_input_new(C, "t", GGML_TYPE_F32, 1,1,1,1);
-		t_c = mlctx_input_new(C, "c", GGML_TYPE_F32, P->n_ctx, 77, 1, 1);
+		t_x = mlctx_input_new(C, "x", GGML_TYPE_F32, lw, lh, 4, n_batch);
+		t_t = mlctx_input_new(C, "t", GGML_TYPE_F32, n_batch,1,1,1);
+		if (kv_pre) {
+			// Only the shape is used, the K/V inputs are created instead
+			C->c.flags_e |= MLB_F_XKV_INPUT;
+			t_c = ggml_new_tensor_4d(C->cp, GGML_TYPE_F32,
+				P->n_ctx, 77, n_batch, 1);
+		} else
+			t_c = mlctx_input_new(C, "c", GGML_TYPE_F32, P->n_ctx, 77, n_batch, 1);
 		if (P->ch_adm_in)
-			t_l = mlctx_input_new(C, "l", GGML_TYPE_F32, P->ch_adm_in, 1,1,1);
-		mlb_unet_denoise(C, t_x, t_t, t_c, t_l, P);
+			t_l = mlctx_input_new(C, "l", GGML_TYPE_F32, P->ch_adm_in, n_batch,1,1);
+		if (!mlctx_cache_get(C, 0))
+			mlb_unet_denoise(C, t_x, t_t, t_c, t_l, P);
 		TRY( mlctx_prep(C) );
 	}
 
 	S->ctx = C;
 	S->par = P;
+	S->n_batch = n_batch;
 	S->split = split;
+	S->kv_pre = kv_pre && split == UNET_SPLIT_NONE;
+
+end:
+	return R;
+}
+
+/* Sets an input tensor from sz bytes of data.
+ * If the data is smaller, it is repeated to fill the input
+ * (e.g. the same conditioning for all the images in the batch).
+ */
+static
+void unet_input_set(MLTensor* dst, const float* data, size_t sz)
+{
+	size_t n = ggml_nbytes(dst);
+	assert( sz > 0 && n % sz == 0 );
+	for (size_t o=0; o<n; o+=sz)
+		ggml_backend_tensor_set(dst, data, o, sz);
+}
+
+#define unet_input_set_lt(DST, LT) \
+	unet_input_set((DST), (LT)->d, ltensor_nbytes(LT))
+
+/* Computes the cross attention K/V projections of cond in a separate graph.
+ * The step graph does not include the parameters for them.
+ */
+static
+int unet_xkv_compute(UnetState* S, const LocalTensor* cond, LocalTensor** pkv)
+{
+	int R=1;
+	MLCtx *C = S->ctx,
+	      K = { .backend=C->backend, .tstore=C->tstore, .ss=C->ss, .c=C->c,
+	            .lora.items=C->lora.items };
+	K.c.flags &= ~MLB_F_RESIDENT;
+	K.c.cache_n = 0;
+
+	mlctx_begin(&K, "UNet K/V");
+	K.c.flags_e |= S->ctx->c.flags_e & MLB_F_QUIET;
+	MLTensor *t_c = mlctx_input_new(&K, "c", GGML_TYPE_F32,
+		LT_SHAPE_UNPACK(*cond));
+	mlb_unet_xkv(&K, t_c, S->par);
+	TRY( mlctx_prep(&K) );
+
+	ltensor_to_backend(cond, t_c);
+	TRY( mlctx_compute(&K) );
+
+	vec_resize_zero(*pkv, vec_count(K.outputs));
+	vec_for(K.outputs,i,0) ltensor_from_backend(&(*pkv)[i], K.outputs[i]);
+
+end:
+	mlctx_end(&K);
+	vec_free(K.lora.hooks);  //lora.items is shared
+	return R;
+}
+
+/* Sets the K/V inputs of the step graph for cond.
+ * The projections are computed the first time that cond is used.
+ */
+static
+int unet_xkv_set(UnetState* S, const LocalTensor* cond,
+	MLTensor** inputs, unsigned n_input)
+{
+	int R=1;
+	UnetCondKV *e=NULL;
+	for (int i=0; i<2 && !e; ++i) if (S->kv[i].cond == cond) e = &S->kv[i];
+	if (e && e == S->kv_cur) return 1;
+
+	if (!e) {  //reuse the slot not in use
+		e = &S->kv[ S->kv_cur == &S->kv[0] ];
+		e->cond = NULL;
+		TRY( unet_xkv_compute(S, cond, &e->kv) );
+		e->cond = cond;
+	}
+
+	if (n_input != vec_count(e->kv))
+		ERROR_LOG(-1, "unet: K/V inputs mismatch %u != %u",
+			n_input, (unsigned)vec_count(e->kv));
+	for (unsigned i=0; i<n_input; ++i) unet_input_set_lt(inputs[i], &e->kv[i]);
+	S->kv_cur = e;
 
 end:
 	return R;
 }
 
-int unet_compute(MLCtx* C, const UnetParams* P,
+static
+int unet_compute(UnetState* S,
 	const LocalTensor* x, const LocalTensor* cond, const LocalTensor* label,
 	float t, LocalTensor* dx)
 {
 	int R=1;
+	MLCtx *C = S->ctx;
+	unsigned i=2;
 
 	// Set input
 	ltensor_to_backend(x, C->inputs[0]);
-	ggml_backend_tensor_set(C->inputs[1], &t, 0, sizeof(t));
-	ltensor_to_backend(cond, C->inputs[2]);
-	if (P->ch_adm_in) ltensor_to_backend(label, C->inputs[3]);
+	unet_input_set(C->inputs[1], &t, sizeof(t));
+	if (!S->kv_pre) unet_input_set_lt(C->inputs[i++], cond);
+	if (S->par->ch_adm_in) unet_input_set_lt(C->inputs[i++], label);
+	if (S->kv_pre)  // The K/V inputs are the remaining ones
+		TRY( unet_xkv_set(S, cond, C->inputs+i, vec_count(C->inputs)-i) );
 		
 	// Compute
 	TRY( mlctx_compute(C) );
@@ -396,14 +660,16 @@ int unet_compute_split(MLCtx* C, const UnetParams* P,
 	         **tstack=NULL;
 	LocalTensor *lstack=NULL, emb={0};
 
+	const int n_batch = x->n[3];
+
 	// First half
 	mlctx_begin(C, "UNet 1/2");
 
-	t_x = mlctx_input_new(C, "x", GGML_TYPE_F32, x->n[0], x->n[1], 4, 1);
-	t_t = mlctx_input_new(C, "t", GGML_TYPE_F32, 1,1,1,1);
-	t_c = mlctx_input_new(C, "c", GGML_TYPE_F32, P->n_ctx, 77, 1, 1);
+	t_x = mlctx_input_new(C, "x", GGML_TYPE_F32, x->n[0], x->n[1], 4, n_batch);
+	t_t = mlctx_input_new(C, "t", GGML_TYPE_F32, n_batch,1,1,1);
+	t_c = mlctx_input_new(C, "c", GGML_TYPE_F32, P->n_ctx, 77, n_batch, 1);
 	if (P->ch_adm_in)
-		t_l = mlctx_input_new(C, "l", GGML_TYPE_F32, P->ch_adm_in, 1,1,1);
+		t_l = mlctx_input_new(C, "l", GGML_TYPE_F32, P->ch_adm_in, n_batch,1,1);
 	
 	mlctx_block_begin(C);
 	t_e = mlb_unet__embed(C, t_t, t_l, P);
@@ -414,9 +680,9 @@ int unet_compute_split(MLCtx* C, const UnetParams* P,
 	TRY( mlctx_prep(C) );
 	
 	ltensor_to_backend(x, t_x);
-	ggml_backend_tensor_set(t_t, &t, 0, sizeof(t));
-	ltensor_to_backend(cond, t_c);
-	if (t_l) ltensor_to_backend(label, t_l);
+	unet_input_set(t_t, &t, sizeof(t));
+	unet_input_set_lt(t_c, cond);
+	if (t_l) unet_input_set_lt(t_l, label);
 
 	TRY( mlctx_compute(C) );
 
@@ -430,7 +696,7 @@ int unet_compute_split(MLCtx* C, const UnetParams* P,
 	
 	t_x = mlctx_input_new(C, "x", GGML_TYPE_F32, LT_SHAPE_UNPACK(*dx));
 	t_e = mlctx_input_new(C, "e", GGML_TYPE_F32, LT_SHAPE_UNPACK(emb));
-	t_c = mlctx_input_new(C, "c", GGML_TYPE_F32, P->n_ctx, 77, 1, 1);
+	t_c = mlctx_input_new(C, "c", GGML_TYPE_F32, P->n_ctx, 77, n_batch, 1);
 	vec_for(lstack,i,0)
 		tstack[i] = mlctx_input_new(C, "skip", GGML_TYPE_F32,
 			LT_SHAPE_UNPACK(lstack[i]));
@@ -441,7 +707,7 @@ int unet_compute_split(MLCtx* C, const UnetParams* P,
 	
 	ltensor_to_backend(dx, t_x);
 	ltensor_to_backend(&emb, t_e);
-	ltensor_to_backend(cond, t_c);
+	unet_input_set_lt(t_c, cond);
 	vec_for(lstack,i,0) ltensor_to_backend(&lstack[i], tstack[i]);
 	
 	TRY( mlctx_compute(C) );
@@ -457,6 +723,36 @@ end:
 	return R;
 }
 
+static
+int unet_compute_split_keep(UnetState* S,
+	const LocalTensor* x, const LocalTensor* cond, const LocalTensor* label,
+	float t, LocalTensor* dx)
+{
+	int R=1;
+	MLCtx *H0 = &S->half[0],
+	      *H1 = &S->half[1];
+
+	// First half
+	TRY( mlctx_realloc(H0) );
+	ltensor_to_backend(x, H0->inputs[0]);
+	unet_input_set(H0->inputs[1], &t, sizeof(t));
+	unet_input_set_lt(H0->inputs[2], cond);
+	if (S->par->ch_adm_in) unet_input_set_lt(H0->inputs[3], label);
+
+	TRY( mlctx_compute(H0) );
+
+	// Second half: x, embedding and skip connections are already in place
+	TRY( mlctx_realloc(H1) );
+	unet_input_set_lt(H1->inputs[2], cond);
+
+	TRY( mlctx_compute(H1) );
+
+	ltensor_from_backend(dx, H1->result);
+
+end:
+	return R;
+}
+
 int unet_denoise_run(UnetState* S,
 	const LocalTensor* x, const LocalTensor* cond, const LocalTensor* label,
 	float sigma, LocalTensor* dx)
@@ -469,15 +765,22 @@ int unet_denoise_run(UnetState* S,
 
 	// Scale input
 	float c_in = 1 / sqrt(sigma*sigma + 1);
-	ltensor_for(*dx,i,0) dx->d[i] = x->d[i] * c_in;
+	ltensor_lincomb(dx, c_in, x, 0, NULL);
 
 	// Compute
-	if (!S->split || S->nfe > 0) S->ctx->c.flags_e |= MLB_F_QUIET;
+	if (S->split != UNET_SPLIT_STEP || S->nfe > 0)
+		S->ctx->c.flags_e |= MLB_F_QUIET;
+	if (S->split == UNET_SPLIT_KEEP && S->nfe > 0) {
+		S->half[0].c.flags_e |= MLB_F_QUIET;
+		S->half[1].c.flags_e |= MLB_F_QUIET;
+	}
 	double t_comp = timing_time();
-	if (S->split) {
+	if (S->split == UNET_SPLIT_KEEP) {
+		TRY( unet_compute_split_keep(S, dx, cond, label, t, dx) );
+	} else if (S->split) {
 		TRY( unet_compute_split(S->ctx, S->par, dx, cond, label, t, dx) );
 	} else {
-		TRY( unet_compute(S->ctx, S->par, dx, cond, label, t, dx) );
+		TRY( unet_compute(S, dx, cond, label, t, dx) );
 	}
 	t_comp = timing_time() - t_comp;
 	//log_debug("dx  %.6e", ltensor_mean(dx));
@@ -490,7 +793,7 @@ int unet_denoise_run(UnetState* S,
 	if (S->par->vparam) {
 		float c_skip = sigma / (sigma*sigma + 1),
 		      c_out = 1 / sqrt(sigma*sigma + 1);
-		ltensor_for(*dx,i,0) dx->d[i] = dx->d[i] * c_out + x->d[i] * c_skip;
+		ltensor_lincomb(dx, c_out, dx, c_skip, x);
 	}
 
 end:
@@ -40,20 +40,55 @@ extern const UnetParams g_unet_sdxl;	//SDXL
 MLTensor* mlb_unet_denoise(MLCtx* C, MLTensor* x, MLTensor* time, MLTensor* c,
 	MLTensor* label, const UnetParams* P);
 
+/* Cross attention K/V projections of the context c for all the transformer
+ * blocks, added as outputs in the order that mlb_unet_denoise with
+ * MLB_F_XKV_INPUT creates the inputs for them.
+ */
+MLTensor* mlb_unet_xkv(MLCtx* C, MLTensor* c, const UnetParams* P);
+
 void unet_params_init();  //fill global log_sigmas
 
 float unet_sigma_to_t(const UnetParams* P, float sigma);
 
 float unet_t_to_sigma(const UnetParams* P, float t);
 
+enum UnetSplit {
+	UNET_SPLIT_NONE,
+	// Two halves built on each step, only one in memory at a time
+	UNET_SPLIT_STEP,
+	// Two halves built once and kept until unet_denoise_free,
+	// computed one after the other in the same memory
+	UNET_SPLIT_KEEP,
+};
+
+typedef struct {
+	const LocalTensor *cond;
+	LocalTensor *kv;  //vector
+} UnetCondKV;
+
 typedef struct {
 	MLCtx *ctx;
 	const UnetParams *par;
-	unsigned nfe, split:1;
+	unsigned nfe, n_batch, split:2, kv_pre:1;
+	MLCtx half[2];  //UNET_SPLIT_KEEP
+	ggml_gallocr_t allocr;  //compute memory of both halves
+	ggml_backend_buffer_t bridge;  //inputs of the second half
+	// Cross attention K/V of each conditioning (kv_pre)
+	UnetCondKV kv[2];
+	const UnetCondKV *kv_cur;  //currently in the step graph inputs
 } UnetState;
 
+/* Prepares the UNet computation for latents of size lw x lh.
+ * n_batch: number of latents denoised together. The conditioning and label
+ *          may have a batch of one, they are repeated for each latent.
+ * split: UNET_SPLIT_*
+ * kv_pre: compute the cross attention K/V projections of each conditioning
+ *         only once instead of on each step (not with split).
+ */
 int unet_denoise_init(UnetState* S, MLCtx* C, const UnetParams* P,
-	unsigned lw, unsigned lh, bool split);
+	unsigned lw, unsigned lh, unsigned n_batch, int split, bool kv_pre);
+
+void unet_denoise_free(UnetState* S);
 
 int unet_denoise_run(UnetState* S,
 	const LocalTensor* x, const LocalTensor* cond, const LocalTensor* label,
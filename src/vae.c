@@ -11,6 +11,10 @@
 #include <stdlib.h>
 #include <math.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #define T  true
 #define MLN(NAME,X)  mlctx_tensor_add(C, (NAME), (X))
 
@@ -64,7 +68,8 @@ MLTensor* mlb_attn_2d_self(MLCtx* C, MLTensor* x)
 	v = MLN("v", mlb_nn_conv2d(C, x, c, 1,1, 1,1, 0,0, 1,1, T));
 	v = ggml_reshape_3d(C->cc, v, h * w, c, n);  //[N, c, h*w]
 
-	x = ggml_nn_attention(C->cc, q, k, v, false);  //[N, h*w, c]
+	x = ggml_nn_attention_chunked(C->cc, q, k, v, false,
+		C->c.attn_chunk);  //[N, h*w, c]
 	x = ggml_cont(C->cc, ggml_permute(C->cc, x, 1, 0, 2, 3));  //[N, c, h*w]
 	x = ggml_reshape_4d(C->cc, x, w, h, c, n);               //[N, c, h, w]
 
@@ -219,11 +224,267 @@ void sdvae_latent_sample(LocalTensor* latent, const LocalTensor* mom,
 	ltensor_for(*latent,i,0) latent->d[i] *= P->scale_factor;
 }
 
+/* Tiled computation
+ * The input is split in overlapping tiles of the size of the graph input.
+ * The outputs are blended with weights that fade to zero near the inner
+ * edges of each tile, so that there are no visible seams.
+ * The tiles may be computed in parallel by several workers (CPU only), each
+ * with its own graph and compute buffer. On the CPU backend the parameters
+ * usually use the tensor store memory directly, so they are shared.
+ * With a sink, the tiles are computed row by row and the output only holds
+ * a window of rows starting at row0, that is emitted once finished.
+ */
+typedef struct {
+	const LocalTensor *in;
+	const char *in_name;
+	LocalTensor out, wsum;
+	int n0, n1,  //tile size (input)
+	    k,  //overlap margin (input)
+	    step0, step1, n_tile0, n_tile1,
+	    f_mul, f_div,  //output size = input size * f_mul / f_div
+	    row0;  //first output row in out
+	bool enc;  //apply sdvae_encoder_pre
+	const VaeRowSink *sink;  //apply sdvae_decoder_post and emit the rows
+} VaeTiling;
+
+static
+void vae_tiling_init(VaeTiling* V, const LocalTensor* in, int n0, int n1,
+	int k, int f_mul, int f_div)
+{
+	V->in = in;
+	V->n0 = n0;
+	V->n1 = n1;
+	V->k = k;
+	V->step0 = n0 - k*2;  //overlapping
+	V->step1 = n1 - k*2;
+	V->n_tile0 = (in->n[0] - k*2 + V->step0 - 1) / V->step0;
+	V->n_tile1 = (in->n[1] - k*2 + V->step1 - 1) / V->step1;
+	V->f_mul = f_mul;
+	V->f_div = f_div;
+}
+
+static
+void vae_tiling_free(VaeTiling* V)
+{
+	ltensor_free(&V->out);
+	ltensor_free(&V->wsum);
+}
+
+// Tile weight along one dimension: zero in the outer half of the margin,
+// then linear up to one. Only on the sides with a neighbor tile.
+static inline
+float vae_tile_ramp(int x, int n, int m, bool lo, bool hi)
+{
+	float w = 1;
+	if (lo) w = ccMIN(w, ((x + 0.5f) - m*0.5f) / m);
+	if (hi) w = ccMIN(w, ((n - x - 0.5f) - m*0.5f) / m);
+	return w > 0 ? w : 0;
+}
+
+static
+void vae_tile_blend(VaeTiling* V, const LocalTensor* tile, int i0, int i1)
+{
+	const int fm = V->f_mul, fd = V->f_div,
+	          m  = V->k * fm / fd,  //margin in the output
+	          o0 = i0 * fm / fd,
+	          o1 = i1 * fm / fd - V->row0,
+	          n0 = tile->n[0], n1 = tile->n[1],
+	          N0 = V->out.n[0], N1 = V->out.n[1];
+	const bool lo0 = i0 > 0, hi0 = i0 + V->n0 < V->in->n[0],
+	           lo1 = i1 > 0, hi1 = i1 + V->n1 < V->in->n[1];
+	
+	float *wx = alloc_alloc(g_allocator, sizeof(float)*n0);
+	for (int x=0; x<n0; ++x) wx[x] = vae_tile_ramp(x, n0, m, lo0, hi0);
+
+	for (int y=0; y<n1; ++y) {
+		float wy = vae_tile_ramp(y, n1, m, lo1, hi1);
+		for (int x=0; x<n0; ++x)
+			V->wsum.d[o0+x + (o1+y)*N0] += wx[x] * wy;
+		for (int c=0; c<tile->n[2]*tile->n[3]; ++c) {
+			const float *src = tile->d + (y + c*n1)*n0;
+			float *dst = V->out.d + o0 + (o1+y + c*N1)*N0;
+			for (int x=0; x<n0; ++x) dst[x] += src[x] * wx[x] * wy;
+		}
+	}
+
+	alloc_free(g_allocator, wx);
+}
+
+static
+int vae_tile_compute(MLCtx* C, VaeTiling* V, int i_tile, LocalTensor* tmp)
+{
+	int t0 = i_tile % V->n_tile0,
+	    t1 = i_tile / V->n_tile0,
+	    i0 = ccMIN(t0 * V->step0, V->in->n[0] - V->n0),
+	    i1 = ccMIN(t1 * V->step1, V->in->n[1] - V->n1);
+
+	ltensor_resize(tmp, V->n0, V->n1, V->in->n[2], V->in->n[3]);
+	ltensor_copy_slice2(tmp, V->in, V->n0,V->n1, 0,0, i0,i1, 1,1, 1,1);
+	if (V->enc) sdvae_encoder_pre(tmp, tmp);
+	
+	ltensor_to_backend(tmp, C->inputs[0]);
+	TRYR( mlctx_compute(C) );
+	ltensor_from_backend(tmp, C->result);
+	log_debug3_ltensor(tmp, "vae tile");
+
+#ifdef _OPENMP
+	#pragma omp critical (vae_tile_blend)
+#endif
+	vae_tile_blend(V, tmp, i0, i1);
+	return 1;
+}
+
+// Sends the output rows [row0, y1) to the sink and moves the rest up
+static
+int vae_tiling_emit(VaeTiling* V, int y1, LocalTensor* band)
+{
+	const int N0 = V->out.n[0], N1 = V->out.n[1],
+	          n_plane = V->out.n[2] * V->out.n[3],
+	          h = y1 - V->row0;
+	if (h <= 0) return 0;
+
+	ltensor_resize(band, N0, h, V->out.n[2], V->out.n[3]);
+	for (int c=0; c<n_plane; ++c) {
+		const float *src = V->out.d + c*N0*N1;
+		float *dst = band->d + c*N0*h;
+		for (int i=0; i<N0*h; ++i) dst[i] = src[i] / V->wsum.d[i];
+	}
+	sdvae_decoder_post(band, band);
+	TRYR( V->sink->func(V->sink->user, band, V->row0,
+		V->in->n[1] * V->f_mul / V->f_div) );
+
+	// Shift the window
+	for (int c=0; c<n_plane; ++c) {
+		float *p = V->out.d + c*N0*N1;
+		memmove(p, p + N0*h, sizeof(float)*N0*(N1-h));
+		memset(p + N0*(N1-h), 0, sizeof(float)*N0*h);
+	}
+	memmove(V->wsum.d, V->wsum.d + N0*h, sizeof(float)*N0*(N1-h));
+	memset(V->wsum.d + N0*(N1-h), 0, sizeof(float)*N0*h);
+	V->row0 = y1;
+	return 1;
+}
+
+/* Computes all the tiles with C, already prepared, and n_worker-1
+ * additional contexts built with func.
+ */
+static
+int vae_tiling_run(MLCtx* C, const VaeParams* P, VaeTiling* V, int n_worker,
+	MLTensor* (*func)(MLCtx*, MLTensor*, const VaeParams*))
+{
+	int R=1;
+	MLCtx *W=NULL;  //vector, workers besides C
+	LocalTensor *tmp=NULL;  //vector, one per worker
+	LocalTensor band={0};
+	const int n_tile = V->n_tile0 * V->n_tile1,
+	          n_chunk = V->sink ? V->n_tile0 : n_tile,  //tiles per step
+	          out_n1 = V->in->n[1] * V->f_mul / V->f_div;
+	const MLTensor *in = C->inputs[0], *out = C->result;
+
+	V->row0 = 0;
+	ltensor_resize(&V->out, V->in->n[0] * V->f_mul / V->f_div,
+		(V->sink ? V->n1 : V->in->n[1]) * V->f_mul / V->f_div,
+		out->ne[2], out->ne[3]);
+	ltensor_resize(&V->wsum, V->out.n[0], V->out.n[1], 1, 1);
+	memset(V->out.d, 0, ltensor_nbytes(&V->out));
+	memset(V->wsum.d, 0, ltensor_nbytes(&V->wsum));
+
+	ggml_backend_dev_t dev = ggml_backend_get_device(C->backend);
+#ifdef _OPENMP
+	if (n_worker > 1 && ggml_backend_dev_type(dev) != GGML_BACKEND_DEVICE_TYPE_CPU) {
+		log_warning("VAE tile workers are only supported with the CPU backend");
+		n_worker = 1;
+	}
+#else
+	n_worker = 1;
+#endif
+	ccCLAMP(n_worker, 1, n_chunk);
+
+	// The threads are split between the main backend and the workers
+	const int n_thread = g_ltensor_n_thread > 0 ? g_ltensor_n_thread
+	                   : GGML_DEFAULT_N_THREADS,
+	          n_thread_w = ccMAX(1, n_thread / n_worker);
+	if (n_worker > 1) ggml__backend_set_n_threads(C->backend, n_thread_w);
+	
+	vec_resize_zero(W, n_worker-1);
+	vec_resize_zero(tmp, n_worker);
+	vec_forp(MLCtx, W, w, 0) {
+		*w = (MLCtx){ .backend=ggml_backend_dev_init(dev, NULL),
+			.tstore=C->tstore, .ss=C->ss, .c=C->c,
+			.lora.items=C->lora.items };
+		if (!w->backend) ERROR_LOG(-1, "VAE tile worker backend init");
+		ggml__backend_set_n_threads(w->backend, n_thread_w);
+		w->c.flags &= ~(MLB_F_RESIDENT | MLB_F_PROFILE);
+		w->c.cache_n = 0;
+		mlctx_begin(w, C->c.name);
+		w->c.flags_e |= MLB_F_MULTI_COMPUTE | MLB_F_QUIET;
+		MLTensor *x = mlctx_input_new(w, V->in_name, GGML_TYPE_F32,
+			GGML_SHAPE_UNPACK(in));
+		func(w, x, P);
+		TRY( mlctx_prep(w) );
+	}
+	if (n_worker > 1)
+		log_debug("VAE tile workers: %d threads: %d", n_worker, n_thread_w);
+
+	for (int i_beg=0; i_beg<n_tile; i_beg+=n_chunk) {
+#ifdef _OPENMP
+		#pragma omp parallel for num_threads(n_worker) schedule(dynamic) if(n_worker > 1)
+#endif
+		for (int i=i_beg; i<i_beg+n_chunk; ++i) {
+#ifdef _OPENMP
+			int iw = omp_get_thread_num();
+#else
+			int iw = 0;
+#endif
+			if (R < 0) continue;
+			log_info("VAE tile %d/%d", i+1, n_tile);
+			MLCtx *wc = iw ? &W[iw-1] : C;
+			int r = vae_tile_compute(wc, V, i, &tmp[iw]);
+			if (!iw) C->c.flags_e |= MLB_F_QUIET;
+			if (r < 0) {
+#ifdef _OPENMP
+				#pragma omp critical (vae_tile_error)
+#endif
+				R = r;
+			}
+		}
+		if (R < 0) goto end;
+
+		if (V->sink) {
+			// Rows before the start of the next row of tiles are done
+			int t1 = i_beg / n_chunk + 1,
+			    y1 = t1 < V->n_tile1
+			       ? ccMIN(t1 * V->step1, V->in->n[1] - V->n1)
+			         * V->f_mul / V->f_div
+			       : out_n1;
+			TRY( vae_tiling_emit(V, y1, &band) );
+		}
+	}
+
+	if (!V->sink) {  // Normalize
+		int n_plane = V->out.n[0] * V->out.n[1];
+		ltensor_for(V->out,i,0) V->out.d[i] /= V->wsum.d[i % n_plane];
+	}
+
+end:
+	if (n_worker > 1) ggml__backend_set_n_threads(C->backend, n_thread);
+	vec_forp(MLCtx, W, w, 0) {
+		mlctx_free(w);
+		vec_free(w->lora.hooks);  //lora.items is shared
+		if (w->backend) ggml_backend_free(w->backend);
+	}
+	vec_free(W);
+	vec_for(tmp,i,0) ltensor_free(&tmp[i]);
+	vec_free(tmp);
+	ltensor_free(&band);
+	return R;
+}
+
 int sdvae_encode(MLCtx* C, const VaeParams* P,
-	const LocalTensor* img, LocalTensor* latent, int tile_px)
+	const LocalTensor* img, LocalTensor* latent, int tile_px, int n_worker)
 {
 	int R=1;
-	LocalTensor ltmp={0}, itmp={0};
+	VaeTiling tl={ .in_name="img", .enc=true };
 	
 	const int f = P->f_down,  //latent to image scale (8 for SD)
 	          k = f*8;  //overlap margin to prevent border effects when tiling
@@ -246,51 +507,25 @@ int sdvae_encode(MLCtx* C, const VaeParams* P,
 	// Prepare computation
 	mlctx_begin(C, "VAE encode");
 	if (tile_px > 0) C->c.flags_e |= MLB_F_MULTI_COMPUTE;
-	MLTensor *input = mlctx_input_new(C, "img", GGML_TYPE_F32, n0, n1, 3, 1);
-	MLTensor *output = mlb_sdvae_encoder(C, input, P);
+	MLTensor *input = mlctx_input_new(C, "img", GGML_TYPE_F32, n0, n1, 3, 1),
+	         *output;
+	if (mlctx_cache_get(C, 0)) {
+		input  = C->inputs[0];
+		output = C->result;
+	}
+	else
+		output = mlb_sdvae_encoder(C, input, P);
 	TRY( mlctx_prep(C) );
 
 	if (tile_px > 0) {
 		double t = timing_time();
-		int lat_n0  = img_n0 / f,
-		    lat_n1  = img_n1 / f,
-			step0  = n0 - k*2,  //overlapping
-			step1  = n1 - k*2,
-			n_tile0 = (img_n0 + step0 - 1) / step0,
-			n_tile1 = (img_n1 + step1 - 1) / step1,
-			n_tile  = n_tile0 * n_tile1,
-			i_tile  = 0;
+		vae_tiling_init(&tl, img, n0, n1, k, 1, f);
+		log_debug("VAE encode tiling: size:%d,%d step:%d,%d", n0,n1,
+			tl.step0, tl.step1);
 		
-		log_debug("VAE encode tiling: size:%d,%d step:%d,%d", n0,n1, step0,step1);
-		
-		// Temporal latent tensor in case latent == img
-		ltensor_resize(&ltmp, lat_n0, lat_n1, 8, 1);
-
-		for (int t1=0; t1<n_tile1; ++t1) {
-			int i1 = ccMIN(t1 * step1, img_n1 - n1);
-			for (int t0=0; t0<n_tile0; ++t0, ++i_tile) {
-				int i0 = ccMIN(t0 * step0, img_n0 - n0);
-
-				log_info("VAE tile %d/%d", i_tile+1, n_tile);
-
-				ltensor_resize(&itmp, n0, n1, 3, 1);
-				ltensor_copy_slice2(&itmp, img, n0,n1, 0,0, i0,i1, 1,1, 1,1);
-
-				sdvae_encoder_pre(&itmp, &itmp);
-				ltensor_to_backend(&itmp, input);
-				if (i_tile > 0) C->c.flags_e |= MLB_F_QUIET;
-				TRY( mlctx_compute(C) );
-				ltensor_from_backend(&itmp, output);
-				log_debug3_ltensor(&itmp, "vae enc");
-				
-				int d0 = i0 ? k : 0,
-				    d1 = i1 ? k : 0;
-				ltensor_copy_slice2(&ltmp, &itmp, (n0-k)/f, (n1-k)/f,
-					(i0+d0)/f,(i1+d1)/f, d0/f,d1/f, 1,1, 1,1);
-			}
-		}
+		TRY( vae_tiling_run(C, P, &tl, n_worker, mlb_sdvae_encoder) );
 
-		ltensor_copy(latent, &ltmp);
+		ltensor_copy(latent, &tl.out);  //latent may be img
 		t = timing_time() - t;
 		log_info("VAE encode done {%.3fs}", t);
 	}
@@ -309,23 +544,24 @@ int sdvae_encode(MLCtx* C, const VaeParams* P,
 	log_debug2_ltensor(latent, "vae enc");
 
 end:
-	ltensor_free(&itmp);
-	ltensor_free(&ltmp);
+	vae_tiling_free(&tl);
 	mlctx_end(C);
 	return R;
 }
 
 int sdvae_decode(MLCtx* C, const VaeParams* P,
-	const LocalTensor* latent, LocalTensor* img, int tile_px)
+	const LocalTensor* latent, LocalTensor* img, int tile_px, int n_worker,
+	const VaeRowSink* sink)
 {
 	int R=1;
-	LocalTensor ltmp={0}, itmp={0};
+	VaeTiling tl={ .in_name="latent", .sink=sink };
 
 	assert( isfinite( ltensor_sum(latent) ) );
 
-	TRY( ltensor_shape_check_log(latent, "latent", 0,0,4,1) );
+	TRY( ltensor_shape_check_log(latent, "latent", 0,0,4,0) );
 	int lat_n0 = latent->n[0],  n0 = lat_n0,
-		lat_n1 = latent->n[1],  n1 = lat_n1;
+		lat_n1 = latent->n[1],  n1 = lat_n1,
+		n_batch = latent->n[3];  //all the batch is decoded at once
 	
 	const int f = P->f_down,  //latent to image scale (8 for SD)
 	          k = 8;  //overlap margin to prevent border effects when tiling
@@ -341,53 +577,28 @@ int sdvae_decode(MLCtx* C, const VaeParams* P,
 	// Prepare computation
 	mlctx_begin(C, "VAE decode");
 	if (tile_px > 0) C->c.flags_e |= MLB_F_MULTI_COMPUTE;
-	MLTensor *input = mlctx_input_new(C, "latent", GGML_TYPE_F32, n0, n1, 4, 1);
-	MLTensor *output = mlb_sdvae_decoder(C, input, P);
+	MLTensor *input = mlctx_input_new(C, "latent", GGML_TYPE_F32, n0, n1, 4,
+		n_batch), *output;
+	if (mlctx_cache_get(C, 0)) {
+		input  = C->inputs[0];
+		output = C->result;
+	}
+	else
+		output = mlb_sdvae_decoder(C, input, P);
 	TRY( mlctx_prep(C) );
 
 	if (tile_px > 0) {
 		double t = timing_time();
-		int f = P->f_down,  
-		    img_n0  = lat_n0 * f,
-		    img_n1  = lat_n1 * f,
-			step0  = n0 - k*2,  //overlapping
-			step1  = n1 - k*2,
-			n_tile0 = (lat_n0 + step0 - 1) / step0,
-			n_tile1 = (lat_n1 + step1 - 1) / step1,
-			n_tile  = n_tile0 * n_tile1,
-			i_tile  = 0;
-		
-		log_debug("VAE decode tiling: size:%d,%d step:%d,%d", n0,n1, step0,step1);
+		vae_tiling_init(&tl, latent, n0, n1, k, f, 1);
+		log_debug("VAE decode tiling: size:%d,%d step:%d,%d", n0,n1,
+			tl.step0, tl.step1);
 		
-		// Temporal image tensor in case latent == img
-		ltensor_resize(&itmp, img_n0, img_n1, 3, 1);
-
-		for (int t1=0; t1<n_tile1; ++t1) {
-			int i1 = ccMIN(t1 * step1, lat_n1 - n1);
-			for (int t0=0; t0<n_tile0; ++t0, ++i_tile) {
-				int i0 = ccMIN(t0 * step0, lat_n0 - n0);
-
-				log_info("VAE tile %d/%d", i_tile+1, n_tile);
-
-				ltensor_resize(&ltmp, n0, n1, 4, 1);
-				ltensor_copy_slice2(&ltmp, latent, n0,n1, 0,0, i0,i1, 1,1, 1,1);
-
-				ltensor_to_backend(&ltmp, input);
-				if (i_tile > 0) C->c.flags_e |= MLB_F_QUIET;
-				TRY( mlctx_compute(C) );
-				ltensor_from_backend(&ltmp, output);
-				log_debug3_ltensor(&ltmp, "vae dec");
-				
-				int d0 = i0 ? k : 0,
-				    d1 = i1 ? k : 0;
-				ltensor_copy_slice2(&itmp, &ltmp, (n0-k)*f, (n1-k)*f,
-					(i0+d0)*f,(i1+d1)*f, d0*f,d1*f, 1,1, 1,1);
-			}
-		}
+		TRY( vae_tiling_run(C, P, &tl, n_worker, mlb_sdvae_decoder) );
 
-		ltensor_copy(img, &itmp);
 		t = timing_time() - t;
 		log_info("VAE decode done {%.3fs}", t);
+		if (sink) goto end;  //already sent
+		ltensor_copy(img, &tl.out);  //img may be latent
 	}
 	else {
 		// Set input
@@ -402,10 +613,10 @@ int sdvae_decode(MLCtx* C, const VaeParams* P,
 	
 	sdvae_decoder_post(img, img);
 	log_debug2_ltensor(img, "vae dec");
+	if (sink) TRY( sink->func(sink->user, img, 0, img->n[1]) );
 
 end:
-	ltensor_free(&ltmp);
-	ltensor_free(&itmp);
+	vae_tiling_free(&tl);
 	mlctx_end(C);
 	return R;
 }
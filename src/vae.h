@@ -46,8 +46,27 @@ void sdvae_decoder_post(LocalTensor* out, const LocalTensor* img)
 	ltensor_for(*out,i,0) out->d[i] = (img->d[i]+1)/2;
 }
 
+/* Receives the decoded image in bands of complete rows, from top to bottom.
+ * band: rows [y, y+band->n[1]) of all the images of the batch, in [0,1].
+ * h: total image height.
+ * Return a negative value to abort.
+ */
+typedef struct {
+	int (*func)(void* user, const LocalTensor* band, int y, int h);
+	void *user;
+} VaeRowSink;
+
+/* tile_px: if not zero, computes the image in tiles of this size.
+ * n_worker: number of tiles computed in parallel (CPU backend only).
+ *   The threads (g_ltensor_n_thread) are split between the workers.
+ */
 int sdvae_encode(MLCtx* C, const VaeParams* P,
-	const LocalTensor* img, LocalTensor* latent, int tile_px);
+	const LocalTensor* img, LocalTensor* latent, int tile_px, int n_worker);
 
+/* sink: optional, if set the image is passed to it instead of stored in img.
+ * With tiling, each row of tiles is sent when finished, so that only one row
+ * of tiles is in memory. img is still used as temporal storage.
+ */
 int sdvae_decode(MLCtx* C, const VaeParams* P,
-	const LocalTensor* latent, LocalTensor* img, int tile_px);
+	const LocalTensor* latent, LocalTensor* img, int tile_px, int n_worker,
+	const VaeRowSink* sink);